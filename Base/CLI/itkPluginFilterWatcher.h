@@ -80,6 +80,13 @@ virtual void ShowProgress()
           this->GetProcess()->AbortGenerateDataOn();
           m_ProcessInformation->Progress = 0;
           m_ProcessInformation->StageProgress = 0;
+          // AbortGenerateData is only honored by filters that explicitly
+          // check it; raising ProcessAborted here unwinds the pipeline
+          // immediately so cancellation is not deferred until the filter
+          // happens to complete.
+          itk::ProcessAborted e(__FILE__, __LINE__);
+          e.SetDescription("Module cancelled");
+          throw e;
           }
 
         if (m_ProcessInformation->ProgressCallbackFunction
@@ -107,6 +114,25 @@ virtual void ShowProgress()
     }
 }
 
+//-----------------------------------------------------------------------------
+/** Callback method to show the IterationEvent.
+ * Iterative filters (e.g. level-set evolutions) can run many iterations
+ * between progress updates, so the abort flag is checked here as well to
+ * bound the cancellation latency by the duration of a single iteration. */
+virtual void ShowIteration()
+{
+  this->SetIterations( this->GetIterations() + 1 );
+  if (m_ProcessInformation && m_ProcessInformation->Abort && this->GetProcess())
+    {
+    this->GetProcess()->AbortGenerateDataOn();
+    m_ProcessInformation->Progress = 0;
+    m_ProcessInformation->StageProgress = 0;
+    itk::ProcessAborted e(__FILE__, __LINE__);
+    e.SetDescription("Module cancelled");
+    throw e;
+    }
+}
+
 //-----------------------------------------------------------------------------
 /** Callback method to show the StartEvent */
 virtual void StartFilter()
@@ -17,6 +17,9 @@
 #include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkVersion.h>
 
+// STD includes
+#include <cstring>
+
 vtkCxxSetObjectMacro(vtkImageFillROI,Points,vtkPoints);
 
 //------------------------------------------------------------------------------
@@ -438,6 +441,30 @@ static void DrawLinesFast(int nx, int ny, int nPts, int *xPts, int *yPts,
     }//for
 }
 
+// Fill the (2*rad+1)^2 square centered on (x, y). The square must be
+// entirely inside the output extent (the callers check this). Writing
+// through plain pointer arithmetic instead of calling
+// vtkImageData::GetScalarPointer() for every row makes the stamp cheap
+// enough to be applied once per step of a thick stroke.
+template <class T>
+static void FillSquare(T *basePtr, int rowLength, int min0, int min1,
+                       int x, int y, int rad, T value)
+{
+  T *rowPtr = basePtr + ((vtkIdType)(y - rad - min1)) * rowLength
+                      + (x - rad - min0);
+  int width = 2*rad + 1;
+  for (int yy = 0; yy < width; yy++)
+    {
+    T *outPtr = rowPtr;
+    for (int xx = 0; xx < width; xx++)
+      {
+      *outPtr = value;
+      outPtr++;
+      }
+    rowPtr += rowLength;
+    }
+}
+
 // This corresponds to "DrawThickLine" in vtkImageDrawROI.cxx. Both are
 // used to draw the "Lines" shape (before and after the lines are Applied).
 template <class T>
@@ -448,12 +475,13 @@ static void DrawLines(int nx, int ny, int z, int radius,
   int i, x, y, x1, y1, x2, y2, xx1, xx2, yy1, yy2;
   int min0, max0, min1, max1, min2, max2;
   outData->GetExtent(min0, max0, min1, max1, min2, max2);
-  T *outPtr;
+  T *basePtr = (T*)(outData->GetScalarPointer(min0, min1, z));
+  int rowLength = max0 - min0 + 1;
   int n = nPts;
   int rad = radius;
   //int d = 2*rad+1;
   int dx, dy, dy2, dx2, r, dydx2;
-  int xx, yy, xInc;
+  int xInc;
   (void)nx; (void)ny; // unused ??
 
   for (i=0; i < n-1; i++)
@@ -499,15 +527,7 @@ static void DrawLines(int nx, int ny, int z, int radius,
       y = y1;
 
       // Draw first point with radius r
-      for (yy = y-rad; yy <= y+rad; yy++)
-        {
-        outPtr = (T*)(outData->GetScalarPointer(x-rad, yy, z));
-        for (xx = x-rad; xx <= x+rad; xx++)
-          {
-          *outPtr = value;
-          outPtr++;
-          }
-        }
+      FillSquare(basePtr, rowLength, min0, min1, x, y, rad, value);
 
       // < 45 degree slope
       if (dy <= dx)
@@ -528,28 +548,12 @@ static void DrawLines(int nx, int ny, int z, int radius,
             else
               {
               // Draw now only because it's thick
-              for (yy = y-rad; yy <= y+rad; yy++)
-                {
-                outPtr = (T*)(outData->GetScalarPointer(x-rad, yy, z));
-                for (xx = x-rad; xx <= x+rad; xx++)
-                  {
-                  *outPtr = value;
-                  outPtr++;
-                  }
-                }
+              FillSquare(basePtr, rowLength, min0, min1, x, y, rad, value);
               y++;
               r += dydx2;
               }
             // Draw point with radius r
-            for (yy = y-rad; yy <= y+rad; yy++)
-              {
-              outPtr = (T*)(outData->GetScalarPointer(x-rad, yy, z));
-              for (xx = x-rad; xx <= x+rad; xx++)
-                {
-                *outPtr = value;
-                outPtr++;
-                }
-              }
+            FillSquare(basePtr, rowLength, min0, min1, x, y, rad, value);
             }
           }
         else
@@ -564,28 +568,12 @@ static void DrawLines(int nx, int ny, int z, int radius,
             else
               {
               // Draw now only because it's thick
-              for (yy = y-rad; yy <= y+rad; yy++)
-                {
-                outPtr = (T*)(outData->GetScalarPointer(x-rad, yy, z));
-                for (xx = x-rad; xx <= x+rad; xx++)
-                  {
-                  *outPtr = value;
-                  outPtr++;
-                  }
-                }
+              FillSquare(basePtr, rowLength, min0, min1, x, y, rad, value);
               y++;
               r += dydx2;
               }
             // Draw point with radius r
-            for (yy = y-rad; yy <= y+rad; yy++)
-              {
-              outPtr = (T*)(outData->GetScalarPointer(x-rad, yy, z));
-              for (xx = x-rad; xx <= x+rad; xx++)
-                {
-                *outPtr = value;
-                outPtr++;
-                }
-              }
+            FillSquare(basePtr, rowLength, min0, min1, x, y, rad, value);
             }
           }
         }
@@ -612,15 +600,7 @@ static void DrawLines(int nx, int ny, int z, int radius,
             r += dydx2;
             }
           // Draw point with radius r
-          for (yy = y-rad; yy <= y+rad; yy++)
-            {
-            outPtr = (T*)(outData->GetScalarPointer(x-rad, yy, z));
-            for (xx = x-rad; xx <= x+rad; xx++)
-              {
-              *outPtr = value;
-              outPtr++;
-              }
-            }
+          FillSquare(basePtr, rowLength, min0, min1, x, y, rad, value);
           }
         }
       }
@@ -632,10 +612,11 @@ static void DrawPoints(int nx, int ny, int z, int radius,
         int nPts, int *xPts, int *yPts,
         T value, vtkImageData *outData)
 {
-  int i, x, y, x1, y1;
-  T *outPtr;
+  int i, x1, y1;
   int min0, max0, min1, max1, min2, max2;
   outData->GetExtent(min0, max0, min1, max1, min2, max2);
+  T *basePtr = (T*)(outData->GetScalarPointer(min0, min1, z));
+  int rowLength = max0 - min0 + 1;
   int n = nPts;
   int r = radius;
   //int d = 2*r+1;
@@ -649,15 +630,7 @@ static void DrawPoints(int nx, int ny, int z, int radius,
     if (x1-r >= min0 && x1+r <= max0 &&
       y1-r >= min1 && y1+r <= max1)
       {
-      for (y = y1-r; y <= y1+r; y++)
-        {
-        outPtr = (T*)(outData->GetScalarPointer(x1-r, y, z));
-        for (x = x1-r; x <= x1+r; x++)
-          {
-          *outPtr = value;
-          outPtr++;
-          }
-        }
+      FillSquare(basePtr, rowLength, min0, min1, x1, y1, r, value);
       }
     }
 }
@@ -704,14 +677,10 @@ static void vtkImageFillROIExecute(vtkImageFillROI* self,
   outPtr = (T*)outData->GetScalarPointerForExtent(outExt);
 
   // zero out the background (added when filter switched from
-  // in place to being image to image).
-  for (int xx = 0; xx < nx; xx++)
-    {
-    for (int yy = 0; yy < ny; yy++)
-      {
-      outPtr[xx + nx*yy] = 0;
-      }
-    }
+  // in place to being image to image). All supported scalar types
+  // represent zero as an all-zero bit pattern, so the whole slice can
+  // be cleared in one sequential pass.
+  memset(outPtr, 0, ((size_t)nx) * ny * sizeof(T));
 
   switch (self->GetShape())
     {
@@ -43,6 +43,7 @@
 
 // STD includes
 #include <algorithm>
+#include <cstdio>
 
 #ifdef ITK_USE_PTHREADS
 # include <unistd.h>
@@ -50,12 +51,30 @@
 # include <sys/resource.h>
 #endif
 
+#include <deque>
 #include <queue>
 
 #include "vtkSlicerApplicationLogicRequests.h"
 
+namespace
+{
 //----------------------------------------------------------------------------
-class ProcessingTaskQueue : public std::queue<vtkSmartPointer<vtkSlicerTask> > {};
+// Shared state of the worker threads spawned from
+// vtkSlicerApplicationLogic::PrefetchReadDataFiles(). The workers pull
+// filenames off the list one by one until the list is exhausted.
+struct FilePrefetchJob
+{
+  std::vector<std::string> Filenames;
+  itk::MutexLock::Pointer Lock;
+  size_t NextFileIndex;
+};
+} // end of anonymous namespace
+
+//----------------------------------------------------------------------------
+// A deque rather than a queue so that the processing threads can scan
+// past tasks that are not runnable yet (wrong type, or affinity key
+// already active on another thread) and pull out the best candidate.
+class ProcessingTaskQueue : public std::deque<vtkSmartPointer<vtkSlicerTask> > {};
 class ModifiedQueue : public std::queue<vtkSmartPointer<vtkObject> > {};
 class ReadDataQueue : public std::queue<DataRequest*> {};
 class WriteDataQueue : public std::queue<DataRequest*> {};
@@ -68,6 +87,8 @@ vtkSlicerApplicationLogic::vtkSlicerApplicationLogic()
 {
   this->ProcessingThreader = itk::MultiThreader::New();
   this->ProcessingThreadId = -1;
+  this->NumberOfProcessingThreads = 0;
+  this->NumberOfNetworkingThreads = 4;
   this->ProcessingThreadActive = false;
   this->ProcessingThreadActiveLock = itk::MutexLock::New();
   this->ProcessingTaskQueueLock = itk::MutexLock::New();
@@ -84,12 +105,16 @@ vtkSlicerApplicationLogic::vtkSlicerApplicationLogic()
   this->WriteDataQueueActiveLock = itk::MutexLock::New();
   this->WriteDataQueueLock = itk::MutexLock::New();
 
+  this->ImmediateRequestDelay = 0;
+
   this->InternalTaskQueue = new ProcessingTaskQueue;
   this->InternalModifiedQueue = new ModifiedQueue;
 
   this->InternalReadDataQueue = new ReadDataQueue;
   this->InternalWriteDataQueue = new WriteDataQueue;
 
+  this->ReadDataBatchSize = 8;
+
   this->UserInformation = vtkPersonInformation::New();
 }
 
@@ -106,10 +131,19 @@ vtkSlicerApplicationLogic::~vtkSlicerApplicationLogic()
     this->ProcessingThreadActive = false;
     this->ProcessingThreadActiveLock->Unlock();
 
-    // Wait for the thread to finish and clean up the state of the threader
+    // Wait for the threads to finish and clean up the state of the threader
     this->ProcessingThreader->TerminateThread( this->ProcessingThreadId );
 
     this->ProcessingThreadId = -1;
+
+    std::vector<int>::const_iterator idIterator;
+    idIterator = this->ProcessingThreadIDs.begin();
+    while (idIterator != this->ProcessingThreadIDs.end())
+      {
+      this->ProcessingThreader->TerminateThread( *idIterator );
+      ++idIterator;
+      }
+    this->ProcessingThreadIDs.clear();
     }
 
   delete this->InternalTaskQueue;
@@ -199,30 +233,37 @@ void vtkSlicerApplicationLogic::CreateProcessingThread()
     this->ProcessingThreadActive = true;
     this->ProcessingThreadActiveLock->Unlock();
 
+    // Size the processing thread pool to the machine unless the
+    // application configured an explicit size
+    int numberOfProcessingThreads = this->NumberOfProcessingThreads;
+    if (numberOfProcessingThreads <= 0)
+      {
+      numberOfProcessingThreads
+        = itk::MultiThreader::GetGlobalDefaultNumberOfThreads();
+      }
+
     this->ProcessingThreadId
       = this->ProcessingThreader
       ->SpawnThread(vtkSlicerApplicationLogic::ProcessingThreaderCallback,
                     this);
 
-    // Start four network threads (TODO: make the number of threads a setting)
-    this->NetworkingThreadIDs.push_back ( this->ProcessingThreader
-          ->SpawnThread(vtkSlicerApplicationLogic::NetworkingThreaderCallback,
-                    this) );
-    /*
-     * TODO: it looks like curl is not thread safe by default
-     * - maybe there's a setting that cmcurl can have
-     *   similar to the --enable-threading of the standard curl build
-     *
-    this->NetworkingThreadIDs.push_back ( this->ProcessingThreader
-          ->SpawnThread(vtkSlicerApplicationLogic::NetworkingThreaderCallback,
-                    this) );
-    this->NetworkingThreadIDs.push_back ( this->ProcessingThreader
-          ->SpawnThread(vtkSlicerApplicationLogic::NetworkingThreaderCallback,
-                    this) );
-    this->NetworkingThreadIDs.push_back ( this->ProcessingThreader
-          ->SpawnThread(vtkSlicerApplicationLogic::NetworkingThreaderCallback,
+    for (int thread = 1; thread < numberOfProcessingThreads; ++thread)
+      {
+      this->ProcessingThreadIDs.push_back ( this->ProcessingThreader
+          ->SpawnThread(vtkSlicerApplicationLogic::ProcessingThreaderCallback,
                     this) );
-    */
+      }
+
+    // Start the network threads. Each transfer drives its own curl
+    // handle (curl is thread safe as long as a handle is only used by
+    // one thread at a time), so several downloads can run while the
+    // main thread decompresses and reads earlier ones into the scene.
+    for (int thread = 0; thread < this->NumberOfNetworkingThreads; ++thread)
+      {
+      this->NetworkingThreadIDs.push_back ( this->ProcessingThreader
+            ->SpawnThread(vtkSlicerApplicationLogic::NetworkingThreaderCallback,
+                      this) );
+      }
 
     // Setup the communication channel back to the main thread
     this->ModifiedQueueActiveLock->Lock();
@@ -235,7 +276,12 @@ void vtkSlicerApplicationLogic::CreateProcessingThread()
     this->WriteDataQueueActive = true;
     this->WriteDataQueueActiveLock->Unlock();
 
-    int delay = 1000;
+    // Prime one pass over each queue. Further processing is event
+    // driven: every Request* call posts a wake-up through
+    // NotifyRequestQueued and the Process* methods only re-arm their
+    // timer while entries remain, so the queues are not polled when
+    // idle.
+    int delay = 0;
     this->InvokeEvent(vtkSlicerApplicationLogic::RequestModifiedEvent, &delay);
     this->InvokeEvent(vtkSlicerApplicationLogic::RequestReadDataEvent, &delay);
     this->InvokeEvent(vtkSlicerApplicationLogic::RequestWriteDataEvent, &delay);
@@ -267,6 +313,14 @@ void vtkSlicerApplicationLogic::TerminateProcessingThread()
     this->ProcessingThreadId = -1;
 
     std::vector<int>::const_iterator idIterator;
+    idIterator = this->ProcessingThreadIDs.begin();
+    while (idIterator != this->ProcessingThreadIDs.end())
+      {
+      this->ProcessingThreader->TerminateThread( *idIterator );
+      ++idIterator;
+      }
+    this->ProcessingThreadIDs.clear();
+
     idIterator = this->NetworkingThreadIDs.begin();
     while (idIterator != this->NetworkingThreadIDs.end())
       {
@@ -329,29 +383,59 @@ void vtkSlicerApplicationLogic::ProcessProcessingTasks()
 
     if (active)
       {
-      // pull a task off the queue
+      // pull the best runnable task off the queue: the highest priority
+      // processing task whose affinity key is not already executing on
+      // another thread of the pool; ties are broken by scheduling order
+      std::string affinityKey;
       this->ProcessingTaskQueueLock->Lock();
-      if ((*this->InternalTaskQueue).size() > 0)
+      ProcessingTaskQueue::iterator bestTask = (*this->InternalTaskQueue).end();
+      ProcessingTaskQueue::iterator taskIterator;
+      for (taskIterator = (*this->InternalTaskQueue).begin();
+           taskIterator != (*this->InternalTaskQueue).end();
+           ++taskIterator)
         {
-        // std::cout << "Number of queued tasks: " << (*this->InternalTaskQueue).size() << std::endl;
-
         // only handle processing tasks in this thread
-        task = (*this->InternalTaskQueue).front();
-        if ( task->GetType() == vtkSlicerTask::Processing )
+        if ( (*taskIterator)->GetType() != vtkSlicerTask::Processing )
           {
-          (*this->InternalTaskQueue).pop();
+          continue;
           }
-        else
+        std::string candidateKey = (*taskIterator)->GetAffinityKey();
+        if ( !candidateKey.empty()
+             && this->ActiveAffinityKeys.find(candidateKey)
+                != this->ActiveAffinityKeys.end() )
           {
-          task = NULL;
+          // a task with the same affinity key is already running,
+          // leave this one for later to keep them serialized
+          continue;
+          }
+        if ( bestTask == (*this->InternalTaskQueue).end()
+             || (*taskIterator)->GetPriority() > (*bestTask)->GetPriority() )
+          {
+          bestTask = taskIterator;
+          }
+        }
+      if (bestTask != (*this->InternalTaskQueue).end())
+        {
+        task = *bestTask;
+        (*this->InternalTaskQueue).erase(bestTask);
+        affinityKey = task->GetAffinityKey();
+        if (!affinityKey.empty())
+          {
+          this->ActiveAffinityKeys.insert(affinityKey);
           }
         }
       this->ProcessingTaskQueueLock->Unlock();
 
-      // process the task (should this be in a separate thread?)
+      // process the task
       if (task)
         {
         task->Execute();
+        if (!affinityKey.empty())
+          {
+          this->ProcessingTaskQueueLock->Lock();
+          this->ActiveAffinityKeys.erase(affinityKey);
+          this->ProcessingTaskQueueLock->Unlock();
+          }
         task = 0;
         }
       }
@@ -419,7 +503,7 @@ void vtkSlicerApplicationLogic::ProcessNetworkingTasks()
         task = (*this->InternalTaskQueue).front();
         if ( task->GetType() == vtkSlicerTask::Networking )
           {
-          (*this->InternalTaskQueue).pop();
+          (*this->InternalTaskQueue).pop_front();
           }
         else
           {
@@ -454,11 +538,22 @@ int vtkSlicerApplicationLogic::ScheduleTask( vtkSlicerTask *task )
     }
 
   this->ProcessingTaskQueueLock->Lock();
-  (*this->InternalTaskQueue).push( task );
+  (*this->InternalTaskQueue).push_back( task );
   this->ProcessingTaskQueueLock->Unlock();
   return true;
 }
 
+//----------------------------------------------------------------------------
+void vtkSlicerApplicationLogic::NotifyRequestQueued(unsigned long requestEvent)
+{
+  // The RequestInvokeEvent channel hands the event over to the main
+  // thread, so this is safe to call from the processing and networking
+  // threads. The delay call data must outlive this call, hence the
+  // persistent member.
+  this->InvokeEventWithDelay(0, this, requestEvent,
+                             &this->ImmediateRequestDelay);
+}
+
 //----------------------------------------------------------------------------
 vtkMTimeType vtkSlicerApplicationLogic::RequestModified(vtkObject *obj)
 {
@@ -478,6 +573,7 @@ vtkMTimeType vtkSlicerApplicationLogic::RequestModified(vtkObject *obj)
   vtkMTimeType uid = this->RequestTimeStamp.GetMTime();
   (*this->InternalModifiedQueue).push(obj);
   this->ModifiedQueueLock->Unlock();
+  this->NotifyRequestQueued(vtkSlicerApplicationLogic::RequestModifiedEvent);
   return uid;
 }
 
@@ -500,6 +596,7 @@ vtkMTimeType vtkSlicerApplicationLogic::RequestReadFile(const char *refNode, con
   (*this->InternalReadDataQueue).push(
     new ReadDataRequestFile(refNode, filename, displayData, deleteFile, uid));
   this->ReadDataQueueLock->Unlock();
+  this->NotifyRequestQueued(vtkSlicerApplicationLogic::RequestReadDataEvent);
   return uid;
 }
 
@@ -521,6 +618,7 @@ vtkMTimeType vtkSlicerApplicationLogic::RequestUpdateParentTransform(const std::
   vtkMTimeType uid = this->RequestTimeStamp.GetMTime();
   (*this->InternalReadDataQueue).push(new ReadDataRequestUpdateParentTransform(refNode, parentTransformNode, uid));
   this->ReadDataQueueLock->Unlock();
+  this->NotifyRequestQueued(vtkSlicerApplicationLogic::RequestReadDataEvent);
   return uid;
 }
 
@@ -542,6 +640,7 @@ vtkMTimeType vtkSlicerApplicationLogic::RequestUpdateSubjectHierarchyLocation(co
   vtkMTimeType uid = this->RequestTimeStamp.GetMTime();
   (*this->InternalReadDataQueue).push(new ReadDataRequestUpdateSubjectHierarchyLocation(updatedNode, siblingNode, uid));
   this->ReadDataQueueLock->Unlock();
+  this->NotifyRequestQueued(vtkSlicerApplicationLogic::RequestReadDataEvent);
   return uid;
 }
 
@@ -564,6 +663,7 @@ vtkMTimeType vtkSlicerApplicationLogic::RequestWriteData(const char *refNode, co
   (*this->InternalWriteDataQueue).push(
     new WriteDataRequestFile(refNode, filename, uid) );
   this->WriteDataQueueLock->Unlock();
+  this->NotifyRequestQueued(vtkSlicerApplicationLogic::RequestWriteDataEvent);
   return uid;
 }
 
@@ -591,6 +691,7 @@ vtkMTimeType vtkSlicerApplicationLogic::RequestReadScene(
   (*this->InternalReadDataQueue).push(
     new ReadDataRequestScene(targetIDs, sourceIDs, filename, displayData, deleteFile, uid));
   this->ReadDataQueueLock->Unlock();
+  this->NotifyRequestQueued(vtkSlicerApplicationLogic::RequestReadDataEvent);
   return uid;
 }
 
@@ -633,10 +734,13 @@ void vtkSlicerApplicationLogic::ProcessModified()
     obj = 0;
     }
 
-  // schedule the next timer sooner in case there is stuff in the queue
-  // otherwise for a while later
-  int delay = (*this->InternalModifiedQueue).size() > 0 ? 0: 200;
-  this->InvokeEvent(vtkSlicerApplicationLogic::RequestModifiedEvent, &delay);
+  // re-arm only while there are entries left; an empty queue is woken
+  // up again by the next RequestModified call
+  if ((*this->InternalModifiedQueue).size() > 0)
+    {
+    int delay = 0;
+    this->InvokeEvent(vtkSlicerApplicationLogic::RequestModifiedEvent, &delay);
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -651,33 +755,116 @@ void vtkSlicerApplicationLogic::ProcessReadData()
     return;
     }
 
-  // pull an object off the queue
-  DataRequest* req = NULL;
+  // pull a batch of objects off the queue
+  std::vector<DataRequest*> requests;
   this->ReadDataQueueLock->Lock();
-  if ((*this->InternalReadDataQueue).size() > 0)
+  while ((*this->InternalReadDataQueue).size() > 0
+    && static_cast<int>(requests.size()) < this->ReadDataBatchSize)
     {
-    req = (*this->InternalReadDataQueue).front();
+    requests.push_back((*this->InternalReadDataQueue).front());
     (*this->InternalReadDataQueue).pop();
     }
   this->ReadDataQueueLock->Unlock();
 
-  vtkMTimeType uid = 0;
-  if (req)
+  // Warm the OS file cache for all files of the batch concurrently. The
+  // requests themselves must still be executed serially on the main thread
+  // as they modify MRML nodes, but the expensive cold-storage IO of the
+  // independent reads is overlapped this way.
+  this->PrefetchReadDataFiles(requests);
+
+  for (std::vector<DataRequest*>::iterator reqIt = requests.begin();
+       reqIt != requests.end(); ++reqIt)
     {
-    uid = req->GetUID();
+    DataRequest* req = *reqIt;
+    vtkMTimeType uid = req->GetUID();
     req->Execute(this);
     delete req;
+    if (uid)
+      {
+      this->InvokeEvent(vtkSlicerApplicationLogic::RequestProcessedEvent,
+                        reinterpret_cast<void*>(uid));
+      }
+    }
+
+  // re-arm only while there are entries left; an empty queue is woken
+  // up again by the next read request
+  if ((*this->InternalReadDataQueue).size() > 0)
+    {
+    int delay = 0;
+    this->InvokeEvent(vtkSlicerApplicationLogic::RequestReadDataEvent, &delay);
+    }
+}
+
+//----------------------------------------------------------------------------
+ITK_THREAD_RETURN_TYPE
+vtkSlicerApplicationLogic
+::PrefetchFilesThreaderCallback( void *arg )
+{
+  FilePrefetchJob* job
+    = (FilePrefetchJob*)
+    (((itk::MultiThreader::ThreadInfoStruct *)(arg))->UserData);
+
+  std::vector<char> buffer(1024 * 1024);
+  while (true)
+    {
+    job->Lock->Lock();
+    size_t fileIndex = job->NextFileIndex++;
+    job->Lock->Unlock();
+    if (fileIndex >= job->Filenames.size())
+      {
+      break;
+      }
+    // Read through the file, discarding the contents; this populates the
+    // OS file cache so that the storage node read on the main thread does
+    // not have to wait for the disk.
+    FILE* file = fopen(job->Filenames[fileIndex].c_str(), "rb");
+    if (!file)
+      {
+      continue;
+      }
+    while (fread(&buffer[0], 1, buffer.size(), file) == buffer.size())
+      {
+      }
+    fclose(file);
     }
 
-  int delay = (*this->InternalReadDataQueue).size() > 0 ? 0: 200;
-  // schedule the next timer sooner in case there is stuff in the queue
-  // otherwise for a while later
-  this->InvokeEvent(vtkSlicerApplicationLogic::RequestReadDataEvent, &delay);
-  if (uid)
+  return ITK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+void vtkSlicerApplicationLogic::PrefetchReadDataFiles(const std::vector<DataRequest*>& requests)
+{
+  FilePrefetchJob job;
+  job.Lock = itk::MutexLock::New();
+  job.NextFileIndex = 0;
+  for (std::vector<DataRequest*>::const_iterator reqIt = requests.begin();
+       reqIt != requests.end(); ++reqIt)
+    {
+    ReadDataRequestFile* fileRequest = dynamic_cast<ReadDataRequestFile*>(*reqIt);
+    if (!fileRequest)
+      {
+      continue;
+      }
+    // Remote references are staged by the cache manager, only local files
+    // can be prefetched here.
+    if (itksys::SystemTools::FileExists(fileRequest->GetFilename().c_str(), true))
+      {
+      job.Filenames.push_back(fileRequest->GetFilename());
+      }
+    }
+  if (job.Filenames.size() < 2)
     {
-    this->InvokeEvent(vtkSlicerApplicationLogic::RequestProcessedEvent,
-                      reinterpret_cast<void*>(uid));
+    // nothing to overlap
+    return;
     }
+
+  itk::MultiThreader::Pointer threader = itk::MultiThreader::New();
+  int numberOfThreads = static_cast<int>(
+    std::min<size_t>(job.Filenames.size(),
+                     static_cast<size_t>(threader->GetNumberOfThreads())));
+  threader->SetNumberOfThreads(numberOfThreads);
+  threader->SetSingleMethod(vtkSlicerApplicationLogic::PrefetchFilesThreaderCallback, &job);
+  threader->SingleMethodExecute();
 }
 
 //----------------------------------------------------------------------------
@@ -708,10 +895,13 @@ void vtkSlicerApplicationLogic::ProcessWriteData()
     req->Execute(this);
     delete req;
 
-    // schedule the next timer sooner in case there is stuff in the queue
-    // otherwise for a while later
-    int delay = (*this->InternalWriteDataQueue).size() > 0 ? 0 : 200;
-    this->InvokeEvent(vtkSlicerApplicationLogic::RequestWriteDataEvent, &delay);
+    // re-arm only while there are entries left; an empty queue is woken
+    // up again by the next write request
+    if ((*this->InternalWriteDataQueue).size() > 0)
+      {
+      int delay = 0;
+      this->InvokeEvent(vtkSlicerApplicationLogic::RequestWriteDataEvent, &delay);
+      }
     if (uid)
       {
       this->InvokeEvent(vtkSlicerApplicationLogic::RequestProcessedEvent,
@@ -31,12 +31,16 @@
 #include <itkMultiThreader.h>
 #include <itkMutexLock.h>
 
+// STD includes
+#include <set>
+
 class vtkMRMLSelectionNode;
 class vtkMRMLInteractionNode;
 class vtkMRMLRemoteIOLogic;
 class vtkDataIOManagerLogic;
 class vtkPersonInformation;
 class vtkSlicerTask;
+class DataRequest;
 class ModifiedQueue;
 class ProcessingTaskQueue;
 class ReadDataQueue;
@@ -70,9 +74,30 @@ class VTK_SLICER_BASE_LOGIC_EXPORT vtkSlicerApplicationLogic
   /// (display it in the Fiducials GUI)
   void PropagateFiducialListSelection();
 
-  /// Create a thread for processing
+  /// Create a pool of threads for processing
   void CreateProcessingThread();
 
+  /// Number of threads in the processing thread pool. 0 (the default)
+  /// sizes the pool to the number of cores of the machine. Must be set
+  /// before CreateProcessingThread() is called to have an effect.
+  /// Independent tasks run concurrently on the pool; tasks sharing a
+  /// non-empty affinity key are serialized and higher priority tasks
+  /// are picked first.
+  /// \sa vtkSlicerTask::SetPriority(), vtkSlicerTask::SetAffinityKey()
+  vtkSetClampMacro(NumberOfProcessingThreads, int, 0, 64);
+  vtkGetMacro(NumberOfProcessingThreads, int);
+
+  /// Number of threads running networking tasks. With more than one
+  /// thread the next remote file downloads while earlier ones are
+  /// decompressed and read into the scene by the main thread, so
+  /// multi-file remote scene loads pipeline instead of running each
+  /// transfer to completion first. The URI handlers drive a curl
+  /// handle per transfer, which keeps concurrent transfers safe.
+  /// Must be set before CreateProcessingThread() is called to have
+  /// an effect.
+  vtkSetClampMacro(NumberOfNetworkingThreads, int, 1, 8);
+  vtkGetMacro(NumberOfNetworkingThreads, int);
+
   /// Shutdown the processing thread
   void TerminateProcessingThread();
   /// List of events potentially fired by the application logic
@@ -136,6 +161,15 @@ class VTK_SLICER_BASE_LOGIC_EXPORT vtkSlicerApplicationLogic
   /// multiple items are being returned and have all been returned).
   unsigned int GetReadDataQueueSize();
 
+  /// Number of read requests processed per ProcessReadData() call.
+  /// The requests of a batch are still executed serially on the main thread
+  /// (storage nodes are not thread-safe), but the local files they reference
+  /// are prefetched concurrently by a worker pool beforehand, so the serial
+  /// ReadData calls operate on a warm OS file cache instead of cold storage.
+  /// Default is 8. Set to 1 to process a single request per timer callback.
+  /// \sa ProcessReadData()
+  vtkSetClampMacro(ReadDataBatchSize, int, 1, 128);
+  vtkGetMacro(ReadDataBatchSize, int);
 
   /// Request that data be written from a file to a remote destination.
   /// Return the request UID (monotonically increasing) of the request or 0 if
@@ -222,6 +256,16 @@ protected:
   /// Callback used by a MultiThreader to start a networking thread
   static ITK_THREAD_RETURN_TYPE NetworkingThreaderCallback( void * );
 
+  /// Callback used by a MultiThreader to prefetch files of a read
+  /// request batch
+  static ITK_THREAD_RETURN_TYPE PrefetchFilesThreaderCallback( void * );
+
+  /// Concurrently read through the local files referenced by the given
+  /// read requests so that the subsequent serial storage node reads hit
+  /// the OS file cache.
+  /// \sa ProcessReadData(), SetReadDataBatchSize()
+  void PrefetchReadDataFiles(const std::vector<DataRequest*>& requests);
+
   /// Task processing loop that is run in the processing thread
   void ProcessProcessingTasks();
 
@@ -235,6 +279,16 @@ protected:
   void ProcessReadSceneData( ReadDataRequest &req );
   void ProcessWriteSceneData( WriteDataRequest &req );
 
+  /// Wake the main thread so it drains the queue associated with the
+  /// given request event right away. Called by the Request* methods
+  /// after enqueueing; safe to call from the processing and networking
+  /// threads because it goes through the RequestInvokeEvent channel.
+  /// This makes queue processing event driven: the Process* methods
+  /// only re-arm their timer while their queue still holds entries, so
+  /// nothing polls when the queues are idle and completed background
+  /// tasks are picked up without waiting out a polling interval.
+  void NotifyRequestQueued(unsigned long requestEvent);
+
 private:
   vtkSlicerApplicationLogic(const vtkSlicerApplicationLogic&);
   void operator=(const vtkSlicerApplicationLogic&);
@@ -250,17 +304,29 @@ private:
   itk::MutexLock::Pointer WriteDataQueueLock;
   vtkTimeStamp RequestTimeStamp;
   int ProcessingThreadId;
+  std::vector<int> ProcessingThreadIDs;
   std::vector<int> NetworkingThreadIDs;
   int ProcessingThreadActive;
+  int NumberOfProcessingThreads;
+  int NumberOfNetworkingThreads;
+  /// Affinity keys of the tasks currently executing on the processing
+  /// thread pool, protected by ProcessingTaskQueueLock
+  std::set<std::string> ActiveAffinityKeys;
   int ModifiedQueueActive;
   int ReadDataQueueActive;
   int WriteDataQueueActive;
+  /// Persistent zero delay passed as call data of the wake-up events
+  /// posted by NotifyRequestQueued; the pointer must stay valid until
+  /// the scheduled event fires on the main thread.
+  int ImmediateRequestDelay;
 
   ProcessingTaskQueue* InternalTaskQueue;
   ModifiedQueue*       InternalModifiedQueue;
   ReadDataQueue*       InternalReadDataQueue;
   WriteDataQueue*      InternalWriteDataQueue;
 
+  int ReadDataBatchSize;
+
   vtkPersonInformation* UserInformation;
 
   /// For use with external tracing tool (such as AQTime)
@@ -51,6 +51,11 @@ public:
     m_DeleteFile = deleteFile;
   }
 
+  /// Filename the request will read from. Used by
+  /// vtkSlicerApplicationLogic::PrefetchReadDataFiles() to warm the file
+  /// cache for a batch of requests before they are executed.
+  const std::string& GetFilename()const{return m_Filename;}
+
   void Execute(vtkSlicerApplicationLogic* appLogic)
   {
     // This method needs to read the data into the specific type of node and set up an
@@ -66,8 +71,14 @@ public:
 
     bool useURI = appLogic->GetMRMLScene()->GetCacheManager()->IsRemoteReference(m_Filename.c_str());
 
+    // A scene reference ("slicer:%p#%s") means the module wrote its result
+    // directly into the target node through the in-memory bridge; there is
+    // no file to read back. Skip the storage node machinery and only run
+    // the display-side handling below.
+    bool sceneReference = (m_Filename.compare(0, 7, "slicer:") == 0);
+
     vtkMRMLStorableNode *storableNode = vtkMRMLStorableNode::SafeDownCast(nd);
-    if (storableNode)
+    if (storableNode && !sceneReference)
       {
       int numStorageNodes = storableNode->GetNumberOfStorageNodes();
       for (int n = 0; n < numStorageNodes; n++)
@@ -12,6 +12,8 @@ vtkSlicerTask::vtkSlicerTask()
   this->TaskObject = 0;
   this->TaskFunction = 0;
   this->Type = vtkSlicerTask::Undefined;
+  this->Priority = vtkSlicerTask::PriorityNormal;
+  this->AffinityKey = "";
 }
 //----------------------------------------------------------------------------
 vtkSlicerTask::~vtkSlicerTask()
@@ -37,8 +39,29 @@ void vtkSlicerTask::Execute()
     }
 }
 
+//----------------------------------------------------------------------------
+void vtkSlicerTask::SetAffinityKey(const char* key)
+{
+  std::string newKey = key ? key : "";
+  if (newKey == this->AffinityKey)
+    {
+    return;
+    }
+  this->AffinityKey = newKey;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+const char* vtkSlicerTask::GetAffinityKey() const
+{
+  return this->AffinityKey.c_str();
+}
+
 //----------------------------------------------------------------------------
 void vtkSlicerTask::PrintSelf(ostream& os, vtkIndent indent)
 {
   Superclass::PrintSelf(os, indent);
+  os << indent << "Type: " << this->GetTypeAsString() << "\n";
+  os << indent << "Priority: " << this->Priority << "\n";
+  os << indent << "AffinityKey: " << this->AffinityKey << "\n";
 }
@@ -6,6 +6,9 @@
 #include "vtkMRMLAbstractLogic.h"
 #include "vtkSlicerBaseLogic.h"
 
+// STL includes
+#include <string>
+
 class VTK_SLICER_BASE_LOGIC_EXPORT vtkSlicerTask : public vtkObject
 {
 public:
@@ -48,6 +51,33 @@ public:
     return "Unknown";
   }
 
+  ///
+  /// The priority of the task - when several tasks are waiting, the
+  /// processing threads pick higher priority tasks first; tasks of the
+  /// same priority run in scheduling order
+  enum
+    {
+    PriorityLow = 0,
+    PriorityNormal,
+    PriorityHigh
+    };
+
+  vtkSetClampMacro (Priority, int, vtkSlicerTask::PriorityLow, vtkSlicerTask::PriorityHigh);
+  vtkGetMacro (Priority, int);
+  void SetPriorityToLow() {this->SetPriority(vtkSlicerTask::PriorityLow);};
+  void SetPriorityToNormal() {this->SetPriority(vtkSlicerTask::PriorityNormal);};
+  void SetPriorityToHigh() {this->SetPriority(vtkSlicerTask::PriorityHigh);};
+
+  ///
+  /// Affinity hint of the task: tasks carrying the same non-empty key
+  /// are never executed concurrently (they run in scheduling order on
+  /// whichever processing thread becomes available). Use it to serialize
+  /// tasks that share state that is not thread-safe, e.g. tasks
+  /// operating on the same MRML node. Empty by default, which imposes
+  /// no constraint.
+  void SetAffinityKey(const char* key);
+  const char* GetAffinityKey() const;
+
 protected:
   vtkSlicerTask();
   virtual ~vtkSlicerTask();
@@ -60,6 +90,8 @@ private:
   void *TaskClientData;
 
   int Type;
+  int Priority;
+  std::string AffinityKey;
 
 };
 #endif
@@ -125,6 +125,24 @@ int vtkTransformVisualizerGlyph3D::RequestData(
   vtkNew<vtkIdList> pts;
   pts->Allocate(VTK_CELL_SIZE);
 
+  // Cache the source glyph topology. The cell structure is the same for
+  // every glyph (only the point ids are shifted), and source->GetCell()
+  // is too expensive to be called numPts * numSourceCells times.
+  std::vector<int> sourceCellTypes(numSourceCells);
+  std::vector<std::vector<vtkIdType> > sourceCellPointIds(numSourceCells);
+  for (vtkIdType cellId=0; cellId < numSourceCells; cellId++)
+    {
+    vtkCell *cell = source->GetCell(cellId);
+    sourceCellTypes[cellId] = cell->GetCellType();
+    vtkIdList *cellPts = cell->GetPointIds();
+    vtkIdType npts = cellPts->GetNumberOfIds();
+    sourceCellPointIds[cellId].resize(npts);
+    for (vtkIdType i=0; i < npts; i++)
+      {
+      sourceCellPointIds[cellId][i] = cellPts->GetId(i);
+      }
+    }
+
   // Traverse all Input points, transforming Source points and copying
   // point attributes.
   vtkIdType ptIncr=0;
@@ -157,15 +175,14 @@ int vtkTransformVisualizerGlyph3D::RequestData(
     // Copy all topology (transformation independent)
     for (vtkIdType cellId=0; cellId < numSourceCells; cellId++)
       {
-      vtkCell *cell = source->GetCell(cellId);
-      vtkIdList *cellPts = cell->GetPointIds();
-      int npts = cellPts->GetNumberOfIds();
+      const std::vector<vtkIdType>& cellPts = sourceCellPointIds[cellId];
+      vtkIdType npts = static_cast<vtkIdType>(cellPts.size());
       pts->Reset();
       for (vtkIdType i=0; i < npts; i++)
         {
-        pts->InsertId(i,cellPts->GetId(i) + ptIncr);
+        pts->InsertId(i,cellPts[i] + ptIncr);
         }
-      output->InsertNextCell(cell->GetCellType(),pts.GetPointer());
+      output->InsertNextCell(sourceCellTypes[cellId],pts.GetPointer());
       }
 
     // translate Source to Input point
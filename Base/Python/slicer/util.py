@@ -728,6 +728,12 @@ def arrayFromVolume(volumeNode):
   by changing values in the numpy array.
   After all modifications has been completed, call :py:meth:`arrayFromVolumeModified`.
 
+  The returned array keeps a reference to the VTK data array that owns the
+  voxel buffer (through the numpy array's `base` attribute), therefore the
+  buffer remains valid even if the volume node is removed from the scene or
+  its image data is replaced by another image data object. The array only
+  becomes disconnected from the node in these cases; it does not dangle.
+
   .. warning:: Memory area of the returned array is managed by VTK, therefore
     values in the array may be changed, but the array must not be reallocated
     (change array size, shallow-copy content from other array most likely causes
@@ -833,6 +839,10 @@ def arrayFromSegment(segmentationNode, segmentId):
   by changing values in the numpy array. After all modifications has been completed, call:
   segmentationNode.GetSegmentation().GetSegment(segmentID).Modified()
 
+  The returned array keeps a reference to the VTK data array that owns the
+  voxel buffer, therefore the buffer remains valid even if the segment is
+  removed from the segmentation (see :py:meth:`arrayFromVolume` for details).
+
   .. warning:: Important: memory area of the returned array is managed by VTK,
     therefore values in the array may be changed, but the array must not be reallocated.
     See :py:meth:`arrayFromVolume` for details.
@@ -849,6 +859,10 @@ def updateVolumeFromArray(volumeNode, narray):
   is modified after calling this method, voxel values in the volume node will not change.
   Dimensions and data size of the source numpy array does not have to match the current
   content of the volume node.
+  Arrays previously returned by :py:meth:`arrayFromVolume` for this node remain
+  valid (they keep the previous voxel buffer alive), but they are no longer
+  connected to the node: a new buffer is allocated for the new content instead
+  of reallocating the buffer that the existing arrays point to.
   """
 
   vshape = tuple(reversed(narray.shape))
@@ -870,6 +884,13 @@ def updateVolumeFromArray(volumeNode, narray):
     volumeNode.SetAndObserveImageData(vimage)
   import vtk.util.numpy_support
   vtype = vtk.util.numpy_support.get_vtk_array_type(narray.dtype)
+
+  # Detach the current scalar array so that AllocateScalars creates a new one
+  # instead of reallocating the existing buffer in place. Reallocation in place
+  # would leave numpy arrays previously returned by arrayFromVolume pointing
+  # to freed memory.
+  vimage.GetPointData().SetScalars(None)
+
   vimage.SetDimensions(vshape)
   vimage.AllocateScalars(vtype, vcomponents)
 
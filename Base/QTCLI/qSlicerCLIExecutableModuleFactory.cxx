@@ -102,7 +102,9 @@ qSlicerAbstractCoreModule* qSlicerCLIExecutableModuleFactoryItem::instanciator()
 
   //
   // If the xml file exists, read it and associate it with the module
-  // description. If not, run the CLI executable with "--xml".
+  // description. If not, look up the description harvested in an earlier
+  // session, and only run the CLI executable with "--xml" if there is no
+  // up-to-date cache entry.
   //
   QString xmlDescription;
   if (QFile::exists(xmlFilePath))
@@ -120,7 +122,12 @@ qSlicerAbstractCoreModule* qSlicerCLIExecutableModuleFactoryItem::instanciator()
     }
   else
     {
-    xmlDescription = this->runCLIWithXmlArgument();
+    xmlDescription = qSlicerCLIModuleFactoryHelper::loadModuleDescriptionFromCache(this->path());
+    if (xmlDescription.isEmpty())
+      {
+      xmlDescription = this->runCLIWithXmlArgument();
+      qSlicerCLIModuleFactoryHelper::saveModuleDescriptionToCache(this->path(), xmlDescription);
+      }
     }
   if (xmlDescription.isEmpty())
     {
@@ -38,9 +38,11 @@ qSlicerCLILoadableModuleFactoryItem::qSlicerCLILoadableModuleFactoryItem(
 //-----------------------------------------------------------------------------
 bool qSlicerCLILoadableModuleFactoryItem::load()
 {
-  // If XML description file exists, skip loading. It will be
-  // lazily done by calling ModuleDescription::GetTarget() method.
-  if (!QFile::exists(this->xmlModuleDescriptionFilePath()))
+  // If the XML description is available without the library - either as a
+  // file next to it or cached from an earlier session - skip loading. It
+  // will be lazily done by calling ModuleDescription::GetTarget() method.
+  if (!QFile::exists(this->xmlModuleDescriptionFilePath())
+    && qSlicerCLIModuleFactoryHelper::loadModuleDescriptionFromCache(this->path()).isEmpty())
     {
     return this->Superclass::load();
     }
@@ -118,12 +120,25 @@ qSlicerAbstractCoreModule* qSlicerCLILoadableModuleFactoryItem::instanciator()
     }
   else
     {
-    // Library is expected to already be loaded
-    // in qSlicerCLILoadableModuleFactoryItem::load()
-    xmlDescription = this->resolveXMLModuleDescriptionSymbol();
-    if (!this->resolveSymbols(module->moduleDescription()))
+    xmlDescription = qSlicerCLIModuleFactoryHelper::loadModuleDescriptionFromCache(this->path());
+    if (!xmlDescription.isEmpty())
       {
-      return 0;
+      // The description was cached in an earlier session and the library was
+      // not loaded in qSlicerCLILoadableModuleFactoryItem::load(). Resolve
+      // the entry point lazily, like in the xml-file case above.
+      module->moduleDescription().SetTargetCallback(
+            this, qSlicerCLILoadableModuleFactoryItem::loadLibraryAndResolveSymbols);
+      }
+    else
+      {
+      // Library is expected to already be loaded
+      // in qSlicerCLILoadableModuleFactoryItem::load()
+      xmlDescription = this->resolveXMLModuleDescriptionSymbol();
+      if (!this->resolveSymbols(module->moduleDescription()))
+        {
+        return 0;
+        }
+      qSlicerCLIModuleFactoryHelper::saveModuleDescriptionToCache(this->path(), xmlDescription);
       }
     }
   if (xmlDescription.isEmpty())
@@ -19,7 +19,11 @@
 ==============================================================================*/
 
 // Qt includes
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFileInfo>
 #include <QSettings>
+#include <QTextStream>
 
 // QtCLI includes
 #include "qSlicerCLIModuleFactoryHelper.h"
@@ -73,3 +77,83 @@ bool qSlicerCLIModuleFactoryHelper::isBuiltIn(const QString& path)
   qSlicerCoreApplication * app = qSlicerCoreApplication::application();
   return app ? qSlicerUtils::isPluginBuiltIn(path, app->slicerHome()) : true;
 }
+
+//-----------------------------------------------------------------------------
+namespace
+{
+QString moduleDescriptionCacheFilePath(const QString& cliPath)
+{
+  QString cachePath = qSlicerCLIModuleFactoryHelper::moduleDescriptionCachePath();
+  if (cachePath.isEmpty())
+    {
+    return QString();
+    }
+  // The base name keeps the entry readable, the hash of the absolute path
+  // disambiguates modules with the same name in different directories.
+  QString absolutePath = QFileInfo(cliPath).absoluteFilePath();
+  QString pathHash = QCryptographicHash::hash(
+    absolutePath.toUtf8(), QCryptographicHash::Md5).toHex().left(8);
+  return QDir(cachePath).filePath(
+    QFileInfo(cliPath).baseName() + "-" + pathHash + ".xml");
+}
+} // end of anonymous namespace
+
+//-----------------------------------------------------------------------------
+QString qSlicerCLIModuleFactoryHelper::moduleDescriptionCachePath()
+{
+  qSlicerCoreApplication * app = qSlicerCoreApplication::application();
+  if (!app)
+    {
+    return QString();
+    }
+  QDir cacheDirectory =
+    QFileInfo(app->slicerRevisionUserSettingsFilePath()).absoluteDir();
+  QString subDirectory = "CLIModuleDescriptionCache";
+  if (!cacheDirectory.exists(subDirectory) && !cacheDirectory.mkpath(subDirectory))
+    {
+    return QString();
+    }
+  return cacheDirectory.filePath(subDirectory);
+}
+
+//-----------------------------------------------------------------------------
+QString qSlicerCLIModuleFactoryHelper::loadModuleDescriptionFromCache(const QString& cliPath)
+{
+  QString cacheFilePath = moduleDescriptionCacheFilePath(cliPath);
+  if (cacheFilePath.isEmpty() || !QFile::exists(cacheFilePath))
+    {
+    return QString();
+    }
+  // an entry older than the CLI it was harvested from is stale
+  if (QFileInfo(cacheFilePath).lastModified() < QFileInfo(cliPath).lastModified())
+    {
+    return QString();
+    }
+  QFile cacheFile(cacheFilePath);
+  if (!cacheFile.open(QIODevice::ReadOnly))
+    {
+    return QString();
+    }
+  return QTextStream(&cacheFile).readAll();
+}
+
+//-----------------------------------------------------------------------------
+void qSlicerCLIModuleFactoryHelper::saveModuleDescriptionToCache(const QString& cliPath, const QString& xmlDescription)
+{
+  if (xmlDescription.isEmpty())
+    {
+    return;
+    }
+  QString cacheFilePath = moduleDescriptionCacheFilePath(cliPath);
+  if (cacheFilePath.isEmpty())
+    {
+    return;
+    }
+  QFile cacheFile(cacheFilePath);
+  if (!cacheFile.open(QIODevice::WriteOnly))
+    {
+    return;
+    }
+  QTextStream stream(&cacheFile);
+  stream << xmlDescription;
+}
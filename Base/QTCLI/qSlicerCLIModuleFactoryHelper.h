@@ -40,6 +40,22 @@ public:
   /// Convenient method returning True if the given CLI path corresponds to a built-in module
   static bool isBuiltIn(const QString& path);
 
+  /// Directory where parsed module description XML is cached between
+  /// sessions, next to the revision user settings. Created on demand,
+  /// empty if there is no application instance.
+  static QString moduleDescriptionCachePath();
+
+  /// Return the cached module description XML for the given CLI if the
+  /// cache entry is not older than the CLI file itself, otherwise an
+  /// empty string.
+  /// \sa saveModuleDescriptionToCache()
+  static QString loadModuleDescriptionFromCache(const QString& cliPath);
+
+  /// Store the module description XML of the given CLI in the cache so
+  /// that later sessions do not need to harvest it again.
+  /// \sa loadModuleDescriptionFromCache()
+  static void saveModuleDescriptionToCache(const QString& cliPath, const QString& xmlDescription);
+
 private:
   /// Not implemented
   qSlicerCLIModuleFactoryHelper(){}
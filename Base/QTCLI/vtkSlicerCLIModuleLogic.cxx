@@ -20,6 +20,7 @@
 // MRML includes
 #include <vtkEventBroker.h>
 #include <vtkMRMLColorNode.h>
+#include <vtkMRMLPerformanceLogger.h>
 #include <vtkMRMLDisplayableNode.h>
 #include <vtkMRMLDisplayNode.h>
 #include <vtkMRMLFiducialListNode.h>
@@ -41,6 +42,7 @@
 #include <vtksys/SystemTools.hxx>
 
 // ITKSYS includes
+#include <itksys/DynamicLoader.hxx>
 #include <itksys/Process.h>
 #include <itksys/SystemTools.hxx>
 #include <itksys/RegularExpression.hxx>
@@ -55,15 +57,51 @@
 // STL includes
 #include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <ctime>
+#include <map>
 #include <set>
 
 #ifdef _WIN32
 #else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
 #include <sys/types.h>
 #include <unistd.h>
 #endif
 
+//----------------------------------------------------------------------------
+// Return a writable RAM-backed directory for bulk data exchange with
+// command line executables, or an empty string when none is usable.
+static std::string GetSharedMemoryDirectory()
+{
+#ifdef _WIN32
+  return std::string();
+#else
+  const char* sharedMemoryDirectory = "/dev/shm";
+  if (!itksys::SystemTools::FileIsDirectory(sharedMemoryDirectory)
+      || access(sharedMemoryDirectory, W_OK | X_OK) != 0)
+    {
+    return std::string();
+    }
+  // require a reasonable amount of headroom so that writing volumes into
+  // shared memory does not starve the rest of the system
+  struct statvfs fsInfo;
+  if (statvfs(sharedMemoryDirectory, &fsInfo) != 0)
+    {
+    return std::string();
+    }
+  unsigned long long availableBytes =
+    static_cast<unsigned long long>(fsInfo.f_bavail) * fsInfo.f_frsize;
+  if (availableBytes < 1024ull * 1024ull * 1024ull)
+    {
+    return std::string();
+    }
+  return std::string(sharedMemoryDirectory);
+#endif
+}
+
 //----------------------------------------------------------------------------
 struct DigitsToCharacters
 {
@@ -198,12 +236,246 @@ public:
   ModuleDescription DefaultModuleDescription;
   int DeleteTemporaryFiles;
   int AllowInMemoryTransfer;
+  int AllowSharedMemoryTransfer;
 
   int RedirectModuleStreams;
 
   itk::MutexLock::Pointer ProcessesKillLock;
   std::vector<itksysProcess*> Processes;
 
+  /// CLI nodes held back by Apply() because a scheduled or running job
+  /// reads or writes one of their input/output nodes. Only accessed from
+  /// the main thread. \sa ScheduleDeferredNodes()
+  std::vector<vtkSmartPointer<vtkMRMLCommandLineModuleNode> > DeferredNodes;
+
+  int AllowWorkerProcessReuse;
+
+  /// A resident CLI executable that stays alive between invocations and
+  /// receives new parameter sets over a pipe (its standard input is
+  /// connected to a named pipe created by the logic).
+  struct WorkerProcess
+    {
+    itksysProcess* Process;
+    std::string FifoFileName;
+    int FifoFd;
+    bool Busy;
+    };
+  /// Resident workers by executable path, guarded by ProcessesKillLock
+  std::map<std::string, WorkerProcess> WorkerPool;
+  /// Executables that failed the worker handshake: they do not implement
+  /// the worker protocol and are always run one process per invocation
+  std::set<std::string> WorkerUnsupported;
+
+  /// Return a resident worker for the given executable, starting one if
+  /// needed, or NULL when the worker mode cannot be used (unsupported
+  /// platform or executable, worker busy, startup failure). A returned
+  /// worker is marked busy until ReleaseWorker() is called.
+  WorkerProcess* StartOrAcquireWorker(const std::string& executable,
+                                      const std::string& temporaryDirectory)
+    {
+#ifdef _WIN32
+    (void)executable;
+    (void)temporaryDirectory;
+    return 0;
+#else
+    if (this->WorkerUnsupported.find(executable) != this->WorkerUnsupported.end())
+      {
+      return 0;
+      }
+    this->ProcessesKillLock->Lock();
+    std::map<std::string, WorkerProcess>::iterator poolIt = this->WorkerPool.find(executable);
+    if (poolIt != this->WorkerPool.end())
+      {
+      if (poolIt->second.Busy)
+        {
+        // a concurrent invocation owns the worker: run classically
+        this->ProcessesKillLock->Unlock();
+        return 0;
+        }
+      // make sure the worker did not die between invocations
+      double aliveCheckTimeout = 0.001;
+      if (itksysProcess_WaitForExit(poolIt->second.Process, &aliveCheckTimeout) == 0)
+        {
+        poolIt->second.Busy = true;
+        this->ProcessesKillLock->Unlock();
+        return &poolIt->second;
+        }
+      this->ProcessesKillLock->Unlock();
+      this->RemoveWorker(executable, true);
+      this->ProcessesKillLock->Lock();
+      }
+    this->ProcessesKillLock->Unlock();
+
+    // start a fresh worker
+    std::ostringstream fifoFileNameStream;
+    fifoFileNameStream << temporaryDirectory << "/"
+      << itksys::SystemTools::GetFilenameName(executable)
+      << "_" << getpid() << "_" << this->WorkerPool.size() << ".cliworker";
+    std::string fifoFileName = fifoFileNameStream.str();
+    if (mkfifo(fifoFileName.c_str(), 0600) != 0)
+      {
+      return 0;
+      }
+    const char* workerCommand[4];
+    workerCommand[0] = executable.c_str();
+    workerCommand[1] = "--run-as-worker";
+    workerCommand[2] = fifoFileName.c_str();
+    workerCommand[3] = 0;
+    itksysProcess* process = itksysProcess_New();
+    itksysProcess_SetCommand(process, workerCommand);
+    itksysProcess_SetOption(process, itksysProcess_Option_Detach, 0);
+    itksysProcess_SetOption(process, itksysProcess_Option_HideWindow, 1);
+    itksysProcess_Execute(process);
+
+    // O_RDWR so that the open does not block until the worker opens the
+    // read end of the pipe
+    int fifoFd = open(fifoFileName.c_str(), O_RDWR);
+
+    // executables that do not implement the protocol exit immediately
+    // (unknown argument); require a ready handshake before pooling
+    bool ready = false;
+    if (fifoFd >= 0)
+      {
+      std::string handshakeBuffer;
+      double remainingTime = 10.0; // seconds
+      char* data = 0;
+      int length = 0;
+      int pipe;
+      while (remainingTime > 0.
+        && (pipe = itksysProcess_WaitForData(process, &data, &length, &remainingTime)) != 0)
+        {
+        if (pipe == itksysProcess_Pipe_STDOUT)
+          {
+          handshakeBuffer.append(data, length);
+          if (handshakeBuffer.find("<worker-ready/>") != std::string::npos)
+            {
+            ready = true;
+            break;
+            }
+          }
+        }
+      }
+    if (!ready)
+      {
+      itksysProcess_Kill(process);
+      itksysProcess_WaitForExit(process, 0);
+      itksysProcess_Delete(process);
+      if (fifoFd >= 0)
+        {
+        close(fifoFd);
+        }
+      itksys::SystemTools::RemoveFile(fifoFileName.c_str());
+      this->WorkerUnsupported.insert(executable);
+      return 0;
+      }
+
+    WorkerProcess worker;
+    worker.Process = process;
+    worker.FifoFileName = fifoFileName;
+    worker.FifoFd = fifoFd;
+    worker.Busy = true;
+    this->ProcessesKillLock->Lock();
+    this->Processes.push_back(process);
+    WorkerProcess* pooledWorker = &(this->WorkerPool[executable] = worker);
+    this->ProcessesKillLock->Unlock();
+    return pooledWorker;
+#endif
+    }
+
+  /// Hand a parameter set to a resident worker: one invocation per line,
+  /// arguments separated by the ASCII unit separator character
+  bool SendWorkerInvocation(WorkerProcess* worker, const std::vector<std::string>& arguments)
+    {
+#ifdef _WIN32
+    (void)worker;
+    (void)arguments;
+    return false;
+#else
+    std::string line;
+    for (std::vector<std::string>::const_iterator argumentIt = arguments.begin();
+         argumentIt != arguments.end(); ++argumentIt)
+      {
+      if (argumentIt != arguments.begin())
+        {
+        line += '\x1f';
+        }
+      line += *argumentIt;
+      }
+    line += '\n';
+    const char* buffer = line.c_str();
+    size_t remaining = line.size();
+    while (remaining > 0)
+      {
+      ssize_t written = write(worker->FifoFd, buffer, remaining);
+      if (written <= 0)
+        {
+        return false;
+        }
+      buffer += written;
+      remaining -= written;
+      }
+    return true;
+#endif
+    }
+
+  /// Mark the worker of the given executable as available again
+  void ReleaseWorker(const std::string& executable)
+    {
+    this->ProcessesKillLock->Lock();
+    std::map<std::string, WorkerProcess>::iterator poolIt = this->WorkerPool.find(executable);
+    if (poolIt != this->WorkerPool.end())
+      {
+      poolIt->second.Busy = false;
+      }
+    this->ProcessesKillLock->Unlock();
+    }
+
+  /// Drop the worker of the given executable from the pool. When
+  /// \a deleteProcess is true the worker process is also killed, removed
+  /// from the process list and deleted; pass false when the caller
+  /// leaves that to the regular per-invocation cleanup.
+  void RemoveWorker(const std::string& executable, bool deleteProcess)
+    {
+    this->ProcessesKillLock->Lock();
+    std::map<std::string, WorkerProcess>::iterator poolIt = this->WorkerPool.find(executable);
+    if (poolIt == this->WorkerPool.end())
+      {
+      this->ProcessesKillLock->Unlock();
+      return;
+      }
+    WorkerProcess worker = poolIt->second;
+    this->WorkerPool.erase(poolIt);
+    if (deleteProcess)
+      {
+      itksysProcess_Kill(worker.Process);
+      itksysProcess_WaitForExit(worker.Process, 0);
+      std::vector<itksysProcess*>::iterator processIt =
+        std::find(this->Processes.begin(), this->Processes.end(), worker.Process);
+      if (processIt != this->Processes.end())
+        {
+        this->Processes.erase(processIt);
+        }
+      itksysProcess_Delete(worker.Process);
+      }
+    this->ProcessesKillLock->Unlock();
+#ifndef _WIN32
+    if (worker.FifoFd >= 0)
+      {
+      close(worker.FifoFd);
+      }
+#endif
+    itksys::SystemTools::RemoveFile(worker.FifoFileName.c_str());
+    }
+
+  /// Shut down all resident workers (logic is being destroyed)
+  void ShutDownWorkers()
+    {
+    while (!this->WorkerPool.empty())
+      {
+      this->RemoveWorker(this->WorkerPool.begin()->first, true);
+      }
+    }
+
   typedef std::vector<std::pair<vtkMTimeType, vtkMRMLCommandLineModuleNode*> > RequestType;
   struct FindRequest
   {
@@ -300,6 +572,8 @@ vtkSlicerCLIModuleLogic::vtkSlicerCLIModuleLogic()
   this->Internal->ProcessesKillLock = itk::MutexLock::New();
   this->Internal->DeleteTemporaryFiles = 1;
   this->Internal->AllowInMemoryTransfer = 1;
+  this->Internal->AllowSharedMemoryTransfer = 1;
+  this->Internal->AllowWorkerProcessReuse = 0;
   this->Internal->RedirectModuleStreams = 1;
   this->Internal->RescheduleCallback =
     vtkSmartPointer<vtkSlicerCLIRescheduleCallback>::New();
@@ -316,6 +590,8 @@ vtkSlicerCLIModuleLogic::~vtkSlicerCLIModuleLogic()
 {
   this->RemoveObserver(this->Internal->OneShotCallbackCallback);
 
+  this->Internal->ShutDownWorkers();
+
   delete this->Internal;
 }
 
@@ -403,6 +679,38 @@ int vtkSlicerCLIModuleLogic::GetAllowInMemoryTransfer() const
   return this->Internal->AllowInMemoryTransfer;
 }
 
+//----------------------------------------------------------------------------
+void vtkSlicerCLIModuleLogic::SetAllowSharedMemoryTransfer(int value)
+{
+  vtkDebugMacro(<< this->GetClassName() << " (" << this << "): setting AllowSharedMemoryTransfer to " << value);
+  if (this->Internal->AllowSharedMemoryTransfer != value)
+    {
+    this->Internal->AllowSharedMemoryTransfer = value;
+    }
+}
+
+//----------------------------------------------------------------------------
+int vtkSlicerCLIModuleLogic::GetAllowSharedMemoryTransfer() const
+{
+  return this->Internal->AllowSharedMemoryTransfer;
+}
+
+//----------------------------------------------------------------------------
+void vtkSlicerCLIModuleLogic::SetAllowWorkerProcessReuse(int value)
+{
+  vtkDebugMacro(<< this->GetClassName() << " (" << this << "): setting AllowWorkerProcessReuse to " << value);
+  if (this->Internal->AllowWorkerProcessReuse != value)
+    {
+    this->Internal->AllowWorkerProcessReuse = value;
+    }
+}
+
+//----------------------------------------------------------------------------
+int vtkSlicerCLIModuleLogic::GetAllowWorkerProcessReuse() const
+{
+  return this->Internal->AllowWorkerProcessReuse;
+}
+
 //----------------------------------------------------------------------------
 void vtkSlicerCLIModuleLogic::RedirectModuleStreamsOn()
 {
@@ -486,7 +794,8 @@ vtkSlicerCLIModuleLogic
                              const std::string& type,
                              const std::string& name,
                              const std::vector<std::string>& extensions,
-                             CommandLineModuleType commandType)
+                             CommandLineModuleType commandType,
+                             bool directMRMLTransfer)
 {
   std::string fname = name;
   std::string pid;
@@ -535,6 +844,23 @@ vtkSlicerCLIModuleLogic
     return fname;
     }
 
+  // A module that negotiated the direct MRML bridge resolves scene
+  // references for every node parameter itself, so there is no file to
+  // construct for any of the node tags. Point files keep going through
+  // files: their coordinate system conversion happens in the storage node.
+  if (directMRMLTransfer &&
+      (tag == "image" || tag == "geometry" || tag == "transform"
+       || tag == "table" || tag == "measurement"))
+    {
+    // Must be large enough to hold slicer:, #, an ascii
+    // representation of the scene pointer and the MRML node ID.
+    char *tname = new char[name.size() + 100];
+    sprintf(tname, "slicer:%p#%s", this->GetMRMLScene(), name.c_str());
+    fname = tname;
+    delete [] tname;
+    return fname;
+    }
+
   // To avoid confusing the Archetype readers, convert any
   // numbers in the filename to characters [0-9]->[A-J]
   std::transform(fname.begin(), fname.end(),
@@ -548,6 +874,22 @@ vtkSlicerCLIModuleLogic
     {
     temporaryDirectory = appLogic->GetTemporaryPath();
     }
+  // Volumes exchanged with command line executables go through files;
+  // placing those files on a RAM-backed filesystem removes the disk
+  // round trip while keeping the executables unchanged (they read and
+  // write the files with their regular I/O code).
+  if (tag == "image" && this->GetAllowSharedMemoryTransfer() != 0
+      && (commandType == CommandLineModule
+          || type == "dynamic-contrast-enhanced"
+          || this->GetAllowInMemoryTransfer() == 0))
+    {
+    std::string sharedMemoryDirectory = GetSharedMemoryDirectory();
+    if (!sharedMemoryDirectory.empty())
+      {
+      temporaryDirectory = sharedMemoryDirectory;
+      }
+    }
+
   fname = temporaryDirectory + "/" + pid + "_" + fname;
 
   if (tag == "image")
@@ -689,16 +1031,83 @@ void vtkSlicerCLIModuleLogic::KillProcesses()
 }
 
 //-----------------------------------------------------------------------------
-void vtkSlicerCLIModuleLogic::Apply ( vtkMRMLCommandLineModuleNode* node, bool updateDisplay )
+// Collect the IDs of the scene nodes a CLI node reads (channel "input") or
+// writes (channel "output") according to its module description.
+static void GetChannelNodeIDs(vtkMRMLCommandLineModuleNode* node,
+                              const std::string& channel,
+                              std::set<std::string>& nodeIDs)
 {
-  bool ret;
+  std::vector<ModuleParameterGroup>::iterator pgit
+    = node->GetModuleDescription().GetParameterGroups().begin();
+  std::vector<ModuleParameterGroup>::iterator pgendit
+    = node->GetModuleDescription().GetParameterGroups().end();
+  for (; pgit != pgendit; ++pgit)
+    {
+    std::vector<ModuleParameter>::iterator pit = (*pgit).GetParameters().begin();
+    std::vector<ModuleParameter>::iterator pendit = (*pgit).GetParameters().end();
+    for (; pit != pendit; ++pit)
+      {
+      if ((*pit).GetTag() != "image" && (*pit).GetTag() != "geometry"
+          && (*pit).GetTag() != "transform" && (*pit).GetTag() != "table"
+          && (*pit).GetTag() != "measurement" && (*pit).GetTag() != "pointfile")
+        {
+        continue;
+        }
+      if ((*pit).GetChannel() != channel)
+        {
+        continue;
+        }
+      std::string id = (*pit).GetValue();
+      if (!id.empty() && id != "None")
+        {
+        nodeIDs.insert(id);
+        }
+      }
+    }
+}
 
+//-----------------------------------------------------------------------------
+void vtkSlicerCLIModuleLogic::Apply ( vtkMRMLCommandLineModuleNode* node, bool updateDisplay )
+{
   if ( node->GetModuleDescription().GetType() == "PythonModule" )
     {
     this->ApplyAndWait ( node );
     return;
     }
 
+  node->SetAttribute("UpdateDisplay", updateDisplay ? "true" : "false");
+
+  // The processing threads execute unrelated tasks concurrently, so a CLI
+  // that consumes the output of a scheduled or running CLI (or shares an
+  // output with it) must not be handed to them yet: the two would race on
+  // the shared nodes. Hold such a node back; ScheduleDeferredNodes() picks
+  // it up once the conflicting jobs leave their busy state. Independent
+  // invocations are scheduled right away and run in parallel, bounded by
+  // vtkSlicerApplicationLogic::NumberOfProcessingThreads.
+  if (this->IsWaitingForUpstream(node))
+    {
+    node->SetOutputText("", false);
+    node->SetErrorText("", false);
+    node->SetStatus(vtkMRMLCommandLineModuleNode::Scheduled);
+    this->Internal->DeferredNodes.push_back(node);
+    return;
+    }
+
+  if (!this->ScheduleNodeTask(node))
+    {
+    vtkWarningMacro( << "Could not schedule task" );
+    }
+  else
+    {
+    node->SetOutputText("", false);
+    node->SetErrorText("", false);
+    node->SetStatus(vtkMRMLCommandLineModuleNode::Scheduled);
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool vtkSlicerCLIModuleLogic::ScheduleNodeTask(vtkMRMLCommandLineModuleNode* node)
+{
   vtkNew<vtkSlicerTask> task;
   task->SetTypeToProcessing();
 
@@ -714,20 +1123,98 @@ void vtkSlicerCLIModuleLogic::Apply ( vtkMRMLCommandLineModuleNode* node, bool u
   // reference count on the node, we'll decrease the reference count
   // once the task actually runs
   node->Register(this);
-  node->SetAttribute("UpdateDisplay", updateDisplay ? "true" : "false");
 
   // Schedule the task
-  ret = this->GetApplicationLogic()->ScheduleTask( task.GetPointer() );
+  return this->GetApplicationLogic()->ScheduleTask( task.GetPointer() );
+}
 
-  if (!ret)
+//-----------------------------------------------------------------------------
+bool vtkSlicerCLIModuleLogic::IsWaitingForUpstream(vtkMRMLCommandLineModuleNode* node)
+{
+  if (!this->GetMRMLScene())
     {
-    vtkWarningMacro( << "Could not schedule task" );
+    return false;
     }
-  else
+
+  std::set<std::string> inputIDs;
+  std::set<std::string> outputIDs;
+  GetChannelNodeIDs(node, "input", inputIDs);
+  GetChannelNodeIDs(node, "output", outputIDs);
+  if (inputIDs.empty() && outputIDs.empty())
     {
-    node->SetOutputText("", false);
-    node->SetErrorText("", false);
-    node->SetStatus(vtkMRMLCommandLineModuleNode::Scheduled);
+    return false;
+    }
+
+  int numberOfCLINodes = this->GetMRMLScene()
+    ->GetNumberOfNodesByClass("vtkMRMLCommandLineModuleNode");
+  for (int i = 0; i < numberOfCLINodes; ++i)
+    {
+    vtkMRMLCommandLineModuleNode* other =
+      vtkMRMLCommandLineModuleNode::SafeDownCast(
+        this->GetMRMLScene()->GetNthNodeByClass(i, "vtkMRMLCommandLineModuleNode"));
+    if (!other || other == node || !other->IsBusy())
+      {
+      continue;
+      }
+    std::set<std::string> otherInputIDs;
+    std::set<std::string> otherOutputIDs;
+    GetChannelNodeIDs(other, "input", otherInputIDs);
+    GetChannelNodeIDs(other, "output", otherOutputIDs);
+    std::set<std::string>::iterator idIt;
+    for (idIt = otherOutputIDs.begin(); idIt != otherOutputIDs.end(); ++idIt)
+      {
+      // the busy job writes a node this one reads or writes
+      if (inputIDs.find(*idIt) != inputIDs.end()
+          || outputIDs.find(*idIt) != outputIDs.end())
+        {
+        return true;
+        }
+      }
+    for (idIt = otherInputIDs.begin(); idIt != otherInputIDs.end(); ++idIt)
+      {
+      // the busy job reads a node this one writes
+      if (outputIDs.find(*idIt) != outputIDs.end())
+        {
+        return true;
+        }
+      }
+    }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+void vtkSlicerCLIModuleLogic::ScheduleDeferredNodes()
+{
+  // Iterate over a copy: scheduling a node fires events that may re-enter
+  // this method or make Apply() defer new nodes.
+  std::vector<vtkSmartPointer<vtkMRMLCommandLineModuleNode> > deferredNodes;
+  deferredNodes.swap(this->Internal->DeferredNodes);
+  std::vector<vtkSmartPointer<vtkMRMLCommandLineModuleNode> >::iterator it;
+  for (it = deferredNodes.begin(); it != deferredNodes.end(); ++it)
+    {
+    vtkMRMLCommandLineModuleNode* node = *it;
+    if (node->GetStatus() == vtkMRMLCommandLineModuleNode::Cancelling)
+      {
+      // The node was cancelled while it was held back. No task has been
+      // scheduled for it, so finish the cancellation here.
+      node->SetStatus(vtkMRMLCommandLineModuleNode::Cancelled);
+      continue;
+      }
+    if (node->GetStatus() != vtkMRMLCommandLineModuleNode::Scheduled)
+      {
+      // the node left the queue some other way (e.g. scene close)
+      continue;
+      }
+    if (this->IsWaitingForUpstream(node))
+      {
+      this->Internal->DeferredNodes.push_back(node);
+      continue;
+      }
+    if (!this->ScheduleNodeTask(node))
+      {
+      vtkWarningMacro( << "Could not schedule deferred task" );
+      node->SetStatus(vtkMRMLCommandLineModuleNode::CompletedWithErrors);
+      }
     }
 }
 
@@ -810,6 +1297,33 @@ void vtkSlicerCLIModuleLogic
 //     }
 // }
 
+//-----------------------------------------------------------------------------
+// A shared object module declares that it can resolve "slicer:%p#%s" scene
+// references for every one of its node parameters (not only the image types
+// read through MRMLIDImageIO) by exporting a symbol named
+// "ModuleSupportsDirectMRMLTransfer" next to its entry point. The capability
+// is negotiated here instead of assumed, so modules built without the bridge
+// keep receiving regular temporary files.
+static bool ModuleSupportsDirectMRMLTransfer(const ModuleDescription& description)
+{
+  if (description.GetLocation().empty())
+    {
+    return false;
+    }
+  itksys::DynamicLoader::LibraryHandle lib
+    = itksys::DynamicLoader::OpenLibrary(description.GetLocation().c_str());
+  if (!lib)
+    {
+    return false;
+    }
+  bool supported
+    = (itksys::DynamicLoader::GetSymbolAddress(lib, "ModuleSupportsDirectMRMLTransfer") != 0);
+  // The module library is already resident (the factory loaded it to resolve
+  // the entry point); closing only drops the extra reference taken above.
+  itksys::DynamicLoader::CloseLibrary(lib);
+  return supported;
+}
+
 //-----------------------------------------------------------------------------
 //
 // This routine is called in a separate thread from the main thread.
@@ -821,6 +1335,7 @@ void vtkSlicerCLIModuleLogic
 //
 void vtkSlicerCLIModuleLogic::ApplyTask(void *clientdata)
 {
+  vtkMRMLScopedPerformanceTimer performanceTimer("vtkSlicerCLIModuleLogic::ApplyTask");
   // check if MRML node is present
   if (clientdata == NULL)
     {
@@ -896,6 +1411,17 @@ void vtkSlicerCLIModuleLogic::ApplyTask(void *clientdata)
   // vtkSlicerApplication::GetInstance()->InformationMessage
   qDebug() << "ModuleType:" << node0->GetModuleDescription().GetType().c_str();
 
+  // Negotiate the direct MRML bridge: a shared object module that declared
+  // it can consume scene references for every node parameter gets
+  // "slicer:%p#%s" references instead of temporary files, and none of its
+  // inputs are serialized to disk.
+  bool directMRMLTransfer = false;
+  if (commandType == SharedObjectModule && this->GetAllowInMemoryTransfer() != 0)
+    {
+    directMRMLTransfer
+      = ModuleSupportsDirectMRMLTransfer(node0->GetModuleDescription());
+    }
+
   // map to keep track of MRML Ids and filenames
   typedef std::map<std::string, std::string> MRMLIDToFileNameMap;
   MRMLIDToFileNameMap nodesToReload;
@@ -963,7 +1489,8 @@ void vtkSlicerCLIModuleLogic::ApplyTask(void *clientdata)
                                              (*pit).GetType(),
                                              id,
                                              (*pit).GetFileExtensions(),
-                                             commandType);
+                                             commandType,
+                                             directMRMLTransfer);
 
         filesToDelete.insert(fname);
         if ((*pit).GetChannel() == "input")
@@ -1051,11 +1578,14 @@ void vtkSlicerCLIModuleLogic::ApplyTask(void *clientdata)
       //std::cerr << nd->GetName() << " is " << nd->GetClassName() << std::endl;
 
       // Check if we can transfer the datatype using a direct memory transfer
-      if ((this->GetAllowInMemoryTransfer() == 0) ||
-          std::find(MemoryTransferPossible.begin(), MemoryTransferPossible.end(),
-                    nd->GetClassName()) == MemoryTransferPossible.end())
+      if (!directMRMLTransfer &&
+          ((this->GetAllowInMemoryTransfer() == 0) ||
+           std::find(MemoryTransferPossible.begin(), MemoryTransferPossible.end(),
+                     nd->GetClassName()) == MemoryTransferPossible.end()))
         {
-        // Cannot use a memory transfer, use a StorageNode
+        // Cannot use a memory transfer, use a StorageNode. With the direct
+        // MRML bridge the module consumes the scene reference for any node
+        // class, so nothing is serialized.
         out = defaultOut;
         }
       }
@@ -1848,20 +2378,55 @@ void vtkSlicerCLIModuleLogic::ApplyTask(void *clientdata)
     //
     // now run the process
     //
-    itksysProcess *process = itksysProcess_New();
 
-    this->Internal->Processes.push_back(process);
+    // If enabled, reuse a resident worker process of this module so that
+    // process creation and library/factory initialization are paid only
+    // on the first invocation; later invocations just send the new
+    // parameter set over the worker pipe.
+    vtkInternal::WorkerProcess* worker = 0;
+    if (this->GetAllowWorkerProcessReuse())
+      {
+      std::string workerTemporaryDirectory = ".";
+      if (this->GetApplicationLogic())
+        {
+        workerTemporaryDirectory = this->GetApplicationLogic()->GetTemporaryPath();
+        }
+      worker = this->Internal->StartOrAcquireWorker(commandLineAsString[0],
+                                                    workerTemporaryDirectory);
+      }
+    bool useWorker = (worker != 0);
+    itksysProcess *process = 0;
+    if (useWorker)
+      {
+      process = worker->Process;
+      if (!this->Internal->SendWorkerInvocation(worker, commandLineAsString))
+        {
+        // could not hand over the parameter set: drop the worker and run
+        // this invocation as a regular one-shot process
+        this->Internal->RemoveWorker(commandLineAsString[0], true);
+        worker = 0;
+        useWorker = false;
+        process = 0;
+        }
+      }
+
+    if (!useWorker)
+      {
+      process = itksysProcess_New();
 
-    // setup the command
-    itksysProcess_SetCommand(process, command);
-    itksysProcess_SetOption(process,
-                            itksysProcess_Option_Detach, 0);
-    itksysProcess_SetOption(process,
-                            itksysProcess_Option_HideWindow, 1);
-    // itksysProcess_SetTimeout(process, 5.0); // 5 seconds
+      this->Internal->Processes.push_back(process);
 
-    // execute the command
-    itksysProcess_Execute(process);
+      // setup the command
+      itksysProcess_SetCommand(process, command);
+      itksysProcess_SetOption(process,
+                              itksysProcess_Option_Detach, 0);
+      itksysProcess_SetOption(process,
+                              itksysProcess_Option_HideWindow, 1);
+      // itksysProcess_SetTimeout(process, 5.0); // 5 seconds
+
+      // execute the command
+      itksysProcess_Execute(process);
+      }
 
     // restore the load path
     std::string putEnvString = ("ITK_AUTOLOAD_PATH=");
@@ -1914,6 +2479,15 @@ void vtkSlicerCLIModuleLogic::ApplyTask(void *clientdata)
           //std::cout << "STDOUT: " << std::string(tbuffer, length) << std::endl;
           stdoutbuffer = stdoutbuffer.append(tbuffer, length);
 
+          if (useWorker
+              && stdoutbuffer.find("<worker-invocation-done") != std::string::npos)
+            {
+            // the resident worker completed the invocation (it stays
+            // alive, so waiting for more data would block until the
+            // next invocation)
+            break;
+            }
+
           bool foundTag = false;
           // search for the last occurence of </filter-progress>
           tagend = stdoutbuffer.rfind("</filter-progress>");
@@ -1980,9 +2554,28 @@ void vtkSlicerCLIModuleLogic::ApplyTask(void *clientdata)
           }
         }
       }
-    this->Internal->ProcessesKillLock->Lock();
-    itksysProcess_WaitForExit(process, 0);
-    this->Internal->ProcessesKillLock->Unlock();
+    // For a resident worker the completion sentinel carries the exit
+    // value of the invocation; the worker process itself keeps running.
+    bool workerCompleted = false;
+    int workerExitValue = -1;
+    if (useWorker)
+      {
+      itksys::RegularExpression workerDoneRegExp(
+        "<worker-invocation-done exit=\"(-?[0-9]+)\"/>[ \t\n\r]*");
+      if (workerDoneRegExp.find(stdoutbuffer))
+        {
+        workerCompleted = true;
+        workerExitValue = atoi(workerDoneRegExp.match(1).c_str());
+        stdoutbuffer.erase(workerDoneRegExp.start(),
+                           workerDoneRegExp.end() - workerDoneRegExp.start());
+        }
+      }
+    if (!useWorker || !workerCompleted)
+      {
+      this->Internal->ProcessesKillLock->Lock();
+      itksysProcess_WaitForExit(process, 0);
+      this->Internal->ProcessesKillLock->Unlock();
+      }
 
     // remove the embedded XML from the stdout stream
     //
@@ -2060,11 +2653,45 @@ void vtkSlicerCLIModuleLogic::ApplyTask(void *clientdata)
     // check the exit state / error state of the process
     if (node0->GetStatus() == vtkMRMLCommandLineModuleNode::Cancelling)
       {
+      if (useWorker)
+        {
+        // the worker was killed along with the invocation
+        this->Internal->RemoveWorker(commandLineAsString[0], true);
+        }
       node0->SetStatus(vtkMRMLCommandLineModuleNode::Cancelled, false);
       this->GetApplicationLogic()->RequestModified(node0);
       }
+    else if (useWorker && workerCompleted)
+      {
+      if (workerExitValue == 0)
+        {
+        std::stringstream information;
+        information << node0->GetModuleDescription().GetTitle()
+                    << " completed without errors" << std::endl;
+        // vtkSlicerApplication::GetInstance()->InformationMessage
+        qDebug() << information.str().c_str();
+        }
+      else
+        {
+        std::stringstream information;
+        information << node0->GetModuleDescription().GetTitle()
+                    << " completed with errors" << std::endl;
+        vtkErrorMacro( << information.str().c_str() );
+        node0->SetStatus(vtkMRMLCommandLineModuleNode::CompletedWithErrors, false);
+        this->GetApplicationLogic()->RequestModified( node0 );
+        }
+      // the worker process stays resident for the next invocation
+      this->Internal->ReleaseWorker(commandLineAsString[0]);
+      }
     else
       {
+      if (useWorker)
+        {
+        // the worker died instead of reporting completion; drop it from
+        // the pool (the regular cleanup below reaps the process) and
+        // report how it ended
+        this->Internal->RemoveWorker(commandLineAsString[0], false);
+        }
       int result = itksysProcess_GetState(process);
       if (result == itksysProcess_State_Exited)
         {
@@ -2690,6 +3317,9 @@ bool vtkSlicerCLIModuleLogic
 //----------------------------------------------------------------------------
 void vtkSlicerCLIModuleLogic::SetMRMLSceneInternal(vtkMRMLScene * newScene)
 {
+  // nodes held back by Apply() belong to the previous scene
+  this->Internal->DeferredNodes.clear();
+
   vtkNew<vtkIntArray> events;
   events->InsertNextValue(vtkMRMLScene::NodeAddedEvent);
   this->SetAndObserveMRMLSceneEventsInternal(newScene, events.GetPointer());
@@ -2746,6 +3376,14 @@ void vtkSlicerCLIModuleLogic
   // Observe only the CLI of the logic.
   vtkMRMLCommandLineModuleNode* cliNode =
     vtkMRMLCommandLineModuleNode::SafeDownCast(node);
+  if (cliNode && event == vtkCommand::ModifiedEvent
+      && !cliNode->IsBusy()
+      && !this->Internal->DeferredNodes.empty())
+    {
+    // A job finishing (or being cancelled) may unblock nodes that Apply()
+    // held back because of input/output conflicts with it.
+    this->ScheduleDeferredNodes();
+    }
   if (cliNode &&
       cliNode->GetModuleTitle() ==
         this->Internal->DefaultModuleDescription.GetTitle())
@@ -80,6 +80,31 @@ public:
   void SetAllowInMemoryTransfer(int value);
   int GetAllowInMemoryTransfer() const;
 
+  /// Control whether the temporary volume files exchanged with command
+  /// line executables are placed on a RAM-backed (shared memory)
+  /// filesystem instead of the temporary directory, avoiding the disk
+  /// round trip on both sides. Enabled by default; silently falls back
+  /// to the temporary directory when no usable shared memory filesystem
+  /// is found (e.g. on Windows, or when it is low on space).
+  void SetAllowSharedMemoryTransfer(int value);
+  int GetAllowSharedMemoryTransfer() const;
+
+  /// Control reuse of resident worker processes for command line
+  /// executables. When enabled, the first invocation of a module starts
+  /// it with the \c --run-as-worker \c \<pipe\> arguments: a module that
+  /// implements the worker protocol answers with a \c \<worker-ready/\>
+  /// handshake on its standard output, stays alive between invocations
+  /// and receives each new parameter set as one line on the named pipe
+  /// (arguments separated by the ASCII unit separator), reporting
+  /// completion with a \c \<worker-invocation-done exit="N"/\> sentinel.
+  /// This amortizes process startup and library/factory initialization
+  /// over a whole batch of invocations. Executables that do not
+  /// implement the protocol fail the handshake once and are then always
+  /// run one process per invocation. Disabled by default; workers are
+  /// only available on POSIX platforms.
+  void SetAllowWorkerProcessReuse(int value);
+  int GetAllowWorkerProcessReuse() const;
+
   /// For debugging, control redirection of cout and cerr
   virtual void RedirectModuleStreamsOn();
   virtual void RedirectModuleStreamsOff();
@@ -92,6 +117,12 @@ public:
   /// If \a updateDisplay is 'true' the selection node will be updated with the
   /// the created nodes, which would automatically select the created nodes
   /// in the node selectors.
+  /// Independent invocations run concurrently on the application logic
+  /// processing threads; an invocation whose input or output nodes are
+  /// still read or written by a scheduled or running CLI is held back
+  /// (status Scheduled) and started automatically once the conflicting
+  /// jobs finish, so a graph of dependent CLI nodes can be submitted in
+  /// one go. \sa vtkSlicerApplicationLogic::SetNumberOfProcessingThreads()
   void Apply( vtkMRMLCommandLineModuleNode* node, bool updateDisplay = true );
 
   /// Don't start the CLI in a separate thread, but run it in the main thread.
@@ -123,11 +154,17 @@ protected:
   void ProcessMRMLLogicsEvents(vtkObject*, long unsigned int, void*) VTK_OVERRIDE;
 
 
+  /// If \a directMRMLTransfer is true, every node parameter (not only the
+  /// image types readable through MRMLIDImageIO) is encoded as a
+  /// "slicer:%p#%s" scene reference instead of a temporary filename.
+  /// Only valid for shared object modules that negotiated the direct MRML
+  /// bridge (\sa ApplyTask).
   std::string ConstructTemporaryFileName(const std::string& tag,
                                          const std::string& type,
                                          const std::string& name,
                                      const std::vector<std::string>& extensions,
-                                     CommandLineModuleType commandType);
+                                     CommandLineModuleType commandType,
+                                     bool directMRMLTransfer = false);
   std::string ConstructTemporarySceneFileName(vtkMRMLScene *scene);
   std::string FindHiddenNodeID(const ModuleDescription& d,
                                const ModuleParameter& p);
@@ -146,6 +183,22 @@ protected:
   /// Call apply because the node requests it.
   void AutoRun(vtkMRMLCommandLineModuleNode* cliNode);
 
+  /// Return true if a scheduled or running CLI node (of any module) writes
+  /// a node that \a node reads or writes, or reads a node that \a node
+  /// writes. Such a node must not start before the conflicting jobs finish.
+  /// \sa Apply(), ScheduleDeferredNodes()
+  bool IsWaitingForUpstream(vtkMRMLCommandLineModuleNode* node);
+
+  /// Hand \a node over to the application logic processing threads.
+  /// Return false if the task could not be scheduled.
+  /// \sa Apply(), ScheduleDeferredNodes()
+  bool ScheduleNodeTask(vtkMRMLCommandLineModuleNode* node);
+
+  /// Schedule the nodes held back by Apply() whose conflicting jobs have
+  /// finished. Called whenever an observed CLI node leaves its busy state.
+  /// \sa Apply(), IsWaitingForUpstream()
+  void ScheduleDeferredNodes();
+
     /// List of custom events fired by the class.
   enum Events{
     RequestHierarchyEditEvent = vtkCommand::UserEvent + 1
@@ -48,6 +48,7 @@ public:
   bool                                       Installed;
   bool                                       BuiltIn;
   bool                                       WidgetRepresentationCreationEnabled;
+  bool                                       LogicCreatedOnStartup;
   qSlicerAbstractModuleRepresentation*       WidgetRepresentation;
   QList<qSlicerAbstractModuleRepresentation*> WidgetRepresentations;
   vtkSmartPointer<vtkMRMLScene>              MRMLScene;
@@ -65,6 +66,7 @@ qSlicerAbstractCoreModulePrivate::qSlicerAbstractCoreModulePrivate()
   this->Installed = false;
   this->BuiltIn = false;
   this->WidgetRepresentationCreationEnabled = true;
+  this->LogicCreatedOnStartup = true;
 }
 
 //-----------------------------------------------------------------------------
@@ -98,7 +100,10 @@ qSlicerAbstractCoreModule::~qSlicerAbstractCoreModule()
 void qSlicerAbstractCoreModule::initialize(vtkSlicerApplicationLogic* _appLogic)
 {
   this->setAppLogic(_appLogic);
-  this->logic(); // Create the logic if it hasn't been created already.
+  if (this->isLogicCreatedOnStartup())
+    {
+    this->logic(); // Create the logic if it hasn't been created already.
+    }
   this->setup(); // Setup is a virtual pure method overloaded in subclass
 }
 
@@ -221,6 +226,10 @@ CTK_SET_CPP(qSlicerAbstractCoreModule, bool, setBuiltIn, BuiltIn);
 CTK_GET_CPP(qSlicerAbstractCoreModule, bool, isWidgetRepresentationCreationEnabled, WidgetRepresentationCreationEnabled);
 CTK_SET_CPP(qSlicerAbstractCoreModule, bool, setWidgetRepresentationCreationEnabled, WidgetRepresentationCreationEnabled);
 
+//-----------------------------------------------------------------------------
+CTK_GET_CPP(qSlicerAbstractCoreModule, bool, isLogicCreatedOnStartup, LogicCreatedOnStartup);
+CTK_SET_CPP(qSlicerAbstractCoreModule, bool, setLogicCreatedOnStartup, LogicCreatedOnStartup);
+
 //-----------------------------------------------------------------------------
 qSlicerAbstractModuleRepresentation* qSlicerAbstractCoreModule::widgetRepresentation()
 {
@@ -244,13 +253,11 @@ qSlicerAbstractModuleRepresentation* qSlicerAbstractCoreModule::createNewWidgetR
     return 0;
     }
 
-  // Since 'logic()' should have been called in 'initialize(), let's make
-  // sure the 'logic()' method call is consistent and won't create a
-  // diffent logic object
-#ifndef QT_NO_DEBUG // Required to avoid undefined variable warning
-  vtkMRMLAbstractLogic* currentLogic = d->Logic;
-  Q_ASSERT(currentLogic == this->logic());
-#endif
+  // Make sure the logic exists before the widget is created: modules that
+  // defer logic creation at startup create it here, on first panel
+  // activation. For all other modules this is a no-op, 'logic()' was
+  // already called in 'initialize()'.
+  this->logic();
 
   qSlicerAbstractModuleRepresentation *newWidgetRepresentation;
   newWidgetRepresentation = this->createWidgetRepresentation();
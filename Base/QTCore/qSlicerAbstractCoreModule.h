@@ -116,6 +116,20 @@ class Q_SLICER_BASE_QTCORE_EXPORT qSlicerAbstractCoreModule : public QObject
              READ isWidgetRepresentationCreationEnabled
              WRITE setWidgetRepresentationCreationEnabled)
 
+  /// This property holds whether the module logic is created when the module
+  /// is initialized at startup.
+  /// By default it is, because many module logics register MRML node
+  /// classes, file readers or displayable managers when they are associated
+  /// with the scene. Modules whose logic has no such side effects can
+  /// disable this before initialization; their logic is then only created on
+  /// first access, which shortens startup.
+  /// \sa isLogicCreatedOnStartup
+  /// \sa setLogicCreatedOnStartup
+  /// \sa logic()
+  Q_PROPERTY(bool logicCreatedOnStartup
+             READ isLogicCreatedOnStartup
+             WRITE setLogicCreatedOnStartup)
+
   /// This property holds the help of the module.
   /// The help is displayed inside the module as a tab.
   /// \a helpText must be reimplemented for each module.
@@ -248,6 +262,12 @@ public:
   bool isWidgetRepresentationCreationEnabled()const;
   void setWidgetRepresentationCreationEnabled(bool value);
 
+  /// Set/Get if the module logic is created at startup or lazily on first
+  /// access. Must be set before initialize() is called to take effect.
+  /// \sa logicCreatedOnStartup, logic()
+  bool isLogicCreatedOnStartup()const;
+  void setLogicCreatedOnStartup(bool value);
+
   /// This method allows to get a pointer to the WidgetRepresentation.
   /// If no WidgetRepresentation already exists, one will be created calling
   /// 'createWidgetRepresentation' method.
@@ -147,6 +147,7 @@ qSlicerCoreApplicationPrivate::qSlicerCoreApplicationPrivate(
   this->DICOMDatabase = 0;
 #endif
   this->NextResourceHandle = 0;
+  this->LastStartupPhaseTimeMs = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -174,6 +175,8 @@ void qSlicerCoreApplicationPrivate::init()
 {
   Q_Q(qSlicerCoreApplication);
 
+  this->StartupTimer.start();
+
   // Minimize the number of call to 'systemEnvironment()' by keeping
   // a reference to 'Environment'. Indeed, re-creating QProcessEnvironment is a non-trivial
   // operation. See http://doc.qt.nokia.com/4.7/qprocessenvironment.html#systemEnvironment
@@ -295,6 +298,8 @@ void qSlicerCoreApplicationPrivate::init()
       }
     }
 
+  this->recordStartupPhase("Environment and settings");
+
   // Create the application Logic object,
   this->AppLogic = vtkSmartPointer<vtkSlicerApplicationLogic>::New();
   this->AppLogic->SetTemporaryPath(q->temporaryPath().toLatin1());
@@ -332,6 +337,8 @@ void qSlicerCoreApplicationPrivate::init()
   //this->AppLogic->SetAndObserveMRMLScene(scene);
   this->AppLogic->CreateProcessingThread();
 
+  this->recordStartupPhase("Application logic");
+
   // Set up Slicer to use the system proxy
   QNetworkProxyFactory::setUseSystemConfiguration(true);
 
@@ -349,6 +356,8 @@ void qSlicerCoreApplicationPrivate::init()
   q->connect(q, SIGNAL(mrmlSceneChanged(vtkMRMLScene*)),
                  this->ModuleManager->factoryManager(), SLOT(setMRMLScene(vtkMRMLScene*)));
 
+  this->recordStartupPhase("Data IO and MRML scene");
+
   q->handlePreApplicationCommandLineArguments();
 
 #ifdef Slicer_USE_PYTHONQT
@@ -362,46 +371,68 @@ void qSlicerCoreApplicationPrivate::init()
                  q, SLOT(terminate(int)));
       }
     }
+  this->recordStartupPhase("Python initialization");
 #endif
 
 #ifdef Slicer_BUILD_EXTENSIONMANAGER_SUPPORT
 
-  qSlicerExtensionsManagerModel * model = new qSlicerExtensionsManagerModel(q);
-  model->setExtensionsSettingsFilePath(q->slicerRevisionUserSettingsFilePath());
-  model->setExtensionsHistorySettingsFilePath(q->slicerUserSettingsFilePath());
-  model->setSlicerRequirements(q->repositoryRevision(), q->os(), q->arch());
-  q->setExtensionsManagerModel(model);
+  if (q->isBatchProcessingEnabled())
+    {
+    // Updating the extensions model reads and writes extension settings and
+    // scans the extensions install directory, which is not needed for
+    // headless batch jobs and would slow down every cold start.
+    q->recordSkippedStartupComponent("Extensions manager");
+    }
+  else
+    {
+    qSlicerExtensionsManagerModel * model = new qSlicerExtensionsManagerModel(q);
+    model->setExtensionsSettingsFilePath(q->slicerRevisionUserSettingsFilePath());
+    model->setExtensionsHistorySettingsFilePath(q->slicerUserSettingsFilePath());
+    model->setSlicerRequirements(q->repositoryRevision(), q->os(), q->arch());
+    q->setExtensionsManagerModel(model);
 
 # ifdef Q_OS_MAC
-  this->createDirectory(this->defaultExtensionsInstallPathForMacOSX(), "extensions"); // Make sure the path exists
-  q->addLibraryPath(this->defaultExtensionsInstallPathForMacOSX());
-  q->setExtensionsInstallPath(this->defaultExtensionsInstallPathForMacOSX());
+    this->createDirectory(this->defaultExtensionsInstallPathForMacOSX(), "extensions"); // Make sure the path exists
+    q->addLibraryPath(this->defaultExtensionsInstallPathForMacOSX());
+    q->setExtensionsInstallPath(this->defaultExtensionsInstallPathForMacOSX());
 # endif
 
-  this->createDirectory(q->extensionsInstallPath(), "extensions"); // Make sure the path exists
+    this->createDirectory(q->extensionsInstallPath(), "extensions"); // Make sure the path exists
 
-  model->updateModel();
+    model->updateModel();
 
-  QStringList updatedExtensions;
-  model->updateScheduledExtensions(updatedExtensions);
-  foreach(const QString& extensionName, updatedExtensions)
-    {
-    qDebug() << "Successfully updated extension" << extensionName;
-    }
+    QStringList updatedExtensions;
+    model->updateScheduledExtensions(updatedExtensions);
+    foreach(const QString& extensionName, updatedExtensions)
+      {
+      qDebug() << "Successfully updated extension" << extensionName;
+      }
 
-  QStringList uninstalledExtensions;
-  model->uninstallScheduledExtensions(uninstalledExtensions);
-  foreach(const QString& extensionName, uninstalledExtensions)
-    {
-    qDebug() << "Successfully uninstalled extension" << extensionName;
+    QStringList uninstalledExtensions;
+    model->uninstallScheduledExtensions(uninstalledExtensions);
+    foreach(const QString& extensionName, uninstalledExtensions)
+      {
+      qDebug() << "Successfully uninstalled extension" << extensionName;
+      }
     }
 
+  this->recordStartupPhase("Extensions manager");
+
 #endif
 
   if (q->userSettings()->value("Internationalization/Enabled").toBool())
     {
-    // We load the language selected for the application
-    qSlicerCoreApplication::loadLanguage();
+    if (q->isBatchProcessingEnabled())
+      {
+      // Translations are only used by the GUI
+      q->recordSkippedStartupComponent("Internationalization");
+      }
+    else
+      {
+      // We load the language selected for the application
+      qSlicerCoreApplication::loadLanguage();
+      }
+    this->recordStartupPhase("Internationalization");
     }
 }
 
@@ -657,6 +688,18 @@ void qSlicerCoreApplicationPrivate::parseArguments()
     }
 }
 
+//-----------------------------------------------------------------------------
+void qSlicerCoreApplicationPrivate::recordStartupPhase(const QString& name)
+{
+  if (!this->StartupTimer.isValid())
+    {
+    return;
+    }
+  qint64 now = this->StartupTimer.elapsed();
+  this->StartupPhaseTimings << qMakePair(name, now - this->LastStartupPhaseTimeMs);
+  this->LastStartupPhaseTimeMs = now;
+}
+
 //-----------------------------------------------------------------------------
 // qSlicerCoreApplication methods
 
@@ -1357,6 +1400,47 @@ qSlicerCoreCommandOptions* qSlicerCoreApplication::coreCommandOptions()const
   return d->CoreCommandOptions.data();
 }
 
+//-----------------------------------------------------------------------------
+bool qSlicerCoreApplication::isBatchProcessingEnabled()const
+{
+  Q_D(const qSlicerCoreApplication);
+  if (!d->CoreCommandOptions)
+    {
+    return false;
+    }
+  return d->CoreCommandOptions->isBatchProcessingEnabled();
+}
+
+//-----------------------------------------------------------------------------
+QStringList qSlicerCoreApplication::skippedStartupComponents()const
+{
+  Q_D(const qSlicerCoreApplication);
+  return d->SkippedStartupComponents;
+}
+
+//-----------------------------------------------------------------------------
+void qSlicerCoreApplication::recordSkippedStartupComponent(const QString& component)
+{
+  Q_D(qSlicerCoreApplication);
+  if (!d->SkippedStartupComponents.contains(component))
+    {
+    d->SkippedStartupComponents << component;
+    }
+}
+
+//-----------------------------------------------------------------------------
+QStringList qSlicerCoreApplication::startupTimingReport()const
+{
+  Q_D(const qSlicerCoreApplication);
+  QStringList report;
+  typedef QPair<QString, qint64> StartupPhaseTimingType;
+  foreach(const StartupPhaseTimingType& timing, d->StartupPhaseTimings)
+    {
+    report << QString("%1: %2 ms").arg(timing.first).arg(timing.second);
+    }
+  return report;
+}
+
 //-----------------------------------------------------------------------------
 QString qSlicerCoreApplication::libraries()const
 {
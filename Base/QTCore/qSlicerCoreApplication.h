@@ -317,6 +317,33 @@ public:
   /// \note qSlicerCoreApplication takes ownership of the object
   void setCoreCommandOptions(qSlicerCoreCommandOptions* options);
 
+  /// Return True if the application runs in headless batch processing mode.
+  /// In this mode only the components needed for scripted processing are
+  /// instantiated (MRML core, module logics, CLI manager) and GUI-only
+  /// subsystems are skipped to reduce startup time.
+  /// \sa qSlicerCoreCommandOptions::isBatchProcessingEnabled()
+  /// \sa skippedStartupComponents()
+  Q_INVOKABLE bool isBatchProcessingEnabled()const;
+
+  /// Return the names of the startup components that were intentionally not
+  /// instantiated, typically because batch processing mode is enabled.
+  /// Empty in a regular interactive session.
+  /// \sa isBatchProcessingEnabled(), recordSkippedStartupComponent()
+  Q_INVOKABLE QStringList skippedStartupComponents()const;
+
+  /// Record that a startup component was intentionally not instantiated so
+  /// that it can be enumerated with skippedStartupComponents(). Called by the
+  /// application subclasses when they skip GUI-only subsystems in batch
+  /// processing mode.
+  void recordSkippedStartupComponent(const QString& component);
+
+  /// Return the duration of each startup phase as a list of
+  /// "phase name: duration in ms" strings, in order of execution.
+  /// Useful for finding out where startup time is spent, for example when
+  /// tuning batch processing pipelines.
+  /// \sa isBatchProcessingEnabled()
+  Q_INVOKABLE QStringList startupTimingReport()const;
+
   /// Get slicer application default settings.
   /// \sa slicerDefaultSettingsFilePath()
   Q_INVOKABLE QSettings* defaultSettings()const;
@@ -33,6 +33,7 @@
 //
 
 // Qt includes
+#include <QElapsedTimer>
 #include <QPointer>
 #include <QProcessEnvironment>
 #include <QSettings>
@@ -123,6 +124,12 @@ public:
   /// Parse arguments
   void parseArguments();
 
+  /// Record the duration of a startup phase, measured from the end of the
+  /// previously recorded phase (or from the start of init() for the first
+  /// phase). Used for generating the startup timing report.
+  /// \sa qSlicerCoreApplication::startupTimingReport()
+  void recordStartupPhase(const QString& name);
+
 public:
   /// MRMLScene and AppLogic pointers
   vtkSmartPointer<vtkMRMLScene>               MRMLScene;
@@ -177,6 +184,17 @@ public:
   /// Associated modules for each node type.
   /// Key: node class name; values: module names.
   QMultiMap<QString, QString> ModulesForNodes;
+
+  /// Names of startup components that were intentionally not instantiated,
+  /// typically because batch processing mode is enabled.
+  /// \sa qSlicerCoreApplication::skippedStartupComponents()
+  QStringList SkippedStartupComponents;
+
+  /// Startup phase durations, in order of execution.
+  /// \sa recordStartupPhase(), qSlicerCoreApplication::startupTimingReport()
+  QElapsedTimer StartupTimer;
+  qint64 LastStartupPhaseTimeMs;
+  QList<QPair<QString, qint64> > StartupPhaseTimings;
 };
 
 #endif
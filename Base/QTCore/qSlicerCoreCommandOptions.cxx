@@ -356,6 +356,13 @@ bool qSlicerCoreCommandOptions::isTestingEnabled() const
   return d->ParsedArgs.value("testing").toBool();
 }
 
+//-----------------------------------------------------------------------------
+bool qSlicerCoreCommandOptions::isBatchProcessingEnabled() const
+{
+  Q_D(const qSlicerCoreCommandOptions);
+  return d->ParsedArgs.value("batch-processing").toBool();
+}
+
 #ifdef Slicer_USE_PYTHONQT
 //-----------------------------------------------------------------------------
 bool qSlicerCoreCommandOptions::isPythonDisabled() const
@@ -384,6 +391,14 @@ void qSlicerCoreCommandOptions::addArguments()
                     testingDescription,
                     QVariant(false));
 
+  this->addArgument("batch-processing", "", QVariant::Bool,
+                    "Start the application in headless batch processing mode: only components needed for "
+                    "scripted processing (MRML core, module logics, CLI manager) are instantiated and GUI-only "
+                    "subsystems (style, settings dialog, extensions manager, internationalization) are skipped "
+                    "to reduce startup time. The skipped components can be enumerated with "
+                    "slicer.app.skippedStartupComponents(). Combine with --no-main-window and "
+                    "--modules-to-ignore to further reduce startup time.");
+
 #ifdef Slicer_USE_PYTHONQT
   this->addArgument("disable-python", "", QVariant::Bool,
                     "Disable python support. This is equivalent to build the application with Slicer_USE_PYTHONQT=OFF.");
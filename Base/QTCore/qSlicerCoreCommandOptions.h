@@ -55,6 +55,7 @@ class Q_SLICER_BASE_QTCORE_EXPORT qSlicerCoreCommandOptions : public ctkCommandL
   Q_PROPERTY(bool verboseModuleDiscovery READ verboseModuleDiscovery CONSTANT)
   Q_PROPERTY(bool disableMessageHandlers READ disableMessageHandlers CONSTANT)
   Q_PROPERTY(bool testingEnabled READ isTestingEnabled CONSTANT)
+  Q_PROPERTY(bool batchProcessing READ isBatchProcessingEnabled CONSTANT)
 #ifdef Slicer_USE_PYTHONQT
   Q_PROPERTY(bool pythonDisabled READ isPythonDisabled CONSTANT)
 #endif
@@ -191,6 +192,14 @@ public:
   /// \sa settingsDisabled()
   bool isTestingEnabled()const;
 
+  /// Return True if slicer is in headless batch processing mode.
+  /// In this mode only the components needed for scripted processing are
+  /// instantiated (MRML core, module logics and the CLI manager); GUI-only
+  /// subsystems are skipped to reduce startup time.
+  /// \sa qSlicerCoreApplication::isBatchProcessingEnabled()
+  /// \sa qSlicerCoreApplication::skippedStartupComponents()
+  bool isBatchProcessingEnabled()const;
+
 #ifdef Slicer_USE_PYTHONQT
   /// Return True if slicer has no python infrastructure initialized.
   /// Python is still compiled with the app, but not enabled at run-time.
@@ -19,8 +19,11 @@
 ==============================================================================*/
 
 // Qt includes
+#include <QDateTime>
 #include <QDebug>
+#include <QFile>
 #include <QFileInfo>
+#include <QTextStream>
 
 // CTK includes
 #include <ctkUtils.h>
@@ -60,6 +63,12 @@ public:
   QList<qSlicerFileReader*> Readers;
   QList<qSlicerFileWriter*> Writers;
   QMap<qSlicerIO::IOFileType, QStringList> FileTypes;
+  /// Memoized result of readers(fileName), keyed by lowercase complete file
+  /// suffix. Which name filters match only depends on the extension, so the
+  /// regular expression probe is run once per distinct extension instead of
+  /// once per file. Cleared when a new reader is registered.
+  /// \sa readers(), qSlicerCoreIOManager::registerIO()
+  mutable QMap<QString, QList<qSlicerFileReader*> > ReadersCacheByExtension;
 };
 
 //-----------------------------------------------------------------------------
@@ -88,6 +97,23 @@ qSlicerFileReader* qSlicerCoreIOManagerPrivate::reader(const QString& fileName)c
 //-----------------------------------------------------------------------------
 QList<qSlicerFileReader*> qSlicerCoreIOManagerPrivate::readers(const QString& fileName)const
 {
+  QFileInfo file(fileName);
+  if (!file.isFile() ||
+      !file.isReadable() ||
+      file.suffix().contains('~')) //temporary file
+    {
+    return QList<qSlicerFileReader*>();
+    }
+  // The probe below only depends on the file extension (the name filters are
+  // all of the form "*.ext"), so its result is memoized per extension. This
+  // makes loading a large batch of files (e.g. a folder dropped onto the
+  // application) run the name filter regular expressions only once per
+  // distinct extension instead of once per file.
+  QString cacheKey = file.completeSuffix().toLower();
+  if (!cacheKey.isEmpty() && this->ReadersCacheByExtension.contains(cacheKey))
+    {
+    return this->ReadersCacheByExtension.value(cacheKey);
+    }
   // Use a map so that we can access readers sorted by confidence.
   // The more specific the filter that was matched, the higher confidence
   // that the reader is more appropriate (e.g., *.seg.nrrd is more specific than *.nrrd;
@@ -112,6 +138,10 @@ QList<qSlicerFileReader*> qSlicerCoreIOManagerPrivate::readers(const QString& fi
     i.next();
     matchingReaders.push_front(i.value());
     }
+  if (!cacheKey.isEmpty())
+    {
+    this->ReadersCacheByExtension.insert(cacheKey, matchingReaders);
+    }
   return matchingReaders;
 }
 
@@ -633,6 +663,115 @@ bool qSlicerCoreIOManager::saveScene(const QString& fileName, QImage screenShot)
   return this->saveNodes(QString("SceneFile"), properties);
 }
 
+//-----------------------------------------------------------------------------
+bool qSlicerCoreIOManager::saveSceneDifferentially(const QString& fileName, QImage screenShot)
+{
+  Q_D(qSlicerCoreIOManager);
+  vtkMRMLScene* scene = d->currentScene();
+  if (!scene)
+    {
+    qCritical() << Q_FUNC_INFO << " failed: invalid scene";
+    return false;
+    }
+
+  // Read the manifest of the previous save: one "size|time|path" line per
+  // storage file, used to detect files changed or removed behind our back
+  QString manifestFileName = fileName + ".manifest";
+  QMap<QString, QString> previousManifest;
+  QFile manifestFile(manifestFileName);
+  if (manifestFile.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+    QTextStream manifestStream(&manifestFile);
+    while (!manifestStream.atEnd())
+      {
+      QString line = manifestStream.readLine();
+      QString path = line.section('|', 2);
+      if (!path.isEmpty())
+        {
+        previousManifest[path] = line.section('|', 0, 1);
+        }
+      }
+    manifestFile.close();
+    }
+
+  bool success = true;
+  int writtenCount = 0;
+  int skippedCount = 0;
+  QMap<QString, QString> updatedManifest;
+  int numberOfStorableNodes = scene->GetNumberOfNodesByClass("vtkMRMLStorableNode");
+  for (int nodeIndex = 0; nodeIndex < numberOfStorableNodes; ++nodeIndex)
+    {
+    vtkMRMLStorableNode* storableNode = vtkMRMLStorableNode::SafeDownCast(
+      scene->GetNthNodeByClass(nodeIndex, "vtkMRMLStorableNode"));
+    if (!storableNode || !storableNode->GetSaveWithScene())
+      {
+      continue;
+      }
+    vtkMRMLStorageNode* storageNode = storableNode->GetStorageNode();
+    if (!storageNode || storageNode->GetFileName() == 0)
+      {
+      // node is stored in the scene file itself
+      continue;
+      }
+    QString storageFileName = QString::fromLocal8Bit(
+      storageNode->GetFullNameFromFileName().c_str());
+    QFileInfo storageFileInfo(storageFileName);
+    QString diskStamp;
+    if (storageFileInfo.exists())
+      {
+      diskStamp = QString("%1|%2").arg(storageFileInfo.size())
+        .arg(storageFileInfo.lastModified().toTime_t());
+      }
+    bool upToDate = !storableNode->GetModifiedSinceRead()
+      && !diskStamp.isEmpty()
+      && previousManifest.value(storageFileName) == diskStamp;
+    if (upToDate)
+      {
+      ++skippedCount;
+      }
+    else
+      {
+      if (!storageNode->WriteData(storableNode))
+        {
+        qWarning() << Q_FUNC_INFO << ": failed to write" << storageFileName
+                   << "for node" << storableNode->GetID();
+        success = false;
+        continue;
+        }
+      ++writtenCount;
+      storageFileInfo.refresh();
+      diskStamp = QString("%1|%2").arg(storageFileInfo.size())
+        .arg(storageFileInfo.lastModified().toTime_t());
+      }
+    updatedManifest[storageFileName] = diskStamp;
+    }
+
+  // the scene file itself is small, always rewrite it
+  if (!this->saveScene(fileName, screenShot))
+    {
+    return false;
+    }
+
+  if (manifestFile.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate))
+    {
+    QTextStream manifestStream(&manifestFile);
+    QMap<QString, QString>::const_iterator entry = updatedManifest.constBegin();
+    for (; entry != updatedManifest.constEnd(); ++entry)
+      {
+      manifestStream << entry.value() << "|" << entry.key() << "\n";
+      }
+    manifestFile.close();
+    }
+  else
+    {
+    qWarning() << Q_FUNC_INFO << ": could not write manifest" << manifestFileName;
+    }
+
+  qDebug() << Q_FUNC_INFO << ": wrote" << writtenCount << "storage file(s), skipped"
+           << skippedCount << "unmodified file(s)";
+  return success;
+}
+
 //-----------------------------------------------------------------------------
 const QList<qSlicerFileReader*>& qSlicerCoreIOManager::readers()const
 {
@@ -707,6 +846,7 @@ void qSlicerCoreIOManager::registerIO(qSlicerIO* io)
   else if (fileReader)
     {
     d->Readers << fileReader;
+    d->ReadersCacheByExtension.clear();
     }
 
   // Reparent - this will make sure the object is destroyed properly
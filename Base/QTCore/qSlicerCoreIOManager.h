@@ -145,6 +145,17 @@ public:
   /// and screenShot set as properties.
   Q_INVOKABLE bool saveScene(const QString& fileName, QImage screenShot);
 
+  /// Differential scene save: write only the storage files of nodes whose
+  /// data changed since it was last read or written (\sa
+  /// vtkMRMLStorableNode::GetModifiedSinceRead()), then save the scene file
+  /// itself. A manifest next to the scene file (fileName + ".manifest")
+  /// records the size and time stamp of every storage file, and a skipped
+  /// file that is missing or no longer matches its manifest entry is
+  /// rewritten, so files deleted or truncated outside the application are
+  /// repaired instead of silently trusted. Returns false if the scene file
+  /// or any required storage file could not be written.
+  Q_INVOKABLE bool saveSceneDifferentially(const QString& fileName, QImage screenShot);
+
   /// Register the reader/writer \a io
   /// Note also that the IOManager takes ownership of \a io
   void registerIO(qSlicerIO* io);
@@ -19,8 +19,11 @@
 ==============================================================================*/
 
 // Qt includes
+#include <QDateTime>
 #include <QDebug>
 #include <QDir>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
 #include <QMessageBox>
 #include <QNetworkAccessManager>
 #include <QNetworkRequest>
@@ -29,6 +32,7 @@
 #include <QStandardItemModel>
 #include <QTemporaryFile>
 #include <QTextStream>
+#include <QTimer>
 #include <QUrl>
 
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
@@ -169,6 +173,12 @@ public:
 
   QFileInfoList extensionDescriptionFileInfos(const QString& extensionDescriptionPath)const;
 
+  /// Keep the file system watcher pointed at the current extensions install
+  /// path so that description files added or removed by another process
+  /// (e.g. a second application instance) are picked up without polling.
+  /// \sa updateModel()
+  void updateExtensionsInstallPathWatcher();
+
   void addExtensionModelRow(const ExtensionMetadataType &metadata);
   QStandardItem* extensionItem(const QString& extensionName, int column = Self::NameColumn)const;
 
@@ -232,6 +242,12 @@ public:
   qSlicerExtensionsManagerModel::ExtensionMetadataType retrieveExtensionMetadata(
     const qMidasAPI::ParametersType& parameters);
 
+  /// Path of the persisted extension metadata cache, located next to the
+  /// extensions settings file. Empty if the extensions settings file path
+  /// has not been set.
+  /// \sa retrieveExtensionMetadata()
+  QString extensionsMetadataCacheFilePath()const;
+
   void initializeColumnIdToNameMap(int columnIdx, const char* columnName);
   QHash<int, QString> ColumnIdToName;
   QStringList ColumnNames;
@@ -239,6 +255,13 @@ public:
   bool NewExtensionEnabledByDefault;
 
   QNetworkAccessManager NetworkManager;
+
+  /// Watches the extensions install path using the native change
+  /// notification mechanism (inotify, FSEvents, ...) and coalesces bursts of
+  /// change notifications into a single deferred updateModel() call.
+  QFileSystemWatcher ExtensionsInstallPathWatcher;
+  QTimer UpdateModelCoalescingTimer;
+
   qMidasAPI CheckForUpdatesApi;
   QHash<QUuid, UpdateCheckInformation> CheckForUpdatesRequests;
 
@@ -312,6 +335,15 @@ void qSlicerExtensionsManagerModelPrivate::init()
   this->Model.CustomRoleNames = roleNames;
 #endif
 
+  this->UpdateModelCoalescingTimer.setSingleShot(true);
+  this->UpdateModelCoalescingTimer.setInterval(500);
+
+  QObject::connect(&this->UpdateModelCoalescingTimer, SIGNAL(timeout()),
+                   q, SLOT(updateModel()));
+
+  QObject::connect(&this->ExtensionsInstallPathWatcher, SIGNAL(directoryChanged(QString)),
+                   &this->UpdateModelCoalescingTimer, SLOT(start()));
+
   QObject::connect(q, SIGNAL(slicerRequirementsChanged(QString,QString,QString)),
                    q, SLOT(identifyIncompatibleExtensions()));
 
@@ -399,6 +431,30 @@ QFileInfoList qSlicerExtensionsManagerModelPrivate::extensionDescriptionFileInfo
   return fileInfos;
 }
 
+// --------------------------------------------------------------------------
+void qSlicerExtensionsManagerModelPrivate::updateExtensionsInstallPathWatcher()
+{
+  Q_Q(qSlicerExtensionsManagerModel);
+
+  QString extensionDescriptionPath = q->extensionsInstallPath();
+  QStringList watchedDirectories = this->ExtensionsInstallPathWatcher.directories();
+  if (watchedDirectories.contains(extensionDescriptionPath))
+    {
+    return;
+    }
+  if (!watchedDirectories.isEmpty())
+    {
+    this->ExtensionsInstallPathWatcher.removePaths(watchedDirectories);
+    }
+  // The install path may not exist yet (no extension has been installed);
+  // updateModel() is called again after the first installation, at which
+  // point the directory can be watched.
+  if (!extensionDescriptionPath.isEmpty() && QDir(extensionDescriptionPath).exists())
+    {
+    this->ExtensionsInstallPathWatcher.addPath(extensionDescriptionPath);
+    }
+}
+
 // --------------------------------------------------------------------------
 void qSlicerExtensionsManagerModelPrivate::addExtensionModelRow(const ExtensionMetadataType &metadata)
 {
@@ -960,18 +1016,68 @@ void qSlicerExtensionsManagerModelPrivate::initializeColumnIdToNameMap(int colum
   this->ColumnNames << columnName;
 }
 
+namespace
+{
+// How long a cached server answer may be served without contacting the
+// server again. Extension metadata for a given application revision
+// changes at most daily (nightly factory builds).
+const int METADATA_CACHE_REFRESH_INTERVAL_SECS = 24 * 3600;
+}
+
+// --------------------------------------------------------------------------
+QString qSlicerExtensionsManagerModelPrivate::extensionsMetadataCacheFilePath()const
+{
+  if (this->ExtensionsSettingsFilePath.isEmpty())
+    {
+    return QString();
+    }
+  return QFileInfo(this->ExtensionsSettingsFilePath).dir().filePath("ExtensionsMetadataCache.ini");
+}
+
 // --------------------------------------------------------------------------
 qSlicerExtensionsManagerModel::ExtensionMetadataType qSlicerExtensionsManagerModelPrivate
 ::retrieveExtensionMetadata(const qMidasAPI::ParametersType& parameters)
 {
   Q_Q(const qSlicerExtensionsManagerModel);
 
+  // Check the persisted metadata cache first: gathering information about
+  // many extensions (e.g. extension history on startup) would otherwise
+  // issue one blocking server query per extension.
+  QString cacheKey;
+  foreach(const QString& parameterName, parameters.keys())
+    {
+    cacheKey += QString("%1=%2&").arg(parameterName, parameters.value(parameterName));
+    }
+  QString cacheFilePath = this->extensionsMetadataCacheFilePath();
+  uint currentTime = QDateTime::currentDateTime().toTime_t();
+  ExtensionMetadataType cachedMetadata;
+  bool cachedMetadataAvailable = false;
+  if (!cacheFilePath.isEmpty() && !cacheKey.isEmpty())
+    {
+    QSettings cache(cacheFilePath, QSettings::IniFormat);
+    cachedMetadata = cache.value(cacheKey + "/metadata").toMap();
+    cachedMetadataAvailable = !cachedMetadata.isEmpty();
+    uint cacheTime = cache.value(cacheKey + "/queryTime").toUInt();
+    if (cachedMetadataAvailable
+      && currentTime >= cacheTime
+      && currentTime - cacheTime < METADATA_CACHE_REFRESH_INTERVAL_SECS)
+      {
+      return cachedMetadata;
+      }
+    }
+
   bool ok = false;
   QList<QVariantMap> results = qMidasAPI::synchronousQuery(
         ok, q->serverUrl().toString(),
         "midas.slicerpackages.extension.list", parameters);
   if (!ok || results.count() != 1)
     {
+    if (cachedMetadataAvailable)
+      {
+      // Server is not reachable (e.g. offline or behind a restrictive
+      // proxy): serve the stale cache entry instead of failing.
+      return cachedMetadata;
+      }
     this->critical(results[0]["queryError"].toString());
     return ExtensionMetadataType();
     }
@@ -989,6 +1095,13 @@ qSlicerExtensionsManagerModel::ExtensionMetadataType qSlicerExtensionsManagerMod
       q->serverToExtensionDescriptionKey().value(key, key), result.value(key));
     }
 
+  if (!cacheFilePath.isEmpty() && !cacheKey.isEmpty())
+    {
+    QSettings cache(cacheFilePath, QSettings::IniFormat);
+    cache.setValue(cacheKey + "/metadata", updatedExtensionMetadata);
+    cache.setValue(cacheKey + "/queryTime", currentTime);
+    }
+
   return updatedExtensionMetadata;
 }
 
@@ -1291,6 +1404,19 @@ qSlicerExtensionsManagerModel::ExtensionMetadataType qSlicerExtensionsManagerMod
   return d->retrieveExtensionMetadata(parameters);
 }
 
+// --------------------------------------------------------------------------
+void qSlicerExtensionsManagerModel::clearExtensionsMetadataCache()
+{
+  Q_D(qSlicerExtensionsManagerModel);
+  QString cacheFilePath = d->extensionsMetadataCacheFilePath();
+  if (cacheFilePath.isEmpty())
+    {
+    return;
+    }
+  QSettings cache(cacheFilePath, QSettings::IniFormat);
+  cache.clear();
+}
+
 // --------------------------------------------------------------------------
 qSlicerExtensionDownloadTask*
 qSlicerExtensionsManagerModelPrivate::downloadExtension(
@@ -2219,6 +2345,11 @@ void qSlicerExtensionsManagerModel::updateModel()
 
   QString extensionDescriptionPath = this->extensionsInstallPath();
 
+  // The model is about to be rebuilt, a pending watcher-triggered update
+  // would be redundant.
+  d->UpdateModelCoalescingTimer.stop();
+  d->updateExtensionsInstallPathWatcher();
+
   d->Model.clear();
 
   foreach(const QFileInfo& fileInfo, d->extensionDescriptionFileInfos(extensionDescriptionPath))
@@ -205,6 +205,16 @@ public:
   /// \sa setServerUrl
   Q_INVOKABLE ExtensionMetadataType retrieveExtensionMetadataByName(const QString& extensionName);
 
+  /// \brief Remove the persisted extension metadata cache.
+  ///
+  /// Server answers of metadata queries are cached on disk next to the
+  /// extensions settings file and served without contacting the server
+  /// for a day, so that opening the extensions manager or gathering the
+  /// extension history does not issue one blocking query per extension.
+  /// Clearing the cache forces the next queries to fetch fresh metadata.
+  /// \sa retrieveExtensionMetadata, retrieveExtensionMetadataByName
+  Q_INVOKABLE void clearExtensionsMetadataCache();
+
   /// Install extension from the specified archive file.
   ///
   /// This attempts to install an extension given only the archive file
@@ -338,6 +348,10 @@ public slots:
 
   QStringList checkInstallPrerequisites() const;
 
+  /// Rebuild the model from the extension description files found in the
+  /// extensions install path. The model is also updated automatically when
+  /// description files are added to or removed from the install path by
+  /// another process (e.g. a second application instance).
   void updateModel();
 
 signals:
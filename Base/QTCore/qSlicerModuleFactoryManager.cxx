@@ -18,9 +18,13 @@
 
 ==============================================================================*/
 
+// Qt includes
+#include <QSettings>
+
 // SlicerQt includes
 #include "qSlicerModuleFactoryManager.h"
 #include "qSlicerAbstractCoreModule.h"
+#include "qSlicerCoreApplication.h"
 
 #include "vtkSlicerConfigure.h" // XXX For modulePaths() function.
 
@@ -168,6 +172,15 @@ bool qSlicerModuleFactoryManager::loadModule(const QString& name, const QString&
   // Update internal Map
   d->LoadedModules << name;
 
+  // Modules listed in the 'Modules/DeferredStartupModules' setting only
+  // create their logic on first access instead of at startup.
+  qSlicerCoreApplication* app = qSlicerCoreApplication::application();
+  if (app && app->revisionUserSettings()
+        ->value("Modules/DeferredStartupModules").toStringList().contains(name))
+    {
+    instance->setLogicCreatedOnStartup(false);
+    }
+
   // Initialize module
   instance->initialize(d->AppLogic);
 
@@ -122,6 +122,9 @@ public:
   /// Initialize application style
   void initStyle();
 
+  /// Create the settings dialog and its panels
+  void initSettingsDialog();
+
   virtual QSettings* newSettings();
 
   /// ErrorLogModel - It should exist only one instance of the ErrorLogModel
@@ -217,11 +220,24 @@ void qSlicerApplicationPrivate::init()
     }
 #endif
 
-  this->initStyle();
+  if (q->isBatchProcessingEnabled())
+    {
+    // Style, tooltip handling and the settings dialog are pure QWidget
+    // machinery that headless batch jobs never use
+    q->recordSkippedStartupComponent("Style");
+    q->recordSkippedStartupComponent("Tooltip manager");
+    q->recordSkippedStartupComponent("Settings dialog");
+    }
+  else
+    {
+    this->initStyle();
 
-  this->ToolTipTrapper = new ctkToolTipTrapper(q);
-  this->ToolTipTrapper->setToolTipsTrapped(false);
-  this->ToolTipTrapper->setToolTipsWordWrapped(true);
+    this->ToolTipTrapper = new ctkToolTipTrapper(q);
+    this->ToolTipTrapper->setToolTipsTrapped(false);
+    this->ToolTipTrapper->setToolTipsWordWrapped(true);
+    }
+
+  this->recordStartupPhase("Style and tooltips");
 
   //----------------------------------------------------------------------------
   // Instantiate ErrorLogModel
@@ -247,9 +263,55 @@ void qSlicerApplicationPrivate::init()
   q->setupFileLogging();
   q->logApplicationInformation();
 
+  this->recordStartupPhase("Error log");
+
   //----------------------------------------------------------------------------
   // Settings Dialog
   //----------------------------------------------------------------------------
+  if (!q->isBatchProcessingEnabled())
+    {
+    this->initSettingsDialog();
+    }
+
+  this->recordStartupPhase("Settings dialog");
+  //----------------------------------------------------------------------------
+  // Test Utility
+  //----------------------------------------------------------------------------
+#ifdef Slicer_USE_QtTesting
+  this->TestingUtility = new ctkQtTestingUtility(0);
+  this->TestingUtility->addEventObserver(
+      "xml", new ctkXMLEventObserver(this->TestingUtility));
+  ctkXMLEventSource* eventSource = new ctkXMLEventSource(this->TestingUtility);
+  eventSource->setRestoreSettingsAuto(
+      qSlicerApplication::testAttribute(qSlicerCoreApplication::AA_EnableTesting));
+  this->TestingUtility->addEventSource("xml", eventSource);
+
+  // Translator and Player for MRML widget
+  this->TestingUtility->addPlayer(
+      new qMRMLCheckableNodeComboBoxEventPlayer());
+  this->TestingUtility->addPlayer(
+      new qMRMLNodeComboBoxEventPlayer());
+  this->TestingUtility->addTranslator(
+      new qMRMLNodeComboBoxEventTranslator());
+  this->TestingUtility->addPlayer(
+      new qMRMLTreeViewEventPlayer());
+  this->TestingUtility->addTranslator(
+      new qMRMLTreeViewEventTranslator());
+
+  // Player for the CLI Module || cannot be added for the moment ...
+#endif
+}
+/*
+#if !defined (QT_NO_LIBRARY) && !defined(QT_NO_SETTINGS)
+Q_GLOBAL_STATIC_WITH_ARGS(QFactoryLoader, loaderV2,
+    (QIconEngineFactoryInterfaceV2_iid, QLatin1String("/iconengines"), Qt::CaseInsensitive))
+#endif
+*/
+//-----------------------------------------------------------------------------
+void qSlicerApplicationPrivate::initSettingsDialog()
+{
+  Q_Q(qSlicerApplication);
+
   this->SettingsDialog = new ctkSettingsDialog(0);
   this->SettingsDialog->setResetButton(true);
   // Some settings panels are quite large, show maximize button to allow resizing with a single click
@@ -299,40 +361,8 @@ void qSlicerApplicationPrivate::init()
 
   QObject::connect(this->SettingsDialog, SIGNAL(restartRequested()),
                    q, SLOT(restart()));
-
-  //----------------------------------------------------------------------------
-  // Test Utility
-  //----------------------------------------------------------------------------
-#ifdef Slicer_USE_QtTesting
-  this->TestingUtility = new ctkQtTestingUtility(0);
-  this->TestingUtility->addEventObserver(
-      "xml", new ctkXMLEventObserver(this->TestingUtility));
-  ctkXMLEventSource* eventSource = new ctkXMLEventSource(this->TestingUtility);
-  eventSource->setRestoreSettingsAuto(
-      qSlicerApplication::testAttribute(qSlicerCoreApplication::AA_EnableTesting));
-  this->TestingUtility->addEventSource("xml", eventSource);
-
-  // Translator and Player for MRML widget
-  this->TestingUtility->addPlayer(
-      new qMRMLCheckableNodeComboBoxEventPlayer());
-  this->TestingUtility->addPlayer(
-      new qMRMLNodeComboBoxEventPlayer());
-  this->TestingUtility->addTranslator(
-      new qMRMLNodeComboBoxEventTranslator());
-  this->TestingUtility->addPlayer(
-      new qMRMLTreeViewEventPlayer());
-  this->TestingUtility->addTranslator(
-      new qMRMLTreeViewEventTranslator());
-
-  // Player for the CLI Module || cannot be added for the moment ...
-#endif
 }
-/*
-#if !defined (QT_NO_LIBRARY) && !defined(QT_NO_SETTINGS)
-Q_GLOBAL_STATIC_WITH_ARGS(QFactoryLoader, loaderV2,
-    (QIconEngineFactoryInterfaceV2_iid, QLatin1String("/iconengines"), Qt::CaseInsensitive))
-#endif
-*/
+
 //-----------------------------------------------------------------------------
 void qSlicerApplicationPrivate::initStyle()
 {
@@ -559,6 +589,11 @@ void qSlicerApplication::onSlicerApplicationLogicModified()
 void qSlicerApplication::setToolTipsEnabled(bool enable)
 {
   Q_D(qSlicerApplication);
+  if (!d->ToolTipTrapper)
+    {
+    // not instantiated in batch processing mode
+    return;
+    }
   d->ToolTipTrapper->setToolTipsTrapped(!enable);
 }
 
@@ -16,6 +16,8 @@
 #include "vtkFSLookupTable.h"
 
 // VTK includes
+#include <vtkMultiThreader.h>
+#include <vtkNew.h>
 #include <vtkObjectFactory.h>
 
 //------------------------------------------------------------------------------
@@ -34,6 +36,20 @@ vtkFSLookupTable::vtkFSLookupTable()
     this->Blufact = 1.0;
     this->FMid = 0.0;
     this->NumberOfColors = 256;
+
+    this->MappingTableMin = 0.0;
+    this->MappingTableScale = 1.0;
+    this->MappingTableValid = 0;
+    this->BuildLowThresh = 0.0;
+    this->BuildHiThresh = 0.0;
+    this->BuildLutType = -1;
+    this->BuildReverse = 0;
+    this->BuildTruncate = 0;
+    this->BuildOffset = 0.0;
+    this->BuildSlope = 0.0;
+    this->BuildBlufact = 0.0;
+    this->BuildFMid = 0.0;
+    this->BuildAlpha = 0.0;
 }
 
 //------------------------------------------------------------------------------
@@ -190,6 +206,13 @@ void vtkFSLookupTable::SetRange(double /*lo*/, double /*hi*/)
 
 //------------------------------------------------------------------------------
 const unsigned char *vtkFSLookupTable::MapValue(double val)
+{
+    this->ComputeColor(val, this->RGBA);
+    return this->RGBA;
+}
+
+//------------------------------------------------------------------------------
+void vtkFSLookupTable::ComputeColor(double val, unsigned char rgba[4])
 {
     /// variables for the heat colour scale
     float f, ftmp, c1, c2, fcurv;
@@ -263,10 +286,10 @@ const unsigned char *vtkFSLookupTable::MapValue(double val)
                 this->Offset*((f < this->LowThresh)?1:(f < this->FMid)?1 - (f - this->LowThresh)/(this->FMid - this->LowThresh):0);
         }
 
-        this->RGBA[0] = (unsigned char)(r * 255.0);
-        this->RGBA[1] = (unsigned char)(g * 255.0);
-        this->RGBA[2] = (unsigned char)(b * 255.0);
-        this->RGBA[3] = (unsigned char)(a * 255.0);
+        rgba[0] = (unsigned char)(r * 255.0);
+        rgba[1] = (unsigned char)(g * 255.0);
+        rgba[2] = (unsigned char)(b * 255.0);
+        rgba[3] = (unsigned char)(a * 255.0);
 
         break;
     case FSLUTGREENRED:
@@ -296,10 +319,10 @@ const unsigned char *vtkFSLookupTable::MapValue(double val)
             b = 255 * (this->Offset*this->Blufact*(1 - fabs(f)));
         }
 
-        this->RGBA[0] = (unsigned char)(r);
-        this->RGBA[1] = (unsigned char)(g);
-        this->RGBA[2] = (unsigned char)(b);
-        this->RGBA[3] = (unsigned char)(a * 255.0);
+        rgba[0] = (unsigned char)(r);
+        rgba[1] = (unsigned char)(g);
+        rgba[2] = (unsigned char)(b);
+        rgba[3] = (unsigned char)(a * 255.0);
 
         break;
     case FSLUTREDGREEN:
@@ -330,10 +353,10 @@ const unsigned char *vtkFSLookupTable::MapValue(double val)
             b = 255 * (this->Offset*this->Blufact*(1 - fabs(f)));
         }
 
-        this->RGBA[0] = (unsigned char)(r);
-        this->RGBA[1] = (unsigned char)(g);
-        this->RGBA[2] = (unsigned char)(b);
-        this->RGBA[3] = (unsigned char)(a * 255.0);
+        rgba[0] = (unsigned char)(r);
+        rgba[1] = (unsigned char)(g);
+        rgba[2] = (unsigned char)(b);
+        rgba[3] = (unsigned char)(a * 255.0);
 
         break;
         /*
@@ -348,9 +371,98 @@ const unsigned char *vtkFSLookupTable::MapValue(double val)
         vtkErrorMacro(<<"Unknown look up table type " << this->LutType);
     }
 
-//    vtkDebugMacro(<<"R = " << this->RGBA[1] << ", G = " <<  this->RGBA[2] << ", B = " <<  this->RGBA[3] << endl);
+//    vtkDebugMacro(<<"R = " << rgba[1] << ", G = " <<  rgba[2] << ", B = " <<  rgba[3] << endl);
+}
 
-    return this->RGBA;
+//------------------------------------------------------------------------------
+void vtkFSLookupTable::BuildMappingTable()
+{
+    if (this->MappingTableValid &&
+        this->BuildLowThresh == this->LowThresh &&
+        this->BuildHiThresh == this->HiThresh &&
+        this->BuildLutType == this->LutType &&
+        this->BuildReverse == this->Reverse &&
+        this->BuildTruncate == this->Truncate &&
+        this->BuildOffset == this->Offset &&
+        this->BuildSlope == this->Slope &&
+        this->BuildBlufact == this->Blufact &&
+        this->BuildFMid == this->FMid &&
+        this->BuildAlpha == this->Alpha)
+    {
+        // nothing changed since the last build
+        return;
+    }
+    this->MappingTableValid = 0;
+
+    // Work out the value range over which the colour functions actually
+    // vary; outside of it they are constant, so clamping a value to the end
+    // samples of the table maps it correctly.
+    double minVal;
+    double maxVal;
+    switch (this->LutType) {
+    case FSLUTHEAT:
+    case FSLUTBLUERED:
+    case FSLUTREDBLUE:
+        // the heat scale is a function of the magnitude of the value and
+        // saturates above FMid + 1/Slope and above LowThresh
+        maxVal = fabs(this->FMid);
+        if (this->Slope > 0.0)
+        {
+            maxVal += 1.0/this->Slope;
+        }
+        else
+        {
+            maxVal += 1.0;
+        }
+        if (fabs(this->LowThresh) > maxVal)
+        {
+            maxVal = fabs(this->LowThresh);
+        }
+        minVal = -maxVal;
+        break;
+    case FSLUTGREENRED:
+    case FSLUTREDGREEN:
+        // constant below the low threshold and above the high threshold
+        minVal = this->LowThresh;
+        maxVal = this->HiThresh;
+        break;
+    default:
+        // labels go through the superclass, anything else is an error
+        return;
+    }
+    if (!(maxVal > minVal))
+    {
+        minVal -= 1.0;
+        maxVal += 1.0;
+    }
+
+    // Widen the range by one step on each side so that the end samples are
+    // taken strictly outside the thresholds and hold the saturated colours.
+    double step = (maxVal - minVal)/(FSLUTMAPPINGTABLESIZE - 3);
+    minVal -= step;
+    maxVal += step;
+
+    this->MappingTable.resize(4*FSLUTMAPPINGTABLESIZE);
+    for (int i = 0; i < FSLUTMAPPINGTABLESIZE; i++)
+    {
+        this->ComputeColor(minVal + i*step, &this->MappingTable[4*i]);
+    }
+    this->MappingTableMin = minVal;
+    this->MappingTableScale = 1.0/step;
+
+    // record the parameters after sampling, ComputeColor may turn Reverse
+    // on for the red/blue scale
+    this->BuildLowThresh = this->LowThresh;
+    this->BuildHiThresh = this->HiThresh;
+    this->BuildLutType = this->LutType;
+    this->BuildReverse = this->Reverse;
+    this->BuildTruncate = this->Truncate;
+    this->BuildOffset = this->Offset;
+    this->BuildSlope = this->Slope;
+    this->BuildBlufact = this->Blufact;
+    this->BuildFMid = this->FMid;
+    this->BuildAlpha = this->Alpha;
+    this->MappingTableValid = 1;
 }
 
 //------------------------------------------------------------------------------
@@ -363,16 +475,95 @@ void vtkFSLookupTable::GetColor(double val, double rgb[3])
     rgb[2] = rgb8[2]/255.0;
 }
 
+//------------------------------------------------------------------------------
+// Shared state of the threads colouring a range of scalars through the
+// sampled mapping table (\sa vtkFSLookupTableMapCallback).
+struct vtkFSLookupTableMapJob
+{
+    void *Input;
+    unsigned char *Output;
+    int InputDataType;
+    int NumberOfValues;
+    int InputIncrement;
+    int OutputIncrement;
+    const unsigned char *Table;
+    int TableSize;
+    double TableMin;
+    double TableScale;
+};
+
+//------------------------------------------------------------------------------
+// Colour the scalars in [first, last) with a table look up per value.
+template <class T>
+void vtkFSLookupTableMapRange(vtkFSLookupTableMapJob *job, int first, int last)
+{
+    const T *input = static_cast<T *>(job->Input);
+    for (int n = first; n < last; n++)
+    {
+        double val = input[n*job->InputIncrement];
+        int index = (int)((val - job->TableMin)*job->TableScale + 0.5);
+        if (index < 0)
+        {
+            index = 0;
+        }
+        else if (index >= job->TableSize)
+        {
+            index = job->TableSize - 1;
+        }
+        const unsigned char *rgba = job->Table + 4*index;
+        unsigned char *out = job->Output + n*job->OutputIncrement;
+        out[0] = rgba[0];
+        out[1] = rgba[1];
+        out[2] = rgba[2];
+        if (job->OutputIncrement == VTK_RGBA)
+        {
+            out[3] = rgba[3];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Each thread colours its own contiguous range of the scalars.
+VTK_THREAD_RETURN_TYPE vtkFSLookupTableMapCallback(void *arg)
+{
+    vtkMultiThreader::ThreadInfo *info = static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+    vtkFSLookupTableMapJob *job = static_cast<vtkFSLookupTableMapJob *>(info->UserData);
+
+    int valuesPerThread = (job->NumberOfValues + info->NumberOfThreads - 1)/info->NumberOfThreads;
+    int first = info->ThreadID*valuesPerThread;
+    int last = first + valuesPerThread;
+    if (last > job->NumberOfValues)
+    {
+        last = job->NumberOfValues;
+    }
+    if (first >= last)
+    {
+        return VTK_THREAD_RETURN_VALUE;
+    }
+
+    switch (job->InputDataType)
+    {
+    case VTK_DOUBLE:
+        vtkFSLookupTableMapRange<double>(job, first, last);
+        break;
+    case VTK_FLOAT:
+        vtkFSLookupTableMapRange<float>(job, first, last);
+        break;
+    case VTK_INT:
+        vtkFSLookupTableMapRange<int>(job, first, last);
+        break;
+    case VTK_UNSIGNED_CHAR:
+        vtkFSLookupTableMapRange<unsigned char>(job, first, last);
+        break;
+    }
+    return VTK_THREAD_RETURN_VALUE;
+}
+
 //------------------------------------------------------------------------------
 void vtkFSLookupTable::MapScalarsThroughTable2(void *input, unsigned char *output,
                                int inputDataType, int numberOfValues,
                                int inputIncrement, int outputIncrement)
 {
-    int n;
-    double rgb[3];
-    double val;
-    const unsigned char alpha = (unsigned char)(this->Alpha * 255.0);
-
     vtkDebugMacro( << "MapScalarsThroughTable2:\n");
     vtkDebugMacro( << "\tinputDataType = " << inputDataType << ", number of vals = " << numberOfValues << ", input incr = " << inputIncrement << ",\noutput incr = " << outputIncrement << ", VTK_RGBA data type = "<< VTK_RGBA << ", lut type = " << this->LutType << endl);
 
@@ -403,141 +594,49 @@ void vtkFSLookupTable::MapScalarsThroughTable2(void *input, unsigned char *outpu
       }
 
 
-    switch (inputDataType)
+    if (inputDataType != VTK_DOUBLE &&
+        inputDataType != VTK_FLOAT &&
+        inputDataType != VTK_INT &&
+        inputDataType != VTK_UNSIGNED_CHAR)
       {
-      case VTK_DOUBLE:
-        vtkDebugMacro(<<"Input data type is double.");
-        for (n = 0; n < numberOfValues; n++)
-          {
-          double *inPtr;
-          inPtr = static_cast<double *>(input);
-          inPtr += n*inputIncrement;
-          val = *inPtr;
-          this->GetColor(val, rgb);
-          if (n < 100) // (n % 10000 == 0)
-            {
-            vtkDebugMacro( << n << ": val = " << val << ", rgb = " << rgb[0] << "," << rgb[1] << "," << rgb[2] << "\noutput array index = " << n*outputIncrement*sizeof(unsigned char));
-            }
-          if (rgb[0] < 0.0 || rgb[0] > 1.0 ||
-              rgb[1] < 0.0 || rgb[1] > 1.0 ||
-              rgb[2] < 0.0 || rgb[2] > 1.0)
-            {
-            // invalid colour values, use 0
-            vtkDebugMacro(<<"Val " << val << " resulted in invalid rgb, out of range 0-1, using 0 0 0 instead of " << rgb[0] << " " << rgb[1] << " " << rgb[2] );
-            rgb[0] = 0.0;
-            rgb[1] = 0.0;
-            rgb[2] = 0.0;
-            }
-          // now save it to the output - should loop 0 to
-          // outputIncrement
-
-          output[n*outputIncrement*sizeof(unsigned char)] = (unsigned char)(rgb[0]*255.0);
-          output[n*outputIncrement*sizeof(unsigned char) + 1] = (unsigned char)(rgb[1]*255.0);
-          output[n*outputIncrement*sizeof(unsigned char) + 2] = (unsigned char)(rgb[2]*255.0);
-          if (outputIncrement == VTK_RGBA)
-            {
-            // opacity set to be always 1
-            output[n*outputIncrement*sizeof(unsigned char) + 3] = alpha;
-            }
-          }
-        break;
-      case VTK_FLOAT:
-        vtkDebugMacro(<<"Input data type is float.");
-        for (n = 0; n < numberOfValues; n++)
-          {
-          float *inPtr;
-          inPtr = static_cast<float *>(input);
-          inPtr += n*inputIncrement;
-          val = *inPtr;
-          this->GetColor(val, rgb);
-          if (n < 100) // (n % 10000 == 0)
-            {
-            vtkDebugMacro( << n << ": val = " << val << ", rgb = " << rgb[0] << "," << rgb[1] << "," << rgb[2] << "\noutput array index = " << n*outputIncrement*sizeof(unsigned char));
-            }
-          if (rgb[0] < 0.0 || rgb[0] > 1.0 ||
-              rgb[1] < 0.0 || rgb[1] > 1.0 ||
-              rgb[2] < 0.0 || rgb[2] > 1.0)
-            {
-            // invalid colour values, use 0
-            vtkDebugMacro(<<"Val " << val << " resulted in invalid rgb, out of range 0-1, using 0 0 0 instead of " << rgb[0] << " " << rgb[1] << " " << rgb[2] );
-            rgb[0] = 0.0;
-            rgb[1] = 0.0;
-            rgb[2] = 0.0;
-            }
-          // now save it to the output - should loop 0 to
-          // outputIncrement
+      vtkErrorMacro(<<"MapScalarsThroughTable2: Have no idea how to deal with this input type " << inputDataType);
+      return;
+      }
 
-          output[n*outputIncrement*sizeof(unsigned char)] = (unsigned char)(rgb[0]*255.0);
-          output[n*outputIncrement*sizeof(unsigned char) + 1] = (unsigned char)(rgb[1]*255.0);
-          output[n*outputIncrement*sizeof(unsigned char) + 2] = (unsigned char)(rgb[2]*255.0);
-          if (outputIncrement == VTK_RGBA)
-            {
-            // opacity set to be always 1
-            output[n*outputIncrement*sizeof(unsigned char) + 3] = alpha;
-            }
-          }
-        break;
-      case VTK_INT:
-        vtkDebugMacro(<<"Input data type is int.");
-        for (n = 0; n < numberOfValues; n++)
-          {
-          int *inPtr;
-          inPtr = static_cast<int *>(input);
-          inPtr += n*inputIncrement;
-          val = *inPtr;
-          this->GetColor(val, rgb);
-          if (n < 100) // (n % 10000 == 0)
-            {
-            vtkDebugMacro( << n << ": val = " << val << ", rgb = " << rgb[0] << "," << rgb[1] << "," << rgb[2] << "\noutput array index = " << n*outputIncrement*sizeof(unsigned char));
-            }
-          if (rgb[0] < 0.0 || rgb[0] > 1.0 ||
-              rgb[1] < 0.0 || rgb[1] > 1.0 ||
-              rgb[2] < 0.0 || rgb[2] > 1.0)
-            {
-            // invalid colour values, use 0
-            vtkDebugMacro(<<"Val " << val << " resulted in invalid rgb, out of range 0-1, using 0 0 0 instead of " << rgb[0] << " " << rgb[1] << " " << rgb[2] );
-            rgb[0] = 0.0;
-            rgb[1] = 0.0;
-            rgb[2] = 0.0;
-            }
-          // now save it to the output - should loop 0 to
-          // outputIncrement
+    // Sample the colour functions into the mapping table, only done when a
+    // parameter changed since the last call, so each value is coloured with
+    // a table look up instead of evaluating the functions per value.
+    this->BuildMappingTable();
+    if (!this->MappingTableValid)
+      {
+      vtkErrorMacro(<<"Unknown look up table type " << this->LutType);
+      return;
+      }
 
-          output[n*outputIncrement*sizeof(unsigned char)] = (unsigned char)(rgb[0]*255.0);
-          output[n*outputIncrement*sizeof(unsigned char) + 1] = (unsigned char)(rgb[1]*255.0);
-          output[n*outputIncrement*sizeof(unsigned char) + 2] = (unsigned char)(rgb[2]*255.0);
-          if (outputIncrement == VTK_RGBA)
-            {
-            // opacity set to be always 1
-            output[n*outputIncrement*sizeof(unsigned char) + 3] = alpha;
-            }
-          }
-        break;
-      case VTK_UNSIGNED_CHAR:
-        vtkDebugMacro("Input data type is unsigned char.");
-        unsigned char *ucPtr;
-        unsigned char ucVal;
-        for (n = 0; n < numberOfValues; n++)
-          {
-          ucPtr = static_cast<unsigned char*>(input);
-          ucPtr += n*inputIncrement;
-          ucVal = *ucPtr;
-          const unsigned char *rgb8 = this->MapValue((double)ucVal);
-
-          // now save it to the output - unsigned char return guarantees it's 0-255
-          output[n*outputIncrement*sizeof(unsigned char)] = rgb8[0];
-          output[n*outputIncrement*sizeof(unsigned char) + 1] = rgb8[1];
-          output[n*outputIncrement*sizeof(unsigned char) + 2] = (unsigned char)rgb8[2];
-          if (outputIncrement == VTK_RGBA)
-            {
-            // opacity set to be always 1
-            output[n*outputIncrement*sizeof(unsigned char) + 3] = alpha;
-            }
-          }
-        break;
-      default:
-        vtkErrorMacro(<<"MapScalarsThroughTable2: Have no idea how to deal with this input type " << inputDataType);
+    vtkFSLookupTableMapJob job;
+    job.Input = input;
+    job.Output = output;
+    job.InputDataType = inputDataType;
+    job.NumberOfValues = numberOfValues;
+    job.InputIncrement = inputIncrement;
+    job.OutputIncrement = outputIncrement;
+    job.Table = &this->MappingTable[0];
+    job.TableSize = FSLUTMAPPINGTABLESIZE;
+    job.TableMin = this->MappingTableMin;
+    job.TableScale = this->MappingTableScale;
+
+    // Split the values over the threads; short arrays are not worth the
+    // thread startup overhead and are coloured on the calling thread.
+    int numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
+    const int minimumValuesForThreading = 1 << 18;
+    if (numberOfValues < minimumValuesForThreading)
+      {
+      numberOfThreads = 1;
       }
+    vtkNew<vtkMultiThreader> threader;
+    threader->SetNumberOfThreads(numberOfThreads);
+    threader->SetSingleMethod(vtkFSLookupTableMapCallback, &job);
+    threader->SingleMethodExecute();
 }
 
 //----------------------------------------------------------------------------
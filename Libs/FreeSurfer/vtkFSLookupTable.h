@@ -16,6 +16,9 @@
 // VTK includes
 #include <vtkLookupTable.h>
 
+// STD includes
+#include <vector>
+
 /// \brief A look up table for FreeSurfer colour scales.
 ///
 /// Reimplements vtkLookupTable to provide custom mapping of scalars to colours.
@@ -105,10 +108,29 @@ public:
     // Description:
     // Get the number of available colors for mapping to.
     virtual vtkIdType GetNumberOfAvailableColors() VTK_OVERRIDE;
+    ///
+    /// Number of samples in the precalculated mapping table
+    enum
+    {
+      FSLUTMAPPINGTABLESIZE = 4096,
+    };
+
 protected:
     vtkFSLookupTable();
     ~vtkFSLookupTable();
 
+    ///
+    /// Compute the colour for one scalar value, shared by MapValue and
+    /// BuildMappingTable
+    void ComputeColor(double val, unsigned char rgba[4]);
+
+    ///
+    /// Sample the colour functions into MappingTable so that
+    /// MapScalarsThroughTable2 can colour each scalar with a table look up
+    /// instead of evaluating the functions per value. Only rebuilds the
+    /// table if a mapping parameter changed since the last build.
+    void BuildMappingTable();
+
     ///
     /// Low cut off, values passed in that are below this level are mapped to
     /// low cut off colour
@@ -155,6 +177,29 @@ protected:
     ///
     /// output of colour computation
     unsigned char RGBA[4];
+
+    ///
+    /// colour functions sampled at FSLUTMAPPINGTABLESIZE points (RGBA per
+    /// sample), values outside the sampled range clamp to the end samples,
+    /// which hold the saturated colours
+    std::vector<unsigned char> MappingTable;
+    double MappingTableMin;
+    double MappingTableScale;
+
+    ///
+    /// parameter values the mapping table was built from, used to detect
+    /// when it has to be rebuilt
+    int MappingTableValid;
+    float BuildLowThresh;
+    float BuildHiThresh;
+    int BuildLutType;
+    int BuildReverse;
+    int BuildTruncate;
+    float BuildOffset;
+    float BuildSlope;
+    float BuildBlufact;
+    float BuildFMid;
+    double BuildAlpha;
 };
 
 #endif
@@ -20,11 +20,15 @@
 #include <vtkObjectFactory.h>
 #include <vtkByteSwap.h>
 #include <vtkCellArray.h>
+#include <vtkFloatArray.h>
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
 #include <vtkPolyData.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
 
+// STD includes
+#include <vector>
+
 //-------------------------------------------------------------------------
 vtkStandardNewMacro(vtkFSSurfaceReader);
 
@@ -259,6 +263,78 @@ int vtkFSSurfaceReader::RequestData(
 #endif
   vtkDebugMacro(<<"Got total steps = " << totalSteps);
 
+  // Triangle files store the vertex and face sections as flat runs of
+  // big-endian 4 byte values, so they can be read with one fread per
+  // section and byte swapped in bulk, which is much faster than one
+  // fread and swap per element. Quad files mix 2 and 3 byte integers
+  // and keep the per-element path below.
+  bool bulkTriangleRead =
+    (vtkFSSurfaceReader::FS_TRIANGLE_FILE_MAGIC_NUMBER == magicNumber);
+#if FS_CALC_NORMALS
+  // The bulk path does not fill out the connectivity structures needed
+  // to calculate normals.
+  if (NULL != vertices && NULL != faces) {
+    bulkTriangleRead = false;
+  }
+#endif
+
+  if (bulkTriangleRead) {
+
+    // Read all the vertex locations at once, directly into the array
+    // that will back the output points, and swap them in place.
+    vtkFloatArray *pointData = vtkFloatArray::New();
+    pointData->SetNumberOfComponents (3);
+    pointData->SetNumberOfTuples (numVertices);
+    retval = fread (pointData->GetPointer(0), sizeof(float),
+                    3*numVertices, surfaceFile);
+    if (retval != (size_t)(3*numVertices))
+      {
+      vtkErrorMacro("Error reading vertices: expected " << 3*numVertices
+                    << " floats, got " << retval);
+      pointData->Delete();
+      outputVertices->Delete();
+      outputFaces->Delete();
+      fclose (surfaceFile);
+      return 1;
+      }
+    vtkByteSwap::Swap4BERange (pointData->GetPointer(0), 3*numVertices);
+    outputVertices->SetData (pointData);
+    pointData->Delete();
+    this->UpdateProgress(1.0*numVertices/totalSteps);
+
+    // Read all the face indices at once and swap them in place, then
+    // expand them into the cell array in a single pass.
+    std::vector<int> faceBuffer (3*numFaces);
+    if (numFaces > 0)
+      {
+      retval = fread (&faceBuffer[0], sizeof(int), 3*numFaces, surfaceFile);
+      if (retval != (size_t)(3*numFaces))
+        {
+        vtkErrorMacro("Error reading faces: expected " << 3*numFaces
+                      << " ints, got " << retval);
+        outputVertices->Delete();
+        outputFaces->Delete();
+        fclose (surfaceFile);
+        return 1;
+        }
+      vtkByteSwap::Swap4BERange (&faceBuffer[0], 3*numFaces);
+      }
+    vtkIdType *cellPtr = outputFaces->WritePointer (numFaces, 4*numFaces);
+    for (fIndex = 0; fIndex < numFaces; fIndex++)
+      {
+      cellPtr[0] = 3;
+      cellPtr[1] = faceBuffer[3*fIndex];
+      cellPtr[2] = faceBuffer[3*fIndex + 1];
+      cellPtr[3] = faceBuffer[3*fIndex + 2];
+      cellPtr += 4;
+      if ((fIndex % 65536) == 0)
+        {
+        this->UpdateProgress(1.0*(numVertices + fIndex*numVerticesPerFace)/totalSteps);
+        }
+      }
+
+  } else {
+
   // For each vertex...
   for (vIndex = 0; vIndex < numVertices; vIndex++) {
 
@@ -366,6 +442,8 @@ int vtkFSSurfaceReader::RequestData(
     }
   }
 
+  } // end of the per-element path
+
   // Close the surface file.
   fclose (surfaceFile);
 
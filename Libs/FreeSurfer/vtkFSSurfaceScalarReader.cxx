@@ -138,40 +138,46 @@ int vtkFSSurfaceScalarReader::ReadFSScalars()
   // Make our float array.
   FSscalars = (float*) calloc (numValues, sizeof(float));
 
-  // For each value, if it's a new style file read a float, otherwise
-  // read a two byte int and divide it by 100. Add this value to the
-  // array.
-  for (vIndex = 0; vIndex < numValues; vIndex ++ ) {
+  if (this->FS_NEW_SCALAR_MAGIC_NUMBER == magicNumber) {
 
-    if (feof(scalarFile)) {
-      vtkErrorMacro (<< "vtkFSSurfaceScalarReader.cxx Execute: Unexpected EOF after " << vIndex << " values read.");
+    // New style files are a flat run of big-endian floats, so read them
+    // all with a single fread and swap the whole run in place instead of
+    // one value at a time.
+    size_t retval = fread (FSscalars, sizeof(float), numValues, scalarFile);
+    if (retval != (size_t)numValues)
+      {
+      vtkErrorMacro (<< "vtkFSSurfaceScalarReader.cxx Execute: Unexpected EOF after " << retval << " values read.");
+      free (FSscalars);
+      fclose (scalarFile);
       return 0;
-    }
+      }
+    vtkByteSwap::Swap4BERange (FSscalars, numValues);
+
+  } else {
+
+    // For each value, read a two byte int and divide it by 100. Add this
+    // value to the array.
+    for (vIndex = 0; vIndex < numValues; vIndex ++ ) {
+
+      if (feof(scalarFile)) {
+        vtkErrorMacro (<< "vtkFSSurfaceScalarReader.cxx Execute: Unexpected EOF after " << vIndex << " values read.");
+        free (FSscalars);
+        fclose (scalarFile);
+        return 0;
+      }
 
-    if (this->FS_NEW_SCALAR_MAGIC_NUMBER == magicNumber) {
-      size_t retval = fread (&fvalue, sizeof(float), 1, scalarFile);
-      if (retval == 1)
-        {
-        vtkByteSwap::Swap4BE (&fvalue);
-        }
-      else
-        {
-        vtkErrorMacro("Error reading fvalue from file " << this->FileName);
-        }
-
-    } else {
       vtkFSIO::ReadInt2 (scalarFile, ivalue);
       fvalue = ivalue / 100.0;
-    }
 
-    FSscalars[vIndex] = fvalue;
+      FSscalars[vIndex] = fvalue;
 
-    if (numValues < 10000 ||
-        (vIndex % 100) == 0)
-    {
-        this->UpdateProgress(1.0*vIndex/numValues);
-    }
+      if (numValues < 10000 ||
+          (vIndex % 100) == 0)
+      {
+          this->UpdateProgress(1.0*vIndex/numValues);
+      }
 
+    }
   }
 
   this->SetProgressText("");
@@ -57,6 +57,15 @@ int vtkMRMLColorTableNodeTest1(int argc, char * argv[])
     colorNode->SetColor(2, "two", 0.0, 1.0, 0.0, 1.0);
     colorNode->NamesInitialisedOn();
 
+    // check that the name to index lookup follows color name changes
+    CHECK_INT(colorNode->GetColorIndexByName("one"), 1);
+    CHECK_INT(colorNode->GetColorIndexByName("two"), 2);
+    CHECK_INT(colorNode->GetColorIndexByName("nosuchcolor"), -1);
+    colorNode->SetColorName(2, "three");
+    CHECK_INT(colorNode->GetColorIndexByName("two"), -1);
+    CHECK_INT(colorNode->GetColorIndexByName("three"), 2);
+    colorNode->SetColorName(2, "two");
+
     vtkSmartPointer<vtkMRMLStorageNode> colorStorageNode =
         vtkSmartPointer<vtkMRMLStorageNode>::Take(colorNode->CreateDefaultStorageNode());
 
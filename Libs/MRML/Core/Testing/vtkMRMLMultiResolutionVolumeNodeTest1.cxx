@@ -0,0 +1,178 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH)
+  All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+
+=========================================================================auto=*/
+
+// MRML includes
+#include "vtkMRMLCoreTestingMacros.h"
+#include "vtkMRMLMultiResolutionVolumeNode.h"
+
+// VTK includes
+#include <vtkImageData.h>
+#include <vtkMatrix4x4.h>
+#include <vtkNew.h>
+
+//---------------------------------------------------------------------------
+int ExerciseBasicMethods();
+int TestPyramid();
+int TestFetchBrick();
+
+namespace
+{
+void FillTestImage(vtkImageData* image, int dimX, int dimY, int dimZ);
+}
+
+//---------------------------------------------------------------------------
+int vtkMRMLMultiResolutionVolumeNodeTest1(int , char * [] )
+{
+  CHECK_EXIT_SUCCESS(ExerciseBasicMethods());
+  CHECK_EXIT_SUCCESS(TestPyramid());
+  CHECK_EXIT_SUCCESS(TestFetchBrick());
+  return EXIT_SUCCESS;
+}
+
+namespace
+{
+//---------------------------------------------------------------------------
+void FillTestImage(vtkImageData* image, int dimX, int dimY, int dimZ)
+{
+  image->SetDimensions(dimX, dimY, dimZ);
+  image->AllocateScalars(VTK_UNSIGNED_CHAR, 1);
+  for (int z = 0; z < dimZ; z++)
+    {
+    for (int y = 0; y < dimY; y++)
+      {
+      for (int x = 0; x < dimX; x++)
+        {
+        image->SetScalarComponentFromDouble(x, y, z, 0, (x + y + z) % 256);
+        }
+      }
+    }
+}
+}
+
+//---------------------------------------------------------------------------
+int ExerciseBasicMethods()
+{
+  vtkNew<vtkMRMLMultiResolutionVolumeNode> node1;
+  EXERCISE_ALL_BASIC_MRML_METHODS(node1.GetPointer());
+  return EXIT_SUCCESS;
+}
+
+//---------------------------------------------------------------------------
+int TestPyramid()
+{
+  vtkNew<vtkMRMLMultiResolutionVolumeNode> node1;
+
+  // No image data: no levels are available
+  CHECK_INT(node1->GetNumberOfAvailableLevels(), 0);
+
+  vtkNew<vtkImageData> image;
+  FillTestImage(image.GetPointer(), 16, 16, 8);
+  node1->SetAndObserveImageData(image.GetPointer());
+
+  // Default is 4 levels: 16x16x8, 8x8x4, 4x4x2, 2x2x1
+  CHECK_INT(node1->GetNumberOfAvailableLevels(), 4);
+  CHECK_POINTER(node1->GetLevelImageData(0), image.GetPointer());
+
+  int dims[3] = {0, 0, 0};
+  node1->GetLevelImageData(1)->GetDimensions(dims);
+  CHECK_INT(dims[0], 8);
+  CHECK_INT(dims[1], 8);
+  CHECK_INT(dims[2], 4);
+
+  // Each level doubles the voxel size relative to the previous one
+  vtkNew<vtkMatrix4x4> levelIJKToRAS;
+  node1->GetLevelIJKToRASMatrix(1, levelIJKToRAS.GetPointer());
+  CHECK_DOUBLE(levelIJKToRAS->GetElement(0, 0), 2.0);
+
+  // Level selection by sample distance (node spacing is 1)
+  CHECK_INT(node1->GetLevelForSampleDistance(0.5), 0);
+  CHECK_INT(node1->GetLevelForSampleDistance(2.0), 1);
+  // Large sample distances are capped at the coarsest available level
+  CHECK_INT(node1->GetLevelForSampleDistance(100.0), 3);
+
+  // Out of range level requests fail with an error
+  TESTING_OUTPUT_ASSERT_ERRORS_BEGIN();
+  CHECK_NULL(node1->GetLevelImageData(4));
+  TESTING_OUTPUT_ASSERT_ERRORS_END();
+  TESTING_OUTPUT_ASSERT_ERRORS_BEGIN();
+  CHECK_NULL(node1->GetLevelImageData(-1));
+  TESTING_OUTPUT_ASSERT_ERRORS_END();
+
+  // Changing the requested depth invalidates and rebuilds the pyramid
+  node1->SetNumberOfLevels(2);
+  CHECK_INT(node1->GetNumberOfAvailableLevels(), 2);
+
+  // Removing the image data drops the levels
+  node1->SetAndObserveImageData(NULL);
+  CHECK_INT(node1->GetNumberOfAvailableLevels(), 0);
+
+  return EXIT_SUCCESS;
+}
+
+//---------------------------------------------------------------------------
+int TestFetchBrick()
+{
+  vtkNew<vtkMRMLMultiResolutionVolumeNode> node1;
+  vtkNew<vtkImageData> image;
+  FillTestImage(image.GetPointer(), 16, 16, 8);
+  node1->SetAndObserveImageData(image.GetPointer());
+  node1->SetBrickSize(8);
+
+  int gridDims[3] = {0, 0, 0};
+  CHECK_BOOL(node1->GetBrickGridDimensions(0, gridDims), true);
+  CHECK_INT(gridDims[0], 2);
+  CHECK_INT(gridDims[1], 2);
+  CHECK_INT(gridDims[2], 1);
+
+  // Bricks keep the extents of their position in the level
+  vtkImageData* brick = node1->FetchBrick(0, 1, 1, 0);
+  CHECK_NOT_NULL(brick);
+  int extent[6] = {0, -1, 0, -1, 0, -1};
+  brick->GetExtent(extent);
+  CHECK_INT(extent[0], 8);
+  CHECK_INT(extent[1], 15);
+  CHECK_INT(extent[2], 8);
+  CHECK_INT(extent[3], 15);
+  CHECK_INT(extent[4], 0);
+  CHECK_INT(extent[5], 7);
+  // and carry the voxel values of the full resolution data
+  CHECK_DOUBLE(brick->GetScalarComponentAsDouble(8, 8, 0, 0),
+               image->GetScalarComponentAsDouble(8, 8, 0, 0));
+
+  // Fetched bricks are cached until released
+  CHECK_POINTER(node1->FetchBrick(0, 1, 1, 0), brick);
+  node1->ReleaseBricks();
+  CHECK_NOT_NULL(node1->FetchBrick(0, 1, 1, 0));
+
+  // A brick of a coarser level covers that level's extent
+  CHECK_BOOL(node1->GetBrickGridDimensions(1, gridDims), true);
+  CHECK_INT(gridDims[0], 1);
+  brick = node1->FetchBrick(1, 0, 0, 0);
+  CHECK_NOT_NULL(brick);
+  brick->GetExtent(extent);
+  CHECK_INT(extent[1], 7);
+
+  // Bricks at the high end of an axis may be smaller than the brick size
+  node1->SetBrickSize(10);
+  brick = node1->FetchBrick(0, 1, 0, 0);
+  CHECK_NOT_NULL(brick);
+  brick->GetExtent(extent);
+  CHECK_INT(extent[0], 10);
+  CHECK_INT(extent[1], 15);
+
+  // Out of range brick requests fail with an error
+  TESTING_OUTPUT_ASSERT_ERRORS_BEGIN();
+  CHECK_NULL(node1->FetchBrick(0, 2, 0, 0));
+  TESTING_OUTPUT_ASSERT_ERRORS_END();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,249 @@
+/*==============================================================================
+
+  Program: 3D Slicer
+
+  Copyright (c) Kitware Inc.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+// MRML includes
+#include "vtkMRMLCoreTestingMacros.h"
+#include "vtkMRMLModelNode.h"
+#include "vtkMRMLScalarVolumeNode.h"
+#include "vtkMRMLScene.h"
+
+// VTK includes
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtkPolyData.h>
+#include <vtkSphereSource.h>
+#include <vtkTimerLog.h>
+
+// STD includes
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+//---------------------------------------------------------------------------
+// Synthetic scene generator: the node counts and data sizes are fixed so
+// that runs are reproducible and timings comparable between builds.
+void populateScene(vtkMRMLScene* scene, int numberOfVolumes, int numberOfModels)
+{
+  const int volumeDim = 64;
+  for (int volumeIndex = 0; volumeIndex < numberOfVolumes; ++volumeIndex)
+    {
+    vtkNew<vtkImageData> imageData;
+    imageData->SetDimensions(volumeDim, volumeDim, volumeDim);
+    imageData->AllocateScalars(VTK_SHORT, 1);
+    short* voxels = static_cast<short*>(imageData->GetScalarPointer());
+    long numberOfVoxels = volumeDim * volumeDim * volumeDim;
+    for (long voxel = 0; voxel < numberOfVoxels; ++voxel)
+      {
+      // deterministic pattern, different for each volume
+      voxels[voxel] = static_cast<short>((voxel + volumeIndex) % 1024);
+      }
+    vtkNew<vtkMRMLScalarVolumeNode> volumeNode;
+    std::stringstream nodeName;
+    nodeName << "BenchmarkVolume" << volumeIndex;
+    volumeNode->SetName(nodeName.str().c_str());
+    volumeNode->SetAndObserveImageData(imageData.GetPointer());
+    scene->AddNode(volumeNode.GetPointer());
+    }
+  for (int modelIndex = 0; modelIndex < numberOfModels; ++modelIndex)
+    {
+    vtkNew<vtkSphereSource> sphere;
+    sphere->SetThetaResolution(32);
+    sphere->SetPhiResolution(32);
+    sphere->SetRadius(1.0 + modelIndex);
+    sphere->Update();
+    vtkNew<vtkMRMLModelNode> modelNode;
+    std::stringstream nodeName;
+    nodeName << "BenchmarkModel" << modelIndex;
+    modelNode->SetName(nodeName.str().c_str());
+    modelNode->SetAndObservePolyData(sphere->GetOutput());
+    scene->AddNode(modelNode.GetPointer());
+    }
+}
+
+//---------------------------------------------------------------------------
+// Minimal reader for the JSON this benchmark writes: one "name": value pair
+// per timing, no nesting inside "timings_ms".
+bool readBaseline(const std::string& baselineFilePath,
+                  std::map<std::string, double>& baselineTimingsMs)
+{
+  std::ifstream baselineFile(baselineFilePath.c_str());
+  if (!baselineFile)
+    {
+    return false;
+    }
+  std::string line;
+  while (std::getline(baselineFile, line))
+    {
+    std::string::size_type keyStart = line.find('"');
+    std::string::size_type keyEnd = line.find('"', keyStart + 1);
+    std::string::size_type separator = line.find(':', keyEnd);
+    if (keyStart == std::string::npos || keyEnd == std::string::npos
+        || separator == std::string::npos)
+      {
+      continue;
+      }
+    std::string key = line.substr(keyStart + 1, keyEnd - keyStart - 1);
+    double value = atof(line.substr(separator + 1).c_str());
+    if (value > 0.)
+      {
+      baselineTimingsMs[key] = value;
+      }
+    }
+  return true;
+}
+
+} // end of anonymous namespace
+
+//---------------------------------------------------------------------------
+// Scene-scale performance benchmark.
+//
+// Usage: vtkMRMLScenePerformanceTest [temporaryDirPath] [baseline.json] [thresholdPercent]
+//
+// Builds a reproducible synthetic scene, times the scene-level operations
+// that dominate interactive sessions (bulk node add, scene save, scene
+// import, scene clear) and emits the timings as JSON on stdout and into
+// <temporaryDirPath>/vtkMRMLScenePerformanceTest.json. When a baseline JSON
+// (a previous run's output) is given, the test fails if any timing regressed
+// by more than thresholdPercent (default 50) over the baseline, so CTest can
+// flag performance regressions between releases.
+int vtkMRMLScenePerformanceTest(int argc, char * argv[])
+{
+  std::string temporaryDirPath = ".";
+  if (argc > 1)
+    {
+    temporaryDirPath = argv[1];
+    }
+  std::string baselineFilePath;
+  if (argc > 2)
+    {
+    baselineFilePath = argv[2];
+    }
+  double thresholdPercent = 50.;
+  if (argc > 3)
+    {
+    thresholdPercent = atof(argv[3]);
+    }
+
+  const int numberOfVolumes = 20;
+  const int numberOfModels = 50;
+
+  std::vector<std::pair<std::string, double> > timingsMs;
+  vtkNew<vtkMRMLScene> scene;
+
+  // --- scene build: bulk node add inside a batch process block
+  double startTime = vtkTimerLog::GetUniversalTime();
+  scene->StartState(vtkMRMLScene::BatchProcessState);
+  populateScene(scene.GetPointer(), numberOfVolumes, numberOfModels);
+  scene->EndState(vtkMRMLScene::BatchProcessState);
+  timingsMs.push_back(std::make_pair(
+    "scene-build", (vtkTimerLog::GetUniversalTime() - startTime) * 1000.));
+
+  // --- scene save (XML serialization of all nodes)
+  std::string sceneFilePath = temporaryDirPath + "/vtkMRMLScenePerformanceTest.mrml";
+  scene->SetURL(sceneFilePath.c_str());
+  startTime = vtkTimerLog::GetUniversalTime();
+  if (!scene->Commit())
+    {
+    std::cerr << "Failed to save scene to " << sceneFilePath << std::endl;
+    return EXIT_FAILURE;
+    }
+  timingsMs.push_back(std::make_pair(
+    "scene-save", (vtkTimerLog::GetUniversalTime() - startTime) * 1000.));
+
+  // --- scene import into a populated scene (parse, instantiate, remap IDs)
+  startTime = vtkTimerLog::GetUniversalTime();
+  scene->Import();
+  timingsMs.push_back(std::make_pair(
+    "scene-import", (vtkTimerLog::GetUniversalTime() - startTime) * 1000.));
+
+  // --- scene clear (node removal and reference bookkeeping)
+  startTime = vtkTimerLog::GetUniversalTime();
+  scene->Clear(0);
+  timingsMs.push_back(std::make_pair(
+    "scene-clear", (vtkTimerLog::GetUniversalTime() - startTime) * 1000.));
+
+  // --- emit machine-readable JSON
+  std::stringstream json;
+  json << "{" << std::endl;
+  json << "  \"benchmark\": \"vtkMRMLScenePerformanceTest\"," << std::endl;
+  json << "  \"parameters\": {" << std::endl;
+  json << "    \"numberOfVolumes\": " << numberOfVolumes << "," << std::endl;
+  json << "    \"numberOfModels\": " << numberOfModels << std::endl;
+  json << "  }," << std::endl;
+  json << "  \"timings_ms\": {" << std::endl;
+  for (size_t timingIndex = 0; timingIndex < timingsMs.size(); ++timingIndex)
+    {
+    json << "    \"" << timingsMs[timingIndex].first << "\": "
+         << timingsMs[timingIndex].second
+         << (timingIndex + 1 < timingsMs.size() ? "," : "") << std::endl;
+    }
+  json << "  }" << std::endl;
+  json << "}" << std::endl;
+  std::cout << json.str();
+
+  std::string jsonFilePath = temporaryDirPath + "/vtkMRMLScenePerformanceTest.json";
+  std::ofstream jsonFile(jsonFilePath.c_str());
+  if (jsonFile)
+    {
+    jsonFile << json.str();
+    }
+  else
+    {
+    std::cerr << "Warning: could not write " << jsonFilePath << std::endl;
+    }
+
+  // --- compare against the stored baseline if one was provided
+  if (!baselineFilePath.empty())
+    {
+    std::map<std::string, double> baselineTimingsMs;
+    if (!readBaseline(baselineFilePath, baselineTimingsMs))
+      {
+      std::cerr << "Failed to read baseline file " << baselineFilePath << std::endl;
+      return EXIT_FAILURE;
+      }
+    bool regression = false;
+    for (size_t timingIndex = 0; timingIndex < timingsMs.size(); ++timingIndex)
+      {
+      std::map<std::string, double>::iterator baselineIt =
+        baselineTimingsMs.find(timingsMs[timingIndex].first);
+      if (baselineIt == baselineTimingsMs.end())
+        {
+        continue;
+        }
+      double allowedMs = baselineIt->second * (1. + thresholdPercent / 100.);
+      if (timingsMs[timingIndex].second > allowedMs)
+        {
+        std::cerr << "Performance regression: " << timingsMs[timingIndex].first
+                  << " took " << timingsMs[timingIndex].second << " ms, baseline "
+                  << baselineIt->second << " ms (threshold " << thresholdPercent
+                  << "%)" << std::endl;
+        regression = true;
+        }
+      }
+    if (regression)
+      {
+      return EXIT_FAILURE;
+      }
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -73,6 +73,17 @@ int vtkMRMLTableNodeTest1(int , char * [] )
   CHECK_BOOL(node2->RemoveRow(1), true);
   CHECK_INT(table->GetNumberOfRows(), 3);
 
+  CHECK_INT(node2->AddEmptyRows(5), 3);
+  CHECK_INT(table->GetNumberOfRows(), 8);
+  TESTING_OUTPUT_ASSERT_ERRORS_BEGIN();
+  CHECK_INT(node2->AddEmptyRows(0), -1);
+  TESTING_OUTPUT_ASSERT_ERRORS_END();
+  CHECK_INT(table->GetNumberOfRows(), 8);
+  while (table->GetNumberOfRows() > 3)
+    {
+    CHECK_BOOL(node2->RemoveRow(table->GetNumberOfRows()-1), true);
+    }
+
   // Verify that arrays that are shorter than the table size are extended to match the current table size
 
   vtkSmartPointer< vtkStringArray > newShortArray = vtkSmartPointer< vtkStringArray >::New();
@@ -18,8 +18,11 @@
 
 // VTK includes
 #include <vtkGeneralTransform.h>
+#include <vtkMath.h>
 #include <vtkMatrix4x4.h>
 #include <vtkNew.h>
+#include <vtkPoints.h>
+#include <vtkThinPlateSplineTransform.h>
 #include <vtkTransform.h>
 #include <vtkAddonMathUtilities.h>
 
@@ -177,6 +180,44 @@ int vtkMRMLTransformNodeTest1(int , char * [] )
   CHECK_BOOL(vtkAddonMathUtilities::MatrixAreEqual(c_from_r_mx.GetPointer(), test_mx.GetPointer()), true);
   CHECK_POINTER(rTransform->GetFirstCommonParent(dTransform.GetPointer()), bTransform.GetPointer());
 
+  // Test ComposeLinearComponents: the linear components around a nonlinear
+  // component are composed into single matrices without changing the result
+  vtkNew<vtkPoints> tpsSourceLandmarks;
+  tpsSourceLandmarks->InsertNextPoint(  0.0,   0.0,   0.0);
+  tpsSourceLandmarks->InsertNextPoint(100.0,   0.0,   0.0);
+  tpsSourceLandmarks->InsertNextPoint(  0.0, 100.0,   0.0);
+  tpsSourceLandmarks->InsertNextPoint(  0.0,   0.0, 100.0);
+  vtkNew<vtkPoints> tpsTargetLandmarks;
+  tpsTargetLandmarks->InsertNextPoint(  3.0,  -2.0,   1.0);
+  tpsTargetLandmarks->InsertNextPoint( 95.0,   4.0,  -3.0);
+  tpsTargetLandmarks->InsertNextPoint( -2.0, 103.0,   2.0);
+  tpsTargetLandmarks->InsertNextPoint(  1.0,  -4.0,  97.0);
+  vtkNew<vtkThinPlateSplineTransform> nonlinearComponent;
+  nonlinearComponent->SetBasisToR();
+  nonlinearComponent->SetSourceLandmarks(tpsSourceLandmarks.GetPointer());
+  nonlinearComponent->SetTargetLandmarks(tpsTargetLandmarks.GetPointer());
+  vtkNew<vtkTransform> linearComponent1;
+  linearComponent1->SetMatrix(w_from_b_mx.GetPointer());
+  vtkNew<vtkTransform> linearComponent2;
+  linearComponent2->SetMatrix(b_from_c_mx.GetPointer());
+  vtkNew<vtkTransform> linearComponent3;
+  linearComponent3->SetMatrix(c_from_d_mx.GetPointer());
+  vtkNew<vtkGeneralTransform> chainedTransform;
+  chainedTransform->Concatenate(linearComponent1.GetPointer());
+  chainedTransform->Concatenate(linearComponent2.GetPointer());
+  chainedTransform->Concatenate(nonlinearComponent.GetPointer());
+  chainedTransform->Concatenate(linearComponent3.GetPointer());
+  vtkNew<vtkGeneralTransform> composedTransform;
+  vtkMRMLTransformNode::ComposeLinearComponents(composedTransform.GetPointer(), chainedTransform.GetPointer());
+  // linear1+linear2 are composed into one matrix, nonlinear and linear3 are kept
+  CHECK_INT(composedTransform->GetNumberOfConcatenatedTransforms(), 3);
+  double chainedPoint[3] = {0.0, 0.0, 0.0};
+  double composedPoint[3] = {0.0, 0.0, 0.0};
+  double probePoint[3] = {10.0, -20.0, 30.0};
+  chainedTransform->TransformPoint(probePoint, chainedPoint);
+  composedTransform->TransformPoint(probePoint, composedPoint);
+  CHECK_BOOL(vtkMath::Distance2BetweenPoints(chainedPoint, composedPoint) < 1e-6, true);
+
   std::cout << "vtkMRMLTransformNodeTest1 successfully completed" << std::endl;
   return EXIT_SUCCESS;
 }
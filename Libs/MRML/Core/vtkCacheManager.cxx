@@ -10,6 +10,8 @@
 #include <vtkCallbackCommand.h>
 #include <vtkObjectFactory.h>
 
+#include <algorithm>
+
 vtkStandardNewMacro ( vtkCacheManager );
 
 #define MB 1000000.0
@@ -25,6 +27,8 @@ vtkCacheManager::vtkCacheManager()
   this->RemoteCacheFreeBufferSize = 10;
   this->CurrentCacheSize = 0;
   this->EnableForceRedownload = 0;
+  this->EnableAutomaticCacheEviction = 0;
+  this->CacheSizeUpToDate = 0;
   this->InsufficientFreeBufferNotificationFlag = 0;
   // this->EnableRemoteCacheOverwriting = 1;
   this->uriMap.clear();
@@ -46,6 +50,8 @@ vtkCacheManager::~vtkCacheManager()
   this->CurrentCacheSize = 0;
   this->RemoteCacheFreeBufferSize = 0;
   this->EnableForceRedownload = 0;
+  this->EnableAutomaticCacheEviction = 0;
+  this->CacheSizeUpToDate = 0;
   this->InsufficientFreeBufferNotificationFlag = 0;
 //  this->EnableRemoteCacheOverwriting = 1;
 }
@@ -254,6 +260,7 @@ void vtkCacheManager::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "RemoteCacheFreeBufferSize: " << this->GetRemoteCacheFreeBufferSize() << "\n";
   //os << indent << "EnableRemoteCacheOverwriting: " << this->GetEnableRemoteCacheOverwriting() << "\n";
   os << indent << "EnableForceRedownload: " << this->GetEnableForceRedownload() << "\n";
+  os << indent << "EnableAutomaticCacheEviction: " << this->GetEnableAutomaticCacheEviction() << "\n";
 }
 
 
@@ -508,8 +515,9 @@ const char* vtkCacheManager::GetFilenameFromURI ( const char *uri )
 //----------------------------------------------------------------------------
 void vtkCacheManager::UpdateCacheInformation ( )
 {
-  //--- now recompute cache size
-  // this->CurrentCacheSize = ?;
+  //--- the bookkept cache size is now stale; the next call to
+  //--- GetCurrentCacheSize() recomputes it.
+  this->CacheSizeUpToDate = 0;
 
   //--- recompute free buffer size
   // this->RemoteCacheFreeBufferSize = ?;
@@ -662,8 +670,14 @@ float vtkCacheManager::GetCurrentCacheSize ()
     {
     return (0.0);
     }
-  float size = this->ComputeCacheSize ( this->RemoteCacheDirectory.c_str(), 0 );
-  this->SetCurrentCacheSize ( size );
+  //--- only walk the cache directory when a download, delete or clear
+  //--- made the bookkept size stale; otherwise answer from the last scan.
+  if ( !this->CacheSizeUpToDate )
+    {
+    float size = this->ComputeCacheSize ( this->RemoteCacheDirectory.c_str(), 0 );
+    this->SetCurrentCacheSize ( size );
+    this->CacheSizeUpToDate = 1;
+    }
   return ( this->CurrentCacheSize );
 
 }
@@ -831,9 +845,15 @@ void vtkCacheManager::CacheSizeCheck()
 {
 
   //--- Compute size of the current cache
-  this->ComputeCacheSize(this->RemoteCacheDirectory.c_str(), 0);
+  float size = this->GetCurrentCacheSize();
+  //--- Try to make room before complaining if automatic eviction is on.
+  if ( size > (float) (this->RemoteCacheLimit) && this->EnableAutomaticCacheEviction )
+    {
+    this->EvictLeastRecentlyUsedFiles();
+    size = this->GetCurrentCacheSize();
+    }
   //--- Invoke an event if cache size is exceeded.
-  if ( this->CurrentCacheSize > (float) (this->RemoteCacheLimit) )
+  if ( size > (float) (this->RemoteCacheLimit) )
     {
     // remove the file just downloaded?
      this->InvokeEvent ( vtkCacheManager::CacheLimitExceededEvent );
@@ -844,7 +864,7 @@ void vtkCacheManager::CacheSizeCheck()
 float vtkCacheManager::GetFreeCacheSpaceRemaining()
 {
 
-  float cachesize = this->ComputeCacheSize(this->RemoteCacheDirectory.c_str(), 0);
+  float cachesize = this->GetCurrentCacheSize();
   // cache limit - current cache size = total space left in cache.
   // total space in cache - free buffer size = amount that can be used.
   float diff = ( float (this->RemoteCacheLimit) - cachesize );
@@ -854,6 +874,62 @@ float vtkCacheManager::GetFreeCacheSpaceRemaining()
 }
 
 
+//----------------------------------------------------------------------------
+int vtkCacheManager::EvictLeastRecentlyUsedFiles()
+{
+  if ( !vtksys::SystemTools::FileIsDirectory ( this->RemoteCacheDirectory.c_str() ) )
+    {
+    return 0;
+    }
+
+  //--- Collect the top level cache entries (files and unpacked
+  //--- directories) together with their modification times. The
+  //--- modification time is the closest thing to an access time that
+  //--- is reliably reported across platforms and filesystems.
+  std::vector< std::pair< long int, std::string > > entries;
+  vtksys::Directory dir;
+  dir.Load ( this->RemoteCacheDirectory.c_str() );
+  size_t fileNum;
+  for ( fileNum = 0; fileNum < dir.GetNumberOfFiles(); ++fileNum )
+    {
+    if (strcmp(dir.GetFile(static_cast<unsigned long>(fileNum)),".") &&
+        strcmp(dir.GetFile(static_cast<unsigned long>(fileNum)),".."))
+      {
+      std::string fullName = this->RemoteCacheDirectory;
+      fullName += "/";
+      fullName += dir.GetFile(static_cast<unsigned long>(fileNum));
+      entries.push_back ( std::make_pair (
+        vtksys::SystemTools::ModifiedTime ( fullName.c_str() ), fullName ) );
+      }
+    }
+  //--- oldest first.
+  std::sort ( entries.begin(), entries.end() );
+
+  //--- Delete entries until the cache fits inside the limit with the
+  //--- free buffer left over, or until nothing is left to delete.
+  float targetSize = (float)(this->RemoteCacheLimit) - (float)(this->RemoteCacheFreeBufferSize);
+  if ( targetSize < 0.0 )
+    {
+    targetSize = 0.0;
+    }
+  int numberDeleted = 0;
+  std::vector< std::pair< long int, std::string > >::iterator it;
+  for ( it = entries.begin(); it != entries.end(); it++ )
+    {
+    if ( this->GetCurrentCacheSize() <= targetSize )
+      {
+      break;
+      }
+    //--- DeleteFromCache marks any referencing nodes as modified since
+    //--- read, refreshes the cached file list and bookkept size, and
+    //--- invokes CacheDeleteEvent.
+    this->DeleteFromCache ( it->second.c_str() );
+    numberDeleted++;
+    }
+  return ( numberDeleted );
+}
+
+
 //----------------------------------------------------------------------------
 void vtkCacheManager::FreeCacheBufferCheck()
 {
@@ -114,6 +114,15 @@ class VTK_MRML_EXPORT vtkCacheManager : public vtkObject
   float GetCurrentCacheSize();
   float GetFreeCacheSpaceRemaining();
 
+  ///
+  /// Deletes least recently modified files and directories from the
+  /// cache until its size fits within the RemoteCacheLimit with the
+  /// free buffer left over, oldest first. Any node referencing deleted
+  /// data is marked modified since read. Called by CacheSizeCheck()
+  /// when EnableAutomaticCacheEviction is set; may also be called
+  /// directly. Returns the number of cache entries deleted.
+  int EvictLeastRecentlyUsedFiles();
+
   std::vector< std::string > GetCachedFiles()const;
 
   ///
@@ -124,6 +133,12 @@ class VTK_MRML_EXPORT vtkCacheManager : public vtkObject
   vtkSetMacro ( RemoteCacheFreeBufferSize, int );
   vtkGetMacro ( EnableForceRedownload, int );
   vtkSetMacro ( EnableForceRedownload, int );
+  ///
+  /// When set, CacheSizeCheck() evicts least recently used cache
+  /// entries to make room instead of only invoking
+  /// CacheLimitExceededEvent. Off by default.
+  vtkGetMacro ( EnableAutomaticCacheEviction, int );
+  vtkSetMacro ( EnableAutomaticCacheEviction, int );
   //vtkGetMacro ( EnableRemoteCacheOverwriting, int );
   //vtkSetMacro ( EnableRemoteCacheOverwriting, int );
   void SetMRMLScene ( vtkMRMLScene *scene )
@@ -160,6 +175,11 @@ class VTK_MRML_EXPORT vtkCacheManager : public vtkObject
   float CurrentCacheSize;
   int RemoteCacheFreeBufferSize;
   int EnableForceRedownload;
+  int EnableAutomaticCacheEviction;
+  /// Nonzero while CurrentCacheSize reflects the directory contents;
+  /// cleared whenever files are added to or removed from the cache so
+  /// that GetCurrentCacheSize() only walks the disk when it has to.
+  int CacheSizeUpToDate;
   //int EnableRemoteCacheOverwriting;
   vtkMRMLScene *MRMLScene;
 
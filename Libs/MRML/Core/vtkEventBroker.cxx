@@ -22,6 +22,9 @@
 #include <vtkObjectFactory.h>
 #include <vtkTimerLog.h>
 
+// STD includes
+#include <algorithm>
+
 vtkCxxSetObjectMacro(vtkEventBroker, TimerLog, vtkTimerLog);
 
 //----------------------------------------------------------------------------
@@ -91,8 +94,11 @@ vtkEventBroker* vtkEventBroker::GetInstance()
 vtkEventBroker::vtkEventBroker()
 {
   this->EventMode = vtkEventBroker::Synchronous;
+  this->BatchProcessingCount = 0;
+  this->BatchProcessingEventMode = vtkEventBroker::Synchronous;
   this->EventLogging = 0;
   this->EventNestingLevel = 0;
+  this->EventTimeBudget = 0.0;
   this->TimerLog = vtkTimerLog::New();
   this->CompressCallData = 0;
   this->LogFileName = NULL;
@@ -571,6 +577,84 @@ int vtkEventBroker::GenerateGraphFile ( const char *graphFile )
   return 0;
 }
 
+namespace
+{
+//----------------------------------------------------------------------------
+// sort predicate: most expensive observation first
+bool vtkObservationIsMoreExpensive ( vtkObservation *observation1,
+                                     vtkObservation *observation2 )
+{
+  return observation1->GetTotalElapsedTime() > observation2->GetTotalElapsedTime();
+}
+}
+
+//----------------------------------------------------------------------------
+int vtkEventBroker::GenerateAccountingReportFile ( const char *reportFile )
+{
+  std::ofstream file;
+
+  file.open( reportFile, std::ios::out );
+
+  if ( file.fail() )
+    {
+    vtkErrorMacro( "could not write to " << reportFile );
+    return 1;
+    }
+
+  std::vector<vtkObservation *> observations;
+  int size = this->GetNumberOfObservations();
+  for (int count = 0; count < size; count++)
+    {
+    observations.push_back( this->GetNthObservation( count ) );
+    }
+  std::sort( observations.begin(), observations.end(),
+             vtkObservationIsMoreExpensive );
+
+  file << "# Event broker accounting report"
+       << " - observations ranked by cumulative handler time\n";
+  file << "# total[s]\tcount\tmean[s]\tsubject -> observer [event]\n";
+  std::vector<vtkObservation *>::iterator iter;
+  for (iter = observations.begin(); iter != observations.end(); iter++)
+    {
+    vtkObservation *observation = *iter;
+    int invocations = observation->GetNumberOfInvocations();
+    file << observation->GetTotalElapsedTime()
+         << "\t" << invocations
+         << "\t" << ( invocations > 0 ?
+                      observation->GetTotalElapsedTime() / invocations : 0. )
+         << "\t" << ( observation->GetSubject() ?
+                      observation->GetSubject()->GetClassName() : "(none)" )
+         << " -> ";
+    if ( observation->GetScript() != NULL )
+      {
+      file << "\"" << observation->GetScript() << "\"";
+      }
+    else
+      {
+      file << ( observation->GetObserver() ?
+                observation->GetObserver()->GetClassName() : "(none)" );
+      }
+    file << " [" << vtkCommand::GetStringFromEventId( observation->GetEvent() )
+         << " (" << observation->GetEvent() << ")]\n";
+    }
+
+  file.close();
+  return 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkEventBroker::ResetObservationTimingStatistics ()
+{
+  int size = this->GetNumberOfObservations();
+  for (int count = 0; count < size; count++)
+    {
+    vtkObservation *observation = this->GetNthObservation( count );
+    observation->SetTotalElapsedTime( 0. );
+    observation->SetLastElapsedTime( 0. );
+    observation->SetNumberOfInvocations( 0 );
+    }
+}
+
 //----------------------------------------------------------------------------
 void vtkEventBroker::OpenLogFile ()
 {
@@ -751,6 +835,21 @@ void vtkEventBroker::QueueObservation ( vtkObservation *observation,
   // If the event is not currently in the queue, add it and keep a flag.
   //
   vtkObservation::CallType call(eid, callData);
+
+  // Fast path: bulk operations (scene import, batch processing) queue the
+  // same event with the same call data over and over - typically millions
+  // of ModifiedEvents with null call data. If the incoming call matches the
+  // most recently queued call of this observation, it is already coalesced
+  // and nothing needs to be done; this avoids rescanning the call data list
+  // for every event of an event storm.
+  if ( observation->GetInEventQueue()
+    && !observation->GetCallDataList()->empty()
+    && observation->GetCallDataList()->back().EventID == call.EventID
+    && observation->GetCallDataList()->back().CallData == call.CallData )
+    {
+    return;
+    }
+
   if ( this->GetCompressCallData() &&
        observation->GetEvent() != vtkCommand::AnyEvent)
     {
@@ -841,6 +940,24 @@ void vtkEventBroker::InvokeObservation ( vtkObservation *observation,
   double elapsedTime = this->TimerLog->GetUniversalTime() - startTime;
   observation->SetTotalElapsedTime (observation->GetTotalElapsedTime() + elapsedTime);
   observation->SetLastElapsedTime (elapsedTime);
+  observation->SetNumberOfInvocations (observation->GetNumberOfInvocations() + 1);
+  // flag handler chains that blow the budget - only at the outermost level
+  // so that a slow leaf handler is not reported once per nesting level
+  if ( this->EventTimeBudget > 0. && this->EventNestingLevel == 1
+       && elapsedTime > this->EventTimeBudget )
+    {
+    vtkWarningMacro( "Event handler chain exceeded time budget ("
+                     << elapsedTime << " s > " << this->EventTimeBudget << " s): "
+                     << (observation->GetSubject() ?
+                         observation->GetSubject()->GetClassName() : "(none)")
+                     << " -> "
+                     << (observation->GetScript() ? observation->GetScript() :
+                         (observation->GetObserver() ?
+                          observation->GetObserver()->GetClassName() : "(none)"))
+                     << " on event "
+                     << vtkCommand::GetStringFromEventId( observation->GetEvent() )
+                     << " (" << observation->GetEvent() << ")" );
+    }
   this->LogEvent (observation);
 
   // clear reference to observation (may cause delete)
@@ -848,6 +965,33 @@ void vtkEventBroker::InvokeObservation ( vtkObservation *observation,
   this->EventNestingLevel--;
 }
 
+//----------------------------------------------------------------------------
+void vtkEventBroker::StartBatchProcessing ()
+{
+  if ( this->BatchProcessingCount++ == 0 )
+    {
+    this->BatchProcessingEventMode = this->EventMode;
+    // set the mode directly, SetEventMode() would flush the queue
+    this->EventMode = vtkEventBroker::Asynchronous;
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkEventBroker::EndBatchProcessing ()
+{
+  if ( this->BatchProcessingCount <= 0 )
+    {
+    vtkWarningMacro("EndBatchProcessing: there was no matching StartBatchProcessing");
+    return;
+    }
+  if ( --this->BatchProcessingCount == 0 )
+    {
+    this->EventMode = this->BatchProcessingEventMode;
+    // the sync point: deliver all the coalesced events
+    this->ProcessEventQueue();
+    }
+}
+
 //----------------------------------------------------------------------------
 void vtkEventBroker::ProcessEventQueue ()
 {
@@ -894,6 +1038,7 @@ void vtkEventBroker::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "EventNestingLevel: " << this->EventNestingLevel << "\n";
   os << indent << "LogFileName: " <<
     (this->LogFileName ? this->LogFileName : "(none)") << "\n";
+  os << indent << "EventTimeBudget: " << this->EventTimeBudget << "\n";
 }
 
 //----------------------------------------------------------------------------
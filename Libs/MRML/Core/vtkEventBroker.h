@@ -173,6 +173,31 @@ public:
   /// Write out the current list of observations in graphviz format (.dot)
   int GenerateGraphFile ( const char *graphFile );
 
+  /// Event cost accounting
+  ///
+  /// Every invocation is timed and accumulated on its vtkObservation
+  /// (TotalElapsedTime, NumberOfInvocations) whether or not event logging
+  /// is enabled, so this accounting is always available.
+  ///
+  /// Write out all current observations ranked by cumulative handler time
+  /// (most expensive subject->observer edge first), with invocation counts
+  /// and mean cost per invocation.
+  int GenerateAccountingReportFile ( const char *reportFile );
+
+  ///
+  /// Reset the invocation counts and cumulative times of all current
+  /// observations, e.g. to account only for a specific interaction.
+  void ResetObservationTimingStatistics ();
+
+  ///
+  /// Budget (in seconds) for the handler chain of a single event.
+  /// When > 0, an outermost event invocation that exceeds the budget
+  /// (including the handlers it triggered in cascade) is reported with a
+  /// warning identifying the subject->observer edge. 0 (default) disables
+  /// the check, which otherwise costs one comparison per invocation.
+  vtkSetMacro (EventTimeBudget, double);
+  vtkGetMacro (EventTimeBudget, double);
+
 
   /// Event Queue processing modes
   ///
@@ -196,6 +221,17 @@ public:
 
   void SetEventModeToSynchronous() {this->SetEventMode(vtkEventBroker::Synchronous);};
   void SetEventModeToAsynchronous() {this->SetEventMode(vtkEventBroker::Asynchronous);};
+
+  ///
+  /// Collect events during a bulk operation and deliver them coalesced at
+  /// the end. StartBatchProcessing() switches the broker to asynchronous
+  /// mode so that observations are queued and coalesced instead of invoked
+  /// one by one; EndBatchProcessing() restores the previous event mode and
+  /// flushes the queue (the sync point). Calls may be nested, only the
+  /// outermost EndBatchProcessing() delivers the events.
+  void StartBatchProcessing();
+  void EndBatchProcessing();
+  vtkGetMacro(BatchProcessingCount, int);
   const char * GetEventModeAsString() {
     if (this->EventMode == vtkEventBroker::Synchronous) return ("Synchronous");
     if (this->EventMode == vtkEventBroker::Asynchronous) return ("Asynchronous");
@@ -283,7 +319,11 @@ protected:
   char *LogFileName;
   vtkTimerLog *TimerLog;
 
+  double EventTimeBudget;
+
   int EventMode;
+  int BatchProcessingCount;
+  int BatchProcessingEventMode;
   int CompressCallData;
 
   std::ofstream LogFile;
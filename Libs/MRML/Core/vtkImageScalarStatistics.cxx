@@ -0,0 +1,314 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkImageScalarStatistics.cxx,v $
+  Date:      $Date: 2006/06/14 20:44:13 $
+  Version:   $Revision: 1.1 $
+
+=========================================================================auto=*/
+#include "vtkImageScalarStatistics.h"
+
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkMultiThreader.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+//----------------------------------------------------------------------------
+vtkStandardNewMacro(vtkImageScalarStatistics);
+
+namespace
+{
+
+//----------------------------------------------------------------------------
+struct vtkImageScalarStatisticsJob
+{
+  void *InPtr;
+  int ScalarType;
+  vtkIdType NumberOfTuples;
+  vtkIdType NumberOfBins;
+  double BinOrigin;
+  double BinSpacing;
+  // one partial result per thread, merged serially after the threads join
+  std::vector< std::vector<vtkIdType> > *PartialHistograms;
+  std::vector<double> *PartialMin;
+  std::vector<double> *PartialMax;
+};
+
+//----------------------------------------------------------------------------
+// Accumulate a contiguous range of voxels into the partial histogram of one
+// thread. The loop body only carries the running min/max and one bounds
+// checked bin index, which lets the compiler vectorize the scan for each
+// scalar type.
+template <class T>
+void vtkImageScalarStatisticsAccumulate(vtkImageScalarStatisticsJob *job,
+                                        int threadId,
+                                        vtkIdType firstTuple,
+                                        vtkIdType endTuple)
+{
+  T *inPtr = static_cast<T*>(job->InPtr) + firstTuple;
+  vtkIdType numberOfBins = job->NumberOfBins;
+  double binOrigin = job->BinOrigin;
+  double binInverseSpacing = 1.0 / job->BinSpacing;
+  std::vector<vtkIdType> &histogram = (*job->PartialHistograms)[threadId];
+  double minValue = (*job->PartialMin)[threadId];
+  double maxValue = (*job->PartialMax)[threadId];
+  for (vtkIdType tuple = firstTuple; tuple < endTuple; ++tuple, ++inPtr)
+    {
+    double value = static_cast<double>(*inPtr);
+    minValue = (value < minValue ? value : minValue);
+    maxValue = (value > maxValue ? value : maxValue);
+    vtkIdType bin = static_cast<vtkIdType>((value - binOrigin) * binInverseSpacing);
+    if (bin >= 0 && bin < numberOfBins)
+      {
+      ++histogram[bin];
+      }
+    }
+  (*job->PartialMin)[threadId] = minValue;
+  (*job->PartialMax)[threadId] = maxValue;
+}
+
+//----------------------------------------------------------------------------
+VTK_THREAD_RETURN_TYPE vtkImageScalarStatisticsThreaderCallback(void *arg)
+{
+  vtkMultiThreader::ThreadInfo* info = static_cast<vtkMultiThreader::ThreadInfo*>(arg);
+  vtkImageScalarStatisticsJob* job = static_cast<vtkImageScalarStatisticsJob*>(info->UserData);
+  int threadId = info->ThreadID;
+  int threadCount = info->NumberOfThreads;
+
+  // split the voxels into contiguous ranges, one per thread
+  vtkIdType tuplesPerThread = (job->NumberOfTuples + threadCount - 1) / threadCount;
+  vtkIdType firstTuple = threadId * tuplesPerThread;
+  vtkIdType endTuple = firstTuple + tuplesPerThread;
+  if (endTuple > job->NumberOfTuples)
+    {
+    endTuple = job->NumberOfTuples;
+    }
+  if (firstTuple >= endTuple)
+    {
+    return VTK_THREAD_RETURN_VALUE;
+    }
+
+  switch (job->ScalarType)
+    {
+    vtkTemplateMacro(vtkImageScalarStatisticsAccumulate<VTK_TT>(
+      job, threadId, firstTuple, endTuple));
+    default:
+      // unsupported types are reported by the serial code path
+      break;
+    }
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // end of anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkImageScalarStatistics::vtkImageScalarStatistics()
+{
+  for (int i = 0; i < 6; ++i)
+    {
+    this->ComponentExtent[i] = 0;
+    }
+  this->ComponentExtent[1] = 255;
+  for (int i = 0; i < 3; ++i)
+    {
+    this->ComponentOrigin[i] = 0.0;
+    this->ComponentSpacing[i] = 1.0;
+    }
+  this->Min = 0.0;
+  this->Max = 0.0;
+  this->VoxelCount = 0;
+  this->BinnedVoxelCount = 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkImageScalarStatistics::RequestInformation(
+  vtkInformation * vtkNotUsed(request),
+  vtkInformationVector **vtkNotUsed(inputVector),
+  vtkInformationVector *outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+
+  outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(),
+               this->ComponentExtent, 6);
+  outInfo->Set(vtkDataObject::ORIGIN(), this->ComponentOrigin, 3);
+  outInfo->Set(vtkDataObject::SPACING(), this->ComponentSpacing, 3);
+  vtkDataObject::SetPointDataActiveScalarInfo(outInfo, VTK_ID_TYPE, 1);
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkImageScalarStatistics::RequestUpdateExtent(
+  vtkInformation * vtkNotUsed(request),
+  vtkInformationVector **inputVector,
+  vtkInformationVector *vtkNotUsed(outputVector))
+{
+  // the histogram is global, always scan the whole input
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  int wholeExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), wholeExtent, 6);
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkImageScalarStatistics::ExecuteDataWithInformation(vtkDataObject *output,
+                                                          vtkInformation *outInfo)
+{
+  vtkImageData *inData = vtkImageData::SafeDownCast(this->GetInput());
+  vtkImageData *outData = this->AllocateOutputData(output, outInfo);
+
+  this->Min = 0.0;
+  this->Max = 0.0;
+  this->VoxelCount = 0;
+  this->BinnedVoxelCount = 0;
+
+  if (inData == NULL || inData->GetScalarPointer() == NULL)
+    {
+    vtkErrorMacro("ExecuteData: input image data is null");
+    return;
+    }
+  int c = inData->GetNumberOfScalarComponents();
+  if (c > 1)
+    {
+    vtkErrorMacro("This filter requires 1 scalar component, not " << c);
+    return;
+    }
+
+  vtkIdType numberOfBins = this->ComponentExtent[1] - this->ComponentExtent[0] + 1;
+  if (numberOfBins <= 0 || this->ComponentSpacing[0] == 0.0)
+    {
+    vtkErrorMacro("ExecuteData: invalid bin extent or spacing");
+    return;
+    }
+
+  vtkImageScalarStatisticsJob job;
+  job.InPtr = inData->GetScalarPointer();
+  job.ScalarType = inData->GetScalarType();
+  job.NumberOfTuples = inData->GetNumberOfPoints();
+  job.NumberOfBins = numberOfBins;
+  job.BinOrigin = this->ComponentOrigin[0];
+  job.BinSpacing = this->ComponentSpacing[0];
+
+  // Threading overhead is not worth it for small volumes.
+  const vtkIdType minimumTuplesForThreading = 1 << 20;
+  int numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
+  if (job.NumberOfTuples < minimumTuplesForThreading)
+    {
+    numberOfThreads = 1;
+    }
+
+  std::vector< std::vector<vtkIdType> > partialHistograms(numberOfThreads);
+  for (int thread = 0; thread < numberOfThreads; ++thread)
+    {
+    partialHistograms[thread].resize(numberOfBins, 0);
+    }
+  std::vector<double> partialMin(numberOfThreads, VTK_DOUBLE_MAX);
+  std::vector<double> partialMax(numberOfThreads, VTK_DOUBLE_MIN);
+  job.PartialHistograms = &partialHistograms;
+  job.PartialMin = &partialMin;
+  job.PartialMax = &partialMax;
+
+  if (numberOfThreads > 1)
+    {
+    vtkNew<vtkMultiThreader> threader;
+    threader->SetNumberOfThreads(numberOfThreads);
+    threader->SetSingleMethod(vtkImageScalarStatisticsThreaderCallback, &job);
+    threader->SingleMethodExecute();
+    }
+  else
+    {
+    switch (job.ScalarType)
+      {
+      vtkTemplateMacro(vtkImageScalarStatisticsAccumulate<VTK_TT>(
+        &job, 0, 0, job.NumberOfTuples));
+      default:
+        vtkErrorMacro("ExecuteData: Unsupported ScalarType");
+        return;
+      }
+    }
+
+  // merge the partial histograms into the output image and the cached
+  // prefix-sum source
+  this->BinCounts.assign(numberOfBins, 0);
+  bool haveMinMax = false;
+  for (int thread = 0; thread < numberOfThreads; ++thread)
+    {
+    std::vector<vtkIdType> &histogram = partialHistograms[thread];
+    for (vtkIdType bin = 0; bin < numberOfBins; ++bin)
+      {
+      this->BinCounts[bin] += histogram[bin];
+      }
+    if (partialMin[thread] <= partialMax[thread])
+      {
+      if (!haveMinMax || partialMin[thread] < this->Min)
+        {
+        this->Min = partialMin[thread];
+        }
+      if (!haveMinMax || partialMax[thread] > this->Max)
+        {
+        this->Max = partialMax[thread];
+        }
+      haveMinMax = true;
+      }
+    }
+  this->VoxelCount = job.NumberOfTuples;
+
+  vtkIdType *outPtr = static_cast<vtkIdType*>(outData->GetScalarPointer());
+  for (vtkIdType bin = 0; bin < numberOfBins; ++bin)
+    {
+    outPtr[bin] = this->BinCounts[bin];
+    this->BinnedVoxelCount += this->BinCounts[bin];
+    }
+}
+
+//----------------------------------------------------------------------------
+double vtkImageScalarStatistics::GetPercentile(double fraction)
+{
+  if (this->BinCounts.empty() || this->BinnedVoxelCount == 0)
+    {
+    return 0.0;
+    }
+  if (fraction < 0.0)
+    {
+    fraction = 0.0;
+    }
+  if (fraction > 1.0)
+    {
+    fraction = 1.0;
+    }
+  vtkIdType targetCount =
+    static_cast<vtkIdType>(fraction * static_cast<double>(this->BinnedVoxelCount));
+  vtkIdType cumulativeCount = 0;
+  vtkIdType numberOfBins = static_cast<vtkIdType>(this->BinCounts.size());
+  for (vtkIdType bin = 0; bin < numberOfBins; ++bin)
+    {
+    cumulativeCount += this->BinCounts[bin];
+    if (cumulativeCount >= targetCount)
+      {
+      return this->ComponentOrigin[0] +
+        (this->ComponentExtent[0] + bin + 0.5) * this->ComponentSpacing[0];
+      }
+    }
+  return this->Max;
+}
+
+//----------------------------------------------------------------------------
+void vtkImageScalarStatistics::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os,indent);
+
+  os << indent << "ComponentExtent: " << this->ComponentExtent[0] << "," << this->ComponentExtent[1] << "\n";
+  os << indent << "ComponentOrigin: " << this->ComponentOrigin[0] << "\n";
+  os << indent << "ComponentSpacing: " << this->ComponentSpacing[0] << "\n";
+  os << indent << "Min: " << this->Min << "\n";
+  os << indent << "Max: " << this->Max << "\n";
+  os << indent << "VoxelCount: " << this->VoxelCount << "\n";
+}
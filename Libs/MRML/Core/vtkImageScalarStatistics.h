@@ -0,0 +1,107 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkImageScalarStatistics.h,v $
+  Date:      $Date: 2006/06/14 20:44:13 $
+  Version:   $Revision: 1.1 $
+
+=========================================================================auto=*/
+
+#ifndef __vtkImageScalarStatistics_h
+#define __vtkImageScalarStatistics_h
+
+// MRML includes
+#include "vtkMRML.h"
+
+// VTK includes
+#include <vtkImageAlgorithm.h>
+
+// STD includes
+#include <vector>
+
+/// \brief Parallel min/max/histogram/percentile engine for scalar volumes.
+///
+/// Produces the same one dimensional histogram image as vtkImageAccumulate
+/// for single component inputs (one vtkIdType count per bin, bins described
+/// by ComponentExtent/ComponentOrigin/ComponentSpacing), so the output can
+/// be fed directly to vtkImageBimodalAnalysis. Unlike vtkImageAccumulate the
+/// volume is scanned with one partial histogram per thread and the partial
+/// histograms are merged at the end, and the scalar min/max are recorded in
+/// the same pass so percentiles can be queried from the prefix sum of the
+/// bins without re-scanning the volume.
+class VTK_MRML_EXPORT vtkImageScalarStatistics : public vtkImageAlgorithm
+{
+public:
+  static vtkImageScalarStatistics *New();
+  vtkTypeMacro(vtkImageScalarStatistics,vtkImageAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  ///
+  /// Extent of the histogram bins, only the first dimension is used.
+  /// Same semantics as vtkImageAccumulate: values that fall outside the
+  /// extent are not counted.
+  vtkSetVector6Macro(ComponentExtent, int);
+  vtkGetVector6Macro(ComponentExtent, int);
+
+  ///
+  /// Scalar value of the left edge of the first bin
+  vtkSetVector3Macro(ComponentOrigin, double);
+  vtkGetVector3Macro(ComponentOrigin, double);
+
+  ///
+  /// Width of one bin in scalar units
+  vtkSetVector3Macro(ComponentSpacing, double);
+  vtkGetVector3Macro(ComponentSpacing, double);
+
+  ///
+  /// Smallest and largest scalar value seen in the last update, over all
+  /// voxels including the ones that fall outside the bin extent
+  vtkGetMacro(Min, double);
+  vtkGetMacro(Max, double);
+
+  ///
+  /// Number of voxels scanned in the last update
+  vtkGetMacro(VoxelCount, vtkIdType);
+
+  ///
+  /// Scalar value below which the given fraction (0..1) of the binned
+  /// voxels fall, computed from the prefix sum of the histogram.
+  /// Only valid after the filter has been updated.
+  double GetPercentile(double fraction);
+
+protected:
+  vtkImageScalarStatistics();
+  ~vtkImageScalarStatistics() {};
+
+  virtual int RequestInformation(vtkInformation*,
+                                 vtkInformationVector**,
+                                 vtkInformationVector*) VTK_OVERRIDE;
+  virtual int RequestUpdateExtent(vtkInformation*,
+                                  vtkInformationVector**,
+                                  vtkInformationVector*) VTK_OVERRIDE;
+  virtual void ExecuteDataWithInformation(vtkDataObject *output,
+                                          vtkInformation *outInfo) VTK_OVERRIDE;
+
+  int ComponentExtent[6];
+  double ComponentOrigin[3];
+  double ComponentSpacing[3];
+
+  double Min;
+  double Max;
+  vtkIdType VoxelCount;
+
+  /// Merged histogram kept for GetPercentile()
+  std::vector<vtkIdType> BinCounts;
+  vtkIdType BinnedVoxelCount;
+
+private:
+  vtkImageScalarStatistics(const vtkImageScalarStatistics&);
+  void operator=(const vtkImageScalarStatistics&);
+};
+
+#endif
@@ -42,6 +42,7 @@ vtkMRMLColorNode::vtkMRMLColorNode()
   this->SetNoName("(none)");
 
   this->NamesInitialised = 0;
+  this->ColorNameIndexUpToDate = false;
 }
 
 //----------------------------------------------------------------------------
@@ -149,6 +150,7 @@ void vtkMRMLColorNode::Copy(vtkMRMLNode *anode)
 
   // copy names
   this->Names = node->Names;
+  this->InvalidateColorNameIndex();
 
   this->NamesInitialised = node->NamesInitialised;
 
@@ -270,9 +272,18 @@ void vtkMRMLColorNode::SetType(int type)
 //---------------------------------------------------------------------------
 void vtkMRMLColorNode::SetNamesFromColors()
 {
+  const bool namesWereInitialised = (this->GetNamesInitialised() != 0);
   const int numPoints = this->GetNumberOfColors();
+  // GetNumberOfColors may have triggered a deferred color file read, which
+  // populates the names from the file and sets NamesInitialised. Do not
+  // overwrite the file-provided names with synthesized ones in that case.
+  if (!namesWereInitialised && this->GetNamesInitialised())
+    {
+    return;
+    }
   // reset the names
   this->Names.resize(numPoints);
+  this->InvalidateColorNameIndex();
 
   for (int i = 0; i < numPoints; ++i)
     {
@@ -386,15 +397,43 @@ int vtkMRMLColorNode::GetColorIndexByName(const char *name)
     this->SetNamesFromColors();
     }
 
-  std::string strName = name;
-  for (int i = 0; i < this->GetNumberOfColors(); ++i)
+  if (!this->ColorNameIndexUpToDate)
     {
-    if (strName == this->GetColorName(i))
+    // Rebuild the lookup map in one pass over the table. Only the lowest
+    // index is stored for each name, matching what the former linear
+    // search returned for duplicate names.
+    this->ColorNameIndex.clear();
+    const int numberOfColors = this->GetNumberOfColors();
+    for (int i = 0; i < numberOfColors; ++i)
       {
-      return i;
+      std::string colorName = this->GetColorName(i);
+      if (this->ColorNameIndex.find(colorName) == this->ColorNameIndex.end())
+        {
+        this->ColorNameIndex[colorName] = i;
+        }
       }
+    this->ColorNameIndexUpToDate = true;
+    }
+
+  std::map<std::string, int>::iterator nameIt = this->ColorNameIndex.find(std::string(name));
+  if (nameIt == this->ColorNameIndex.end())
+    {
+    return -1;
+    }
+  return nameIt->second;
+}
+
+//---------------------------------------------------------------------------
+void vtkMRMLColorNode::InvalidateColorNameIndex()
+{
+  if (!this->ColorNameIndexUpToDate)
+    {
+    // already invalid, avoid clearing the map once per color while a
+    // table is being filled
+    return;
     }
-  return -1;
+  this->ColorNameIndexUpToDate = false;
+  this->ColorNameIndex.clear();
 }
 
 //---------------------------------------------------------------------------
@@ -449,6 +488,7 @@ int vtkMRMLColorNode::SetColorName(int ind, const char *name)
   if (this->Names[ind] != newName)
     {
     this->Names[ind] = newName;
+    this->InvalidateColorNameIndex();
     this->StorableModifiedTime.Modified();
     // TBD: fire Modified?
     }
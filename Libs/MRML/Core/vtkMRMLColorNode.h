@@ -23,6 +23,7 @@ class vtkLookupTable;
 class vtkScalarsToColors;
 
 // Std includes
+#include <map>
 #include <string>
 #include <vector>
 
@@ -116,6 +117,10 @@ public:
 
   /// Return the index associated with this color name, which can then be used
   /// to get the colour. Returns -1 on failure.
+  /// Lookups are answered from a name to index map that is built on first
+  /// call and kept until the color names change, so repeated queries do not
+  /// scan the whole table. If multiple colors share the same name then the
+  /// lowest index is returned.
   /// \sa GetColorName()
   int GetColorIndexByName(const char *name);
 
@@ -210,6 +215,12 @@ protected:
   /// Set values in the names vector from the colours in the node
   virtual bool SetNameFromColor(int index);
 
+  /// Drop the name to color index lookup map, it will be rebuilt at the
+  /// next GetColorIndexByName() call. Must be called whenever the \a Names
+  /// vector is modified outside of SetColorName().
+  /// \sa GetColorIndexByName()
+  void InvalidateColorNameIndex();
+
   /// Return true if the color index has a "real" name, otherwise return false
   /// if the name is \a NoName (i.e. "(none)") or automatically generated
   /// (i.e. "R=...G=...B=...").
@@ -235,6 +246,15 @@ protected:
   ///
   /// Have the colour names been set? Used to do lazy copy of the Names array.
   int NamesInitialised;
+
+  ///
+  /// Lookup map from color name to the lowest matching color index, built
+  /// on demand by GetColorIndexByName()
+  std::map<std::string, int> ColorNameIndex;
+
+  ///
+  /// Is the color name lookup map in sync with the Names vector?
+  bool ColorNameIndexUpToDate;
 };
 
 #endif
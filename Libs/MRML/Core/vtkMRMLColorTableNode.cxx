@@ -36,6 +36,38 @@ vtkMRMLColorTableNode::vtkMRMLColorTableNode()
   this->SetDescription("Color Table");
   this->LookupTable = NULL;
   this->LastAddedColor = -1;
+  this->FileReadPending = false;
+}
+
+//----------------------------------------------------------------------------
+vtkLookupTable* vtkMRMLColorTableNode::GetLookupTable()
+{
+  if (this->FileReadPending)
+    {
+    this->ReadFileOnDemand();
+    }
+  return this->LookupTable;
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLColorTableNode::ReadFileOnDemand()
+{
+  // Clear the flag before reading so that the lookup table accesses made
+  // by the storage node while it fills the table do not re-enter this method
+  this->FileReadPending = false;
+  vtkMRMLStorageNode* storageNode = this->GetStorageNode();
+  if (storageNode == NULL)
+    {
+    vtkWarningMacro("ReadFileOnDemand: no storage node is set, the color table remains empty");
+    return;
+    }
+  vtkDebugMacro("ReadFileOnDemand: reading color table file "
+                << (storageNode->GetFileName() ? storageNode->GetFileName() : "(none)"));
+  if (storageNode->ReadData(this) == 0)
+    {
+    vtkErrorMacro("ReadFileOnDemand: unable to read color table file "
+                  << (storageNode->GetFileName() ? storageNode->GetFileName() : "(none)"));
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -622,7 +654,16 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetTableRange(0, 255);
       }
 
-    // delay setting names from colours until asked for one
+    // Drop the names of the previous type; the ramp table branches below do
+    // not rebuild them here. The "R=0.5 G=0.2 B=0.8" style names are
+    // recomputed from the new colors on first use (GetColorName and
+    // GetColorIndexByName initialize names on demand), so the dozens of
+    // default nodes created at startup do not each pay for building
+    // hundreds of name strings nobody asked for.
+    this->Names.clear();
+    this->NamesInitialisedOff();
+    this->InvalidateColorNameIndex();
+
     if (this->Type == this->FullRainbow)
       {
       // from vtkMRMLSliceLayerLogic.cxx
@@ -633,7 +674,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A full rainbow of 256 colors, goes from red to red with all rainbow colors in between. Useful for colourful display of a label map");
       }
     else if (this->Type == this->Grey)
@@ -646,7 +686,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A grey scale ranging from black at 0 to white at 255. Useful for displaying MRI volumes.");
       }
     else if (this->Type == this->Red)
@@ -659,7 +698,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A red scale of 256 values. Useful for layering with Cyan");
       }
     else if (this->Type == this->Green)
@@ -672,7 +710,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A green scale of 256 values, useful for layering with Magenta");
       }
     else if (this->Type == this->Blue)
@@ -685,7 +722,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A blue scale of 256 values from black to pure blue, useful for layering with Yellow");
       }
     else if (this->Type == this->Yellow)
@@ -698,7 +734,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A yellow scale of 256 values, from black to pure yellow, useful for layering with blue (it's complementary, layering yields gray)");
       }
     else if (this->Type == this->Cyan)
@@ -711,7 +746,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A cyan ramp of 256 values, from black to cyan, complementary ramp to red, layering yeilds gray");
       }
     else if (this->Type == this->Magenta)
@@ -724,7 +758,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A magenta scale of 256 colors from black to magenta, complementary ramp to green, layering yeilds gray ");
       }
     else if (this->Type == this->WarmShade1)
@@ -737,7 +770,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from black to red, of 256 colors, ramp of warm colors with variation in value that's complementary to CoolShade1 ");
       }
     else if (this->Type == this->WarmShade2)
@@ -750,7 +782,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from black to yellow, through green, of 256 colors, ramp of warm colors with variation in value that's complementary to CoolShade2 ");
       }
     else if (this->Type == this->WarmShade3)
@@ -763,7 +794,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from black to green, of 256 colours, ramp of warm colors with variation in value that's complementary to CoolShade3 ");
       }
     else if (this->Type == this->CoolShade1)
@@ -776,7 +806,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from black to cyan, 256 colours, ramp of cool colours with variation in value that is complementary to WarmShade1 ");
       }
     else if (this->Type == this->CoolShade2)
@@ -789,7 +818,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from black to blue through purple, 256 colors, ramp of cool colours with variation in value that is complementary to WarmShade2 ");
       }
     else if (this->Type == this->CoolShade3)
@@ -802,7 +830,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(0, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from black to magenta, 256 colours, ramp of cool colours with variation in value that is complementary to WarmShade3");
       }
     else if (this->Type == this->WarmTint1)
@@ -815,7 +842,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from white to red, 256 colours, ramp of warm colours with variation in saturation that's complementary to CoolTint1");
       }
     else if (this->Type == this->WarmTint2)
@@ -828,7 +854,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from white to yellow, 256 colours, ramp of warm colours with variation in saturation that's complementary to CoolTint2");
       }
     else if (this->Type == this->WarmTint3)
@@ -841,7 +866,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from white to green, 256 colours, ramp of warm colours with variation in saturation that's complementary to CoolTint3");
       }
     else if (this->Type == this->CoolTint1)
@@ -854,7 +878,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from white to cyan, 256 colours, ramp of cool colours with variations in saturation that's complementary to WarmTint1");
       }
     else if (this->Type == this->CoolTint2)
@@ -867,7 +890,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from white to blue, 256 colours, ramp of cool colours with variations in saturation that's complementary to WarmTint2");
       }
     else if (this->Type == this->CoolTint3)
@@ -880,7 +902,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from white to magenta, 256 colours, ramp of cool colours with variations in saturation that's complementary to WarmTint3");
       }
     else if (this->Type == this->Warm1)
@@ -893,7 +914,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from yellow to red, of 256 colors, ramp of warm colours that's complementary to Cool1");
       }
     else if (this->Type == this->Warm2)
@@ -906,7 +926,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from green to yellow, 256 colours, ramp of warm colours that's complementary to Cool2");
       }
     else if (this->Type == this->Warm3)
@@ -919,7 +938,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from cyan to green, 256 colours, ramp of warm colours that's complementary to Cool3");
       }
     else if (this->Type == this->Cool1)
@@ -932,7 +950,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from blue to cyan, 256 colours, ramp of cool colours that's complementary to Warm1");
       }
     else if (this->Type == this->Cool2)
@@ -945,7 +962,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from magenta to blue, 256 colours, ramp of cool colours that's complementary to Warm2");
       }
     else if (this->Type == this->Cool3)
@@ -958,7 +974,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetAlphaRange(1, 1); // not used
       this->GetLookupTable()->Build();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from red to magenta, ramp of cool colours that's complementary to Warm3");
       }
     else if (this->Type == this->Iron)
@@ -970,7 +985,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1,1);
       this->GetLookupTable()->SetRampToLinear();
       this->GetLookupTable()->ForceBuild();
-      this->SetNamesFromColors();
       this->SetDescription("A scale from red to  yellow, 157 colours, useful for ");
       }
 
@@ -982,7 +996,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1,1);
       this->GetLookupTable()->SetRampToLinear();
       this->GetLookupTable()->ForceBuild();
-      this->SetNamesFromColors();
       this->SetDescription("Goes from red to purple, passing through the colors of the rainbow in between. Useful for a colorful display of a label map");
       }
 
@@ -994,7 +1007,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1,1);
       this->GetLookupTable()->SetRampToLinear();
       this->GetLookupTable()->ForceBuild();
-      this->SetNamesFromColors();
       this->SetDescription("A lighter blue scale of 256 values, useful for showing registration results.");
       }
     else if (this->Type == this->Desert)
@@ -1005,7 +1017,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1,1);
       this->GetLookupTable()->SetRampToLinear();
       this->GetLookupTable()->ForceBuild();
-      this->SetNamesFromColors();
       this->SetDescription("Red to yellow/orange scale, 256 colours, useful for ");
       }
 
@@ -1017,7 +1028,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1,0);
       this->GetLookupTable()->SetRampToLinear();
       this->GetLookupTable()->ForceBuild();
-      this->SetNamesFromColors();
       this->SetDescription("A white to black scale, 256 colours, useful to highlight negative versions, or to flip intensities of signal values.");
       }
 
@@ -1029,7 +1039,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1,1);
       this->GetLookupTable()->SetRampToLinear();
       this->GetLookupTable()->ForceBuild();
-      this->SetNamesFromColors();
       this->SetDescription("A colourful display option, 256 colours going from purple to red");
       }
 
@@ -1072,7 +1081,6 @@ void vtkMRMLColorTableNode::SetType(int type)
 
       pos->Delete();
       neg->Delete();
-      this->SetNamesFromColors();
       this->SetDescription("A combination of Ocean (0-22) and Desert (23-42), useful for displaying functional MRI volumes (highlights activation)");
       }
 
@@ -1086,7 +1094,6 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetValueRange(1, 1);
       this->GetLookupTable()->SetRampToLinear();
       this->GetLookupTable()->ForceBuild();
-      this->SetNamesFromColors();
       this->SetDescription("A small fMRI positive activation scale going from red to yellow from 0-19, useful for displaying functional MRI volumes when don't need the blue of the fMRI scale.");
       }
 
@@ -1097,6 +1104,7 @@ void vtkMRMLColorTableNode::SetType(int type)
       this->GetLookupTable()->SetTableRange(0,255);
       this->Names.clear();
       this->Names.resize(this->GetLookupTable()->GetNumberOfTableValues());
+      this->InvalidateColorNameIndex();
 
       if (this->SetColorName(0, "Black") != 0)
         {
@@ -1217,7 +1225,6 @@ void vtkMRMLColorTableNode::SetType(int type)
 
         this->GetLookupTable()->SetTableValue(i, r, g, b, 1.0);
         }
-      this->SetNamesFromColors();
       this->SetDescription("A random selection of 256 rgb colours, useful to distinguish between a small number of labeled regions (especially outside of the brain)");
       }
 
@@ -1275,6 +1282,7 @@ void vtkMRMLColorTableNode::SetNumberOfColors(int n)
   if (this->Names.size() != (unsigned int)n)
     {
     this->Names.resize(n);
+    this->InvalidateColorNameIndex();
     }
 
   this->Modified();
@@ -1407,6 +1415,7 @@ bool vtkMRMLColorTableNode::GetColor(int entry, double color[4])
 void vtkMRMLColorTableNode::ClearNames()
 {
   this->Names.clear();
+  this->InvalidateColorNameIndex();
   this->NamesInitialisedOff();
 }
 
@@ -53,8 +53,10 @@ public:
   virtual const char* GetNodeTagName() VTK_OVERRIDE {return "ColorTable";}
 
   /// Access lookup table object that stores table values.
+  /// If reading the table content from the storage node file was deferred
+  /// (\sa GetFileReadPending()), the file is read on the first access.
   /// \sa SetAndObserveLookupTable()
-  vtkGetObjectMacro(LookupTable, vtkLookupTable);
+  virtual vtkLookupTable* GetLookupTable() VTK_OVERRIDE;
 
   /// Set lookup table object that this object will use.
   /// \sa GetLookupTable()
@@ -233,16 +235,36 @@ public:
   /// Create default storage node or NULL if does not have one
   virtual vtkMRMLStorageNode* CreateDefaultStorageNode() VTK_OVERRIDE;
 
+  ///
+  /// Get/Set a flag indicating that the color table content has not been
+  /// read from the storage node file yet. While the flag is set the file
+  /// is loaded by the first access to the lookup table, so the many color
+  /// files registered at application startup are only read when a session
+  /// actually uses them.
+  /// \sa GetLookupTable(), vtkMRMLColorLogic::CreateFileNode()
+  vtkGetMacro(FileReadPending, bool);
+  vtkSetMacro(FileReadPending, bool);
+  vtkBooleanMacro(FileReadPending, bool);
+
 protected:
   vtkMRMLColorTableNode();
   virtual ~vtkMRMLColorTableNode();
   vtkMRMLColorTableNode(const vtkMRMLColorTableNode&);
   void operator=(const vtkMRMLColorTableNode&);
 
+  ///
+  /// Read the color file through the storage node now if reading was
+  /// deferred at node creation time
+  /// \sa FileReadPending
+  void ReadFileOnDemand();
+
   ///
   /// The look up table, constructed according to the Type
   vtkLookupTable *LookupTable;
 
+  ///
+  /// Has reading of the color table file been deferred?
+  bool FileReadPending;
 };
 
 #endif
@@ -132,3 +132,51 @@ void vtkMRMLDiffusionWeightedVolumeDisplayNode::UpdateImageDataPipeline()
   this->ExtractComponent->SetComponents(this->GetDiffusionComponent());
   this->Superclass::UpdateImageDataPipeline();
 }
+
+//----------------------------------------------------------------------------
+void vtkMRMLDiffusionWeightedVolumeDisplayNode::CalculateAutoLevels()
+{
+  if (!this->GetAutoWindowLevel() && !this->GetAutoThreshold())
+    {
+    return;
+    }
+  // Selecting a gradient modifies the component extraction filter, which
+  // rewrites the extracted voxel array, so the array-based cache of the
+  // superclass cannot be reused across gradients. Cache the levels per
+  // diffusion component instead: revisiting a gradient then applies the
+  // stored levels without extracting and scanning the whole
+  // multi-component volume again.
+  vtkImageData* inputImageData = this->GetInputImageData();
+  std::map<int, AutoLevelsCacheEntry>::iterator cacheIt =
+    this->ComponentAutoLevelsCache.find(this->GetDiffusionComponent());
+  if (inputImageData != NULL && cacheIt != this->ComponentAutoLevelsCache.end() &&
+      cacheIt->second.ArrayMTime == inputImageData->GetMTime())
+    {
+    this->IsInCalculateAutoLevels = true;
+    int disabledModify = this->StartModify();
+    if (this->GetAutoWindowLevel())
+      {
+      this->SetWindowLevel(cacheIt->second.Window, cacheIt->second.Level);
+      }
+    if (this->GetAutoThreshold())
+      {
+      this->SetThreshold(cacheIt->second.Lower, cacheIt->second.Upper);
+      }
+    this->EndModify(disabledModify);
+    this->IsInCalculateAutoLevels = false;
+    return;
+    }
+
+  this->Superclass::CalculateAutoLevels();
+
+  if (inputImageData != NULL)
+    {
+    AutoLevelsCacheEntry entry;
+    entry.ArrayMTime = inputImageData->GetMTime();
+    entry.Window = this->GetWindow();
+    entry.Level = this->GetLevel();
+    entry.Lower = this->GetLowerThreshold();
+    entry.Upper = this->GetUpperThreshold();
+    this->ComponentAutoLevelsCache[this->GetDiffusionComponent()] = entry;
+    }
+}
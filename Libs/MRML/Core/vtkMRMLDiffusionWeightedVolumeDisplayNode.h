@@ -85,9 +85,19 @@ protected:
 
   virtual vtkAlgorithmOutput* GetScalarImageDataConnection() VTK_OVERRIDE;
 
+  /// Reimplemented to cache the computed levels per diffusion component.
+  /// Selecting a gradient re-executes the component extraction over the
+  /// whole multi-component volume, so revisited gradients reuse their
+  /// previously computed levels instead of extracting and scanning again.
+  virtual void CalculateAutoLevels() VTK_OVERRIDE;
+
   /// This property holds the current diffusion component used for display.
   int DiffusionComponent;
   vtkImageExtractComponents *ExtractComponent;
+
+  /// Results of CalculateAutoLevels per diffusion component, verified
+  /// against the input image modified time on lookup.
+  std::map<int, AutoLevelsCacheEntry> ComponentAutoLevelsCache;
 };
 
 #endif
@@ -33,6 +33,13 @@ class vtkPolyData;
 ///
 /// vtkMRMLDisplayNode fires a ModifiedEvent event when the texture image data
 /// or the color node is modified.
+///
+/// When several display properties are changed together (for example color,
+/// opacity, and visibility from a script styling many nodes), wrap the
+/// setter calls in StartModify()/EndModify(). The property changes are then
+/// announced by a single ModifiedEvent (forwarded to the views as one
+/// DisplayModifiedEvent), so the displayable managers synchronize the
+/// actors and schedule a render once per batch instead of once per setter.
 /// \sa vtkMRMLDisplayableNode, TextureImageDataConnection, ColorNode
 class VTK_MRML_EXPORT vtkMRMLDisplayNode : public vtkMRMLNode
 {
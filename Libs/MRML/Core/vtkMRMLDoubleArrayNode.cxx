@@ -420,6 +420,26 @@ int vtkMRMLDoubleArrayNode::AddValues(double* values)
 }
 
 
+//----------------------------------------------------------------------------
+int vtkMRMLDoubleArrayNode::AddValues(int numberOfTuples, double* values)
+{
+  if (numberOfTuples <= 0 || values == NULL)
+    {
+    return 0;
+    }
+
+  int nComp = this->Array->GetNumberOfComponents();
+  for (int i = 0; i < numberOfTuples; i ++)
+    {
+    this->Array->InsertNextTuple(values + i * nComp);
+    }
+  // Invoke a single Modified for the whole chunk so that the cost of
+  // observer updates does not grow with the sampling rate.
+  this->Modified();
+  return 1;
+}
+
+
 //----------------------------------------------------------------------------
 int vtkMRMLDoubleArrayNode::AddValue(int component, double value)
 {
@@ -137,6 +137,17 @@ public:
   /// Add values at the end of the array
   int AddValues(double* values);
 
+  ///
+  /// Add multiple sets of values at the end of the array.
+  /// 'values' must contain numberOfTuples * GetNumberOfComponents() entries,
+  /// ordered tuple by tuple. A single Modified is invoked after the whole
+  /// chunk has been appended, so observers (such as chart views, which
+  /// redraw fully on every Modified) see one update per chunk instead of
+  /// one per sample. Use this method to stream high-rate signals into the
+  /// node; for batching several separate modifications, use
+  /// StartModify()/EndModify() instead.
+  int AddValues(int numberOfTuples, double* values);
+
   ///
   /// Add value at the end of the array at the given 'component'
   int AddValue(int component, double value);
@@ -103,6 +103,7 @@ void vtkMRMLFreeSurferProceduralColorNode::ReadXMLAttributes(const char** atts)
       this->LookupTable->SetNumberOfColors(numColors);
       this->Names.clear();
       this->Names.resize(numColors);
+      this->InvalidateColorNameIndex();
       }
     else if (!strcmp(attName, "colors"))
       {
@@ -59,6 +59,15 @@ vtkMRMLModelNode::vtkMRMLModelNode()
   // for backward compatibility, we assume that if no
   // mesh were set, it is a polydata.
   this->MeshType = vtkMRMLModelNode::PolyDataMeshType;
+
+  for (int i = 0; i < 6; i++)
+    {
+    this->RASBoundsCache[i] = 0.;
+    }
+  this->RASBoundsCacheValid = false;
+  this->RASBoundsCacheNodeTime = 0;
+  this->RASBoundsCacheMeshTime = 0;
+  this->RASBoundsCacheTransformTime = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -224,6 +233,18 @@ vtkPointSet *vtkMRMLModelNode::GetMesh()
     producer->GetOutputDataObject(this->MeshConnection->GetIndex()));
 }
 
+//---------------------------------------------------------------------------
+unsigned long vtkMRMLModelNode::GetBulkDataActualMemorySize()
+{
+  // do not go through GetMesh(), it updates the producer pipeline
+  vtkAlgorithm* producer = this->MeshConnection ?
+    this->MeshConnection->GetProducer() : 0;
+  vtkPointSet* mesh = vtkPointSet::SafeDownCast(
+    producer ? producer->GetOutputDataObject(
+      this->MeshConnection->GetIndex()) : 0);
+  return mesh ? mesh->GetActualMemorySize() : 0;
+}
+
 //---------------------------------------------------------------------------
 vtkPolyData* vtkMRMLModelNode::GetPolyData()
 {
@@ -726,9 +747,36 @@ void vtkMRMLModelNode::ApplyTransform(vtkAbstractTransform* transform)
 //---------------------------------------------------------------------------
 void vtkMRMLModelNode::GetRASBounds(double bounds[6])
 {
+  // The displayable managers ask for the bounds on every frame during
+  // interaction, so memoize them: the node MTime covers the parent
+  // transform reference, the mesh MTime covers the geometry and the
+  // transform-to-world MTime covers the whole chain.
+  vtkMTimeType nodeTime = this->GetMTime();
+  vtkMTimeType meshTime = this->GetMesh() ? this->GetMesh()->GetMTime() : 0;
+  vtkMRMLTransformNode* transformNode = this->GetParentTransformNode();
+  vtkMTimeType transformTime = transformNode ? transformNode->GetTransformToWorldMTime() : 0;
+  if (this->RASBoundsCacheValid &&
+      this->RASBoundsCacheNodeTime == nodeTime &&
+      this->RASBoundsCacheMeshTime == meshTime &&
+      this->RASBoundsCacheTransformTime == transformTime)
+    {
+    for (int i = 0; i < 6; i++)
+      {
+      bounds[i] = this->RASBoundsCache[i];
+      }
+    return;
+    }
   double localBounds[6];
   this->GetBounds(localBounds);
   this->TransformBoundsToRAS(localBounds, bounds);
+  for (int i = 0; i < 6; i++)
+    {
+    this->RASBoundsCache[i] = bounds[i];
+    }
+  this->RASBoundsCacheValid = true;
+  this->RASBoundsCacheNodeTime = nodeTime;
+  this->RASBoundsCacheMeshTime = meshTime;
+  this->RASBoundsCacheTransformTime = transformTime;
 }
 
 //---------------------------------------------------------------------------
@@ -110,6 +110,12 @@ public:
   /// \sa GetMeshConnection(), SetUnstructuredGridConnection()
   virtual vtkAlgorithmOutput* GetUnstructuredGridConnection();
 
+  ///
+  /// Size of the mesh (points, cells and attribute arrays) in kibibytes.
+  /// Does not update the mesh pipeline.
+  /// \sa GetMesh()
+  virtual unsigned long GetBulkDataActualMemorySize() VTK_OVERRIDE;
+
   /// Mesh Type hint
   /// \sa GetMeshType()
   typedef enum {
@@ -216,6 +222,9 @@ public:
   /// Get bounding box in global RAS form (xmin,xmax, ymin,ymax, zmin,zmax).
   /// This method returns the bounds of the object with any transforms that may
   /// be applied to it.
+  /// The result is memoized: repeated calls while the node, its mesh and
+  /// its transform chain are unchanged only copy the cached bounds, so the
+  /// method is cheap to call per frame during interaction.
   /// \sa GetBounds()
   virtual void GetRASBounds(double bounds[6]) VTK_OVERRIDE;
 
@@ -283,6 +292,15 @@ protected:
   vtkAlgorithmOutput* MeshConnection;
   vtkEventForwarderCommand* DataEventForwarder;
   MeshTypeHint MeshType;
+
+  /// Memoized world bounds, valid while the node, its mesh and its
+  /// transform chain are unchanged since the recorded times
+  /// \sa GetRASBounds()
+  double RASBoundsCache[6];
+  bool RASBoundsCacheValid;
+  vtkMTimeType RASBoundsCacheNodeTime;
+  vtkMTimeType RASBoundsCacheMeshTime;
+  vtkMTimeType RASBoundsCacheTransformTime;
 };
 
 #endif
@@ -22,11 +22,13 @@
 #include <vtkBYUReader.h>
 #include <vtkCellArray.h>
 #include <vtkDataSetSurfaceFilter.h>
+#include <vtkDecimatePro.h>
 #include <vtkFieldData.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
 #include <vtkOBJReader.h>
 #include <vtkOBJExporter.h>
+#include <vtkPolyData.h>
 #include <vtkPolyDataMapper.h>
 #include <vtkPLYReader.h>
 #include <vtkPLYWriter.h>
@@ -90,6 +92,7 @@ vtkMRMLNodeNewMacro(vtkMRMLModelStorageNode);
 vtkMRMLModelStorageNode::vtkMRMLModelStorageNode()
 {
   this->DefaultWriteFileExtension = "vtk";
+  this->LoadedMeshIsPreview = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -101,6 +104,7 @@ vtkMRMLModelStorageNode::~vtkMRMLModelStorageNode()
 void vtkMRMLModelStorageNode::PrintSelf(ostream& os, vtkIndent indent)
 {
   vtkMRMLStorageNode::PrintSelf(os,indent);
+  os << indent << "LoadedMeshIsPreview: " << this->LoadedMeshIsPreview << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -150,9 +154,17 @@ int vtkMRMLModelStorageNode::ReadDataInternal(vtkMRMLNode *refNode)
   vtkDebugMacro("ReadDataInternal: extension = " << extension.c_str());
 
   int result = 1;
+  this->LoadedMeshIsPreview = 0;
   try
     {
-    if ( extension == std::string(".g") || extension == std::string(".byu") )
+    if (this->GetLazyLoading() && this->ReadPreviewFromCache(modelNode))
+      {
+      // An up to date decimated preview is cached next to the file; display
+      // it immediately. The application can replace it with the full
+      // resolution mesh later by reading again with lazy loading turned off.
+      this->LoadedMeshIsPreview = 1;
+      }
+    else if ( extension == std::string(".g") || extension == std::string(".byu") )
       {
       vtkNew<vtkBYUReader> reader;
       reader->SetGeometryFileName(fullName.c_str());
@@ -303,6 +315,13 @@ int vtkMRMLModelStorageNode::ReadDataInternal(vtkMRMLNode *refNode)
     result = 0;
     }
 
+  if (result != 0 && this->GetLazyLoading() && !this->LoadedMeshIsPreview)
+    {
+    // Refresh the preview cache from the full resolution mesh so that the
+    // next lazy read of this large model can display it quickly.
+    this->WritePreviewToCache(modelNode);
+    }
+
   if (modelNode->GetMesh() != NULL)
     {
     // is there an active scalar array?
@@ -321,6 +340,91 @@ int vtkMRMLModelStorageNode::ReadDataInternal(vtkMRMLNode *refNode)
   return result;
 }
 
+//----------------------------------------------------------------------------
+std::string vtkMRMLModelStorageNode::GetPreviewCacheFileName()
+{
+  std::string fullName = this->GetFullNameFromFileName();
+  if (fullName.empty())
+    {
+    return std::string();
+    }
+  return fullName + std::string(".preview.vtp");
+}
+
+//----------------------------------------------------------------------------
+bool vtkMRMLModelStorageNode::ReadPreviewFromCache(vtkMRMLModelNode *modelNode)
+{
+  std::string previewFileName = this->GetPreviewCacheFileName();
+  if (previewFileName.empty()
+    || vtksys::SystemTools::FileExists(previewFileName.c_str()) == false)
+    {
+    return false;
+    }
+  // a preview that is older than the mesh it was computed from is stale
+  std::string fullName = this->GetFullNameFromFileName();
+  int newer = 0;
+  if (!vtksys::SystemTools::FileTimeCompare(previewFileName.c_str(), fullName.c_str(), &newer)
+    || newer < 0)
+    {
+    return false;
+    }
+  vtkNew<vtkXMLPolyDataReader> reader;
+  reader->SetFileName(previewFileName.c_str());
+  reader->Update();
+  if (reader->GetOutput() == NULL || reader->GetOutput()->GetNumberOfPoints() == 0)
+    {
+    vtkWarningMacro("ReadPreviewFromCache: could not read preview file '"
+      << previewFileName.c_str() << "', falling back to the full resolution mesh");
+    return false;
+    }
+  modelNode->SetPolyDataConnection(reader->GetOutputPort());
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLModelStorageNode::WritePreviewToCache(vtkMRMLModelNode *modelNode)
+{
+  // only meshes that are slow to read and render are worth a preview
+  const vtkIdType minimumCellCountForPreview = 500000;
+  const vtkIdType targetPreviewCellCount = 100000;
+  vtkPolyData *polyData = (modelNode != NULL ? modelNode->GetPolyData() : NULL);
+  if (polyData == NULL || polyData->GetNumberOfCells() < minimumCellCountForPreview)
+    {
+    return;
+    }
+  std::string previewFileName = this->GetPreviewCacheFileName();
+  if (previewFileName.empty())
+    {
+    return;
+    }
+  // skip the decimation if the cache is already up to date
+  std::string fullName = this->GetFullNameFromFileName();
+  int newer = 0;
+  if (vtksys::SystemTools::FileExists(previewFileName.c_str())
+    && vtksys::SystemTools::FileTimeCompare(previewFileName.c_str(), fullName.c_str(), &newer)
+    && newer >= 0)
+    {
+    return;
+    }
+  vtkNew<vtkTriangleFilter> triangleFilter;
+  triangleFilter->SetInputData(polyData);
+  vtkNew<vtkDecimatePro> decimator;
+  decimator->SetInputConnection(triangleFilter->GetOutputPort());
+  decimator->SetTargetReduction(
+    1.0 - double(targetPreviewCellCount) / double(polyData->GetNumberOfCells()));
+  decimator->Update();
+  vtkNew<vtkXMLPolyDataWriter> writer;
+  writer->SetInputConnection(decimator->GetOutputPort());
+  writer->SetFileName(previewFileName.c_str());
+  writer->SetDataModeToBinary();
+  writer->SetCompressorTypeToZLib();
+  if (!writer->Write())
+    {
+    vtkWarningMacro("WritePreviewToCache: could not write preview file '"
+      << previewFileName.c_str() << "'");
+    }
+}
+
 //----------------------------------------------------------------------------
 int vtkMRMLModelStorageNode::WriteDataInternal(vtkMRMLNode *refNode)
 {
@@ -41,6 +41,20 @@ public:
   /// Return true if the reference node can be read in
   virtual bool CanReadInReferenceNode(vtkMRMLNode *refNode) VTK_OVERRIDE;
 
+  ///
+  /// Name of the decimated preview mesh that is cached next to the model
+  /// file when lazy loading is enabled. Returns an empty string if the
+  /// file name is not set.
+  /// \sa vtkMRMLStorageNode::SetLazyLoading()
+  std::string GetPreviewCacheFileName();
+
+  ///
+  /// Nonzero if the last read filled the node with the cached decimated
+  /// preview instead of the full resolution mesh. Reading again with lazy
+  /// loading turned off replaces the preview with the full mesh.
+  /// \sa vtkMRMLStorageNode::SetLazyLoading(), GetPreviewCacheFileName()
+  vtkGetMacro(LoadedMeshIsPreview, int);
+
 protected:
   vtkMRMLModelStorageNode();
   ~vtkMRMLModelStorageNode();
@@ -62,6 +76,18 @@ protected:
   /// Write data from a  referenced node
   virtual int WriteDataInternal(vtkMRMLNode *refNode) VTK_OVERRIDE;
 
+  /// Read the up-to-date decimated preview cache into the node if one
+  /// exists next to the model file. Return true on success.
+  /// \sa GetPreviewCacheFileName()
+  bool ReadPreviewFromCache(vtkMRMLModelNode *modelNode);
+
+  /// Decimate the mesh of the node and cache it next to the model file so
+  /// that the next lazy read can display it quickly. Does nothing for
+  /// small meshes or if the cache is already up to date.
+  /// \sa GetPreviewCacheFileName()
+  void WritePreviewToCache(vtkMRMLModelNode *modelNode);
+
+  int LoadedMeshIsPreview;
 };
 
 #endif
@@ -0,0 +1,342 @@
+/*=auto=========================================================================
+
+Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+See COPYRIGHT.txt
+or http://www.slicer.org/copyright/copyright.txt for details.
+
+Program:   3D Slicer
+Module:    $RCSfile: vtkMRMLMultiResolutionVolumeNode.cxx,v $
+Date:      $Date: 2006/03/17 17:01:53 $
+Version:   $Revision: 1.14 $
+
+=========================================================================auto=*/
+// MRML includes
+#include "vtkMRMLMultiResolutionVolumeNode.h"
+
+// VTK includes
+#include <vtkExtractVOI.h>
+#include <vtkImageData.h>
+#include <vtkImageShrink3D.h>
+#include <vtkMatrix4x4.h>
+#include <vtkNew.h>
+#include <vtkObjectFactory.h>
+
+// STD includes
+#include <cmath>
+#include <sstream>
+
+//----------------------------------------------------------------------------
+vtkMRMLNodeNewMacro(vtkMRMLMultiResolutionVolumeNode);
+
+//----------------------------------------------------------------------------
+vtkMRMLMultiResolutionVolumeNode::vtkMRMLMultiResolutionVolumeNode()
+{
+  this->NumberOfLevels = 4;
+  this->BrickSize = 64;
+  this->PyramidBuildTime = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkMRMLMultiResolutionVolumeNode::~vtkMRMLMultiResolutionVolumeNode()
+{
+  this->InvalidatePyramid();
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLMultiResolutionVolumeNode::WriteXML(ostream& of, int nIndent)
+{
+  Superclass::WriteXML(of, nIndent);
+  of << " numberOfLevels=\"" << this->NumberOfLevels << "\"";
+  of << " brickSize=\"" << this->BrickSize << "\"";
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLMultiResolutionVolumeNode::ReadXMLAttributes(const char** atts)
+{
+  int disabledModify = this->StartModify();
+
+  Superclass::ReadXMLAttributes(atts);
+
+  const char* attName;
+  const char* attValue;
+  while (*atts != NULL)
+    {
+    attName = *(atts++);
+    attValue = *(atts++);
+    if (!strcmp(attName, "numberOfLevels"))
+      {
+      std::stringstream ss;
+      ss << attValue;
+      int val = 0;
+      ss >> val;
+      this->SetNumberOfLevels(val);
+      }
+    else if (!strcmp(attName, "brickSize"))
+      {
+      std::stringstream ss;
+      ss << attValue;
+      int val = 0;
+      ss >> val;
+      this->SetBrickSize(val);
+      }
+    }
+
+  this->EndModify(disabledModify);
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLMultiResolutionVolumeNode::Copy(vtkMRMLNode *anode)
+{
+  Superclass::Copy(anode);
+  vtkMRMLMultiResolutionVolumeNode *node =
+    vtkMRMLMultiResolutionVolumeNode::SafeDownCast(anode);
+  if (node)
+    {
+    this->SetNumberOfLevels(node->GetNumberOfLevels());
+    this->SetBrickSize(node->GetBrickSize());
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLMultiResolutionVolumeNode::PrintSelf(ostream& os, vtkIndent indent)
+{
+  Superclass::PrintSelf(os,indent);
+  os << indent << "NumberOfLevels: " << this->NumberOfLevels << "\n";
+  os << indent << "BrickSize: " << this->BrickSize << "\n";
+  os << indent << "AvailableLevels: " << this->Levels.size() << "\n";
+  os << indent << "CachedBricks: " << this->BrickCache.size() << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLMultiResolutionVolumeNode::SetNumberOfLevels(int numberOfLevels)
+{
+  if (numberOfLevels < 1)
+    {
+    numberOfLevels = 1;
+    }
+  if (numberOfLevels == this->NumberOfLevels)
+    {
+    return;
+    }
+  this->NumberOfLevels = numberOfLevels;
+  this->InvalidatePyramid();
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLMultiResolutionVolumeNode::SetBrickSize(int brickSize)
+{
+  if (brickSize < 1)
+    {
+    brickSize = 1;
+    }
+  if (brickSize == this->BrickSize)
+    {
+    return;
+    }
+  this->BrickSize = brickSize;
+  this->ReleaseBricks();
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLMultiResolutionVolumeNode::InvalidatePyramid()
+{
+  this->Levels.clear();
+  this->BrickCache.clear();
+  this->PyramidBuildTime = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLMultiResolutionVolumeNode::ReleaseBricks()
+{
+  this->BrickCache.clear();
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLMultiResolutionVolumeNode::UpdatePyramid()
+{
+  vtkImageData* imageData = this->GetImageData();
+  if (imageData == NULL)
+    {
+    this->InvalidatePyramid();
+    return;
+    }
+  if (!this->Levels.empty() &&
+      this->Levels[0].GetPointer() == imageData &&
+      this->PyramidBuildTime >= imageData->GetMTime())
+    {
+    // up to date
+    return;
+    }
+
+  this->InvalidatePyramid();
+  this->Levels.push_back(imageData);
+  for (int level = 1; level < this->NumberOfLevels; level++)
+    {
+    vtkImageData* previous = this->Levels[level - 1];
+    int dims[3];
+    previous->GetDimensions(dims);
+    if (dims[0] < 2 && dims[1] < 2 && dims[2] < 2)
+      {
+      // nothing left to downsample, the pyramid stays shallower than
+      // requested
+      break;
+      }
+    vtkNew<vtkImageShrink3D> shrink;
+    shrink->SetInputData(previous);
+    shrink->SetShrinkFactors(dims[0] < 2 ? 1 : 2,
+                             dims[1] < 2 ? 1 : 2,
+                             dims[2] < 2 ? 1 : 2);
+    // average the contributing voxels so coarse levels stay representative
+    shrink->MeanOn();
+    shrink->Update();
+    this->Levels.push_back(shrink->GetOutput());
+    }
+  this->PyramidBuildTime = imageData->GetMTime();
+}
+
+//----------------------------------------------------------------------------
+int vtkMRMLMultiResolutionVolumeNode::GetNumberOfAvailableLevels()
+{
+  this->UpdatePyramid();
+  return static_cast<int>(this->Levels.size());
+}
+
+//----------------------------------------------------------------------------
+vtkImageData* vtkMRMLMultiResolutionVolumeNode::GetLevelImageData(int level)
+{
+  this->UpdatePyramid();
+  if (level < 0 || level >= static_cast<int>(this->Levels.size()))
+    {
+    vtkErrorMacro("GetLevelImageData: level " << level << " is out of range");
+    return NULL;
+    }
+  return this->Levels[level];
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLMultiResolutionVolumeNode::GetLevelIJKToRASMatrix(int level, vtkMatrix4x4* mat)
+{
+  this->GetIJKToRASMatrix(mat);
+  vtkImageData* levelData = this->GetLevelImageData(level);
+  if (levelData == NULL || level == 0)
+    {
+    return;
+    }
+  // the downsampled levels carry their scale and offset relative to the
+  // level 0 index space in their spacing and origin
+  double spacing[3];
+  double origin[3];
+  levelData->GetSpacing(spacing);
+  levelData->GetOrigin(origin);
+  vtkNew<vtkMatrix4x4> levelToIJK;
+  for (int row = 0; row < 3; row++)
+    {
+    levelToIJK->SetElement(row, row, spacing[row]);
+    levelToIJK->SetElement(row, 3, origin[row]);
+    }
+  vtkMatrix4x4::Multiply4x4(mat, levelToIJK.GetPointer(), mat);
+}
+
+//----------------------------------------------------------------------------
+int vtkMRMLMultiResolutionVolumeNode::GetLevelForSampleDistance(double sampleDistance)
+{
+  int numberOfLevels = this->GetNumberOfAvailableLevels();
+  double spacing[3];
+  this->GetSpacing(spacing);
+  double minSpacing = spacing[0];
+  for (int i = 1; i < 3; i++)
+    {
+    if (fabs(spacing[i]) < fabs(minSpacing))
+      {
+      minSpacing = spacing[i];
+      }
+    }
+  minSpacing = fabs(minSpacing);
+  if (minSpacing == 0.0)
+    {
+    return 0;
+    }
+  int level = 0;
+  double levelSpacing = minSpacing;
+  while (level + 1 < numberOfLevels && levelSpacing * 2.0 <= sampleDistance)
+    {
+    levelSpacing *= 2.0;
+    level++;
+    }
+  return level;
+}
+
+//----------------------------------------------------------------------------
+bool vtkMRMLMultiResolutionVolumeNode::GetBrickGridDimensions(int level, int dims[3])
+{
+  vtkImageData* levelData = this->GetLevelImageData(level);
+  if (levelData == NULL)
+    {
+    return false;
+    }
+  int imageDims[3];
+  levelData->GetDimensions(imageDims);
+  for (int i = 0; i < 3; i++)
+    {
+    dims[i] = (imageDims[i] + this->BrickSize - 1) / this->BrickSize;
+    }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkImageData* vtkMRMLMultiResolutionVolumeNode::FetchBrick(int level, int i, int j, int k)
+{
+  vtkImageData* levelData = this->GetLevelImageData(level);
+  if (levelData == NULL)
+    {
+    return NULL;
+    }
+  int gridDims[3];
+  this->GetBrickGridDimensions(level, gridDims);
+  int brick[3] = {i, j, k};
+  for (int axis = 0; axis < 3; axis++)
+    {
+    if (brick[axis] < 0 || brick[axis] >= gridDims[axis])
+      {
+      vtkErrorMacro("FetchBrick: brick (" << i << ", " << j << ", " << k
+                    << ") is out of range at level " << level);
+      return NULL;
+      }
+    }
+
+  // pack level and grid position into one key, the grid of any level of a
+  // volume addressable with int extents fits comfortably in 16 bits per axis
+  long long key = level;
+  key = (key << 16) | i;
+  key = (key << 16) | j;
+  key = (key << 16) | k;
+  std::map< long long, vtkSmartPointer<vtkImageData> >::iterator cacheIt =
+    this->BrickCache.find(key);
+  if (cacheIt != this->BrickCache.end())
+    {
+    return cacheIt->second;
+    }
+
+  int extent[6];
+  levelData->GetExtent(extent);
+  int voi[6];
+  for (int axis = 0; axis < 3; axis++)
+    {
+    voi[2 * axis] = extent[2 * axis] + brick[axis] * this->BrickSize;
+    voi[2 * axis + 1] = voi[2 * axis] + this->BrickSize - 1;
+    if (voi[2 * axis + 1] > extent[2 * axis + 1])
+      {
+      voi[2 * axis + 1] = extent[2 * axis + 1];
+      }
+    }
+  vtkNew<vtkExtractVOI> extractVOI;
+  extractVOI->SetInputData(levelData);
+  extractVOI->SetVOI(voi);
+  extractVOI->Update();
+
+  this->BrickCache[key] = extractVOI->GetOutput();
+  return this->BrickCache[key];
+}
@@ -0,0 +1,151 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkMRMLMultiResolutionVolumeNode.h,v $
+  Date:      $Date: 2006/03/19 17:12:29 $
+  Version:   $Revision: 1.13 $
+
+=========================================================================auto=*/
+
+#ifndef __vtkMRMLMultiResolutionVolumeNode_h
+#define __vtkMRMLMultiResolutionVolumeNode_h
+
+// MRML includes
+#include "vtkMRMLScalarVolumeNode.h"
+
+// VTK includes
+#include <vtkSmartPointer.h>
+
+// STD includes
+#include <map>
+#include <vector>
+
+class vtkMatrix4x4;
+
+/// \brief MRML node for a scalar volume with a multi-resolution brick pyramid.
+///
+/// The node keeps a pyramid of progressively downsampled copies of its image
+/// data (each level halves the resolution of the previous one, level 0 being
+/// the full resolution data) together with a tiled fetch API that hands out
+/// fixed-size bricks of a level on demand. Consumers that only need a portion
+/// of a large volume at a given scale - slice display at a coarse zoom, a
+/// progressive volume rendering pass - can pick a level matching their sample
+/// distance and request just the bricks that intersect the visible region
+/// instead of traversing the full resolution array.
+///
+/// The pyramid is derived data: it is rebuilt lazily from the node's image
+/// data whenever the data changed since the last build, and it is not stored
+/// in the scene file. The levels are held in memory, so this node speeds up
+/// navigation of volumes that are large but loadable; a disk-backed brick
+/// store for volumes that do not fit in memory would additionally need a
+/// dedicated storage node and file format.
+class VTK_MRML_EXPORT vtkMRMLMultiResolutionVolumeNode : public vtkMRMLScalarVolumeNode
+{
+  public:
+  static vtkMRMLMultiResolutionVolumeNode *New();
+  vtkTypeMacro(vtkMRMLMultiResolutionVolumeNode,vtkMRMLScalarVolumeNode);
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  virtual vtkMRMLNode* CreateNodeInstance() VTK_OVERRIDE;
+
+  ///
+  /// Set node attributes
+  virtual void ReadXMLAttributes( const char** atts) VTK_OVERRIDE;
+
+  ///
+  /// Write this node's information to a MRML file in XML format.
+  virtual void WriteXML(ostream& of, int indent) VTK_OVERRIDE;
+
+  ///
+  /// Copy the node's attributes to this object
+  virtual void Copy(vtkMRMLNode *node) VTK_OVERRIDE;
+
+  ///
+  /// Get node XML tag name (like Volume, Model)
+  virtual const char* GetNodeTagName() VTK_OVERRIDE {return "MultiResolutionVolume";}
+
+  ///
+  /// Requested number of pyramid levels, including the full resolution
+  /// level 0. The actual pyramid may be shallower if the volume becomes
+  /// smaller than two voxels along every axis before the requested depth
+  /// is reached. Changing this invalidates the current pyramid.
+  vtkGetMacro(NumberOfLevels, int);
+  void SetNumberOfLevels(int numberOfLevels);
+
+  ///
+  /// Edge length in voxels of the bricks handed out by FetchBrick.
+  /// Changing this discards any cached bricks.
+  vtkGetMacro(BrickSize, int);
+  void SetBrickSize(int brickSize);
+
+  ///
+  /// Number of levels actually available, rebuilding the pyramid first if
+  /// the image data changed since the last build. 0 if there is no image
+  /// data.
+  int GetNumberOfAvailableLevels();
+
+  ///
+  /// Image data of the given level, or NULL if the level is out of range.
+  /// Level 0 is the node's full resolution image data.
+  vtkImageData* GetLevelImageData(int level);
+
+  ///
+  /// IJK to RAS matrix mapping voxel indices of the given level to world
+  /// coordinates. For level 0 this equals GetIJKToRASMatrix.
+  void GetLevelIJKToRASMatrix(int level, vtkMatrix4x4* mat);
+
+  ///
+  /// Coarsest level whose voxel size does not exceed the given sample
+  /// distance, expressed in the node's spacing units. Returns 0 for sample
+  /// distances at or below the full resolution spacing.
+  int GetLevelForSampleDistance(double sampleDistance);
+
+  ///
+  /// Number of bricks along each axis of the given level.
+  /// Returns false if the level is out of range.
+  bool GetBrickGridDimensions(int level, int dims[3]);
+
+  ///
+  /// The brick at grid position (i, j, k) of the given level as a
+  /// standalone image with extents matching its position in the level, or
+  /// NULL if the level or position is out of range. Bricks at the high end
+  /// of an axis may be smaller than BrickSize. Fetched bricks are cached
+  /// until the pyramid is invalidated or ReleaseBricks is called.
+  vtkImageData* FetchBrick(int level, int i, int j, int k);
+
+  ///
+  /// Drop all cached bricks, keeping the pyramid levels.
+  void ReleaseBricks();
+
+protected:
+  vtkMRMLMultiResolutionVolumeNode();
+  ~vtkMRMLMultiResolutionVolumeNode();
+  vtkMRMLMultiResolutionVolumeNode(const vtkMRMLMultiResolutionVolumeNode&);
+  void operator=(const vtkMRMLMultiResolutionVolumeNode&);
+
+  ///
+  /// Rebuild the pyramid from the current image data if it is missing or
+  /// stale. Called by the level and brick accessors.
+  void UpdatePyramid();
+
+  ///
+  /// Discard the pyramid levels and cached bricks.
+  void InvalidatePyramid();
+
+  int NumberOfLevels;
+  int BrickSize;
+
+  /// Levels[0] is the node's own image data, the rest are owned copies.
+  std::vector< vtkSmartPointer<vtkImageData> > Levels;
+  /// Cached bricks keyed by level and grid position packed into one value.
+  std::map< long long, vtkSmartPointer<vtkImageData> > BrickCache;
+  /// Modified time of the image data the pyramid was last built from.
+  vtkMTimeType PyramidBuildTime;
+};
+
+#endif
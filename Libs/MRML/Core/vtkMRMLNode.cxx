@@ -456,6 +456,41 @@ void vtkMRMLNode::ParseReferencesAttribute(const char *attValue,
 }
 
 
+//----------------------------------------------------------------------------
+// Stream inString into of, encoding the XML special characters (and for
+// attribute values also the percent sign and the semicolon, which separates
+// attributes) on the fly. Equivalent to percent encoding the value and
+// passing it through XMLAttributeEncodeString, but writes straight into the
+// stream without allocating temporary strings, which dominated scene save
+// time on scenes with many attributes.
+static void vtkMRMLNodeWriteXMLEncodedString(ostream& of, const std::string& inString,
+                                             bool isAttributeValue)
+{
+  const char* specialChars = isAttributeValue ? "%;&\"'<>" : "&\"'<>";
+  std::string::size_type start = 0;
+  while (start < inString.length())
+    {
+    std::string::size_type pos = inString.find_first_of(specialChars, start);
+    if (pos == std::string::npos)
+      {
+      of.write(inString.c_str() + start, inString.length() - start);
+      break;
+      }
+    of.write(inString.c_str() + start, pos - start);
+    switch (inString[pos])
+      {
+      case '%': of << "%25"; break;
+      case ';': of << "%3B"; break;
+      case '&': of << "&amp;"; break;
+      case '"': of << "&quot;"; break;
+      case '\'': of << "&apos;"; break;
+      case '<': of << "&lt;"; break;
+      case '>': of << "&gt;"; break;
+      }
+    start = pos + 1;
+    }
+}
+
 //----------------------------------------------------------------------------
 void vtkMRMLNode::WriteXML(ostream& of, int nIndent)
 {
@@ -483,11 +518,9 @@ void vtkMRMLNode::WriteXML(ostream& of, int nIndent)
         {
         of << ';';
         }
-      std::string attributeValue = it->second;
-      // encode percent sign and semicolon (semicolon is a special character because it separates attributes)
-      vtksys::SystemTools::ReplaceString(attributeValue, "%", "%25");
-      vtksys::SystemTools::ReplaceString(attributeValue, ";", "%3B");
-      of << this->XMLAttributeEncodeString(it->first) << ':' << this->XMLAttributeEncodeString(attributeValue);
+      vtkMRMLNodeWriteXMLEncodedString(of, it->first, false);
+      of << ':';
+      vtkMRMLNodeWriteXMLEncodedString(of, it->second, true);
       }
     of << "\"";
     }
@@ -757,7 +790,10 @@ void vtkMRMLNode::UpdateReferenceID(const char *oldID, const char *newID)
         vtkErrorMacro(<< "UpdateReferenceID: Reference " << i << " is expected to be non NULL.");
         continue;
         }
-      if (std::string(oldID) == std::string(reference->GetReferencedNodeID()))
+      // strcmp instead of constructing two std::strings per comparison,
+      // this runs once per reference for every ID change on scene import
+      if (reference->GetReferencedNodeID() &&
+          strcmp(oldID, reference->GetReferencedNodeID()) == 0)
         {
         this->SetAndObserveNthNodeReferenceID(reference->GetReferenceRole(), i, newID, reference->GetEvents());
         }
@@ -780,23 +816,57 @@ void vtkMRMLNode::SetAttribute(const char* name, const char* value)
     vtkErrorMacro(<< "SetAttribute: Name parameter is expected to have at least one character.");
     return;
     }
-  const char* oldValue = this->GetAttribute(name);
-  if ((!oldValue && !value) ||
-      (oldValue && value && !strcmp(oldValue, value)))
-    {
-    return;
-    }
   if (value != 0)
     {
-    this->Attributes[std::string(name)] = std::string(value);
+    // a single insert instead of a look up of the old value followed by an
+    // assignment, attributes are set in bulk when reading a scene
+    std::pair<AttributesType::iterator, bool> inserted =
+      this->Attributes.insert(std::make_pair(std::string(name), std::string(value)));
+    if (!inserted.second)
+      {
+      if (inserted.first->second.compare(value) == 0)
+        {
+        // no change
+        return;
+        }
+      inserted.first->second = value;
+      }
     }
   else
     {
-    this->Attributes.erase(std::string(name));
+    if (this->Attributes.erase(std::string(name)) == 0)
+      {
+      // no change
+      return;
+      }
     }
   this->Modified();
 }
 
+//----------------------------------------------------------------------------
+void vtkMRMLNode::SetAttributes(vtkStringArray* names, vtkStringArray* values)
+{
+  if (!names || !values)
+    {
+    vtkErrorMacro(<< "SetAttributes: Name and value arrays are expected to be non NULL.");
+    return;
+    }
+  if (names->GetNumberOfValues() != values->GetNumberOfValues())
+    {
+    vtkErrorMacro(<< "SetAttributes: Name and value arrays are expected to contain"
+      " the same number of values.");
+    return;
+    }
+  int wasModifying = this->StartModify();
+  vtkIdType numberOfAttributes = names->GetNumberOfValues();
+  for (vtkIdType attributeIndex = 0; attributeIndex < numberOfAttributes; ++attributeIndex)
+    {
+    this->SetAttribute(names->GetValue(attributeIndex).c_str(),
+                       values->GetValue(attributeIndex).c_str());
+    }
+  this->EndModify(wasModifying);
+}
+
 //----------------------------------------------------------------------------
 void vtkMRMLNode::RemoveAttribute(const char* name)
 {
@@ -1008,6 +1078,11 @@ const char * vtkMRMLNode::URLDecodeString(const char *inString)
 //----------------------------------------------------------------------------
 std::string vtkMRMLNode::XMLAttributeEncodeString(const std::string& inString)
 {
+  if (inString.find_first_of("&\"'<>") == std::string::npos)
+    {
+    // most strings contain nothing to encode, skip the replacement passes
+    return inString;
+    }
   std::string outString = inString;
   vtksys::SystemTools::ReplaceString(outString, "&", "&amp;");
   vtksys::SystemTools::ReplaceString(outString, "\"", "&quot;");
@@ -246,6 +246,21 @@ public:
   /// \sa SetSingletonTag()
   virtual void Reset(vtkMRMLNode* defaultNode);
 
+  /// \brief Size of the bulk data owned by this node, in kibibytes.
+  ///
+  /// Nodes holding bulk data (image scalars, mesh arrays, segmentation
+  /// labelmaps, ...) override this to report its current size, so that
+  /// memory usage of a session can be attributed to nodes. Nodes holding
+  /// only attributes report 0. The returned size follows
+  /// vtkDataObject::GetActualMemorySize() conventions.
+  ///
+  /// \sa vtkMRMLScene::GetBulkDataActualMemorySize()
+  /// \sa vtkMRMLScene::GenerateBulkDataMemoryReportFile()
+  virtual unsigned long GetBulkDataActualMemorySize()
+    {
+    return 0;
+    };
+
   /// \brief Start modifying the node. Disable Modify events.
   ///
   /// Returns the previous state of \a DisableModifiedEvent flag
@@ -295,6 +310,16 @@ public:
   /// \sa WriteXML()
   void SetAttribute(const char* name, const char* value);
 
+  /// \brief Set multiple name value pair attributes in a single call.
+  ///
+  /// The i-th name is set to the i-th value; the two arrays must contain
+  /// the same number of values. The per-attribute modifications are
+  /// compressed into a single vtkCommand::ModifiedEvent (\sa StartModify,
+  /// \sa EndModify), so observers process one update for the whole batch.
+  ///
+  /// \sa SetAttribute()
+  void SetAttributes(vtkStringArray* names, vtkStringArray* values);
+
   /// Remove attribute with the specified name.
   void RemoveAttribute(const char* name);
 
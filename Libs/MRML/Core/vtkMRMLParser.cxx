@@ -95,12 +95,17 @@ void vtkMRMLParser::StartElement(const char* tagName, const char** atts)
     // children items named SubjectHierarchyItem.
     // Another possibility is that it's part of a scene view, in which case we need to access the
     // last node in the scene view's snapshot scene
+    // When no separate node collection is set, the nodes are added to the
+    // scene directly (streaming import), so the last loaded node is the last
+    // node of the scene.
+    vtkCollection* loadedNodes =
+      this->NodeCollection ? this->NodeCollection : this->MRMLScene->GetNodes();
     vtkMRMLSubjectHierarchyNode* subjectHierarchyNode = vtkMRMLSubjectHierarchyNode::SafeDownCast(
-      this->NodeCollection->GetItemAsObject(this->NodeCollection->GetNumberOfItems()-1) );
+      loadedNodes->GetItemAsObject(loadedNodes->GetNumberOfItems()-1) );
     if (!subjectHierarchyNode)
       {
       vtkMRMLSceneViewNode* sceneViewNode = vtkMRMLSceneViewNode::SafeDownCast(
-        this->NodeCollection->GetItemAsObject(this->NodeCollection->GetNumberOfItems()-1) );
+        loadedNodes->GetItemAsObject(loadedNodes->GetNumberOfItems()-1) );
       if (!sceneViewNode)
         {
         vtkWarningMacro("Invalid parent node element for SubjectHierarchyItem");
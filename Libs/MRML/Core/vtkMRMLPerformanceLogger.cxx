@@ -0,0 +1,251 @@
+/*==============================================================================
+
+  Program: 3D Slicer
+
+  Copyright (c) Kitware Inc.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+// MRML includes
+#include "vtkMRMLPerformanceLogger.h"
+
+// VTK includes
+#include <vtkObjectFactory.h>
+#include <vtkTimerLog.h>
+
+// STD includes
+#include <cstring>
+#include <fstream>
+
+//----------------------------------------------------------------------------
+// The performance logger singleton.
+// This MUST be default initialized to zero by the compiler and is
+// therefore not initialized here.  The ClassInitialize and
+// ClassFinalize methods handle this instance.
+static vtkMRMLPerformanceLogger* vtkMRMLPerformanceLoggerInstance;
+
+//----------------------------------------------------------------------------
+// Must NOT be initialized.  Default initialization to zero is necessary.
+unsigned int vtkMRMLPerformanceLoggerInitialize::Count;
+
+//----------------------------------------------------------------------------
+// Implementation of vtkMRMLPerformanceLoggerInitialize class.
+//----------------------------------------------------------------------------
+vtkMRMLPerformanceLoggerInitialize::vtkMRMLPerformanceLoggerInitialize()
+{
+  if(++Self::Count == 1)
+    {
+    vtkMRMLPerformanceLogger::classInitialize();
+    }
+}
+
+//----------------------------------------------------------------------------
+vtkMRMLPerformanceLoggerInitialize::~vtkMRMLPerformanceLoggerInitialize()
+{
+  if(--Self::Count == 0)
+    {
+    vtkMRMLPerformanceLogger::classFinalize();
+    }
+}
+
+//----------------------------------------------------------------------------
+// Up the reference count so it behaves like New
+vtkMRMLPerformanceLogger* vtkMRMLPerformanceLogger::New()
+{
+  vtkMRMLPerformanceLogger* ret = vtkMRMLPerformanceLogger::GetInstance();
+  ret->Register(NULL);
+  return ret;
+}
+
+//----------------------------------------------------------------------------
+// Return the single instance of the vtkMRMLPerformanceLogger
+vtkMRMLPerformanceLogger* vtkMRMLPerformanceLogger::GetInstance()
+{
+  if(!vtkMRMLPerformanceLoggerInstance)
+    {
+    // Try the factory first
+    vtkMRMLPerformanceLoggerInstance = (vtkMRMLPerformanceLogger*)
+      vtkObjectFactory::CreateInstance("vtkMRMLPerformanceLogger");
+    // if the factory did not provide one, then create it here
+    if(!vtkMRMLPerformanceLoggerInstance)
+      {
+      vtkMRMLPerformanceLoggerInstance = new vtkMRMLPerformanceLogger;
+#ifdef VTK_HAS_INITIALIZE_OBJECT_BASE
+      vtkMRMLPerformanceLoggerInstance->InitializeObjectBase();
+#endif
+      }
+    }
+  // return the instance
+  return vtkMRMLPerformanceLoggerInstance;
+}
+
+//----------------------------------------------------------------------------
+vtkMRMLPerformanceLogger::vtkMRMLPerformanceLogger()
+{
+  this->Events.resize(Capacity);
+  this->NextEventIndex = 0;
+  this->TotalNumberOfEvents = 0;
+  this->RecordingEnabled = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkMRMLPerformanceLogger::~vtkMRMLPerformanceLogger()
+{
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLPerformanceLogger::LogEvent(const char* name,
+                                        double startTime, double endTime)
+{
+  if (!this->RecordingEnabled || name == NULL)
+    {
+    return;
+    }
+  TimedEvent& event = this->Events[this->NextEventIndex];
+  strncpy(event.Name, name, EventNameLength - 1);
+  event.Name[EventNameLength - 1] = '\0';
+  event.StartTime = startTime;
+  event.EndTime = endTime;
+  this->NextEventIndex = (this->NextEventIndex + 1) % Capacity;
+  ++this->TotalNumberOfEvents;
+  // no Modified(): recording must not trigger observers on the hot path
+}
+
+//----------------------------------------------------------------------------
+int vtkMRMLPerformanceLogger::GetNumberOfEvents()
+{
+  return this->TotalNumberOfEvents < Capacity ?
+    this->TotalNumberOfEvents : static_cast<int>(Capacity);
+}
+
+//----------------------------------------------------------------------------
+int vtkMRMLPerformanceLogger::GetBufferIndex(int n)
+{
+  if (n < 0 || n >= this->GetNumberOfEvents())
+    {
+    return -1;
+    }
+  if (this->TotalNumberOfEvents < Capacity)
+    {
+    return n;
+    }
+  // buffer has wrapped: the oldest event is at NextEventIndex
+  return (this->NextEventIndex + n) % Capacity;
+}
+
+//----------------------------------------------------------------------------
+const char* vtkMRMLPerformanceLogger::GetNthEventName(int n)
+{
+  int bufferIndex = this->GetBufferIndex(n);
+  return bufferIndex < 0 ? NULL : this->Events[bufferIndex].Name;
+}
+
+//----------------------------------------------------------------------------
+double vtkMRMLPerformanceLogger::GetNthEventStartTime(int n)
+{
+  int bufferIndex = this->GetBufferIndex(n);
+  return bufferIndex < 0 ? 0. : this->Events[bufferIndex].StartTime;
+}
+
+//----------------------------------------------------------------------------
+double vtkMRMLPerformanceLogger::GetNthEventDuration(int n)
+{
+  int bufferIndex = this->GetBufferIndex(n);
+  return bufferIndex < 0 ? 0. :
+    this->Events[bufferIndex].EndTime - this->Events[bufferIndex].StartTime;
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLPerformanceLogger::Clear()
+{
+  this->NextEventIndex = 0;
+  this->TotalNumberOfEvents = 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkMRMLPerformanceLogger::WriteChromeTraceFile(const char* filename)
+{
+  if (filename == NULL)
+    {
+    vtkErrorMacro("WriteChromeTraceFile: filename is not set");
+    return 0;
+    }
+  std::ofstream traceFile(filename);
+  if (!traceFile)
+    {
+    vtkErrorMacro("WriteChromeTraceFile: could not open " << filename
+                  << " for writing");
+    return 0;
+    }
+  // Chrome trace-event format: complete ("X") events with microsecond
+  // timestamps, see
+  // https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+  traceFile << "{ \"traceEvents\": [" << std::endl;
+  int numberOfEvents = this->GetNumberOfEvents();
+  for (int n = 0; n < numberOfEvents; ++n)
+    {
+    int bufferIndex = this->GetBufferIndex(n);
+    const TimedEvent& event = this->Events[bufferIndex];
+    traceFile << "  { \"name\": \"" << event.Name << "\""
+              << ", \"ph\": \"X\""
+              << ", \"pid\": 1, \"tid\": 1"
+              << ", \"ts\": " << static_cast<long long>(event.StartTime * 1.e6)
+              << ", \"dur\": "
+              << static_cast<long long>((event.EndTime - event.StartTime) * 1.e6)
+              << " }" << (n + 1 < numberOfEvents ? "," : "") << std::endl;
+    }
+  traceFile << "] }" << std::endl;
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLPerformanceLogger::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "RecordingEnabled: " << this->RecordingEnabled << "\n";
+  os << indent << "NumberOfEvents: " << this->GetNumberOfEvents() << "\n";
+  os << indent << "TotalNumberOfEvents: " << this->TotalNumberOfEvents << "\n";
+}
+
+//----------------------------------------------------------------------------
+// Implementation of vtkMRMLScopedPerformanceTimer class.
+//----------------------------------------------------------------------------
+vtkMRMLScopedPerformanceTimer::vtkMRMLScopedPerformanceTimer(const char* name)
+{
+  this->Name = name;
+  this->Active = vtkMRMLPerformanceLogger::GetInstance()->GetRecordingEnabled();
+  this->StartTime = this->Active ? vtkTimerLog::GetUniversalTime() : 0.;
+}
+
+//----------------------------------------------------------------------------
+vtkMRMLScopedPerformanceTimer::~vtkMRMLScopedPerformanceTimer()
+{
+  if (this->Active)
+    {
+    vtkMRMLPerformanceLogger::GetInstance()->LogEvent(
+      this->Name, this->StartTime, vtkTimerLog::GetUniversalTime());
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLPerformanceLogger::classInitialize()
+{
+  // Allocate the singleton
+  vtkMRMLPerformanceLoggerInstance = vtkMRMLPerformanceLogger::GetInstance();
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLPerformanceLogger::classFinalize()
+{
+  vtkMRMLPerformanceLoggerInstance->Delete();
+  vtkMRMLPerformanceLoggerInstance = 0;
+}
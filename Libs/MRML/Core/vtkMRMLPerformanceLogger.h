@@ -0,0 +1,183 @@
+/*==============================================================================
+
+  Program: 3D Slicer
+
+  Copyright (c) Kitware Inc.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+#ifndef __vtkMRMLPerformanceLogger_h
+#define __vtkMRMLPerformanceLogger_h
+
+// MRML includes
+#include "vtkMRML.h"
+
+// VTK includes
+#include <vtkObject.h>
+
+// STD includes
+#include <vector>
+
+/// \brief Low-overhead recorder of timed events in hot code paths.
+///
+/// Hot paths (scene import, slice pipeline updates, CLI task execution, ...)
+/// record their duration into a fixed-capacity ring buffer through
+/// \a vtkMRMLScopedPerformanceTimer, so a long session can stay instrumented
+/// without unbounded memory growth. Recording is off by default and costs a
+/// single flag check per scope when disabled; when a session misbehaves it
+/// can be switched on at runtime (including from Python) without restarting.
+///
+/// The recorded events can be inspected event-by-event with the
+/// GetNthEvent*() accessors or exported with WriteChromeTraceFile() in the
+/// Chrome trace-event JSON format, which chrome://tracing and compatible
+/// viewers can display as a timeline.
+///
+/// This class is a singleton, following the pattern of vtkEventBroker.
+class VTK_MRML_EXPORT vtkMRMLPerformanceLogger : public vtkObject
+{
+public:
+  vtkTypeMacro(vtkMRMLPerformanceLogger, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  ///
+  /// Return the singleton instance with no reference counting.
+  static vtkMRMLPerformanceLogger* GetInstance();
+
+  ///
+  /// This is a singleton pattern New. There will only be ONE
+  /// reference to a vtkMRMLPerformanceLogger object per process. Clients
+  /// that call this must call Delete on the object so that the reference
+  /// counting will work. The single instance will be unreferenced when
+  /// the program exits.
+  static vtkMRMLPerformanceLogger* New();
+
+  ///
+  /// Enable/disable recording. When disabled (the default), instrumented
+  /// scopes only pay for reading this flag.
+  vtkBooleanMacro(RecordingEnabled, int);
+  vtkSetMacro(RecordingEnabled, int);
+  vtkGetMacro(RecordingEnabled, int);
+
+  ///
+  /// Record one completed event. Start and end times are in seconds, as
+  /// returned by vtkTimerLog::GetUniversalTime(). The name is copied (only
+  /// the first 63 characters are kept), so callers do not need to keep the
+  /// string alive. Usually called by vtkMRMLScopedPerformanceTimer rather
+  /// than directly.
+  void LogEvent(const char* name, double startTime, double endTime);
+
+  ///
+  /// Number of events currently held in the ring buffer
+  /// (at most GetCapacity()).
+  int GetNumberOfEvents();
+
+  ///
+  /// Total number of events recorded since the last Clear(), including
+  /// those already overwritten in the ring buffer.
+  vtkGetMacro(TotalNumberOfEvents, int);
+
+  ///
+  /// Access the n-th buffered event, oldest first.
+  /// GetNthEventName returns NULL and the time accessors return 0. for an
+  /// out-of-range index.
+  const char* GetNthEventName(int n);
+  double GetNthEventStartTime(int n);
+  double GetNthEventDuration(int n);
+
+  ///
+  /// Discard all buffered events and reset the total event count.
+  void Clear();
+
+  ///
+  /// Write the buffered events to a file in the Chrome trace-event JSON
+  /// format (open with chrome://tracing or a compatible viewer).
+  /// Returns 0 on failure to open the file, 1 on success.
+  int WriteChromeTraceFile(const char* filename);
+
+protected:
+  vtkMRMLPerformanceLogger();
+  virtual ~vtkMRMLPerformanceLogger();
+  vtkMRMLPerformanceLogger(const vtkMRMLPerformanceLogger&);
+  void operator=(const vtkMRMLPerformanceLogger&);
+
+  ///
+  /// Singleton management functions.
+  static void classInitialize();
+  static void classFinalize();
+
+  friend class vtkMRMLPerformanceLoggerInitialize;
+  typedef vtkMRMLPerformanceLogger Self;
+
+  enum
+    {
+    EventNameLength = 64,
+    Capacity = 4096
+    };
+
+  struct TimedEvent
+    {
+    char Name[EventNameLength];
+    double StartTime;
+    double EndTime;
+    };
+
+  /// Map oldest-first index n to the index in the ring buffer,
+  /// -1 if out of range.
+  int GetBufferIndex(int n);
+
+  std::vector<TimedEvent> Events;
+  int NextEventIndex;
+  int TotalNumberOfEvents;
+  int RecordingEnabled;
+};
+
+/// \brief Times the enclosing scope and reports it to the logger.
+///
+/// Create one on the stack at the top of a hot path:
+/// \code
+/// vtkMRMLScopedPerformanceTimer timer("vtkMRMLScene::Import");
+/// \endcode
+/// The event is recorded when the timer goes out of scope. When recording
+/// is disabled the constructor returns after a single flag check.
+class VTK_MRML_EXPORT vtkMRMLScopedPerformanceTimer
+{
+public:
+  vtkMRMLScopedPerformanceTimer(const char* name);
+  ~vtkMRMLScopedPerformanceTimer();
+private:
+  vtkMRMLScopedPerformanceTimer(const vtkMRMLScopedPerformanceTimer&);
+  void operator=(const vtkMRMLScopedPerformanceTimer&);
+
+  const char* Name;
+  double StartTime;
+  int Active;
+};
+
+/// Utility class to make sure vtkMRMLPerformanceLogger is initialized before
+/// it is used.
+class VTK_MRML_EXPORT vtkMRMLPerformanceLoggerInitialize
+{
+public:
+  typedef vtkMRMLPerformanceLoggerInitialize Self;
+
+  vtkMRMLPerformanceLoggerInitialize();
+  ~vtkMRMLPerformanceLoggerInitialize();
+private:
+  static unsigned int Count;
+};
+
+/// This instance will show up in any translation unit that uses
+/// vtkMRMLPerformanceLogger. It will make sure vtkMRMLPerformanceLogger is
+/// initialized before it is used.
+static vtkMRMLPerformanceLoggerInitialize vtkMRMLPerformanceLoggerInitializer;
+
+#endif
@@ -23,7 +23,8 @@ Version:   $Revision: 1.2 $
 #include <vtkAlgorithmOutput.h>
 #include <vtkCallbackCommand.h>
 #include <vtkColorTransferFunction.h>
-#include <vtkImageAccumulate.h>
+#include <vtkDataArray.h>
+#include <vtkImageScalarStatistics.h>
 #include <vtkImageAppendComponents.h>
 #include <vtkImageExtractComponents.h>
 #include <vtkImageBimodalAnalysis.h>
@@ -106,7 +107,7 @@ vtkMRMLScalarVolumeDisplayNode::vtkMRMLScalarVolumeDisplayNode()
   this->AppendComponents->AddInputConnection(0, this->AlphaLogic->GetOutputPort() );
 
   this->Bimodal = NULL;
-  this->Accumulate = NULL;
+  this->Statistics = NULL;
   this->IsInCalculateAutoLevels = false;
 
   vtkEventBroker::GetInstance()->AddObservation(
@@ -132,10 +133,10 @@ vtkMRMLScalarVolumeDisplayNode::~vtkMRMLScalarVolumeDisplayNode()
     this->Bimodal->Delete();
     this->Bimodal = NULL;
     }
-  if (this->Accumulate)
+  if (this->Statistics)
     {
-    this->Accumulate->Delete();
-    this->Accumulate = NULL;
+    this->Statistics->Delete();
+    this->Statistics = NULL;
     }
 }
 
@@ -163,6 +164,9 @@ void vtkMRMLScalarVolumeDisplayNode::SetInputImageDataConnection(vtkAlgorithmOut
 
   this->Superclass::SetInputImageDataConnection(imageDataConnection);
 
+  // Cached auto-levels refer to the voxel arrays of the previous input
+  this->AutoLevelsCache.clear();
+
   vtkAlgorithm* inputImageDataAlgorithm = this->GetInputImageDataConnection() ?
     this->GetInputImageDataConnection()->GetProducer() : 0;
   if (inputImageDataAlgorithm != NULL)
@@ -737,13 +741,38 @@ void vtkMRMLScalarVolumeDisplayNode::CalculateAutoLevels()
     return;
     }
 
+  // When browsing an image sequence the proxy image is modified on every
+  // frame change but the per-frame voxel arrays are shared, so levels that
+  // were already computed for this array can be reused without re-scanning
+  // the volume.
+  vtkDataArray* scalars = imageDataScalar->GetPointData()->GetScalars();
+  std::map<vtkDataArray*, AutoLevelsCacheEntry>::iterator cacheIt =
+    this->AutoLevelsCache.find(scalars);
+  if (cacheIt != this->AutoLevelsCache.end() &&
+      cacheIt->second.ArrayMTime == scalars->GetMTime())
+    {
+    this->IsInCalculateAutoLevels = true;
+    int disabledModify = this->StartModify();
+    if (this->GetAutoWindowLevel())
+      {
+      this->SetWindowLevel(cacheIt->second.Window, cacheIt->second.Level);
+      }
+    if (this->GetAutoThreshold())
+      {
+      this->SetThreshold(cacheIt->second.Lower, cacheIt->second.Upper);
+      }
+    this->EndModify(disabledModify);
+    this->IsInCalculateAutoLevels = false;
+    return;
+    }
+
   if (this->Bimodal == NULL)
     {
     this->Bimodal = vtkImageBimodalAnalysis::New();
     }
-  if (this->Accumulate == NULL)
+  if (this->Statistics == NULL)
     {
-    this->Accumulate = vtkImageAccumulate::New();
+    this->Statistics = vtkImageScalarStatistics::New();
     }
 
   double window = 0.0;
@@ -771,11 +800,11 @@ void vtkMRMLScalarVolumeDisplayNode::CalculateAutoLevels()
 
     // Setup filter to work with signed 16-bit integer.
     int extent[6] = {0, 65535, 0, 0, 0, 0};
-    this->Accumulate->SetComponentExtent(extent);
+    this->Statistics->SetComponentExtent(extent);
     double origin[3] = {-32768, 0, 0};
-    this->Accumulate->SetComponentOrigin(origin);
-    this->Accumulate->SetInputData(imageDataScalar);
-    this->Bimodal->SetInputConnection(this->Accumulate->GetOutputPort());
+    this->Statistics->SetComponentOrigin(origin);
+    this->Statistics->SetInputData(imageDataScalar);
+    this->Bimodal->SetInputConnection(this->Statistics->GetOutputPort());
     this->Bimodal->Update();
     // Workaround for image data where all accumulate samples fall
     // within the same histogram bin
@@ -804,15 +833,15 @@ void vtkMRMLScalarVolumeDisplayNode::CalculateAutoLevels()
     long minInt = trunc(range[0]) - 1;
     long maxInt = trunc(range[1]) + 1;
 
-    this->Accumulate->SetInputData(imageDataScalar);
+    this->Statistics->SetInputData(imageDataScalar);
     int extent[6] = {0, 999, 0, 0, 0, 0};
-    this->Accumulate->SetComponentExtent(extent);
+    this->Statistics->SetComponentExtent(extent);
     double origin[3] = {static_cast<double>(minInt), 0.0, 0.0};
-    this->Accumulate->SetComponentOrigin(origin);
+    this->Statistics->SetComponentOrigin(origin);
     double spacing[3] = {(maxInt-minInt)/1000.0, 1.0, 1.0};
-    this->Accumulate->SetComponentSpacing(spacing);
+    this->Statistics->SetComponentSpacing(spacing);
 
-    this->Bimodal->SetInputConnection(this->Accumulate->GetOutputPort());
+    this->Bimodal->SetInputConnection(this->Statistics->GetOutputPort());
     this->Bimodal->Update();
 
     // The bimodal analysis assumes that the bin indices correspond directly to
@@ -844,6 +873,14 @@ void vtkMRMLScalarVolumeDisplayNode::CalculateAutoLevels()
     upper = range[1];
     }
 
+  AutoLevelsCacheEntry cacheEntry;
+  cacheEntry.ArrayMTime = scalars->GetMTime();
+  cacheEntry.Window = window;
+  cacheEntry.Level = level;
+  cacheEntry.Lower = lower;
+  cacheEntry.Upper = upper;
+  this->AutoLevelsCache[scalars] = cacheEntry;
+
   this->IsInCalculateAutoLevels = true;
   int disabledModify = this->StartModify();
   if (this->GetAutoWindowLevel())
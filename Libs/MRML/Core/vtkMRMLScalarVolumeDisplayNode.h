@@ -19,8 +19,9 @@
 #include "vtkMRMLVolumeDisplayNode.h"
 
 // VTK includes
+class vtkDataArray;
 class vtkImageAlgorithm;
-class vtkImageAccumulate;
+class vtkImageScalarStatistics;
 class vtkImageAppendComponents;
 class vtkImageBimodalAnalysis;
 class vtkImageCast;
@@ -33,6 +34,7 @@ class vtkImageExtractComponents;
 class vtkImageMathematics;
 
 // STD includes
+#include <map>
 #include <vector>
 
 /// \brief MRML node for representing a volume display attributes.
@@ -194,7 +196,7 @@ protected:
 
   virtual void SetColorNodeInternal(vtkMRMLColorNode* newColorNode) VTK_OVERRIDE;
   void UpdateLookupTable(vtkMRMLColorNode* newColorNode);
-  void CalculateAutoLevels();
+  virtual void CalculateAutoLevels();
 
   /// Return the image data with scalar type, it can be in the middle of the
   /// pipeline, it's typically the input of the threshold/windowlevel filters
@@ -242,9 +244,25 @@ protected:
 
   ///
   /// Used internally in CalculateScalarAutoLevels and CalculateStatisticsAutoLevels
-  vtkImageAccumulate *Accumulate;
+  vtkImageScalarStatistics *Statistics;
   vtkImageBimodalAnalysis *Bimodal;
   bool IsInCalculateAutoLevels;
+
+  ///
+  /// Results of CalculateAutoLevels cached by the voxel array of the input
+  /// image. When browsing an image sequence the proxy image is modified on
+  /// every frame change but the per-frame voxel arrays are shared, so
+  /// revisited frames can reuse their levels without re-scanning the volume.
+  /// Entries are verified against the array modified time on lookup.
+  struct AutoLevelsCacheEntry
+    {
+    unsigned long ArrayMTime;
+    double Window;
+    double Level;
+    double Lower;
+    double Upper;
+    };
+  std::map<vtkDataArray*, AutoLevelsCacheEntry> AutoLevelsCache;
 };
 
 #endif
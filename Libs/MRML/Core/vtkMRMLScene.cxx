@@ -14,6 +14,7 @@ Version:   $Revision: 1.18 $
 
 #include "vtkMRMLScene.h"
 #include "vtkMRMLParser.h"
+#include "vtkMRMLPerformanceLogger.h"
 
 #include "vtkCacheManager.h"
 #include "vtkDataIOManager.h"
@@ -39,6 +40,7 @@ Version:   $Revision: 1.18 $
 #include "vtkMRMLLinearTransformNode.h"
 #include "vtkMRMLModelNode.h"
 #include "vtkMRMLModelHierarchyNode.h"
+#include "vtkMRMLMultiResolutionVolumeNode.h"
 #include "vtkMRMLPlotSeriesNode.h"
 #include "vtkMRMLPlotChartNode.h"
 #include "vtkMRMLPlotViewNode.h"
@@ -93,6 +95,8 @@ Version:   $Revision: 1.18 $
 
 // STD includes
 #include <algorithm>
+#include <fstream>
+#include <map>
 #include <numeric>
 
 //#define MRMLSCENE_VERBOSE
@@ -111,6 +115,13 @@ vtkMRMLScene::vtkMRMLScene()
 {
   this->NodeIDsMTime = 0;
   this->SceneModifiedTime = 0;
+  this->StructuralEpoch = 0;
+
+  this->WriteScopeDepth = 0;
+  this->WriteGeneration = 0;
+  this->ChangesetAddedNodes = vtkCollection::New();
+  this->ChangesetRemovedNodes = vtkCollection::New();
+  this->ChangesetModifiedNodes = vtkCollection::New();
 
   this->RegisteredNodeClasses.clear();
   this->UniqueIDs.clear();
@@ -137,6 +148,8 @@ vtkMRMLScene::vtkMRMLScene()
 
   this->ReadDataOnLoad = 1;
 
+  this->StreamingImport = 0;
+
   this->LastLoadedVersion = NULL;
   this->Version = NULL;
   this->SetVersion(CURRENT_MRML_VERSION);
@@ -180,6 +193,7 @@ vtkMRMLScene::vtkMRMLScene()
   this->RegisterNodeClass( vtkSmartPointer< vtkMRMLScalarVolumeDisplayNode >::New() );
   this->RegisterNodeClass( vtkSmartPointer< vtkMRMLLabelMapVolumeDisplayNode >::New() );
   this->RegisterNodeClass( vtkSmartPointer< vtkMRMLLabelMapVolumeNode >::New() );
+  this->RegisterNodeClass( vtkSmartPointer< vtkMRMLMultiResolutionVolumeNode >::New() );
   this->RegisterNodeClass( vtkSmartPointer< vtkMRMLColorNode >::New() );
   this->RegisterNodeClass( vtkSmartPointer< vtkMRMLDiffusionWeightedVolumeNode >::New() );
 #ifdef MRML_USE_vtkTeem
@@ -267,6 +281,21 @@ vtkMRMLScene::~vtkMRMLScene()
     this->UserTagTable->Delete();
     this->UserTagTable = NULL;
     }
+  if ( this->ChangesetAddedNodes != NULL )
+    {
+    this->ChangesetAddedNodes->Delete();
+    this->ChangesetAddedNodes = NULL;
+    }
+  if ( this->ChangesetRemovedNodes != NULL )
+    {
+    this->ChangesetRemovedNodes->Delete();
+    this->ChangesetRemovedNodes = NULL;
+    }
+  if ( this->ChangesetModifiedNodes != NULL )
+    {
+    this->ChangesetModifiedNodes->Delete();
+    this->ChangesetModifiedNodes = NULL;
+    }
   this->SetLastLoadedVersion(0);
   this->SetVersion(0);
   if ( this->DeleteEventCallback != NULL )
@@ -305,6 +334,7 @@ void vtkMRMLScene::Clear(int removeSingletons)
   this->StartState(vtkMRMLScene::CloseState);
 
   this->RemoveAllNodes(removeSingletons);
+  this->StructuralEpoch++;
   this->NodeReferences.clear();
   this->ReferencedIDChanges.clear();
   this->ResetNodes();
@@ -741,6 +771,7 @@ int vtkMRMLScene::Connect()
 //------------------------------------------------------------------------------
 int vtkMRMLScene::Import()
 {
+  vtkMRMLScopedPerformanceTimer performanceTimer("vtkMRMLScene::Import");
 #ifdef MRMLSCENE_VERBOSE
   vtkTimerLog* addNodesTimer = vtkTimerLog::New();
   vtkTimerLog* updateSceneTimer = vtkTimerLog::New();
@@ -756,39 +787,61 @@ int vtkMRMLScene::Import()
   this->StartState(vtkMRMLScene::ImportState);
   this->ReferencedIDChanges.clear();
 
+  // When streaming import is enabled and the scene is empty, the parser adds
+  // the nodes to the scene directly as the XML elements are read, so the full
+  // document is never materialized in a temporary collection and
+  // NodeAddedEvent observers can overlap storage node reads with parsing.
+  // With existing nodes in the scene the two-pass path below is required,
+  // as node ID conflicts can only be resolved once all imported IDs are known.
+  bool streaming = (this->StreamingImport != 0 && this->GetNumberOfNodes() == 0);
+
   // read nodes into a temp scene
   vtkSmartPointer<vtkCollection> loadedNodes = vtkSmartPointer<vtkCollection>::New();
 
-  int parsingSuccess = this->LoadIntoScene(loadedNodes);
+  int parsingSuccess = this->LoadIntoScene(streaming ? this->Nodes : loadedNodes.GetPointer());
 
   if (parsingSuccess)
     {
-    /// In case the scene needs to change the ID of some nodes to add, the new
-    /// ID should not be one already existing in the scene nor one of the
-    /// imported scene.
-    /// Mark all the node IDs of the scene as reserved so the node ID
-    /// generator doesn't choose them.
+    vtkSmartPointer<vtkCollection> addedNodes = vtkSmartPointer<vtkCollection>::New();
     vtkMRMLNode *node=NULL;
     vtkCollectionSimpleIterator it;
-    for (loadedNodes->InitTraversal(it);
-         (node = (vtkMRMLNode*)loadedNodes->GetNextItemAsObject(it)) ;)
+    if (streaming)
       {
-      this->AddReservedID(node->GetID());
+      // The scene was empty, so the added nodes are exactly the scene nodes.
+      for (this->Nodes->InitTraversal(it);
+           (node = (vtkMRMLNode*)this->Nodes->GetNextItemAsObject(it)) ;)
+        {
+        addedNodes->AddItem(node);
+        }
       }
+    else
+      {
+      /// In case the scene needs to change the ID of some nodes to add, the new
+      /// ID should not be one already existing in the scene nor one of the
+      /// imported scene.
+      /// Mark all the node IDs of the scene as reserved so the node ID
+      /// generator doesn't choose them.
+      for (loadedNodes->InitTraversal(it);
+           (node = (vtkMRMLNode*)loadedNodes->GetNextItemAsObject(it)) ;)
+        {
+        this->AddReservedID(node->GetID());
+        }
 #ifdef MRMLSCENE_VERBOSE
-    addNodesTimer->StartTimer();
+      addNodesTimer->StartTimer();
+#endif
+      // Loaded node is not always the same the one that is actually added:
+      // in case of singleton nodes the existing singleton node is kept
+      // and only the contents is overwritten.
+      for (loadedNodes->InitTraversal(it);
+           (node = (vtkMRMLNode*)loadedNodes->GetNextItemAsObject(it)) ;)
+        {
+        addedNodes->AddItem(this->AddNode(node));
+        }
+#ifdef MRMLSCENE_VERBOSE
+      addNodesTimer->StopTimer();
 #endif
-    // Loaded node is not always the same the one that is actually added:
-    // in case of singleton nodes the existing singleton node is kept
-    // and only the contents is overwritten.
-    vtkSmartPointer<vtkCollection> addedNodes = vtkSmartPointer<vtkCollection>::New();
-    for (loadedNodes->InitTraversal(it);
-         (node = (vtkMRMLNode*)loadedNodes->GetNextItemAsObject(it)) ;)
-      {
-      addedNodes->AddItem(this->AddNode(node));
       }
 #ifdef MRMLSCENE_VERBOSE
-    addNodesTimer->StopTimer();
     updateSceneTimer->StartTimer();
 #endif
     // Update the node references to the changed node IDs
@@ -1184,6 +1237,20 @@ vtkMRMLNode* vtkMRMLScene::AddNodeNoNotify(vtkMRMLNode *n)
     }
   n->SetScene( this );
   this->Nodes->vtkCollection::AddItem((vtkObject *)n);
+  this->StructuralEpoch++;
+  if (this->WriteScopeDepth > 0)
+    {
+    // a node removed and re-added within the same write scope cancels
+    // out in the changeset
+    if (this->ChangesetRemovedNodes->IsItemPresent(n))
+      {
+      this->ChangesetRemovedNodes->RemoveItem(n);
+      }
+    else
+      {
+      this->ChangesetAddedNodes->AddItem(n);
+      }
+    }
 
   // cache the node so the whole scene cache stays up-todate
   this->AddNodeID(n);
@@ -1346,9 +1413,24 @@ void vtkMRMLScene::RemoveNode(vtkMRMLNode *n)
     n->SetScene(0);
     }
   this->Nodes->vtkCollection::RemoveItem((vtkObject *)n);
+  this->StructuralEpoch++;
+  if (this->WriteScopeDepth > 0)
+    {
+    // a node added and removed within the same write scope cancels out
+    // in the changeset
+    if (this->ChangesetAddedNodes->IsItemPresent(n))
+      {
+      this->ChangesetAddedNodes->RemoveItem(n);
+      }
+    else
+      {
+      this->ChangesetRemovedNodes->AddItem(n);
+      }
+    }
 
   std::string nid=n->GetID();
   this->RemoveNodeID(n->GetID());
+  this->RemoveNodeFromIndexes(n);
 
   this->InvokeEvent(vtkMRMLScene::NodeRemovedEvent, n);
 
@@ -1518,6 +1600,96 @@ int vtkMRMLScene::GetNumberOfNodes ()
   return this->Nodes->GetNumberOfItems();
 }
 
+//------------------------------------------------------------------------------
+unsigned long vtkMRMLScene::GetBulkDataActualMemorySize()
+{
+  unsigned long memorySizeInKilobytes = 0;
+  vtkMRMLNode* node = NULL;
+  vtkCollectionSimpleIterator it;
+  for (this->Nodes->InitTraversal(it);
+    (node = (vtkMRMLNode*)this->Nodes->GetNextItemAsObject(it));)
+    {
+    memorySizeInKilobytes += node->GetBulkDataActualMemorySize();
+    }
+  return memorySizeInKilobytes;
+}
+
+namespace
+{
+//------------------------------------------------------------------------------
+// sort predicate: node owning the most bulk data first
+// (sizes are passed in to avoid re-querying the nodes while sorting)
+struct vtkMRMLNodeBulkDataEntry
+{
+  vtkMRMLNode* Node;
+  unsigned long MemorySize;
+};
+
+bool vtkMRMLNodeOwnsMoreBulkData(const vtkMRMLNodeBulkDataEntry& entry1,
+                                 const vtkMRMLNodeBulkDataEntry& entry2)
+{
+  return entry1.MemorySize > entry2.MemorySize;
+}
+}
+
+//------------------------------------------------------------------------------
+int vtkMRMLScene::GenerateBulkDataMemoryReportFile(const char* reportFile)
+{
+  std::ofstream file;
+
+  file.open( reportFile, std::ios::out );
+
+  if ( file.fail() )
+    {
+    vtkErrorMacro( "could not write to " << reportFile );
+    return 1;
+    }
+
+  std::vector<vtkMRMLNodeBulkDataEntry> entries;
+  std::map<std::string, unsigned long> classTotals;
+  unsigned long total = 0;
+  vtkMRMLNode* node = NULL;
+  vtkCollectionSimpleIterator it;
+  for (this->Nodes->InitTraversal(it);
+    (node = (vtkMRMLNode*)this->Nodes->GetNextItemAsObject(it));)
+    {
+    unsigned long memorySize = node->GetBulkDataActualMemorySize();
+    if (memorySize == 0)
+      {
+      continue;
+      }
+    vtkMRMLNodeBulkDataEntry entry;
+    entry.Node = node;
+    entry.MemorySize = memorySize;
+    entries.push_back(entry);
+    classTotals[node->GetClassName()] += memorySize;
+    total += memorySize;
+    }
+  std::sort(entries.begin(), entries.end(), vtkMRMLNodeOwnsMoreBulkData);
+
+  file << "# Bulk data memory report - sizes in KiB\n";
+  file << "# total\t" << total << "\n";
+  file << "# per-class subtotals:\n";
+  std::map<std::string, unsigned long>::iterator classIt;
+  for (classIt = classTotals.begin(); classIt != classTotals.end(); ++classIt)
+    {
+    file << "# " << classIt->second << "\t" << classIt->first << "\n";
+    }
+  file << "# size\tid\tclass\tname\n";
+  std::vector<vtkMRMLNodeBulkDataEntry>::iterator entryIt;
+  for (entryIt = entries.begin(); entryIt != entries.end(); ++entryIt)
+    {
+    file << entryIt->MemorySize
+         << "\t" << (entryIt->Node->GetID() ? entryIt->Node->GetID() : "(none)")
+         << "\t" << entryIt->Node->GetClassName()
+         << "\t" << (entryIt->Node->GetName() ? entryIt->Node->GetName() : "(none)")
+         << "\n";
+    }
+
+  file.close();
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 int vtkMRMLScene::GetNumberOfNodesByClass(const char *className)
 {
@@ -1549,15 +1721,18 @@ int vtkMRMLScene::GetNodesByClass(const char *className, std::vector<vtkMRMLNode
     vtkErrorMacro("GetNodesByClass: class name is null.");
     return 0;
     }
-  vtkMRMLNode *node;
-  vtkCollectionSimpleIterator it;
-  for (this->Nodes->InitTraversal(it);
-       (node = (vtkMRMLNode*)this->Nodes->GetNextItemAsObject(it)) ;)
+  this->UpdateNodeIDs();
+  // The class index groups the nodes by their exact class name, therefore
+  // IsA() only needs to be evaluated once per node class instead of once
+  // per node.
+  for (std::map< std::string, std::vector<vtkMRMLNode*> >::iterator classIt =
+       this->NodeClassIndex.begin(); classIt != this->NodeClassIndex.end(); ++classIt)
     {
-    if (node->IsA(className))
+    if (classIt->second.empty() || !classIt->second.front()->IsA(className))
       {
-      nodes.push_back(node);
+      continue;
       }
+    nodes.insert(nodes.end(), classIt->second.begin(), classIt->second.end());
     }
   return static_cast<int>(nodes.size());
 }
@@ -1571,15 +1746,12 @@ vtkCollection* vtkMRMLScene::GetNodesByClass(const char *className)
     return 0;
     }
   vtkCollection* nodes = vtkCollection::New();
-  vtkMRMLNode *node;
-  vtkCollectionSimpleIterator it;
-  for (this->Nodes->InitTraversal(it);
-       (node = (vtkMRMLNode*)this->Nodes->GetNextItemAsObject(it)) ;)
+  std::vector<vtkMRMLNode *> foundNodes;
+  this->GetNodesByClass(className, foundNodes);
+  for (std::vector<vtkMRMLNode *>::iterator nodeIt = foundNodes.begin();
+       nodeIt != foundNodes.end(); ++nodeIt)
     {
-    if (node->IsA(className))
-      {
-      nodes->AddItem(node);
-      }
+    nodes->AddItem(*nodeIt);
     }
   return nodes;
 }
@@ -1809,6 +1981,25 @@ vtkMRMLNode* vtkMRMLScene::GetFirstNodeByName(const char* name)
     return node;
     }
 
+  this->UpdateNodeIDs();
+  std::map< std::string, std::vector<vtkMRMLNode*> >::iterator nameIt =
+    this->NodeNameIndex.find(name);
+  if (nameIt != this->NodeNameIndex.end())
+    {
+    for (std::vector<vtkMRMLNode*>::iterator nodeIt = nameIt->second.begin();
+         nodeIt != nameIt->second.end(); ++nodeIt)
+      {
+      // The index entry may be stale if the node has been renamed since it
+      // was added to the scene, therefore the current name is verified.
+      if ((*nodeIt)->GetName() != 0 && !strcmp((*nodeIt)->GetName(), name))
+        {
+        return *nodeIt;
+        }
+      }
+    }
+
+  // A node that was renamed after it was added to the scene is not found in
+  // the name index, fall back to searching the full node collection.
   vtkCollectionSimpleIterator it;
   for (this->Nodes->InitTraversal(it);
        (node = (vtkMRMLNode*)this->Nodes->GetNextItemAsObject(it)) ;)
@@ -2508,7 +2699,19 @@ void vtkMRMLScene::CopyNodeInUndoStack(vtkMRMLNode *copyNode)
   vtkMRMLNode *snode = copyNode->CreateNodeInstance();
   if (snode != NULL)
     {
-    snode->CopyWithScene(copyNode);
+    vtkMRMLSegmentationNode* segmentationSnode = vtkMRMLSegmentationNode::SafeDownCast(snode);
+    if (segmentationSnode)
+      {
+      // A previous checkpoint copy of the same segmentation (if any) can
+      // serve as baseline so that only the segments modified since then
+      // need to be deep-copied onto the undo stack.
+      segmentationSnode->CopyWithSceneWithBaseline(copyNode,
+        vtkMRMLSegmentationNode::SafeDownCast(this->FindUndoStackCopy(copyNode)));
+      }
+    else
+      {
+      snode->CopyWithScene(copyNode);
+      }
     }
   vtkCollection* undoScene = dynamic_cast < vtkCollection *>( this->UndoStack.back() );
   int nnodes = undoScene->GetNumberOfItems();
@@ -2524,6 +2727,35 @@ void vtkMRMLScene::CopyNodeInUndoStack(vtkMRMLNode *copyNode)
   snode->Delete();
 }
 
+//------------------------------------------------------------------------------
+vtkMRMLNode* vtkMRMLScene::FindUndoStackCopy(vtkMRMLNode *node)
+{
+  if (!node || node->GetID() == NULL)
+    {
+    return NULL;
+    }
+  // Search the undo states from the most recent one backwards. Scene nodes
+  // that have not been checkpointed yet are stored in the states as pointers
+  // to the live node itself, so only an item with matching ID but different
+  // pointer is an actual checkpoint copy.
+  for (std::list< vtkCollection* >::reverse_iterator stackIt = this->UndoStack.rbegin();
+       stackIt != this->UndoStack.rend(); ++stackIt)
+    {
+    vtkCollection* undoScene = *stackIt;
+    int nnodes = undoScene->GetNumberOfItems();
+    for (int n=0; n<nnodes; n++)
+      {
+      vtkMRMLNode *undoNode = dynamic_cast < vtkMRMLNode *>(undoScene->GetItemAsObject(n));
+      if (undoNode && undoNode != node
+        && undoNode->GetID() && !strcmp(undoNode->GetID(), node->GetID()))
+        {
+        return undoNode;
+        }
+      }
+    }
+  return NULL;
+}
+
 //------------------------------------------------------------------------------
 // Put a replacement node into the redoable copy of the scene so that the node
 // can be replaced by the Undo version
@@ -2918,6 +3150,32 @@ const char* vtkMRMLScene::GetChangedID(const char* id)
 //------------------------------------------------------------------------------
 void vtkMRMLScene::UpdateNodeReferences(vtkCollection* checkNodes/*=NULL*/)
 {
+  if (this->ReferencedIDChanges.empty())
+    {
+    return;
+    }
+
+  // Build a fast look up of the nodes the update is restricted to.
+  // vtkCollection::IsItemPresent is a linear scan and was called once per
+  // reference, which made reference fix up quadratic on large scene imports.
+  std::set<vtkMRMLNode*> checkNodeSet;
+  if (checkNodes!=NULL)
+    {
+    vtkObject *object = NULL;
+    vtkCollectionSimpleIterator it;
+    for (checkNodes->InitTraversal(it);
+         (object = checkNodes->GetNextItemAsObject(it)) ;)
+      {
+      checkNodeSet.insert(vtkMRMLNode::SafeDownCast(object));
+      }
+    }
+
+  // First pass: collect the ID changes to apply, grouped by referring node.
+  // This works on a snapshot of the reference index, as the index may change
+  // as a result of the UpdateReferenceID calls in the second pass.
+  typedef std::vector< std::pair<std::string, std::string> > IDChangeListType;
+  typedef std::map<vtkMRMLNode*, IDChangeListType> NodeIDChangesType;
+  NodeIDChangesType nodeIDChanges;
   for (std::map< std::string, std::string>::const_iterator iterChanged = this->ReferencedIDChanges.begin();
     iterChanged != this->ReferencedIDChanges.end(); iterChanged++)
     {
@@ -2929,10 +3187,8 @@ void vtkMRMLScene::UpdateNodeReferences(vtkCollection* checkNodes/*=NULL*/)
       // this updated ID is not observed by any node
       continue;
       }
-    // make a copy of the node list, as the list may change as a result of UpdateReferenceID calls
-    std::set<std::string> nodesToNotify=referencedIdIt->second;
-    for (NodeReferencesType::value_type::second_type::iterator referringNodesIt = nodesToNotify.begin();
-      referringNodesIt!=nodesToNotify.end();
+    for (NodeReferencesType::value_type::second_type::iterator referringNodesIt = referencedIdIt->second.begin();
+      referringNodesIt!=referencedIdIt->second.end();
       ++referringNodesIt)
       {
       vtkMRMLNode *node = this->GetNodeByID(*referringNodesIt);
@@ -2940,12 +3196,30 @@ void vtkMRMLScene::UpdateNodeReferences(vtkCollection* checkNodes/*=NULL*/)
         {
         continue;
         }
-      if (checkNodes!=NULL && !checkNodes->IsItemPresent(node))
+      if (checkNodes!=NULL && checkNodeSet.find(node)==checkNodeSet.end())
         {
         continue;
         }
-      node->UpdateReferenceID(oldID.c_str(), newID.c_str());
+      nodeIDChanges[node].push_back(std::make_pair(oldID, newID));
+      }
+    }
+
+  // Second pass: apply the changes node by node, holding each node's events
+  // until all of its references are updated, so observers get one coalesced
+  // notification per node instead of one per updated reference.
+  for (NodeIDChangesType::iterator changesIt = nodeIDChanges.begin();
+    changesIt != nodeIDChanges.end();
+    ++changesIt)
+    {
+    vtkMRMLNode* node = changesIt->first;
+    int wasModifying = node->StartModify();
+    for (IDChangeListType::iterator idChangeIt = changesIt->second.begin();
+      idChangeIt != changesIt->second.end();
+      ++idChangeIt)
+      {
+      node->UpdateReferenceID(idChangeIt->first.c_str(), idChangeIt->second.c_str());
       }
+    node->EndModify(wasModifying);
     }
 }
 
@@ -3115,6 +3389,65 @@ void vtkMRMLScene::AddNodeID(vtkMRMLNode *node)
     {
     this->NodeIDs[std::string(node->GetID())] = node;
     this->NodeIDsMTime = this->Nodes->GetMTime();
+    this->AddNodeToIndexes(node);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void vtkMRMLScene::AddNodeToIndexes(vtkMRMLNode *node)
+{
+  if (!node)
+    {
+    return;
+    }
+  this->NodeClassIndex[node->GetClassName()].push_back(node);
+  if (node->GetName())
+    {
+    this->NodeNameIndex[node->GetName()].push_back(node);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void vtkMRMLScene::RemoveNodeFromIndexes(vtkMRMLNode *node)
+{
+  if (!node)
+    {
+    return;
+    }
+  std::map< std::string, std::vector<vtkMRMLNode*> >::iterator classIt =
+    this->NodeClassIndex.find(node->GetClassName());
+  if (classIt != this->NodeClassIndex.end())
+    {
+    std::vector<vtkMRMLNode*>::iterator nodeIt =
+      std::find(classIt->second.begin(), classIt->second.end(), node);
+    if (nodeIt != classIt->second.end())
+      {
+      classIt->second.erase(nodeIt);
+      }
+    if (classIt->second.empty())
+      {
+      this->NodeClassIndex.erase(classIt);
+      }
+    }
+  // The node may have been renamed since it was indexed, therefore
+  // the node is searched in all the name index entries.
+  for (std::map< std::string, std::vector<vtkMRMLNode*> >::iterator nameIt =
+       this->NodeNameIndex.begin(); nameIt != this->NodeNameIndex.end();)
+    {
+    std::vector<vtkMRMLNode*>::iterator nodeIt =
+      std::find(nameIt->second.begin(), nameIt->second.end(), node);
+    if (nodeIt != nameIt->second.end())
+      {
+      nameIt->second.erase(nodeIt);
+      }
+    if (nameIt->second.empty())
+      {
+      this->NodeNameIndex.erase(nameIt++);
+      }
+    else
+      {
+      ++nameIt;
+      }
     }
 }
 
@@ -3134,6 +3467,8 @@ void vtkMRMLScene::ClearNodeIDs()
   if (this->Nodes)
     {
     this->NodeIDs.clear();
+    this->NodeClassIndex.clear();
+    this->NodeNameIndex.clear();
     this->NodeIDsMTime = this->Nodes->GetMTime();
   }
 }
@@ -3425,6 +3760,136 @@ SetStorableNodesModifiedSinceRead(vtkCollection* storableNodes)
     }
 }
 
+//-----------------------------------------------------------------------------
+vtkMTimeType vtkMRMLScene::GetStructuralEpoch()
+{
+  return this->StructuralEpoch;
+}
+
+//-----------------------------------------------------------------------------
+vtkCollection* vtkMRMLScene::StartReadTransaction()
+{
+  // Referencing the nodes in the returned collection keeps them alive
+  // for the duration of the transaction even if the main thread
+  // removes them from the scene, so a background job can traverse the
+  // snapshot without risking dangling pointers.
+  vtkCollection* snapshot = vtkCollection::New();
+  vtkMRMLNode* node = NULL;
+  vtkCollectionSimpleIterator it;
+  for (this->Nodes->InitTraversal(it);
+       (node = (vtkMRMLNode*)this->Nodes->GetNextItemAsObject(it)) ;)
+    {
+    snapshot->AddItem(node);
+    }
+  return snapshot;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkMRMLScene::IsReadTransactionValid(vtkMTimeType epoch)
+{
+  return epoch == this->StructuralEpoch;
+}
+
+//-----------------------------------------------------------------------------
+void vtkMRMLScene::StartWriteScope()
+{
+  if (this->WriteScopeDepth == 0)
+    {
+    this->WriteGeneration++;
+    this->ChangesetAddedNodes->RemoveAllItems();
+    this->ChangesetRemovedNodes->RemoveAllItems();
+    this->ChangesetModifiedNodes->RemoveAllItems();
+    this->WriteScopeStartTime.Modified();
+    this->StartState(vtkMRMLScene::BatchProcessState);
+    }
+  this->WriteScopeDepth++;
+}
+
+//-----------------------------------------------------------------------------
+void vtkMRMLScene::EndWriteScope()
+{
+  if (this->WriteScopeDepth <= 0)
+    {
+    vtkErrorMacro("EndWriteScope: no write scope is open");
+    return;
+    }
+  this->WriteScopeDepth--;
+  if (this->WriteScopeDepth > 0)
+    {
+    return;
+    }
+  // Fill the modified changeset: every node whose MTime advanced during
+  // the scope, except the ones the scope itself added (those are
+  // reported in the added changeset only).
+  vtkMRMLNode* node = NULL;
+  vtkCollectionSimpleIterator it;
+  for (this->Nodes->InitTraversal(it);
+       (node = (vtkMRMLNode*)this->Nodes->GetNextItemAsObject(it)) ;)
+    {
+    if (node->GetMTime() > this->WriteScopeStartTime.GetMTime() &&
+        !this->ChangesetAddedNodes->IsItemPresent(node))
+      {
+      this->ChangesetModifiedNodes->AddItem(node);
+      }
+    }
+  // End the batch state first so observers that only honor the batch
+  // events refresh as before, then let changeset-aware observers
+  // consume the recorded collections in a single pass.
+  this->EndState(vtkMRMLScene::BatchProcessState);
+  this->InvokeEvent(vtkMRMLScene::SceneChangesetEvent);
+}
+
+//-----------------------------------------------------------------------------
+bool vtkMRMLScene::IsInWriteScope()
+{
+  return this->WriteScopeDepth > 0;
+}
+
+//-----------------------------------------------------------------------------
+vtkMTimeType vtkMRMLScene::GetWriteGeneration()
+{
+  return this->WriteGeneration;
+}
+
+//-----------------------------------------------------------------------------
+vtkCollection* vtkMRMLScene::GetChangesetAddedNodes()
+{
+  return this->ChangesetAddedNodes;
+}
+
+//-----------------------------------------------------------------------------
+vtkCollection* vtkMRMLScene::GetChangesetRemovedNodes()
+{
+  return this->ChangesetRemovedNodes;
+}
+
+//-----------------------------------------------------------------------------
+vtkCollection* vtkMRMLScene::GetChangesetModifiedNodes()
+{
+  return this->ChangesetModifiedNodes;
+}
+
+//-----------------------------------------------------------------------------
+vtkMRMLScene::WriteScope::WriteScope(vtkMRMLScene* scene)
+{
+  this->Scene = scene;
+  if (this->Scene)
+    {
+    this->Scene->Register(NULL);
+    this->Scene->StartWriteScope();
+    }
+}
+
+//-----------------------------------------------------------------------------
+vtkMRMLScene::WriteScope::~WriteScope()
+{
+  if (this->Scene)
+    {
+    this->Scene->EndWriteScope();
+    this->Scene->UnRegister(NULL);
+    }
+}
+
 //-----------------------------------------------------------------------------
 int vtkMRMLScene::GetNumberOfNodeReferences()
 {
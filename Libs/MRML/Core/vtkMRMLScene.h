@@ -468,6 +468,42 @@ public:
   vtkSetMacro(ReadDataOnLoad,int);
   vtkGetMacro(ReadDataOnLoad,int);
 
+  /// \brief This property controls whether Import() adds nodes to the scene
+  /// while the scene XML stream is being parsed.
+  ///
+  /// If false (default), Import() first parses the whole scene XML into a
+  /// temporary node collection and only then adds the nodes to the scene.
+  /// If true, nodes are instantiated and added to the scene as the
+  /// corresponding XML elements are read, without ever materializing the
+  /// full document. NodeAddedEvent observers (such as the asynchronous data
+  /// IO machinery) can therefore start scheduling storage node reads while
+  /// parsing is still in progress.
+  /// Streaming import is only taken into account when the scene is empty
+  /// (as in Connect(), which clears the scene first), because node ID
+  /// conflicts with existing nodes cannot be resolved before the full set
+  /// of imported node IDs is known.
+  /// \sa Import(), Connect()
+  vtkSetMacro(StreamingImport,int);
+  vtkGetMacro(StreamingImport,int);
+  vtkBooleanMacro(StreamingImport,int);
+
+  /// \brief Total size of the bulk data owned by all nodes, in kibibytes.
+  ///
+  /// Sums vtkMRMLNode::GetBulkDataActualMemorySize() over all nodes in the
+  /// scene, so multi-GB memory growth can be attributed to nodes while the
+  /// application is running.
+  /// \sa GenerateBulkDataMemoryReportFile()
+  unsigned long GetBulkDataActualMemorySize();
+
+  /// \brief Write a bulk data memory report to a file.
+  ///
+  /// Lists all nodes that own bulk data, largest first, with node ID, class
+  /// and name, preceded by per-class subtotals. Sizes are in kibibytes.
+  /// Returns 0 on success (following GenerateGraphFile() conventions in
+  /// vtkEventBroker).
+  /// \sa GetBulkDataActualMemorySize()
+  int GenerateBulkDataMemoryReportFile(const char* reportFile);
+
   void SetErrorMessage(const std::string &error);
   std::string GetErrorMessage();
 
@@ -627,6 +663,10 @@ public:
     MetadataAddedEvent = 66032, // ### Slicer 4.5: Simplify - Do not explicitly set for backward compat. See issue #3472
     ImportProgressFeedbackEvent,
     SaveProgressFeedbackEvent,
+    /// Fired once when the outermost write scope ends, after the
+    /// changeset collections have been filled.
+    /// \sa StartWriteScope(), EndWriteScope()
+    SceneChangesetEvent,
 
     /// \internal
     /// not to be used directly
@@ -697,6 +737,115 @@ public:
   /// and call StorableModified() on them.
   static void SetStorableNodesModifiedSinceRead(vtkCollection* storableNodes);
 
+  /// \brief Epoch counter incremented on every structural change of
+  /// the scene (node added or removed, scene cleared).
+  ///
+  /// Background jobs use it for optimistic read transactions: record
+  /// the epoch and a snapshot before starting, traverse the snapshot
+  /// off the main thread, then check the epoch again to detect that
+  /// the scene changed underneath and the result must be discarded.
+  /// \sa StartReadTransaction(), IsReadTransactionValid()
+  vtkMTimeType GetStructuralEpoch();
+
+  /// \brief Start a read transaction for a background job.
+  ///
+  /// Returns a new collection referencing every node currently in the
+  /// scene. The references keep the nodes alive even if the main
+  /// thread removes them from the scene while the job runs, so the
+  /// snapshot can be traversed safely without copying any node data.
+  /// Must be called on the main thread; the caller is responsible for
+  /// deleting the returned collection, which ends the transaction.
+  ///
+  /// Node content is not frozen: a job that needs consistent values
+  /// records GetStructuralEpoch() and the MTime of the nodes it read,
+  /// and re-runs if IsReadTransactionValid() reports a change.
+  /// \sa GetStructuralEpoch(), IsReadTransactionValid()
+  vtkCollection* StartReadTransaction();
+
+  /// \brief Whether no structural change happened since \a epoch.
+  ///
+  /// Returns true if a read transaction started when
+  /// GetStructuralEpoch() returned \a epoch saw a scene that is still
+  /// structurally current.
+  /// \sa GetStructuralEpoch(), StartReadTransaction()
+  bool IsReadTransactionValid(vtkMTimeType epoch);
+
+  /// \brief Start a scoped scene write.
+  ///
+  /// A write scope wraps a batch of scene modifications into a single
+  /// notification: it puts the scene into
+  /// \link vtkMRMLScene::BatchProcessState BatchProcessState \endlink
+  /// (so observers that honor the batch state skip the intermediate
+  /// per-node events), increments the write generation and starts
+  /// recording the nodes that are added, removed or modified. When the
+  /// outermost EndWriteScope() is called the scene fires a single
+  /// \link vtkMRMLScene::SceneChangesetEvent SceneChangesetEvent \endlink
+  /// and observers consume the changeset collections in one pass
+  /// instead of reacting to every individual event.
+  /// Write scopes can be nested; only the outermost pair records and
+  /// fires. Prefer the stack-based WriteScope helper which cannot leak
+  /// an unmatched EndWriteScope().
+  /// \sa EndWriteScope(), WriteScope, GetWriteGeneration()
+  void StartWriteScope();
+
+  /// \brief End a scoped scene write started with StartWriteScope().
+  ///
+  /// When the outermost scope ends, the nodes whose MTime advanced
+  /// during the scope (and that were not added in the scope) are
+  /// collected into the modified changeset, the batch state ends and
+  /// \link vtkMRMLScene::SceneChangesetEvent SceneChangesetEvent \endlink
+  /// is fired.
+  /// \sa StartWriteScope()
+  void EndWriteScope();
+
+  /// Whether a write scope is currently open.
+  /// \sa StartWriteScope(), EndWriteScope()
+  bool IsInWriteScope();
+
+  /// \brief Generation counter incremented by every outermost
+  /// StartWriteScope().
+  ///
+  /// Observers record it when they consume a changeset to recognize
+  /// changesets they already processed.
+  /// \sa StartWriteScope()
+  vtkMTimeType GetWriteGeneration();
+
+  /// \brief Nodes added, removed or modified during the last write
+  /// scope.
+  ///
+  /// Valid from the
+  /// \link vtkMRMLScene::SceneChangesetEvent SceneChangesetEvent \endlink
+  /// until the next outermost StartWriteScope(). The collections are
+  /// owned by the scene; the removed collection references the nodes
+  /// so they are still alive when the changeset is consumed. A node
+  /// removed and re-added (or added and removed) within the same scope
+  /// cancels out and appears in neither list.
+  /// \sa StartWriteScope(), EndWriteScope()
+  vtkCollection* GetChangesetAddedNodes();
+  vtkCollection* GetChangesetRemovedNodes();
+  vtkCollection* GetChangesetModifiedNodes();
+
+  /// \brief Stack-based helper that keeps a write scope open for its
+  /// own lifetime.
+  ///
+  /// \code
+  /// {
+  ///   vtkMRMLScene::WriteScope writeScope(scene);
+  ///   // ... add/remove/modify many nodes ...
+  /// } // single SceneChangesetEvent fired here
+  /// \endcode
+  /// \sa StartWriteScope(), EndWriteScope()
+  class VTK_MRML_EXPORT WriteScope
+    {
+  public:
+    WriteScope(vtkMRMLScene* scene);
+    ~WriteScope();
+  private:
+    vtkMRMLScene* Scene;
+    WriteScope(const WriteScope&); // not implemented
+    void operator=(const WriteScope&); // not implemented
+    };
+
 protected:
 
   typedef std::map< std::string, std::set<std::string> > NodeReferencesType;
@@ -710,6 +859,12 @@ protected:
   void CopyNodeInUndoStack(vtkMRMLNode *node);
   void CopyNodeInRedoStack(vtkMRMLNode *node);
 
+  /// Return the most recent checkpoint copy of \a node stored in the undo
+  /// stack, or NULL if the node has not been copied yet. Used to share
+  /// unmodified bulk data between successive undo checkpoints.
+  /// \sa CopyNodeInUndoStack()
+  vtkMRMLNode* FindUndoStackCopy(vtkMRMLNode *node);
+
   /// Add a node to the scene without invoking a vtkMRMLScene::NodeAddedEvent event.
   ///
   /// \warning Use with extreme caution as it might unsynchronize observer.
@@ -752,11 +907,34 @@ protected:
   /// Clear NodeIDs map used to speedup GetByID() method.
   void ClearNodeIDs();
 
+  /// Add node to the class name and node name indexes used to speedup
+  /// GetNodesByClass() and GetFirstNodeByName() methods.
+  /// Called from AddNodeID().
+  void AddNodeToIndexes(vtkMRMLNode *node);
+
+  /// Remove node from the class name and node name indexes.
+  void RemoveNodeFromIndexes(vtkMRMLNode *node);
+
   /// Get a NodeReferences iterator for a node reference.
   NodeReferencesType::iterator FindNodeReference(const char* referencedId, vtkMRMLNode* referencingNode);
 
   vtkCollection*  Nodes;
   vtkMTimeType    SceneModifiedTime;
+  /// Incremented whenever a node is added or removed or the scene is
+  /// cleared, read by background jobs to validate read transactions.
+  vtkMTimeType    StructuralEpoch;
+
+  /// Nesting depth of StartWriteScope()/EndWriteScope() pairs;
+  /// recording and the changeset event happen on the outermost pair.
+  int             WriteScopeDepth;
+  /// Incremented by every outermost StartWriteScope().
+  vtkMTimeType    WriteGeneration;
+  /// Time the outermost write scope started, compared against node
+  /// MTimes to fill the modified changeset.
+  vtkTimeStamp    WriteScopeStartTime;
+  vtkCollection*  ChangesetAddedNodes;
+  vtkCollection*  ChangesetRemovedNodes;
+  vtkCollection*  ChangesetModifiedNodes;
 
   /// data i/o handling members
   vtkCacheManager *  CacheManager;
@@ -787,6 +965,16 @@ protected:
   std::map< std::string, std::string > ReferencedIDChanges;
   std::map< std::string, vtkSmartPointer<vtkMRMLNode> > NodeIDs;
 
+  /// Indexes used to speedup GetNodesByClass() and GetFirstNodeByName().
+  /// Maintained incrementally in AddNodeID()/RemoveNodeFromIndexes() so that
+  /// lookups do not need to traverse the whole \a Nodes collection.
+  /// The class index maps the exact (most derived) class name to the nodes
+  /// of that class, in the order the nodes were added to the scene.
+  /// The name index may contain stale entries if a node is renamed after
+  /// it was added, therefore entries must be verified before use.
+  std::map< std::string, std::vector<vtkMRMLNode*> > NodeClassIndex;
+  std::map< std::string, std::vector<vtkMRMLNode*> > NodeNameIndex;
+
   // Stores default nodes. If a class is created or reset (using CreateNodeByClass or Clear) and
   // a default node is defined for it then the content of the default node will be used to initialize
   // the class. It is useful for overriding default values that are set in a node's constructor.
@@ -802,6 +990,8 @@ protected:
 
   int ReadDataOnLoad;
 
+  int StreamingImport;
+
   vtkMTimeType  NodeIDsMTime;
 
   void RemoveAllNodes(bool removeSingletons);
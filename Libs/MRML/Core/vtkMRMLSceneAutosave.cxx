@@ -0,0 +1,330 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkMRMLSceneAutosave.cxx,v $
+  Date:      $Date$
+  Version:   $Revision$
+
+=========================================================================auto=*/
+
+// MRML includes
+#include "vtkMRMLSceneAutosave.h"
+#include "vtkMRMLScene.h"
+#include "vtkMRMLNode.h"
+#include "vtkTagTable.h"
+
+// VTK includes
+#include <vtkCollection.h>
+#include <vtkMultiThreader.h>
+#include <vtkMutexLock.h>
+#include <vtkObjectFactory.h>
+
+// VTKsys includes
+#include <vtksys/SystemTools.hxx>
+
+// STD includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+//----------------------------------------------------------------------------
+vtkStandardNewMacro(vtkMRMLSceneAutosave);
+
+namespace
+{
+
+// Number of bytes the worker writes between bandwidth budget checks
+const size_t AutosaveWriteChunkSize = 1024 * 1024;
+
+//----------------------------------------------------------------------------
+struct AutosaveWriteJob
+{
+  std::string Data;
+  std::string FileName;
+  double BytesPerSecond;
+  int Done;
+  int Succeeded;
+  vtkMutexLock* Lock;
+
+  AutosaveWriteJob()
+    {
+    this->BytesPerSecond = 0.;
+    this->Done = 0;
+    this->Succeeded = 0;
+    this->Lock = vtkMutexLock::New();
+    }
+  ~AutosaveWriteJob()
+    {
+    this->Lock->Delete();
+    }
+};
+
+//----------------------------------------------------------------------------
+// Writes the document to FileName + ".tmp" in chunks, pausing between
+// chunks when a bandwidth budget is set, then moves the temporary file
+// over the target in one rename so readers never see a half-written file.
+VTK_THREAD_RETURN_TYPE AutosaveWriterCallback(void* arg)
+{
+  vtkMultiThreader::ThreadInfo* info = static_cast<vtkMultiThreader::ThreadInfo*>(arg);
+  AutosaveWriteJob* job = static_cast<AutosaveWriteJob*>(info->UserData);
+
+  std::string temporaryFileName = job->FileName + ".tmp";
+  bool succeeded = false;
+  {
+    std::ofstream outputFile(temporaryFileName.c_str(),
+      std::ios::out | std::ios::binary | std::ios::trunc);
+    if (outputFile)
+      {
+      size_t written = 0;
+      while (written < job->Data.size())
+        {
+        size_t length = job->Data.size() - written;
+        if (length > AutosaveWriteChunkSize)
+          {
+          length = AutosaveWriteChunkSize;
+          }
+        outputFile.write(job->Data.c_str() + written, length);
+        written += length;
+        if (job->BytesPerSecond > 0. && written < job->Data.size())
+          {
+          // hold the average rate at the budget by sleeping off the time
+          // this chunk was allowed to take
+          double seconds = static_cast<double>(length) / job->BytesPerSecond;
+          vtksys::SystemTools::Delay(static_cast<unsigned int>(seconds * 1000.));
+          }
+        }
+      outputFile.flush();
+      succeeded = outputFile.good();
+      }
+  }
+  if (succeeded)
+    {
+    if (rename(temporaryFileName.c_str(), job->FileName.c_str()) != 0)
+      {
+      // rename over an existing file fails on some platforms; dropping the
+      // target first narrows crash consistency to this small window there
+      vtksys::SystemTools::RemoveFile(job->FileName.c_str());
+      succeeded = (rename(temporaryFileName.c_str(), job->FileName.c_str()) == 0);
+      }
+    }
+  if (!succeeded)
+    {
+    vtksys::SystemTools::RemoveFile(temporaryFileName.c_str());
+    }
+
+  job->Lock->Lock();
+  job->Succeeded = succeeded ? 1 : 0;
+  job->Done = 1;
+  job->Lock->Unlock();
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkMRMLSceneAutosave::vtkMRMLSceneAutosave()
+{
+  this->Scene = NULL;
+  this->FileName = NULL;
+  this->WriteBytesPerSecond = 0.;
+  this->LastNumberOfSerializedNodes = 0;
+  this->LastNumberOfReusedNodes = 0;
+  this->Threader = vtkMultiThreader::New();
+  this->WriteThreadId = -1;
+  this->WriteJob = NULL;
+}
+
+//----------------------------------------------------------------------------
+vtkMRMLSceneAutosave::~vtkMRMLSceneAutosave()
+{
+  this->WaitForCompletion();
+  this->Threader->Delete();
+  this->SetScene(NULL);
+  this->SetFileName(NULL);
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLSceneAutosave::SetScene(vtkMRMLScene* scene)
+{
+  if (scene == this->Scene)
+    {
+    return;
+    }
+  vtkSetObjectBodyMacro(Scene, vtkMRMLScene, scene);
+  // cached XML belongs to the previous scene
+  this->NodeXMLCache.clear();
+}
+
+//----------------------------------------------------------------------------
+std::string vtkMRMLSceneAutosave::AssembleSceneXML()
+{
+  std::ostringstream document;
+
+  // same document header as vtkMRMLScene::Commit()
+  document << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>\n";
+  document << "<MRML ";
+  if (this->Scene->GetVersion())
+    {
+    document << " version=\"" << this->Scene->GetVersion() << "\" ";
+    }
+  vtkTagTable* userTagTable = this->Scene->GetUserTagTable();
+  if (userTagTable != NULL)
+    {
+    std::stringstream userTags;
+    int numberOfTags = userTagTable->GetNumberOfTags();
+    for (int tagIndex = 0; tagIndex < numberOfTags; tagIndex++)
+      {
+      const char* keyword = userTagTable->GetTagAttribute(tagIndex);
+      const char* tagValue = userTagTable->GetTagValue(tagIndex);
+      if (keyword != NULL && tagValue != NULL)
+        {
+        userTags << keyword << "=" << tagValue;
+        if (tagIndex < numberOfTags - 1)
+          {
+          userTags << " ";
+          }
+        }
+      }
+    document << "userTags=\"" << userTags.str() << "\"";
+    }
+  document << ">\n";
+
+  this->LastNumberOfSerializedNodes = 0;
+  this->LastNumberOfReusedNodes = 0;
+  std::map<std::string, CachedNodeXML> updatedCache;
+
+  vtkCollection* nodes = this->Scene->GetNodes();
+  for (int n = 0; n < nodes->GetNumberOfItems(); n++)
+    {
+    vtkMRMLNode* node = (vtkMRMLNode*)nodes->GetItemAsObject(n);
+    if (!node->GetSaveWithScene())
+      {
+      continue;
+      }
+    std::string nodeID = node->GetID() ? node->GetID() : "";
+    vtkMTimeType nodeTime = node->GetMTime();
+    if (!nodeID.empty())
+      {
+      std::map<std::string, CachedNodeXML>::iterator cached =
+        this->NodeXMLCache.find(nodeID);
+      if (cached != this->NodeXMLCache.end() && cached->second.MTime == nodeTime)
+        {
+        document << cached->second.XML;
+        updatedCache[nodeID] = cached->second;
+        this->LastNumberOfReusedNodes++;
+        continue;
+        }
+      }
+    // serialize the node the way vtkMRMLScene::Commit() does, with a fixed
+    // indent of one so that the fragment does not depend on its position
+    std::ostringstream nodeXML;
+    vtkIndent vindent(1);
+    nodeXML << vindent << "<" << node->GetNodeTagName() << "\n ";
+    node->WriteXML(nodeXML, 1);
+    nodeXML << vindent << ">";
+    node->WriteNodeBodyXML(nodeXML, 1);
+    nodeXML << "</" << node->GetNodeTagName() << ">\n";
+    document << nodeXML.str();
+    this->LastNumberOfSerializedNodes++;
+    if (!nodeID.empty())
+      {
+      CachedNodeXML& entry = updatedCache[nodeID];
+      entry.MTime = nodeTime;
+      entry.XML = nodeXML.str();
+      }
+    }
+  document << "</MRML>\n";
+
+  // entries of removed nodes are dropped with the old cache
+  this->NodeXMLCache.swap(updatedCache);
+
+  return document.str();
+}
+
+//----------------------------------------------------------------------------
+bool vtkMRMLSceneAutosave::Autosave()
+{
+  if (this->Scene == NULL)
+    {
+    vtkErrorMacro("Autosave: scene is not set");
+    return false;
+    }
+  if (this->FileName == NULL || this->FileName[0] == '\0')
+    {
+    vtkErrorMacro("Autosave: FileName is not set");
+    return false;
+    }
+  if (this->IsWriteInProgress())
+    {
+    vtkDebugMacro("Autosave: previous write still in progress, skipping");
+    return false;
+    }
+
+  AutosaveWriteJob* job = new AutosaveWriteJob;
+  job->Data = this->AssembleSceneXML();
+  job->FileName = this->FileName;
+  job->BytesPerSecond = this->WriteBytesPerSecond;
+  this->WriteJob = job;
+  this->WriteThreadId = this->Threader->SpawnThread(AutosaveWriterCallback, job);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkMRMLSceneAutosave::IsWriteInProgress()
+{
+  if (this->WriteThreadId < 0)
+    {
+    return false;
+    }
+  AutosaveWriteJob* job = static_cast<AutosaveWriteJob*>(this->WriteJob);
+  job->Lock->Lock();
+  int done = job->Done;
+  job->Lock->Unlock();
+  if (done)
+    {
+    this->ReapFinishedWrite();
+    return false;
+    }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLSceneAutosave::WaitForCompletion()
+{
+  if (this->WriteThreadId < 0)
+    {
+    return;
+    }
+  this->ReapFinishedWrite();
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLSceneAutosave::ReapFinishedWrite()
+{
+  // joins the worker, so this blocks until the write is over
+  this->Threader->TerminateThread(this->WriteThreadId);
+  AutosaveWriteJob* job = static_cast<AutosaveWriteJob*>(this->WriteJob);
+  if (!job->Succeeded)
+    {
+    vtkWarningMacro("Autosave: could not write " << job->FileName.c_str());
+    }
+  delete job;
+  this->WriteJob = NULL;
+  this->WriteThreadId = -1;
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLSceneAutosave::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << (this->FileName ? this->FileName : "(none)") << "\n";
+  os << indent << "WriteBytesPerSecond: " << this->WriteBytesPerSecond << "\n";
+  os << indent << "LastNumberOfSerializedNodes: " << this->LastNumberOfSerializedNodes << "\n";
+  os << indent << "LastNumberOfReusedNodes: " << this->LastNumberOfReusedNodes << "\n";
+  os << indent << "WriteInProgress: " << (this->IsWriteInProgress() ? "true" : "false") << "\n";
+}
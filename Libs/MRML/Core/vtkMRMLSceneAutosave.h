@@ -0,0 +1,132 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkMRMLSceneAutosave.h,v $
+  Date:      $Date$
+  Version:   $Revision$
+
+=========================================================================auto=*/
+
+#ifndef __vtkMRMLSceneAutosave_h
+#define __vtkMRMLSceneAutosave_h
+
+// MRML includes
+#include "vtkMRML.h"
+
+// VTK includes
+#include <vtkObject.h>
+
+// STD includes
+#include <map>
+#include <string>
+
+class vtkMRMLScene;
+class vtkMultiThreader;
+
+/// \brief Periodic scene autosave with incremental serialization and a
+/// background writer.
+///
+/// Serializing a large scene with vtkMRMLScene::Commit() stalls the main
+/// thread proportionally to the scene size, which rules it out for periodic
+/// autosave. This class keeps the per-node XML of the last autosave cached
+/// by node ID and MTime, so on each Autosave() call only the nodes modified
+/// since the previous save are re-serialized on the main thread; the
+/// assembled document is then written to disk by a worker thread, within an
+/// optional bandwidth budget so the disk stays responsive for interactive
+/// loads. The file is written to a temporary name and moved over the target
+/// in one rename, so a crash during the write leaves the previous autosave
+/// intact.
+///
+/// Only the scene XML is covered: bulk data (volumes, meshes) is saved by
+/// the storage nodes and cannot be snapshotted from another thread safely.
+///
+/// Typical use: create one instance, set the scene and file name, and call
+/// Autosave() from a timer. If the previous write is still in flight the
+/// call is skipped and reports false.
+class VTK_MRML_EXPORT vtkMRMLSceneAutosave : public vtkObject
+{
+public:
+  static vtkMRMLSceneAutosave *New();
+  vtkTypeMacro(vtkMRMLSceneAutosave, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  ///
+  /// The scene to save
+  vtkGetObjectMacro(Scene, vtkMRMLScene);
+  virtual void SetScene(vtkMRMLScene* scene);
+
+  ///
+  /// Target file of the autosave
+  vtkSetStringMacro(FileName);
+  vtkGetStringMacro(FileName);
+
+  ///
+  /// Maximum disk write rate of the background writer in bytes per second.
+  /// 0 (the default) writes at full speed.
+  vtkSetClampMacro(WriteBytesPerSecond, double, 0., VTK_DOUBLE_MAX);
+  vtkGetMacro(WriteBytesPerSecond, double);
+
+  ///
+  /// Serialize the scene (re-serializing only the nodes modified since the
+  /// last call) and hand the document to the background writer. Returns
+  /// false if the scene or file name is not set, or if the previous write
+  /// has not finished yet - in that case the call does nothing and the
+  /// next timer tick will try again.
+  bool Autosave();
+
+  ///
+  /// True while the background writer is flushing the last document
+  bool IsWriteInProgress();
+
+  ///
+  /// Block until the background writer is done. Called automatically on
+  /// destruction; call it explicitly before application shutdown if the
+  /// last autosave must be on disk.
+  void WaitForCompletion();
+
+  ///
+  /// How many nodes the last Autosave() re-serialized and how many it
+  /// reused from the cache, for tuning the autosave interval
+  vtkGetMacro(LastNumberOfSerializedNodes, int);
+  vtkGetMacro(LastNumberOfReusedNodes, int);
+
+protected:
+  vtkMRMLSceneAutosave();
+  virtual ~vtkMRMLSceneAutosave();
+  vtkMRMLSceneAutosave(const vtkMRMLSceneAutosave&);
+  void operator=(const vtkMRMLSceneAutosave&);
+
+  /// Build the full scene document, reusing cached node XML where the node
+  /// MTime is unchanged
+  std::string AssembleSceneXML();
+
+  /// Reap the worker thread and release the finished job, if any
+  void ReapFinishedWrite();
+
+  /// Per-node XML of the last autosave, keyed by node ID
+  struct CachedNodeXML
+    {
+    vtkMTimeType MTime;
+    std::string XML;
+    };
+  std::map<std::string, CachedNodeXML> NodeXMLCache;
+
+  vtkMRMLScene* Scene;
+  char* FileName;
+  double WriteBytesPerSecond;
+  int LastNumberOfSerializedNodes;
+  int LastNumberOfReusedNodes;
+
+  vtkMultiThreader* Threader;
+  int WriteThreadId;
+  /// Owned by this class while a write is in flight, shared with the
+  /// worker thread; concrete type is internal to the implementation
+  void* WriteJob;
+};
+
+#endif
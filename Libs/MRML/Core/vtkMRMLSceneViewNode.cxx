@@ -29,6 +29,7 @@ Version:   $Revision: 1.14 $
 
 // STD includes
 #include <cassert>
+#include <set>
 #include <sstream>
 #include <stack>
 
@@ -214,6 +215,8 @@ void vtkMRMLSceneViewNode::ProcessChildNode(vtkMRMLNode *node)
   this->SnapshotScene->GetNodes()->vtkCollection::AddItem((vtkObject *)node);
 
   this->SnapshotScene->AddNodeID(node);
+  // The node was loaded from file, it has no known capture time.
+  this->StoredNodeMTimes.erase(node->GetID() ? node->GetID() : "");
 
   node->SetScene(this->SnapshotScene);
 
@@ -243,6 +246,9 @@ void vtkMRMLSceneViewNode::Copy(vtkMRMLNode *anode)
     this->SnapshotScene->GetNodes()->RemoveAllItems();
     this->SnapshotScene->ClearNodeIDs();
     }
+  // The stored copies are replaced wholesale, the next StoreScene() must
+  // not reuse any of them.
+  this->StoredNodeMTimes.clear();
   vtkMRMLNode *node = NULL;
   if ( snode->SnapshotScene != NULL )
     {
@@ -348,11 +354,12 @@ void vtkMRMLSceneViewNode::StoreScene()
   if (this->SnapshotScene == NULL)
     {
     this->SnapshotScene = vtkMRMLScene::New();
+    this->StoredNodeMTimes.clear();
     }
-  else
-    {
-    this->SnapshotScene->Clear(1);
-    }
+  // The snapshot scene is not cleared here: nodes that have not been
+  // modified since the previous capture are kept as-is (their bulk data is
+  // shared with the main scene nodes by pipeline connection anyway), so a
+  // repeated capture only pays for the nodes that actually changed.
 
   if (this->GetScene())
     {
@@ -391,26 +398,70 @@ void vtkMRMLSceneViewNode::StoreScene()
 
   /// \todo: GetNumberOfNodes/GetNthNode is slow, fasten by using collection
   /// iterators.
+  std::set<std::string> capturedNodeIDs;
   for (int n=0; n < this->Scene->GetNumberOfNodes(); n++)
     {
     vtkMRMLNode *node = this->Scene->GetNthNode(n);
     if (this->IncludeNodeInSceneView(node) &&
         node->GetSaveWithScene() )
       {
-      vtkSmartPointer<vtkMRMLNode> newNode = vtkSmartPointer<vtkMRMLNode>::Take(node->CreateNodeInstance());
+      capturedNodeIDs.insert(node->GetID());
 
-      newNode->SetScene(this->SnapshotScene);
-      newNode->CopyWithoutModifiedEvent(node);
-      newNode->SetID(node->GetID());
+      vtkMRMLNode* storedNode = this->SnapshotScene->GetNodeByID(node->GetID());
+      if (storedNode && strcmp(storedNode->GetClassName(), node->GetClassName()) != 0)
+        {
+        // The node ID has been reused for a node of a different class,
+        // the stored copy cannot be updated in place.
+        this->SnapshotScene->RemoveNode(storedNode);
+        storedNode = NULL;
+        }
 
-      newNode->SetAddToSceneNoModify(1);
-      this->SnapshotScene->AddNode(newNode);
-      newNode->SetAddToSceneNoModify(0);
+      std::map<std::string, vtkMTimeType>::iterator storedMTimeIt =
+        this->StoredNodeMTimes.find(node->GetID());
+      if (storedNode && storedMTimeIt != this->StoredNodeMTimes.end()
+        && node->GetMTime() <= storedMTimeIt->second)
+        {
+        // The node has not been modified since the previous capture,
+        // the stored copy is still valid.
+        continue;
+        }
 
-      // sanity check
-      assert(newNode->GetScene() == this->SnapshotScene);
+      if (storedNode)
+        {
+        storedNode->CopyWithoutModifiedEvent(node);
+        }
+      else
+        {
+        vtkSmartPointer<vtkMRMLNode> newNode = vtkSmartPointer<vtkMRMLNode>::Take(node->CreateNodeInstance());
+
+        newNode->SetScene(this->SnapshotScene);
+        newNode->CopyWithoutModifiedEvent(node);
+        newNode->SetID(node->GetID());
+
+        newNode->SetAddToSceneNoModify(1);
+        this->SnapshotScene->AddNode(newNode);
+        newNode->SetAddToSceneNoModify(0);
+
+        // sanity check
+        assert(newNode->GetScene() == this->SnapshotScene);
+        }
+      this->StoredNodeMTimes[node->GetID()] = node->GetMTime();
       }
     }
+
+  // Remove stored nodes that no longer have a counterpart in the main scene.
+  std::vector<vtkMRMLNode*> storedNodes;
+  this->SnapshotScene->GetNodesByClass("vtkMRMLNode", storedNodes);
+  for (std::vector<vtkMRMLNode*>::iterator storedNodeIt = storedNodes.begin();
+       storedNodeIt != storedNodes.end(); ++storedNodeIt)
+    {
+    if (capturedNodeIDs.find((*storedNodeIt)->GetID()) == capturedNodeIDs.end())
+      {
+      this->StoredNodeMTimes.erase((*storedNodeIt)->GetID());
+      this->SnapshotScene->RemoveNode(*storedNodeIt);
+      }
+    }
+
   this->SnapshotScene->CopyNodeReferences(this->GetScene());
   this->SnapshotScene->CopyNodeChangedIDs(this->GetScene());
 }
@@ -592,8 +643,22 @@ void vtkMRMLSceneViewNode::RestoreScene(bool removeNodes)
         if (snode)
           {
           snode->SetScene(this->Scene);
-          // to prevent copying of default info if not stored in snapshot
-          snode->CopyWithSingleModifiedEvent(node);
+          std::map<std::string, vtkMTimeType>::iterator storedMTimeIt =
+            this->StoredNodeMTimes.find(node->GetID());
+          if (storedMTimeIt != this->StoredNodeMTimes.end() &&
+              snode->GetMTime() <= storedMTimeIt->second)
+            {
+            // The scene node has not been modified since it was last in sync
+            // with the stored copy, so there is nothing to restore and its
+            // observers (widgets, displayable managers) need not be notified.
+            }
+          else
+            {
+            // to prevent copying of default info if not stored in snapshot
+            snode->CopyWithSingleModifiedEvent(node);
+            // the scene node is now in sync with the stored copy again
+            this->StoredNodeMTimes[node->GetID()] = snode->GetMTime();
+            }
           // to prevent reading data on UpdateScene()
           snode->SetAddToSceneNoModify(0);
           }
@@ -605,6 +670,7 @@ void vtkMRMLSceneViewNode::RestoreScene(bool removeNodes)
           addedNodes.push_back(newNode);
           newNode->SetAddToSceneNoModify(1);
           this->Scene->AddNode(newNode);
+          this->StoredNodeMTimes[newNode->GetID() ? newNode->GetID() : ""] = newNode->GetMTime();
           newNode->Delete();
 
           // to prevent reading data on UpdateScene()
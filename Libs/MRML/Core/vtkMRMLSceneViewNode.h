@@ -22,6 +22,10 @@
 class vtkCollection;
 class vtkImageData;
 
+// STD includes
+#include <map>
+#include <string>
+
 class vtkMRMLStorageNode;
 class VTK_MRML_EXPORT vtkMRMLSceneViewNode : public vtkMRMLStorableNode
 {
@@ -137,6 +141,14 @@ protected:
 
   vtkMRMLScene* SnapshotScene;
 
+  /// MTime of each main scene node at the time it was last in sync with
+  /// its stored copy (captured or restored), by node ID. Used by
+  /// StoreScene() to reuse the stored copy of nodes that have not been
+  /// modified since the previous capture, and by RestoreScene() to leave
+  /// nodes that have not diverged from the stored state untouched instead
+  /// of copying into (and re-notifying the observers of) every node.
+  std::map<std::string, vtkMTimeType> StoredNodeMTimes;
+
   /// The associated Description
   vtkStdString SceneViewDescription;
 
@@ -524,10 +524,28 @@ void vtkMRMLSegmentationDisplayNode::SetAllSegmentsVisibility(bool visible)
 {
   std::vector<std::string> segmentIDs;
   this->GetSegmentIDs(segmentIDs, false);
+  int wasModifying = this->StartModify();
   for (std::vector<std::string>::iterator segmentIDIt = segmentIDs.begin(); segmentIDIt != segmentIDs.end(); ++segmentIDIt)
     {
     this->SetSegmentVisibility(*segmentIDIt, visible);
     }
+  this->EndModify(wasModifying);
+}
+
+//---------------------------------------------------------------------------
+void vtkMRMLSegmentationDisplayNode::SetSegmentsVisibility(vtkStringArray* segmentIDs, bool visible)
+{
+  if (!segmentIDs)
+    {
+    vtkErrorMacro("SetSegmentsVisibility: invalid segment ID list");
+    return;
+    }
+  int wasModifying = this->StartModify();
+  for (vtkIdType segmentIndex = 0; segmentIndex < segmentIDs->GetNumberOfValues(); ++segmentIndex)
+    {
+    this->SetSegmentVisibility(segmentIDs->GetValue(segmentIndex), visible);
+    }
+  this->EndModify(wasModifying);
 }
 
 //---------------------------------------------------------------------------
@@ -557,10 +575,12 @@ void vtkMRMLSegmentationDisplayNode::SetAllSegmentsVisibility3D(bool visible, bo
 {
   std::vector<std::string> segmentIDs;
   this->GetSegmentIDs(segmentIDs, changeVisibleSegmentsOnly);
+  int wasModifying = this->StartModify();
   for (std::vector<std::string>::iterator segmentIDIt = segmentIDs.begin(); segmentIDIt != segmentIDs.end(); ++segmentIDIt)
     {
     this->SetSegmentVisibility3D(*segmentIDIt, visible);
     }
+  this->EndModify(wasModifying);
 }
 
 //---------------------------------------------------------------------------
@@ -590,10 +610,12 @@ void vtkMRMLSegmentationDisplayNode::SetAllSegmentsVisibility2DFill(bool visible
 {
   std::vector<std::string> segmentIDs;
   this->GetSegmentIDs(segmentIDs, changeVisibleSegmentsOnly);
+  int wasModifying = this->StartModify();
   for (std::vector<std::string>::iterator segmentIDIt = segmentIDs.begin(); segmentIDIt != segmentIDs.end(); ++segmentIDIt)
     {
     this->SetSegmentVisibility2DFill(*segmentIDIt, visible);
     }
+  this->EndModify(wasModifying);
 }
 
 //---------------------------------------------------------------------------
@@ -623,10 +645,12 @@ void vtkMRMLSegmentationDisplayNode::SetAllSegmentsVisibility2DOutline(bool visi
 {
   std::vector<std::string> segmentIDs;
   this->GetSegmentIDs(segmentIDs, changeVisibleSegmentsOnly);
+  int wasModifying = this->StartModify();
   for (std::vector<std::string>::iterator segmentIDIt = segmentIDs.begin(); segmentIDIt != segmentIDs.end(); ++segmentIDIt)
     {
     this->SetSegmentVisibility2DOutline(*segmentIDIt, visible);
     }
+  this->EndModify(wasModifying);
 }
 
 //---------------------------------------------------------------------------
@@ -656,10 +680,12 @@ void vtkMRMLSegmentationDisplayNode::SetAllSegmentsOpacity3D(double opacity, boo
 {
   std::vector<std::string> segmentIDs;
   this->GetSegmentIDs(segmentIDs, changeVisibleSegmentsOnly);
+  int wasModifying = this->StartModify();
   for (std::vector<std::string>::iterator segmentIDIt = segmentIDs.begin(); segmentIDIt != segmentIDs.end(); ++segmentIDIt)
     {
     this->SetSegmentOpacity3D(*segmentIDIt, opacity);
     }
+  this->EndModify(wasModifying);
 }
 
 //---------------------------------------------------------------------------
@@ -690,10 +716,12 @@ void vtkMRMLSegmentationDisplayNode::SetAllSegmentsOpacity2DFill(double opacity,
 {
   std::vector<std::string> segmentIDs;
   this->GetSegmentIDs(segmentIDs, changeVisibleSegmentsOnly);
+  int wasModifying = this->StartModify();
   for (std::vector<std::string>::iterator segmentIDIt = segmentIDs.begin(); segmentIDIt != segmentIDs.end(); ++segmentIDIt)
     {
     this->SetSegmentOpacity2DFill(*segmentIDIt, opacity);
     }
+  this->EndModify(wasModifying);
 }
 
 //---------------------------------------------------------------------------
@@ -724,10 +752,12 @@ void vtkMRMLSegmentationDisplayNode::SetAllSegmentsOpacity2DOutline(double opaci
 {
   std::vector<std::string> segmentIDs;
   this->GetSegmentIDs(segmentIDs, changeVisibleSegmentsOnly);
+  int wasModifying = this->StartModify();
   for (std::vector<std::string>::iterator segmentIDIt = segmentIDs.begin(); segmentIDIt != segmentIDs.end(); ++segmentIDIt)
     {
     this->SetSegmentOpacity2DOutline(*segmentIDIt, opacity);
     }
+  this->EndModify(wasModifying);
 }
 
 //---------------------------------------------------------------------------
@@ -746,10 +776,12 @@ void vtkMRMLSegmentationDisplayNode::SetAllSegmentsOpacity(double opacity, bool
 {
   std::vector<std::string> segmentIDs;
   this->GetSegmentIDs(segmentIDs, changeVisibleSegmentsOnly);
+  int wasModifying = this->StartModify();
   for (std::vector<std::string>::iterator segmentIDIt = segmentIDs.begin(); segmentIDIt != segmentIDs.end(); ++segmentIDIt)
     {
     this->SetSegmentOpacity(*segmentIDIt, opacity);
     }
+  this->EndModify(wasModifying);
 }
 
 //---------------------------------------------------------------------------
@@ -210,6 +210,11 @@ public:
   /// Set overall segment visibility by segment ID. Convenience function for python compatibility.
   void SetSegmentVisibility(std::string segmentID, bool visible);
   void SetAllSegmentsVisibility(bool visible);
+  /// Set overall visibility of the listed segments in a single call.
+  /// The per-segment modification events are compressed into one
+  /// (\sa StartModify, \sa EndModify), so displayable managers update
+  /// once for the whole batch instead of once per segment.
+  void SetSegmentsVisibility(vtkStringArray* segmentIDs, bool visible);
 
   /// Get segment 3D visibility by segment ID. Convenience function for python compatibility.
   /// \return Segment 3D visibility if segment found, otherwise false
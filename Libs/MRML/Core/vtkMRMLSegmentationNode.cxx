@@ -65,6 +65,8 @@ vtkMRMLSegmentationNode::vtkMRMLSegmentationNode()
   this->SegmentationModifiedCallbackCommand->SetClientData(reinterpret_cast<void *>(this));
   this->SegmentationModifiedCallbackCommand->SetCallback(vtkMRMLSegmentationNode::SegmentationModifiedCallback);
 
+  this->CopyBaselineSegmentation = NULL;
+
   // Create empty segmentations object
   this->Segmentation = NULL;
   vtkSmartPointer<vtkSegmentation> segmentation = vtkSmartPointer<vtkSegmentation>::New();
@@ -129,8 +131,17 @@ void vtkMRMLSegmentationNode::Copy(vtkMRMLNode *anode)
       vtkSmartPointer<vtkSegmentation> segmentation = vtkSmartPointer<vtkSegmentation>::New();
       this->SetAndObserveSegmentation(segmentation);
       }
-    // Deep copy segmentation (containing the same segments from two segmentations is unstable)
-    this->Segmentation->DeepCopy(otherNode->GetSegmentation());
+    // Deep copy segmentation (containing the same segments from two segmentations is unstable).
+    // If a baseline is set (undo checkpoint), representations that are
+    // unmodified since the baseline capture are shared with it instead.
+    if (this->CopyBaselineSegmentation)
+      {
+      this->Segmentation->DeepCopyWithBaseline(otherNode->GetSegmentation(), this->CopyBaselineSegmentation);
+      }
+    else
+      {
+      this->Segmentation->DeepCopy(otherNode->GetSegmentation());
+      }
     }
   else
     {
@@ -146,6 +157,14 @@ void vtkMRMLSegmentationNode::DeepCopy(vtkMRMLNode* aNode)
   Copy(aNode);
 }
 
+//----------------------------------------------------------------------------
+void vtkMRMLSegmentationNode::CopyWithSceneWithBaseline(vtkMRMLNode* node, vtkMRMLSegmentationNode* baselineNode)
+{
+  this->CopyBaselineSegmentation = baselineNode ? baselineNode->GetSegmentation() : NULL;
+  this->CopyWithScene(node);
+  this->CopyBaselineSegmentation = NULL;
+}
+
 //----------------------------------------------------------------------------
 void vtkMRMLSegmentationNode::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -199,6 +218,12 @@ void vtkMRMLSegmentationNode::SetAndObserveSegmentation(vtkSegmentation* segment
   }
 }
 
+//---------------------------------------------------------------------------
+unsigned long vtkMRMLSegmentationNode::GetBulkDataActualMemorySize()
+{
+  return this->Segmentation ? this->Segmentation->GetActualMemorySize() : 0;
+}
+
 //---------------------------------------------------------------------------
 void vtkMRMLSegmentationNode::SegmentationModifiedCallback(vtkObject* vtkNotUsed(caller), unsigned long eid, void* clientData, void* callData)
 {
@@ -542,7 +567,8 @@ bool vtkMRMLSegmentationNode::GenerateMergedLabelmap(
       mergedImageToWorldMatrix->Identity();
       return true;
       }
-    vtkSegmentationConverter::DeserializeImageGeometry(commonGeometryString, commonGeometryImage);
+    // Only geometry and extent of this image are used below, do not allocate voxels
+    vtkSegmentationConverter::DeserializeImageGeometry(commonGeometryString, commonGeometryImage, false /* do not allocate scalars */);
     }
   commonGeometryImage->GetImageToWorldMatrix(mergedImageToWorldMatrix);
   int referenceDimensions[3] = {0,0,0};
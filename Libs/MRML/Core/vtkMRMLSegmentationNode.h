@@ -73,6 +73,14 @@ public:
   /// Copy the entire contents of the node into this node
   virtual void DeepCopy(vtkMRMLNode* node);
 
+  /// Same as CopyWithScene(), but segments whose representations have not
+  /// been modified since \a baselineNode was captured share their
+  /// representation data objects with the baseline copy instead of being
+  /// deep-copied. Used by the scene undo stack to keep the cost of a
+  /// segmentation undo checkpoint proportional to the edited segments.
+  /// \sa vtkSegmentation::DeepCopyWithBaseline()
+  void CopyWithSceneWithBaseline(vtkMRMLNode* node, vtkMRMLSegmentationNode* baselineNode);
+
   /// Get unique node XML tag name (like Volume, Model)
   virtual const char* GetNodeTagName() VTK_OVERRIDE {return "Segmentation";};
 
@@ -152,6 +160,10 @@ public:
   /// Set and observe segmentation object
   void SetAndObserveSegmentation(vtkSegmentation* segmentation);
 
+  /// Size of all representations of all segments in kibibytes.
+  /// \sa vtkSegmentation::GetActualMemorySize()
+  virtual unsigned long GetBulkDataActualMemorySize() VTK_OVERRIDE;
+
   // Convenience functions for commonly needed features
 
   /// Change master representation. All other representations are automatically computed
@@ -231,6 +243,11 @@ protected:
   /// Segmentation object to store the actual data
   vtkSegmentation* Segmentation;
 
+  /// Baseline segmentation that Copy() may share unmodified representation
+  /// data with. Only set for the duration of CopyWithSceneWithBaseline(),
+  /// not owned by this node.
+  vtkSegmentation* CopyBaselineSegmentation;
+
   /// Command handling events from segmentation object
   vtkSmartPointer<vtkCallbackCommand> SegmentationModifiedCallbackCommand;
 };
@@ -91,6 +91,18 @@ public:
   vtkGetMacro(UseCompression, int);
   vtkSetMacro(UseCompression, int);
 
+  ///
+  /// Defer reading of bulk data until it is first accessed.
+  /// When enabled, storage nodes that support it (\sa
+  /// vtkMRMLVolumeArchetypeStorageNode) read only the header and geometry
+  /// in ReadData() and mark the data node as pending; the data node then
+  /// requests the full read on the first access to its bulk data.
+  /// This is a runtime option of the reading application and is not
+  /// stored in the scene. Off by default.
+  vtkBooleanMacro(LazyLoading, int);
+  vtkGetMacro(LazyLoading, int);
+  vtkSetMacro(LazyLoading, int);
+
   ///
   /// Location of the remote copy of this file.
   vtkSetStringMacro(URI);
@@ -333,6 +345,7 @@ protected:
   char *URI;
   vtkURIHandler *URIHandler;
   int UseCompression;
+  int LazyLoading;
   int ReadState;
   int WriteState;
 
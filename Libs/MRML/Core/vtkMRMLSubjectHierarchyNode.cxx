@@ -30,10 +30,13 @@
 #include "vtkMRMLTransformNode.h"
 
 // VTK includes
+#include <vtkBoundingBox.h>
 #include <vtkCollection.h>
+#include <vtkMath.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
 #include <vtkSmartPointer.h>
+#include <vtkStringArray.h>
 #include <vtkWeakPointer.h>
 #include <vtkCallbackCommand.h>
 
@@ -107,6 +110,12 @@ public:
   /// It can be static as the item IDs are unique in one application session.
   static std::map<vtkIdType, vtkSubjectHierarchyItem*> ItemCache;
 
+  /// Item cache to speed up lookup by associated data node, which is performed each time
+  /// a data node is modified (and so would traverse the whole tree for each event otherwise).
+  /// It can be static for the same reason as \sa ItemCache. Entries are verified against the
+  /// item's data node pointer on lookup, so a stale entry can never be returned.
+  static std::map<vtkMRMLNode*, vtkSubjectHierarchyItem*> DataNodeCache;
+
 // Get/set functions
 public:
   /// Add data item to tree under parent, specifying basic properties
@@ -249,6 +258,8 @@ vtkIdType vtkSubjectHierarchyItem::NextSubjectHierarchyItemID = vtkMRMLSubjectHi
 
 std::map<vtkIdType, vtkSubjectHierarchyItem*> vtkSubjectHierarchyItem::ItemCache = std::map<vtkIdType, vtkSubjectHierarchyItem*>();
 
+std::map<vtkMRMLNode*, vtkSubjectHierarchyItem*> vtkSubjectHierarchyItem::DataNodeCache = std::map<vtkMRMLNode*, vtkSubjectHierarchyItem*>();
+
 //---------------------------------------------------------------------------
 // vtkSubjectHierarchyItem methods
 
@@ -301,8 +312,12 @@ vtkIdType vtkSubjectHierarchyItem::AddToTree(vtkSubjectHierarchyItem* parent, vt
     vtkSmartPointer<vtkSubjectHierarchyItem> childPointer(this);
     this->Parent->Children.push_back(childPointer);
 
-    // Add to cache
+    // Add to caches
     vtkSubjectHierarchyItem::ItemCache[this->ID] = this;
+    if (dataNode)
+      {
+      vtkSubjectHierarchyItem::DataNodeCache[dataNode] = this;
+      }
     }
   else
     {
@@ -747,12 +762,28 @@ vtkSubjectHierarchyItem* vtkSubjectHierarchyItem::FindChildByDataNode(vtkMRMLNod
     return NULL;
     }
 
+  // Try to find item in cache
+  std::map<vtkMRMLNode*, vtkSubjectHierarchyItem*>::iterator cacheIt = vtkSubjectHierarchyItem::DataNodeCache.find(dataNode);
+  if (cacheIt != vtkSubjectHierarchyItem::DataNodeCache.end())
+    {
+    if (dataNode == cacheIt->second->DataNode.GetPointer())
+      {
+      return cacheIt->second;
+      }
+    // Remove stale cache entry (the data node it was created for has since been deleted,
+    // and a new node was allocated at the same address)
+    vtkSubjectHierarchyItem::DataNodeCache.erase(cacheIt);
+    }
+
+  // On failure to look up in cache, traverse tree to find item
   ChildVector::iterator childIt;
   for (childIt=this->Children.begin(); childIt!=this->Children.end(); ++childIt)
     {
     vtkSubjectHierarchyItem* currentItem = childIt->GetPointer();
     if (dataNode == currentItem->DataNode.GetPointer())
       {
+      // Add to cache so that subsequent lookups for the same data node are fast
+      vtkSubjectHierarchyItem::DataNodeCache[dataNode] = currentItem;
       return currentItem;
       }
     if (recursive)
@@ -1115,8 +1146,12 @@ bool vtkSubjectHierarchyItem::RemoveChild(vtkSubjectHierarchyItem* item)
   // Reparent children to parent node (to avoid them becoming orphans and thus lost to the hierarchy)
   removedItem->ReparentChildrenToParent();
 
-  // Remove from cache
+  // Remove from caches
   vtkSubjectHierarchyItem::ItemCache.erase(removedItem->ID);
+  if (removedItem->DataNode.GetPointer())
+    {
+    vtkSubjectHierarchyItem::DataNodeCache.erase(removedItem->DataNode.GetPointer());
+    }
 
   // Invoke events
   this->InvokeEvent(vtkMRMLSubjectHierarchyNode::SubjectHierarchyItemRemovedEvent, item);
@@ -1159,8 +1194,12 @@ bool vtkSubjectHierarchyItem::RemoveChild(vtkIdType itemID)
   // Reparent children to parent node (to avoid them becoming orphans and thus lost to the hierarchy)
   removedItem->ReparentChildrenToParent();
 
-  // Remove from cache
+  // Remove from caches
   vtkSubjectHierarchyItem::ItemCache.erase(removedItem->ID);
+  if (removedItem->DataNode.GetPointer())
+    {
+    vtkSubjectHierarchyItem::DataNodeCache.erase(removedItem->DataNode.GetPointer());
+    }
 
   // Invoke events
   this->InvokeEvent(vtkMRMLSubjectHierarchyNode::SubjectHierarchyItemRemovedEvent, removedItem.GetPointer());
@@ -1449,6 +1488,13 @@ public:
   /// Flag indicating whether resolving unresolved items is underway (after scene import or restore)
   bool IsResolving;
 
+  /// Depth of nested item modified event batches \sa StartItemModifiedEventBatch.
+  /// While non-zero, item modified events are collected in \sa BatchedModifiedItemIDs
+  /// instead of being invoked immediately
+  int ItemModifiedEventBatchLevel;
+  /// Unique IDs of the items that were modified during the current event batch
+  std::set<vtkIdType> BatchedModifiedItemIDs;
+
 private:
   vtkMRMLSubjectHierarchyNode* External;
 };
@@ -1460,6 +1506,7 @@ private:
 vtkMRMLSubjectHierarchyNode::vtkInternal::vtkInternal(vtkMRMLSubjectHierarchyNode* external)
 : EventsDisabled(false)
 , IsResolving(false)
+, ItemModifiedEventBatchLevel(0)
 , External(external)
 {
   // Create scene item
@@ -1882,7 +1929,7 @@ void vtkMRMLSubjectHierarchyNode::SetItemName(vtkIdType itemID, std::string name
 
   if (nameChanged)
     {
-    this->InvokeCustomModifiedEvent(SubjectHierarchyItemModifiedEvent, (void*)&itemID);
+    this->InvokeItemModifiedEvent(itemID);
     }
 }
 
@@ -1941,7 +1988,7 @@ void vtkMRMLSubjectHierarchyNode::SetItemOwnerPluginName(vtkIdType itemID, std::
   if (item->OwnerPluginName.compare(ownerPluginName))
     {
     item->OwnerPluginName = ownerPluginName;
-    this->InvokeCustomModifiedEvent(SubjectHierarchyItemModifiedEvent, (void*)&itemID);
+    this->InvokeItemModifiedEvent(itemID);
     }
 }
 
@@ -1971,7 +2018,7 @@ void vtkMRMLSubjectHierarchyNode::SetItemExpanded(vtkIdType itemID, bool expande
   if (item->Expanded != expanded)
     {
     item->Expanded = expanded;
-    this->InvokeCustomModifiedEvent(SubjectHierarchyItemModifiedEvent, (void*)&itemID);
+    this->InvokeItemModifiedEvent(itemID);
     }
 }
 
@@ -2052,6 +2099,36 @@ void vtkMRMLSubjectHierarchyNode::SetItemAttribute(vtkIdType itemID, std::string
   item->SetAttribute(attributeName, attributeValue); // Events are invoked within this call
 }
 
+//----------------------------------------------------------------------------
+void vtkMRMLSubjectHierarchyNode::SetItemAttributes(vtkIdType itemID, vtkStringArray* attributeNames, vtkStringArray* attributeValues)
+{
+  if (!attributeNames || !attributeValues)
+    {
+    vtkErrorMacro("SetItemAttributes: Invalid attribute name or value array");
+    return;
+    }
+  if (attributeNames->GetNumberOfValues() != attributeValues->GetNumberOfValues())
+    {
+    vtkErrorMacro("SetItemAttributes: Attribute name and value arrays contain different number of values ("
+      << attributeNames->GetNumberOfValues() << " and " << attributeValues->GetNumberOfValues() << ")");
+    return;
+    }
+  vtkSubjectHierarchyItem* item = this->Internal->FindItemByID(itemID);
+  if (!item)
+    {
+    vtkErrorMacro("SetItemAttributes: Failed to find subject hierarchy item by ID " << itemID);
+    return;
+    }
+
+  // Collapse the per-attribute modified events into a single one for the item
+  this->StartItemModifiedEventBatch();
+  for (vtkIdType attributeIndex = 0; attributeIndex < attributeNames->GetNumberOfValues(); ++attributeIndex)
+    {
+    item->SetAttribute(attributeNames->GetValue(attributeIndex), attributeValues->GetValue(attributeIndex));
+    }
+  this->EndItemModifiedEventBatch();
+}
+
 //---------------------------------------------------------------------------
 bool vtkMRMLSubjectHierarchyNode::RemoveItemAttribute(vtkIdType itemID, std::string attributeName)
 {
@@ -2117,6 +2194,49 @@ void vtkMRMLSubjectHierarchyNode::ItemModified(vtkIdType itemID)
     }
 
   // Invoke the node event directly, thus saving an extra callback round
+  this->InvokeItemModifiedEvent(itemID);
+}
+
+//---------------------------------------------------------------------------
+void vtkMRMLSubjectHierarchyNode::StartItemModifiedEventBatch()
+{
+  this->Internal->ItemModifiedEventBatchLevel++;
+}
+
+//---------------------------------------------------------------------------
+void vtkMRMLSubjectHierarchyNode::EndItemModifiedEventBatch()
+{
+  if (this->Internal->ItemModifiedEventBatchLevel <= 0)
+    {
+    vtkErrorMacro("EndItemModifiedEventBatch: Mismatched call, no event batch is in progress");
+    return;
+    }
+  if (--this->Internal->ItemModifiedEventBatchLevel > 0)
+    {
+    // Events are invoked when the outermost batch ends
+    return;
+    }
+
+  // Invoke one modified event per item that was modified during the batch, duplicates collapsed.
+  // Copy and clear the collected IDs first so that observers modifying items do not interfere
+  std::set<vtkIdType> modifiedItemIDs(this->Internal->BatchedModifiedItemIDs);
+  this->Internal->BatchedModifiedItemIDs.clear();
+  for (std::set<vtkIdType>::iterator itemIt=modifiedItemIDs.begin(); itemIt!=modifiedItemIDs.end(); ++itemIt)
+    {
+    vtkIdType itemID = (*itemIt);
+    this->InvokeCustomModifiedEvent(SubjectHierarchyItemModifiedEvent, (void*)&itemID);
+    }
+}
+
+//---------------------------------------------------------------------------
+void vtkMRMLSubjectHierarchyNode::InvokeItemModifiedEvent(vtkIdType itemID)
+{
+  if (this->Internal->ItemModifiedEventBatchLevel > 0)
+    {
+    // Within a batch only collect the modified item IDs \sa StartItemModifiedEventBatch
+    this->Internal->BatchedModifiedItemIDs.insert(itemID);
+    return;
+    }
   this->InvokeCustomModifiedEvent(SubjectHierarchyItemModifiedEvent, (void*)&itemID);
 }
 
@@ -2613,6 +2733,38 @@ vtkMRMLNode* vtkMRMLSubjectHierarchyNode::GetParentDataNode(vtkMRMLNode* dataNod
   return parentDataNode;
 }
 
+//---------------------------------------------------------------------------
+void vtkMRMLSubjectHierarchyNode::GetRASBoundsForBranch(vtkIdType itemID, double bounds[6])
+{
+  vtkMath::UninitializeBounds(bounds);
+
+  // Get all child displayable nodes for branch
+  vtkNew<vtkCollection> childDisplayableNodes;
+  this->GetDataNodesInBranch(itemID, childDisplayableNodes.GetPointer(), "vtkMRMLDisplayableNode");
+
+  vtkBoundingBox boundingBox;
+  childDisplayableNodes->InitTraversal();
+  for (int childNodeIndex = 0; childNodeIndex < childDisplayableNodes->GetNumberOfItems(); ++childNodeIndex)
+    {
+    vtkMRMLDisplayableNode* displayableNode =
+      vtkMRMLDisplayableNode::SafeDownCast(childDisplayableNodes->GetItemAsObject(childNodeIndex));
+    if (!displayableNode)
+      {
+      continue;
+      }
+    double nodeBounds[6];
+    displayableNode->GetRASBounds(nodeBounds);
+    if (vtkMath::AreBoundsInitialized(nodeBounds))
+      {
+      boundingBox.AddBounds(nodeBounds);
+      }
+    }
+  if (boundingBox.IsValid())
+    {
+    boundingBox.GetBounds(bounds);
+    }
+}
+
 //---------------------------------------------------------------------------
 void vtkMRMLSubjectHierarchyNode::SetDisplayVisibilityForBranch(vtkIdType itemID, int visible)
 {
@@ -2631,6 +2783,9 @@ void vtkMRMLSubjectHierarchyNode::SetDisplayVisibilityForBranch(vtkIdType itemID
   vtkNew<vtkCollection> childDisplayableNodes;
   this->GetDataNodesInBranch(itemID, childDisplayableNodes.GetPointer(), "vtkMRMLDisplayableNode");
 
+  // Collect item modified events for the branch and invoke each of them only once at the end
+  this->StartItemModifiedEventBatch();
+
   childDisplayableNodes->InitTraversal();
   std::set<vtkIdType> parentItems;
   for (int childNodeIndex = 0; childNodeIndex < childDisplayableNodes->GetNumberOfItems(); ++childNodeIndex)
@@ -2681,6 +2836,8 @@ void vtkMRMLSubjectHierarchyNode::SetDisplayVisibilityForBranch(vtkIdType itemID
     {
     this->ItemModified((*parentIt));
     }
+
+  this->EndItemModifiedEventBatch();
 }
 
 //---------------------------------------------------------------------------
@@ -3109,7 +3266,7 @@ void vtkMRMLSubjectHierarchyNode::ItemEventCallback(vtkObject* caller, unsigned
       if (item)
         {
         // Propagate item modified event
-        self->InvokeCustomModifiedEvent(vtkMRMLSubjectHierarchyNode::SubjectHierarchyItemModifiedEvent, (void*)&item->ID);
+        self->InvokeItemModifiedEvent(item->ID);
         self->Modified(); // Indicate that the content of the subject hierarchy node has changed, so it needs to be saved
         }
       else if (dataNode)
@@ -3118,7 +3275,7 @@ void vtkMRMLSubjectHierarchyNode::ItemEventCallback(vtkObject* caller, unsigned
         vtkIdType itemID = self->GetItemByDataNode(dataNode);
         if (itemID != vtkMRMLSubjectHierarchyNode::INVALID_ITEM_ID)
           {
-          self->InvokeCustomModifiedEvent(vtkMRMLSubjectHierarchyNode::SubjectHierarchyItemModifiedEvent, (void*)&itemID);
+          self->InvokeItemModifiedEvent(itemID);
           }
         }
       }
@@ -3134,7 +3291,7 @@ void vtkMRMLSubjectHierarchyNode::ItemEventCallback(vtkObject* caller, unsigned
         vtkIdType itemID = self->GetItemByDataNode(dataNode);
         if (itemID != vtkMRMLSubjectHierarchyNode::INVALID_ITEM_ID)
           {
-          self->InvokeCustomModifiedEvent(vtkMRMLSubjectHierarchyNode::SubjectHierarchyItemModifiedEvent, (void*)&itemID);
+          self->InvokeItemModifiedEvent(itemID);
           }
         }
       }
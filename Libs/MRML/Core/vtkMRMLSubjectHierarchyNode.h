@@ -34,6 +34,7 @@
 
 class vtkCallbackCommand;
 class vtkMRMLTransformNode;
+class vtkStringArray;
 
 /// \ingroup Slicer_MRML_Core
 /// \brief MRML node to represent a complete subject hierarchy tree
@@ -139,6 +140,12 @@ public:
 
   /// Add attribute to the subject hierarchy item
   void SetItemAttribute(vtkIdType itemID, std::string attributeName, std::string attributeValue);
+  /// Add several attributes to the subject hierarchy item in one call: the i-th name is set
+  /// to the i-th value. The two arrays must contain the same number of values.
+  /// A single item modified event is invoked for the whole batch instead of one per attribute
+  /// (\sa StartItemModifiedEventBatch), so filling many attributes (e.g. tag metadata during
+  /// DICOM import) triggers only one view update for the item.
+  void SetItemAttributes(vtkIdType itemID, vtkStringArray* attributeNames, vtkStringArray* attributeValues);
   /// Remove attribute from subject hierarchy item
   /// \return True if attribute was removed, false if item or attribute is not found
   bool RemoveItemAttribute(vtkIdType itemID, std::string attributeName);
@@ -157,6 +164,16 @@ public:
   /// changes that does not originate in the subject hierarchy item (such as visibility or transform of data node)
   void ItemModified(vtkIdType itemID);
 
+  /// Start collecting item modified events instead of invoking them immediately.
+  /// Useful when modifying many items in a loop, to prevent a per-item view update for each
+  /// modification. Until the matching \sa EndItemModifiedEventBatch call only the modified item
+  /// IDs are recorded, then one event is invoked per modified item with duplicates collapsed.
+  /// Batches can be nested, events are invoked when the outermost batch ends.
+  void StartItemModifiedEventBatch();
+  /// Stop collecting item modified events and invoke one event for each item that was modified
+  /// during the batch \sa StartItemModifiedEventBatch
+  void EndItemModifiedEventBatch();
+
   /// Invoke SubjectHierarchyItemOwnerPluginSearchRequested event for the item, which results in a search for owner plugin.
   /// Typically called after setting an attribute indicating a desired role for the item.
   void RequestOwnerPluginSearch(vtkIdType itemID);
@@ -287,6 +304,14 @@ public:
   /// Set subject hierarchy branch visibility
   void SetDisplayVisibilityForBranch(vtkIdType itemID, int visible);
 
+  /// Get the bounding box of a subject hierarchy branch in world (RAS)
+  /// coordinates, as the union of the RAS bounds of every displayable data
+  /// node in the branch. Bounds are uninitialized (min>max) if the branch
+  /// contains no displayable node with valid bounds. The per-node bounds
+  /// are memoized by the nodes themselves, so this is cheap enough to call
+  /// repeatedly, e.g. when fitting views to a branch.
+  void GetRASBoundsForBranch(vtkIdType itemID, double bounds[6]);
+
   /// Get subject hierarchy branch visibility
   /// \return Visibility value (0:Hidden, 1:Visible, 2:PartiallyVisible, -1:NotDisplayable)
   int GetDisplayVisibilityForBranch(vtkIdType itemID);
@@ -355,6 +380,10 @@ protected:
   /// Callback function for all events from the subject hierarchy items
   static void ItemEventCallback(vtkObject* caller, unsigned long eid, void* clientData, void* callData);
 
+  /// Invoke \sa SubjectHierarchyItemModifiedEvent for an item, or record the item ID if an event
+  /// batch is in progress \sa StartItemModifiedEventBatch
+  void InvokeItemModifiedEvent(vtkIdType itemID);
+
 protected:
   vtkMRMLSubjectHierarchyNode();
   ~vtkMRMLSubjectHierarchyNode();
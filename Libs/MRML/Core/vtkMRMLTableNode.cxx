@@ -581,6 +581,39 @@ int vtkMRMLTableNode::AddEmptyRow()
   return rowIndex;
 }
 
+//----------------------------------------------------------------------------
+int vtkMRMLTableNode::AddEmptyRows(int numberOfRows)
+{
+  if (!this->Table)
+    {
+    vtkErrorMacro("vtkMRMLTableNode::AddEmptyRows failed: invalid table");
+    return -1;
+    }
+  if (numberOfRows <= 0)
+    {
+    vtkErrorMacro("vtkMRMLTableNode::AddEmptyRows failed: invalid number of rows: "<<numberOfRows);
+    return -1;
+    }
+  int tableWasModified = this->StartModify();
+  if (this->Table->GetNumberOfColumns()==0)
+    {
+    vtkDebugMacro("vtkMRMLTableNode::AddEmptyRows called for an empty table. Add an empty column first.");
+    this->AddColumn();
+    }
+  vtkIdType firstRowIndex = -1;
+  for (int i = 0; i < numberOfRows; ++i)
+    {
+    vtkIdType rowIndex = this->InsertNextBlankRowWithNullValues(this->Table);
+    if (firstRowIndex < 0)
+      {
+      firstRowIndex = rowIndex;
+      }
+    }
+  this->Table->Modified();
+  this->EndModify(tableWasModified);
+  return firstRowIndex;
+}
+
 //----------------------------------------------------------------------------
 bool vtkMRMLTableNode::RemoveRow(int rowIndex)
 {
@@ -153,6 +153,14 @@ public:
   /// Returns the index of the inserted row or -1 on failure.
   int AddEmptyRow();
 
+  ///
+  /// Add multiple empty rows at the end of the table with a single
+  /// modified event. Much faster than calling AddEmptyRow() in a loop
+  /// when importing large tables, as observers (such as table views)
+  /// are only notified once.
+  /// Returns the index of the first inserted row or -1 on failure.
+  int AddEmptyRows(int numberOfRows);
+
   ///
   /// Remove row from the table
   /// Returns with true on success.
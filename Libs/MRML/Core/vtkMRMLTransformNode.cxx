@@ -54,6 +54,8 @@ vtkMRMLTransformNode::vtkMRMLTransformNode()
 
   this->CachedMatrixTransformToParent=vtkMatrix4x4::New();
   this->CachedMatrixTransformFromParent=vtkMatrix4x4::New();
+
+  this->CachedTransformToWorld=NULL;
 }
 
 //----------------------------------------------------------------------------
@@ -66,6 +68,12 @@ vtkMRMLTransformNode::~vtkMRMLTransformNode()
   this->CachedMatrixTransformToParent=NULL;
   this->CachedMatrixTransformFromParent->Delete();
   this->CachedMatrixTransformFromParent=NULL;
+
+  if (this->CachedTransformToWorld!=NULL)
+    {
+    this->CachedTransformToWorld->Delete();
+    this->CachedTransformToWorld=NULL;
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -149,6 +157,53 @@ void vtkMRMLTransformNode::FlattenGeneralTransform(vtkCollection* outputTransfor
     }
 }
 
+//---------------------------------------------------------------------------
+void vtkMRMLTransformNode::ComposeLinearComponents(vtkGeneralTransform* outputTransform, vtkAbstractTransform* inputTransform)
+{
+  if (outputTransform==NULL)
+    {
+    vtkGenericWarningMacro("vtkMRMLTransformNode::ComposeLinearComponents failed: output transform is invalid");
+    return;
+    }
+
+  // Flatten the input into a simple list of components
+  vtkNew<vtkCollection> transformList;
+  FlattenGeneralTransform(transformList.GetPointer(), inputTransform);
+
+  // Rebuild the transform, composing each run of consecutive linear
+  // components into a single matrix. Concatenating in traversal order with
+  // PreMultiply reproduces the original transform (same as in
+  // DeepCopyTransform), both for the output general transform and for the
+  // composed matrices.
+  outputTransform->Identity();
+  outputTransform->PreMultiply();
+  vtkSmartPointer<vtkTransform> composedLinearTransform;
+  vtkCollectionSimpleIterator it;
+  vtkAbstractTransform* transformComponent = NULL;
+  for (transformList->InitTraversal(it); (transformComponent = vtkAbstractTransform::SafeDownCast(transformList->GetNextItemAsObject(it))) ;)
+    {
+    vtkLinearTransform* linearTransformComponent = vtkLinearTransform::SafeDownCast(transformComponent);
+    if (linearTransformComponent)
+      {
+      linearTransformComponent->Update();
+      if (composedLinearTransform.GetPointer()==NULL)
+        {
+        // start of a new run of linear components
+        composedLinearTransform = vtkSmartPointer<vtkTransform>::New();
+        composedLinearTransform->PreMultiply();
+        outputTransform->Concatenate(composedLinearTransform);
+        }
+      composedLinearTransform->Concatenate(linearTransformComponent->GetMatrix());
+      }
+    else
+      {
+      // nonlinear component, ends the current run of linear components
+      composedLinearTransform = NULL;
+      outputTransform->Concatenate(transformComponent);
+      }
+    }
+}
+
 //---------------------------------------------------------------------------
 bool vtkMRMLTransformNode::AreTransformsEqual(vtkAbstractTransform* transform1, vtkAbstractTransform* transform2)
 {
@@ -411,6 +466,48 @@ int  vtkMRMLTransformNode::IsTransformToWorldLinear()
   return 1;
 }
 
+//----------------------------------------------------------------------------
+vtkGeneralTransform* vtkMRMLTransformNode::GetCachedTransformToWorld()
+{
+  // Collect the current transform chain to world. This walk is cheap
+  // compared to rebuilding the concatenated transform and allows
+  // validating the cache: the cache is only stale if the chain structure
+  // changed (parameter changes of the component transforms propagate into
+  // the concatenated transform automatically, because generic transforms
+  // reference their components).
+  std::vector<vtkMRMLTransformNode*> currentNodes;
+  std::vector<vtkAbstractTransform*> currentTransforms;
+  for (vtkMRMLTransformNode* current = this; current != NULL; current = current->GetParentTransformNode())
+    {
+    currentNodes.push_back(current);
+    vtkAbstractTransform* transformToParent = current->GetTransformToParent();
+    if (transformToParent != NULL)
+      {
+      currentTransforms.push_back(transformToParent);
+      }
+    }
+
+  if (this->CachedTransformToWorld != NULL
+    && this->CachedTransformToWorldNodes == currentNodes
+    && this->CachedTransformToWorldTransforms == currentTransforms)
+    {
+    return this->CachedTransformToWorld;
+    }
+
+  // A new transform object is created instead of rebuilding the cached one
+  // in place, so that transforms that were handed out earlier keep
+  // describing the old chain (same behavior as without caching).
+  if (this->CachedTransformToWorld != NULL)
+    {
+    this->CachedTransformToWorld->Delete();
+    }
+  this->CachedTransformToWorld = vtkGeneralTransform::New();
+  vtkMRMLTransformNode::GetTransformBetweenNodes(this, NULL, this->CachedTransformToWorld);
+  this->CachedTransformToWorldNodes = currentNodes;
+  this->CachedTransformToWorldTransforms = currentTransforms;
+  return this->CachedTransformToWorld;
+}
+
 //----------------------------------------------------------------------------
 void vtkMRMLTransformNode::GetTransformToWorld(vtkGeneralTransform* transformToWorld)
 {
@@ -419,7 +516,9 @@ void vtkMRMLTransformNode::GetTransformToWorld(vtkGeneralTransform* transformToW
     vtkErrorMacro("vtkMRMLTransformNode::GetTransformToWorld failed: transformToWorld is invalid");
     return;
     }
-  vtkMRMLTransformNode::GetTransformBetweenNodes(this, NULL, transformToWorld);
+  transformToWorld->Identity();
+  transformToWorld->PostMultiply();
+  transformToWorld->Concatenate(this->GetCachedTransformToWorld());
 }
 
 //----------------------------------------------------------------------------
@@ -430,7 +529,10 @@ void vtkMRMLTransformNode::GetTransformFromWorld(vtkGeneralTransform* transformF
     vtkErrorMacro("vtkMRMLTransformNode::GetTransformFromWorld failed: transformToWorld is invalid");
     return;
     }
-  vtkMRMLTransformNode::GetTransformBetweenNodes(NULL, this, transformFromWorld);
+  transformFromWorld->Identity();
+  transformFromWorld->PostMultiply();
+  transformFromWorld->Concatenate(this->GetCachedTransformToWorld());
+  transformFromWorld->Inverse();
 }
 
 //----------------------------------------------------------------------------
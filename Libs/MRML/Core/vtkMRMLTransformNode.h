@@ -314,6 +314,15 @@ public:
   /// into a flat list of transforms. This is useful for simplifying serialization for copying and writing to file.
   static void FlattenGeneralTransform(vtkCollection* outputTransformList, vtkAbstractTransform* inputTransform);
 
+  ///
+  /// Creates a simplified, equivalent copy of an input composite transform in outputTransform:
+  /// the input is flattened into a list of components and each run of consecutive linear
+  /// components is composed into a single matrix. Nonlinear components are added by reference,
+  /// unchanged. This reduces the number of transforms that have to be evaluated for each point
+  /// when a deep transform chain is applied to a large point set (for example, when hardening
+  /// a transform on a model), without changing the result.
+  static void ComposeLinearComponents(vtkGeneralTransform* outputTransform, vtkAbstractTransform* inputTransform);
+
   ///
   /// Return true if the two transforms are equal. A transform object is considered to be the same if it is
   /// made up of the same flattened list of transforms.
@@ -369,6 +378,15 @@ protected:
   /// Sets and observes a transform and deletes the inverse (so that the inverse will be computed automatically)
   virtual void SetAndObserveTransform(vtkAbstractTransform** originalTransformPtr, vtkAbstractTransform** inverseTransformPtr, vtkAbstractTransform *transform);
 
+  ///
+  /// Returns the cached flattened concatenation of all transforms from this
+  /// node to world, rebuilding it only if the transform chain changed since
+  /// the cache was built. Parameter changes of transforms along the chain
+  /// do not require a rebuild, because the concatenated generic transform
+  /// references the component transforms and is updated automatically.
+  /// \sa GetTransformToWorld, GetTransformFromWorld
+  vtkGeneralTransform* GetCachedTransformToWorld();
+
   ///
   /// These transforms store the transforms that were set externally.
   /// We use the capability of generic transforms for concatenating and inverting the same
@@ -388,6 +406,13 @@ protected:
   /// GetMatrixTransformToParent and GetMatrixFromParent methods
   vtkMatrix4x4* CachedMatrixTransformToParent;
   vtkMatrix4x4* CachedMatrixTransformFromParent;
+
+  /// Cached flattened transform to world and the transform chain it was
+  /// built from, used for validating the cache.
+  /// \sa GetCachedTransformToWorld
+  vtkGeneralTransform* CachedTransformToWorld;
+  std::vector<vtkMRMLTransformNode*> CachedTransformToWorldNodes;
+  std::vector<vtkAbstractTransform*> CachedTransformToWorldTransforms;
 };
 
 #endif
@@ -189,7 +189,12 @@ bool vtkMRMLTransformableNode::HardenTransform()
     {
     vtkNew<vtkGeneralTransform> hardeningTransform;
     transformNode->GetTransformToWorld(hardeningTransform.GetPointer());
-    this->ApplyTransform(hardeningTransform.GetPointer());
+    // Compose runs of consecutive linear components into single matrices,
+    // so that deep transform chains do not have to be evaluated component
+    // by component for every point.
+    vtkNew<vtkGeneralTransform> composedHardeningTransform;
+    vtkMRMLTransformNode::ComposeLinearComponents(composedHardeningTransform.GetPointer(), hardeningTransform.GetPointer());
+    this->ApplyTransform(composedHardeningTransform.GetPointer());
     }
 
   this->SetAndObserveTransformNodeID(NULL);
@@ -17,9 +17,10 @@ Version:   $Revision: 1.14 $
 #include "vtkMRMLVectorVolumeNode.h"
 #include "vtkMRMLVolumeArchetypeStorageNode.h"
 
+#include "vtkImageData.h"
+#include "vtkImageExtractComponents.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
-#include "vtkImageExtractComponents.h"
 
 
 //----------------------------------------------------------------------------
@@ -28,6 +29,7 @@ vtkMRMLNodeNewMacro(vtkMRMLVectorVolumeNode);
 //----------------------------------------------------------------------------
 vtkMRMLVectorVolumeNode::vtkMRMLVectorVolumeNode()
 {
+  this->ComponentImageCacheTime = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -93,3 +95,49 @@ void vtkMRMLVectorVolumeNode::CreateDefaultDisplayNodes()
   dispNode->SetDefaultColorMap();
   this->SetAndObserveDisplayNodeID(dispNode->GetID());
 }
+
+//----------------------------------------------------------------------------
+vtkImageData* vtkMRMLVectorVolumeNode::GetComponentImageData(int component)
+{
+  vtkImageData* imageData = this->GetImageData();
+  if (imageData == NULL)
+    {
+    vtkErrorMacro("GetComponentImageData: no image data");
+    return NULL;
+    }
+  if (component < 0 || component >= imageData->GetNumberOfScalarComponents())
+    {
+    vtkErrorMacro("GetComponentImageData: component " << component
+      << " is out of range, the volume has "
+      << imageData->GetNumberOfScalarComponents() << " components");
+    return NULL;
+    }
+  if (imageData->GetMTime() > this->ComponentImageCacheTime)
+    {
+    // the volume changed since the cache was filled
+    this->ComponentImageCache.clear();
+    this->ComponentImageCacheTime = imageData->GetMTime();
+    }
+  std::map<int, vtkSmartPointer<vtkImageData> >::iterator cachedComponent =
+    this->ComponentImageCache.find(component);
+  if (cachedComponent != this->ComponentImageCache.end())
+    {
+    return cachedComponent->second;
+    }
+  vtkNew<vtkImageExtractComponents> extract;
+  extract->SetInputData(imageData);
+  extract->SetComponents(component);
+  extract->Update();
+  // shallow-copy into an image the node owns so the cached result does not
+  // keep the extraction filter alive
+  vtkSmartPointer<vtkImageData> componentImage = vtkSmartPointer<vtkImageData>::New();
+  componentImage->ShallowCopy(extract->GetOutput());
+  this->ComponentImageCache[component] = componentImage;
+  return componentImage;
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLVectorVolumeNode::ClearComponentImageCache()
+{
+  this->ComponentImageCache.clear();
+}
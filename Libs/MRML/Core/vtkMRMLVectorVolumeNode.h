@@ -16,6 +16,14 @@
 #define __vtkMRMLVectorVolumeNode_h
 
 #include "vtkMRMLTensorVolumeNode.h"
+
+// VTK includes
+#include <vtkSmartPointer.h>
+
+// STD includes
+#include <map>
+
+class vtkImageData;
 class vtkMRMLVolumeArchetypeStorageNode;
 class vtkMRMLVectorVolumeDisplayNode;
 
@@ -59,12 +67,33 @@ class VTK_MRML_EXPORT vtkMRMLVectorVolumeNode : public vtkMRMLTensorVolumeNode
   /// Create and observe default display node
   virtual void CreateDefaultDisplayNodes() VTK_OVERRIDE;
 
+  ///
+  /// Return a single-component image holding the requested component of
+  /// the volume. The extracted component is cached, so switching back and
+  /// forth between components of a many-channel volume only pays for the
+  /// extraction the first time each component is requested. The cache is
+  /// discarded automatically when the volume image is modified.
+  /// Returns NULL if the volume has no image data or the component index
+  /// is out of range. The returned image is owned by the node; observe
+  /// or register it if it has to outlive the cache.
+  virtual vtkImageData* GetComponentImageData(int component);
+
+  ///
+  /// Release the cached component images. Useful to reclaim memory after
+  /// cycling through the components of a large volume; the cache is
+  /// rebuilt on demand.
+  virtual void ClearComponentImageCache();
+
 protected:
   vtkMRMLVectorVolumeNode();
   ~vtkMRMLVectorVolumeNode();
   vtkMRMLVectorVolumeNode(const vtkMRMLVectorVolumeNode&);
   void operator=(const vtkMRMLVectorVolumeNode&);
 
+  /// Extracted components indexed by component number, valid while the
+  /// volume image is unchanged since ComponentImageCacheTime
+  std::map<int, vtkSmartPointer<vtkImageData> > ComponentImageCache;
+  vtkMTimeType ComponentImageCacheTime;
 };
 
 #endif
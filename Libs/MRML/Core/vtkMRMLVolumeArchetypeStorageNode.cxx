@@ -56,6 +56,7 @@ vtkMRMLVolumeArchetypeStorageNode::vtkMRMLVolumeArchetypeStorageNode()
   this->CenterImage = 0;
   this->SingleFile  = 0;
   this->UseOrientationFromFile = 1;
+  this->UseParallelCompression = 0;
   this->DefaultWriteFileExtension = "nrrd";
 }
 
@@ -78,6 +79,11 @@ void vtkMRMLVolumeArchetypeStorageNode::WriteXML(ostream& of, int nIndent)
   ss << this->UseOrientationFromFile;
   of << " UseOrientationFromFile=\"" << ss.str() << "\"";
   }
+  {
+  std::stringstream ss;
+  ss << this->UseParallelCompression;
+  of << " UseParallelCompression=\"" << ss.str() << "\"";
+  }
   // SingleFile attribute is not written to file. GetNumberOfFileNames()
   // is used to determine if reader should read from single/multiple files.
 }
@@ -107,6 +113,12 @@ void vtkMRMLVolumeArchetypeStorageNode::ReadXMLAttributes(const char** atts)
       ss << attValue;
       ss >> this->UseOrientationFromFile;
       }
+    if (!strcmp(attName, "UseParallelCompression"))
+      {
+      std::stringstream ss;
+      ss << attValue;
+      ss >> this->UseParallelCompression;
+      }
     }
 
   // SingleFile attribute used to be read from the scene, but often
@@ -131,6 +143,7 @@ void vtkMRMLVolumeArchetypeStorageNode::Copy(vtkMRMLNode *anode)
   this->SetCenterImage(node->CenterImage);
   this->SetSingleFile(node->SingleFile);
   this->SetUseOrientationFromFile(node->UseOrientationFromFile);
+  this->SetUseParallelCompression(node->UseParallelCompression);
 
   this->EndModify(disabledModify);
 }
@@ -142,6 +155,7 @@ void vtkMRMLVolumeArchetypeStorageNode::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "CenterImage:   " << this->CenterImage << "\n";
   os << indent << "SingleFile:   " << this->SingleFile << "\n";
   os << indent << "UseOrientationFromFile:   " << this->UseOrientationFromFile << "\n";
+  os << indent << "UseParallelCompression:   " << this->UseParallelCompression << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -318,6 +332,9 @@ int vtkMRMLVolumeArchetypeStorageNode::ReadDataInternal(vtkMRMLNode *refNode)
 
   reader->AddObserver( vtkCommand::ProgressEvent,  this->MRMLCallbackCommand);
 
+  // this read supersedes any pixel data read deferred by an earlier lazy
+  // header-only pass (GetImageData below must not trigger it)
+  volNode->SetPixelDataPending(0);
   if (volNode->GetImageData())
     {
     volNode->SetAndObserveImageData(NULL);
@@ -342,6 +359,43 @@ int vtkMRMLVolumeArchetypeStorageNode::ReadDataInternal(vtkMRMLNode *refNode)
     reader->SetUseNativeOriginOn();
     }
 
+  if (this->GetLazyLoading())
+    {
+    // Header-only pass: the reader computes the geometry, the RAS to IJK
+    // matrix and the metadata dictionary in its information pass, so only
+    // the pixel data read is deferred. The node is marked as pending and
+    // requests a full read on the first GetImageData() call of a consumer.
+    try
+      {
+      reader->UpdateInformation();
+      }
+    catch (itk::ExceptionObject& e)
+      {
+      vtkErrorMacro(<< "ReadData: Cannot read file header as a volume of type "
+                    << (refNode ? refNode->GetNodeTagName() : "null")
+                    << "[" << "fullName = " << fullName << "]\n"
+                    << "ITK exception info: error in " << e.GetLocation() << "\n"
+                    << e.GetDescription() << "\n");
+      return 0;
+      }
+    vtkMatrix4x4* rasToIjk = reader->GetRasToIjkMatrix();
+    if (rasToIjk == NULL)
+      {
+      vtkErrorMacro("ReadData: Reader returned NULL RasToIjkMatrix");
+      return 0;
+      }
+    volNode->SetRASToIJKMatrix(rasToIjk);
+    vtkMRMLVolumeArchetypeStorageNode::SetMetaDataDictionaryFromReader(volNode, reader);
+    if (volNode->IsA("vtkMRMLDiffusionTensorVolumeNode"))
+      {
+      vtkMRMLDiffusionTensorVolumeNode* dtvn = vtkMRMLDiffusionTensorVolumeNode::SafeDownCast(volNode);
+      dtvn->SetMeasurementFrameMatrix(reader->GetMeasurementFrameMatrix());
+      }
+    volNode->PixelDataPendingOn();
+    vtkDebugMacro("ReadData: lazy loading is enabled, deferred reading pixel data of " << fullName);
+    return 1;
+    }
+
   bool readingWorked = true;
   std::string errorMessage = "";
   try
@@ -456,6 +510,9 @@ int vtkMRMLVolumeArchetypeStorageNode::ReadDataInternal(vtkMRMLNode *refNode)
 
   vtkNew<vtkImageData> iciOutputCopy;
   iciOutputCopy->ShallowCopy(ici->GetOutput());
+  // the pixel data is in memory now, clear any deferred read left from an
+  // earlier lazy header-only pass
+  volNode->SetPixelDataPending(0);
   volNode->SetAndObserveImageData(iciOutputCopy.GetPointer());
 
   // Log volume size to the application log. It helps to identify potential out-of-memory issues.
@@ -580,6 +637,7 @@ int vtkMRMLVolumeArchetypeStorageNode::WriteDataInternal(vtkMRMLNode *refNode)
 
     writer->SetInputConnection( volNode->GetImageDataConnection() );
     writer->SetUseCompression(this->GetUseCompression());
+    writer->SetUseParallelCompression(this->GetUseParallelCompression());
     if(this->WriteFileFormat)
       {
       writer->SetImageIOClassName(
@@ -706,6 +764,7 @@ std::string vtkMRMLVolumeArchetypeStorageNode::UpdateFileList(vtkMRMLNode *refNo
   writer->SetFileName(tempName.c_str());
   writer->SetInputData( volNode->GetImageData() );
   writer->SetUseCompression(this->GetUseCompression());
+  writer->SetUseParallelCompression(this->GetUseParallelCompression());
   if(this->WriteFileFormat)
     {
     if (this->GetScene() &&
@@ -73,6 +73,17 @@ public:
   vtkSetMacro(UseOrientationFromFile, int);
   vtkGetMacro(UseOrientationFromFile, int);
 
+  ///
+  /// Whether to compress the pixel data on all cores when saving a
+  /// compressed volume. The written file stays a standard gzip-encoded
+  /// NRRD; file types that the parallel engine cannot produce are saved
+  /// through the regular single-threaded writer.
+  /// Only used when UseCompression is on. Disabled by default.
+  /// \sa vtkITKImageWriter::SetUseParallelCompression()
+  vtkGetMacro(UseParallelCompression, int);
+  vtkSetMacro(UseParallelCompression, int);
+  vtkBooleanMacro(UseParallelCompression, int);
+
   /// Return true if the reference node is supported by the storage node
   virtual bool CanReadInReferenceNode(vtkMRMLNode* refNode) VTK_OVERRIDE;
   virtual bool CanWriteFromReferenceNode(vtkMRMLNode* refNode) VTK_OVERRIDE;
@@ -110,6 +121,7 @@ protected:
   int CenterImage;
   int SingleFile;
   int UseOrientationFromFile;
+  int UseParallelCompression;
 
 };
 
@@ -16,6 +16,7 @@ Version:   $Revision: 1.14 $
 #include "vtkEventBroker.h"
 #include "vtkMRMLScalarVolumeDisplayNode.h"
 #include "vtkMRMLVolumeNode.h"
+#include "vtkMRMLStorageNode.h"
 #include "vtkMRMLTransformNode.h"
 
 // VTK includes
@@ -67,6 +68,14 @@ vtkMRMLVolumeNode::vtkMRMLVolumeNode()
 
   this->ImageDataConnection = NULL;
   this->DataEventForwarder = NULL;
+
+  this->PixelDataPending = 0;
+
+  vtkMath::UninitializeBounds(this->RASBoundsCache);
+  this->RASBoundsCacheValid = false;
+  this->RASBoundsCacheNodeTime = 0;
+  this->RASBoundsCacheImageTime = 0;
+  this->RASBoundsCacheTransformTime = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -741,6 +750,12 @@ void vtkMRMLVolumeNode::SetAndObserveImageData(vtkImageData *imageData)
 //---------------------------------------------------------------------------
 vtkImageData* vtkMRMLVolumeNode::GetImageData()
 {
+  if (this->PixelDataPending)
+    {
+    // the storage node only read the header and geometry, read the pixel
+    // data now that a consumer asks for it
+    this->LoadPendingPixelData();
+    }
   vtkAlgorithm* producer = this->ImageDataConnection ?
     this->ImageDataConnection->GetProducer() : 0;
   return vtkImageData::SafeDownCast(
@@ -748,6 +763,40 @@ vtkImageData* vtkMRMLVolumeNode::GetImageData()
       this->ImageDataConnection->GetIndex()) : 0);
 }
 
+//---------------------------------------------------------------------------
+unsigned long vtkMRMLVolumeNode::GetBulkDataActualMemorySize()
+{
+  // do not go through GetImageData(), it would trigger a deferred pixel
+  // data read; a volume with pending pixel data holds no pixel memory yet
+  vtkAlgorithm* producer = this->ImageDataConnection ?
+    this->ImageDataConnection->GetProducer() : 0;
+  vtkImageData* imageData = vtkImageData::SafeDownCast(
+    producer ? producer->GetOutputDataObject(
+      this->ImageDataConnection->GetIndex()) : 0);
+  return imageData ? imageData->GetActualMemorySize() : 0;
+}
+
+//---------------------------------------------------------------------------
+void vtkMRMLVolumeNode::LoadPendingPixelData()
+{
+  // clear the flag first so that GetImageData calls made while the file is
+  // read (for example by observers of the events the read fires) do not
+  // trigger another read
+  this->PixelDataPending = 0;
+  vtkMRMLStorageNode* storageNode = this->GetStorageNode();
+  if (storageNode == NULL)
+    {
+    vtkWarningMacro("LoadPendingPixelData: no storage node is set, cannot read the pixel data");
+    return;
+    }
+  // force a full read, the storage node would defer the pixel data again
+  // while lazy loading is enabled on it
+  int wasLazy = storageNode->GetLazyLoading();
+  storageNode->SetLazyLoading(0);
+  storageNode->ReadData(this);
+  storageNode->SetLazyLoading(wasLazy);
+}
+
 //---------------------------------------------------------------------------
 void vtkMRMLVolumeNode
 ::SetImageDataConnection(vtkAlgorithmOutput *newImageDataConnection)
@@ -896,7 +945,35 @@ void vtkMRMLVolumeNode::ApplyTransformMatrix(vtkMatrix4x4* transformMatrix)
 //---------------------------------------------------------------------------
 void vtkMRMLVolumeNode::GetRASBounds(double bounds[6])
 {
+  // Slice fitting and the displayable managers ask for the bounds on every
+  // frame during interaction, so memoize them: the node MTime covers the
+  // geometry and the parent transform reference, the image MTime covers the
+  // dimensions and the transform-to-world MTime covers the whole chain.
+  vtkMTimeType nodeTime = this->GetMTime();
+  vtkImageData* volumeImage = this->GetImageData();
+  vtkMTimeType imageTime = volumeImage ? volumeImage->GetMTime() : 0;
+  vtkMRMLTransformNode* transformNode = this->GetParentTransformNode();
+  vtkMTimeType transformTime = transformNode ? transformNode->GetTransformToWorldMTime() : 0;
+  if (this->RASBoundsCacheValid &&
+      this->RASBoundsCacheNodeTime == nodeTime &&
+      this->RASBoundsCacheImageTime == imageTime &&
+      this->RASBoundsCacheTransformTime == transformTime)
+    {
+    for (int i = 0; i < 6; i++)
+      {
+      bounds[i] = this->RASBoundsCache[i];
+      }
+    return;
+    }
   this->GetSliceBounds(bounds, NULL);
+  for (int i = 0; i < 6; i++)
+    {
+    this->RASBoundsCache[i] = bounds[i];
+    }
+  this->RASBoundsCacheValid = true;
+  this->RASBoundsCacheNodeTime = nodeTime;
+  this->RASBoundsCacheImageTime = imageTime;
+  this->RASBoundsCacheTransformTime = transformTime;
 }
 
 //---------------------------------------------------------------------------
@@ -141,6 +141,9 @@ public:
   /// Get bounding box in global RAS form (xmin,xmax, ymin,ymax, zmin,zmax).
   /// This method returns the bounds of the object with any transforms that may
   /// be applied to it.
+  /// The result is memoized: repeated calls while the node, its image and
+  /// its transform chain are unchanged only copy the cached bounds, so the
+  /// method is cheap to call per frame during interaction.
   /// \sa GetSliceBounds(), GetIJKToRASMatrix(), vtkMRMLSliceLogic::GetVolumeSliceBounds()
   /// \sa GetNodeBounds()
   virtual void GetRASBounds(double bounds[6]) VTK_OVERRIDE;
@@ -171,7 +174,20 @@ public:
   /// vtkMRMLVolumeNode::Spacing, and vtkMRMLVolumeNode::IJKToRASDirections).
   /// \sa GetImageData(), SetImageDataConnection()
   void SetAndObserveImageData(vtkImageData *ImageData);
+  /// Return the image data of the volume.
+  /// If the pixel data read was deferred by a lazily loading storage node
+  /// (\sa vtkMRMLStorageNode::SetLazyLoading(), PixelDataPending) then the
+  /// first call reads the pixel data from the storage node.
   virtual vtkImageData* GetImageData();
+
+  ///
+  /// Set by a storage node that read only the header and geometry of the
+  /// volume; while set, the pixel data is read from the storage node on the
+  /// first GetImageData() call.
+  /// \sa vtkMRMLStorageNode::SetLazyLoading(), GetImageData()
+  vtkGetMacro(PixelDataPending, int);
+  vtkSetMacro(PixelDataPending, int);
+  vtkBooleanMacro(PixelDataPending, int);
   /// Set and observe image data pipeline.
   /// It is propagated to the display nodes.
   /// \sa GetImageDataConnection()
@@ -185,6 +201,13 @@ public:
   /// (0,dim[0],0,dim[1],0,dim[2]), which is not the case many times for segmentation merged labelmaps.
   void ShiftImageDataExtentToZeroStart();
 
+  ///
+  /// Size of the image data in kibibytes. Does not trigger a pending
+  /// lazy pixel data read: a volume whose pixel data has not been read
+  /// yet reports 0.
+  /// \sa GetImageData(), PixelDataPending
+  virtual unsigned long GetBulkDataActualMemorySize() VTK_OVERRIDE;
+
   ///
   /// alternative method to propagate events generated in Display nodes
   virtual void ProcessMRMLEvents ( vtkObject * /*caller*/,
@@ -245,6 +268,12 @@ protected:
   /// the useTransform parameter and the rasToSlice transform
   virtual void GetBoundsInternal(double bounds[6], vtkMatrix4x4* rasToSlice, bool useTransform);
 
+  ///
+  /// Read the deferred pixel data from the storage node, forcing a full
+  /// read even if the storage node is still set to load lazily.
+  /// \sa GetImageData(), PixelDataPending
+  void LoadPendingPixelData();
+
   /// these are unit length direction cosines
   double IJKToRASDirections[3][3];
 
@@ -255,6 +284,17 @@ protected:
   vtkAlgorithmOutput* ImageDataConnection;
   vtkEventForwarderCommand* DataEventForwarder;
 
+  int PixelDataPending;
+
+  /// Memoized world bounds, valid while the node, its image and its
+  /// transform chain are unchanged since the recorded times
+  /// \sa GetRASBounds()
+  double RASBoundsCache[6];
+  bool RASBoundsCacheValid;
+  vtkMTimeType RASBoundsCacheNodeTime;
+  vtkMTimeType RASBoundsCacheImageTime;
+  vtkMTimeType RASBoundsCacheTransformTime;
+
   itk::MetaDataDictionary Dictionary;
 };
 
@@ -90,6 +90,12 @@ class VTK_MRML_EXPORT vtkObservation : public vtkObject
   vtkGetMacro (TotalElapsedTime, double);
   vtkSetMacro (TotalElapsedTime, double);
 
+  /// Description
+  /// Number of times this observation has been invoked
+  /// (together with TotalElapsedTime this gives the mean handler cost)
+  vtkGetMacro (NumberOfInvocations, int);
+  vtkSetMacro (NumberOfInvocations, int);
+
   struct CallType
   {
     inline CallType(unsigned long eventID, void* callData);
@@ -159,6 +165,7 @@ protected:
 
   double LastElapsedTime;
   double TotalElapsedTime;
+  int NumberOfInvocations;
 
 };
 
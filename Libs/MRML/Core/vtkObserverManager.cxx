@@ -45,6 +45,16 @@ vtkObserverManager::~vtkObserverManager()
     vtkUnsignedLongArray *objTags = iter->second;
     objTags->Delete();
     }
+  // The direct (broker bypass) observations live on the objects themselves
+  for(iter=this->DirectObserverTags.begin(); iter != this->DirectObserverTags.end(); iter++)
+    {
+    vtkUnsignedLongArray *objTags = iter->second;
+    for (int i=0; i < objTags->GetNumberOfTuples(); i++)
+      {
+      iter->first->RemoveObserver(objTags->GetValue(i));
+      }
+    objTags->Delete();
+    }
 
   if (this->CallbackCommand)
     {
@@ -191,6 +201,80 @@ void vtkObserverManager::SetAndObserveObjectEvents(vtkObject **nodePtr, vtkObjec
   this->AddObjectEvents(node, events, priorities);
 }
 
+//----------------------------------------------------------------------------
+void vtkObserverManager::SetAndObserveObjectDirect(vtkObject **nodePtr, vtkObject *node, float priority)
+{
+  vtkDebugMacro (<< "SetAndObserveObjectDirect of " << node);
+  if (*nodePtr == node)
+    {
+    return;
+    }
+  this->SetObject(nodePtr, node);
+  vtkNew<vtkIntArray> events;
+  events->InsertNextValue(vtkCommand::ModifiedEvent);
+  vtkNew<vtkFloatArray> priorities;
+  priorities->InsertNextValue(priority);
+  this->ObserveObjectEventsDirect(node, events.GetPointer(), priorities.GetPointer());
+}
+
+//----------------------------------------------------------------------------
+void vtkObserverManager::SetAndObserveObjectEventsDirect(vtkObject **nodePtr, vtkObject *node, vtkIntArray *events, vtkFloatArray *priorities)
+{
+  vtkDebugMacro (<< "SetAndObserveObjectEventsDirect of " << node);
+  if (*nodePtr == node)
+    {
+    return;
+    }
+  this->SetObject(nodePtr, node);
+  this->ObserveObjectEventsDirect(node, events, priorities);
+}
+
+//----------------------------------------------------------------------------
+void vtkObserverManager::ObserveObjectEventsDirect(vtkObject *nodePtr, vtkIntArray *events, vtkFloatArray *priorities)
+{
+  // check whether no priorities are provided or the same number of
+  // events and priorities are provided
+  if ( !((events && priorities && events->GetNumberOfTuples() == priorities->GetNumberOfTuples()) || (events && !priorities)))
+    {
+    vtkWarningMacro(<< "Number of events (" << events->GetNumberOfTuples()
+                    << ") doesn't match number of priorities ("
+                    << priorities->GetNumberOfTuples());
+    return;
+    }
+
+  if (nodePtr)
+    {
+    vtkUnsignedLongArray* objTags = NULL;
+    std::map< vtkObject*, vtkUnsignedLongArray*>::iterator it =  this->DirectObserverTags.find(nodePtr);
+    if (it != this->DirectObserverTags.end())
+      {
+      objTags = it->second;
+      }
+    else
+      {
+      objTags = vtkUnsignedLongArray::New();
+      this->DirectObserverTags[nodePtr] = objTags;
+      }
+
+    if (events)
+      {
+      for (int i=0; i<events->GetNumberOfTuples(); i++)
+        {
+        unsigned long tag = 0;
+        if (!priorities)
+          {
+          tag = nodePtr->AddObserver(events->GetValue(i), this->CallbackCommand);
+          }
+        else
+          {
+          tag = nodePtr->AddObserver(events->GetValue(i), this->CallbackCommand, priorities->GetValue(i));
+          }
+        objTags->InsertNextValue(tag);
+        }
+      }
+    }
+}
+
 //----------------------------------------------------------------------------
 void vtkObserverManager::RemoveObjectEvents(vtkObject *nodePtr)
 {
@@ -207,6 +291,16 @@ void vtkObserverManager::RemoveObjectEvents(vtkObject *nodePtr)
         }
       objTags->Reset();
       }
+    std::map< vtkObject*, vtkUnsignedLongArray*>::iterator directIt = this->DirectObserverTags.find(nodePtr);
+    if (directIt != this->DirectObserverTags.end())
+      {
+      vtkUnsignedLongArray* objTags = directIt->second;
+      for (int i=0; i < objTags->GetNumberOfTuples(); i++)
+        {
+        nodePtr->RemoveObserver(objTags->GetValue(i));
+        }
+      objTags->Reset();
+      }
     }
 }
 
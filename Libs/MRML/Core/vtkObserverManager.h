@@ -56,6 +56,29 @@ class VTK_MRML_EXPORT vtkObserverManager : public vtkObject
   /// set vtkObject to a specified pointer, remove all observers for all events, add observers for specified events
   void SetAndObserveObjectEvents(vtkObject **nodePtr, vtkObject *node, vtkIntArray *events, vtkFloatArray *priorities=0, bool logWarningIfSameObservationExists=true);
 
+  /// set vtkObject to a specified pointer, remove all observers for all
+  /// events, observe the ModifiedEvent with a direct connection
+  /// \sa ObserveObjectEventsDirect()
+  void SetAndObserveObjectDirect(vtkObject **nodePtr, vtkObject *node, float priority=0.0);
+
+  /// set vtkObject to a specified pointer, remove all observers for all
+  /// events, observe the specified events with direct connections
+  /// \sa ObserveObjectEventsDirect()
+  void SetAndObserveObjectEventsDirect(vtkObject **nodePtr, vtkObject *node, vtkIntArray *events, vtkFloatArray *priorities=0);
+
+  /// Observe events of an object with a direct connection: the callback
+  /// command is added straight on the object, bypassing vtkEventBroker.
+  /// No observation record is allocated and the per event broker
+  /// bookkeeping (timing, logging, asynchronous queueing) is skipped, so
+  /// this is the cheap way to observe high rate events such as slice or
+  /// interaction node updates during interaction. The observations are
+  /// invisible to the broker (event log, GetObservationsCount()) and are
+  /// always delivered synchronously; keep broker observations for rare
+  /// structural events. The object must stay registered while observed,
+  /// which is guaranteed when used through the vtkSetAndObserve macros.
+  /// RemoveObjectEvents() removes direct and broker observations alike.
+  void ObserveObjectEventsDirect(vtkObject *nodePtr, vtkIntArray *events, vtkFloatArray *priorities=0);
+
   /// remove all observers for all events
   void RemoveObjectEvents(vtkObject *nodePtr);
 
@@ -99,6 +122,11 @@ protected:
 
   std::map< vtkObject*, vtkUnsignedLongArray* > ObserverTags;
 
+  /// Tags of the direct (broker bypass) observations, kept separate from
+  /// the broker tags because they are removed on the object itself.
+  /// \sa ObserveObjectEventsDirect()
+  std::map< vtkObject*, vtkUnsignedLongArray* > DirectObserverTags;
+
 };
 
 #endif
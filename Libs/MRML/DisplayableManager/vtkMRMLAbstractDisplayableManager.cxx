@@ -40,6 +40,7 @@
 #include <vtkRenderWindow.h>
 #include <vtkRenderWindowInteractor.h>
 #include <vtkSmartPointer.h>
+#include <vtkTimerLog.h>
 #include <vtkWeakPointer.h>
 
 // STD includes
@@ -123,6 +124,7 @@ public:
   bool                                      Created;
   vtkObserverManager*                       WidgetsObserverManager;
   bool                                      UpdateFromMRMLRequested;
+  double                                    LastUpdateFromMRMLDuration;
   vtkRenderer*                              Renderer;
   vtkMRMLNode*                              MRMLDisplayableNode;
   vtkSmartPointer<vtkIntArray>              MRMLDisplayableNodeObservableEvents;
@@ -151,6 +153,7 @@ vtkMRMLAbstractDisplayableManager::vtkInternal::vtkInternal(
   this->Created = false;
   this->WidgetsObserverManager = vtkObserverManager::New();
   this->UpdateFromMRMLRequested = false;
+  this->LastUpdateFromMRMLDuration = 0.;
   this->Renderer = 0;
   this->LightBoxRendererManagerProxy = 0;
   this->MRMLDisplayableNode = 0;
@@ -661,6 +664,12 @@ bool vtkMRMLAbstractDisplayableManager::IsCreated()
   return this->Internal->Created;
 }
 
+//----------------------------------------------------------------------------
+double vtkMRMLAbstractDisplayableManager::GetLastUpdateFromMRMLDuration()
+{
+  return this->Internal->LastUpdateFromMRMLDuration;
+}
+
 //---------------------------------------------------------------------------
 vtkRenderer * vtkMRMLAbstractDisplayableManager::GetRenderer()
 {
@@ -851,7 +860,10 @@ void vtkMRMLAbstractDisplayableManager::RequestRender()
 
   if (this->Internal->UpdateFromMRMLRequested)
     {
+    double startTime = vtkTimerLog::GetUniversalTime();
     this->UpdateFromMRML();
+    this->Internal->LastUpdateFromMRMLDuration =
+        vtkTimerLog::GetUniversalTime() - startTime;
     }
 
   this->InvokeEvent(vtkCommand::UpdateEvent);
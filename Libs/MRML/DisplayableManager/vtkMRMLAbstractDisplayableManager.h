@@ -55,6 +55,13 @@ public:
   /// \sa CreateIfPossible() Create()
   bool IsCreated();
 
+  /// Time (in seconds) spent in the most recent UpdateFromMRML() triggered
+  /// from RequestRender(), 0 if no update has happened yet. This gives the
+  /// per-manager cost of keeping the renderer synchronized with MRML and
+  /// can be used to identify managers that exceed the frame time budget.
+  /// \sa RequestRender() UpdateFromMRML()
+  double GetLastUpdateFromMRMLDuration();
+
   /// Set the LightBoxRendererManager proxy. This proxy provides a
   /// method GetRenderer(int) that returns the renderer for the ith
   /// lightbox pane. The DisplayableManagers use this method to map
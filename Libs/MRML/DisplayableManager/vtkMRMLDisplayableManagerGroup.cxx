@@ -72,6 +72,15 @@ public:
   vtkMRMLNode*                          MRMLDisplayableNode;
   vtkRenderer*                          Renderer;
   vtkWeakPointer<vtkMRMLLightBoxRendererManagerProxy> LightBoxRendererManagerProxy;
+
+  // True while a render request has been forwarded (UpdateEvent invoked)
+  // and the corresponding render has not started yet. Further requests are
+  // coalesced into the pending one until the render window's StartEvent
+  // clears the flag.
+  bool RenderRequestPending;
+  unsigned int CoalescedRenderRequestCount;
+  vtkSmartPointer<vtkCallbackCommand> RenderWindowCallBackCommand;
+  vtkWeakPointer<vtkRenderWindow> ObservedRenderWindow;
 };
 
 //----------------------------------------------------------------------------
@@ -85,6 +94,9 @@ vtkMRMLDisplayableManagerGroup::vtkInternal::vtkInternal()
   this->CallBackCommand = vtkSmartPointer<vtkCallbackCommand>::New();
   this->DisplayableManagerFactory = 0;
   this->LightBoxRendererManagerProxy = 0;
+  this->RenderRequestPending = false;
+  this->CoalescedRenderRequestCount = 0;
+  this->RenderWindowCallBackCommand = vtkSmartPointer<vtkCallbackCommand>::New();
 }
 
 //----------------------------------------------------------------------------
@@ -96,6 +108,8 @@ vtkMRMLDisplayableManagerGroup::vtkMRMLDisplayableManagerGroup()
   this->Internal = new vtkInternal;
   this->Internal->CallBackCommand->SetCallback(Self::DoCallback);
   this->Internal->CallBackCommand->SetClientData(this);
+  this->Internal->RenderWindowCallBackCommand->SetCallback(Self::DoRenderWindowCallback);
+  this->Internal->RenderWindowCallBackCommand->SetClientData(this);
 }
 
 //----------------------------------------------------------------------------
@@ -109,6 +123,12 @@ vtkMRMLDisplayableManagerGroup::~vtkMRMLDisplayableManagerGroup()
     this->Internal->DisplayableManagers[i]->Delete();
     }
 
+  if (this->Internal->ObservedRenderWindow)
+    {
+    this->Internal->ObservedRenderWindow->RemoveObserver(
+        this->Internal->RenderWindowCallBackCommand);
+    }
+
   if (this->Internal->Renderer)
     {
     this->Internal->Renderer->UnRegister(this);
@@ -355,9 +375,44 @@ vtkRenderWindowInteractor* vtkMRMLDisplayableManagerGroup::GetInteractor()
 //----------------------------------------------------------------------------
 void vtkMRMLDisplayableManagerGroup::RequestRender()
 {
+  // Keep the render window observed so that the start of each render
+  // clears the pending flag. The window may be attached to the renderer
+  // (or replaced) after SetRenderer.
+  vtkRenderWindow* renderWindow =
+      this->Internal->Renderer ? this->Internal->Renderer->GetRenderWindow() : 0;
+  if (renderWindow != this->Internal->ObservedRenderWindow.GetPointer())
+    {
+    if (this->Internal->ObservedRenderWindow)
+      {
+      this->Internal->ObservedRenderWindow->RemoveObserver(
+          this->Internal->RenderWindowCallBackCommand);
+      }
+    this->Internal->ObservedRenderWindow = renderWindow;
+    if (renderWindow)
+      {
+      renderWindow->AddObserver(vtkCommand::StartEvent,
+                                this->Internal->RenderWindowCallBackCommand);
+      }
+    this->Internal->RenderRequestPending = false;
+    }
+
+  // Requests are only coalesced while a render window is observed:
+  // without one there is no render start to clear the pending flag.
+  if (renderWindow && this->Internal->RenderRequestPending)
+    {
+    ++this->Internal->CoalescedRenderRequestCount;
+    return;
+    }
+  this->Internal->RenderRequestPending = (renderWindow != 0);
   this->InvokeEvent(vtkCommand::UpdateEvent);
 }
 
+//----------------------------------------------------------------------------
+unsigned int vtkMRMLDisplayableManagerGroup::GetCoalescedRenderRequestCount()
+{
+  return this->Internal->CoalescedRenderRequestCount;
+}
+
 //----------------------------------------------------------------------------
 vtkRenderer* vtkMRMLDisplayableManagerGroup::GetRenderer()
 {
@@ -433,6 +488,26 @@ void vtkMRMLDisplayableManagerGroup::DoCallback(vtkObject* vtk_obj, unsigned lon
     }
 }
 
+//-----------------------------------------------------------------------------
+void vtkMRMLDisplayableManagerGroup::DoRenderWindowCallback(vtkObject* vtk_obj, unsigned long event,
+                                                            void* client_data, void* vtkNotUsed(call_data))
+{
+  vtkMRMLDisplayableManagerGroup* self =
+      reinterpret_cast<vtkMRMLDisplayableManagerGroup*>(client_data);
+  assert(self);
+  assert(reinterpret_cast<vtkRenderWindow*>(vtk_obj));
+#ifndef _DEBUG
+  (void)vtk_obj;
+#endif
+
+  if (event == vtkCommand::StartEvent)
+    {
+    // The render that is starting covers every request forwarded so far;
+    // requests arriving during or after this render need a new UpdateEvent.
+    self->Internal->RenderRequestPending = false;
+    }
+}
+
 //----------------------------------------------------------------------------
 void vtkMRMLDisplayableManagerGroup::onDisplayableManagerFactoryRegisteredEvent(
     const char* displayableManagerName)
@@ -80,9 +80,20 @@ public:
   /// Invoke vtkCommand::UpdateEvent
   /// An observer can then listen for that event and "compress" the different Render requests
   /// to efficiently call RenderWindow->Render()
+  /// Requests are coalesced: once an UpdateEvent has been invoked, further
+  /// requests do not invoke it again until the render window starts the
+  /// corresponding render.
   /// \sa vtkMRMLAbstractDisplayableManager::RequestRender()
+  /// \sa GetCoalescedRenderRequestCount()
   void RequestRender();
 
+  /// Number of RequestRender() calls that were coalesced into an already
+  /// pending request instead of invoking another vtkCommand::UpdateEvent.
+  /// Useful to quantify how many redundant render requests the group
+  /// absorbed.
+  /// \sa RequestRender()
+  unsigned int GetCoalescedRenderRequestCount();
+
   /// Get Renderer
   vtkRenderer* GetRenderer();
 
@@ -125,6 +136,11 @@ protected:
   typedef vtkMRMLDisplayableManagerGroup Self;
   static void DoCallback(vtkObject* vtk_obj, unsigned long event,
                          void* client_data, void* call_data);
+  /// Clears the pending render request flag when the observed render
+  /// window starts rendering
+  /// \sa RequestRender()
+  static void DoRenderWindowCallback(vtkObject* vtk_obj, unsigned long event,
+                                     void* client_data, void* call_data);
   /// Trigger upon a DisplayableManager is either registered or unregistered from
   /// the associated factory
   void onDisplayableManagerFactoryRegisteredEvent(const char* displayableManagerName);
@@ -72,6 +72,7 @@
 #include <vtkWeakPointer.h>
 
 // for picking
+#include <vtkCellLocator.h>
 #include <vtkCellPicker.h>
 #include <vtkPointPicker.h>
 #include <vtkPropPicker.h>
@@ -96,6 +97,12 @@ public:
   /// Reset all the pick vars
   void ResetPick();
 
+  /// Register a cell locator in the cell picker for each displayed model
+  /// mesh, so that picking traverses a spatial tree per model instead of
+  /// every cell of every visible actor. Locators are kept across picks and
+  /// only rebuilt for meshes that changed since the last pick.
+  void UpdatePickLocators();
+
   std::map<std::string, vtkProp3D *>               DisplayedActors;
   std::map<std::string, vtkMRMLDisplayNode *>      DisplayedNodes;
   std::map<std::string, int>                       DisplayedClipState;
@@ -103,6 +110,10 @@ public:
   std::map<std::string, vtkMRMLDisplayableNode *>  DisplayableNodes;
   std::map<std::string, int>                       RegisteredModelHierarchies;
   std::map<std::string, vtkTransformFilter *>      DisplayNodeTransformFilters;
+  /// Combined modified time of a displayable node, its display nodes and its
+  /// parent transform at the last pipeline update, used to skip rebuilding
+  /// pipelines of unchanged models in UpdateModelsFromMRML
+  std::map<std::string, vtkMTimeType>              DisplayedNodeUpdateTimes;
 
   vtkMRMLSliceNode *   RedSliceNode;
   vtkMRMLSliceNode *   GreenSliceNode;
@@ -129,6 +140,9 @@ public:
   vtkSmartPointer<vtkCellPicker>       CellPicker;
   vtkSmartPointer<vtkPointPicker>      PointPicker;
 
+  /// Cell locators registered in CellPicker, one per displayed model mesh
+  std::map<vtkDataSet*, vtkSmartPointer<vtkCellLocator> > PickLocators;
+
   /// Information about a pick event
   std::string  PickedNodeID;
   double       PickedRAS[3];
@@ -200,6 +214,63 @@ void vtkMRMLModelDisplayableManager::vtkInternal::ResetPick()
   this->PickedPointID = -1;
 }
 
+//---------------------------------------------------------------------------
+void vtkMRMLModelDisplayableManager::vtkInternal::UpdatePickLocators()
+{
+  // Collect the locators of the currently displayed meshes, reusing
+  // locators built for previous picks. Dropping the previous map afterward
+  // releases locators of meshes that are no longer displayed.
+  std::map<vtkDataSet*, vtkSmartPointer<vtkCellLocator> > currentLocators;
+  std::map<std::string, vtkMRMLDisplayNode *>::iterator modelIter;
+  for (modelIter = this->DisplayedNodes.begin();
+       modelIter != this->DisplayedNodes.end();
+       modelIter++)
+    {
+    vtkMRMLModelDisplayNode* displayNode = vtkMRMLModelDisplayNode::SafeDownCast(modelIter->second);
+    if (displayNode == 0)
+      {
+      continue;
+      }
+    vtkPointSet* mesh = displayNode->GetOutputMesh();
+    if (mesh == 0 || mesh->GetNumberOfCells() == 0)
+      {
+      continue;
+      }
+    vtkSmartPointer<vtkCellLocator> locator;
+    std::map<vtkDataSet*, vtkSmartPointer<vtkCellLocator> >::iterator previousIter =
+      this->PickLocators.find(mesh);
+    if (previousIter != this->PickLocators.end())
+      {
+      locator = previousIter->second;
+      }
+    else
+      {
+      locator = vtkSmartPointer<vtkCellLocator>::New();
+      locator->SetDataSet(mesh);
+      }
+    if (locator->GetBuildTime() < mesh->GetMTime())
+      {
+      locator->BuildLocator();
+      }
+    currentLocators[mesh] = locator;
+    }
+  this->PickLocators.swap(currentLocators);
+
+  // Re-register the locators in the picker. The picker transforms the pick
+  // ray into each actor's coordinate system, so the locators remain valid
+  // for actors moved by transform nodes. Actors whose mapper input is not
+  // the output mesh (e.g. clipped models) have no matching locator and are
+  // picked cell by cell as before.
+  this->CellPicker->RemoveAllLocators();
+  std::map<vtkDataSet*, vtkSmartPointer<vtkCellLocator> >::iterator locatorIter;
+  for (locatorIter = this->PickLocators.begin();
+       locatorIter != this->PickLocators.end();
+       locatorIter++)
+    {
+    this->CellPicker->AddLocator(locatorIter->second);
+    }
+}
+
 //---------------------------------------------------------------------------
 // vtkMRMLModelDisplayableManager methods
 
@@ -513,7 +584,12 @@ void vtkMRMLModelDisplayableManager::ProcessMRMLNodesEvents(vtkObject *caller,
           {
           requestRender = false;
           break;
-          } // else fall through
+          }
+        // only the display node carried by the event can differ from what
+        // the actors show, restrict the update check to it
+        requestRender = this->OnMRMLDisplayableModelNodeModifiedEvent(
+          displayableNode, reinterpret_cast<vtkMRMLDisplayNode*>(callData));
+        break;
       case vtkCommand::ModifiedEvent:
         VTK_FALLTHROUGH;
       case vtkMRMLModelNode::MeshModifiedEvent:
@@ -733,7 +809,7 @@ bool vtkMRMLModelDisplayableManager::IsModelDisplayable(vtkMRMLDisplayNode* node
 
 //---------------------------------------------------------------------------
 bool vtkMRMLModelDisplayableManager::OnMRMLDisplayableModelNodeModifiedEvent(
-    vtkMRMLDisplayableNode * modelNode)
+    vtkMRMLDisplayableNode * modelNode, vtkMRMLDisplayNode* modifiedDisplayNode /*=0*/)
 {
   assert(modelNode);
 
@@ -755,6 +831,11 @@ bool vtkMRMLModelDisplayableManager::OnMRMLDisplayableModelNodeModifiedEvent(
       updateMRML = true;
       break;
       }
+    if (modifiedDisplayNode != 0 && dnode != modifiedDisplayNode)
+      {
+      // the unmodified display nodes are already in sync with their actors
+      continue;
+      }
     bool visible = (dnode->GetVisibility() == 1) && this->IsModelDisplayable(dnode);
     bool hasActor =
       this->Internal->DisplayedActors.find(dnode->GetID()) != this->Internal->DisplayedActors.end();
@@ -858,6 +939,7 @@ void vtkMRMLModelDisplayableManager::UpdateModelsFromMRML()
     this->Internal->DisplayedClipState.clear();
     this->Internal->DisplayedVisibility.clear();
     this->Internal->DisplayNodeTransformFilters.clear();
+    this->Internal->DisplayedNodeUpdateTimes.clear();
     this->UpdateModelHierarchies();
     }
 
@@ -893,7 +975,57 @@ void vtkMRMLModelDisplayableManager::UpdateModelsFromMRML()
         {
         continue;
         }
+
+      // Compute the combined modified time of the model, its display nodes
+      // and its parent transform. If it matches the time of the last pipeline
+      // update and all displayable display nodes have actors, then nothing
+      // that this method depends on has changed and the rebuild can be
+      // skipped for this model. Clipping and model hierarchies pull in state
+      // from other nodes, so no models are skipped when those are active.
+      vtkMTimeType modelUpdateTime = model->GetMTime();
+      if (model->GetParentTransformNode())
+        {
+        vtkMTimeType transformTime = model->GetParentTransformNode()->GetTransformToWorldMTime();
+        if (transformTime > modelUpdateTime)
+          {
+          modelUpdateTime = transformTime;
+          }
+        }
+      int ndnodes = model->GetNumberOfDisplayNodes();
+      bool allActorsPresent = true;
+      for (int i = 0; i < ndnodes; i++)
+        {
+        vtkMRMLDisplayNode *dnode = model->GetNthDisplayNode(i);
+        if (dnode == 0)
+          {
+          allActorsPresent = false;
+          break;
+          }
+        if (dnode->GetMTime() > modelUpdateTime)
+          {
+          modelUpdateTime = dnode->GetMTime();
+          }
+        if (this->IsModelDisplayable(dnode) &&
+            this->Internal->DisplayedActors.find(dnode->GetID()) == this->Internal->DisplayedActors.end())
+          {
+          allActorsPresent = false;
+          }
+        }
+      if (allActorsPresent &&
+          !this->Internal->ClippingOn &&
+          !this->Internal->ModelHierarchiesPresent)
+        {
+        std::map<std::string, vtkMTimeType>::iterator updateTimeIt =
+          this->Internal->DisplayedNodeUpdateTimes.find(model->GetID());
+        if (updateTimeIt != this->Internal->DisplayedNodeUpdateTimes.end() &&
+            updateTimeIt->second == modelUpdateTime)
+          {
+          continue;
+          }
+        }
+
       this->UpdateModifiedModel(model);
+      this->Internal->DisplayedNodeUpdateTimes[model->GetID()] = modelUpdateTime;
       }
     }
 }
@@ -1386,6 +1518,7 @@ void vtkMRMLModelDisplayableManager::RemoveDisplayable(vtkMRMLDisplayableNode* m
     }
   this->RemoveDisplayableNodeObservers(model);
   this->Internal->DisplayableNodes.erase(model->GetID());
+  this->Internal->DisplayedNodeUpdateTimes.erase(model->GetID());
 }
 
 //---------------------------------------------------------------------------
@@ -1841,6 +1974,10 @@ int vtkMRMLModelDisplayableManager::Pick(int x, int y)
   displayPoint[1] = renSize[1] - y;
   displayPoint[2] = 0.0;
 
+  // Make sure each displayed mesh has an up-to-date cell locator in the
+  // picker so the pick cost is logarithmic in the number of cells per model
+  this->Internal->UpdatePickLocators();
+
   if (this->Internal->CellPicker->Pick(displayPoint[0], displayPoint[1], displayPoint[2], ren))
     {
     this->Internal->CellPicker->GetPickPosition(pickPoint);
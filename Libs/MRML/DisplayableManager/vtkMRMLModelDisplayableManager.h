@@ -169,7 +169,12 @@ protected:
 
   /// Returns true if something visible in modelNode has changed and would
   /// require a refresh.
-  bool OnMRMLDisplayableModelNodeModifiedEvent(vtkMRMLDisplayableNode * modelNode);
+  /// When \a modifiedDisplayNode is given (display node carried by a
+  /// DisplayModifiedEvent), only that display node's state is compared
+  /// against what the actors show; changes to display nodes that are not
+  /// visible then do not trigger a model update or render.
+  bool OnMRMLDisplayableModelNodeModifiedEvent(vtkMRMLDisplayableNode * modelNode,
+                                               vtkMRMLDisplayNode* modifiedDisplayNode = 0);
 
   /// Updates Actors based on models in the scene
   virtual void UpdateFromMRML() VTK_OVERRIDE;
@@ -54,6 +54,7 @@
 #include <vtkTransformPolyDataFilter.h>
 #include <vtkWeakPointer.h>
 #include <vtkPointLocator.h>
+#include <vtkAddonMathUtilities.h>
 
 // VTK includes: customization
 #if VTK_MAJOR_VERSION >= 9
@@ -463,9 +464,11 @@ void vtkMRMLModelSliceDisplayableManager::vtkInternal
   pipeline->ModelWarper->SetInputData(pointSet); //why here? +connection?
   pipeline->ModelWarper->SetTransform(pipeline->NodeToWorld);
 
-  //  Set Plane Transform
+  //  Set Plane Transform.
+  // The plane is only modified if its normal or origin actually changed,
+  // so the cutter can reuse its cached output when the update was triggered
+  // by a display property change or an in-plane pan/zoom of the slice view.
   this->SetSlicePlaneFromMatrix(this->SliceXYToRAS, pipeline->Plane);
-  pipeline->Plane->Modified();
 
   if (modelDisplayNode->GetSliceDisplayMode() == vtkMRMLModelDisplayNode::SliceDisplayProjection
     || modelDisplayNode->GetSliceDisplayMode() == vtkMRMLModelDisplayNode::SliceDisplayDistanceEncodedProjection)
@@ -491,7 +494,10 @@ void vtkMRMLModelSliceDisplayableManager::vtkInternal
     rasToSliceXY->SetElement(2, 0, 0);
     rasToSliceXY->SetElement(2, 1, 0);
     rasToSliceXY->SetElement(2, 2, 0);
-    pipeline->TransformToSlice->SetMatrix(rasToSliceXY.GetPointer());
+    if (!vtkAddonMathUtilities::MatrixAreEqual(rasToSliceXY.GetPointer(), pipeline->TransformToSlice->GetMatrix()))
+      {
+      pipeline->TransformToSlice->SetMatrix(rasToSliceXY.GetPointer());
+      }
     }
   else
     {
@@ -504,8 +510,12 @@ void vtkMRMLModelSliceDisplayableManager::vtkInternal
 
     // optimization for slice to slice intersections which are 1 quad polydatas
     // no need for 50^3 default locator divisons
-    if (pointSet->GetPoints() != NULL && pointSet->GetNumberOfPoints() <= 4)
+    if (pointSet->GetPoints() != NULL && pointSet->GetNumberOfPoints() <= 4
+      && pipeline->Cutter->GetLocator() == NULL)
     {
+      // The cutter re-initializes point insertion into the locator on each
+      // execution, so the locator only has to be created and set once;
+      // setting a new one on every update would needlessly modify the cutter.
       vtkNew<vtkPointLocator> locator;
       double *bounds = pointSet->GetBounds();
       locator->SetDivisions(2, 2, 2);
@@ -518,7 +528,10 @@ void vtkMRMLModelSliceDisplayableManager::vtkInternal
     //  Set Poly Data Transform
     vtkNew<vtkMatrix4x4> rasToSliceXY;
     vtkMatrix4x4::Invert(this->SliceXYToRAS, rasToSliceXY.GetPointer());
-    pipeline->TransformToSlice->SetMatrix(rasToSliceXY.GetPointer());
+    if (!vtkAddonMathUtilities::MatrixAreEqual(rasToSliceXY.GetPointer(), pipeline->TransformToSlice->GetMatrix()))
+      {
+      pipeline->TransformToSlice->SetMatrix(rasToSliceXY.GetPointer());
+      }
     }
 
   // Update pipeline actor
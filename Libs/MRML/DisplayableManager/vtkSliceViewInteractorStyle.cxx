@@ -37,6 +37,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkCommand.h"
 #include "vtkNew.h"
+#include "vtkTimerLog.h"
 
 //STL includes
 #include <algorithm>
@@ -63,6 +64,9 @@ vtkSliceViewInteractorStyle::vtkSliceViewInteractorStyle()
   this->VolumeScalarRange[1] = 0;
   this->StartActionSegmentationDisplayNode = 0;
 
+  this->FrameTimeBudget = 0.1;
+  this->LastMoveEventTime = 0.;
+
   this->LastForegroundOpacity = 0.;
   this->LastLabelOpacity = 0.;
   this->LastEventPosition[0] = 0;
@@ -79,6 +83,33 @@ vtkSliceViewInteractorStyle::~vtkSliceViewInteractorStyle()
   this->SetSliceLogic(0);
 }
 
+//----------------------------------------------------------------------------
+void vtkSliceViewInteractorStyle::SetActionState(int state)
+{
+  if (this->ActionState == state)
+    {
+    return;
+    }
+  int reslicingDrags = vtkSliceViewInteractorStyle::Translate
+    | vtkSliceViewInteractorStyle::Zoom
+    | vtkSliceViewInteractorStyle::Rotate;
+  bool wasReslicingDrag = (this->ActionState & reslicingDrags) != 0;
+  this->ActionState = state;
+  if ((state & reslicingDrags) != 0)
+    {
+    // new reslicing drag: the frame-time governor starts measuring from
+    // the first mouse move event
+    this->LastMoveEventTime = 0.;
+    }
+  else if (wasReslicingDrag && this->SliceLogic)
+    {
+    // drag ended: restore full-quality resampling (no-op if the governor
+    // never engaged)
+    this->SliceLogic->SetLayersInteractiveResampling(0);
+    }
+  this->Modified();
+}
+
 //----------------------------------------------------------------------------
 void vtkSliceViewInteractorStyle::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -448,6 +479,24 @@ void vtkSliceViewInteractorStyle::OnMouseMove()
   int* windowSize = this->GetInteractor()->GetRenderWindow()->GetSize();
   double windowMinSize = std::min(windowSize[0], windowSize[1]);
 
+  // Frame-time governor: when move events of a reslicing drag arrive slower
+  // than the budget the view cannot keep up, switch the slice layers to
+  // cheap nearest neighbor resampling for the rest of the drag.
+  // SetActionState() restores full quality when the drag ends.
+  if (this->FrameTimeBudget > 0. && this->SliceLogic
+      && (this->GetActionState() & (vtkSliceViewInteractorStyle::Translate
+                                    | vtkSliceViewInteractorStyle::Zoom
+                                    | vtkSliceViewInteractorStyle::Rotate)) != 0)
+    {
+    double now = vtkTimerLog::GetUniversalTime();
+    if (this->LastMoveEventTime > 0.
+        && now - this->LastMoveEventTime > this->FrameTimeBudget)
+      {
+      this->SliceLogic->SetLayersInteractiveResampling(1);
+      }
+    this->LastMoveEventTime = now;
+    }
+
   switch (this->GetActionState())
     {
     case vtkSliceViewInteractorStyle::Translate:
@@ -92,7 +92,17 @@ public:
       | BrowseSlice | ShowSlice | AdjustLightbox | SelectVolume | SetCursorPosition
     };
   vtkGetMacro(ActionState, int);
-  vtkSetMacro(ActionState, int);
+  void SetActionState(int state);
+
+  /// Budget (in seconds) for a frame during click-drag interactions that
+  /// re-reslice the view (Translate, Zoom, Rotate). When the time between
+  /// consecutive mouse move events of such a drag exceeds the budget, the
+  /// slice layers are switched to nearest neighbor resampling for the rest
+  /// of the drag (\sa vtkMRMLSliceLogic::SetLayersInteractiveResampling());
+  /// full quality is restored when the drag ends. 0 disables the governor.
+  /// Default is 0.1 s, so views that keep up at 10 fps are never degraded.
+  vtkSetMacro(FrameTimeBudget, double);
+  vtkGetMacro(FrameTimeBudget, double);
 
   /// Enable/disable the specified action (Translate, Zoom, Blend, etc.).
   /// Multiple actions can be specifed by providing the sum of action ids.
@@ -184,6 +194,12 @@ protected:
   double VolumeScalarRange[2];
   vtkMRMLSegmentationDisplayNode* StartActionSegmentationDisplayNode;
 
+  double FrameTimeBudget;
+  /// Time of the last mouse move event of the current reslicing drag,
+  /// 0 when no move event has been seen yet.
+  /// \sa FrameTimeBudget
+  double LastMoveEventTime;
+
   int LastEventPosition[2];
   double LastForegroundOpacity;
   double LastLabelOpacity;
@@ -22,6 +22,7 @@
 // STD includes
 #include <cstring>
 #include <iostream>
+#include <set>
 
 namespace
 {
@@ -346,7 +347,8 @@ bool extract_tar(const char* tarFileName, bool verbose, bool extract, std::vecto
 //-----------------------------------------------------------------------------
 // creates a zip file with the full contents of the directory (recurses)
 // zip entries will include relative path of including tail of directoryToZip
-bool zip(const char* zipFileName, const char* directoryToZip)
+bool zip(const char* zipFileName, const char* directoryToZip,
+         int compressionLevel)
 {
 
   //
@@ -388,7 +390,9 @@ bool zip(const char* zipFileName, const char* directoryToZip)
   // now zip it up using LibArchive
   struct archive *zipArchive;
   struct archive_entry *entry, *dirEntry;
-  char buff[BUFSIZ];
+  // copy in large chunks so the disk reads don't dominate the save;
+  // BUFSIZ (often 8kb) is far too small for multi-gigabyte bundles
+  std::vector<char> buff(1024 * 1024);
   size_t len;
   // have to read the contents of the files to add them to the archive
   FILE *fd;
@@ -401,10 +405,22 @@ bool zip(const char* zipFileName, const char* directoryToZip)
 #else
   std::string compression_type = "store";
 #endif
+  if (compressionLevel == 0)
+    {
+    // level 0 stores the entries uncompressed; most of the bulk of a
+    // scene bundle is typically in already-compressed payload files
+    // where deflating again costs minutes and saves next to nothing
+    compression_type = "store";
+    }
 
   archive_write_set_format_zip(zipArchive);
 
   archive_write_set_format_option(zipArchive, "zip", "compression", compression_type.c_str());
+  if (compressionLevel > 0 && compression_type == "deflate")
+    {
+    char level[2] = { (char)('0' + (compressionLevel > 9 ? 9 : compressionLevel)), '\0' };
+    archive_write_set_format_option(zipArchive, "zip", "compression-level", level);
+    }
 
   archive_write_open_filename(zipArchive, zipFileName);
 
@@ -455,11 +471,11 @@ bool zip(const char* zipFileName, const char* directoryToZip)
       }
     else
       {
-      len = fread(buff, sizeof(char), sizeof(buff), fd);
+      len = fread(&buff[0], sizeof(char), buff.size(), fd);
       while ( len > 0 )
         {
-        archive_write_data(zipArchive, buff, len);
-        len = fread(buff, sizeof(char), sizeof(buff), fd);
+        archive_write_data(zipArchive, &buff[0], len);
+        len = fread(&buff[0], sizeof(char), buff.size(), fd);
         }
       fclose(fd);
       }
@@ -526,8 +542,9 @@ bool unzip(const char* zipFileName, const char* destinationDirectory)
   // we will typically have zip files, but support all archive types (why not?)
   archive_read_support_filter_all(zipArchive);
   archive_read_support_format_all(zipArchive);
-  // Note: the 10240 is just a suggested block size
-  result = archive_read_open_filename(zipArchive, zipFileName, 10240);
+  // Note: the block size is just a suggestion; reading in large blocks
+  // keeps the extraction of big bundles from being dominated by IO calls
+  result = archive_read_open_filename(zipArchive, zipFileName, 1024 * 1024);
   if (result != ARCHIVE_OK)
     {
     vtkArchiveTools::Error("Unzip:", "Cannot open archive file");
@@ -629,3 +646,131 @@ bool unzip(const char* zipFileName, const char* destinationDirectory)
 
   return (result == ARCHIVE_OK);
 }
+
+//-----------------------------------------------------------------------------
+bool unzip_select(const char* zipFileName, const char* destinationDirectory,
+                  const std::vector<std::string>& fileNames)
+{
+  //
+  // Same structure as unzip(), but only the requested entries are written
+  // out; the data of every other entry is skipped, which for zip archives
+  // seeks past the compressed bytes without decompressing them.
+  //
+
+  if ( !zipFileName || !destinationDirectory )
+    {
+    vtkArchiveTools::Error("UnzipSelect:", "Invalid zipfile or directory");
+    return false;
+    }
+
+  if ( !vtksys::SystemTools::FileExists(zipFileName) )
+    {
+    vtkArchiveTools::Error("UnzipSelect:", "Zip file does not exist");
+    return false;
+    }
+
+  if ( !vtksys::SystemTools::FileIsDirectory(destinationDirectory) )
+    {
+    vtkArchiveTools::Error("UnzipSelect:", "Destination is not a directory");
+    return false;
+    }
+
+  std::string cwd = vtksys::SystemTools::GetCurrentWorkingDirectory(true);
+
+  if ( vtksys::SystemTools::ChangeDirectory(destinationDirectory) )
+    {
+    vtkArchiveTools::Error("UnzipSelect:", "could not change to destination directory");
+    return false;
+    }
+
+  std::set<std::string> requestedFiles(fileNames.begin(), fileNames.end());
+
+  struct archive *zipArchive;
+  struct archive *diskDestination;
+  struct archive_entry *entry;
+  int result;
+
+  zipArchive = archive_read_new();
+  archive_read_support_filter_all(zipArchive);
+  archive_read_support_format_all(zipArchive);
+  result = archive_read_open_filename(zipArchive, zipFileName, 1024 * 1024);
+  if (result != ARCHIVE_OK)
+    {
+    vtkArchiveTools::Error("UnzipSelect:", "Cannot open archive file");
+    return false;
+    }
+
+  diskDestination = archive_write_disk_new();
+  archive_write_disk_set_standard_lookup(diskDestination);
+
+  bool success = true;
+  for (;;)
+    {
+    result = archive_read_next_header(zipArchive, &entry);
+    if (result == ARCHIVE_EOF)
+      {
+      break;
+      }
+    if (result != ARCHIVE_OK)
+      {
+      vtkArchiveTools::Error("UnzipSelect error:", archive_error_string(zipArchive));
+      if (result < ARCHIVE_WARN)
+        {
+        success = false;
+        break;
+        }
+      }
+    std::string entryName = archive_entry_pathname(entry);
+    std::set<std::string>::iterator requested = requestedFiles.find(entryName);
+    if (requested == requestedFiles.end())
+      {
+      archive_read_data_skip(zipArchive);
+      continue;
+      }
+    requestedFiles.erase(requested);
+    result = archive_write_header(diskDestination, entry);
+    if (result != ARCHIVE_OK)
+      {
+      vtkArchiveTools::Error("UnzipSelect error:", archive_error_string(diskDestination));
+      if (result < ARCHIVE_WARN)
+        {
+        success = false;
+        break;
+        }
+      archive_read_data_skip(zipArchive);
+      }
+    else
+      {
+      if (copy_data(zipArchive, diskDestination) != ARCHIVE_OK)
+        {
+        vtkArchiveTools::Error("UnzipSelect error:", "could not extract entry data");
+        success = false;
+        break;
+        }
+      }
+    // stop reading as soon as everything requested has been extracted
+    if (requestedFiles.empty())
+      {
+      break;
+      }
+    }
+
+  if (!requestedFiles.empty())
+    {
+    vtkArchiveTools::Error("UnzipSelect:", "some requested entries were not found in the archive");
+    success = false;
+    }
+
+  archive_read_close(zipArchive);
+  archive_read_free(zipArchive);
+  archive_write_close(diskDestination);
+  archive_write_free(diskDestination);
+
+  if ( vtksys::SystemTools::ChangeDirectory(cwd.c_str()) )
+    {
+    vtkArchiveTools::Error("UnzipSelect:", "could not change back to working directory");
+    return false;
+    }
+
+  return success;
+}
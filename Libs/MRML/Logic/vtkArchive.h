@@ -37,11 +37,25 @@ VTK_MRML_LOGIC_EXPORT bool extract_tar(const char* tarFileName, bool verbose, bo
 
 // creates a zip file with the full contents of the directory (recurses)
 // zip entries will include relative path of including tail of directoryToZip
-VTK_MRML_LOGIC_EXPORT bool zip(const char* zipFileName, const char* directoryToZip);
+// compressionLevel selects the entry codec per save: -1 keeps the library
+// default deflate level, 0 stores entries uncompressed (fastest, useful for
+// bundles whose payload files are already compressed), 1 (fast) to
+// 9 (small) select the deflate level
+VTK_MRML_LOGIC_EXPORT bool zip(const char* zipFileName, const char* directoryToZip,
+                               int compressionLevel = -1);
 
 // unzips zip file into specified directory
 // (internally this supports many formats of archive, not just zip)
 VTK_MRML_LOGIC_EXPORT bool unzip(const char* zipFileName, const char *destinationDirectory);
+
+// extracts only the named entries of the zip file into the specified
+// directory. The data of the other entries is skipped without being
+// decompressed, so pulling a few files out of a large bundle costs a
+// fraction of a full unzip. Entry names must match the paths reported by
+// list_archive. Returns false if an entry could not be written or one of
+// the requested names was not found in the archive.
+VTK_MRML_LOGIC_EXPORT bool unzip_select(const char* zipFileName, const char* destinationDirectory,
+                                        const std::vector<std::string>& fileNames);
 #ifdef __cplusplus
 }
 #endif
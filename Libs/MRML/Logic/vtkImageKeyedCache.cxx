@@ -0,0 +1,179 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkImageKeyedCache.cxx,v $
+  Date:      $Date$
+  Version:   $Revision$
+
+=========================================================================auto=*/
+#include "vtkImageKeyedCache.h"
+
+// VTK includes
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkObjectFactory.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+
+vtkStandardNewMacro(vtkImageKeyedCache);
+
+//----------------------------------------------------------------------------
+vtkImageKeyedCache::vtkImageKeyedCache()
+{
+  this->Enabled = 0;
+  this->MaximumNumberOfEntries = 12;
+}
+
+//----------------------------------------------------------------------------
+vtkImageKeyedCache::~vtkImageKeyedCache()
+{
+}
+
+//----------------------------------------------------------------------------
+void vtkImageKeyedCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << this->Enabled << "\n";
+  os << indent << "MaximumNumberOfEntries: " << this->MaximumNumberOfEntries << "\n";
+  os << indent << "NumberOfEntries: " << this->Entries.size() << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkImageKeyedCache::SetCacheKey(const std::string& key)
+{
+  if (this->CacheKey == key)
+    {
+    return;
+    }
+  this->CacheKey = key;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+const std::string& vtkImageKeyedCache::GetCacheKey()const
+{
+  return this->CacheKey;
+}
+
+//----------------------------------------------------------------------------
+void vtkImageKeyedCache::InvalidateAll()
+{
+  if (this->Entries.empty())
+    {
+    return;
+    }
+  this->Entries.clear();
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+vtkImageData* vtkImageKeyedCache::FindEntry(int wholeExtent[6])
+{
+  if (this->CacheKey.empty())
+    {
+    return NULL;
+    }
+  for (std::list<CacheEntry>::iterator entryIt = this->Entries.begin();
+       entryIt != this->Entries.end(); ++entryIt)
+    {
+    if (entryIt->first != this->CacheKey)
+      {
+      continue;
+      }
+    int entryExtent[6];
+    entryIt->second->GetExtent(entryExtent);
+    for (int i = 0; i < 6; i++)
+      {
+      if (entryExtent[i] != wholeExtent[i])
+        {
+        // same key but different viewport size: the entry is unusable
+        this->Entries.erase(entryIt);
+        return NULL;
+        }
+      }
+    // move the entry to the front of the LRU list
+    this->Entries.splice(this->Entries.begin(), this->Entries, entryIt);
+    return this->Entries.front().second;
+    }
+  return NULL;
+}
+
+//----------------------------------------------------------------------------
+int vtkImageKeyedCache::RequestUpdateExtent(
+  vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector,
+  vtkInformationVector* vtkNotUsed(outputVector))
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+
+  int wholeExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+
+  int updateExtent[6];
+  for (int i = 0; i < 6; i++)
+    {
+    updateExtent[i] = wholeExtent[i];
+    }
+  if (this->Enabled && this->FindEntry(wholeExtent) != NULL)
+    {
+    // the cached image will be served: an extent must still be requested,
+    // so ask upstream for a single voxel to keep its work negligible
+    updateExtent[1] = updateExtent[0];
+    updateExtent[3] = updateExtent[2];
+    updateExtent[5] = updateExtent[4];
+    }
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), updateExtent, 6);
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkImageKeyedCache::RequestData(
+  vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector,
+  vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0]);
+  vtkImageData* output = vtkImageData::GetData(outputVector);
+  if (input == NULL || output == NULL)
+    {
+    return 0;
+    }
+
+  if (!this->Enabled)
+    {
+    output->ShallowCopy(input);
+    this->Entries.clear();
+    return 1;
+    }
+
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  int wholeExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+
+  vtkImageData* cached = this->FindEntry(wholeExtent);
+  if (cached != NULL)
+    {
+    output->ShallowCopy(cached);
+    return 1;
+    }
+
+  output->ShallowCopy(input);
+  if (!this->CacheKey.empty())
+    {
+    // the input buffer is reused by the upstream filter, so the entry
+    // needs its own copy
+    vtkSmartPointer<vtkImageData> entryImage = vtkSmartPointer<vtkImageData>::New();
+    entryImage->DeepCopy(input);
+    this->Entries.push_front(CacheEntry(this->CacheKey, entryImage));
+    while (static_cast<int>(this->Entries.size()) > this->MaximumNumberOfEntries)
+      {
+      this->Entries.pop_back();
+      }
+    }
+  return 1;
+}
@@ -0,0 +1,105 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkImageKeyedCache.h,v $
+  Date:      $Date$
+  Version:   $Revision$
+
+=========================================================================auto=*/
+
+#ifndef __vtkImageKeyedCache_h
+#define __vtkImageKeyedCache_h
+
+#include "vtkImageAlgorithm.h"
+#include "vtkSmartPointer.h"
+
+#include "vtkMRMLLogicExport.h"
+
+// STD includes
+#include <list>
+#include <string>
+
+class vtkImageData;
+
+/// \brief Keep copies of recently produced images keyed by a caller key.
+///
+/// Placed at the tail of the slice blend pipeline, this filter keeps a
+/// small least-recently-used list of its past outputs, each stored under
+/// a key supplied by the caller with SetCacheKey(). When the current key
+/// matches a stored entry, the entry is served as the output and only a
+/// minimal extent is requested from the upstream reslice/color/blend
+/// filters, so revisiting a recently displayed slice (e.g. scrolling
+/// back and forth through offsets) costs a copy instead of a full
+/// pipeline execution.
+///
+/// The caller is responsible for building a key that changes whenever
+/// any pipeline input changes (slice pose, volume and display node
+/// modification times, compositing settings...); a key that misses an
+/// input leaves a stale image on screen until the key changes.
+/// When the filter is disabled (the default) it is a plain
+/// shallow-copy passthrough.
+/// \sa vtkMRMLSliceLogic::GetSliceImageCache(), vtkImageTileCache
+class VTK_MRML_LOGIC_EXPORT vtkImageKeyedCache : public vtkImageAlgorithm
+{
+public:
+  static vtkImageKeyedCache *New();
+  vtkTypeMacro(vtkImageKeyedCache,vtkImageAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  ///
+  /// Enable serving cached images. When disabled the filter is a plain
+  /// shallow-copy passthrough and no entries are stored.
+  /// Disabled by default.
+  vtkSetMacro(Enabled, int);
+  vtkGetMacro(Enabled, int);
+  vtkBooleanMacro(Enabled, int);
+
+  ///
+  /// Maximum number of cached images kept. When the limit is reached
+  /// the least recently used entry is discarded.
+  vtkSetClampMacro(MaximumNumberOfEntries, int, 1, 64);
+  vtkGetMacro(MaximumNumberOfEntries, int);
+
+  ///
+  /// Key identifying the current pipeline configuration. The next
+  /// update serves the stored image when an entry with the same key
+  /// exists, and stores the computed image under this key otherwise.
+  /// An empty key disables both lookups and stores.
+  void SetCacheKey(const std::string& key);
+  const std::string& GetCacheKey()const;
+
+  ///
+  /// Discard all cached entries.
+  void InvalidateAll();
+
+protected:
+  vtkImageKeyedCache();
+  ~vtkImageKeyedCache();
+
+  virtual int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) VTK_OVERRIDE;
+  virtual int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) VTK_OVERRIDE;
+
+  /// Return the image stored under the current key, or NULL.
+  /// A found entry is moved to the front of the LRU list.
+  /// Entries whose extent does not match wholeExtent are discarded.
+  vtkImageData* FindEntry(int wholeExtent[6]);
+
+  int Enabled;
+  int MaximumNumberOfEntries;
+  std::string CacheKey;
+
+  typedef std::pair<std::string, vtkSmartPointer<vtkImageData> > CacheEntry;
+  /// Most recently used entries first
+  std::list<CacheEntry> Entries;
+
+private:
+  vtkImageKeyedCache(const vtkImageKeyedCache&);  /// Not implemented.
+  void operator=(const vtkImageKeyedCache&);  /// Not implemented.
+};
+
+#endif
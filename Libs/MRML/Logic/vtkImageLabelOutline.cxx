@@ -43,6 +43,46 @@ vtkImageLabelOutline::~vtkImageLabelOutline()
 //----------------------------------------------------------------------------
 
 
+// Description:
+// Returns 1 if any pixel of the neighborhood has a different value than the
+// center pixel, 0 otherwise. The neighborhood must be entirely inside the
+// input domain: no boundary check is performed, which keeps the inner loop
+// free of data-dependent branches so the compiler can vectorize the
+// comparisons.
+template <class T>
+static int vtkImageLabelOutlineAnyNeighborDiffers(
+  T *inPtr0, T centerValue,
+  int hoodMin0, int hoodMax0,
+  int hoodMin1, int hoodMax1,
+  int hoodMin2, int hoodMax2,
+  vtkIdType inInc0, vtkIdType inInc1, vtkIdType inInc2)
+{
+  // start at lower left pixel
+  T *hoodPtr2 = inPtr0 + hoodMin0 * inInc0
+                       + hoodMin1 * inInc1
+                       + hoodMin2 * inInc2;
+  for (int hoodIdx2 = hoodMin2; hoodIdx2 <= hoodMax2; ++hoodIdx2)
+    {
+    T *hoodPtr1 = hoodPtr2;
+    for (int hoodIdx1 = hoodMin1; hoodIdx1 <= hoodMax1; ++hoodIdx1)
+      {
+      T *hoodPtr0 = hoodPtr1;
+      for (int hoodIdx0 = hoodMin0; hoodIdx0 <= hoodMax0; ++hoodIdx0)
+        {
+        if (*hoodPtr0 != centerValue)
+          {
+          return 1;
+          }
+        hoodPtr0 += inInc0;
+        }
+      hoodPtr1 += inInc1;
+      }
+    hoodPtr2 += inInc2;
+    }
+  return 0;
+}
+
+//----------------------------------------------------------------------------
 // Description:
 // This templated function executes the filter for any type of data.
 template <class T>
@@ -61,8 +101,9 @@ static void vtkImageLabelOutlineExecute(vtkImageLabelOutline *self,
   T *outPtr0, *outPtr1, *outPtr2;
   // For looping through hood pixels
   int hoodMin0, hoodMax0, hoodMin1, hoodMax1, hoodMin2, hoodMax2;
-  int hoodIdx0, hoodIdx1, hoodIdx2;
-  T *hoodPtr0, *hoodPtr1, *hoodPtr2;
+  // Range of pixels whose whole neighborhood is inside the input domain
+  int interiorMin0, interiorMax0;
+  int sliceIsInterior, rowIsInterior;
   // The extent of the whole input image
   int inImageMin0, inImageMin1, inImageMin2;
   int inImageMax0, inImageMax1, inImageMax2;
@@ -105,6 +146,12 @@ static void vtkImageLabelOutlineExecute(vtkImageLabelOutline *self,
   hoodMax1 = outline;
   hoodMax2 = 0;
 
+  // Pixels in this range along the first axis have their whole neighborhood
+  // inside the input domain (together with the per-slice and per-row checks
+  // below), so the neighborhood can be scanned without boundary checks.
+  interiorMin0 = inImageMin0 - hoodMin0;
+  interiorMax0 = inImageMax0 - hoodMax0;
+
   // in and out should be marching through corresponding pixels.
   inPtr = (T *)(inData->GetScalarPointer(outMin0, outMin1, outMin2));
 
@@ -118,9 +165,14 @@ static void vtkImageLabelOutlineExecute(vtkImageLabelOutline *self,
     {
     outPtr1 = outPtr2;
     inPtr1 = inPtr2;
+    sliceIsInterior = (outIdx2 + hoodMin2 >= inImageMin2 &&
+                       outIdx2 + hoodMax2 <= inImageMax2);
     for (outIdx1 = outMin1;
       !self->AbortExecute && outIdx1 <= outMax1; outIdx1++)
       {
+      rowIsInterior = sliceIsInterior &&
+                      (outIdx1 + hoodMin1 >= inImageMin1 &&
+                       outIdx1 + hoodMax1 <= inImageMax1);
       if (!id)
         {
         if (!(count%target))
@@ -143,50 +195,30 @@ static void vtkImageLabelOutlineExecute(vtkImageLabelOutline *self,
         // If there is, then this is an outline pixel
         if (inLabelValue != backgroundLabelValue)
           {
-          // Loop through neighborhood pixels
-          // Note: hood pointer marches out of bounds.
-          // start at lower left pixel
-          hoodPtr2 = inPtr0 + hoodMin0 * inInc0
-                            + hoodMin1 * inInc1
-                            + hoodMin2 * inInc2;
-
-          for (hoodIdx2 = hoodMin2; hoodIdx2 <= hoodMax2; ++hoodIdx2)
+          if (rowIsInterior &&
+              outIdx0 >= interiorMin0 && outIdx0 <= interiorMax0)
             {
-            hoodPtr1 = hoodPtr2;
-            for (hoodIdx1 = hoodMin1; hoodIdx1 <= hoodMax1; ++hoodIdx1)
+            // The whole neighborhood is inside the input domain: scan it
+            // without per-pixel boundary checks and stop at the first
+            // transition.
+            // If a neighbor value is not the same label value that means
+            // this is an outline pixel (border is within neighborhood),
+            // so set the output to foreground.
+            if (vtkImageLabelOutlineAnyNeighborDiffers(
+                  inPtr0, inLabelValue,
+                  hoodMin0, hoodMax0, hoodMin1, hoodMax1,
+                  hoodMin2, hoodMax2,
+                  inInc0, inInc1, inInc2))
               {
-              hoodPtr0 = hoodPtr1;
-              for (hoodIdx0 = hoodMin0; hoodIdx0 <= hoodMax0; ++hoodIdx0)
-                {
-                // handle boundaries
-                if (outIdx0 + hoodIdx0 >= inImageMin0 &&
-                    outIdx0 + hoodIdx0 <= inImageMax0 &&
-                    outIdx1 + hoodIdx1 >= inImageMin1 &&
-                    outIdx1 + hoodIdx1 <= inImageMax1 &&
-                    outIdx2 + hoodIdx2 >= inImageMin2 &&
-                    outIdx2 + hoodIdx2 <= inImageMax2)
-                  {
-                  // If the neighbor value is not the same label value
-                  // that means this is an outline pixel
-                  // (border is within neighborhood).
-                  // so set the output to foreground
-                  if (*hoodPtr0 != inLabelValue)
-                    {
-                    *outPtr0 = inLabelValue;
-                    }
-                  }
-                else
-                  {
-                  // neighborhood reaches outside of the input
-                  // domain, so this is also an outline pixel
-                  *outPtr0 = inLabelValue;
-                  }
-                hoodPtr0 += inInc0;
-                }//for0
-              hoodPtr1 += inInc1;
-              }//for1
-            hoodPtr2 += inInc2;
-            }//for2
+              *outPtr0 = inLabelValue;
+              }
+            }
+          else
+            {
+            // The neighborhood reaches outside of the input domain,
+            // so this is also an outline pixel.
+            *outPtr0 = inLabelValue;
+            }
           }//if
         inPtr0 += inInc0;
         outPtr0 += outInc0;
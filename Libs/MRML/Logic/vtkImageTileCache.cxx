@@ -0,0 +1,203 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkImageTileCache.cxx,v $
+  Date:      $Date$
+  Version:   $Revision$
+
+=========================================================================auto=*/
+#include "vtkImageTileCache.h"
+
+// VTK includes
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkObjectFactory.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+
+// STD includes
+#include <algorithm>
+
+vtkStandardNewMacro(vtkImageTileCache);
+
+//----------------------------------------------------------------------------
+vtkImageTileCache::vtkImageTileCache()
+{
+  this->Enabled = 0;
+  this->TileSize = 64;
+  this->AllTilesDirty = 1;
+  this->DirtyRegion[0] = this->DirtyRegion[1] = 0;
+  this->DirtyRegion[2] = this->DirtyRegion[3] = 0;
+  this->HasDirtyRegion = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkImageTileCache::~vtkImageTileCache()
+{
+}
+
+//----------------------------------------------------------------------------
+void vtkImageTileCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << this->Enabled << "\n";
+  os << indent << "TileSize: " << this->TileSize << "\n";
+  os << indent << "AllTilesDirty: " << this->AllTilesDirty << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkImageTileCache::InvalidateRegion(const int region[4])
+{
+  if (this->AllTilesDirty)
+    {
+    // everything is recomputed anyway
+    return;
+    }
+  // round the region out to tile boundaries so that repeated small
+  // invalidations coalesce into whole tiles
+  int tileAligned[4];
+  tileAligned[0] = (region[0] / this->TileSize) * this->TileSize;
+  tileAligned[1] = (region[1] / this->TileSize + 1) * this->TileSize - 1;
+  tileAligned[2] = (region[2] / this->TileSize) * this->TileSize;
+  tileAligned[3] = (region[3] / this->TileSize + 1) * this->TileSize - 1;
+  if (this->HasDirtyRegion)
+    {
+    this->DirtyRegion[0] = std::min(this->DirtyRegion[0], tileAligned[0]);
+    this->DirtyRegion[1] = std::max(this->DirtyRegion[1], tileAligned[1]);
+    this->DirtyRegion[2] = std::min(this->DirtyRegion[2], tileAligned[2]);
+    this->DirtyRegion[3] = std::max(this->DirtyRegion[3], tileAligned[3]);
+    }
+  else
+    {
+    for (int i = 0; i < 4; i++)
+      {
+      this->DirtyRegion[i] = tileAligned[i];
+      }
+    this->HasDirtyRegion = 1;
+    }
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkImageTileCache::InvalidateAll()
+{
+  this->AllTilesDirty = 1;
+  this->HasDirtyRegion = 0;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+bool vtkImageTileCache::IsCacheCompatible(int wholeExtent[6], int scalarType, int numberOfComponents)
+{
+  if (this->Cache.GetPointer() == NULL)
+    {
+    return false;
+    }
+  int cacheExtent[6];
+  this->Cache->GetExtent(cacheExtent);
+  for (int i = 0; i < 6; i++)
+    {
+    if (cacheExtent[i] != wholeExtent[i])
+      {
+      return false;
+      }
+    }
+  return this->Cache->GetScalarType() == scalarType
+    && this->Cache->GetNumberOfScalarComponents() == numberOfComponents;
+}
+
+//----------------------------------------------------------------------------
+int vtkImageTileCache::RequestUpdateExtent(
+  vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector,
+  vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+
+  int wholeExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+
+  bool partialUpdate = this->Enabled && !this->AllTilesDirty && this->HasDirtyRegion
+    && this->IsCacheCompatible(wholeExtent,
+         vtkImageData::GetScalarType(outInfo),
+         vtkImageData::GetNumberOfScalarComponents(outInfo));
+
+  int updateExtent[6];
+  for (int i = 0; i < 6; i++)
+    {
+    updateExtent[i] = wholeExtent[i];
+    }
+  if (partialUpdate)
+    {
+    // clip the tile-aligned dirty region against the whole extent
+    updateExtent[0] = std::max(this->DirtyRegion[0], wholeExtent[0]);
+    updateExtent[1] = std::min(this->DirtyRegion[1], wholeExtent[1]);
+    updateExtent[2] = std::max(this->DirtyRegion[2], wholeExtent[2]);
+    updateExtent[3] = std::min(this->DirtyRegion[3], wholeExtent[3]);
+    if (updateExtent[0] > updateExtent[1] || updateExtent[2] > updateExtent[3])
+      {
+      // dirty region entirely outside the viewport: nothing upstream to
+      // recompute, but an extent must still be requested
+      for (int i = 0; i < 6; i++)
+        {
+        updateExtent[i] = wholeExtent[i];
+        }
+      }
+    }
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), updateExtent, 6);
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkImageTileCache::RequestData(
+  vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector,
+  vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0]);
+  vtkImageData* output = vtkImageData::GetData(outputVector);
+  if (input == NULL || output == NULL)
+    {
+    return 0;
+    }
+
+  if (!this->Enabled)
+    {
+    output->ShallowCopy(input);
+    this->Cache = NULL;
+    this->AllTilesDirty = 1;
+    this->HasDirtyRegion = 0;
+    return 1;
+    }
+
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  int wholeExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+  int inputExtent[6];
+  input->GetExtent(inputExtent);
+
+  if (this->IsCacheCompatible(wholeExtent,
+        input->GetScalarType(), input->GetNumberOfScalarComponents()))
+    {
+    // patch the freshly computed tiles over the cached image
+    this->Cache->CopyAndCastFrom(input, inputExtent);
+    }
+  else
+    {
+    // viewport size or pixel format changed: rebuild the cache from the
+    // full input (RequestUpdateExtent requested the whole extent)
+    this->Cache = vtkSmartPointer<vtkImageData>::New();
+    this->Cache->DeepCopy(input);
+    }
+
+  output->ShallowCopy(this->Cache);
+  this->AllTilesDirty = 0;
+  this->HasDirtyRegion = 0;
+  return 1;
+}
@@ -0,0 +1,98 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkImageTileCache.h,v $
+  Date:      $Date$
+  Version:   $Revision$
+
+=========================================================================auto=*/
+
+#ifndef __vtkImageTileCache_h
+#define __vtkImageTileCache_h
+
+#include "vtkImageAlgorithm.h"
+#include "vtkSmartPointer.h"
+
+#include "vtkMRMLLogicExport.h"
+
+class vtkImageData;
+
+/// \brief Cache pipeline output and recompute only invalidated tiles.
+///
+/// Placed at the tail of the slice blend pipeline, this filter keeps a
+/// persistent copy of its output. When callers declare that only a small
+/// region changed upstream (e.g. the pixels under a paint stroke), the
+/// filter requests just the tile-aligned bounding extent of the
+/// invalidated region from the upstream reslice/color/blend filters and
+/// patches the cached image, instead of re-executing the pipeline over
+/// the whole viewport.
+///
+/// When the filter is disabled (the default), or when a change is not
+/// localized with InvalidateRegion(), the full extent is recomputed, so
+/// behavior is never less correct than without the cache.
+/// \sa vtkMRMLSliceLogic::InvalidateSliceRegion()
+class VTK_MRML_LOGIC_EXPORT vtkImageTileCache : public vtkImageAlgorithm
+{
+public:
+  static vtkImageTileCache *New();
+  vtkTypeMacro(vtkImageTileCache,vtkImageAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  ///
+  /// Enable incremental tile updates. When disabled the filter is a
+  /// plain shallow-copy passthrough. Disabled by default.
+  vtkSetMacro(Enabled, int);
+  vtkGetMacro(Enabled, int);
+  vtkBooleanMacro(Enabled, int);
+
+  ///
+  /// Edge length of the cache tiles in pixels. Invalidated regions are
+  /// rounded out to tile boundaries before being requested upstream.
+  vtkSetClampMacro(TileSize, int, 16, 1024);
+  vtkGetMacro(TileSize, int);
+
+  ///
+  /// Declare that only the given output region (xMin, xMax, yMin, yMax,
+  /// in output pixels) changed upstream since the last update. Only the
+  /// tiles overlapping the region are recomputed on the next update.
+  /// Callers must invalidate every region that changed; a change that is
+  /// not declared leaves stale tiles on screen until InvalidateAll()
+  /// or a non-localized modification triggers a full recompute.
+  void InvalidateRegion(const int region[4]);
+
+  ///
+  /// Discard all cached tiles; the next update recomputes the full extent.
+  void InvalidateAll();
+
+protected:
+  vtkImageTileCache();
+  ~vtkImageTileCache();
+
+  virtual int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) VTK_OVERRIDE;
+  virtual int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) VTK_OVERRIDE;
+
+  /// Return true if the cached image can still be patched (matching
+  /// extent, scalar type and number of components).
+  bool IsCacheCompatible(int wholeExtent[6], int scalarType, int numberOfComponents);
+
+  int Enabled;
+  int TileSize;
+  /// When set, every tile is recomputed on the next update
+  int AllTilesDirty;
+  /// Tile-aligned bounding box of the invalidated regions
+  /// (xMin, xMax, yMin, yMax), only valid when HasDirtyRegion is set
+  int DirtyRegion[4];
+  int HasDirtyRegion;
+  vtkSmartPointer<vtkImageData> Cache;
+
+private:
+  vtkImageTileCache(const vtkImageTileCache&);  /// Not implemented.
+  void operator=(const vtkImageTileCache&);  /// Not implemented.
+};
+
+#endif
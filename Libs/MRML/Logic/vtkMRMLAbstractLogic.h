@@ -89,6 +89,48 @@ class vtkFloatArray;
 };
 #endif
 
+//----------------------------------------------------------------------------
+#ifndef vtkSetAndObserveMRMLNodeDirectMacro
+/// \brief Set and observe a MRML node with a direct connection.
+/// Same as vtkSetAndObserveMRMLNodeMacro, but the ModifiedEvent is delivered
+/// straight from the node to ProcessMRMLNodesEvents without going through
+/// vtkEventBroker: no observation record is allocated and the per event
+/// broker bookkeeping (timing, logging, queueing) is skipped. Use it for
+/// nodes that fire at interaction rate (slice node, interaction node...);
+/// keep the broker macro for rarely modified nodes so their observations
+/// stay visible to the broker tools.
+/// \sa vtkSetAndObserveMRMLNodeMacro,
+/// vtkObserverManager::ObserveObjectEventsDirect()
+#define vtkSetAndObserveMRMLNodeDirectMacro(node,value) {                     \
+  vtkObject *_oldNode = (node);                                               \
+  this->GetMRMLNodesObserverManager()->SetAndObserveObjectDirect(             \
+    vtkObjectPointer(&(node)), (value));                                      \
+  vtkObject *_newNode = (node);                                               \
+  if (_oldNode != _newNode)                                                   \
+    {                                                                         \
+    this->Modified();                                                         \
+    }                                                                         \
+};
+#endif
+
+//----------------------------------------------------------------------------
+#ifndef vtkSetAndObserveMRMLNodeEventsDirectMacro
+/// \brief Set and observe specific events of a MRML node with direct
+/// connections, bypassing vtkEventBroker.
+/// \sa vtkSetAndObserveMRMLNodeDirectMacro,
+/// vtkSetAndObserveMRMLNodeEventsMacro
+#define vtkSetAndObserveMRMLNodeEventsDirectMacro(node,value,events) {        \
+  vtkObject *_oldNode = (node);                                               \
+  this->GetMRMLNodesObserverManager()->SetAndObserveObjectEventsDirect(       \
+     vtkObjectPointer(&(node)), (value), (events));                           \
+  vtkObject *_newNode = (node);                                               \
+  if (_oldNode != _newNode)                                                   \
+    {                                                                         \
+    this->Modified();                                                         \
+    }                                                                         \
+};
+#endif
+
 #ifndef vtkObserveMRMLNodeMacro
 #define vtkObserveMRMLNodeMacro(node)                                         \
 {                                                                             \
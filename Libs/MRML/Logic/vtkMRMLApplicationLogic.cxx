@@ -39,13 +39,20 @@
 #include "vtkMRMLStorageNode.h"
 #include "vtkMRMLSceneViewNode.h"
 #include "vtkMRMLTableViewNode.h"
+#include "vtkMRMLVolumeArchetypeStorageNode.h"
+#include "vtkMRMLVolumeDisplayNode.h"
+#include "vtkMRMLVolumeNode.h"
 
 // VTK includes
 #include <vtkCollection.h>
 #include <vtkImageData.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
+#include <vtkPointData.h>
 #include <vtkSmartPointer.h>
+#include <vtkStringArray.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkZLibDataCompressor.h>
 
 // VTKSYS includes
 #include <vtksys/SystemTools.hxx>
@@ -53,6 +60,7 @@
 
 // STD includes
 #include <cassert>
+#include <set>
 #include <sstream>
 
 // For LoadDefaultParameterSets
@@ -74,6 +82,19 @@ public:
   void PropagateVolumeSelection(int layer, int fit);
   ~vtkInternal();
 
+  /// Scalars of a volume compressed by CompressInactiveVolumes()
+  struct CompressedVolumeEntry
+    {
+    vtkSmartPointer<vtkMRMLVolumeNode> Volume;
+    vtkSmartPointer<vtkUnsignedCharArray> CompressedScalars;
+    vtkIdType NumberOfTuples;
+    vtkIdType OriginalSize;
+    };
+
+  /// Collect the IDs of the volumes referenced by the slice composite
+  /// nodes and by the selection node
+  void GetActiveVolumeNodeIDs(std::set<std::string>& activeVolumeIDs);
+
   vtkMRMLApplicationLogic*        External;
   vtkSmartPointer<vtkMRMLSelectionNode>    SelectionNode;
   vtkSmartPointer<vtkMRMLInteractionNode>  InteractionNode;
@@ -83,6 +104,9 @@ public:
   vtkSmartPointer<vtkMRMLColorLogic> ColorLogic;
   std::string TemporaryPath;
 
+  vtkSmartPointer<vtkZLibDataCompressor> VolumeCompressor;
+  std::vector<CompressedVolumeEntry> CompressedVolumes;
+  vtkIdType MinimumVolumeSizeToCompress;
 };
 
 //----------------------------------------------------------------------------
@@ -95,6 +119,10 @@ vtkMRMLApplicationLogic::vtkInternal::vtkInternal(vtkMRMLApplicationLogic * exte
   this->SliceLinkLogic = vtkSmartPointer<vtkMRMLSliceLinkLogic>::New();
   this->ModelHierarchyLogic = vtkSmartPointer<vtkMRMLModelHierarchyLogic>::New();
   this->ColorLogic = vtkSmartPointer<vtkMRMLColorLogic>::New();
+  this->VolumeCompressor = vtkSmartPointer<vtkZLibDataCompressor>::New();
+  // Z_BEST_SPEED, same trade-off as the editor undo stash
+  this->VolumeCompressor->SetCompressionLevel(1);
+  this->MinimumVolumeSizeToCompress = 1024 * 1024;
 }
 
 //----------------------------------------------------------------------------
@@ -114,6 +142,22 @@ void vtkMRMLApplicationLogic::vtkInternal::PropagateVolumeSelection(int layer, i
   char *secondID = this->SelectionNode->GetSecondaryVolumeID();
   char *labelID = this->SelectionNode->GetActiveLabelVolumeID();
 
+  // the selected volumes are about to be displayed: restore their
+  // scalars if they were compressed while inactive
+  if (!this->CompressedVolumes.empty())
+    {
+    const char* selectedIDs[3] = {ID, secondID, labelID};
+    for (int volumeIndex = 0; volumeIndex < 3; volumeIndex++)
+      {
+      if (!selectedIDs[volumeIndex])
+        {
+        continue;
+        }
+      this->External->UncompressVolume(vtkMRMLVolumeNode::SafeDownCast(
+        this->External->GetMRMLScene()->GetNodeByID(selectedIDs[volumeIndex])));
+      }
+    }
+
   vtkMRMLSliceCompositeNode *cnode;
   const int nnodes = this->External->GetMRMLScene()->GetNumberOfNodesByClass("vtkMRMLSliceCompositeNode");
 
@@ -143,6 +187,53 @@ void vtkMRMLApplicationLogic::vtkInternal::PropagateVolumeSelection(int layer, i
     this->External->FitSliceToAll(true);
     }
 }
+
+//----------------------------------------------------------------------------
+void vtkMRMLApplicationLogic::vtkInternal::GetActiveVolumeNodeIDs(
+  std::set<std::string>& activeVolumeIDs)
+{
+  vtkMRMLScene* scene = this->External->GetMRMLScene();
+  if (!scene)
+    {
+    return;
+    }
+  if (this->SelectionNode)
+    {
+    const char* selectedIDs[3] =
+      {this->SelectionNode->GetActiveVolumeID(),
+       this->SelectionNode->GetSecondaryVolumeID(),
+       this->SelectionNode->GetActiveLabelVolumeID()};
+    for (int volumeIndex = 0; volumeIndex < 3; volumeIndex++)
+      {
+      if (selectedIDs[volumeIndex])
+        {
+        activeVolumeIDs.insert(selectedIDs[volumeIndex]);
+        }
+      }
+    }
+  const int nnodes = scene->GetNumberOfNodesByClass("vtkMRMLSliceCompositeNode");
+  for (int i = 0; i < nnodes; i++)
+    {
+    vtkMRMLSliceCompositeNode* cnode = vtkMRMLSliceCompositeNode::SafeDownCast(
+      scene->GetNthNodeByClass(i, "vtkMRMLSliceCompositeNode"));
+    if (!cnode)
+      {
+      continue;
+      }
+    const char* layerIDs[3] =
+      {cnode->GetBackgroundVolumeID(),
+       cnode->GetForegroundVolumeID(),
+       cnode->GetLabelVolumeID()};
+    for (int layerIndex = 0; layerIndex < 3; layerIndex++)
+      {
+      if (layerIDs[layerIndex])
+        {
+        activeVolumeIDs.insert(layerIDs[layerIndex]);
+        }
+      }
+    }
+}
+
 //----------------------------------------------------------------------------
 // vtkMRMLApplicationLogic methods
 
@@ -153,6 +244,7 @@ vtkMRMLApplicationLogic::vtkMRMLApplicationLogic()
   this->Internal->SliceLinkLogic->SetMRMLApplicationLogic(this);
   this->Internal->ModelHierarchyLogic->SetMRMLApplicationLogic(this);
   this->Internal->ColorLogic->SetMRMLApplicationLogic(this);
+  this->UseParallelCompressionDuringBundleSave = 1;
 }
 
 //----------------------------------------------------------------------------
@@ -327,6 +419,9 @@ void vtkMRMLApplicationLogic::SetMRMLSceneInternal(vtkMRMLScene *newScene)
   // Add default slice orientation presets
   vtkMRMLSliceNode::AddDefaultSliceOrientationPresets(newScene);
 
+  // stashed scalars of the previous scene are of no use anymore
+  this->Internal->CompressedVolumes.clear();
+
   this->Superclass::SetMRMLSceneInternal(newScene);
 
   this->Internal->SliceLinkLogic->SetMRMLScene(newScene);
@@ -462,10 +557,10 @@ void vtkMRMLApplicationLogic::FitSliceToAll(bool onlyIfPropagateVolumeSelectionA
 }
 
 //----------------------------------------------------------------------------
-bool vtkMRMLApplicationLogic::Zip(const char *zipFileName, const char *directoryToZip)
+bool vtkMRMLApplicationLogic::Zip(const char *zipFileName, const char *directoryToZip, int compressionLevel)
 {
   // call function in vtkArchive
-  return zip(zipFileName, directoryToZip);
+  return zip(zipFileName, directoryToZip, compressionLevel);
 }
 
 //----------------------------------------------------------------------------
@@ -503,6 +598,51 @@ std::string vtkMRMLApplicationLogic::UnpackSlicerDataBundle(const char *sdbFileP
   return( files[0] );
 }
 
+//----------------------------------------------------------------------------
+bool vtkMRMLApplicationLogic::ListSlicerDataBundle(const char *sdbFilePath, vtkStringArray *fileNames)
+{
+  if (!sdbFilePath || !fileNames)
+    {
+    vtkErrorMacro("ListSlicerDataBundle: invalid bundle file path or output array");
+    return false;
+    }
+  std::vector<std::string> files;
+  if (!list_archive(sdbFilePath, files))
+    {
+    vtkErrorMacro("ListSlicerDataBundle: could not read bundle " << sdbFilePath);
+    return false;
+    }
+  fileNames->Reset();
+  for (std::vector<std::string>::iterator fileIt = files.begin(); fileIt != files.end(); ++fileIt)
+    {
+    fileNames->InsertNextValue(fileIt->c_str());
+    }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkMRMLApplicationLogic::UnpackSlicerDataBundleFiles(const char *sdbFilePath,
+  const char *temporaryDirectory, vtkStringArray *fileNames)
+{
+  if (!fileNames || fileNames->GetNumberOfValues() == 0)
+    {
+    vtkErrorMacro("UnpackSlicerDataBundleFiles: no files requested");
+    return false;
+    }
+  std::vector<std::string> files;
+  for (vtkIdType fileIndex = 0; fileIndex < fileNames->GetNumberOfValues(); fileIndex++)
+    {
+    files.push_back(fileNames->GetValue(fileIndex));
+    }
+  if (!unzip_select(sdbFilePath, temporaryDirectory, files))
+    {
+    vtkErrorMacro("UnpackSlicerDataBundleFiles: could not extract requested files from "
+      << sdbFilePath);
+    return false;
+    }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 bool vtkMRMLApplicationLogic::OpenSlicerDataBundle(const char *sdbFilePath, const char *temporaryDirectory)
 {
@@ -665,6 +805,12 @@ bool vtkMRMLApplicationLogic::SaveSceneToSlicerDataBundleDirectory(const char *s
 
   std::map<std::string, vtkMRMLNode *> storableNodes;
 
+  // aggregated progress over the storable nodes of the main scene
+  // (additional scene view nodes written below are not counted)
+  int numberOfStorableNodes =
+    this->GetMRMLScene()->GetNumberOfNodesByClass("vtkMRMLStorableNode");
+  int numberOfWrittenNodes = 0;
+
   int numNodes = this->GetMRMLScene()->GetNumberOfNodes();
   for (int i = 0; i < numNodes; ++i)
     {
@@ -683,6 +829,14 @@ bool vtkMRMLApplicationLogic::SaveSceneToSlicerDataBundleDirectory(const char *s
       this->SaveStorableNodeToSlicerDataBundleDirectory(storableNode, dataDir);
 
       storableNodes[std::string(storableNode->GetID())] = storableNode;
+
+      ++numberOfWrittenNodes;
+      if (numberOfStorableNodes > 0)
+        {
+        double progress =
+          static_cast<double>(numberOfWrittenNodes) / numberOfStorableNodes;
+        this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+        }
     }
     if (mrmlNode->IsA("vtkMRMLSceneViewNode"))
       {
@@ -931,7 +1085,29 @@ void vtkMRMLApplicationLogic::SaveStorableNodeToSlicerDataBundleDirectory(vtkMRM
     storageNode->SetFileName(uniqueFileName.c_str());
     }
 
+  // For a compressed volume write, temporarily switch on the
+  // multi-threaded compression engine so the gzip pass of this file uses
+  // all cores. The writes of the different nodes themselves stay
+  // sequential: storage nodes touch MRML and VTK objects that are not
+  // thread-safe, so the parallelism is within each file, not across files.
+  vtkMRMLVolumeArchetypeStorageNode *archetypeStorageNode =
+    vtkMRMLVolumeArchetypeStorageNode::SafeDownCast(storageNode);
+  bool parallelCompressionEnabledForWrite = false;
+  if (this->UseParallelCompressionDuringBundleSave
+      && archetypeStorageNode
+      && archetypeStorageNode->GetUseCompression()
+      && !archetypeStorageNode->GetUseParallelCompression())
+    {
+    archetypeStorageNode->SetUseParallelCompression(1);
+    parallelCompressionEnabledForWrite = true;
+    }
+
   storageNode->WriteData(storableNode);
+
+  if (parallelCompressionEnabledForWrite)
+    {
+    archetypeStorageNode->SetUseParallelCompression(0);
+    }
  }
 
 //----------------------------------------------------------------------------
@@ -1128,3 +1304,221 @@ void vtkMRMLApplicationLogic::SetTemporaryPath(const char* path)
       }
     this->Modified();
 }
+
+//----------------------------------------------------------------------------
+int vtkMRMLApplicationLogic::CompressInactiveVolumes()
+{
+  vtkMRMLScene* scene = this->GetMRMLScene();
+  if (!scene)
+    {
+    return 0;
+    }
+
+  std::set<std::string> activeVolumeIDs;
+  this->Internal->GetActiveVolumeNodeIDs(activeVolumeIDs);
+
+  int compressedCount = 0;
+  const int nnodes = scene->GetNumberOfNodesByClass("vtkMRMLVolumeNode");
+  for (int i = 0; i < nnodes; i++)
+    {
+    vtkMRMLVolumeNode* volumeNode = vtkMRMLVolumeNode::SafeDownCast(
+      scene->GetNthNodeByClass(i, "vtkMRMLVolumeNode"));
+    if (!volumeNode || !volumeNode->GetID() ||
+        activeVolumeIDs.find(volumeNode->GetID()) != activeVolumeIDs.end())
+      {
+      continue;
+      }
+    // A volume can also be displayed without being in a slice layer, e.g.
+    // through a volume rendering display node. Skip volumes with a visible
+    // display node of any other class than the slice display nodes (those
+    // derive from vtkMRMLVolumeDisplayNode and are governed by the slice
+    // composite layers checked above), so the scalars are not freed while
+    // another renderer is consuming them.
+    bool hasVisibleDisplayNode = false;
+    const int numberOfDisplayNodes = volumeNode->GetNumberOfDisplayNodes();
+    for (int displayNodeIndex = 0; displayNodeIndex < numberOfDisplayNodes; displayNodeIndex++)
+      {
+      vtkMRMLDisplayNode* displayNode = volumeNode->GetNthDisplayNode(displayNodeIndex);
+      if (displayNode && displayNode->GetVisibility() &&
+          !displayNode->IsA("vtkMRMLVolumeDisplayNode"))
+        {
+        hasVisibleDisplayNode = true;
+        break;
+        }
+      }
+    if (hasVisibleDisplayNode)
+      {
+      continue;
+      }
+    vtkImageData* imageData = volumeNode->GetImageData();
+    vtkDataArray* scalars =
+      imageData ? imageData->GetPointData()->GetScalars() : 0;
+    if (!scalars || scalars->GetNumberOfTuples() == 0)
+      {
+      continue;
+      }
+    bool alreadyCompressed = false;
+    for (size_t entryIndex = 0;
+         entryIndex < this->Internal->CompressedVolumes.size(); ++entryIndex)
+      {
+      if (this->Internal->CompressedVolumes[entryIndex].Volume == volumeNode)
+        {
+        alreadyCompressed = true;
+        break;
+        }
+      }
+    if (alreadyCompressed)
+      {
+      continue;
+      }
+
+    vtkIdType numberOfTuples = scalars->GetNumberOfTuples();
+    vtkIdType numberOfValues = numberOfTuples * scalars->GetNumberOfComponents();
+    vtkIdType scalarSize =
+      numberOfValues * vtkDataArray::GetDataTypeSize(scalars->GetDataType());
+    if (scalarSize < this->Internal->MinimumVolumeSizeToCompress)
+      {
+      continue;
+      }
+
+    unsigned char* scalarPointer =
+      static_cast<unsigned char*>(scalars->WriteVoidPointer(0, numberOfValues));
+    vtkUnsignedCharArray* compressedBuffer =
+      this->Internal->VolumeCompressor->Compress(scalarPointer, scalarSize);
+    if (!compressedBuffer)
+      {
+      vtkWarningMacro("CompressInactiveVolumes: could not compress volume "
+                      << volumeNode->GetID());
+      continue;
+      }
+    // the compressor allocates a buffer of the uncompressed size;
+    // squeeze it down to what is actually used
+    compressedBuffer->Squeeze();
+
+    vtkInternal::CompressedVolumeEntry entry;
+    entry.Volume = volumeNode;
+    entry.CompressedScalars.TakeReference(compressedBuffer);
+    entry.NumberOfTuples = numberOfTuples;
+    entry.OriginalSize = scalarSize;
+    this->Internal->CompressedVolumes.push_back(entry);
+
+    // release the uncompressed buffer; the array object stays in place
+    // so the image data remains valid, just empty
+    scalars->SetNumberOfTuples(0);
+    scalars->Squeeze();
+    compressedCount++;
+    }
+  return compressedCount;
+}
+
+//----------------------------------------------------------------------------
+bool vtkMRMLApplicationLogic::UncompressVolume(vtkMRMLVolumeNode* volumeNode)
+{
+  if (!volumeNode)
+    {
+    return false;
+    }
+  for (size_t entryIndex = 0;
+       entryIndex < this->Internal->CompressedVolumes.size(); ++entryIndex)
+    {
+    vtkInternal::CompressedVolumeEntry& entry =
+      this->Internal->CompressedVolumes[entryIndex];
+    if (entry.Volume != volumeNode)
+      {
+      continue;
+      }
+    vtkImageData* imageData = volumeNode->GetImageData();
+    vtkDataArray* scalars =
+      imageData ? imageData->GetPointData()->GetScalars() : 0;
+    if (!scalars || scalars->GetNumberOfTuples() != 0)
+      {
+      // the image data was replaced or rewritten since compression:
+      // do not overwrite the new content, just drop the stash
+      vtkWarningMacro("UncompressVolume: image data of volume "
+                      << (volumeNode->GetID() ? volumeNode->GetID() : "(unknown)")
+                      << " changed since compression, discarding stored scalars");
+      this->Internal->CompressedVolumes.erase(
+        this->Internal->CompressedVolumes.begin() + entryIndex);
+      return false;
+      }
+    vtkIdType numberOfValues =
+      entry.NumberOfTuples * scalars->GetNumberOfComponents();
+    // setting the number of tuples reallocates the buffer, so the
+    // scalars can be uncompressed directly into it
+    scalars->SetNumberOfTuples(entry.NumberOfTuples);
+    unsigned char* scalarPointer =
+      static_cast<unsigned char*>(scalars->WriteVoidPointer(0, numberOfValues));
+    vtkIdType compressedSize = entry.CompressedScalars->GetNumberOfTuples();
+    this->Internal->VolumeCompressor->Uncompress(
+      entry.CompressedScalars->GetPointer(0), compressedSize,
+      scalarPointer, entry.OriginalSize);
+    scalars->Modified();
+    imageData->Modified();
+    this->Internal->CompressedVolumes.erase(
+      this->Internal->CompressedVolumes.begin() + entryIndex);
+    return true;
+    }
+  return false;
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLApplicationLogic::UncompressAllVolumes()
+{
+  while (!this->Internal->CompressedVolumes.empty())
+    {
+    vtkMRMLVolumeNode* volumeNode = this->Internal->CompressedVolumes.front().Volume;
+    if (!this->UncompressVolume(volumeNode))
+      {
+      // the entry was discarded, the loop shrank the vector anyway
+      continue;
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLApplicationLogic::SetMinimumVolumeSizeToCompress(vtkIdType sizeInBytes)
+{
+  if (this->Internal->MinimumVolumeSizeToCompress == sizeInBytes)
+    {
+    return;
+    }
+  this->Internal->MinimumVolumeSizeToCompress = sizeInBytes;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkMRMLApplicationLogic::GetMinimumVolumeSizeToCompress()const
+{
+  return this->Internal->MinimumVolumeSizeToCompress;
+}
+
+//----------------------------------------------------------------------------
+int vtkMRMLApplicationLogic::GetNumberOfCompressedVolumes()const
+{
+  return static_cast<int>(this->Internal->CompressedVolumes.size());
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkMRMLApplicationLogic::GetCompressedVolumesOriginalSize()const
+{
+  vtkIdType totalSize = 0;
+  for (size_t entryIndex = 0;
+       entryIndex < this->Internal->CompressedVolumes.size(); ++entryIndex)
+    {
+    totalSize += this->Internal->CompressedVolumes[entryIndex].OriginalSize;
+    }
+  return totalSize;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkMRMLApplicationLogic::GetCompressedVolumesCompressedSize()const
+{
+  vtkIdType totalSize = 0;
+  for (size_t entryIndex = 0;
+       entryIndex < this->Internal->CompressedVolumes.size(); ++entryIndex)
+    {
+    totalSize +=
+      this->Internal->CompressedVolumes[entryIndex].CompressedScalars->GetNumberOfTuples();
+    }
+  return totalSize;
+}
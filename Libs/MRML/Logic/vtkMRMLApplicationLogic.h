@@ -35,6 +35,8 @@ class vtkMRMLSelectionNode;
 class vtkMRMLStorableNode;
 class vtkMRMLStorageNode;
 class vtkMRMLInteractionNode;
+class vtkMRMLVolumeNode;
+class vtkStringArray;
 
 // VTK includes
 class vtkCollection;
@@ -132,8 +134,13 @@ public:
   void PropagatePlotChartSelection();
 
   /// zip the directory into a zip file
+  /// \a compressionLevel selects how the entries are compressed:
+  /// -1 (the default) keeps the archiver's default deflate level,
+  /// 0 stores the entries uncompressed (fastest, the payload files of
+  /// a scene bundle are typically compressed already), 1 (fast) to
+  /// 9 (small) select the deflate level.
   /// Returns success or failure.
-  bool Zip(const char *zipFileName, const char *directoryToZip);
+  bool Zip(const char *zipFileName, const char *directoryToZip, int compressionLevel = -1);
 
   /// unzip the zip file to the current working directory
   /// Returns success or failure.
@@ -154,9 +161,23 @@ public:
   /// Called by the qSlicerSceneWriter, which can be accessed via
   /// \sa qSlicerCoreIOManager::saveScene
   /// If screenShot is not null, use it as the screen shot for a scene view
+  /// While the storable nodes are written, vtkCommand::ProgressEvent is
+  /// invoked with the fraction of nodes written so far (call data:
+  /// double*), so observers can show aggregated progress for the save.
   /// Returns false if the save failed
   bool SaveSceneToSlicerDataBundleDirectory(const char *sdbDir, vtkImageData *screenShot = NULL);
 
+  /// When enabled, SaveSceneToSlicerDataBundleDirectory() turns on
+  /// parallel compression for the duration of each compressed volume
+  /// write, so every gzip pass of a bundle save uses all cores; the
+  /// setting of the storage node is restored after its write. Enabled
+  /// by default: the multi-member gzip stream it produces is readable
+  /// by any gzip decoder.
+  /// \sa vtkMRMLVolumeArchetypeStorageNode::SetUseParallelCompression()
+  vtkGetMacro(UseParallelCompressionDuringBundleSave, int);
+  vtkSetMacro(UseParallelCompressionDuringBundleSave, int);
+  vtkBooleanMacro(UseParallelCompressionDuringBundleSave, int);
+
   /// Open the file into a temp directory and load the scene file
   /// inside.  Note that the first mrml file found in the extracted
   /// directory will be used.
@@ -167,6 +188,23 @@ public:
   /// directory will be used.
   std::string UnpackSlicerDataBundle(const char *sdbFilePath, const char *temporaryDirectory);
 
+  /// List the files contained in a data bundle without extracting anything,
+  /// by reading only the archive headers. Returns false if the bundle
+  /// cannot be read.
+  /// \sa UnpackSlicerDataBundleFiles()
+  bool ListSlicerDataBundle(const char *sdbFilePath, vtkStringArray *fileNames);
+
+  /// Extract only the named files of a data bundle into the temporary
+  /// directory, skipping the data of every other entry without
+  /// decompressing it. Together with ListSlicerDataBundle() this allows
+  /// pulling a single data file out of a large case archive at a fraction
+  /// of the cost of a full unpack; the extracted files can then be loaded
+  /// individually. File names must match the paths returned by
+  /// ListSlicerDataBundle(). Returns false if the bundle cannot be read or
+  /// a requested file is not in it.
+  bool UnpackSlicerDataBundleFiles(const char *sdbFilePath, const char *temporaryDirectory,
+                                   vtkStringArray *fileNames);
+
   /// Load any default parameter sets into the specified scene
   /// Returns the total number of loaded parameter sets
   static int LoadDefaultParameterSets(vtkMRMLScene * scene,
@@ -197,6 +235,47 @@ public:
                             unsigned long eventID = vtkCommand::ModifiedEvent,
                             void* callData = 0);
 
+  /// Compress the scalar arrays of the volumes that are not displayed
+  /// in any slice view, not selected in the selection node and not
+  /// shown by any other visible display node (such as volume
+  /// rendering), freeing most of their memory. The scalars are
+  /// compressed with zlib at the
+  /// fastest level (the same scheme the editor uses for its undo
+  /// buffers) and the image data keeps its geometry, so a compressed
+  /// volume is still valid, just empty, for code that inspects it.
+  /// Volumes smaller than GetMinimumVolumeSizeToCompress() are left
+  /// alone. The scalars are restored by UncompressVolume(), which
+  /// PropagateVolumeSelection() calls on the volumes it is about to
+  /// display; other code that needs the voxels of a compressed volume
+  /// must call UncompressVolume() first.
+  /// Returns the number of volumes that were compressed.
+  /// \sa UncompressVolume(), UncompressAllVolumes()
+  int CompressInactiveVolumes();
+
+  /// Restore the scalars of a volume compressed by
+  /// CompressInactiveVolumes(). If the image data was replaced or
+  /// rewritten since compression the stored scalars are discarded
+  /// instead of overwriting the new content.
+  /// Returns true if the volume scalars were restored.
+  bool UncompressVolume(vtkMRMLVolumeNode* volumeNode);
+
+  /// Restore the scalars of all compressed volumes.
+  /// \sa CompressInactiveVolumes(), UncompressVolume()
+  void UncompressAllVolumes();
+
+  /// Smallest scalar array size in bytes considered by
+  /// CompressInactiveVolumes(). 1MB by default.
+  void SetMinimumVolumeSizeToCompress(vtkIdType sizeInBytes);
+  vtkIdType GetMinimumVolumeSizeToCompress()const;
+
+  /// Statistics on the currently compressed volumes: number of
+  /// volumes, total size of their scalar arrays before compression and
+  /// total size of the compressed buffers, in bytes.
+  /// \sa CompressInactiveVolumes()
+  int GetNumberOfCompressedVolumes()const;
+  vtkIdType GetCompressedVolumesOriginalSize()const;
+  vtkIdType GetCompressedVolumesCompressedSize()const;
+
   /// Return the temporary path that was set by the application
   const char* GetTemporaryPath();
 
@@ -226,6 +305,8 @@ private:
   /// from GetNthFileName(n)
   std::map<vtkMRMLStorageNode*, std::vector<std::string> > OriginalStorageNodeFileNames;
 
+  int UseParallelCompressionDuringBundleSave;
+
   vtkMRMLApplicationLogic(const vtkMRMLApplicationLogic&);
   void operator=(const vtkMRMLApplicationLogic&);
 
@@ -426,8 +426,10 @@ void vtkMRMLColorLogic::AddColorFile(const char *fileName, std::vector<std::stri
 //----------------------------------------------------------------------------
 vtkMRMLColorNode* vtkMRMLColorLogic::LoadColorFile(const char *fileName, const char *nodeName)
 {
-  // try loading it as a color table node first
-  vtkMRMLColorTableNode* node = this->CreateFileNode(fileName);
+  // try loading it as a color table node first; the read must happen right
+  // away so that a procedural color file can be detected and dispatched to
+  // the procedural reader below
+  vtkMRMLColorTableNode* node = this->CreateFileNode(fileName, false);
   vtkMRMLColorNode * addedNode = NULL;
 
   if (node)
@@ -714,7 +716,7 @@ std::vector<std::string> vtkMRMLColorLogic::FindUserColorFiles()
 }
 
 //--------------------------------------------------------------------------------
-vtkMRMLColorTableNode* vtkMRMLColorLogic::CreateFileNode(const char* fileName)
+vtkMRMLColorTableNode* vtkMRMLColorLogic::CreateFileNode(const char* fileName, bool deferColorRead)
 {
   vtkMRMLColorTableNode * ctnode =  vtkMRMLColorTableNode::New();
   ctnode->SetTypeToFile();
@@ -736,9 +738,19 @@ vtkMRMLColorTableNode* vtkMRMLColorLogic::CreateFileNode(const char* fileName)
   std::string uname( this->GetMRMLScene()->GetUniqueNameByString(basename.c_str()));
   ctnode->SetName(uname.c_str());
 
-  vtkDebugMacro("CreateFileNode: About to read user file " << fileName);
-
-  if (ctnode->GetStorageNode()->ReadData(ctnode) == 0)
+  bool fileValid = false;
+  if (deferColorRead)
+    {
+    // the table content is loaded on first use, only make sure that the
+    // file is there
+    fileValid = vtksys::SystemTools::FileExists(fileName);
+    }
+  else
+    {
+    vtkDebugMacro("CreateFileNode: About to read user file " << fileName);
+    fileValid = (ctnode->GetStorageNode()->ReadData(ctnode) != 0);
+    }
+  if (!fileValid)
     {
     vtkErrorMacro("Unable to read file as color table " << (ctnode->GetFileName() ? ctnode->GetFileName() : ""));
 
@@ -752,7 +764,18 @@ vtkMRMLColorTableNode* vtkMRMLColorLogic::CreateFileNode(const char* fileName)
       ctnode->Delete();
       return 0;
     }
-  vtkDebugMacro("CreateFileNode: finished reading user file " << fileName);
+  if (deferColorRead)
+    {
+    // Defer reading the table content until the node is actually used.
+    // Dozens of color files are registered at startup and a typical
+    // session only ever looks at a few of them.
+    vtkDebugMacro("CreateFileNode: deferring read of user file " << fileName);
+    ctnode->FileReadPendingOn();
+    }
+  else
+    {
+    vtkDebugMacro("CreateFileNode: finished reading user file " << fileName);
+    }
   ctnode->SetSingletonTag(
     this->GetFileColorNodeSingletonTag(fileName).c_str());
 
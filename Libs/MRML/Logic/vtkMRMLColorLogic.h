@@ -238,7 +238,14 @@ protected:
   vtkMRMLdGEMRICProceduralColorNode* CreatedGEMRICColorNode(int type);
   vtkMRMLColorTableNode* CreateDefaultFileNode(const std::string& colorname);
   vtkMRMLColorTableNode* CreateUserFileNode(const std::string& colorname);
-  vtkMRMLColorTableNode* CreateFileNode(const char* fileName);
+  /// Create a color table node that reads its colors from \a fileName.
+  /// If \a deferColorRead is true (default) then only the existence of the
+  /// file is checked and the table content is read on the first access to
+  /// the node's lookup table, which keeps registration of the many default
+  /// color files cheap. Pass false when the read result is needed right
+  /// away (e.g. to fall back to another reader on failure).
+  /// \sa vtkMRMLColorTableNode::GetFileReadPending()
+  vtkMRMLColorTableNode* CreateFileNode(const char* fileName, bool deferColorRead = true);
   vtkMRMLProceduralColorNode* CreateProceduralFileNode(const char* fileName);
 
   void AddLabelsNode();
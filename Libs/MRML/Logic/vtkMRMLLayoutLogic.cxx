@@ -1186,6 +1186,10 @@ vtkMRMLLayoutLogic::vtkMRMLLayoutLogic()
   this->LastValidViewArrangement = vtkMRMLLayoutNode::SlicerLayoutNone;
   this->ViewNodes = vtkCollection::New();
   this->ConventionalLayoutRootElement = NULL;
+  this->LastCompareViewRows = -1;
+  this->LastCompareViewColumns = -1;
+  this->LastCompareViewLightboxRows = -1;
+  this->LastCompareViewLightboxColumns = -1;
 }
 
 //----------------------------------------------------------------------------
@@ -1222,6 +1226,9 @@ void vtkMRMLLayoutLogic::UpdateFromMRMLScene()
 {
   vtkDebugMacro("vtkMRMLLayoutLogic::UpdateFromMRMLScene: got a NewScene event "
                 << this->GetProcessingMRMLSceneEvent());
+  // View nodes may have been added or removed, the cached layout description
+  // no longer guarantees that all views of the layout exist in the scene
+  this->LastUpdatedLayoutDescription.clear();
   // Create default 3D view + slice views
   this->UpdateViewNodes();
   // Create/Retrieve Layout node
@@ -1254,6 +1261,12 @@ void vtkMRMLLayoutLogic::OnMRMLSceneStartRestore()
 //----------------------------------------------------------------------------
 void vtkMRMLLayoutLogic::OnMRMLSceneEndRestore()
 {
+    // restoring a scene may have replaced view nodes and layout descriptions
+    this->LastUpdatedLayoutDescription.clear();
+    this->LastCompareViewRows = -1;
+    this->LastCompareViewColumns = -1;
+    this->LastCompareViewLightboxRows = -1;
+    this->LastCompareViewLightboxColumns = -1;
     this->UpdateLayoutNode();
 }
 
@@ -1336,6 +1349,19 @@ void vtkMRMLLayoutLogic::UpdateFromLayoutNode()
     this->LastValidViewArrangement = this->LayoutNode->GetViewArrangement();
     }
   this->UpdateCompareViewLayoutDefinitions();
+  // The layout node fires ModifiedEvent also for properties that do not
+  // change the current layout (e.g. viewport geometry). Searching the scene
+  // for the view nodes of the layout is only needed when the layout
+  // description itself changed.
+  const char* currentDescription =
+    this->LayoutNode ? this->LayoutNode->GetCurrentLayoutDescription() : NULL;
+  std::string layoutDescription(currentDescription ? currentDescription : "");
+  if (!layoutDescription.empty() &&
+      layoutDescription == this->LastUpdatedLayoutDescription)
+    {
+    return;
+    }
+  this->LastUpdatedLayoutDescription = layoutDescription;
   this->CreateMissingViews();
   this->UpdateViewCollectionsFromLayout();
 }
@@ -1350,6 +1376,25 @@ void vtkMRMLLayoutLogic::UpdateCompareViewLayoutDefinitions()
     return;
     }
 
+  // The compare layout descriptions only depend on the compare view
+  // parameters of the layout node; skip the rebuild when none of them
+  // changed since the last update.
+  int compareViewRows = this->LayoutNode->GetNumberOfCompareViewRows();
+  int compareViewColumns = this->LayoutNode->GetNumberOfCompareViewColumns();
+  int compareViewLightboxRows = this->LayoutNode->GetNumberOfCompareViewLightboxRows();
+  int compareViewLightboxColumns = this->LayoutNode->GetNumberOfCompareViewLightboxColumns();
+  if (compareViewRows == this->LastCompareViewRows &&
+      compareViewColumns == this->LastCompareViewColumns &&
+      compareViewLightboxRows == this->LastCompareViewLightboxRows &&
+      compareViewLightboxColumns == this->LastCompareViewLightboxColumns)
+    {
+    return;
+    }
+  this->LastCompareViewRows = compareViewRows;
+  this->LastCompareViewColumns = compareViewColumns;
+  this->LastCompareViewLightboxRows = compareViewLightboxRows;
+  this->LastCompareViewLightboxColumns = compareViewLightboxColumns;
+
   int wasModifying = this->LayoutNode->StartModify();
 
   // Horizonal compare viewers
@@ -1539,6 +1584,12 @@ void vtkMRMLLayoutLogic::SetLayoutNode(vtkMRMLLayoutNode* layoutNode)
     this->LayoutNode->RemoveObservers(vtkCommand::ModifiedEvent, this->GetMRMLNodesCallbackCommand());
     }
   this->LayoutNode = layoutNode;
+  // force a full update from the new layout node
+  this->LastUpdatedLayoutDescription.clear();
+  this->LastCompareViewRows = -1;
+  this->LastCompareViewColumns = -1;
+  this->LastCompareViewLightboxRows = -1;
+  this->LastCompareViewLightboxColumns = -1;
   if (this->LayoutNode)
     {
     this->LayoutNode->AddObserver(vtkCommand::ModifiedEvent, this->GetMRMLNodesCallbackCommand(), 10.);
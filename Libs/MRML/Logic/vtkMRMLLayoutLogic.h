@@ -35,6 +35,7 @@ class vtkXMLDataElement;
 
 // STD includes
 #include <cstdlib>
+#include <string>
 #include <vector>
 
 /// \brief MRML logic class for layout manipulation
@@ -178,6 +179,22 @@ protected:
   /// Up-to-date list of the nodes that are mapped into the scene
   vtkCollection*     ViewNodes;
   vtkXMLDataElement* ConventionalLayoutRootElement;
+
+  /// Layout description the view collections were last updated from.
+  /// The layout node fires ModifiedEvent also for properties that do not
+  /// change the current layout (e.g. viewport geometry); when the description
+  /// is unchanged the view node lookups in the scene are skipped.
+  /// \sa UpdateFromLayoutNode()
+  std::string        LastUpdatedLayoutDescription;
+
+  /// Compare view parameters the compare layout descriptions were last
+  /// generated from. The descriptions only depend on these values, so they
+  /// do not need to be rebuilt on every layout node modification.
+  /// \sa UpdateCompareViewLayoutDefinitions()
+  int                LastCompareViewRows;
+  int                LastCompareViewColumns;
+  int                LastCompareViewLightboxRows;
+  int                LastCompareViewLightboxColumns;
 };
 
 #endif
@@ -50,27 +50,107 @@ vtkMRMLModelHierarchyLogic::~vtkMRMLModelHierarchyLogic()
 void vtkMRMLModelHierarchyLogic::SetMRMLSceneInternal(vtkMRMLScene* newScene)
 {
   vtkNew<vtkIntArray> sceneEvents;
+  sceneEvents->InsertNextValue(vtkMRMLScene::NodeAddedEvent);
   sceneEvents->InsertNextValue(vtkMRMLScene::NodeRemovedEvent);
+  sceneEvents->InsertNextValue(vtkMRMLScene::EndBatchProcessEvent);
   this->SetAndObserveMRMLSceneEventsInternal(newScene, sceneEvents.GetPointer());
 }
 
+//----------------------------------------------------------------------------
+void vtkMRMLModelHierarchyLogic::OnMRMLSceneNodeAdded(vtkMRMLNode* node)
+{
+  if (this->GetMRMLScene()->IsBatchProcessing())
+    {
+    // Many nodes are typically added in a batch (e.g. scene import),
+    // rebuild the maps in one pass when batch processing ends
+    this->HierarchyIsModified();
+    return;
+    }
+  if (vtkMRMLModelHierarchyNode::SafeDownCast(node) || vtkMRMLModelNode::SafeDownCast(node))
+    {
+    // Callers typically add the node to the scene first and set its model and
+    // parent references afterwards, which does not change the collection
+    // mtime. Rebuild the maps at the next query so those late references are
+    // picked up; updating the maps here would record the node without them.
+    this->HierarchyIsModified();
+    return;
+    }
+  // Other node types cannot appear in the maps, so the maps still match the
+  // changed scene; keep them valid by re-stamping their mtimes
+  vtkMTimeType sceneNodesMTime = this->GetMRMLScene()->GetNodes()->GetMTime();
+  if (this->ModelHierarchyNodesMTime != 0)
+    {
+    this->ModelHierarchyNodesMTime = sceneNodesMTime;
+    }
+  if (this->HierarchyChildrenNodesMTime != 0)
+    {
+    this->HierarchyChildrenNodesMTime = sceneNodesMTime;
+    }
+}
+
 //----------------------------------------------------------------------------
 void vtkMRMLModelHierarchyLogic::OnMRMLSceneNodeRemoved(vtkMRMLNode* node)
 {
+  if (this->GetMRMLScene()->IsBatchProcessing())
+    {
+    // Many nodes are typically removed in a batch (e.g. scene close),
+    // rebuild the maps in one pass when batch processing ends
+    this->HierarchyIsModified();
+    return;
+    }
   vtkMRMLModelNode* modelNode = vtkMRMLModelNode::SafeDownCast(node);
-  if (!modelNode || this->GetMRMLScene()->IsBatchProcessing())
+  if (modelNode)
+    {
+    // A model hierarchy node is useless without a model node. Delete it.
+    vtkMRMLModelHierarchyNode* modelHierarchyNode = NULL;
+    if (this->ModelHierarchyNodesMTime != 0)
+      {
+      // The map was in sync with the scene just before the removal,
+      // look the hierarchy node up without triggering a full scene scan
+      std::map<std::string, vtkMRMLModelHierarchyNode *>::iterator modelIt =
+        this->ModelHierarchyNodes.find(std::string(modelNode->GetID() ? modelNode->GetID() : ""));
+      if (modelIt != this->ModelHierarchyNodes.end())
+        {
+        modelHierarchyNode = modelIt->second;
+        }
+      }
+    else
+      {
+      modelHierarchyNode = this->GetModelHierarchyNode(modelNode->GetID());
+      }
+    // The maps refer to the removed node, rebuild them at the next query
+    this->HierarchyIsModified();
+    if (modelHierarchyNode)
+      {
+      this->GetMRMLScene()->RemoveNode(modelHierarchyNode);
+      }
+    return;
+    }
+  if (vtkMRMLModelHierarchyNode::SafeDownCast(node))
     {
+    // The maps may refer to the removed node, rebuild them at the next query
+    this->HierarchyIsModified();
     return;
     }
-  // A model hierarchy node is useless without a model node. Delete it.
-  vtkMRMLModelHierarchyNode* modelHierarchyNode =
-    this->GetModelHierarchyNode(modelNode->GetID());
-  if (modelHierarchyNode)
+  // Other node types cannot appear in the maps, so the maps still match the
+  // changed scene; keep them valid by re-stamping their mtimes
+  vtkMTimeType sceneNodesMTime = this->GetMRMLScene()->GetNodes()->GetMTime();
+  if (this->ModelHierarchyNodesMTime != 0)
+    {
+    this->ModelHierarchyNodesMTime = sceneNodesMTime;
+    }
+  if (this->HierarchyChildrenNodesMTime != 0)
     {
-    this->GetMRMLScene()->RemoveNode(modelHierarchyNode);
+    this->HierarchyChildrenNodesMTime = sceneNodesMTime;
     }
 }
 
+//----------------------------------------------------------------------------
+void vtkMRMLModelHierarchyLogic::OnMRMLSceneEndBatchProcess()
+{
+  this->HierarchyIsModified();
+}
+
 //----------------------------------------------------------------------------
 int vtkMRMLModelHierarchyLogic::UpdateModelToHierarchyMap()
 {
@@ -308,3 +388,27 @@ void vtkMRMLModelHierarchyLogic::SetChildrenVisibility(vtkMRMLDisplayableHierarc
     scene->EndState(vtkMRMLScene::BatchProcessState);
     }
 }
+
+//----------------------------------------------------------------------------
+void vtkMRMLModelHierarchyLogic::SetVisibilityForBranch(vtkMRMLDisplayableHierarchyNode *displayableHierarchyNode,
+                                                        int visibility)
+{
+  if (displayableHierarchyNode==NULL)
+  {
+    std::cerr << "vtkMRMLModelHierarchyLogic::SetVisibilityForBranch failed: displayableHierarchyNode is invalid" << std::endl;
+    return;
+  }
+  // Keep the scene in batch processing state for the duration of the update
+  // so that observers refresh (and request rendering) only once, regardless
+  // of how many children change visibility.
+  vtkMRMLScene* scene = displayableHierarchyNode->GetScene();
+  if (scene!=NULL)
+    {
+    scene->StartState(vtkMRMLScene::BatchProcessState);
+    }
+  vtkMRMLModelHierarchyLogic::SetChildrenVisibility(displayableHierarchyNode, 0, 0, visibility);
+  if (scene!=NULL)
+    {
+    scene->EndState(vtkMRMLScene::BatchProcessState);
+    }
+}
@@ -79,6 +79,17 @@ public:
                                    const char *displayableNodeClass, const char *displayNodeClass,
                                    int visibility);
 
+  ///
+  /// Show or hide an entire hierarchy branch with a single batched update.
+  /// Sets visibility on the branch's display node and on the display nodes
+  /// of all displayable children recursively. The scene is kept in batch
+  /// processing state for the duration of the update, so observers (such as
+  /// the displayable managers) perform a single refresh instead of one per
+  /// child node.
+  /// \sa SetChildrenVisibility()
+  static void SetVisibilityForBranch(vtkMRMLDisplayableHierarchyNode *displayableHierarchyNode,
+                                     int visibility);
+
   ///
   /// Children visibility setting will be performed in batch processing mode
   /// if the number of children nodes are more than this number
@@ -95,9 +106,19 @@ protected:
   /// Reimplemented to observe the scene
   virtual void SetMRMLSceneInternal(vtkMRMLScene* newScene) VTK_OVERRIDE;
 
-  /// Delete the hierarchy node when a model is removed from the scene
+  /// Update the cached maps incrementally when a node is added to the scene,
+  /// so that a single node insertion does not force a full scene scan at the
+  /// next query
+  virtual void OnMRMLSceneNodeAdded(vtkMRMLNode* addedNode) VTK_OVERRIDE;
+
+  /// Delete the hierarchy node when a model is removed from the scene and
+  /// update the cached maps incrementally
   virtual void OnMRMLSceneNodeRemoved(vtkMRMLNode* removedNode) VTK_OVERRIDE;
 
+  /// Many nodes may have been added/removed during batch processing,
+  /// rebuild the cached maps from scratch at the next query
+  virtual void OnMRMLSceneEndBatchProcess() VTK_OVERRIDE;
+
   ///
   /// Create model to hierarchy map,
   /// return number of model hierarchy nodes
@@ -0,0 +1,62 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkMRMLSliceCompositingEngine.cxx,v $
+  Date:      $Date$
+  Version:   $Revision$
+
+=========================================================================auto=*/
+#include "vtkMRMLSliceCompositingEngine.h"
+
+// MRML includes
+#include <vtkMRMLSliceCompositeNode.h>
+#include <vtkMRMLSliceNode.h>
+#include <vtkMRMLVolumeNode.h>
+
+//----------------------------------------------------------------------------
+vtkCxxSetObjectMacro(vtkMRMLSliceCompositingEngine, SliceNode, vtkMRMLSliceNode);
+vtkCxxSetObjectMacro(vtkMRMLSliceCompositingEngine, SliceCompositeNode, vtkMRMLSliceCompositeNode);
+vtkCxxSetObjectMacro(vtkMRMLSliceCompositingEngine, BackgroundVolumeNode, vtkMRMLVolumeNode);
+vtkCxxSetObjectMacro(vtkMRMLSliceCompositingEngine, ForegroundVolumeNode, vtkMRMLVolumeNode);
+vtkCxxSetObjectMacro(vtkMRMLSliceCompositingEngine, LabelVolumeNode, vtkMRMLVolumeNode);
+
+//----------------------------------------------------------------------------
+vtkMRMLSliceCompositingEngine::vtkMRMLSliceCompositingEngine()
+{
+  this->SliceNode = 0;
+  this->SliceCompositeNode = 0;
+  this->BackgroundVolumeNode = 0;
+  this->ForegroundVolumeNode = 0;
+  this->LabelVolumeNode = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkMRMLSliceCompositingEngine::~vtkMRMLSliceCompositingEngine()
+{
+  this->SetSliceNode(0);
+  this->SetSliceCompositeNode(0);
+  this->SetBackgroundVolumeNode(0);
+  this->SetForegroundVolumeNode(0);
+  this->SetLabelVolumeNode(0);
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLSliceCompositingEngine::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "SliceNode: "
+     << (this->SliceNode ? this->SliceNode->GetID() : "(none)") << "\n";
+  os << indent << "SliceCompositeNode: "
+     << (this->SliceCompositeNode ? this->SliceCompositeNode->GetID() : "(none)") << "\n";
+  os << indent << "BackgroundVolumeNode: "
+     << (this->BackgroundVolumeNode ? this->BackgroundVolumeNode->GetID() : "(none)") << "\n";
+  os << indent << "ForegroundVolumeNode: "
+     << (this->ForegroundVolumeNode ? this->ForegroundVolumeNode->GetID() : "(none)") << "\n";
+  os << indent << "LabelVolumeNode: "
+     << (this->LabelVolumeNode ? this->LabelVolumeNode->GetID() : "(none)") << "\n";
+}
@@ -0,0 +1,93 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+  Module:    $RCSfile: vtkMRMLSliceCompositingEngine.h,v $
+  Date:      $Date$
+  Version:   $Revision$
+
+=========================================================================auto=*/
+
+#ifndef __vtkMRMLSliceCompositingEngine_h
+#define __vtkMRMLSliceCompositingEngine_h
+
+// VTK includes
+#include <vtkObject.h>
+
+#include "vtkMRMLLogicExport.h"
+
+class vtkAlgorithmOutput;
+class vtkMRMLSliceCompositeNode;
+class vtkMRMLSliceNode;
+class vtkMRMLVolumeNode;
+
+/// \brief Base class for accelerated slice reslice/compositing engines.
+///
+/// The CPU slice pipeline (vtkImageReslice, window/level mapping and
+/// vtkImageBlend, managed by vtkMRMLSliceLogic and
+/// vtkMRMLSliceLayerLogic) remains the reference implementation.
+/// A subclass implemented in a rendering-capable library can perform the
+/// oblique reslice, window/level mapping and layer compositing on the
+/// GPU and register itself with
+/// vtkMRMLSliceLogic::SetCompositingEngine(). The slice logic hands the
+/// engine the current slice geometry, compositing settings and layer
+/// volumes, and uses the engine output as the composited slice; it
+/// falls back to the CPU pipeline whenever the engine is unavailable or
+/// returns no output for the current configuration.
+class VTK_MRML_LOGIC_EXPORT vtkMRMLSliceCompositingEngine : public vtkObject
+{
+public:
+  vtkTypeMacro(vtkMRMLSliceCompositingEngine,vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  ///
+  /// True if the engine can run in the current environment (e.g. the
+  /// required GPU features are present). Checked before every update;
+  /// an engine may become unavailable at run time (lost context).
+  virtual bool IsAvailable() = 0;
+
+  ///
+  /// Slice geometry (XYToRAS, dimensions) used for reslicing
+  virtual void SetSliceNode(vtkMRMLSliceNode* sliceNode);
+  vtkGetObjectMacro(SliceNode, vtkMRMLSliceNode);
+
+  ///
+  /// Compositing mode and layer opacities
+  virtual void SetSliceCompositeNode(vtkMRMLSliceCompositeNode* compositeNode);
+  vtkGetObjectMacro(SliceCompositeNode, vtkMRMLSliceCompositeNode);
+
+  ///
+  /// Volumes to be resliced and composited, any of them may be NULL
+  virtual void SetBackgroundVolumeNode(vtkMRMLVolumeNode* volumeNode);
+  vtkGetObjectMacro(BackgroundVolumeNode, vtkMRMLVolumeNode);
+  virtual void SetForegroundVolumeNode(vtkMRMLVolumeNode* volumeNode);
+  vtkGetObjectMacro(ForegroundVolumeNode, vtkMRMLVolumeNode);
+  virtual void SetLabelVolumeNode(vtkMRMLVolumeNode* volumeNode);
+  vtkGetObjectMacro(LabelVolumeNode, vtkMRMLVolumeNode);
+
+  ///
+  /// Composited slice in XY (viewport) space, or NULL when the engine
+  /// cannot composite the current configuration (the caller then uses
+  /// the CPU pipeline instead)
+  virtual vtkAlgorithmOutput* GetOutputConnection() = 0;
+
+protected:
+  vtkMRMLSliceCompositingEngine();
+  ~vtkMRMLSliceCompositingEngine();
+
+  vtkMRMLSliceNode* SliceNode;
+  vtkMRMLSliceCompositeNode* SliceCompositeNode;
+  vtkMRMLVolumeNode* BackgroundVolumeNode;
+  vtkMRMLVolumeNode* ForegroundVolumeNode;
+  vtkMRMLVolumeNode* LabelVolumeNode;
+
+private:
+  vtkMRMLSliceCompositingEngine(const vtkMRMLSliceCompositingEngine&);  /// Not implemented.
+  void operator=(const vtkMRMLSliceCompositingEngine&);  /// Not implemented.
+};
+
+#endif
@@ -14,6 +14,7 @@
 
 // MRMLLogic includes
 #include "vtkMRMLSliceLayerLogic.h"
+#include "vtkMRMLTransientObjectPool.h"
 
 // MRML includes
 #include "vtkMRMLLabelMapVolumeNode.h"
@@ -49,6 +50,7 @@
 
 // STD includes
 #include <algorithm>
+#include <cmath>
 
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkMRMLSliceLayerLogic);
@@ -113,6 +115,8 @@ vtkMRMLSliceLayerLogic::vtkMRMLSliceLayerLogic()
 
   this->IsLabelLayer = 0;
 
+  this->InteractiveResampling = 0;
+
   this->AssignAttributeTensorsToScalars= vtkAssignAttribute::New();
   this->AssignAttributeScalarsToTensors= vtkAssignAttribute::New();
   this->AssignAttributeScalarsToTensorsUVW= vtkAssignAttribute::New();
@@ -291,7 +295,9 @@ void vtkMRMLSliceLayerLogic::SetSliceNode(vtkMRMLSliceNode *sliceNode)
     return;
     }
   bool wasModifying = this->StartModify();
-  vtkSetAndObserveMRMLNodeMacro( this->SliceNode, sliceNode );
+  // the slice node fires at interaction rate (browse, pan, zoom),
+  // observe it directly to stay out of the event broker
+  vtkSetAndObserveMRMLNodeDirectMacro( this->SliceNode, sliceNode );
 
   // Update the reslice transform to move this image into XY
   this->UpdateTransforms();
@@ -486,11 +492,12 @@ void vtkMRMLSliceLayerLogic::UpdateTransforms()
   dimensionsUVW[1] = 100;
   dimensionsUVW[2] = 100;
 
-  vtkNew<vtkMatrix4x4> xyToIJK;
-  xyToIJK->Identity();
+  // this method runs on every slice interaction: borrow the temporary
+  // matrices and transforms from the pool instead of allocating them
+  vtkMRMLTransientObjectPool* pool = vtkMRMLTransientObjectPool::GetInstance();
 
-  vtkNew<vtkMatrix4x4> uvwToIJK;
-  uvwToIJK->Identity();
+  vtkSmartPointer<vtkMatrix4x4> xyToIJK = pool->GetMatrix4x4();
+  vtkSmartPointer<vtkMatrix4x4> uvwToIJK = pool->GetMatrix4x4();
 
   this->XYToIJKTransform->Identity();
   this->UVWToIJKTransform->Identity();
@@ -525,7 +532,7 @@ void vtkMRMLSliceLayerLogic::UpdateTransforms()
       this->UVWToIJKTransform->Concatenate(worldTransform.GetPointer());
       }
 
-    vtkNew<vtkMatrix4x4> rasToIJK;
+    vtkSmartPointer<vtkMatrix4x4> rasToIJK = pool->GetMatrix4x4();
     this->VolumeNode->GetRASToIJKMatrix(rasToIJK.GetPointer());
 
     this->XYToIJKTransform->Concatenate(rasToIJK.GetPointer());
@@ -534,21 +541,35 @@ void vtkMRMLSliceLayerLogic::UpdateTransforms()
     // vtkImageReslice works faster if the input is a linear transform, so try to convert it
     // to a linear transform.
     // Also attempt to make it a permute transform, as it makes reslicing even faster.
-    vtkSmartPointer<vtkTransform> linearXYToIJKTransform = vtkSmartPointer<vtkTransform>::New();
+    // Only replace the transform on the reslice filter if the matrix actually
+    // changed: a fresh transform object would bump the filter's MTime and
+    // force the slice pipeline of every view of this volume to re-execute
+    // even when the slice geometry is the same.
+    vtkSmartPointer<vtkTransform> linearXYToIJKTransform = pool->GetTransform();
     if (vtkMRMLTransformNode::IsGeneralTransformLinear(this->XYToIJKTransform, linearXYToIJKTransform))
       {
       SnapToPermuteMatrix(linearXYToIJKTransform);
-      this->Reslice->SetResliceTransform(linearXYToIJKTransform);
+      vtkTransform* currentTransform = vtkTransform::SafeDownCast(this->Reslice->GetResliceTransform());
+      if (!currentTransform ||
+          !AreMatricesEqual(currentTransform->GetMatrix(), linearXYToIJKTransform->GetMatrix()))
+        {
+        this->Reslice->SetResliceTransform(linearXYToIJKTransform);
+        }
       }
     else
       {
       this->Reslice->SetResliceTransform(this->XYToIJKTransform);
       }
-    vtkSmartPointer<vtkTransform> linearUVWToIJKTransform = vtkSmartPointer<vtkTransform>::New();
+    vtkSmartPointer<vtkTransform> linearUVWToIJKTransform = pool->GetTransform();
     if (vtkMRMLTransformNode::IsGeneralTransformLinear(this->UVWToIJKTransform, linearUVWToIJKTransform))
       {
       SnapToPermuteMatrix(linearUVWToIJKTransform);
-      this->ResliceUVW->SetResliceTransform( linearUVWToIJKTransform );
+      vtkTransform* currentTransformUVW = vtkTransform::SafeDownCast(this->ResliceUVW->GetResliceTransform());
+      if (!currentTransformUVW ||
+          !AreMatricesEqual(currentTransformUVW->GetMatrix(), linearUVWToIJKTransform->GetMatrix()))
+        {
+        this->ResliceUVW->SetResliceTransform( linearUVWToIJKTransform );
+        }
       }
     else
       {
@@ -591,6 +612,103 @@ void vtkMRMLSliceLayerLogic::UpdateTransforms()
     }
 }
 
+//----------------------------------------------------------------------------
+bool vtkMRMLSliceLayerLogic::GetVolumeIJKAtXYZ(const double xyz[3], double ijk[3])
+{
+  if (this->VolumeNode == NULL || this->VolumeNode->GetImageData() == NULL)
+    {
+    return false;
+    }
+  // the transform is kept current by UpdateTransforms() whenever the slice
+  // or volume nodes change, so no pipeline update is needed here
+  this->XYToIJKTransform->TransformPoint(xyz, ijk);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkMRMLSliceLayerLogic::ProbeVoxelAtXYZ(const double xyz[3], double& value, int component)
+{
+  double ijk[3];
+  if (!this->GetVolumeIJKAtXYZ(xyz, ijk))
+    {
+    return false;
+    }
+  vtkImageData* imageData = this->VolumeNode->GetImageData();
+  if (component < 0 || component >= imageData->GetNumberOfScalarComponents())
+    {
+    return false;
+    }
+  int extent[6];
+  imageData->GetExtent(extent);
+
+  if (this->IsLabelLayer)
+    {
+    // labels must not be blended across voxels
+    int index[3];
+    for (int dim = 0; dim < 3; dim++)
+      {
+      index[dim] = static_cast<int>(floor(ijk[dim] + 0.5));
+      if (index[dim] < extent[2 * dim] || index[dim] > extent[2 * dim + 1])
+        {
+        return false;
+        }
+      }
+    value = imageData->GetScalarComponentAsDouble(index[0], index[1], index[2], component);
+    return true;
+    }
+
+  int lower[3];
+  int upper[3];
+  double fraction[3];
+  for (int dim = 0; dim < 3; dim++)
+    {
+    if (ijk[dim] < extent[2 * dim] || ijk[dim] > extent[2 * dim + 1])
+      {
+      return false;
+      }
+    lower[dim] = static_cast<int>(floor(ijk[dim]));
+    if (lower[dim] > extent[2 * dim + 1] - 1)
+      {
+      lower[dim] = extent[2 * dim + 1];
+      }
+    upper[dim] = lower[dim] < extent[2 * dim + 1] ? lower[dim] + 1 : lower[dim];
+    fraction[dim] = ijk[dim] - lower[dim];
+    if (fraction[dim] < 0.)
+      {
+      fraction[dim] = 0.;
+      }
+    else if (fraction[dim] > 1.)
+      {
+      fraction[dim] = 1.;
+      }
+    }
+  value = 0.;
+  for (int corner = 0; corner < 8; corner++)
+    {
+    int cornerIndex[3];
+    double weight = 1.;
+    for (int dim = 0; dim < 3; dim++)
+      {
+      if (corner & (1 << dim))
+        {
+        cornerIndex[dim] = upper[dim];
+        weight *= fraction[dim];
+        }
+      else
+        {
+        cornerIndex[dim] = lower[dim];
+        weight *= 1. - fraction[dim];
+        }
+      }
+    if (weight > 0.)
+      {
+      value += weight * imageData->GetScalarComponentAsDouble(
+        cornerIndex[0], cornerIndex[1], cornerIndex[2], component);
+      }
+    }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 vtkImageData* vtkMRMLSliceLayerLogic::GetImageData()
 {
@@ -631,6 +749,20 @@ vtkAlgorithmOutput* vtkMRMLSliceLayerLogic::GetImageDataConnectionUVW()
   return this->GetVolumeDisplayNodeUVW()->GetOutputImageDataConnection();
 }
 
+//----------------------------------------------------------------------------
+void vtkMRMLSliceLayerLogic::SetInteractiveResampling(int interactive)
+{
+  if (this->InteractiveResampling == interactive)
+    {
+    return;
+    }
+  this->InteractiveResampling = interactive;
+  // re-run the pipeline update so the reslice interpolation mode matches
+  // the new state (in particular to restore quality when the flag clears)
+  this->UpdateImageDisplay();
+  this->Modified();
+}
+
 //----------------------------------------------------------------------------
 void vtkMRMLSliceLayerLogic::UpdateImageDisplay()
 {
@@ -652,7 +784,8 @@ void vtkMRMLSliceLayerLogic::UpdateImageDisplay()
   vtkMTimeType oldLabelUVW = this->LabelOutlineUVW->GetMTime();
 
   if ( (this->VolumeNode->GetImageData() && labelMapVolumeDisplayNode) ||
-       (scalarVolumeDisplayNode && scalarVolumeDisplayNode->GetInterpolate() == 0))
+       (scalarVolumeDisplayNode && scalarVolumeDisplayNode->GetInterpolate() == 0) ||
+       this->InteractiveResampling )
     {
     this->Reslice->SetInterpolationModeToNearestNeighbor();
     this->ResliceUVW->SetInterpolationModeToNearestNeighbor();
@@ -972,6 +1105,7 @@ void vtkMRMLSliceLayerLogic::PrintSelf(ostream& os, vtkIndent indent)
     }
 
   os << indent << "IsLabelLayer: " << this->GetIsLabelLayer() << "\n";
+  os << indent << "InteractiveResampling: " << this->GetInteractiveResampling() << "\n";
   os << indent << "LabelOutline:\n";
   if (this->LabelOutline)
     {
@@ -100,6 +100,16 @@ public:
   /// The filter that turns the label map into an outline
   vtkGetObjectMacro (LabelOutline, vtkImageLabelOutline);
 
+  ///
+  /// While set, the reslice filters run with nearest neighbor interpolation
+  /// regardless of the display node settings, so reslicing stays cheap during
+  /// interaction. Clearing the flag re-runs the pipeline update at the
+  /// quality requested by the display node.
+  /// \sa vtkMRMLSliceLogic::SetLayersInteractiveResampling()
+  void SetInteractiveResampling (int interactive);
+  vtkGetMacro (InteractiveResampling, int);
+  vtkBooleanMacro (InteractiveResampling, int);
+
   ///
   /// Get the output of the pipeline for this layer
   vtkImageData *GetImageData();
@@ -129,6 +139,24 @@ public:
   /// The current reslice transform XYToIJK
   vtkGetObjectMacro (XYToIJKTransform, vtkGeneralTransform);
 
+  ///
+  /// Map an XY(Z) slice view position into IJK coordinates of the volume
+  /// of this layer through the cached XYToIJK transform, without touching
+  /// the reslice pipeline. Returns false if no volume is set.
+  /// \sa ProbeVoxelAtXYZ()
+  bool GetVolumeIJKAtXYZ(const double xyz[3], double ijk[3]);
+
+  ///
+  /// Probe the voxel value of this layer's volume at an XY(Z) slice view
+  /// position by fetching directly from the source image: the position is
+  /// mapped through the cached XYToIJK transform and the value is
+  /// interpolated from the source voxels (trilinear, or nearest neighbor
+  /// for label layers). No pipeline update is triggered, so this is cheap
+  /// enough to call on every mouse move. Returns false if no volume is
+  /// set, the position falls outside the volume, or the component index
+  /// is out of range.
+  bool ProbeVoxelAtXYZ(const double xyz[3], double& value, int component = 0);
+
 
 protected:
   vtkMRMLSliceLayerLogic();
@@ -181,6 +209,8 @@ protected:
 
   int IsLabelLayer;
 
+  int InteractiveResampling;
+
   int UpdatingTransforms;
 };
 
@@ -15,10 +15,15 @@
 // MRMLLogic includes
 #include "vtkMRMLSliceLogic.h"
 #include "vtkMRMLSliceLayerLogic.h"
+#include "vtkImageKeyedCache.h"
+#include "vtkImageTileCache.h"
+#include "vtkMRMLSliceCompositingEngine.h"
+#include "vtkMRMLTransientObjectPool.h"
 
 // MRML includes
 #include <vtkEventBroker.h>
 #include <vtkMRMLCrosshairNode.h>
+#include <vtkMRMLPerformanceLogger.h>
 #include <vtkMRMLDiffusionTensorVolumeSliceDisplayNode.h>
 #include <vtkMRMLGlyphableVolumeDisplayNode.h>
 #include <vtkMRMLLinearTransformNode.h>
@@ -56,6 +61,8 @@
 
 // STD includes
 #include <algorithm>
+#include <iomanip>
+#include <sstream>
 
 //----------------------------------------------------------------------------
 const int vtkMRMLSliceLogic::SLICE_INDEX_ROTATED=-1;
@@ -119,6 +126,17 @@ struct BlendPipeline
 
     this->AddSubOutputCast->SetOutputScalarTypeToUnsignedChar();
     this->AddSubOutputCast->ClampOverflowOn();
+
+    // The tile cache sits at the tail of the pipeline so that localized
+    // changes (e.g. paint strokes) only re-execute the
+    // reslice/color/blend filters over the invalidated tiles. It is a
+    // passthrough until incremental updates are enabled on it.
+    this->TileCache->SetInputConnection(this->Blend->GetOutputPort());
+
+    // The slice image cache follows so that, when enabled, recently
+    // composited slices can be served again without re-executing the
+    // pipeline. It is a passthrough until it is enabled.
+    this->SliceCache->SetInputConnection(this->TileCache->GetOutputPort());
   }
 
   void AddLayers(std::deque<SliceLayerInfo>& layers, int sliceCompositing,
@@ -188,6 +206,8 @@ struct BlendPipeline
   vtkNew<vtkImageAppendComponents> AddSubAppendRGBA;
   vtkNew<vtkImageCast> AddSubOutputCast;
   vtkNew<vtkImageBlend> Blend;
+  vtkNew<vtkImageTileCache> TileCache;
+  vtkNew<vtkImageKeyedCache> SliceCache;
 };
 
 //----------------------------------------------------------------------------
@@ -209,7 +229,7 @@ vtkMRMLSliceLogic::vtkMRMLSliceLogic()
 
   this->ExtractModelTexture = vtkImageReslice::New();
   this->ExtractModelTexture->SetOutputDimensionality (2);
-  this->ExtractModelTexture->SetInputConnection(this->PipelineUVW->Blend->GetOutputPort());
+  this->ExtractModelTexture->SetInputConnection(this->PipelineUVW->SliceCache->GetOutputPort());
 
   this->SliceModelNode = 0;
   this->SliceModelTransformNode = 0;
@@ -217,6 +237,7 @@ vtkMRMLSliceLogic::vtkMRMLSliceLogic()
   this->SetName("");
   this->SliceModelDisplayNode = 0;
   this->ImageDataConnection = 0;
+  this->CompositingEngine = 0;
   this->SliceSpacing[0] = this->SliceSpacing[1] = this->SliceSpacing[2] = 1;
   this->AddingSliceModelNodes = false;
 }
@@ -226,6 +247,7 @@ vtkMRMLSliceLogic::~vtkMRMLSliceLogic()
 {
   this->SetName(0);
   this->SetSliceNode(0);
+  this->SetCompositingEngine(0);
 
   if (this->ImageDataConnection)
     {
@@ -713,7 +735,9 @@ void vtkMRMLSliceLogic::SetSliceNode(vtkMRMLSliceNode * newSliceNode)
   // changed.
   // This class takes care of passing the one slice node to each of the layers
   // so that users of this class only need to set the node one place.
-  vtkSetAndObserveMRMLNodeMacro( this->SliceNode, newSliceNode );
+  // The slice node fires at interaction rate, observe it directly to stay
+  // out of the event broker.
+  vtkSetAndObserveMRMLNodeDirectMacro( this->SliceNode, newSliceNode );
 
   if (this->BackgroundLayer)
     {
@@ -740,8 +764,10 @@ void vtkMRMLSliceLogic::SetSliceCompositeNode(vtkMRMLSliceCompositeNode *sliceCo
     return;
     }
 
-  // Observe the composite node, since this holds the parameters for this pipeline
-  vtkSetAndObserveMRMLNodeMacro( this->SliceCompositeNode, sliceCompositeNode );
+  // Observe the composite node, since this holds the parameters for this
+  // pipeline; it is updated at interaction rate (opacity sliders, layer
+  // selection), so observe it directly to stay out of the event broker.
+  vtkSetAndObserveMRMLNodeDirectMacro( this->SliceCompositeNode, sliceCompositeNode );
   this->UpdatePipeline();
 }
 
@@ -822,6 +848,23 @@ void vtkMRMLSliceLogic::SetLabelLayer(vtkMRMLSliceLayerLogic *labelLayer)
   this->Modified();
 }
 
+//----------------------------------------------------------------------------
+void vtkMRMLSliceLogic::SetLayersInteractiveResampling(int interactive)
+{
+  if (this->BackgroundLayer)
+    {
+    this->BackgroundLayer->SetInteractiveResampling(interactive);
+    }
+  if (this->ForegroundLayer)
+    {
+    this->ForegroundLayer->SetInteractiveResampling(interactive);
+    }
+  if (this->LabelLayer)
+    {
+    this->LabelLayer->SetInteractiveResampling(interactive);
+    }
+}
+
 //----------------------------------------------------------------------------
 void vtkMRMLSliceLogic
 ::SetWindowLevel(double newWindow, double newLevel, int layer)
@@ -918,14 +961,35 @@ vtkAlgorithmOutput * vtkMRMLSliceLogic::GetImageDataConnection()
 //----------------------------------------------------------------------------
 void vtkMRMLSliceLogic::UpdateImageData ()
 {
+  if (this->CompositingEngine && this->CompositingEngine->IsAvailable())
+    {
+    this->CompositingEngine->SetSliceNode(this->SliceNode);
+    this->CompositingEngine->SetSliceCompositeNode(this->SliceCompositeNode);
+    this->CompositingEngine->SetBackgroundVolumeNode(
+      this->BackgroundLayer ? this->BackgroundLayer->GetVolumeNode() : 0);
+    this->CompositingEngine->SetForegroundVolumeNode(
+      this->ForegroundLayer ? this->ForegroundLayer->GetVolumeNode() : 0);
+    this->CompositingEngine->SetLabelVolumeNode(
+      this->LabelLayer ? this->LabelLayer->GetVolumeNode() : 0);
+    vtkAlgorithmOutput* engineOutput = this->CompositingEngine->GetOutputConnection();
+    if (engineOutput)
+      {
+      this->ImageDataConnection = engineOutput;
+      this->ExtractModelTexture->SetInputConnection(engineOutput);
+      return;
+      }
+    // the engine cannot composite the current configuration:
+    // fall through to the CPU blend pipeline
+    }
+
   if (this->SliceNode->GetSliceResolutionMode() == vtkMRMLSliceNode::SliceResolutionMatch2DView)
     {
-    this->ExtractModelTexture->SetInputConnection( this->Pipeline->Blend->GetOutputPort() );
-    this->ImageDataConnection = this->Pipeline->Blend->GetOutputPort();
+    this->ExtractModelTexture->SetInputConnection( this->Pipeline->SliceCache->GetOutputPort() );
+    this->ImageDataConnection = this->Pipeline->SliceCache->GetOutputPort();
     }
   else
     {
-    this->ExtractModelTexture->SetInputConnection( this->PipelineUVW->Blend->GetOutputPort() );
+    this->ExtractModelTexture->SetInputConnection( this->PipelineUVW->SliceCache->GetOutputPort() );
     }
   // It seems very strange that the imagedata can be null.
   // It should probably be always a valid imagedata with invalid bounds if needed
@@ -934,9 +998,9 @@ void vtkMRMLSliceLogic::UpdateImageData ()
        (this->GetForegroundLayer() != 0 && this->GetForegroundLayer()->GetImageDataConnection() != 0) ||
        (this->GetLabelLayer() != 0 && this->GetLabelLayer()->GetImageDataConnection() != 0) )
     {
-    if (this->ImageDataConnection == 0 || this->Pipeline->Blend->GetOutputPort()->GetMTime() > this->ImageDataConnection->GetMTime())
+    if (this->ImageDataConnection == 0 || this->Pipeline->SliceCache->GetOutputPort()->GetMTime() > this->ImageDataConnection->GetMTime())
       {
-      this->ImageDataConnection = this->Pipeline->Blend->GetOutputPort();
+      this->ImageDataConnection = this->Pipeline->SliceCache->GetOutputPort();
       }
     }
   else
@@ -948,7 +1012,7 @@ void vtkMRMLSliceLogic::UpdateImageData ()
       }
     else
       {
-      this->ExtractModelTexture->SetInputConnection(this->PipelineUVW->Blend->GetOutputPort());
+      this->ExtractModelTexture->SetInputConnection(this->PipelineUVW->SliceCache->GetOutputPort());
       }
     }
 }
@@ -1003,6 +1067,7 @@ bool vtkMRMLSliceLogic::UpdateBlendLayers(vtkImageBlend* blend, const std::deque
 //----------------------------------------------------------------------------
 void vtkMRMLSliceLogic::UpdatePipeline()
 {
+  vtkMRMLScopedPerformanceTimer performanceTimer("vtkMRMLSliceLogic::UpdatePipeline");
   int modified = 0;
   if ( this->SliceCompositeNode )
     {
@@ -1113,6 +1178,9 @@ void vtkMRMLSliceLogic::UpdatePipeline()
       modified = 1;
       }
 
+    // keep the slice image cache keys in sync with the pipeline inputs
+    this->UpdateSliceImageCacheKeys();
+
     //Models
     this->UpdateImageData();
     vtkMRMLDisplayNode* displayNode = this->SliceModelNode ? this->SliceModelNode->GetModelDisplayNode() : 0;
@@ -1142,6 +1210,11 @@ void vtkMRMLSliceLogic::UpdatePipeline()
        }
     if ( modified )
       {
+      // layer setup changed: any cached tiles and slices are stale
+      this->Pipeline->TileCache->InvalidateAll();
+      this->PipelineUVW->TileCache->InvalidateAll();
+      this->Pipeline->SliceCache->InvalidateAll();
+      this->PipelineUVW->SliceCache->InvalidateAll();
       if (this->SliceModelNode && this->SliceModelNode->GetPolyData())
         {
         this->SliceModelNode->GetPolyData()->Modified();
@@ -1489,7 +1562,8 @@ void vtkMRMLSliceLogic::GetVolumeSliceBounds(vtkMRMLVolumeNode *volumeNode, doub
   //
   // figure out how big that volume is on this particular slice plane
   //
-  vtkNew<vtkMatrix4x4> rasToSlice;
+  vtkSmartPointer<vtkMatrix4x4> rasToSlice =
+    vtkMRMLTransientObjectPool::GetInstance()->GetMatrix4x4();
   rasToSlice->DeepCopy(sliceNode->GetSliceToRAS());
   rasToSlice->SetElement(0, 3, 0.0);
   rasToSlice->SetElement(1, 3, 0.0);
@@ -1529,23 +1603,27 @@ double *vtkMRMLSliceLogic::GetVolumeSliceSpacing(vtkMRMLVolumeNode *volumeNode)
   // If the slice axis direction is aligned exactly with a voxel axis then the spacing equals voxel size along that axis.
   // If the slice axis is not aligned with any voxel axis then it'll be smoothly interpolated.
 
-  vtkNew<vtkMatrix4x4> ijkToWorld;
+  // this runs on every slice update of every layer: borrow the temporary
+  // matrices from the pool instead of allocating them
+  vtkMRMLTransientObjectPool* pool = vtkMRMLTransientObjectPool::GetInstance();
+
+  vtkSmartPointer<vtkMatrix4x4> ijkToWorld = pool->GetMatrix4x4();
   volumeNode->GetIJKToRASMatrix(ijkToWorld.GetPointer());
 
   // Apply transform to the volume axes, if the volume is transformed with a linear transform
   vtkMRMLTransformNode *transformNode = volumeNode->GetParentTransformNode();
   if ( transformNode != 0 &&  transformNode->IsTransformToWorldLinear() )
     {
-    vtkNew<vtkMatrix4x4> volumeRASToWorld;
+    vtkSmartPointer<vtkMatrix4x4> volumeRASToWorld = pool->GetMatrix4x4();
     transformNode->GetMatrixTransformToWorld(volumeRASToWorld.GetPointer());
     //rasToRAS->Invert();
     vtkMatrix4x4::Multiply4x4(volumeRASToWorld.GetPointer(), ijkToWorld.GetPointer(), ijkToWorld.GetPointer());
     }
 
-  vtkNew<vtkMatrix4x4> worldToIJK;
+  vtkSmartPointer<vtkMatrix4x4> worldToIJK = pool->GetMatrix4x4();
   vtkMatrix4x4::Invert(ijkToWorld.GetPointer(), worldToIJK.GetPointer());
 
-  vtkNew<vtkMatrix4x4> sliceToIJK;
+  vtkSmartPointer<vtkMatrix4x4> sliceToIJK = pool->GetMatrix4x4();
   vtkMatrix4x4::Multiply4x4(worldToIJK.GetPointer(), sliceNode->GetSliceToRAS(), sliceToIJK.GetPointer());
 
   // Make the slice spacing 1 voxel
@@ -1623,7 +1701,8 @@ void vtkMRMLSliceLogic::FitSliceToVolume(vtkMRMLVolumeNode *volumeNode, int widt
   //
   // set the origin to be the center of the volume in RAS
   //
-  vtkNew<vtkMatrix4x4> sliceToRAS;
+  vtkSmartPointer<vtkMatrix4x4> sliceToRAS =
+    vtkMRMLTransientObjectPool::GetInstance()->GetMatrix4x4();
   sliceToRAS->DeepCopy(sliceNode->GetSliceToRAS());
   sliceToRAS->SetElement(0, 3, rasCenter[0]);
   sliceToRAS->SetElement(1, 3, rasCenter[1]);
@@ -1734,7 +1813,8 @@ void vtkMRMLSliceLogic::FitFOVToBackground(double fov)
   int dimensions[3];
   double rasDimensions[4];
   double doubleDimensions[4];
-  vtkNew<vtkMatrix4x4> ijkToRAS;
+  vtkMRMLTransientObjectPool* pool = vtkMRMLTransientObjectPool::GetInstance();
+  vtkSmartPointer<vtkMatrix4x4> ijkToRAS = pool->GetMatrix4x4();
 
   // what are the actual dimensions of the imagedata?
   backgroundImage->GetDimensions(dimensions);
@@ -1746,7 +1826,7 @@ void vtkMRMLSliceLogic::FitFOVToBackground(double fov)
   ijkToRAS->MultiplyPoint(doubleDimensions, rasDimensions);
 
   // and what are their slice dimensions?
-  vtkNew<vtkMatrix4x4> rasToSlice;
+  vtkSmartPointer<vtkMatrix4x4> rasToSlice = pool->GetMatrix4x4();
   double sliceDimensions[4];
   rasToSlice->DeepCopy(this->SliceNode->GetSliceToRAS());
   rasToSlice->SetElement(0, 3, 0.0);
@@ -1774,9 +1854,9 @@ void vtkMRMLSliceLogic::FitFOVToBackground(double fov)
   // view is NOT changed)
   this->SliceNode->SetFieldOfView(fovh, fovv, this->SliceNode->GetFieldOfView()[2]);
 
-  vtkNew<vtkMatrix4x4> sliceToRAS;
-  sliceToRAS->DeepCopy(this->SliceNode->GetSliceToRAS());
-  this->SliceNode->GetSliceToRAS()->DeepCopy(sliceToRAS.GetPointer());
+  // The matrix content is not changed here, but observers rely on the
+  // modification event that the round-trip copy used to emit.
+  this->SliceNode->GetSliceToRAS()->Modified();
 }
 
 //----------------------------------------------------------------------------
@@ -2430,3 +2510,118 @@ vtkImageBlend* vtkMRMLSliceLogic::GetBlendUVW()
 {
   return this->PipelineUVW->Blend.GetPointer();
 }
+
+//----------------------------------------------------------------------------
+vtkCxxSetObjectMacro(vtkMRMLSliceLogic, CompositingEngine, vtkMRMLSliceCompositingEngine);
+
+//----------------------------------------------------------------------------
+vtkImageTileCache* vtkMRMLSliceLogic::GetTileCache()
+{
+  return this->Pipeline->TileCache.GetPointer();
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLSliceLogic::InvalidateSliceRegion(double rasBounds[6])
+{
+  if (!this->SliceNode)
+    {
+    return;
+    }
+  vtkNew<vtkMatrix4x4> rasToXY;
+  vtkMatrix4x4::Invert(this->SliceNode->GetXYToRAS(), rasToXY.GetPointer());
+  double xyMin[2] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
+  double xyMax[2] = { -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+  for (int corner = 0; corner < 8; corner++)
+    {
+    double ras[4] = { rasBounds[(corner & 1) ? 1 : 0],
+                      rasBounds[(corner & 2) ? 3 : 2],
+                      rasBounds[(corner & 4) ? 5 : 4],
+                      1. };
+    double xyz[4] = { 0., 0., 0., 1. };
+    rasToXY->MultiplyPoint(ras, xyz);
+    for (int axis = 0; axis < 2; axis++)
+      {
+      xyMin[axis] = std::min(xyMin[axis], xyz[axis]);
+      xyMax[axis] = std::max(xyMax[axis], xyz[axis]);
+      }
+    }
+  int region[4] = { static_cast<int>(floor(xyMin[0])), static_cast<int>(ceil(xyMax[0])),
+                    static_cast<int>(floor(xyMin[1])), static_cast<int>(ceil(xyMax[1])) };
+  this->Pipeline->TileCache->InvalidateRegion(region);
+}
+
+//----------------------------------------------------------------------------
+vtkImageKeyedCache* vtkMRMLSliceLogic::GetSliceImageCache()
+{
+  return this->Pipeline->SliceCache.GetPointer();
+}
+
+//----------------------------------------------------------------------------
+namespace
+{
+void AppendLayerToCacheKey(std::ostringstream& key, vtkMRMLSliceLayerLogic* layer)
+{
+  vtkMRMLVolumeNode* volumeNode = layer ? layer->GetVolumeNode() : 0;
+  if (!volumeNode)
+    {
+    key << " -";
+    return;
+    }
+  key << " " << volumeNode << " " << volumeNode->GetMTime();
+  vtkImageData* imageData = volumeNode->GetImageData();
+  key << " " << (imageData ? imageData->GetMTime() : 0);
+  vtkMRMLDisplayNode* displayNode = volumeNode->GetDisplayNode();
+  key << " " << (displayNode ? displayNode->GetMTime() : 0);
+  vtkMRMLColorNode* colorNode = displayNode ? displayNode->GetColorNode() : 0;
+  key << " " << (colorNode ? colorNode->GetMTime() : 0);
+  vtkMRMLTransformNode* transformNode = volumeNode->GetParentTransformNode();
+  key << " " << (transformNode ? transformNode->GetMTime() : 0);
+  key << " " << layer->GetInteractiveResampling();
+}
+} // end of anonymous namespace
+
+//----------------------------------------------------------------------------
+std::string vtkMRMLSliceLogic::BuildSliceImageCacheKey(bool uvwPipeline)
+{
+  if (!this->SliceNode || !this->SliceCompositeNode)
+    {
+    return std::string();
+    }
+  std::ostringstream key;
+  key << std::setprecision(17);
+  vtkMatrix4x4* toRAS = uvwPipeline ?
+    this->SliceNode->GetUVWToRAS() : this->SliceNode->GetXYToRAS();
+  for (int i = 0; i < 4; i++)
+    {
+    for (int j = 0; j < 4; j++)
+      {
+      key << toRAS->GetElement(i, j) << " ";
+      }
+    }
+  int* dimensions = uvwPipeline ?
+    this->SliceNode->GetUVWDimensions() : this->SliceNode->GetDimensions();
+  key << dimensions[0] << " " << dimensions[1] << " " << dimensions[2];
+  key << " " << this->SliceNode->GetActiveSlice();
+  key << " " << this->SliceNode->GetUseLabelOutline();
+  key << " " << this->SliceNode->GetSliceResolutionMode();
+  key << " " << this->SliceCompositeNode->GetCompositing();
+  key << " " << this->SliceCompositeNode->GetForegroundOpacity();
+  key << " " << this->SliceCompositeNode->GetLabelOpacity();
+  AppendLayerToCacheKey(key, this->BackgroundLayer);
+  AppendLayerToCacheKey(key, this->ForegroundLayer);
+  AppendLayerToCacheKey(key, this->LabelLayer);
+  return key.str();
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLSliceLogic::UpdateSliceImageCacheKeys()
+{
+  if (this->Pipeline->SliceCache->GetEnabled())
+    {
+    this->Pipeline->SliceCache->SetCacheKey(this->BuildSliceImageCacheKey(false));
+    }
+  if (this->PipelineUVW->SliceCache->GetEnabled())
+    {
+    this->PipelineUVW->SliceCache->SetCacheKey(this->BuildSliceImageCacheKey(true));
+    }
+}
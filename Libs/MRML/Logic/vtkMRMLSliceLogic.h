@@ -27,6 +27,7 @@ class vtkMRMLLinearTransformNode;
 class vtkMRMLModelDisplayNode;
 class vtkMRMLModelNode;
 class vtkMRMLSliceCompositeNode;
+class vtkMRMLSliceCompositingEngine;
 class vtkMRMLSliceLayerLogic;
 class vtkMRMLSliceNode;
 class vtkMRMLVolumeNode;
@@ -34,6 +35,8 @@ class vtkMRMLVolumeNode;
 class vtkAlgorithmOutput;
 class vtkCollection;
 class vtkImageBlend;
+class vtkImageKeyedCache;
+class vtkImageTileCache;
 class vtkTransform;
 class vtkImageData;
 class vtkImageReslice;
@@ -99,6 +102,14 @@ public:
   vtkGetObjectMacro (LabelLayer, vtkMRMLSliceLayerLogic);
   void SetLabelLayer (vtkMRMLSliceLayerLogic *LabelLayer);
 
+  ///
+  /// Helper to set interactive resampling on all slice layers: while set,
+  /// the layers reslice with nearest neighbor interpolation so updates stay
+  /// cheap during interaction; clearing it restores the quality requested by
+  /// the display nodes.
+  /// \sa vtkMRMLSliceLayerLogic::SetInteractiveResampling()
+  void SetLayersInteractiveResampling(int interactive);
+
   ///
   /// Helper to set the background layer Window/Level
   void SetBackgroundWindowLevel(double window, double level);
@@ -134,6 +145,43 @@ public:
   vtkImageBlend* GetBlend();
   vtkImageBlend* GetBlendUVW();
 
+  ///
+  /// Tile cache at the tail of the blend pipeline. Enable incremental
+  /// updates on it so that localized changes declared with
+  /// InvalidateSliceRegion() only re-execute the reslice/color/blend
+  /// filters over the invalidated tiles instead of the whole viewport.
+  vtkImageTileCache* GetTileCache();
+
+  ///
+  /// Declare that only the given RAS bounding box changed in the
+  /// displayed volumes (e.g. the region touched by a paint stroke).
+  /// Only the slice tiles overlapping the region are recomputed on the
+  /// next update. Has no effect unless incremental updates are enabled
+  /// on the tile cache.
+  /// \sa GetTileCache(), vtkImageTileCache::InvalidateRegion()
+  void InvalidateSliceRegion(double rasBounds[6]);
+
+  ///
+  /// Cache of recently composited slices at the tail of the blend
+  /// pipeline. Enable it so that revisiting a recently displayed slice
+  /// pose (e.g. scrolling back and forth through offsets) serves the
+  /// stored image instead of re-executing the reslice/color/blend
+  /// filters. The logic keeps the cache key up to date from the slice
+  /// pose, the layer volumes and the display and compositing settings.
+  /// Disabled by default.
+  /// \sa vtkImageKeyedCache
+  vtkImageKeyedCache* GetSliceImageCache();
+
+  ///
+  /// Optional accelerated reslice/compositing engine (e.g. GPU-based).
+  /// When an engine is set and available, its output replaces the CPU
+  /// blend pipeline as the composited slice; the CPU pipeline is kept
+  /// up to date and used as the fallback whenever the engine cannot
+  /// handle the current configuration. No engine is set by default.
+  /// \sa vtkMRMLSliceCompositingEngine
+  virtual void SetCompositingEngine(vtkMRMLSliceCompositingEngine* engine);
+  vtkGetObjectMacro(CompositingEngine, vtkMRMLSliceCompositingEngine);
+
   ///
   /// An image reslice instance to pull a single slice from the volume that
   /// represents the filmsheet display output
@@ -379,6 +427,16 @@ protected:
   /// is a relatively expensive operation.
   bool UpdateBlendLayers(vtkImageBlend* blend, const std::deque<SliceLayerInfo> &layers);
 
+  /// Build the key identifying the current slice pose and pipeline
+  /// inputs for the slice image cache. The key changes whenever the
+  /// slice geometry, a layer volume, its display settings or the
+  /// compositing settings change.
+  /// \sa GetSliceImageCache()
+  std::string BuildSliceImageCacheKey(bool uvwPipeline);
+  /// Update the key on the slice image caches of both pipelines.
+  /// No-op while the caches are disabled.
+  void UpdateSliceImageCacheKeys();
+
   bool                        AddingSliceModelNodes;
   bool                        Initialized;
 
@@ -393,6 +451,7 @@ protected:
   BlendPipeline* PipelineUVW;
   vtkImageReslice * ExtractModelTexture;
   vtkAlgorithmOutput *    ImageDataConnection;
+  vtkMRMLSliceCompositingEngine * CompositingEngine;
   vtkTransform *    ActiveSliceTransform;
 
   vtkMRMLModelNode *            SliceModelNode;
@@ -0,0 +1,163 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+
+=========================================================================auto=*/
+
+// MRMLLogic includes
+#include "vtkMRMLTransientObjectPool.h"
+
+// VTK includes
+#include <vtkMatrix4x4.h>
+#include <vtkObjectFactory.h>
+#include <vtkSmartPointer.h>
+#include <vtkTransform.h>
+
+//----------------------------------------------------------------------------
+vtkStandardNewMacro(vtkMRMLTransientObjectPool);
+
+//----------------------------------------------------------------------------
+vtkMRMLTransientObjectPool* vtkMRMLTransientObjectPool::GetInstance()
+{
+  // deleted on application exit by the smart pointer
+  static vtkSmartPointer<vtkMRMLTransientObjectPool> instance;
+  if (!instance.GetPointer())
+    {
+    instance = vtkSmartPointer<vtkMRMLTransientObjectPool>::New();
+    }
+  return instance;
+}
+
+//----------------------------------------------------------------------------
+vtkMRMLTransientObjectPool::vtkMRMLTransientObjectPool()
+{
+  this->Capacity = 64;
+  this->NumberOfPoolHits = 0;
+  this->NumberOfPoolMisses = 0;
+  this->NextMatrix = 0;
+  this->NextTransform = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkMRMLTransientObjectPool::~vtkMRMLTransientObjectPool()
+{
+  for (size_t i = 0; i < this->Matrices.size(); ++i)
+    {
+    this->Matrices[i]->Delete();
+    }
+  for (size_t i = 0; i < this->Transforms.size(); ++i)
+    {
+    this->Transforms[i]->Delete();
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkMRMLTransientObjectPool::PrintSelf(ostream& os, vtkIndent indent)
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "Capacity: " << this->Capacity << "\n";
+  os << indent << "NumberOfPoolHits: " << this->NumberOfPoolHits << "\n";
+  os << indent << "NumberOfPoolMisses: " << this->NumberOfPoolMisses << "\n";
+  os << indent << "NumberOfPooledObjects: "
+     << this->GetNumberOfPooledObjects() << "\n";
+}
+
+//----------------------------------------------------------------------------
+vtkMatrix4x4* vtkMRMLTransientObjectPool::GetMatrix4x4()
+{
+  size_t poolSize = this->Matrices.size();
+  for (size_t scanned = 0; scanned < poolSize; ++scanned)
+    {
+    size_t index = (this->NextMatrix + scanned) % poolSize;
+    vtkMatrix4x4* matrix = this->Matrices[index];
+    // only the pool references the instance: free to be handed out again
+    if (matrix->GetReferenceCount() == 1)
+      {
+      this->NextMatrix = (index + 1) % poolSize;
+      this->NumberOfPoolHits++;
+      matrix->Identity();
+      return matrix;
+      }
+    }
+
+  // every instance is in use (or the pool is empty): grow the pool. The
+  // size can exceed the capacity during an event storm; the surplus is
+  // trimmed again as instances are freed.
+  while (static_cast<int>(this->Matrices.size()) >= this->Capacity)
+    {
+    std::vector<vtkMatrix4x4*>::iterator it = this->Matrices.begin();
+    for (; it != this->Matrices.end(); ++it)
+      {
+      if ((*it)->GetReferenceCount() == 1)
+        {
+        break;
+        }
+      }
+    if (it == this->Matrices.end())
+      {
+      break;
+      }
+    (*it)->Delete();
+    this->Matrices.erase(it);
+    }
+
+  this->NumberOfPoolMisses++;
+  vtkMatrix4x4* matrix = vtkMatrix4x4::New();
+  this->Matrices.push_back(matrix);
+  this->NextMatrix = 0;
+  return matrix;
+}
+
+//----------------------------------------------------------------------------
+vtkTransform* vtkMRMLTransientObjectPool::GetTransform()
+{
+  size_t poolSize = this->Transforms.size();
+  for (size_t scanned = 0; scanned < poolSize; ++scanned)
+    {
+    size_t index = (this->NextTransform + scanned) % poolSize;
+    vtkTransform* transform = this->Transforms[index];
+    if (transform->GetReferenceCount() == 1)
+      {
+      this->NextTransform = (index + 1) % poolSize;
+      this->NumberOfPoolHits++;
+      transform->Identity();
+      transform->PreMultiply();
+      return transform;
+      }
+    }
+
+  while (static_cast<int>(this->Transforms.size()) >= this->Capacity)
+    {
+    std::vector<vtkTransform*>::iterator it = this->Transforms.begin();
+    for (; it != this->Transforms.end(); ++it)
+      {
+      if ((*it)->GetReferenceCount() == 1)
+        {
+        break;
+        }
+      }
+    if (it == this->Transforms.end())
+      {
+      break;
+      }
+    (*it)->Delete();
+    this->Transforms.erase(it);
+    }
+
+  this->NumberOfPoolMisses++;
+  vtkTransform* transform = vtkTransform::New();
+  this->Transforms.push_back(transform);
+  this->NextTransform = 0;
+  return transform;
+}
+
+//----------------------------------------------------------------------------
+int vtkMRMLTransientObjectPool::GetNumberOfPooledObjects()
+{
+  return static_cast<int>(this->Matrices.size() + this->Transforms.size());
+}
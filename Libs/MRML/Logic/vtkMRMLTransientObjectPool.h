@@ -0,0 +1,111 @@
+/*=auto=========================================================================
+
+  Portions (c) Copyright 2005 Brigham and Women's Hospital (BWH) All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Program:   3D Slicer
+
+=========================================================================auto=*/
+
+///  vtkMRMLTransientObjectPool - recycles short-lived geometry objects
+///
+/// Slice and displayable manager updates allocate dozens of short-lived
+/// vtkMatrix4x4 and vtkTransform instances per frame, which fragments the
+/// heap over long sessions. This pool keeps the instances alive between
+/// updates and hands them out again instead of allocating new ones.
+///
+/// Reclamation is based on the VTK reference count: the pool holds one
+/// reference to every instance it created, and an instance whose count
+/// dropped back to one is free to be handed out again. A caller therefore
+/// borrows an object exactly like it would create one:
+///
+/// \code
+/// vtkSmartPointer<vtkMatrix4x4> rasToSlice =
+///   vtkMRMLTransientObjectPool::GetInstance()->GetMatrix4x4();
+/// \endcode
+///
+/// and simply lets the smart pointer go out of scope when done - there is
+/// no explicit return call, so a borrowed object can never be recycled
+/// while it is still referenced. Instances are reset (identity) before
+/// they are handed out.
+///
+/// The pool is not locked: like the slice pipeline it serves, it must
+/// only be used from the main thread.
+
+#ifndef __vtkMRMLTransientObjectPool_h
+#define __vtkMRMLTransientObjectPool_h
+
+// MRMLLogic includes
+#include "vtkMRMLLogicExport.h"
+
+// VTK includes
+#include <vtkObject.h>
+class vtkMatrix4x4;
+class vtkTransform;
+
+// STD includes
+#include <vector>
+
+class VTK_MRML_LOGIC_EXPORT vtkMRMLTransientObjectPool : public vtkObject
+{
+public:
+  static vtkMRMLTransientObjectPool *New();
+  vtkTypeMacro(vtkMRMLTransientObjectPool, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  /// The pool shared by the logic classes of the process.
+  /// The returned instance is owned by the caller of this method and must
+  /// not be deleted (it is deleted on application exit).
+  static vtkMRMLTransientObjectPool* GetInstance();
+
+  /// Borrow an identity matrix from the pool. The caller keeps a
+  /// reference (e.g. in a vtkSmartPointer) and releases it when done,
+  /// which makes the instance available again. Store the reference before
+  /// borrowing the next object - an unreferenced borrow looks free to the
+  /// pool.
+  vtkMatrix4x4* GetMatrix4x4();
+
+  /// Borrow an identity transform from the pool (PreMultiply mode, the
+  /// vtkTransform default). Same ownership rules as GetMatrix4x4().
+  vtkTransform* GetTransform();
+
+  /// Maximum number of instances of each type the pool keeps alive.
+  /// Requests beyond the capacity fall back to plain allocation (the
+  /// returned object is then not tracked by the pool). Default is 64,
+  /// enough for the temporaries of one slice update of every view.
+  vtkSetMacro(Capacity, int);
+  vtkGetMacro(Capacity, int);
+
+  /// Instrumentation: number of requests served by recycling an instance
+  /// (allocations saved) and by allocating a new one.
+  vtkGetMacro(NumberOfPoolHits, vtkTypeInt64);
+  vtkGetMacro(NumberOfPoolMisses, vtkTypeInt64);
+
+  /// Number of instances currently kept alive by the pool.
+  int GetNumberOfPooledObjects();
+
+protected:
+  vtkMRMLTransientObjectPool();
+  virtual ~vtkMRMLTransientObjectPool();
+
+  int Capacity;
+  vtkTypeInt64 NumberOfPoolHits;
+  vtkTypeInt64 NumberOfPoolMisses;
+
+  /// All instances the pool created; the pool owns one reference each.
+  std::vector<vtkMatrix4x4*> Matrices;
+  std::vector<vtkTransform*> Transforms;
+
+  /// Rotating scan positions so repeated borrows do not always rescan
+  /// the busy instances at the front of the vectors.
+  size_t NextMatrix;
+  size_t NextTransform;
+
+private:
+  vtkMRMLTransientObjectPool(const vtkMRMLTransientObjectPool&); // Not implemented
+  void operator=(const vtkMRMLTransientObjectPool&); // Not implemented
+};
+
+#endif
@@ -530,6 +530,21 @@ QString qMRMLChartViewPrivate::seriesDateTicksString(vtkMRMLDoubleArrayNode *dn)
   return data.join("");
 }
 
+//---------------------------------------------------------------------------
+unsigned int qMRMLChartViewPrivate::maximumSeriesPointCount()const
+{
+  Q_Q(const qMRMLChartView);
+  // Aim for a few points per horizontal pixel so the drawn curve is
+  // indistinguishable from the full resolution one. Keep a generous floor
+  // so that a small or not yet shown view does not lose features.
+  unsigned int maxPointCount = 2000;
+  if (q->width() > 0 && (unsigned int)(4 * q->width()) > maxPointCount)
+    {
+    maxPointCount = (unsigned int)(4 * q->width());
+    }
+  return maxPointCount;
+}
+
 //---------------------------------------------------------------------------
 QString qMRMLChartViewPrivate::seriesDataString(vtkMRMLDoubleArrayNode *dn)
 {
@@ -540,15 +555,81 @@ QString qMRMLChartViewPrivate::seriesDataString(vtkMRMLDoubleArrayNode *dn)
   if (dn)
     {
     double x, y;
+    unsigned int size = dn->GetSize();
+    unsigned int maxPointCount = this->maximumSeriesPointCount();
 
-    // for each value
-    for (unsigned int j = 0; j < dn->GetSize(); ++j)
+    if (size > maxPointCount)
       {
-      dn->GetXYValue(j, &x, &y);
-      data << "[" << QString("%1").arg(x) << ", " << QString("%1").arg(y) << "]";
-      if (j < dn->GetSize()-1)
+      // A series with far more points than the chart has pixels cannot be
+      // displayed at full resolution anyway, and serializing every point
+      // into javascript blocks the GUI for seconds on very large arrays
+      // (e.g. dose-volume histograms). Emit the minimum and maximum of
+      // each bucket of points instead, which preserves the peaks and the
+      // envelope of the rendered curve.
+      unsigned int bucketCount = maxPointCount / 2;
+      bool firstEmitted = false;
+      for (unsigned int bucket = 0; bucket < bucketCount; ++bucket)
         {
-        data << ",";
+        unsigned int bucketBegin = (unsigned int)((double)bucket * size / bucketCount);
+        unsigned int bucketEnd = (unsigned int)((double)(bucket+1) * size / bucketCount);
+        if (bucketEnd > size)
+          {
+          bucketEnd = size;
+          }
+        if (bucketBegin >= bucketEnd)
+          {
+          continue;
+          }
+        unsigned int minIndex = bucketBegin;
+        unsigned int maxIndex = bucketBegin;
+        double minY = 0., maxY = 0.;
+        dn->GetXYValue(bucketBegin, &x, &minY);
+        maxY = minY;
+        for (unsigned int j = bucketBegin+1; j < bucketEnd; ++j)
+          {
+          dn->GetXYValue(j, &x, &y);
+          if (y < minY)
+            {
+            minY = y;
+            minIndex = j;
+            }
+          if (y > maxY)
+            {
+            maxY = y;
+            maxIndex = j;
+            }
+          }
+        // emit the extrema in index order to keep x monotonic
+        unsigned int firstIndex = minIndex < maxIndex ? minIndex : maxIndex;
+        unsigned int secondIndex = minIndex < maxIndex ? maxIndex : minIndex;
+        for (unsigned int pass = 0; pass < 2; ++pass)
+          {
+          unsigned int j = (pass == 0 ? firstIndex : secondIndex);
+          if (pass == 1 && secondIndex == firstIndex)
+            {
+            continue;
+            }
+          dn->GetXYValue(j, &x, &y);
+          if (firstEmitted)
+            {
+            data << ",";
+            }
+          data << "[" << QString("%1").arg(x) << ", " << QString("%1").arg(y) << "]";
+          firstEmitted = true;
+          }
+        }
+      }
+    else
+      {
+      // for each value
+      for (unsigned int j = 0; j < size; ++j)
+        {
+        dn->GetXYValue(j, &x, &y);
+        data << "[" << QString("%1").arg(x) << ", " << QString("%1").arg(y) << "]";
+        if (j < size-1)
+          {
+          data << ",";
+          }
         }
       }
     }
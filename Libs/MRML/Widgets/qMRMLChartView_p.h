@@ -84,9 +84,16 @@ protected:
   QString seriesColorsString(vtkMRMLColorNode*, vtkMRMLDoubleArrayNode*);
 
   // Convert a data array into a string that can be passed as the data
-  // for a series.
+  // for a series. Series with far more points than the chart can display
+  // are downsampled to maximumSeriesPointCount() points (keeping the
+  // minimum and maximum of each bucket), so serializing the data into
+  // javascript stays fast for very large arrays.
   QString seriesDataString(vtkMRMLDoubleArrayNode*);
 
+  // Maximum number of points serialized for a single line/scatter series,
+  // derived from the current viewport width.
+  unsigned int maximumSeriesPointCount()const;
+
   // Convert a data array into a string that can be passed as the data
   // for a series. This version will use values in the ArrayNode to
   // lookup names in a ColorNode.
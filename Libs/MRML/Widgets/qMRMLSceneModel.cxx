@@ -699,6 +699,8 @@ void qMRMLSceneModel::updateScene()
                  this, SLOT(onMRMLNodeIDChanged(vtkObject*,void*)));
 
   d->RowCache.clear();
+  // The repopulation below picks up any node whose insertion was deferred.
+  d->PendingAddedNodes.clear();
 
   // Enabled so it can be interacted with
   this->invisibleRootItem()->setFlags(Qt::ItemIsEnabled);
@@ -1225,9 +1227,52 @@ void qMRMLSceneModel::onMRMLSceneNodeAdded(vtkMRMLScene* scene, vtkMRMLNode* nod
     // to add a node during importing (see https://issues.slicer.org/view.php?id=4080).
     return;
     }
+  if (d->LazyUpdate)
+    {
+    // Coalesce bursts of added nodes: inserting a node traverses the whole
+    // scene (see nodeIndex()), so inserting nodes one by one as the events
+    // arrive makes a burst of n additions quadratic. The pending nodes are
+    // inserted together on the next event loop cycle.
+    if (d->PendingAddedNodes.isEmpty())
+      {
+      QTimer::singleShot(0, this, SLOT(insertPendingNodes()));
+      }
+    d->PendingAddedNodes << node;
+    return;
+    }
   this->insertNode(node);
 }
 
+//------------------------------------------------------------------------------
+void qMRMLSceneModel::insertPendingNodes()
+{
+  Q_D(qMRMLSceneModel);
+  if (d->PendingAddedNodes.isEmpty())
+    {
+    return;
+    }
+  QList<vtkSmartPointer<vtkMRMLNode> > pendingNodes = d->PendingAddedNodes;
+  d->PendingAddedNodes.clear();
+  // For large bursts a full repopulation is cheaper than repeated inserts:
+  // populateScene() traverses the scene only once because it keeps track of
+  // the node indices itself instead of calling nodeIndex() for every node.
+  if (pendingNodes.count() > 10)
+    {
+    this->updateScene();
+    return;
+    }
+  foreach(const vtkSmartPointer<vtkMRMLNode>& node, pendingNodes)
+    {
+    if (node->GetScene() != d->MRMLScene)
+      {
+      // the node has been removed from the scene before its deferred
+      // insertion was processed
+      continue;
+      }
+    this->insertNode(node);
+    }
+}
+
 //------------------------------------------------------------------------------
 void qMRMLSceneModel::onMRMLSceneNodeAboutToBeRemoved(vtkMRMLScene* scene, vtkMRMLNode* node)
 {
@@ -1240,6 +1285,12 @@ void qMRMLSceneModel::onMRMLSceneNodeAboutToBeRemoved(vtkMRMLScene* scene, vtkMR
     {
     return;
     }
+  if (d->PendingAddedNodes.removeOne(node))
+    {
+    // the node is removed before its deferred insertion was processed, it
+    // has never been added to the model
+    return;
+    }
 
   int connectionsRemoved =
     qvtkDisconnect(node, vtkCommand::ModifiedEvent,
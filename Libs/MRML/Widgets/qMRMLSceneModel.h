@@ -71,7 +71,9 @@ class QMRML_WIDGETS_EXPORT qMRMLSceneModel : public QStandardItemModel
   /// Control whether the model actively listens to the scene.
   /// If LazyUpdate is true, the model ignores added node events when the
   /// scene is importing/restoring, but synchronize with the scene once its
-  /// imported/restored.
+  /// imported/restored. Outside of batch processing, bursts of added nodes
+  /// are coalesced and inserted together on the next event loop cycle
+  /// instead of one by one as the events arrive.
   Q_PROPERTY (bool lazyUpdate READ lazyUpdate WRITE setLazyUpdate)
 
   /// Control in which column vtkMRMLNode names are displayed (Qt::DisplayRole).
@@ -240,6 +242,10 @@ protected slots:
   virtual void onItemChanged(QStandardItem * item);
   virtual void delayedItemChanged();
 
+  /// Insert the nodes whose insertion has been deferred by lazyUpdate.
+  /// \sa lazyUpdate, onMRMLSceneNodeAdded()
+  virtual void insertPendingNodes();
+
   /// Recompute the number of columns in the model.
   /// To be called when a XXXColumn is set.
   /// Needs maxColumnId() to be reimplemented in subclasses
@@ -97,6 +97,13 @@ public:
   QStandardItem* DraggedItem;
   mutable QList<vtkMRMLNode*>  DraggedNodes;
   QList<vtkMRMLNode*> MisplacedNodes;
+  // Nodes added to the scene while LazyUpdate is enabled (outside of batch
+  // processing), waiting to be inserted on the next event loop cycle.
+  // Inserting a node is linear in the number of scene nodes (\sa
+  // qMRMLSceneModel::nodeIndex()), coalescing bursts of added nodes avoids
+  // paying that cost once per event.
+  // \sa qMRMLSceneModel::insertPendingNodes()
+  QList<vtkSmartPointer<vtkMRMLNode> > PendingAddedNodes;
   // We keep a list of QStandardItem instead of vtkMRMLNode* because they are
   // likely to be unreachable when browsing the model
   QList<QList<QStandardItem*> > Orphans;
@@ -28,6 +28,7 @@
 #include <QMessageBox>
 #include <QPushButton>
 #include <QSpinBox>
+#include <QTimer>
 #include <QWidgetAction>
 
 // CTK includes
@@ -85,6 +86,9 @@ qMRMLSliceControllerWidgetPrivate::qMRMLSliceControllerWidgetPrivate(qMRMLSliceC
   this->LastForegroundOpacity = 1.;
   this->LastBackgroundOpacity = 1.;
 
+  this->SliceNodeUpdatePending = false;
+  this->SliceCompositeNodeUpdatePending = false;
+
   this->FitToWindowToolButton = 0;
   this->SliceOffsetSlider = 0;
 
@@ -731,7 +735,7 @@ void qMRMLSliceControllerWidgetPrivate::setMRMLSliceNodeInternal(vtkMRMLSliceNod
     }
 
   this->qvtkReconnect(this->MRMLSliceNode, newSliceNode, vtkCommand::ModifiedEvent,
-                      this, SLOT(updateWidgetFromMRMLSliceNode()));
+                      this, SLOT(scheduleUpdateWidgetFromMRMLSliceNode()));
 
   this->MRMLSliceNode = newSliceNode;
 
@@ -752,7 +756,7 @@ void qMRMLSliceControllerWidgetPrivate::setMRMLSliceCompositeNodeInternal(vtkMRM
   this->qvtkReconnect(this->MRMLSliceCompositeNode,
                       sliceComposite,
                       vtkCommand::ModifiedEvent,
-                      this, SLOT(updateWidgetFromMRMLSliceCompositeNode()));
+                      this, SLOT(scheduleUpdateWidgetFromMRMLSliceCompositeNode()));
   this->MRMLSliceCompositeNode = sliceComposite;
 
   if (this->MRMLSliceCompositeNode)
@@ -857,9 +861,32 @@ void qMRMLSliceControllerWidgetPrivate::updateSliceOrientationSelector(
   sliceOrientationSelector->blockSignals(wasBlocked);
 }
 
+// --------------------------------------------------------------------------
+void qMRMLSliceControllerWidgetPrivate::scheduleUpdateWidgetFromMRMLSliceNode()
+{
+  if (this->SliceNodeUpdatePending)
+    {
+    return;
+    }
+  this->SliceNodeUpdatePending = true;
+  QTimer::singleShot(0, this, SLOT(updateWidgetFromMRMLSliceNode()));
+}
+
+// --------------------------------------------------------------------------
+void qMRMLSliceControllerWidgetPrivate::scheduleUpdateWidgetFromMRMLSliceCompositeNode()
+{
+  if (this->SliceCompositeNodeUpdatePending)
+    {
+    return;
+    }
+  this->SliceCompositeNodeUpdatePending = true;
+  QTimer::singleShot(0, this, SLOT(updateWidgetFromMRMLSliceCompositeNode()));
+}
+
 // --------------------------------------------------------------------------
 void qMRMLSliceControllerWidgetPrivate::updateWidgetFromMRMLSliceNode()
 {
+  this->SliceNodeUpdatePending = false;
   if (!this->MRMLSliceNode)
     {
     return;
@@ -990,12 +1017,18 @@ void qMRMLSliceControllerWidgetPrivate::updateWidgetFromMRMLSliceNode()
 void qMRMLSliceControllerWidgetPrivate::updateWidgetFromMRMLSliceCompositeNode()
 {
   Q_Q(qMRMLSliceControllerWidget);
+  this->SliceCompositeNodeUpdatePending = false;
   if (!q->mrmlScene() || q->mrmlScene()->IsBatchProcessing())
     {// when we are loading, the scene might be in an inconsistent mode, where
     // the volumes pointed by the slice composite node don't exist yet
     return;
     }
-  Q_ASSERT(this->MRMLSliceCompositeNode);
+  if (!this->MRMLSliceCompositeNode)
+    {
+    // the composite node may have been removed between the time the update
+    // was scheduled and the time it is executed
+    return;
+    }
 
   bool wasBlocked;
 
@@ -124,6 +124,20 @@ public slots:
   /// Update widget state using the associated MRML slice composite node
   void updateWidgetFromMRMLSliceCompositeNode();
 
+  /// Coalesce modifications of the slice node into a single widget update
+  /// executed on the next event loop cycle. The slice node is modified for
+  /// every mouse event during slice interactions (and once per view when
+  /// slices are linked), a full widget update is too expensive to run on
+  /// that hot path.
+  /// \sa updateWidgetFromMRMLSliceNode()
+  void scheduleUpdateWidgetFromMRMLSliceNode();
+
+  /// Coalesce modifications of the slice composite node into a single
+  /// widget update executed on the next event loop cycle.
+  /// \sa updateWidgetFromMRMLSliceCompositeNode()
+  /// \sa scheduleUpdateWidgetFromMRMLSliceNode()
+  void scheduleUpdateWidgetFromMRMLSliceCompositeNode();
+
   /// Called after a foreground layer volume node is selected
   /// using the associated qMRMLNodeComboBox
   void onForegroundLayerNodeSelected(vtkMRMLNode* node);
@@ -210,6 +224,12 @@ public:
   ctkSignalMapper*                    OrientationMarkerSizesMapper;
 
   ctkSignalMapper*                    RulerTypesMapper;
+
+  /// True when a widget update has been scheduled but not yet executed.
+  /// \sa scheduleUpdateWidgetFromMRMLSliceNode()
+  /// \sa scheduleUpdateWidgetFromMRMLSliceCompositeNode()
+  bool                                SliceNodeUpdatePending;
+  bool                                SliceCompositeNodeUpdatePending;
 };
 
 #endif
@@ -23,6 +23,7 @@
 // Qt includes
 #include <QApplication>
 #include <QPalette>
+#include <QTimer>
 
 // qMRML includes
 #include "qMRMLUtils.h"
@@ -61,6 +62,10 @@ public:
   vtkSmartPointer<vtkCallbackCommand> CallBack;
   vtkSmartPointer<vtkMRMLTableNode>   MRMLTableNode;
   bool Transposed;
+  /// Set to true when a deferred updateModelFromMRML() call has been
+  /// scheduled in response to a node modification; further modifications
+  /// are ignored until the update runs.
+  bool UpdateModelFromMRMLPending;
 };
 
 //------------------------------------------------------------------------------
@@ -69,6 +74,7 @@ qMRMLTableModelPrivate::qMRMLTableModelPrivate(qMRMLTableModel& object)
 {
   this->CallBack = vtkSmartPointer<vtkCallbackCommand>::New();
   this->Transposed = false;
+  this->UpdateModelFromMRMLPending = false;
 }
 
 //------------------------------------------------------------------------------
@@ -193,6 +199,7 @@ vtkMRMLTableNode* qMRMLTableModel::mrmlTableNode()const
 void qMRMLTableModel::updateModelFromMRML()
 {
   Q_D(qMRMLTableModel);
+  d->UpdateModelFromMRMLPending = false;
 
   QObject::disconnect(this, SIGNAL(itemChanged(QStandardItem*)), this, SLOT(onItemChanged(QStandardItem*)));
 
@@ -564,7 +571,17 @@ void qMRMLTableModel::onMRMLTableNodeModified(vtkObject* node)
   Q_UNUSED(tableNode);
   Q_UNUSED(d);
   Q_ASSERT(tableNode == d->MRMLTableNode);
-  this->updateModelFromMRML();
+  // A single import or paste can modify the node many times; compress the
+  // modifications into one model rebuild, executed when control returns to
+  // the event loop. Callers that need the model right away (e.g. the paste
+  // handler in qMRMLTableView) call updateModelFromMRML() directly, which
+  // always updates synchronously.
+  if (d->UpdateModelFromMRMLPending)
+    {
+    return;
+    }
+  d->UpdateModelFromMRMLPending = true;
+  QTimer::singleShot(0, this, SLOT(updateModelFromMRML()));
 }
 
 //------------------------------------------------------------------------------
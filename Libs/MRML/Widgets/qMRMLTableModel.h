@@ -67,9 +67,6 @@ public:
   /// Return the VTK table cell associated to the node index.
   void updateMRMLFromModel(QStandardItem* item);
 
-  /// Update the entire table from the MRML node
-  void updateModelFromMRML();
-
   /// Get MRML table index from model index
   int mrmlTableRowIndex(QModelIndex modelIndex)const;
 
@@ -82,6 +79,13 @@ public:
   /// model columns are deleted.
   int removeSelectionFromMRML(QModelIndexList selection, bool removeModelRow);
 
+public slots:
+  /// Update the entire table from the MRML node.
+  /// Node modified events are compressed: several modifications in a row
+  /// (e.g. while importing a large table) trigger a single deferred update.
+  /// Call this method directly to update synchronously.
+  void updateModelFromMRML();
+
 protected slots:
   void onMRMLTableNodeModified(vtkObject* node);
   void onItemChanged(QStandardItem * item);
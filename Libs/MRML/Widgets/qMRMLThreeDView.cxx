@@ -191,7 +191,8 @@ void qMRMLThreeDViewPrivate::onSceneEndProcessing()
 {
   //qDebug() << "qMRMLThreeDViewPrivate::onSceneImportedEvent";
   Q_Q(qMRMLThreeDView);
-  q->setRenderEnabled(true);
+  // Views hidden by the current layout stay paused, showEvent resumes them
+  q->setRenderEnabled(!q->isHidden());
 }
 
 // --------------------------------------------------------------------------
@@ -442,6 +443,26 @@ void qMRMLThreeDView::resetFocalPoint()
     }
 }
 
+//------------------------------------------------------------------------------
+void qMRMLThreeDView::showEvent(QShowEvent* event)
+{
+  Q_D(qMRMLThreeDView);
+  this->Superclass::showEvent(event);
+  this->setRenderEnabled(
+    d->MRMLScene != 0 && !d->MRMLScene->IsBatchProcessing());
+  // Catch up with the scene changes that happened while the view was hidden
+  this->scheduleRender();
+}
+
+//------------------------------------------------------------------------------
+void qMRMLThreeDView::hideEvent(QHideEvent* event)
+{
+  // Stop submitting renders for a view that is not on screen; showEvent
+  // re-enables rendering and refreshes the view.
+  this->setRenderEnabled(false);
+  this->Superclass::hideEvent(event);
+}
+
 //------------------------------------------------------------------------------
 void qMRMLThreeDView::getDisplayableManagers(vtkCollection *displayableManagers)
 {
@@ -94,6 +94,15 @@ public slots:
   virtual void resetFocalPoint();
 
 protected:
+  /// Reimplemented to pause rendering while the view is not on screen.
+  /// Secondary 3D views that the current layout hides would otherwise
+  /// keep submitting work to the GPU for every scene change, competing
+  /// with the visible views.
+  /// \sa hideEvent
+  virtual void showEvent(QShowEvent* event);
+  /// \sa showEvent
+  virtual void hideEvent(QHideEvent* event);
+
   QScopedPointer<qMRMLThreeDViewPrivate> d_ptr;
 
 private:
@@ -5,9 +5,15 @@
 // MRML includes
 #include <vtkPermissionPrompter.h>
 
+// VTK includes
+#include <vtkCommand.h>
+
 // CURL includes
 #include <curl/curl.h>
 
+// STD includes
+#include <vector>
+
 #if defined(_MSC_VER)
 #pragma warning ( disable : 4786 )
 #endif
@@ -22,6 +28,7 @@ public:
   vtkHTTPHandler* External;
   CURL* CurlHandle;
   int ForbidReuse;
+  int MaxConcurrentStreams;
 };
 
 //----------------------------------------------------------------------------
@@ -32,6 +39,7 @@ vtkHTTPHandler::vtkInternal::vtkInternal(vtkHTTPHandler* external):External(exte
 {
   this->CurlHandle = NULL;
   this->ForbidReuse = 0;
+  this->MaxConcurrentStreams = 1;
 }
 
 //-----------------------------------------------------------------------------
@@ -91,10 +99,206 @@ size_t ProgressCallback(FILE* vtkNotUsed( outputFile ), double dltotal, double d
   return 0;
 }
 
+//----------------------------------------------------------------------------
+//--- one byte range of a segmented download, writing at its own offset
+//--- into the shared preallocated file
+struct vtkHTTPHandlerSegment
+{
+  FILE *File;
+  double BytesDownloaded;
+};
+
+//----------------------------------------------------------------------------
+size_t segment_write_callback(void *ptr, size_t size, size_t nmemb, void *userData)
+{
+  vtkHTTPHandlerSegment *segment = (vtkHTTPHandlerSegment *)userData;
+  if (segment == NULL || segment->File == NULL)
+    {
+    std::cerr << "segment_write_callback: can't write, segment file is null. size = " << size << std::endl;
+    return 0;
+    }
+  size_t written = fwrite(ptr, size, nmemb, segment->File);
+  segment->BytesDownloaded += (double)(written * size);
+  return written;
+}
+
+//----------------------------------------------------------------------------
+//--- ask the server for the content length without downloading the body.
+//--- returns a negative value if the length is not reported.
+double vtkHTTPHandlerQueryContentLength(const char *source)
+{
+  CURL *handle = curl_easy_init();
+  if (handle == NULL)
+    {
+    return -1.0;
+    }
+  curl_easy_setopt(handle, CURLOPT_URL, source);
+  curl_easy_setopt(handle, CURLOPT_NOBODY, 1);
+  curl_easy_setopt(handle, CURLOPT_FOLLOWLOCATION, true);
+  curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT, 3);
+  double contentLength = -1.0;
+  if (curl_easy_perform(handle) == CURLE_OK)
+    {
+    curl_easy_getinfo(handle, CURLINFO_CONTENT_LENGTH_DOWNLOAD, &contentLength);
+    }
+  curl_easy_cleanup(handle);
+  return contentLength;
+}
+
+//----------------------------------------------------------------------------
+//--- download source into destination with numberOfStreams parallel HTTP
+//--- range requests driven by the curl multi interface. The ranges are
+//--- written into a preallocated .partial file that is renamed into place
+//--- on success, so an interrupted transfer never leaves a truncated
+//--- destination behind. Returns 1 on success, 0 if any stream failed or
+//--- the server ignored the range request (http 200 instead of 206).
+int vtkHTTPHandlerSegmentedDownload(vtkHTTPHandler *self,
+                                    const char *source, const char *destination,
+                                    double contentLength, int numberOfStreams,
+                                    int forbidReuse)
+{
+  long long totalLength = (long long)contentLength;
+  std::string partialFile = std::string(destination) + std::string(".partial");
+
+  //--- preallocate so that every stream can write at its own offset
+  FILE *preallocate = fopen(partialFile.c_str(), "wb");
+  if (preallocate == NULL)
+    {
+    vtkErrorWithObjectMacro(self, "SegmentedDownload: unable to open " << partialFile.c_str() << " for writing");
+    return 0;
+    }
+  if (totalLength > 0)
+    {
+    fseek(preallocate, (long)(totalLength - 1), SEEK_SET);
+    fputc(0, preallocate);
+    }
+  fclose(preallocate);
+
+  long long segmentLength = (totalLength + numberOfStreams - 1) / numberOfStreams;
+  CURLM *multiHandle = curl_multi_init();
+  if (multiHandle == NULL)
+    {
+    vtkErrorWithObjectMacro(self, "SegmentedDownload: unable to initialise curl multi handle");
+    return 0;
+    }
+
+  std::vector<vtkHTTPHandlerSegment> segments(numberOfStreams);
+  std::vector<CURL *> handles;
+  int segmentIndex;
+  for (segmentIndex = 0; segmentIndex < numberOfStreams; segmentIndex++)
+    {
+    long long firstByte = segmentIndex * segmentLength;
+    long long lastByte = firstByte + segmentLength - 1;
+    if (lastByte > totalLength - 1)
+      {
+      lastByte = totalLength - 1;
+      }
+    if (firstByte > lastByte)
+      {
+      break;
+      }
+    segments[segmentIndex].BytesDownloaded = 0.0;
+    segments[segmentIndex].File = fopen(partialFile.c_str(), "r+b");
+    if (segments[segmentIndex].File == NULL)
+      {
+      break;
+      }
+    fseek(segments[segmentIndex].File, (long)firstByte, SEEK_SET);
+
+    CURL *handle = curl_easy_init();
+    if (handle == NULL)
+      {
+      fclose(segments[segmentIndex].File);
+      segments[segmentIndex].File = NULL;
+      break;
+      }
+    char range[64];
+    sprintf(range, "%lld-%lld", firstByte, lastByte);
+    curl_easy_setopt(handle, CURLOPT_HTTPGET, 1);
+    curl_easy_setopt(handle, CURLOPT_URL, source);
+    curl_easy_setopt(handle, CURLOPT_RANGE, range);
+    curl_easy_setopt(handle, CURLOPT_FOLLOWLOCATION, true);
+    curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, segment_write_callback);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA, &segments[segmentIndex]);
+    curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT, 3);
+    if (forbidReuse)
+      {
+      curl_easy_setopt(handle, CURLOPT_FORBID_REUSE, 1);
+      }
+    curl_multi_add_handle(multiHandle, handle);
+    handles.push_back(handle);
+    }
+
+  int success = ((int)handles.size() == numberOfStreams) ? 1 : 0;
+
+  //--- drive all the streams from this thread, reporting overall progress
+  int runningHandles = (int)handles.size();
+  curl_multi_perform(multiHandle, &runningHandles);
+  while (success && runningHandles > 0)
+    {
+    curl_multi_wait(multiHandle, NULL, 0, 1000, NULL);
+    curl_multi_perform(multiHandle, &runningHandles);
+    double bytesDownloaded = 0.0;
+    for (segmentIndex = 0; segmentIndex < (int)handles.size(); segmentIndex++)
+      {
+      bytesDownloaded += segments[segmentIndex].BytesDownloaded;
+      }
+    double fractionDone = bytesDownloaded / contentLength;
+    self->InvokeEvent(vtkCommand::ProgressEvent, &fractionDone);
+    }
+
+  //--- every stream must have completed with a partial-content response
+  CURLMsg *message;
+  int messagesLeft = 0;
+  while ((message = curl_multi_info_read(multiHandle, &messagesLeft)) != NULL)
+    {
+    if (message->msg != CURLMSG_DONE)
+      {
+      continue;
+      }
+    long responseCode = 0;
+    curl_easy_getinfo(message->easy_handle, CURLINFO_RESPONSE_CODE, &responseCode);
+    if (message->data.result != CURLE_OK || responseCode != 206)
+      {
+      success = 0;
+      }
+    }
+
+  for (segmentIndex = 0; segmentIndex < (int)handles.size(); segmentIndex++)
+    {
+    curl_multi_remove_handle(multiHandle, handles[segmentIndex]);
+    curl_easy_cleanup(handles[segmentIndex]);
+    if (segments[segmentIndex].File != NULL)
+      {
+      fclose(segments[segmentIndex].File);
+      }
+    }
+  curl_multi_cleanup(multiHandle);
+
+  if (success)
+    {
+    remove(destination);
+    if (rename(partialFile.c_str(), destination) != 0)
+      {
+      vtkErrorWithObjectMacro(self, "SegmentedDownload: unable to rename " << partialFile.c_str()
+        << " to " << destination);
+      success = 0;
+      }
+    }
+  if (!success)
+    {
+    remove(partialFile.c_str());
+    }
+  return success;
+}
+
 //----------------------------------------------------------------------------
 vtkHTTPHandler::vtkHTTPHandler()
 {
   this->Internal = new vtkInternal(this);
+  //--- curl_global_init is not thread safe, so do it here: handlers are
+  //--- constructed on the main thread before any networking thread runs.
+  curl_global_init(CURL_GLOBAL_ALL);
 }
 
 //----------------------------------------------------------------------------
@@ -162,6 +366,27 @@ int vtkHTTPHandler::GetForbidReuse()
   return this->Internal->ForbidReuse;
 }
 
+//----------------------------------------------------------------------------
+void vtkHTTPHandler::SetMaxConcurrentStreams(int value)
+{
+  if (value < 1)
+    {
+    value = 1;
+    }
+  if (this->Internal->MaxConcurrentStreams == value)
+    {
+    return;
+    }
+  this->Internal->MaxConcurrentStreams = value;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+int vtkHTTPHandler::GetMaxConcurrentStreams()
+{
+  return this->Internal->MaxConcurrentStreams;
+}
+
 //----------------------------------------------------------------------------
 void vtkHTTPHandler::InitTransfer( )
 {
@@ -190,39 +415,56 @@ void vtkHTTPHandler::StageFileRead(const char * source, const char * destination
     vtkErrorMacro("StageFileRead: source or dest is null!");
     return;
     }
-  /*
-  if (this->LocalFile)
+
+  if (this->Internal->MaxConcurrentStreams > 1)
+    {
+    //--- splitting the transfer is only worth the extra connections for
+    //--- large files, and needs the server to report the content length
+    const double minimumLengthForSegments = 16.0 * 1024.0 * 1024.0;
+    double contentLength = vtkHTTPHandlerQueryContentLength(source);
+    if (contentLength >= minimumLengthForSegments)
+      {
+      if (vtkHTTPHandlerSegmentedDownload(this, source, destination, contentLength,
+            this->Internal->MaxConcurrentStreams, this->Internal->ForbidReuse))
+        {
+        return;
+        }
+      //--- servers that ignore range requests (http 200 instead of 206)
+      //--- end up here and use the single stream transfer below
+      vtkDebugMacro("StageFileRead: segmented download not possible, using a single stream");
+      }
+    }
+  //--- each transfer drives its own curl handle and file stream, so
+  //--- several networking threads can call StageFileRead concurrently
+  //--- on the same handler.
+  CURL *curlHandle = curl_easy_init();
+  if (curlHandle == NULL)
     {
-    this->LocalFile->close();
-    delete this->LocalFile;
-    this->LocalFile = NULL;
+    vtkErrorMacro("StageFileRead: unable to initialise curl handle");
+    return;
     }
-  this->LocalFile = new std::ofstream(destination, std::ios::binary);
-  */
-  this->InitTransfer( );
-
 
   if ( this->Internal->ForbidReuse )
     {
-    curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_FORBID_REUSE, 1);
+    curl_easy_setopt(curlHandle, CURLOPT_FORBID_REUSE, 1);
     }
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_HTTPGET, 1);
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_URL, source);
-//  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_NOPROGRESS, false);
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_FOLLOWLOCATION, true);
+  curl_easy_setopt(curlHandle, CURLOPT_HTTPGET, 1);
+  curl_easy_setopt(curlHandle, CURLOPT_URL, source);
+//  curl_easy_setopt(curlHandle, CURLOPT_NOPROGRESS, false);
+  curl_easy_setopt(curlHandle, CURLOPT_FOLLOWLOCATION, true);
   // use the default curl write call back
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_WRITEFUNCTION, NULL); // write_callback);
-  this->LocalFile = fopen(destination, "wb");
-  // output goes into LocalFile, must be  FILE*
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_WRITEDATA, this->LocalFile);
-//  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_PROGRESSDATA, NULL);
-//  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_PROGRESSFUNCTION, ProgressCallback);
+  curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, NULL); // write_callback);
+  FILE *localFile = fopen(destination, "wb");
+  // output goes into localFile, must be  FILE*
+  curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, localFile);
+//  curl_easy_setopt(curlHandle, CURLOPT_PROGRESSDATA, NULL);
+//  curl_easy_setopt(curlHandle, CURLOPT_PROGRESSFUNCTION, ProgressCallback);
 
   // quick timeout during connection phase if URL is not accessible (e.g. blocked by a firewall)
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_CONNECTTIMEOUT, 3); // in seconds (type long)
+  curl_easy_setopt(curlHandle, CURLOPT_CONNECTTIMEOUT, 3); // in seconds (type long)
 
   vtkDebugMacro("StageFileRead: about to do the curl download... source = " << source << ", dest = " << destination);
-  CURLcode retval = curl_easy_perform(this->Internal->CurlHandle);
+  CURLcode retval = curl_easy_perform(curlHandle);
 
   if (retval == CURLE_OK)
     {
@@ -230,7 +472,7 @@ void vtkHTTPHandler::StageFileRead(const char * source, const char * destination
     }
   else if (retval == CURLE_BAD_FUNCTION_ARGUMENT)
     {
-    vtkErrorMacro("StageFileRead: bad function argument to curl, did you init CurlHandle?");
+    vtkErrorMacro("StageFileRead: bad function argument to curl, did you init the curl handle?");
     }
   else if (retval == CURLE_OUT_OF_MEMORY)
     {
@@ -249,16 +491,11 @@ void vtkHTTPHandler::StageFileRead(const char * source, const char * destination
       this->GetPermissionPrompter()->SetRemember ( 0 );
       }
     }
-  this->CloseTransfer();
+  curl_easy_cleanup(curlHandle);
 
-  /*
-  this->LocalFile->close();
-  delete this->LocalFile;
-  this->LocalFile = NULL;
-  */
-  if (this->LocalFile)
+  if (localFile)
     {
-    fclose(this->LocalFile);
+    fclose(localFile);
     }
 }
 
@@ -267,28 +504,30 @@ void vtkHTTPHandler::StageFileRead(const char * source, const char * destination
 void vtkHTTPHandler::StageFileWrite(const char * source, const char * destination)
 {
   //--- check these arguments...
-  /*
-  if (this->LocalFile)
+  //--- as in StageFileRead, the transfer is self contained so that
+  //--- concurrent uploads from the networking threads are safe.
+  FILE *localFile = fopen(source, "r");
+
+  CURL *curlHandle = curl_easy_init();
+  if (curlHandle == NULL)
     {
-    this->LocalFile->close();
-    delete this->LocalFile;
-    this->LocalFile = NULL;
+    vtkErrorMacro("StageFileWrite: unable to initialise curl handle");
+    if (localFile)
+      {
+      fclose(localFile);
+      }
+    return;
     }
-  this->LocalFile = new std::ofstream(destination, std::ios::binary);
-  */
-  this->LocalFile = fopen(source, "r");
 
-  this->InitTransfer( );
-
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_PUT, 1);
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_URL, destination);
-//  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_NOPROGRESS, false);
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_FOLLOWLOCATION, true);
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_READFUNCTION, read_callback);
-  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_READDATA, this->LocalFile);
-//  curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_PROGRESSDATA, NULL);
-  //curl_easy_setopt(this->Internal->CurlHandle, CURLOPT_PROGRESSFUNCTION, ProgressCallback);
-  CURLcode retval = curl_easy_perform(this->Internal->CurlHandle);
+  curl_easy_setopt(curlHandle, CURLOPT_PUT, 1);
+  curl_easy_setopt(curlHandle, CURLOPT_URL, destination);
+//  curl_easy_setopt(curlHandle, CURLOPT_NOPROGRESS, false);
+  curl_easy_setopt(curlHandle, CURLOPT_FOLLOWLOCATION, true);
+  curl_easy_setopt(curlHandle, CURLOPT_READFUNCTION, read_callback);
+  curl_easy_setopt(curlHandle, CURLOPT_READDATA, localFile);
+//  curl_easy_setopt(curlHandle, CURLOPT_PROGRESSDATA, NULL);
+  //curl_easy_setopt(curlHandle, CURLOPT_PROGRESSFUNCTION, ProgressCallback);
+  CURLcode retval = curl_easy_perform(curlHandle);
 
    if (retval == CURLE_OK)
     {
@@ -308,12 +547,10 @@ void vtkHTTPHandler::StageFileWrite(const char * source, const char * destinatio
       }
     }
 
-  this->CloseTransfer();
+  curl_easy_cleanup(curlHandle);
 
-  fclose(this->LocalFile);
-  /*
-  this->LocalFile->close();
-  delete this->LocalFile;
-  this->LocalFile = NULL;
-  */
+  if (localFile)
+    {
+    fclose(localFile);
+    }
 }
@@ -32,7 +32,19 @@ public:
   void SetForbidReuse(int value);
   int GetForbidReuse();
 
-  /// This function wraps curl functionality to download a specified URL to a specified dir
+  /// Number of parallel HTTP range streams that StageFileRead may use for
+  /// large downloads. When set to more than 1 and the server reports a
+  /// content length, the file is split into byte ranges that are
+  /// transferred concurrently into a preallocated file; servers that
+  /// ignore range requests fall back to the usual single stream transfer.
+  /// ProgressEvent is invoked with the completed fraction while a
+  /// segmented download runs. 1 (single stream) by default.
+  void SetMaxConcurrentStreams(int value);
+  int GetMaxConcurrentStreams();
+
+  /// This function wraps curl functionality to download a specified URL to a specified dir.
+  /// Every call drives its own curl handle and file stream, so transfers of
+  /// different files may run concurrently from several networking threads.
   virtual void StageFileRead(const char * source, const char * destination) VTK_OVERRIDE;
   using vtkURIHandler::StageFileRead;
   virtual void StageFileWrite(const char * source, const char * destination) VTK_OVERRIDE;
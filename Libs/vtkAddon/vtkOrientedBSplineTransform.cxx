@@ -12,12 +12,58 @@
 #include "vtkImageData.h"
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
+#include "vtkMultiThreader.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPoints.h"
 
 #include <math.h>
 
 vtkStandardNewMacro(vtkOrientedBSplineTransform);
 
+//------------------------------------------------------------------------
+namespace
+{
+
+struct vtkOrientedBSplineTransformPointsJob
+{
+  vtkOrientedBSplineTransform* Transform;
+  vtkPoints* InPts;
+  vtkPoints* OutPts;
+  vtkIdType NumberOfPoints;
+};
+
+VTK_THREAD_RETURN_TYPE vtkOrientedBSplineTransformPointsCallback(void *arg)
+{
+  vtkMultiThreader::ThreadInfo* info = static_cast<vtkMultiThreader::ThreadInfo*>(arg);
+  vtkOrientedBSplineTransformPointsJob* job =
+    static_cast<vtkOrientedBSplineTransformPointsJob*>(info->UserData);
+  int threadId = info->ThreadID;
+  int threadCount = info->NumberOfThreads;
+
+  // split the points into contiguous ranges, one per thread
+  vtkIdType pointsPerThread = (job->NumberOfPoints + threadCount - 1) / threadCount;
+  vtkIdType firstPoint = threadId * pointsPerThread;
+  vtkIdType endPoint = firstPoint + pointsPerThread;
+  if (endPoint > job->NumberOfPoints)
+    {
+    endPoint = job->NumberOfPoints;
+    }
+
+  double point[3];
+  for (vtkIdType pointIndex = firstPoint; pointIndex < endPoint; ++pointIndex)
+    {
+    job->InPts->GetPoint(pointIndex, point);
+    // InternalTransformPoint only reads the cached matrices and the
+    // displacement grid, so it is safe to call concurrently after Update()
+    job->Transform->InternalTransformPoint(point, point);
+    job->OutPts->SetPoint(pointIndex, point);
+    }
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // end of anonymous namespace
+
 vtkCxxSetObjectMacro(vtkOrientedBSplineTransform,GridDirectionMatrix,vtkMatrix4x4);
 vtkCxxSetObjectMacro(vtkOrientedBSplineTransform,BulkTransformMatrix,vtkMatrix4x4);
 
@@ -126,6 +172,41 @@ void vtkOrientedBSplineTransform::PrintSelf(ostream& os, vtkIndent indent)
     }
 }
 
+//----------------------------------------------------------------------------
+void vtkOrientedBSplineTransform::TransformPoints(vtkPoints* inPts, vtkPoints* outPts)
+{
+  vtkIdType numPts = inPts ? inPts->GetNumberOfPoints() : 0;
+  // Threading overhead is not worth it for small point sets. Appending to a
+  // non-empty output (or transforming in place) is left to the serial
+  // superclass implementation because the output has to be resized here,
+  // which would not preserve already stored points.
+  const vtkIdType minimumPointsForThreading = 10000;
+  int numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
+  if (outPts == NULL || outPts->GetNumberOfPoints() != 0 || inPts == outPts
+      || numPts < minimumPointsForThreading || numberOfThreads <= 1)
+    {
+    this->Superclass::TransformPoints(inPts, outPts);
+    return;
+    }
+
+  // make sure the cached matrices and the displacement grid are up to date
+  // before they are read concurrently
+  this->Update();
+
+  outPts->SetNumberOfPoints(numPts);
+
+  vtkOrientedBSplineTransformPointsJob job;
+  job.Transform = this;
+  job.InPts = inPts;
+  job.OutPts = outPts;
+  job.NumberOfPoints = numPts;
+
+  vtkNew<vtkMultiThreader> threader;
+  threader->SetNumberOfThreads(numberOfThreads);
+  threader->SetSingleMethod(vtkOrientedBSplineTransformPointsCallback, &job);
+  threader->SingleMethodExecute();
+}
+
 //----------------------------------------------------------------------------
 void vtkOrientedBSplineTransform::ForwardTransformPoint(const double inPointTemp[3],
                                                 double outPoint[3])
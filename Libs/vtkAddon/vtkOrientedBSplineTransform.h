@@ -56,6 +56,15 @@ public:
   virtual void SetBulkTransformMatrix(vtkMatrix4x4*);
   vtkGetObjectMacro(BulkTransformMatrix,vtkMatrix4x4);
 
+  // Description:
+  // Apply the transformation to a series of points. Large point sets are
+  // processed in parallel on all available threads, which speeds up
+  // operations that evaluate the b-spline at many points (such as
+  // hardening the transform on a dense model). Falls back to the serial
+  // superclass implementation for small point sets and when appending to
+  // a non-empty output.
+  void TransformPoints(vtkPoints* inPts, vtkPoints* outPts) VTK_OVERRIDE;
+
 protected:
   vtkOrientedBSplineTransform();
   ~vtkOrientedBSplineTransform();
@@ -11,8 +11,52 @@
 
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
+#include "vtkMultiThreader.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+
+namespace
+{
+
+struct vtkOrientedGridTransformPointsJob
+{
+  vtkOrientedGridTransform* Transform;
+  vtkPoints* InPts;
+  vtkPoints* OutPts;
+  vtkIdType NumberOfPoints;
+};
+
+VTK_THREAD_RETURN_TYPE vtkOrientedGridTransformPointsCallback(void *arg)
+{
+  vtkMultiThreader::ThreadInfo* info = static_cast<vtkMultiThreader::ThreadInfo*>(arg);
+  vtkOrientedGridTransformPointsJob* job =
+    static_cast<vtkOrientedGridTransformPointsJob*>(info->UserData);
+  int threadId = info->ThreadID;
+  int threadCount = info->NumberOfThreads;
+
+  // each thread processes a contiguous range of points
+  vtkIdType pointsPerThread = (job->NumberOfPoints + threadCount - 1) / threadCount;
+  vtkIdType firstPoint = threadId * pointsPerThread;
+  vtkIdType endPoint = firstPoint + pointsPerThread;
+  if (endPoint > job->NumberOfPoints)
+    {
+    endPoint = job->NumberOfPoints;
+    }
+
+  double point[3];
+  for (vtkIdType pointIndex = firstPoint; pointIndex < endPoint; ++pointIndex)
+    {
+    job->InPts->GetPoint(pointIndex, point);
+    // the forward transform only reads the cached matrices and the
+    // displacement grid, so concurrent calls are safe after Update()
+    job->Transform->InternalTransformPoint(point, point);
+    job->OutPts->SetPoint(pointIndex, point);
+    }
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // end of anonymous namespace
 
 vtkStandardNewMacro(vtkOrientedGridTransform);
 
@@ -97,6 +141,46 @@ inline void vtkLinearTransformJacobian(double aMat[3][3], double bMat[4][4], dou
     }
 }
 
+//----------------------------------------------------------------------------
+void vtkOrientedGridTransform::TransformPoints(vtkPoints* inPts, vtkPoints* outPts)
+{
+  vtkIdType numPts = inPts ? inPts->GetNumberOfPoints() : 0;
+  // For small point sets the threading overhead outweighs the gain.
+  // Appending to a non-empty output (or transforming in place) is handled
+  // by the serial superclass implementation, since the output is resized
+  // here and already stored points would be lost.
+  // The inverse direction is also left to the superclass: the iterative
+  // inverse computation updates LastWarningMTime and invokes
+  // ConvergenceFailureEvent when it fails to converge, neither of which
+  // is safe to do from worker threads.
+  const vtkIdType minimumPointsForThreading = 10000;
+  int numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
+  if (outPts == NULL || outPts->GetNumberOfPoints() != 0 || inPts == outPts
+      || this->GetInverseFlag() || numPts < minimumPointsForThreading
+      || numberOfThreads <= 1)
+    {
+    this->Superclass::TransformPoints(inPts, outPts);
+    return;
+    }
+
+  // bring the cached matrices and the displacement grid up to date before
+  // worker threads start reading them
+  this->Update();
+
+  outPts->SetNumberOfPoints(numPts);
+
+  vtkOrientedGridTransformPointsJob job;
+  job.Transform = this;
+  job.InPts = inPts;
+  job.OutPts = outPts;
+  job.NumberOfPoints = numPts;
+
+  vtkNew<vtkMultiThreader> threader;
+  threader->SetNumberOfThreads(numberOfThreads);
+  threader->SetSingleMethod(vtkOrientedGridTransformPointsCallback, &job);
+  threader->SingleMethodExecute();
+}
+
 //----------------------------------------------------------------------------
 void vtkOrientedGridTransform::ForwardTransformPoint(const double inPoint[3],
                                              double outPoint[3])
@@ -40,6 +40,17 @@ public:
   // Make another transform of the same type.
   vtkAbstractTransform *MakeTransform() VTK_OVERRIDE;
 
+  // Description:
+  // Apply the transformation to a series of points. Large point sets are
+  // split across all available threads, which makes evaluating the
+  // displacement grid at many points (such as hardening the transform on
+  // a dense model) considerably faster. Falls back to the serial
+  // superclass implementation for small point sets, when appending to a
+  // non-empty output, and when the transform is inverted (the iterative
+  // inverse computation may emit warnings and events, which must happen
+  // on a single thread).
+  void TransformPoints(vtkPoints* inPts, vtkPoints* outPts) VTK_OVERRIDE;
+
   /// List of custom events fired by the class.
   // ConvergenceFailureEvent is invoked when the gradient cannot be
   // inverted, probably due to a singular transform or numeric instability.
@@ -75,6 +75,7 @@ public:
   SetWorkArray( std::vector< SegmentBetweenTwo< TImage > >& workArray )
   {
     m_WorkArray = workArray;
+    m_CompletedCount = 0;
   }
 
   /** Array of segments which need to be interpolated. */
@@ -86,7 +87,9 @@ public:
 
 protected:
   // We need a constructor for the itkNewMacro.
-  MorphologicalContourInterpolatorParallelInvoker() {}
+  MorphologicalContourInterpolatorParallelInvoker()
+    : m_CompletedCount( 0 )
+  {}
 
 private:
   virtual void
@@ -95,6 +98,10 @@ private:
     // Look only at the range of cells by the set of indices in the subDomain.
     for ( itk::IndexValueType ii = subDomain[0]; ii <= subDomain[1] && ii < IndexValueType( m_WorkArray.size() ); ++ii )
       {
+      if ( this->m_Associate->GetAbortGenerateData() )
+        {
+        return; // abort requested, skip the remaining segments
+        }
       this->m_Associate->InterpolateBetweenTwo(
         m_WorkArray[ii].axis,
         m_WorkArray[ii].out,
@@ -104,10 +111,19 @@ private:
         m_WorkArray[ii].iconn,
         m_WorkArray[ii].jconn,
         threadId );
+      m_CompletedMutex.Lock();
+      IdentifierType completed = ++m_CompletedCount;
+      m_CompletedMutex.Unlock();
+      if ( threadId == 0 ) // progress is only reported from the main thread
+        {
+        this->m_Associate->UpdateProgress( float( completed ) / m_WorkArray.size() );
+        }
       }
   } // ThreadedExecution
 
   std::vector< SegmentBetweenTwo< TImage > > m_WorkArray;
+  SimpleFastMutexLock                        m_CompletedMutex;
+  IdentifierType                             m_CompletedCount;
 };
 
 template< typename TImage >
@@ -1550,6 +1566,10 @@ MorphologicalContourInterpolator< TImage >
         it != m_LabeledSlices[axis].end();
         ++it )
     {
+    if ( this->GetAbortGenerateData() )
+      {
+      return;
+      }
     if ( m_Label == 0 || m_Label == it->first ) // label needs to be interpolated
       {
       typename SliceSetType::iterator prev = it->second.begin();
@@ -1693,7 +1713,7 @@ MorphologicalContourInterpolator< TImage >
 
     for ( unsigned int a = 0; a < TImage::ImageDimension; ++a )
       {
-      if ( aggregate[a] )
+      if ( aggregate[a] && !this->GetAbortGenerateData() )
         {
         this->InterpolateAlong( a, m_Output );
         }
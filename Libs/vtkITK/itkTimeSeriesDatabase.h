@@ -5,6 +5,7 @@
 #include <itkImage.h>
 #include <itkArray.h>
 #include <itkImageSource.h>
+#include <itkMultiThreader.h>
 #include <iostream>
 #include <fstream>
 #include <itkTimeSeriesDatabaseHelper.h>
@@ -101,6 +102,23 @@ public:
    */
   float GetCacheSizeInMiB ();
 
+  /** Enable/disable prefetching of the predicted next timepoint.
+   * After each GenerateData call, the blocks of the timepoint that continues
+   * the current scrubbing direction are read into the cache on a background
+   * thread, so stepping through the series does not wait on disk.
+   * The thread is joined before any other access to the database.
+   */
+  itkSetMacro ( Prefetching, bool );
+  itkGetMacro ( Prefetching, bool );
+  itkBooleanMacro ( Prefetching );
+
+  /** Cache effectiveness counters.  A hit is a block served from the cache,
+   * a miss is a block read from disk (blocks loaded by the prefetcher count
+   * as misses when loaded and hits when later requested).
+   */
+  itkGetMacro ( CacheHits, unsigned long );
+  itkGetMacro ( CacheMisses, unsigned long );
+
 
 protected:
   TimeSeriesDatabase();
@@ -147,6 +165,25 @@ protected:
   };
   TimeSeriesDatabaseHelper::LRUCache<unsigned long, CacheBlock> m_Cache;
   CacheBlock* GetCacheBlock ( unsigned long index );
+
+  /// Background prefetching of the predicted next timepoint.
+  /// Only one prefetch thread exists at a time and it is joined before the
+  /// cache or the database files are touched from the pipeline thread.
+  static ITK_THREAD_RETURN_TYPE PrefetchThreaderCallback ( void* arg );
+  void StartPrefetch ( unsigned int image, const typename OutputImageType::RegionType& region );
+  void WaitForPrefetch ();
+  void PrefetchImage ();
+
+  bool                   m_Prefetching;
+  MultiThreader::Pointer m_PrefetchThreader;
+  int                    m_PrefetchThreadId;
+  volatile bool          m_StopPrefetch;
+  unsigned int           m_PrefetchImage;
+  typename OutputImageType::RegionType m_PrefetchRegion;
+  int                    m_LastGeneratedImage;
+
+  unsigned long m_CacheHits;
+  unsigned long m_CacheMisses;
 };
 
 } // end namespace itk
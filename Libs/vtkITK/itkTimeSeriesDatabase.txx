@@ -60,6 +60,7 @@ bool TimeSeriesDatabase<TPixel>::IsOpen () const
 template <class TPixel>
 void TimeSeriesDatabase<TPixel>::Disconnect ()
 {
+  this->WaitForPrefetch();
   for ( int idx = 0; idx < this->m_DatabaseFiles.size(); idx++ )
     {
     this->m_DatabaseFiles[idx]->close();
@@ -189,6 +190,7 @@ typename TimeSeriesDatabase<TPixel>::CacheBlock* TimeSeriesDatabase<TPixel>::Get
   CacheBlock* Buffer = this->m_Cache.find ( index );
   if ( Buffer == 0 ) {
     // Fill it in
+    this->m_CacheMisses++;
     CacheBlock B;
     int FileIdx = this->CalculateFileIndex ( index );
 
@@ -196,6 +198,8 @@ typename TimeSeriesDatabase<TPixel>::CacheBlock* TimeSeriesDatabase<TPixel>::Get
     this->m_DatabaseFiles[FileIdx]->read ( reinterpret_cast<char*> ( B.data ), TimeSeriesVolumeBlockSize * sizeof ( TPixel ) );
     this->m_Cache.insert ( index, B );
     Buffer = this->m_Cache.find ( index );
+  } else {
+    this->m_CacheHits++;
   }
   return Buffer;
 }
@@ -206,19 +210,20 @@ void TimeSeriesDatabase<TPixel>::GetVoxelTimeSeries ( typename OutputImageType::
 {
   // See if the index is inside the volume
   // and figure out which cache block we need
+  this->WaitForPrefetch();
   Size<3> CurrentBlock;
   Size<3> Offset;
   for ( int i = 0; i < 3; i++ ) {
-    if ( idx[i] < 0 || idx[i] > this->m_OutputRegion.Size[i] ) {
+    if ( idx[i] < 0 || idx[i] >= static_cast<IndexValueType>( this->m_OutputRegion.GetSize ( i ) ) ) {
       throw 1;
     }
-    CurrentBlock[i] = reinterpret_cast<unsigned long> ( idx[i] / (double)TimeSeriesBlockSize );
+    CurrentBlock[i] = static_cast<unsigned long> ( idx[i] / TimeSeriesBlockSize );
     Offset[i] = idx[i] % TimeSeriesBlockSize;
   }
   unsigned long offset = Offset[0] + Offset[1] * TimeSeriesBlockSize + Offset[2] * TimeSeriesBlockSizeP2;
   array = ArrayType ( this->m_Dimensions[3] );
-  for ( int volume = 0; volume < this->m_Dimensions[3]; volume++ ) {
-    CacheBlock* cache = this->GetCacheBlock ( CurrentBlock, volume );
+  for ( unsigned int volume = 0; volume < this->m_Dimensions[3]; volume++ ) {
+    CacheBlock* cache = this->GetCacheBlock ( this->CalculateIndex ( CurrentBlock, volume ) );
     array[volume] = cache->data[offset];
   }
 }
@@ -244,6 +249,9 @@ void TimeSeriesDatabase<TPixel>::GenerateData()
   output->SetBufferedRegion ( Region );
   output->Allocate();
 
+  // Make sure no prefetch thread is touching the cache or the files
+  this->WaitForPrefetch();
+
   if ( !this->IsOpen() )
   {
     itkGenericExceptionMacro ( "TimeSeriesDatabase::GenerateOutputInformation: not open for reading" );
@@ -334,9 +342,80 @@ void TimeSeriesDatabase<TPixel>::GenerateData()
       }
     }
 
+  // Guess which timepoint comes next from the scrubbing direction and load
+  // its blocks in the background so the next Update is served from cache
+  if ( this->m_Prefetching && this->m_Dimensions[3] > 1 )
+    {
+    int stride = 1;
+    if ( this->m_LastGeneratedImage >= 0
+         && static_cast<int>( this->m_CurrentImage ) != this->m_LastGeneratedImage )
+      {
+      stride = static_cast<int>( this->m_CurrentImage ) - this->m_LastGeneratedImage;
+      }
+    int next = static_cast<int>( this->m_CurrentImage ) + stride;
+    if ( next >= 0 && next < static_cast<int>( this->m_Dimensions[3] ) )
+      {
+      this->StartPrefetch ( next, Region );
+      }
+    }
+  this->m_LastGeneratedImage = this->m_CurrentImage;
+
   return;
 }
 
+template <class TPixel>
+ITK_THREAD_RETURN_TYPE TimeSeriesDatabase<TPixel>::PrefetchThreaderCallback ( void* arg )
+{
+  MultiThreader::ThreadInfoStruct* info = static_cast<MultiThreader::ThreadInfoStruct*> ( arg );
+  Self* self = static_cast<Self*> ( info->UserData );
+  self->PrefetchImage();
+  return ITK_THREAD_RETURN_VALUE;
+}
+
+template <class TPixel>
+void TimeSeriesDatabase<TPixel>::StartPrefetch ( unsigned int image,
+                                                 const typename OutputImageType::RegionType& region )
+{
+  this->WaitForPrefetch();
+  this->m_PrefetchImage = image;
+  this->m_PrefetchRegion = region;
+  this->m_StopPrefetch = false;
+  this->m_PrefetchThreadId = this->m_PrefetchThreader->SpawnThread ( PrefetchThreaderCallback, this );
+}
+
+template <class TPixel>
+void TimeSeriesDatabase<TPixel>::WaitForPrefetch ()
+{
+  if ( this->m_PrefetchThreadId >= 0 )
+    {
+    this->m_StopPrefetch = true;
+    this->m_PrefetchThreader->TerminateThread ( this->m_PrefetchThreadId );
+    this->m_PrefetchThreadId = -1;
+    }
+}
+
+template <class TPixel>
+void TimeSeriesDatabase<TPixel>::PrefetchImage ()
+{
+  // Runs on the prefetch thread.  Reads the blocks the prefetched timepoint
+  // needs for the same region as the last request into the LRU cache.
+  Size<3> BlockStart, BlockCount, CurrentBlock;
+  for ( unsigned int i = 0; i < 3; i++ ) {
+    BlockStart[i] = (int) floor ( this->m_PrefetchRegion.GetIndex(i) / (double)TimeSeriesBlockSize );
+    BlockCount[i] = (int) TSD_MAX ( 1.0, ceil ( (this->m_PrefetchRegion.GetIndex(i)+this->m_PrefetchRegion.GetSize(i)) / (double)TimeSeriesBlockSize ) - BlockStart[i] );
+  }
+  for ( CurrentBlock[2] = BlockStart[2]; CurrentBlock[2] < BlockStart[2] + BlockCount[2]; CurrentBlock[2]++ ) {
+    for ( CurrentBlock[1] = BlockStart[1]; CurrentBlock[1] < BlockStart[1] + BlockCount[1]; CurrentBlock[1]++ ) {
+      for ( CurrentBlock[0] = BlockStart[0]; CurrentBlock[0] < BlockStart[0] + BlockCount[0]; CurrentBlock[0]++ ) {
+        if ( this->m_StopPrefetch ) {
+          return;
+        }
+        this->GetCacheBlock ( this->CalculateIndex ( CurrentBlock, this->m_PrefetchImage ) );
+      }
+    }
+  }
+}
+
 
 template <class TPixel>
 void TimeSeriesDatabase<TPixel>::CreateFromFileArchetype ( const char* TSDFilename, const char* archetype )
@@ -567,6 +646,7 @@ float TimeSeriesDatabase<TPixel>::GetCacheSizeInMiB()
 template <class TPixel>
 void TimeSeriesDatabase<TPixel>::SetCacheSizeInMiB ( float sz )
 {
+  this->WaitForPrefetch();
   // How many blocks is this?
   double BlockSizeInMiB = sizeof ( TPixel ) * TimeSeriesVolumeBlockSize / ( 1024*1024.);
   unsigned long int blocks = (unsigned long int) ceil ( sz * BlockSizeInMiB );
@@ -577,10 +657,19 @@ template <class TPixel>
 TimeSeriesDatabase<TPixel>::TimeSeriesDatabase () : m_Cache ( 1024 ){
   this->m_Dimensions.SetSize ( 4 );
   this->m_BlocksPerImage.SetSize ( 4 );
+  this->m_Prefetching = true;
+  this->m_PrefetchThreader = MultiThreader::New();
+  this->m_PrefetchThreadId = -1;
+  this->m_StopPrefetch = false;
+  this->m_PrefetchImage = 0;
+  this->m_LastGeneratedImage = -1;
+  this->m_CacheHits = 0;
+  this->m_CacheMisses = 0;
 }
 
 template <class TPixel>
 TimeSeriesDatabase<TPixel>::~TimeSeriesDatabase () {
+  this->WaitForPrefetch();
   // m_Cache.statistics ( std::cout );
 }
 
@@ -609,6 +698,9 @@ TimeSeriesDatabase<TPixel>
   } else {
     os << indent << "Database is closed." << "\n";
   }
+  os << indent << "Prefetching: " << ( m_Prefetching ? "On" : "Off" ) << "\n";
+  os << indent << "CacheHits: " << m_CacheHits << "\n";
+  os << indent << "CacheMisses: " << m_CacheMisses << "\n";
 
   this->m_Cache.statistics ( os );
 }
@@ -68,6 +68,7 @@ vtkITKArchetypeImageSeriesReader::vtkITKArchetypeImageSeriesReader()
   this->FileNameSliceSpacing = 1;
   this->FileNameSliceCount = 0;
   this->UseNativeOrigin = true;
+  this->UseMemoryMapIO = 0;
 
 #ifdef VTKITK_BUILD_DICOM_SUPPORT
   this->DICOMImageIOApproach = vtkITKArchetypeImageSeriesReader::GDCM;
@@ -1118,6 +1119,65 @@ std::string vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces(const itk
   return tagValue;
 }
 
+#ifdef VTKITK_BUILD_DICOM_SUPPORT
+namespace
+{
+// The DICOM tags read for series grouping, in the order the serial
+// grouping pass consumes them
+const char* DicomGroupingTags[] =
+  {
+  "0020|000e", // series instance UID
+  "0008|0033", // content time
+  "0018|1060", // trigger time
+  "0018|0086", // echo numbers
+  "0010|9089", // diffusion gradient orientation
+  "0020|1041", // slice location
+  "0020|0037", // image orientation patient
+  "0020|0032"  // image position patient
+  };
+const int NumberOfDicomGroupingTags = 8;
+
+struct DicomHeaderScan
+{
+  const std::vector<std::string>* FileNames;
+  // NumberOfDicomGroupingTags consecutive values per file
+  std::vector<std::string>* TagValues;
+};
+}
+
+//----------------------------------------------------------------------------
+ITK_THREAD_RETURN_TYPE vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeadersThreaderCallback(void* arg)
+{
+  itk::MultiThreader::ThreadInfoStruct* info =
+    static_cast<itk::MultiThreader::ThreadInfoStruct*>(arg);
+  DicomHeaderScan* scan = static_cast<DicomHeaderScan*>(info->UserData);
+  // Each worker parses an interleaved share of the files with its own
+  // reader instance and only writes the tag values of its own files,
+  // so no locking is needed.
+  itk::GDCMImageIO::Pointer gdcmIO = itk::GDCMImageIO::New();
+  size_t nFiles = scan->FileNames->size();
+  for (size_t f = info->ThreadID; f < nFiles; f += info->NumberOfThreads)
+    {
+    gdcmIO->SetFileName( (*scan->FileNames)[f] );
+    try
+      {
+      gdcmIO->ReadImageInformation();
+      }
+    catch (itk::ExceptionObject&)
+      {
+      continue; // unreadable header: tags stay empty and get index -1
+      }
+    const itk::MetaDataDictionary &dict = gdcmIO->GetMetaDataDictionary();
+    for (int tag = 0; tag < NumberOfDicomGroupingTags; tag++)
+      {
+      (*scan->TagValues)[f*NumberOfDicomGroupingTags + tag] =
+        vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces(dict, DicomGroupingTags[tag]);
+      }
+    }
+  return ITK_THREAD_RETURN_VALUE;
+}
+#endif
+
 //----------------------------------------------------------------------------
 void vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeaders()
 {
@@ -1225,20 +1285,35 @@ void vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeaders()
     }
 
   // if Archetype is a Dicom File
-  gdcmIO->SetFileName( this->Archetype );
+  // Parse all headers in parallel, each worker with its own reader, then
+  // assign the grouping indices serially in file order below so the
+  // resulting indices are identical to those of a serial scan.
+  // The workers use GetMetaDataWithoutSpaces to remove extra spaces from
+  // the DICOM tags, because extra spaces were found in some DICOM file
+  // before/after the multi-value separator backslashes.
+  std::vector<std::string> tagValues( nFiles * NumberOfDicomGroupingTags );
+  if ( nFiles > 0 )
+  {
+    DicomHeaderScan scan;
+    scan.FileNames = &this->AllFileNames;
+    scan.TagValues = &tagValues;
+    itk::MultiThreader::Pointer threader = itk::MultiThreader::New();
+    if ( nFiles < threader->GetNumberOfThreads() )
+    {
+      threader->SetNumberOfThreads( nFiles );
+    }
+    threader->SetSingleMethod( vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeadersThreaderCallback,
+                               &scan );
+    threader->SingleMethodExecute();
+  }
+
   for (int f = 0; f < nFiles; f++)
   {
-    gdcmIO->SetFileName( this->AllFileNames[f] );
-    gdcmIO->ReadImageInformation();
-    itk::MetaDataDictionary &dict = gdcmIO->GetMetaDataDictionary();
+    const std::string* values = &tagValues[f*NumberOfDicomGroupingTags];
     std::string tagValue;
 
-    // Use vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces to remove extra spaces
-    // from the DICOM tag, because extra spaces were found in some DICOM file before/after the
-    // multi-value separator backslashes.
-
     // series instance UID
-    tagValue = vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces(dict, "0020|000e");
+    tagValue = values[0];
     if (!tagValue.empty())
     {
       int idx = InsertSeriesInstanceUIDs( tagValue.c_str() );
@@ -1250,7 +1325,7 @@ void vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeaders()
     }
 
     // content time
-    tagValue = vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces(dict, "0008|0033");
+    tagValue = values[1];
     if (!tagValue.empty())
     {
       int idx = InsertContentTime( tagValue.c_str() );
@@ -1262,7 +1337,7 @@ void vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeaders()
     }
 
     // trigger time
-    tagValue = vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces(dict, "0018|1060");
+    tagValue = values[2];
     if (!tagValue.empty())
     {
       int idx = InsertTriggerTime( tagValue.c_str() );
@@ -1274,7 +1349,7 @@ void vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeaders()
     }
 
     // echo numbers
-    tagValue = vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces(dict, "0018|0086");
+    tagValue = values[3];
     if (!tagValue.empty())
     {
       int idx = InsertEchoNumbers( tagValue.c_str() );
@@ -1286,7 +1361,7 @@ void vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeaders()
     }
 
     // diffision gradient orientation
-    tagValue = vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces(dict, "0010|9089");
+    tagValue = values[4];
     if (!tagValue.empty())
     {
       float a[3] = { -1 };
@@ -1300,7 +1375,7 @@ void vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeaders()
     }
 
     // slice location
-    tagValue = vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces(dict, "0020|1041");
+    tagValue = values[5];
     if (!tagValue.empty())
     {
       float a = -1;
@@ -1314,7 +1389,7 @@ void vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeaders()
     }
 
     // image orientation patient
-    tagValue = vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces(dict, "0020|0037");
+    tagValue = values[6];
     if (!tagValue.empty())
     {
       float a[6] = { -1 };
@@ -1327,7 +1402,7 @@ void vtkITKArchetypeImageSeriesReader::AnalyzeDicomHeaders()
       this->IndexImageOrientationPatient[f] = -1;
     }
     // image position patient
-    tagValue = vtkITKArchetypeImageSeriesReader::GetMetaDataWithoutSpaces(dict, "0020|0032");
+    tagValue = values[7];
     if (!tagValue.empty())
     {
       float a[3] = { -1 };
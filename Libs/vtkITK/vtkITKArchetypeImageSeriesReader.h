@@ -25,6 +25,7 @@ class vtkMatrix4x4;
 // ITK includes
 #include "itkImageIOBase.h"
 #include "itkMetaDataDictionary.h"
+#include "itkMultiThreader.h"
 #include "itkSpatialOrientation.h"
 
 // STD includes
@@ -214,6 +215,18 @@ public:
     UseNativeOrigin = false;
     }
 
+  ///
+  /// Map the pixel data of compatible files directly into memory instead
+  /// of reading it through ITK buffers. The fast path is only taken for a
+  /// single uncompressed little-endian NRRD or NIfTI file read with native
+  /// orientation and scalar type; in all other cases the regular ITK
+  /// reading path is used. The file pages are mapped privately
+  /// (copy-on-write), so in-memory edits of the volume do not modify the
+  /// file. Off by default.
+  vtkSetMacro(UseMemoryMapIO, int);
+  vtkGetMacro(UseMemoryMapIO, int);
+  vtkBooleanMacro(UseMemoryMapIO, int);
+
   ///
   /// Reader to use when reading as a scalar image data
   enum
@@ -806,6 +819,10 @@ protected:
   /// Get MetaData from dictionary, removing all whitespaces from the string.
   static std::string GetMetaDataWithoutSpaces(const itk::MetaDataDictionary &dict, const std::string& tag);
 
+  /// Worker method that parses the DICOM headers of an interleaved share of
+  /// the series files. Used by AnalyzeDicomHeaders to scan headers in parallel.
+  static ITK_THREAD_RETURN_TYPE AnalyzeDicomHeadersThreaderCallback(void* arg);
+
   char *Archetype;
   int SingleFile;
   int UseOrientationFromFile;
@@ -835,6 +852,7 @@ protected:
   char UseNativeCoordinateOrientation;
   char UseNativeScalarType;
   bool UseNativeOrigin;
+  int UseMemoryMapIO;
 
   int DICOMImageIOApproach;
 
@@ -16,6 +16,7 @@
 
 // VTK includes
 #include <vtkAOSDataArrayTemplate.h>
+#include <vtkCallbackCommand.h>
 #include <vtkCommand.h>
 #include <vtkDataArray.h>
 #include <vtkErrorCode.h>
@@ -24,9 +25,23 @@
 #include <vtkInformationVector.h>
 #include <vtkObjectFactory.h>
 #include <vtkPointData.h>
+#include <vtkSmartPointer.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkVersion.h>
 
+// STD includes
+#include <cctype>
+#include <cstring>
+#include <fstream>
+
+#if !defined(_WIN32)
+// POSIX includes for the memory-mapped reading fast path
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 // ITK includes
 #include <itkOrientImageFilter.h>
 #include <itkImageSeriesReader.h>
@@ -45,6 +60,128 @@ vtkAOSDataArrayTemplate<T>* DownCast(vtkAbstractArray* a)
   return vtkAOSDataArrayTemplate<T>::FastDownCast(a);
 }
 
+#if !defined(_WIN32)
+
+struct MemoryMappedPixelBuffer
+{
+  void* MapStart;
+  size_t MapLength;
+};
+
+//----------------------------------------------------------------------------
+// Release the file mapping backing a scalar array when the array is deleted.
+void UnmapPixelBufferCallback(vtkObject* vtkNotUsed(caller), unsigned long vtkNotUsed(eid),
+                              void* clientData, void* vtkNotUsed(callData))
+{
+  MemoryMappedPixelBuffer* buffer = static_cast<MemoryMappedPixelBuffer*>(clientData);
+  munmap(buffer->MapStart, buffer->MapLength);
+  delete buffer;
+}
+
+//----------------------------------------------------------------------------
+// Return the offset of the raw little-endian pixel block in an uncompressed
+// NRRD (attached data) or NIfTI-1 single file, or -1 if the file layout
+// cannot be mapped directly.
+long long GetRawPixelDataOffset(const std::string& filename, int scalarSize)
+{
+  std::ifstream file(filename.c_str(), std::ios::binary);
+  if (!file)
+    {
+    return -1;
+    }
+  char magic[4] = { 0, 0, 0, 0 };
+  file.read(magic, 4);
+  if (!file)
+    {
+    return -1;
+    }
+
+  if (strncmp(magic, "NRRD", 4) == 0)
+    {
+    // The text header ends at the first blank line; with an attached data
+    // file the raw pixel block follows immediately after it.
+    file.seekg(0);
+    std::string line;
+    bool encodingRaw = false;
+    bool endianLittle = false;
+    while (std::getline(file, line))
+      {
+      if (!line.empty() && line[line.size() - 1] == '\r')
+        {
+        line.resize(line.size() - 1);
+        }
+      if (line.empty())
+        {
+        if (!encodingRaw || (scalarSize > 1 && !endianLittle))
+          {
+          return -1;
+          }
+        return static_cast<long long>(file.tellg());
+        }
+      std::string lower = line;
+      for (size_t i = 0; i < lower.size(); ++i)
+        {
+        lower[i] = static_cast<char>(tolower(lower[i]));
+        }
+      if (lower.compare(0, 9, "encoding:") == 0)
+        {
+        encodingRaw = (lower.find("raw") != std::string::npos);
+        }
+      else if (lower.compare(0, 7, "endian:") == 0)
+        {
+        endianLittle = (lower.find("little") != std::string::npos);
+        }
+      else if (lower.compare(0, 10, "data file:") == 0
+        || lower.compare(0, 9, "datafile:") == 0
+        || lower.compare(0, 10, "byte skip:") == 0
+        || lower.compare(0, 9, "byteskip:") == 0
+        || lower.compare(0, 10, "line skip:") == 0
+        || lower.compare(0, 9, "lineskip:") == 0)
+        {
+        // Detached data files and skipped bytes/lines are not handled here
+        return -1;
+        }
+      }
+    return -1;
+    }
+
+  // NIfTI-1 single file: sizeof_hdr must equal 348 when read as
+  // little-endian (this also rejects big-endian files) and the magic at
+  // byte 344 must be "n+1" (data attached to the header).
+  file.seekg(0);
+  char header[348];
+  file.read(header, 348);
+  if (!file)
+    {
+    return -1;
+    }
+  int sizeofHdr = 0;
+  memcpy(&sizeofHdr, header, sizeof(int));
+  if (sizeofHdr != 348 || strncmp(header + 344, "n+1", 3) != 0)
+    {
+    return -1;
+    }
+  // ITK rescales voxel values when scl_slope/scl_inter describe a
+  // non-identity transform; such files must go through the regular path.
+  float voxOffset = 0.0f;
+  float sclSlope = 0.0f;
+  float sclInter = 0.0f;
+  memcpy(&voxOffset, header + 108, sizeof(float));
+  memcpy(&sclSlope, header + 112, sizeof(float));
+  memcpy(&sclInter, header + 116, sizeof(float));
+  if (sclInter != 0.0f || (sclSlope != 0.0f && sclSlope != 1.0f))
+    {
+    return -1;
+    }
+  if (voxOffset < 348.0f)
+    {
+    return -1;
+    }
+  return static_cast<long long>(voxOffset);
+}
+
+#endif // !defined(_WIN32)
+
 };
 
 //----------------------------------------------------------------------------
@@ -92,6 +229,13 @@ int vtkITKArchetypeImageSeriesScalarReader::RequestData(
     vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()));
   this->SetMetaDataScalarRangeToPointDataInfo(data);
 
+  // Fast path: map the raw pixel block of a compatible file directly into
+  // the scalar array instead of reading and copying it through ITK buffers.
+  if (this->UseMemoryMapIO && this->MapRawPixelData(data))
+    {
+    return 1;
+    }
+
 #ifdef VTKITK_BUILD_DICOM_SUPPORT
 #define vtkITKExecuteDataDeclareDICOMImageIO \
       typedef itk::ImageIOBase ImageIOType; \
@@ -268,6 +412,85 @@ int vtkITKArchetypeImageSeriesScalarReader::RequestData(
   return 1;
 }
 
+//----------------------------------------------------------------------------
+bool vtkITKArchetypeImageSeriesScalarReader::MapRawPixelData(vtkImageData* data)
+{
+#if defined(_WIN32) || defined(VTK_WORDS_BIGENDIAN)
+  // Only POSIX little-endian hosts can map the file contents directly
+  (void)data;
+  return false;
+#else
+  if (this->FileNames.size() != 1
+    || this->GetNumberOfComponents() != 1
+    || this->ArchetypeIsDICOM
+    || !this->UseNativeCoordinateOrientation
+    || !this->UseNativeScalarType)
+    {
+    return false;
+    }
+  vtkDataArray* scalars = data->GetPointData()->GetScalars();
+  if (scalars == NULL)
+    {
+    return false;
+    }
+  int extent[6];
+  data->GetExtent(extent);
+  vtkIdType numberOfValues = static_cast<vtkIdType>(extent[1] - extent[0] + 1)
+    * (extent[3] - extent[2] + 1) * (extent[5] - extent[4] + 1);
+  int scalarSize = scalars->GetDataTypeSize();
+  if (numberOfValues <= 0 || scalarSize <= 0)
+    {
+    return false;
+    }
+
+  long long dataOffset = GetRawPixelDataOffset(this->FileNames[0], scalarSize);
+  if (dataOffset < 0 || dataOffset % scalarSize != 0)
+    {
+    // unknown layout, or the pixel block would be misaligned for the type
+    return false;
+    }
+
+  int fd = open(this->FileNames[0].c_str(), O_RDONLY);
+  if (fd < 0)
+    {
+    return false;
+    }
+  struct stat fileInfo;
+  long long expectedBytes = static_cast<long long>(numberOfValues) * scalarSize;
+  if (fstat(fd, &fileInfo) != 0
+    || static_cast<long long>(fileInfo.st_size) < dataOffset + expectedBytes)
+    {
+    close(fd);
+    return false;
+    }
+
+  // Map privately (copy-on-write) so that in-memory edits of the volume are
+  // never written back to the file.
+  size_t mapLength = static_cast<size_t>(dataOffset + expectedBytes);
+  void* mapStart = mmap(NULL, mapLength, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd); // the mapping keeps its own reference to the file
+  if (mapStart == MAP_FAILED)
+    {
+    return false;
+    }
+
+  vtkDebugMacro("MapRawPixelData: mapped " << expectedBytes << " bytes of "
+    << this->FileNames[0].c_str() << " at offset " << dataOffset);
+
+  MemoryMappedPixelBuffer* buffer = new MemoryMappedPixelBuffer;
+  buffer->MapStart = mapStart;
+  buffer->MapLength = mapLength;
+
+  // The array does not own the memory (save=1); the mapping is released by
+  // the observer when the array is deleted.
+  scalars->SetVoidArray(static_cast<char*>(mapStart) + dataOffset, numberOfValues, 1);
+  vtkSmartPointer<vtkCallbackCommand> unmapCallback = vtkSmartPointer<vtkCallbackCommand>::New();
+  unmapCallback->SetClientData(buffer);
+  unmapCallback->SetCallback(UnmapPixelBufferCallback);
+  scalars->AddObserver(vtkCommand::DeleteEvent, unmapCallback);
+  return true;
+#endif
+}
 
 void vtkITKArchetypeImageSeriesScalarReader::ReadProgressCallback(itk::ProcessObject* obj,const itk::ProgressEvent&,void* data)
 {
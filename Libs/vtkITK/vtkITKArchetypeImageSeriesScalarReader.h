@@ -33,6 +33,15 @@ class VTK_ITK_EXPORT vtkITKArchetypeImageSeriesScalarReader : public vtkITKArche
 
   int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) VTK_OVERRIDE;
   static void ReadProgressCallback(itk::ProcessObject* obj,const itk::ProgressEvent&, void* data);
+
+  /// Try to map the raw pixel data of the (single) file directly into the
+  /// scalar array of \a data instead of reading it through ITK. Only
+  /// uncompressed little-endian NRRD and NIfTI layouts matching the output
+  /// scalar type are accepted. Returns false if the file layout is not
+  /// compatible or memory mapping is not available, in which case the
+  /// regular reading path must be used.
+  /// \sa vtkITKArchetypeImageSeriesReader::SetUseMemoryMapIO()
+  bool MapRawPixelData(vtkImageData* data);
   /// private:
 };
 
@@ -21,6 +21,8 @@
 
 #include "itkSignedMaurerDistanceMapImageFilter.h"
 
+#include <vector>
+
 vtkStandardNewMacro(vtkITKDistanceTransform);
 
 vtkITKDistanceTransform::vtkITKDistanceTransform()
@@ -29,6 +31,8 @@ vtkITKDistanceTransform::vtkITKDistanceTransform()
   this->InsideIsPositive = 0;
   this->UseImageSpacing = 0;
   this->BackgroundValue = 0;
+  this->ComputeInLabelBoundingBox = 0;
+  this->BoundingBoxPadding = 0;
 }
 
 vtkITKDistanceTransform::~vtkITKDistanceTransform()
@@ -47,18 +51,113 @@ void vtkITKDistanceTransformExecute(vtkITKDistanceTransform *self, vtkImageData*
   double spacing[3];
   input->GetSpacing(spacing);
 
+  T backgroundValue = static_cast<T>(self->GetBackgroundValue());
+
+  // Optionally restrict the computation to the padded bounding box of the
+  // non-background voxels. The Maurer filter is O(volume) per sweep, so
+  // operating on the box alone makes small labels in large volumes cheap.
+  int boxMin[3] = {0, 0, 0};
+  int boxMax[3] = {dims[0]-1, dims[1]-1, dims[2]-1};
+  bool emptyLabel = false;
+  if (self->GetComputeInLabelBoundingBox())
+    {
+    boxMin[0] = dims[0]; boxMin[1] = dims[1]; boxMin[2] = dims[2];
+    boxMax[0] = boxMax[1] = boxMax[2] = -1;
+    T* scanPtr = inPtr;
+    for (int k = 0; k < dims[2]; k++)
+      {
+      for (int j = 0; j < dims[1]; j++)
+        {
+        for (int i = 0; i < dims[0]; i++, scanPtr++)
+          {
+          if (*scanPtr != backgroundValue)
+            {
+            if (i < boxMin[0]) { boxMin[0] = i; }
+            if (i > boxMax[0]) { boxMax[0] = i; }
+            if (j < boxMin[1]) { boxMin[1] = j; }
+            if (j > boxMax[1]) { boxMax[1] = j; }
+            if (k < boxMin[2]) { boxMin[2] = k; }
+            if (k > boxMax[2]) { boxMax[2] = k; }
+            }
+          }
+        }
+      }
+    emptyLabel = (boxMax[0] < boxMin[0]);
+    int padding = self->GetBoundingBoxPadding();
+    for (int axis = 0; axis < 3; axis++)
+      {
+      boxMin[axis] -= padding;
+      boxMax[axis] += padding;
+      if (boxMin[axis] < 0) { boxMin[axis] = 0; }
+      if (boxMax[axis] > dims[axis]-1) { boxMax[axis] = dims[axis]-1; }
+      }
+    }
+
+  bool fullExtent = (boxMin[0] == 0 && boxMax[0] == dims[0]-1 &&
+                     boxMin[1] == 0 && boxMax[1] == dims[1]-1 &&
+                     boxMin[2] == 0 && boxMax[2] == dims[2]-1);
+
+  // Voxels outside the padded box are at least the padding away from the
+  // label, fill them with the corresponding distance on the background side.
+  double capDistance = self->GetBoundingBoxPadding();
+  if (self->GetUseImageSpacing())
+    {
+    double minSpacing = spacing[0];
+    minSpacing = spacing[1] < minSpacing ? spacing[1] : minSpacing;
+    minSpacing = spacing[2] < minSpacing ? spacing[2] : minSpacing;
+    capDistance *= minSpacing;
+    }
+  if (self->GetSquaredDistance())
+    {
+    capDistance *= capDistance;
+    }
+  T fillValue = static_cast<T>(self->GetInsideIsPositive() ? -capDistance : capDistance);
+
+  if (emptyLabel)
+    {
+    // No foreground voxels, everything is background
+    vtkIdType numberOfVoxels = static_cast<vtkIdType>(dims[0])*dims[1]*dims[2];
+    for (vtkIdType voxel = 0; voxel < numberOfVoxels; voxel++)
+      {
+      outPtr[voxel] = fillValue;
+      }
+    return;
+    }
+
+  int subDims[3] = {boxMax[0]-boxMin[0]+1, boxMax[1]-boxMin[1]+1, boxMax[2]-boxMin[2]+1};
+
+  // Pack the subregion into a contiguous buffer (the full buffer is used
+  // directly when the box covers the whole volume)
+  std::vector<T> subBuffer;
+  T* distInPtr = inPtr;
+  if (!fullExtent)
+    {
+    subBuffer.resize(static_cast<size_t>(subDims[0])*subDims[1]*subDims[2]);
+    T* subPtr = &subBuffer[0];
+    for (int k = boxMin[2]; k <= boxMax[2]; k++)
+      {
+      for (int j = boxMin[1]; j <= boxMax[1]; j++)
+        {
+        T* rowPtr = inPtr + (static_cast<vtkIdType>(k)*dims[1] + j)*dims[0] + boxMin[0];
+        memcpy(subPtr, rowPtr, subDims[0]*sizeof(T));
+        subPtr += subDims[0];
+        }
+      }
+    distInPtr = &subBuffer[0];
+    }
+
   // Wrap scalars into an ITK image
   // - mostly rely on defaults for spacing, origin etc for this filter
   typedef itk::Image<T, 3> ImageType;
   typename ImageType::Pointer inImage = ImageType::New();
-  inImage->GetPixelContainer()->SetImportPointer(inPtr, dims[0]*dims[1]*dims[2], false);
+  inImage->GetPixelContainer()->SetImportPointer(distInPtr, subDims[0]*subDims[1]*subDims[2], false);
   typename ImageType::RegionType region;
   typename ImageType::IndexType index;
   typename ImageType::SizeType size;
   index[0] = index[1] = index[2] = 0;
-  size[0] = dims[0];
-  size[1] = dims[1];
-  size[2] = dims[2];
+  size[0] = subDims[0];
+  size[1] = subDims[1];
+  size[2] = subDims[2];
   region.SetIndex(index);
   region.SetSize(size);
   inImage->SetLargestPossibleRegion(region);
@@ -67,11 +166,12 @@ void vtkITKDistanceTransformExecute(vtkITKDistanceTransform *self, vtkImageData*
 
 
   // Calculate the distance transform
+  // (the Maurer filter parallelizes its per-scanline sweeps internally)
   typedef itk::Image<T,3> DistanceImageType;
   typedef itk::SignedMaurerDistanceMapImageFilter<ImageType, DistanceImageType> DistanceType;
   typename DistanceType::Pointer dist = DistanceType::New();
 
-  dist->SetBackgroundValue(static_cast<T>(self->GetBackgroundValue()));
+  dist->SetBackgroundValue(backgroundValue);
   dist->SetUseImageSpacing(self->GetUseImageSpacing());
   dist->SetInsideIsPositive(self->GetInsideIsPositive());
   dist->SetSquaredDistance(self->GetSquaredDistance());
@@ -80,8 +180,29 @@ void vtkITKDistanceTransformExecute(vtkITKDistanceTransform *self, vtkImageData*
   dist->Update();
 
   // Copy to the output
-  memcpy(outPtr, dist->GetOutput()->GetBufferPointer(),
-         dist->GetOutput()->GetBufferedRegion().GetNumberOfPixels() * sizeof(T));
+  if (fullExtent)
+    {
+    memcpy(outPtr, dist->GetOutput()->GetBufferPointer(),
+           dist->GetOutput()->GetBufferedRegion().GetNumberOfPixels() * sizeof(T));
+    }
+  else
+    {
+    vtkIdType numberOfVoxels = static_cast<vtkIdType>(dims[0])*dims[1]*dims[2];
+    for (vtkIdType voxel = 0; voxel < numberOfVoxels; voxel++)
+      {
+      outPtr[voxel] = fillValue;
+      }
+    T* subPtr = dist->GetOutput()->GetBufferPointer();
+    for (int k = boxMin[2]; k <= boxMax[2]; k++)
+      {
+      for (int j = boxMin[1]; j <= boxMax[1]; j++)
+        {
+        T* rowPtr = outPtr + (static_cast<vtkIdType>(k)*dims[1] + j)*dims[0] + boxMin[0];
+        memcpy(rowPtr, subPtr, subDims[0]*sizeof(T));
+        subPtr += subDims[0];
+        }
+      }
+    }
 
 }
 
@@ -153,6 +274,8 @@ void vtkITKDistanceTransform::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "InsideIsPositive: " << InsideIsPositive << std::endl;
   os << indent << "UseImageSpacing: " << UseImageSpacing << std::endl;
   os << indent << "SquaredDistance: " << SquaredDistance << std::endl;
+  os << indent << "ComputeInLabelBoundingBox: " << ComputeInLabelBoundingBox << std::endl;
+  os << indent << "BoundingBoxPadding: " << BoundingBoxPadding << std::endl;
 }
 
 
@@ -37,6 +37,23 @@ public:
   vtkGetMacro(BackgroundValue, double);
   vtkSetMacro(BackgroundValue, double);
 
+  /// Restrict the computation to the bounding box of the non-background
+  /// voxels, dilated by BoundingBoxPadding voxels along each axis.
+  /// Voxels outside the padded box are set to the distance corresponding
+  /// to the padding (with the sign of the background side), so results
+  /// are only accurate up to the padding distance. This makes the filter
+  /// substantially faster when the label occupies a small part of a
+  /// large volume, e.g. for margin-growing operations. Off by default.
+  vtkGetMacro(ComputeInLabelBoundingBox, int);
+  vtkSetMacro(ComputeInLabelBoundingBox, int);
+  vtkBooleanMacro(ComputeInLabelBoundingBox, int);
+
+  /// Number of voxels the label bounding box is dilated by along each
+  /// axis before computing the distance transform. Only used if
+  /// ComputeInLabelBoundingBox is on.
+  vtkGetMacro(BoundingBoxPadding, int);
+  vtkSetMacro(BoundingBoxPadding, int);
+
 
 protected:
   vtkITKDistanceTransform();
@@ -48,6 +65,8 @@ protected:
   int InsideIsPositive;
   int UseImageSpacing;
   double BackgroundValue;
+  int ComputeInLabelBoundingBox;
+  int BoundingBoxPadding;
 
 private:
   vtkITKDistanceTransform(const vtkITKDistanceTransform&);  /// Not implemented.
@@ -36,11 +36,231 @@
 #include <itkMetaDataDictionary.h>
 #include <itkMetaDataObject.h>
 #include <itkMetaDataObjectBase.h>
+#include <itkMultiThreader.h>
+#include <itkMutexLock.h>
 #include <itkVTKImageImport.h>
+#include <itk_zlib.h>
+
+// STD includes
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
 
 
 vtkStandardNewMacro(vtkITKImageWriter);
 
+namespace
+{
+
+// Pixel bytes compressed per block by the parallel compression engine
+const size_t ParallelCompressionChunkSize = 32 * 1024 * 1024;
+
+//----------------------------------------------------------------------------
+struct CompressChunksJob
+{
+  const unsigned char* Data;
+  size_t TotalBytes;
+  size_t NextChunkIndex;
+  std::vector<std::vector<unsigned char> > CompressedChunks;
+  std::vector<int> ChunkStatus;
+  itk::MutexLock::Pointer Lock;
+};
+
+//----------------------------------------------------------------------------
+// Worker threads take block indices from the shared job and compress each
+// block as an independent gzip member. The members are later written out
+// back to back; gzip decoders read concatenated members as a single stream,
+// so the resulting file stays a standard gzip-encoded NRRD.
+ITK_THREAD_RETURN_TYPE CompressChunksThreaderCallback(void* arg)
+{
+  itk::MultiThreader::ThreadInfoStruct* info =
+    static_cast<itk::MultiThreader::ThreadInfoStruct*>(arg);
+  CompressChunksJob* job = static_cast<CompressChunksJob*>(info->UserData);
+  size_t numberOfChunks = job->CompressedChunks.size();
+  while (true)
+    {
+    job->Lock->Lock();
+    size_t chunkIndex = job->NextChunkIndex++;
+    job->Lock->Unlock();
+    if (chunkIndex >= numberOfChunks)
+      {
+      break;
+      }
+    size_t offset = chunkIndex * ParallelCompressionChunkSize;
+    size_t length = std::min(ParallelCompressionChunkSize, job->TotalBytes - offset);
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+    // windowBits 15+16 selects a gzip wrapper instead of a zlib one
+    if (deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK)
+      {
+      continue;
+      }
+    std::vector<unsigned char>& outputBuffer = job->CompressedChunks[chunkIndex];
+    outputBuffer.resize(deflateBound(&strm, static_cast<uLong>(length)));
+    strm.next_in = const_cast<unsigned char*>(job->Data + offset);
+    strm.avail_in = static_cast<uInt>(length);
+    strm.next_out = &outputBuffer[0];
+    strm.avail_out = static_cast<uInt>(outputBuffer.size());
+    if (deflate(&strm, Z_FINISH) == Z_STREAM_END)
+      {
+      outputBuffer.resize(strm.total_out);
+      job->ChunkStatus[chunkIndex] = 1;
+      }
+    deflateEnd(&strm);
+    }
+  return ITK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+// NRRD type name for a VTK scalar type, NULL when not representable
+const char* GetNrrdTypeString(int vtkScalarType)
+{
+  switch (vtkScalarType)
+    {
+    case VTK_CHAR: return "int8";
+    case VTK_SIGNED_CHAR: return "int8";
+    case VTK_UNSIGNED_CHAR: return "uint8";
+    case VTK_SHORT: return "int16";
+    case VTK_UNSIGNED_SHORT: return "uint16";
+    case VTK_INT: return "int32";
+    case VTK_UNSIGNED_INT: return "uint32";
+    case VTK_FLOAT: return "float";
+    case VTK_DOUBLE: return "double";
+    default: return NULL;
+    }
+}
+
+//----------------------------------------------------------------------------
+// Write a scalar 3D volume as a gzip-encoded NRRD, compressing the pixel
+// blocks on all cores. Returns false (without touching the output file)
+// when the volume or file name is not handled, so that the caller can fall
+// back to the regular ITK writer.
+bool ITKWriteParallelCompressedNrrd(vtkITKImageWriter* self, vtkImageData* inputImage)
+{
+#ifdef VTK_WORDS_BIGENDIAN
+  // the header below advertises little-endian pixel data
+  (void)self;
+  (void)inputImage;
+  return false;
+#else
+  std::string fileExtension = vtksys::SystemTools::LowerCase(
+    vtksys::SystemTools::GetFilenameLastExtension(self->GetFileName()));
+  if (fileExtension != ".nrrd")
+    {
+    return false;
+    }
+  vtkDataArray* scalars = inputImage->GetPointData()->GetScalars();
+  if (scalars == NULL || scalars->GetNumberOfComponents() != 1)
+    {
+    return false;
+    }
+  const char* typeString = GetNrrdTypeString(scalars->GetDataType());
+  if (typeString == NULL || self->GetRasToIJKMatrix() == NULL)
+    {
+    return false;
+    }
+  int dimensions[3] = { 0, 0, 0 };
+  inputImage->GetDimensions(dimensions);
+  size_t totalBytes = static_cast<size_t>(scalars->GetNumberOfTuples())
+    * scalars->GetDataTypeSize();
+  if (totalBytes == 0)
+    {
+    return false;
+    }
+
+  // Space directions and origin: same RAS to LPS conversion as the ITK
+  // writing path (invert, transpose, flip the first two coordinates)
+  vtkNew<vtkMatrix4x4> ijkToRasMatrix;
+  vtkMatrix4x4::Invert(self->GetRasToIJKMatrix(), ijkToRasMatrix.GetPointer());
+  ijkToRasMatrix->Transpose();
+  double axes[3][3];
+  double origin[3];
+  for (int axis = 0; axis < 3; axis++)
+    {
+    for (int component = 0; component < 3; component++)
+      {
+      double lpsSign = (component < 2) ? -1. : 1.;
+      axes[axis][component] = lpsSign * ijkToRasMatrix->GetElement(axis, component);
+      }
+    origin[axis] = ((axis < 2) ? -1. : 1.) * ijkToRasMatrix->GetElement(3, axis);
+    }
+
+  // Compress the pixel blocks concurrently before opening the output file,
+  // so that a failure leaves any existing file untouched
+  CompressChunksJob job;
+  job.Data = static_cast<const unsigned char*>(scalars->GetVoidPointer(0));
+  job.TotalBytes = totalBytes;
+  job.NextChunkIndex = 0;
+  size_t numberOfChunks =
+    (totalBytes + ParallelCompressionChunkSize - 1) / ParallelCompressionChunkSize;
+  job.CompressedChunks.resize(numberOfChunks);
+  job.ChunkStatus.resize(numberOfChunks, 0);
+  job.Lock = itk::MutexLock::New();
+
+  itk::MultiThreader::Pointer threader = itk::MultiThreader::New();
+  int numberOfThreads = std::min(threader->GetNumberOfThreads(),
+    static_cast<int>(numberOfChunks));
+  threader->SetNumberOfThreads(numberOfThreads);
+  threader->SetSingleMethod(CompressChunksThreaderCallback, &job);
+  threader->SingleMethodExecute();
+
+  for (size_t chunkIndex = 0; chunkIndex < numberOfChunks; chunkIndex++)
+    {
+    if (!job.ChunkStatus[chunkIndex])
+      {
+      return false;
+      }
+    }
+
+  std::ostringstream header;
+  header << std::setprecision(17);
+  header << "NRRD0004\n";
+  header << "# Complete NRRD file format specification at:\n";
+  header << "# http://teem.sourceforge.net/nrrd/format.html\n";
+  header << "type: " << typeString << "\n";
+  header << "dimension: 3\n";
+  header << "space: left-posterior-superior\n";
+  header << "sizes: " << dimensions[0] << " " << dimensions[1] << " "
+         << dimensions[2] << "\n";
+  header << "space directions: "
+         << "(" << axes[0][0] << "," << axes[0][1] << "," << axes[0][2] << ") "
+         << "(" << axes[1][0] << "," << axes[1][1] << "," << axes[1][2] << ") "
+         << "(" << axes[2][0] << "," << axes[2][1] << "," << axes[2][2] << ")\n";
+  header << "kinds: domain domain domain\n";
+  if (scalars->GetDataTypeSize() > 1)
+    {
+    header << "endian: little\n";
+    }
+  header << "encoding: gzip\n";
+  header << "space origin: "
+         << "(" << origin[0] << "," << origin[1] << "," << origin[2] << ")\n";
+  header << "\n";
+
+  std::ofstream outputFile(self->GetFileName(),
+    std::ios::binary | std::ios::trunc);
+  if (!outputFile)
+    {
+    return false;
+    }
+  std::string headerString = header.str();
+  outputFile.write(headerString.c_str(), headerString.size());
+  for (size_t chunkIndex = 0; chunkIndex < numberOfChunks; chunkIndex++)
+    {
+    outputFile.write(
+      reinterpret_cast<const char*>(&job.CompressedChunks[chunkIndex][0]),
+      job.CompressedChunks[chunkIndex].size());
+    }
+  outputFile.close();
+  return outputFile.good();
+#endif
+}
+
+}; // end anonymous namespace
+
 // helper function
 template <class  TPixelType, int Dimension>
 void ITKWriteVTKImage(vtkITKImageWriter *self, vtkImageData *inputImage, char *fileName,
@@ -146,6 +366,13 @@ void ITKWriteVTKImage(vtkITKImageWriter *self, vtkImageData *inputImage, char *f
     itkImageWriter->UseCompressionOff();
     }
 
+  // Push the volume to disk slab by slab when more than one stream division
+  // is requested. The conversion happens only once (the importer keeps the
+  // whole buffer), but ImageIOs that can stream then write from it in
+  // pieces instead of staging the full volume; ImageIOs that cannot stream
+  // - and compressed writes - silently fall back to a single piece.
+  itkImageWriter->SetNumberOfStreamDivisions( self->GetNumberOfStreamDivisions() );
+
 
   // set pipeline for the image
   vtkFlip->SetInputData( inputImage );
@@ -245,6 +472,8 @@ vtkITKImageWriter::vtkITKImageWriter()
   this->RasToIJKMatrix = NULL;
   this->MeasurementFrameMatrix = NULL;
   this->UseCompression = 0;
+  this->UseParallelCompression = 0;
+  this->NumberOfStreamDivisions = 1;
   this->ImageIOClassName = NULL;
 }
 
@@ -274,6 +503,7 @@ void vtkITKImageWriter::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "FileName: " <<
     (this->FileName ? this->FileName : "(none)") << "\n";
+  os << indent << "NumberOfStreamDivisions: " << this->NumberOfStreamDivisions << "\n";
   os << indent << "ImageIOClassName: " <<
     (this->ImageIOClassName ? this->ImageIOClassName : "(none)") << "\n";
 }
@@ -328,6 +558,16 @@ void vtkITKImageWriter::Write()
       this->GetOutputInformation(0)->Get(
         vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()), 6);
     }
+  if (this->UseCompression && this->UseParallelCompression)
+    {
+    if (ITKWriteParallelCompressedNrrd(this, inputImage))
+      {
+      return;
+      }
+    // volume or file name not handled by the parallel engine:
+    // fall through to the single-threaded ITK writer
+    }
+
   int inputDataType =
     pointData->GetScalars() ? pointData->GetScalars()->GetDataType() :
     pointData->GetTensors() ? pointData->GetTensors()->GetDataType() :
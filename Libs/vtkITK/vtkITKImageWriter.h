@@ -48,6 +48,28 @@ public:
   vtkSetMacro (UseCompression, int);
   vtkBooleanMacro(UseCompression, int);
 
+  ///
+  /// Compress the pixel data in parallel when saving scalar volumes as
+  /// compressed NRRD: the buffer is split into blocks that are gzip
+  /// compressed concurrently and written out as concatenated gzip members,
+  /// which standard gzip decoders read as a single stream. Only used when
+  /// UseCompression is on; formats and pixel types that this fast path
+  /// cannot handle fall back to the regular single-threaded ITK writer.
+  /// Disabled by default.
+  vtkGetMacro (UseParallelCompression, int);
+  vtkSetMacro (UseParallelCompression, int);
+  vtkBooleanMacro(UseParallelCompression, int);
+
+  ///
+  /// Split the volume into this many slabs and push them to disk one by
+  /// one through the ITK ImageIO streaming interface, which bounds the
+  /// memory the writer needs on top of the input volume. Formats whose
+  /// ImageIO cannot stream - and any format when compression is enabled -
+  /// are automatically written in one piece as before, so all supported
+  /// formats keep working. Default is 1 (no streaming).
+  vtkGetMacro (NumberOfStreamDivisions, int);
+  vtkSetClampMacro (NumberOfStreamDivisions, int, 1, VTK_INT_MAX);
+
   ///
   /// Set/Get the ImageIO class name.
   vtkGetStringMacro (ImageIOClassName);
@@ -62,6 +84,10 @@ public:
     RasToIJKMatrix = mat;
   }
 
+  vtkMatrix4x4* GetRasToIJKMatrix() {
+    return RasToIJKMatrix;
+  }
+
   /// Set orienation matrix
   void SetMeasurementFrameMatrix( vtkMatrix4x4* mat) {
     MeasurementFrameMatrix = mat;
@@ -75,6 +101,8 @@ protected:
   vtkMatrix4x4* RasToIJKMatrix;
   vtkMatrix4x4* MeasurementFrameMatrix;
   int UseCompression;
+  int UseParallelCompression;
+  int NumberOfStreamDivisions;
   char* ImageIOClassName;
 
 private:
@@ -21,9 +21,11 @@
 #include "vtkAlgorithm.h"
 #include <vtkVersion.h>
 
-#include "itkConnectedComponentImageFilter.h"
-#include "itkRelabelComponentImageFilter.h"
-#include "itkCommand.h"
+#include "itkNumericTraits.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 vtkStandardNewMacro(vtkITKIslandMath);
 
@@ -54,18 +56,17 @@ void vtkITKIslandMath::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "OriginalNumberOfIslands: " << OriginalNumberOfIslands << std::endl;
 }
 
-// Note: local function not method - conforms to signature in itkCommand.h
-void vtkITKIslandMathHandleProgressEvent (itk::Object *caller,
-                                          const itk::EventObject& vtkNotUsed(eventObject),
-                                          void *clientdata)
+// Find the equivalence class root of a provisional label, compressing the
+// path as a side effect
+static size_t vtkITKIslandMathFindRoot(std::vector<size_t>& parent, size_t label)
 {
-  itk::ProcessObject *itkFilter = dynamic_cast<itk::ProcessObject*>(caller);
-  vtkAlgorithm *vtkFilter = reinterpret_cast<vtkAlgorithm*>(clientdata);
-  if ( itkFilter && vtkFilter )
+  while (parent[label] != label)
     {
-    vtkFilter->UpdateProgress ( itkFilter->GetProgress() );
+    parent[label] = parent[parent[label]];
+    label = parent[label];
     }
-};
+  return label;
+}
 
 template <class T>
 void vtkITKIslandMathExecute(vtkITKIslandMath *self, vtkImageData* input,
@@ -75,55 +76,177 @@ void vtkITKIslandMathExecute(vtkITKIslandMath *self, vtkImageData* input,
 
   int dims[3];
   input->GetDimensions(dims);
-  double spacing[3];
-  input->GetSpacing(spacing);
-
-  // Wrap scalars into an ITK image
-  // - mostly rely on defaults for spacing, origin etc for this filter
-  typedef itk::Image<T, 3> ImageType;
-  typename ImageType::Pointer inImage = ImageType::New();
-  typename ImageType::RegionType region;
-  typename ImageType::IndexType index;
-  typename ImageType::SizeType size;
-
-  inImage->GetPixelContainer()->SetImportPointer(inPtr, dims[0]*dims[1]*dims[2], false);
-  index[0] = index[1] = index[2] = 0;
-  region.SetIndex(index);
-  size[0] = dims[0]; size[1] = dims[1]; size[2] = dims[2];
-  region.SetSize(size);
-  inImage->SetLargestPossibleRegion(region);
-  inImage->SetBufferedRegion(region);
-  inImage->SetSpacing(spacing);
-
-  // set up the progress callback
-  itk::CStyleCommand::Pointer progressCommand = itk::CStyleCommand::New();
-  progressCommand->SetClientData( static_cast<void *>(self) );
-  progressCommand->SetCallback( vtkITKIslandMathHandleProgressEvent );
-
-
-  // Calculate the island operation
-  // ccfilter - identifies the islands
-  // relabel - sorts them by size
-  typedef itk::ConnectedComponentImageFilter<ImageType, ImageType> ConnectedComponentType;
-  typename ConnectedComponentType::Pointer ccfilter = ConnectedComponentType::New();
-  typedef itk::RelabelComponentImageFilter<ImageType, ImageType> RelabelComponentType;
-  typename RelabelComponentType::Pointer relabel = RelabelComponentType::New();
-
-  ccfilter->AddObserver(itk::ProgressEvent(), progressCommand);
-  relabel->AddObserver(itk::ProgressEvent(), progressCommand);
-
-  ccfilter->SetFullyConnected(self->GetFullyConnected());
-  ccfilter->SetInput( inImage );
-  relabel->SetInput( ccfilter->GetOutput() );
-  relabel->SetMinimumObjectSize( self->GetMinimumSize() );
-  relabel->Update();
-  self->SetNumberOfIslands(relabel->GetNumberOfObjects());
-  self->SetOriginalNumberOfIslands(relabel->GetOriginalNumberOfObjects());
-
-  // Copy to the output
-  memcpy(outPtr, relabel->GetOutput()->GetBufferPointer(),
-         relabel->GetOutput()->GetBufferedRegion().GetNumberOfPixels() * sizeof(T));
 
+  // Two-pass connected components with union-find. Provisional labels are
+  // written directly into the output buffer and only a compact equivalence
+  // table is kept on the side, so no intermediate label volumes are
+  // allocated (the former ITK ConnectedComponent+Relabel pipeline held two
+  // full-size copies, which exhausted memory on very large labelmaps).
+
+  // Offsets of the already-scanned neighbors of a voxel in raster order
+  int neighborOffsets[13][3];
+  int numberOfNeighbors = 0;
+  if (self->GetFullyConnected())
+    {
+    for (int dk = -1; dk <= 0; dk++)
+      {
+      for (int dj = -1; dj <= 1; dj++)
+        {
+        for (int di = -1; di <= 1; di++)
+          {
+          if (dk == 0 && (dj > 0 || (dj == 0 && di >= 0)))
+            {
+            continue;
+            }
+          neighborOffsets[numberOfNeighbors][0] = di;
+          neighborOffsets[numberOfNeighbors][1] = dj;
+          neighborOffsets[numberOfNeighbors][2] = dk;
+          numberOfNeighbors++;
+          }
+        }
+      }
+    }
+  else
+    {
+    static const int faceOffsets[3][3] = {{-1,0,0}, {0,-1,0}, {0,0,-1}};
+    for (int neighbor = 0; neighbor < 3; neighbor++)
+      {
+      neighborOffsets[neighbor][0] = faceOffsets[neighbor][0];
+      neighborOffsets[neighbor][1] = faceOffsets[neighbor][1];
+      neighborOffsets[neighbor][2] = faceOffsets[neighbor][2];
+      }
+    numberOfNeighbors = 3;
+    }
+
+  // Provisional labels share the output scalar type, as they did with the
+  // ITK connected components filter
+  size_t maxLabel = static_cast<size_t>(itk::NumericTraits<T>::max());
+
+  std::vector<size_t> parent;
+  parent.push_back(0); // label 0 is background
+
+  // First pass: assign provisional labels and record equivalences between
+  // labels that meet across scanlines
+  T* voxelPtr = inPtr;
+  vtkIdType voxelIndex = 0;
+  for (int k = 0; k < dims[2]; k++)
+    {
+    for (int j = 0; j < dims[1]; j++)
+      {
+      for (int i = 0; i < dims[0]; i++, voxelPtr++, voxelIndex++)
+        {
+        if (*voxelPtr == 0)
+          {
+          outPtr[voxelIndex] = 0;
+          continue;
+          }
+        size_t assignedRoot = 0;
+        for (int neighbor = 0; neighbor < numberOfNeighbors; neighbor++)
+          {
+          int ni = i + neighborOffsets[neighbor][0];
+          int nj = j + neighborOffsets[neighbor][1];
+          int nk = k + neighborOffsets[neighbor][2];
+          if (ni < 0 || ni >= dims[0] || nj < 0 || nj >= dims[1] || nk < 0)
+            {
+            continue;
+            }
+          size_t neighborLabel = static_cast<size_t>(
+            outPtr[(static_cast<vtkIdType>(nk)*dims[1] + nj)*dims[0] + ni]);
+          if (neighborLabel == 0)
+            {
+            continue;
+            }
+          size_t neighborRoot = vtkITKIslandMathFindRoot(parent, neighborLabel);
+          if (assignedRoot == 0)
+            {
+            assignedRoot = neighborRoot;
+            }
+          else if (neighborRoot != assignedRoot)
+            {
+            // Merge the equivalence classes, keeping the smaller root
+            if (neighborRoot < assignedRoot)
+              {
+              parent[assignedRoot] = neighborRoot;
+              assignedRoot = neighborRoot;
+              }
+            else
+              {
+              parent[neighborRoot] = assignedRoot;
+              }
+            }
+          }
+        if (assignedRoot == 0)
+          {
+          assignedRoot = parent.size();
+          if (assignedRoot > maxLabel)
+            {
+            vtkGenericWarningMacro("Island math: number of provisional labels"
+                                   " exceeds the range of the scalar type,"
+                                   " use a wider scalar type.");
+            return;
+            }
+          parent.push_back(assignedRoot);
+          }
+        outPtr[voxelIndex] = static_cast<T>(assignedRoot);
+        }
+      }
+    if (k % 16 == 0)
+      {
+      self->UpdateProgress(0.5 * (k+1) / dims[2]);
+      }
+    }
+
+  // Fully resolve the equivalence table and accumulate island sizes
+  for (size_t label = 1; label < parent.size(); label++)
+    {
+    parent[label] = vtkITKIslandMathFindRoot(parent, label);
+    }
+  std::vector<vtkIdType> islandSizes(parent.size(), 0);
+  vtkIdType numberOfVoxels = static_cast<vtkIdType>(dims[0])*dims[1]*dims[2];
+  for (vtkIdType voxel = 0; voxel < numberOfVoxels; voxel++)
+    {
+    size_t label = static_cast<size_t>(outPtr[voxel]);
+    if (label != 0)
+      {
+      islandSizes[parent[label]]++;
+      }
+    }
+  self->UpdateProgress(0.6);
+
+  // Sort the islands by size, largest first, matching the ordering of the
+  // ITK relabel filter, and drop the ones below the minimum size
+  std::vector<std::pair<vtkIdType, size_t> > sortedIslands;
+  for (size_t label = 1; label < parent.size(); label++)
+    {
+    if (parent[label] == label && islandSizes[label] > 0)
+      {
+      sortedIslands.push_back(std::make_pair(-islandSizes[label], label));
+      }
+    }
+  std::sort(sortedIslands.begin(), sortedIslands.end());
+
+  std::vector<T> finalLabels(parent.size(), 0);
+  unsigned long numberOfIslands = 0;
+  for (size_t island = 0; island < sortedIslands.size(); island++)
+    {
+    if (-sortedIslands[island].first >= self->GetMinimumSize())
+      {
+      finalLabels[sortedIslands[island].second] = static_cast<T>(++numberOfIslands);
+      }
+    }
+  self->SetNumberOfIslands(numberOfIslands);
+  self->SetOriginalNumberOfIslands(static_cast<unsigned long>(sortedIslands.size()));
+
+  // Second pass: rewrite the provisional labels with the final ones
+  for (vtkIdType voxel = 0; voxel < numberOfVoxels; voxel++)
+    {
+    size_t label = static_cast<size_t>(outPtr[voxel]);
+    if (label != 0)
+      {
+      outPtr[voxel] = finalLabels[parent[label]];
+      }
+    }
+  self->UpdateProgress(1.0);
 }
 
 
@@ -23,6 +23,7 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkStructuredPoints.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
 
 #include "itkExtractImageFilter.h"
 
@@ -38,6 +39,14 @@ vtkITKLevelTracingImageFilter::vtkITKLevelTracingImageFilter()
   this->Seed[2] = 0;
 
   this->Plane = 2;  // Default to XY plane
+
+  this->CachedSeed[0] = 0;
+  this->CachedSeed[1] = 0;
+  this->CachedSeed[2] = 0;
+  this->CachedPlane = -1;
+  this->CachedSeedValue = 0.0;
+  this->CachedInputMTime = 0;
+  this->CachedGrayScalarsMTime = 0;
 }
 
 vtkITKLevelTracingImageFilter::~vtkITKLevelTracingImageFilter()
@@ -236,6 +245,81 @@ int vtkITKLevelTracingImageFilter::RequestData(
 
   inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
 
+  // Resolve the scalar array to trace. RGB inputs are converted to
+  // grayscale once per input change instead of on every seed move.
+  vtkDataArray *traceScalars = inScalars;
+  if (inScalars->GetNumberOfComponents() == 3)
+    {
+    if (this->CachedGrayScalars.GetPointer() == NULL ||
+        this->CachedGrayScalarsMTime != inScalars->GetMTime())
+      {
+      this->CachedGrayScalars = vtkSmartPointer<vtkUnsignedCharArray>::New();
+      this->CachedGrayScalars->SetNumberOfTuples( inScalars->GetNumberOfTuples() );
+
+      double in[3];
+      unsigned char out;
+      for (vtkIdType tuple=0; tuple < inScalars->GetNumberOfTuples(); ++tuple)
+        {
+        inScalars->GetTuple(tuple, in);
+
+        out = static_cast<unsigned char>((2125.0 * in[0] +  7154.0 * in[1] +  0721.0 * in[2]) / 10000.0);
+
+        this->CachedGrayScalars->SetTypedTuple(tuple, &out);
+        }
+      this->CachedGrayScalarsMTime = inScalars->GetMTime();
+      }
+    traceScalars = this->CachedGrayScalars;
+    }
+  else if (inScalars->GetNumberOfComponents() != 1)
+    {
+    vtkErrorMacro(<< "Can only trace scalar and RGB images.");
+    return 1;
+    }
+
+  // During level tracing the seed follows the mouse, so most executions
+  // trace the same curve again. If the seed has the same intensity as the
+  // cached trace and lies on the cached path, the curve through it is the
+  // cached one and the trace can be skipped.
+  bool seedInVolume = (this->Seed[0] >= 0 && this->Seed[0] < dims[0] &&
+                       this->Seed[1] >= 0 && this->Seed[1] < dims[1] &&
+                       this->Seed[2] >= 0 && this->Seed[2] < dims[2] &&
+                       this->Plane >= 0 && this->Plane <= 2);
+  double seedValue = 0.0;
+  if (seedInVolume)
+    {
+    vtkIdType seedIndex =
+      (static_cast<vtkIdType>(this->Seed[2])*dims[1] + this->Seed[1])*dims[0] + this->Seed[0];
+    seedValue = traceScalars->GetComponent(seedIndex, 0);
+
+    if (this->CachedOutput.GetPointer() != NULL &&
+        this->CachedInputMTime == inScalars->GetMTime() &&
+        this->CachedPlane == this->Plane &&
+        this->CachedSeedValue == seedValue &&
+        this->Seed[this->Plane] == this->CachedSeed[this->Plane])
+      {
+      bool sameCurve = (this->Seed[0] == this->CachedSeed[0] &&
+                        this->Seed[1] == this->CachedSeed[1] &&
+                        this->Seed[2] == this->CachedSeed[2]);
+      vtkPoints *cachedPoints = this->CachedOutput->GetPoints();
+      for (vtkIdType point = 0;
+           !sameCurve && cachedPoints && point < cachedPoints->GetNumberOfPoints();
+           point++)
+        {
+        double pointIJK[3];
+        cachedPoints->GetPoint(point, pointIJK);
+        sameCurve = (static_cast<int>(pointIJK[0]) == this->Seed[0] &&
+                     static_cast<int>(pointIJK[1]) == this->Seed[1] &&
+                     static_cast<int>(pointIJK[2]) == this->Seed[2]);
+        }
+      if (sameCurve)
+        {
+        vtkDebugMacro(<< "Reusing cached level trace");
+        output->DeepCopy(this->CachedOutput);
+        return 1;
+        }
+      }
+    }
+
   // estimate the number of points from the volume dimensions
   estimatedSize = (int) pow ((double) (dims[0] * dims[1] * dims[2]), .75);
   estimatedSize = estimatedSize / 1024 * 1024; //multiple of 1024
@@ -264,46 +348,16 @@ int vtkITKLevelTracingImageFilter::RequestData(
 #undef vtkTemplateMacroCase_ll
 # define vtkTemplateMacroCase_ll(typeN, type, call)
 #endif
-  if (inScalars->GetNumberOfComponents() == 1 )
+  void* scalars = traceScalars->GetVoidPointer(0);
+  switch (traceScalars->GetDataType())
   {
-    void* scalars = inScalars->GetVoidPointer(0);
-    switch (inScalars->GetDataType())
-    {
-      vtkTemplateMacro(
-        vtkITKLevelTracingTrace(this, static_cast<VTK_TT*>(scalars),
-        dims,extent,origin,spacing,
-        newPts,newPolys,this->Seed, this->Plane
-        )
-        );
-    } //switch
-  }
-  else if (inScalars->GetNumberOfComponents() == 3)
-    {
-    // RGB - convert for now...
-    vtkSmartPointer<vtkUnsignedCharArray> grayScalars
-      = vtkUnsignedCharArray::New();
-    grayScalars->SetNumberOfTuples( inScalars->GetNumberOfTuples() );
-
-    double in[3];
-    unsigned char out;
-    for (vtkIdType i=0; i < inScalars->GetNumberOfTuples(); ++i)
-      {
-      inScalars->GetTuple(i, in);
-
-      out = static_cast<unsigned char>((2125.0 * in[0] +  7154.0 * in[1] +  0721.0 * in[2]) / 10000.0);
-
-      grayScalars->SetTypedTuple(i, &out);
-      }
-
-    vtkITKLevelTracingTrace(this,
-                            (unsigned char *)grayScalars->GetVoidPointer(0),
-                            dims, extent, origin, spacing,
-                            newPts, newPolys, this->Seed, this->Plane);
-    }
-  else
-    {
-    vtkErrorMacro(<< "Can only trace scalar and RGB images.");
-    }
+    vtkTemplateMacro(
+      vtkITKLevelTracingTrace(this, static_cast<VTK_TT*>(scalars),
+      dims,extent,origin,spacing,
+      newPts,newPolys,this->Seed, this->Plane
+      )
+      );
+  } //switch
 
   vtkDebugMacro(<<"Created: "
     << newPts->GetNumberOfPoints() << " points. " );
@@ -318,6 +372,20 @@ int vtkITKLevelTracingImageFilter::RequestData(
   newPolys->Delete();
 
   output->Squeeze();
+
+  // Remember the trace for reuse while the seed stays on the same curve
+  if (seedInVolume)
+    {
+    this->CachedOutput = vtkSmartPointer<vtkPolyData>::New();
+    this->CachedOutput->DeepCopy(output);
+    this->CachedSeed[0] = this->Seed[0];
+    this->CachedSeed[1] = this->Seed[1];
+    this->CachedSeed[2] = this->Seed[2];
+    this->CachedPlane = this->Plane;
+    this->CachedSeedValue = seedValue;
+    this->CachedInputMTime = inScalars->GetMTime();
+    }
+
   return 1;
 }
 
@@ -5,6 +5,9 @@
 #include "vtkITK.h"
 #include "vtkPolyDataAlgorithm.h"
 #include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+
+class vtkUnsignedCharArray;
 
 /// \brief Wrapper class around itk::LevelTracingImageFilterImageFilter.
 ///
@@ -45,6 +48,20 @@ protected:
   int Seed[3];
   int Plane;
 
+  /// Result of the last trace, reused when the seed moves but provably
+  /// stays on the same level curve (same intensity and located on the
+  /// cached path), which keeps tracing responsive during mouse moves.
+  vtkSmartPointer<vtkPolyData> CachedOutput;
+  int CachedSeed[3];
+  int CachedPlane;
+  double CachedSeedValue;
+  unsigned long CachedInputMTime;
+
+  /// Grayscale conversion of an RGB input, cached so it is not redone on
+  /// every seed move
+  vtkSmartPointer<vtkUnsignedCharArray> CachedGrayScalars;
+  unsigned long CachedGrayScalarsMTime;
+
 private:
   vtkITKLevelTracingImageFilter(const vtkITKLevelTracingImageFilter&);  /// Not implemented.
   void operator=(const vtkITKLevelTracingImageFilter&);  /// Not implemented.
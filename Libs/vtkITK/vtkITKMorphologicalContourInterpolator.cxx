@@ -18,8 +18,10 @@
 #include "vtkDataArray.h"
 #include "vtkPointData.h"
 #include "vtkImageData.h"
+#include "vtkAlgorithm.h"
 
 #include "itkMorphologicalContourInterpolator.h"
+#include "itkCommand.h"
 
 vtkStandardNewMacro(vtkITKMorphologicalContourInterpolator);
 
@@ -37,6 +39,25 @@ vtkITKMorphologicalContourInterpolator::~vtkITKMorphologicalContourInterpolator(
 }
 
 
+// Note: local function not method - conforms to signature in itkCommand.h
+void vtkITKMorphologicalContourInterpolatorHandleProgressEvent(itk::Object *caller,
+                                                               const itk::EventObject& vtkNotUsed(eventObject),
+                                                               void *clientdata)
+{
+  itk::ProcessObject *itkFilter = dynamic_cast<itk::ProcessObject*>(caller);
+  vtkAlgorithm *vtkFilter = reinterpret_cast<vtkAlgorithm*>(clientdata);
+  if ( itkFilter && vtkFilter )
+    {
+    vtkFilter->UpdateProgress( itkFilter->GetProgress() );
+    // Forward cancellation requested on the VTK side to the ITK filter,
+    // which stops handing out interpolation tasks
+    if ( vtkFilter->GetAbortExecute() )
+      {
+      itkFilter->AbortGenerateDataOn();
+      }
+    }
+};
+
 template <class T>
 void vtkITKMorphologicalContourInterpolatorExecute(vtkITKMorphologicalContourInterpolator *self, vtkImageData* input,
                 vtkImageData* vtkNotUsed(output),
@@ -71,6 +92,12 @@ void vtkITKMorphologicalContourInterpolatorExecute(vtkITKMorphologicalContourInt
   typedef itk::MorphologicalContourInterpolator<ImageType> ContourInterpolatorType;
   typename ContourInterpolatorType::Pointer interpolatorFilter = ContourInterpolatorType::New();
 
+  // set up the progress callback
+  itk::CStyleCommand::Pointer progressCommand = itk::CStyleCommand::New();
+  progressCommand->SetClientData( static_cast<void *>(self) );
+  progressCommand->SetCallback( vtkITKMorphologicalContourInterpolatorHandleProgressEvent );
+  interpolatorFilter->AddObserver(itk::ProgressEvent(), progressCommand);
+
   interpolatorFilter->SetLabel(static_cast<T>(self->GetLabel()));
   interpolatorFilter->SetAxis(self->GetAxis());
   interpolatorFilter->SetHeuristicAlignment(self->GetHeuristicAlignment());
@@ -0,0 +1,116 @@
+/*==============================================================================
+
+  Copyright (c) Laboratory for Percutaneous Surgery (PerkLab)
+  Queen's University, Kingston, ON, Canada. All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+// SegmentationCore includes
+#include "vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule.h"
+
+#include "vtkChunkedBinaryLabelmap.h"
+#include "vtkOrientedImageData.h"
+
+// VTK includes
+#include <vtkObjectFactory.h>
+
+// STD includes
+#include <sstream>
+
+//----------------------------------------------------------------------------
+vtkSegmentationConverterRuleNewMacro(vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule);
+
+//----------------------------------------------------------------------------
+vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule::vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule()
+{
+  // Brick size parameter
+  this->ConversionParameters[GetBrickSizeParameterName()] = std::make_pair("32",
+    "Edge length of the chunked labelmap bricks in voxels. Smaller bricks follow the"
+    " segment surface more closely but add bookkeeping overhead.");
+}
+
+//----------------------------------------------------------------------------
+vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule::~vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule()
+{
+}
+
+//----------------------------------------------------------------------------
+unsigned int vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule::GetConversionCost(
+  vtkDataObject* vtkNotUsed(sourceRepresentation)/*=NULL*/,
+  vtkDataObject* vtkNotUsed(targetRepresentation)/*=NULL*/)
+{
+  // Rough input-independent guess (ms)
+  return 100;
+}
+
+//----------------------------------------------------------------------------
+vtkDataObject* vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule::ConstructRepresentationObjectByRepresentation(std::string representationName)
+{
+  if ( !representationName.compare(this->GetSourceRepresentationName()) )
+    {
+    return (vtkDataObject*)vtkOrientedImageData::New();
+    }
+  else if ( !representationName.compare(this->GetTargetRepresentationName()) )
+    {
+    return (vtkDataObject*)vtkChunkedBinaryLabelmap::New();
+    }
+  else
+    {
+    return NULL;
+    }
+}
+
+//----------------------------------------------------------------------------
+vtkDataObject* vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule::ConstructRepresentationObjectByClass(std::string className)
+{
+  if (!className.compare("vtkOrientedImageData"))
+    {
+    return (vtkDataObject*)vtkOrientedImageData::New();
+    }
+  else if (!className.compare("vtkChunkedBinaryLabelmap"))
+    {
+    return (vtkDataObject*)vtkChunkedBinaryLabelmap::New();
+    }
+  else
+    {
+    return NULL;
+    }
+}
+
+//----------------------------------------------------------------------------
+bool vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule::Convert(vtkDataObject* sourceRepresentation, vtkDataObject* targetRepresentation)
+{
+  // Check validity of source and target representation objects
+  vtkOrientedImageData* binaryLabelMap = vtkOrientedImageData::SafeDownCast(sourceRepresentation);
+  if (!binaryLabelMap)
+    {
+    vtkErrorMacro("Convert: Source representation is not an oriented image data!");
+    return false;
+    }
+  vtkChunkedBinaryLabelmap* chunkedLabelMap = vtkChunkedBinaryLabelmap::SafeDownCast(targetRepresentation);
+  if (!chunkedLabelMap)
+    {
+    vtkErrorMacro("Convert: Target representation is not a chunked binary labelmap!");
+    return false;
+    }
+
+  // Apply the brick size parameter
+  int brickSize = 0;
+  std::stringstream brickSizeSs(this->ConversionParameters[GetBrickSizeParameterName()].first);
+  brickSizeSs >> brickSize;
+  if (brickSize > 0)
+    {
+    chunkedLabelMap->SetBrickSize(brickSize);
+    }
+
+  return chunkedLabelMap->ImportFromImage(binaryLabelMap);
+}
@@ -25,7 +25,11 @@
 
 // VTK includes
 #include <vtkVersion.h> // must precede reference to VTK_MAJOR_VERSION
+#include <vtkAppendPolyData.h>
+#include <vtkBox.h>
 #include <vtkDecimatePro.h>
+#include <vtkExtractPolyDataGeometry.h>
+#include <vtkImageClip.h>
 #if VTK_MAJOR_VERSION >= 9
   #include <vtkDiscreteFlyingEdges3D.h>
 #else
@@ -38,12 +42,17 @@
 #include <vtkObjectFactory.h>
 #include <vtkPolyData.h>
 #include <vtkPolyDataNormals.h>
+#include <vtkQuadricDecimation.h>
 #include <vtkTransform.h>
 #include <vtkTransformPolyDataFilter.h>
 #include <vtkWindowedSincPolyDataFilter.h>
 #include <vtkMatrix3x3.h>
+#include <vtkMatrix4x4.h>
 #include <vtkReverseSense.h>
 
+// STD includes
+#include <algorithm>
+
 //----------------------------------------------------------------------------
 vtkSegmentationConverterRuleNewMacro(vtkBinaryLabelmapToClosedSurfaceConversionRule);
 
@@ -53,6 +62,10 @@ vtkBinaryLabelmapToClosedSurfaceConversionRule::vtkBinaryLabelmapToClosedSurface
   this->ConversionParameters[GetDecimationFactorParameterName()] = std::make_pair("0.0",
     "Desired reduction in the total number of polygons. Range: 0.0 (no decimation) to 1.0 (as much simplification as possible)."
     " Value of 0.8 typically reduces data set size by 80% without losing too much details.");
+  this->ConversionParameters[GetQuadricDecimationParameterName()] = std::make_pair("0",
+    "Decimation method. 0 (default) = progressive decimation, preserves topology. "
+    "1 = quadric simplification, considerably faster on large meshes and distributes error"
+    " more evenly, but may close small handles.");
   this->ConversionParameters[GetSmoothingFactorParameterName()] = std::make_pair("0.5",
     "Smoothing factor. Range: 0.0 (no smoothing) to 1.0 (strong smoothing).");
   this->ConversionParameters[GetComputeSurfaceNormalsParameterName()] = std::make_pair("1",
@@ -169,6 +182,7 @@ bool vtkBinaryLabelmapToClosedSurfaceConversionRule::Convert(vtkDataObject* sour
   double decimationFactor = vtkVariant(this->ConversionParameters[GetDecimationFactorParameterName()].first).ToDouble();
   double smoothingFactor = vtkVariant(this->ConversionParameters[GetSmoothingFactorParameterName()].first).ToDouble();
   int computeSurfaceNormals = vtkVariant(this->ConversionParameters[GetComputeSurfaceNormalsParameterName()].first).ToInt();
+  int quadricDecimation = vtkVariant(this->ConversionParameters[GetQuadricDecimationParameterName()].first).ToInt();
 
 
   // Run marching cubes
@@ -200,7 +214,19 @@ bool vtkBinaryLabelmapToClosedSurfaceConversionRule::Convert(vtkDataObject* sour
     }
 
   // Decimate
-  if (decimationFactor > 0.0)
+  if (decimationFactor > 0.0 && quadricDecimation > 0)
+    {
+    // Quadric simplification collapses edges ordered by quadric error instead of
+    // iteratively re-evaluating vertices, which makes it considerably faster than
+    // progressive decimation on meshes with millions of cells.
+    vtkSmartPointer<vtkQuadricDecimation> decimator = vtkSmartPointer<vtkQuadricDecimation>::New();
+    decimator->SetInputData(processingResult);
+    decimator->SetTargetReduction(decimationFactor);
+    decimator->VolumePreservationOn();
+    decimator->Update();
+    processingResult = decimator->GetOutput();
+    }
+  else if (decimationFactor > 0.0)
     {
     vtkSmartPointer<vtkDecimatePro> decimator = vtkSmartPointer<vtkDecimatePro>::New();
     decimator->SetInputData(processingResult);
@@ -287,6 +313,131 @@ bool vtkBinaryLabelmapToClosedSurfaceConversionRule::Convert(vtkDataObject* sour
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool vtkBinaryLabelmapToClosedSurfaceConversionRule::ConvertModifiedRegion(
+  vtkDataObject* sourceRepresentation, vtkDataObject* targetRepresentation, const int modifiedExtent[6])
+{
+  // Check validity of source and target representation objects
+  vtkOrientedImageData* orientedBinaryLabelMap = vtkOrientedImageData::SafeDownCast(sourceRepresentation);
+  if (!orientedBinaryLabelMap)
+    {
+    vtkErrorMacro("ConvertModifiedRegion: Source representation is not oriented image data");
+    return false;
+    }
+  vtkPolyData* closedSurfacePolyData = vtkPolyData::SafeDownCast(targetRepresentation);
+  if (!closedSurfacePolyData)
+    {
+    vtkErrorMacro("ConvertModifiedRegion: Target representation is not poly data");
+    return false;
+    }
+
+  // Without an existing surface there is nothing to patch
+  if (closedSurfacePolyData->GetNumberOfPolys() == 0)
+    {
+    return this->Convert(sourceRepresentation, targetRepresentation);
+    }
+
+  // Clip the modified extent to the labelmap extent
+  int labelmapExtent[6] = { 0, -1, 0, -1, 0, -1 };
+  orientedBinaryLabelMap->GetExtent(labelmapExtent);
+  int region[6] = { 0, -1, 0, -1, 0, -1 };
+  for (int axis = 0; axis < 3; ++axis)
+    {
+    region[2 * axis] = std::max(modifiedExtent[2 * axis], labelmapExtent[2 * axis]);
+    region[2 * axis + 1] = std::min(modifiedExtent[2 * axis + 1], labelmapExtent[2 * axis + 1]);
+    if (region[2 * axis] > region[2 * axis + 1])
+      {
+      // modified region is outside the labelmap, surface is up to date
+      return true;
+      }
+    }
+
+  // When a large part of the labelmap changed the region-limited update
+  // has no advantage over the full conversion
+  long long regionVoxels = 1;
+  long long labelmapVoxels = 1;
+  for (int axis = 0; axis < 3; ++axis)
+    {
+    regionVoxels *= region[2 * axis + 1] - region[2 * axis] + 1;
+    labelmapVoxels *= labelmapExtent[2 * axis + 1] - labelmapExtent[2 * axis] + 1;
+    }
+  if (2 * regionVoxels >= labelmapVoxels)
+    {
+    return this->Convert(sourceRepresentation, targetRepresentation);
+    }
+
+  // Pad the region by one voxel so that the new patch overlaps the seam
+  for (int axis = 0; axis < 3; ++axis)
+    {
+    region[2 * axis] = std::max(region[2 * axis] - 1, labelmapExtent[2 * axis]);
+    region[2 * axis + 1] = std::min(region[2 * axis + 1] + 1, labelmapExtent[2 * axis + 1]);
+    }
+
+  // Extract the modified region into its own oriented labelmap
+  vtkSmartPointer<vtkImageClip> clipper = vtkSmartPointer<vtkImageClip>::New();
+  clipper->SetInputData(orientedBinaryLabelMap);
+  clipper->SetOutputWholeExtent(region);
+  clipper->ClipDataOn();
+  clipper->Update();
+  vtkSmartPointer<vtkOrientedImageData> regionLabelMap = vtkSmartPointer<vtkOrientedImageData>::New();
+  regionLabelMap->ShallowCopy(clipper->GetOutput());
+  regionLabelMap->CopyDirections(orientedBinaryLabelMap);
+
+  // Extract the patch mesh with the regular pipeline (marching cubes,
+  // decimation, smoothing). The border of the region is padded with
+  // background by the full conversion, so the patch is a closed surface
+  // ending at the region boundary.
+  vtkSmartPointer<vtkPolyData> patchPolyData = vtkSmartPointer<vtkPolyData>::New();
+  if (!this->Convert(regionLabelMap, patchPolyData))
+    {
+    return false;
+    }
+
+  // Compute the world-space bounding box of the padded modified region
+  vtkSmartPointer<vtkMatrix4x4> imageToWorldMatrix = vtkSmartPointer<vtkMatrix4x4>::New();
+  orientedBinaryLabelMap->GetImageToWorldMatrix(imageToWorldMatrix);
+  double regionBounds[6] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+  for (int corner = 0; corner < 8; ++corner)
+    {
+    double cornerIjk[4] = { 0.0, 0.0, 0.0, 1.0 };
+    for (int axis = 0; axis < 3; ++axis)
+      {
+      cornerIjk[axis] = (corner & (1 << axis)) ?
+        region[2 * axis + 1] + 0.5 : region[2 * axis] - 0.5;
+      }
+    double cornerWorld[4] = { 0.0, 0.0, 0.0, 1.0 };
+    imageToWorldMatrix->MultiplyPoint(cornerIjk, cornerWorld);
+    for (int axis = 0; axis < 3; ++axis)
+      {
+      regionBounds[2 * axis] = std::min(regionBounds[2 * axis], cornerWorld[axis]);
+      regionBounds[2 * axis + 1] = std::max(regionBounds[2 * axis + 1], cornerWorld[axis]);
+      }
+    }
+
+  // Keep only the cells of the existing surface that lie entirely outside
+  // the modified region; the removed cells are replaced by the new patch
+  vtkSmartPointer<vtkBox> regionBox = vtkSmartPointer<vtkBox>::New();
+  regionBox->SetBounds(regionBounds);
+  vtkSmartPointer<vtkExtractPolyDataGeometry> keptSurfaceExtractor = vtkSmartPointer<vtkExtractPolyDataGeometry>::New();
+  keptSurfaceExtractor->SetInputData(closedSurfacePolyData);
+  keptSurfaceExtractor->SetImplicitFunction(regionBox);
+  keptSurfaceExtractor->ExtractInsideOff();
+  keptSurfaceExtractor->ExtractBoundaryCellsOff();
+  keptSurfaceExtractor->Update();
+
+  // Stitch the kept mesh and the freshly extracted patch
+  vtkSmartPointer<vtkAppendPolyData> appender = vtkSmartPointer<vtkAppendPolyData>::New();
+  appender->AddInputData(keptSurfaceExtractor->GetOutput());
+  if (patchPolyData->GetNumberOfPolys() > 0)
+    {
+    appender->AddInputData(patchPolyData);
+    }
+  appender->Update();
+
+  closedSurfacePolyData->ShallowCopy(appender->GetOutput());
+  return true;
+}
+
 //----------------------------------------------------------------------------
 template<class ImageScalarType>
 void IsLabelmapPaddingNecessaryGeneric(vtkImageData* binaryLabelMap, bool &paddingNecessary)
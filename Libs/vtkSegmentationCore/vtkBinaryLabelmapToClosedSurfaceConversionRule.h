@@ -38,6 +38,8 @@ class vtkSegmentationCore_EXPORT vtkBinaryLabelmapToClosedSurfaceConversionRule
 public:
   /// Conversion parameter: decimation factor
   static const std::string GetDecimationFactorParameterName() { return "Decimation factor"; };
+  /// Conversion parameter: use quadric simplification for the decimation step
+  static const std::string GetQuadricDecimationParameterName() { return "Quadric decimation"; };
   /// Conversion parameter: smoothing factor
   static const std::string GetSmoothingFactorParameterName() { return "Smoothing factor"; };
   /// Conversion parameter: compute surface normals
@@ -61,6 +63,20 @@ public:
   /// Update the target representation based on the source representation
   virtual bool Convert(vtkDataObject* sourceRepresentation, vtkDataObject* targetRepresentation) VTK_OVERRIDE;
 
+  /// This rule can update just the mesh patch affected by a localized edit
+  virtual bool SupportsRegionLimitedConversion() VTK_OVERRIDE { return true; };
+
+  /// Re-extract only the mesh patch that intersects the modified extent of
+  /// the labelmap (IJK voxel coordinates) and stitch it into the existing
+  /// closed surface. Cells of the existing surface that intersect the
+  /// modified region are removed and replaced by the freshly extracted
+  /// patch, so 3D feedback after a paint/erase stroke costs time
+  /// proportional to the stroke, not to the segment.
+  /// Falls back to full conversion when the target surface is empty or the
+  /// modified extent covers most of the labelmap.
+  virtual bool ConvertModifiedRegion(vtkDataObject* sourceRepresentation, vtkDataObject* targetRepresentation,
+    const int modifiedExtent[6]) VTK_OVERRIDE;
+
   /// Get the cost of the conversion.
   virtual unsigned int GetConversionCost(vtkDataObject* sourceRepresentation=NULL, vtkDataObject* targetRepresentation=NULL) VTK_OVERRIDE;
 
@@ -0,0 +1,100 @@
+/*==============================================================================
+
+  Copyright (c) Laboratory for Percutaneous Surgery (PerkLab)
+  Queen's University, Kingston, ON, Canada. All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+// SegmentationCore includes
+#include "vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule.h"
+
+#include "vtkOrientedImageData.h"
+#include "vtkRunLengthBinaryLabelmap.h"
+
+// VTK includes
+#include <vtkObjectFactory.h>
+
+//----------------------------------------------------------------------------
+vtkSegmentationConverterRuleNewMacro(vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule);
+
+//----------------------------------------------------------------------------
+vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule::vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule()
+{
+}
+
+//----------------------------------------------------------------------------
+vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule::~vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule()
+{
+}
+
+//----------------------------------------------------------------------------
+unsigned int vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule::GetConversionCost(
+  vtkDataObject* vtkNotUsed(sourceRepresentation)/*=NULL*/,
+  vtkDataObject* vtkNotUsed(targetRepresentation)/*=NULL*/)
+{
+  // Rough input-independent guess (ms)
+  return 100;
+}
+
+//----------------------------------------------------------------------------
+vtkDataObject* vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule::ConstructRepresentationObjectByRepresentation(std::string representationName)
+{
+  if ( !representationName.compare(this->GetSourceRepresentationName()) )
+    {
+    return (vtkDataObject*)vtkOrientedImageData::New();
+    }
+  else if ( !representationName.compare(this->GetTargetRepresentationName()) )
+    {
+    return (vtkDataObject*)vtkRunLengthBinaryLabelmap::New();
+    }
+  else
+    {
+    return NULL;
+    }
+}
+
+//----------------------------------------------------------------------------
+vtkDataObject* vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule::ConstructRepresentationObjectByClass(std::string className)
+{
+  if (!className.compare("vtkOrientedImageData"))
+    {
+    return (vtkDataObject*)vtkOrientedImageData::New();
+    }
+  else if (!className.compare("vtkRunLengthBinaryLabelmap"))
+    {
+    return (vtkDataObject*)vtkRunLengthBinaryLabelmap::New();
+    }
+  else
+    {
+    return NULL;
+    }
+}
+
+//----------------------------------------------------------------------------
+bool vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule::Convert(vtkDataObject* sourceRepresentation, vtkDataObject* targetRepresentation)
+{
+  // Check validity of source and target representation objects
+  vtkOrientedImageData* binaryLabelMap = vtkOrientedImageData::SafeDownCast(sourceRepresentation);
+  if (!binaryLabelMap)
+    {
+    vtkErrorMacro("Convert: Source representation is not an oriented image data!");
+    return false;
+    }
+  vtkRunLengthBinaryLabelmap* runLengthLabelMap = vtkRunLengthBinaryLabelmap::SafeDownCast(targetRepresentation);
+  if (!runLengthLabelMap)
+    {
+    vtkErrorMacro("Convert: Target representation is not a run-length binary labelmap!");
+    return false;
+    }
+
+  return runLengthLabelMap->ImportFromImage(binaryLabelMap);
+}
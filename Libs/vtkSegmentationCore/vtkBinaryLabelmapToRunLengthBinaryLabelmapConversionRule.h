@@ -0,0 +1,71 @@
+/*==============================================================================
+
+  Copyright (c) Laboratory for Percutaneous Surgery (PerkLab)
+  Queen's University, Kingston, ON, Canada. All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+#ifndef __vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule_h
+#define __vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule_h
+
+// SegmentationCore includes
+#include "vtkSegmentationConverterRule.h"
+#include "vtkSegmentationConverter.h"
+#include "vtkSegmentationCoreConfigure.h"
+
+/// \ingroup SegmentationCore
+/// \brief Convert binary labelmap representation (vtkOrientedImageData type) to
+///   run-length encoded binary labelmap representation
+///   (vtkRunLengthBinaryLabelmap type). Segment masks are almost entirely
+///   made of long runs, so the encoded form uses a small fraction of the
+///   memory of the dense labelmap and is suitable as the at-rest form of
+///   segments that are not being edited.
+class vtkSegmentationCore_EXPORT vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule
+  : public vtkSegmentationConverterRule
+{
+public:
+  static vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule* New();
+  vtkTypeMacro(vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule, vtkSegmentationConverterRule);
+  virtual vtkSegmentationConverterRule* CreateRuleInstance() VTK_OVERRIDE;
+
+  /// Constructs representation object from representation name for the supported representation classes
+  /// (typically source and target representation VTK classes, subclasses of vtkDataObject)
+  /// Note: Need to take ownership of the created object! For example using vtkSmartPointer<vtkDataObject>::Take
+  virtual vtkDataObject* ConstructRepresentationObjectByRepresentation(std::string representationName) VTK_OVERRIDE;
+
+  /// Constructs representation object from class name for the supported representation classes
+  /// (typically source and target representation VTK classes, subclasses of vtkDataObject)
+  /// Note: Need to take ownership of the created object! For example using vtkSmartPointer<vtkDataObject>::Take
+  virtual vtkDataObject* ConstructRepresentationObjectByClass(std::string className) VTK_OVERRIDE;
+
+  /// Update the target representation based on the source representation
+  virtual bool Convert(vtkDataObject* sourceRepresentation, vtkDataObject* targetRepresentation) VTK_OVERRIDE;
+
+  /// Get the cost of the conversion.
+  virtual unsigned int GetConversionCost(vtkDataObject* sourceRepresentation=NULL, vtkDataObject* targetRepresentation=NULL) VTK_OVERRIDE;
+
+  /// Human-readable name of the converter rule
+  virtual const char* GetName() VTK_OVERRIDE { return "Binary labelmap to run-length binary labelmap"; };
+
+  /// Human-readable name of the source representation
+  virtual const char* GetSourceRepresentationName() VTK_OVERRIDE { return vtkSegmentationConverter::GetSegmentationBinaryLabelmapRepresentationName(); };
+
+  /// Human-readable name of the target representation
+  virtual const char* GetTargetRepresentationName() VTK_OVERRIDE { return vtkSegmentationConverter::GetSegmentationRunLengthBinaryLabelmapRepresentationName(); };
+
+protected:
+  vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule();
+  ~vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule();
+  void operator=(const vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule&);
+};
+
+#endif // __vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule_h
@@ -23,6 +23,7 @@
 
 // VTK includes
 #include <vtkCollection.h>
+#include <vtkMassProperties.h>
 #include <vtkMatrix4x4.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
@@ -35,6 +36,26 @@
 // STD includes
 #include <math.h>
 #include <algorithm>
+#include <map>
+
+//----------------------------------------------------------------------------
+namespace
+{
+  /// Mass properties results for a recently analyzed mesh.
+  /// The conversion rules create a new calculator instance for each conversion,
+  /// so the results are kept in a class-level cache. Entries are validated
+  /// against the MTime of the poly data, so a stale entry for a deleted or
+  /// modified mesh can never be returned.
+  struct MassPropertiesCacheEntry
+    {
+    vtkMTimeType InputMTime;
+    double Volume;
+    double ProjectedVolume;
+    double NormalizedShapeIndex;
+    };
+  std::map<vtkPolyData*, MassPropertiesCacheEntry> MassPropertiesCache;
+  const size_t MaximumMassPropertiesCacheEntries = 32;
+} // namespace
 
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkCalculateOversamplingFactor);
@@ -48,7 +69,6 @@ vtkCalculateOversamplingFactor::vtkCalculateOversamplingFactor()
   this->OutputRelativeStructureSize = 0.0;
   this->OutputComplexityMeasure = 0.0;
   this->OutputNormalizedShapeIndex = 0.0;
-  this->MassPropertiesAlgorithm = NULL;
   this->LogSpeedMeasurementsOff();
 }
 
@@ -57,7 +77,6 @@ vtkCalculateOversamplingFactor::~vtkCalculateOversamplingFactor()
 {
   this->SetInputPolyData(NULL);
   this->SetReferenceGeometryImageData(NULL);
-  this->SetMassPropertiesAlgorithm(NULL);
 }
 
 //----------------------------------------------------------------------------
@@ -89,22 +108,51 @@ bool vtkCalculateOversamplingFactor::CalculateOversamplingFactor()
   double checkpointStart = timer->GetUniversalTime();
 #endif
 
-  // Create mass properties algorithm for common use
-  vtkSmartPointer<vtkMassProperties> massProperties = vtkSmartPointer<vtkMassProperties>::New();
-  this->SetMassPropertiesAlgorithm(massProperties);
-  massProperties->SetInputData(this->InputPolyData);
-  // Run algorithm so that results can be extracted for relative structure size calculation and complexity measure
-  massProperties->Update();
+  // Get mass properties of the mesh, re-using cached results if the mesh has not
+  // changed since it was last analyzed. The mass properties pass over the full mesh
+  // dominates the cost of this calculation, so re-running the conversion on an
+  // unchanged surface (e.g. when only the reference geometry changed) skips it.
+  double structureVolume = 0.0;
+  double structureProjectedVolume = 0.0;
+  double normalizedShapeIndex = 0.0;
+  std::map<vtkPolyData*, MassPropertiesCacheEntry>::iterator cacheIt = MassPropertiesCache.find(this->InputPolyData);
+  if (cacheIt != MassPropertiesCache.end() && cacheIt->second.InputMTime == this->InputPolyData->GetMTime())
+    {
+    structureVolume = cacheIt->second.Volume;
+    structureProjectedVolume = cacheIt->second.ProjectedVolume;
+    normalizedShapeIndex = cacheIt->second.NormalizedShapeIndex;
+    }
+  else
+    {
+    vtkSmartPointer<vtkMassProperties> massProperties = vtkSmartPointer<vtkMassProperties>::New();
+    massProperties->SetInputData(this->InputPolyData);
+    // Run algorithm so that results can be extracted for relative structure size calculation and complexity measure
+    massProperties->Update();
+    structureVolume = massProperties->GetVolume();
+    structureProjectedVolume = massProperties->GetVolumeProjected();
+    normalizedShapeIndex = massProperties->GetNormalizedShapeIndex();
+
+    // Keep the cache from growing without bound
+    if (MassPropertiesCache.size() >= MaximumMassPropertiesCacheEntries)
+      {
+      MassPropertiesCache.clear();
+      }
+    MassPropertiesCacheEntry& entry = MassPropertiesCache[this->InputPolyData];
+    entry.InputMTime = this->InputPolyData->GetMTime();
+    entry.Volume = structureVolume;
+    entry.ProjectedVolume = structureProjectedVolume;
+    entry.NormalizedShapeIndex = normalizedShapeIndex;
+    }
 
   // Get relative structure size
-  if (!this->CalculateRelativeStructureSize())
+  if (!this->CalculateRelativeStructureSize(structureVolume, structureProjectedVolume))
     {
     vtkErrorMacro("CalculateOversamplingFactor: Failed to calculate relative structure size");
     return false;
     }
 
   // Get complexity measure
-  if (!this->CalculateComplexityMeasure())
+  if (!this->CalculateComplexityMeasure(normalizedShapeIndex))
     {
     vtkErrorMacro("CalculateOversamplingFactor: Failed to calculate complexity measure");
     return false;
@@ -127,36 +175,19 @@ bool vtkCalculateOversamplingFactor::CalculateOversamplingFactor()
       << "\tDetermining oversampling factor using fuzzy rules: " << checkpointEnd-checkpointFuzzyStart << " s");
     }
 
-  // Clean up (triggers destruction of member)
-  this->SetMassPropertiesAlgorithm(NULL);
-
   return true;
 }
 
 //----------------------------------------------------------------------------
-bool vtkCalculateOversamplingFactor::CalculateRelativeStructureSize()
+bool vtkCalculateOversamplingFactor::CalculateRelativeStructureSize(double structureVolume, double structureProjectedVolume)
 {
-  if (!this->InputPolyData)
-    {
-    vtkErrorMacro("CalculateRelativeStructureSize: Invalid input poly data!");
-    return false;
-    }
   if (!this->ReferenceGeometryImageData)
     {
     vtkErrorMacro("CalculateRelativeStructureSize: Invalid rasterization reference volume node!");
     return false;
     }
-  if (!this->MassPropertiesAlgorithm)
-    {
-    vtkErrorMacro("CalculateRelativeStructureSize: Invalid mass properties algorithm!");
-    return false;
-    }
 
-  // Get structure volume in mm^3
-  double structureVolume = this->MassPropertiesAlgorithm->GetVolume();
-
-  // Sanity check
-  double structureProjectedVolume = this->MassPropertiesAlgorithm->GetVolumeProjected();
+  // Sanity check of the structure volume (in mm^3) using the projected volume
   double error = (structureVolume - structureProjectedVolume);
   if (error * 10000 > structureVolume)
     {
@@ -180,22 +211,11 @@ bool vtkCalculateOversamplingFactor::CalculateRelativeStructureSize()
 }
 
 //----------------------------------------------------------------------------
-bool vtkCalculateOversamplingFactor::CalculateComplexityMeasure()
+bool vtkCalculateOversamplingFactor::CalculateComplexityMeasure(double normalizedShapeIndex)
 {
-  if (!this->InputPolyData)
-    {
-    vtkErrorMacro("CalculateComplexityMeasure: Invalid input poly data!");
-    return false;
-    }
-  if (!this->MassPropertiesAlgorithm)
-    {
-    vtkErrorMacro("CalculateComplexityMeasure: Invalid mass properties algorithm!");
-    return false;
-    }
-
   // Normalized shape index (NSI) characterizes the deviation of the shape of an object
   // from a sphere (from surface area and volume). A sphere's NSI is one. This number is always >= 1.0
-  this->OutputNormalizedShapeIndex = this->MassPropertiesAlgorithm->GetNormalizedShapeIndex();
+  this->OutputNormalizedShapeIndex = normalizedShapeIndex;
 
   // Map raw measurement to the fuzzy input scale
   this->OutputComplexityMeasure = std::max(this->OutputNormalizedShapeIndex - 1.0, 0.0); // If smaller then 0, then return 0
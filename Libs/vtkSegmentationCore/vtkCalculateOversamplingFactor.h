@@ -26,7 +26,6 @@
 
 // VTK includes
 #include <vtkObject.h>
-#include <vtkMassProperties.h>
 #include <vtkPolyData.h>
 
 // SegmentationCore includes
@@ -48,6 +47,9 @@ public:
 public:
   /// Calculate oversampling factor for the input model and its rasterization reference volume
   /// based on model properties using fuzzy logics.
+  /// The expensive mass properties pass over the full mesh is only performed when the
+  /// input poly data changed; results for recently analyzed meshes are re-used, so
+  /// repeated conversions of an unchanged surface skip the mesh analysis.
   bool CalculateOversamplingFactor();
 
   /// Apply oversampling factor on image data geometry.
@@ -55,13 +57,15 @@ public:
   static void ApplyOversamplingOnImageGeometry(vtkOrientedImageData* imageData, double oversamplingFactor);
 
 protected:
-  /// Calculate relative structure size from input model and rasterization reference volume
+  /// Calculate relative structure size from the structure volume and the rasterization
+  /// reference volume. The projected volume is used for a sanity check of the input volume.
   /// \return Success flag
-  bool CalculateRelativeStructureSize();
+  bool CalculateRelativeStructureSize(double structureVolume, double structureProjectedVolume);
 
-  /// Calculate complexity measure based on surface poly data in input model
+  /// Calculate complexity measure from the normalized shape index of the surface poly data
+  /// in the input model
   /// \return Success flag
-  bool CalculateComplexityMeasure();
+  bool CalculateComplexityMeasure(double normalizedShapeIndex);
 
   /// Use fuzzy rules to determine oversampling factor based on calculated relative structure size and complexity measure
   /// \return Automatically calculated oversampling factor
@@ -91,10 +95,6 @@ public:
   vtkSetMacro(LogSpeedMeasurements, bool);
   vtkBooleanMacro(LogSpeedMeasurements, bool);
 
-protected:
-  vtkGetObjectMacro(MassPropertiesAlgorithm, vtkMassProperties);
-  vtkSetObjectMacro(MassPropertiesAlgorithm, vtkMassProperties);
-
 protected:
   /// Input poly data to rasterize
   vtkPolyData* InputPolyData;
@@ -115,10 +115,6 @@ protected:
   /// Flag telling whether the speed measurements are logged on standard output
   bool LogSpeedMeasurements;
 
-  /// Temporary storage for mass properties algorithm that is used in both sub-calculations
-  /// \sa CalculateRelativeStructureSize and CalculateComplexityMeasure
-  vtkMassProperties* MassPropertiesAlgorithm;
-
 protected:
   vtkCalculateOversamplingFactor();
   virtual ~vtkCalculateOversamplingFactor();
@@ -0,0 +1,360 @@
+/*==============================================================================
+
+  Copyright (c) Laboratory for Percutaneous Surgery (PerkLab)
+  Queen's University, Kingston, ON, Canada. All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+// SegmentationCore includes
+#include "vtkChunkedBinaryLabelmap.h"
+
+#include "vtkOrientedImageData.h"
+
+// VTK includes
+#include <vtkImageData.h>
+#include <vtkMatrix4x4.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+
+// STD includes
+#include <cstring>
+
+//----------------------------------------------------------------------------
+vtkStandardNewMacro(vtkChunkedBinaryLabelmap);
+
+namespace
+{
+
+//----------------------------------------------------------------------------
+template <class ImageScalarType>
+void ComputeRegionScalarRange(vtkImageData* image, const int region[6], double range[2])
+{
+  range[0] = VTK_DOUBLE_MAX;
+  range[1] = VTK_DOUBLE_MIN;
+  int rowLength = region[1] - region[0] + 1;
+  for (int z = region[4]; z <= region[5]; ++z)
+    {
+    for (int y = region[2]; y <= region[3]; ++y)
+      {
+      ImageScalarType* voxelPtr = static_cast<ImageScalarType*>(
+        image->GetScalarPointer(region[0], y, z));
+      for (int x = 0; x < rowLength; ++x)
+        {
+        double value = static_cast<double>(voxelPtr[x]);
+        if (value < range[0])
+          {
+          range[0] = value;
+          }
+        if (value > range[1])
+          {
+          range[1] = value;
+          }
+        }
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+// Copy the voxels of a region row by row between two images of the same
+// scalar type that both contain the region
+void CopyRegionVoxels(vtkImageData* source, vtkImageData* target, const int region[6])
+{
+  size_t rowBytes = static_cast<size_t>(region[1] - region[0] + 1)
+    * source->GetScalarSize();
+  for (int z = region[4]; z <= region[5]; ++z)
+    {
+    for (int y = region[2]; y <= region[3]; ++y)
+      {
+      void* sourceRow = source->GetScalarPointer(region[0], y, z);
+      void* targetRow = target->GetScalarPointer(region[0], y, z);
+      memcpy(targetRow, sourceRow, rowBytes);
+      }
+    }
+}
+
+} // end of anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkChunkedBinaryLabelmap::vtkChunkedBinaryLabelmap()
+{
+  this->ImageToWorldMatrix = vtkMatrix4x4::New();
+  this->Extent[0] = 0;
+  this->Extent[1] = -1;
+  this->Extent[2] = 0;
+  this->Extent[3] = -1;
+  this->Extent[4] = 0;
+  this->Extent[5] = -1;
+  this->ScalarType = VTK_VOID;
+  this->BrickSize = 32;
+}
+
+//----------------------------------------------------------------------------
+vtkChunkedBinaryLabelmap::~vtkChunkedBinaryLabelmap()
+{
+  this->ImageToWorldMatrix->Delete();
+  this->ImageToWorldMatrix = NULL;
+}
+
+//----------------------------------------------------------------------------
+void vtkChunkedBinaryLabelmap::Initialize()
+{
+  this->Superclass::Initialize();
+  this->Bricks.clear();
+  this->ImageToWorldMatrix->Identity();
+  this->Extent[0] = 0;
+  this->Extent[1] = -1;
+  this->Extent[2] = 0;
+  this->Extent[3] = -1;
+  this->Extent[4] = 0;
+  this->Extent[5] = -1;
+  this->ScalarType = VTK_VOID;
+}
+
+//----------------------------------------------------------------------------
+void vtkChunkedBinaryLabelmap::DeepCopy(vtkDataObject* src)
+{
+  this->Superclass::DeepCopy(src);
+
+  vtkChunkedBinaryLabelmap* srcLabelmap = vtkChunkedBinaryLabelmap::SafeDownCast(src);
+  if (!srcLabelmap)
+    {
+    return;
+    }
+
+  this->ImageToWorldMatrix->DeepCopy(srcLabelmap->ImageToWorldMatrix);
+  for (int i = 0; i < 6; ++i)
+    {
+    this->Extent[i] = srcLabelmap->Extent[i];
+    }
+  this->ScalarType = srcLabelmap->ScalarType;
+  this->BrickSize = srcLabelmap->BrickSize;
+
+  this->Bricks.clear();
+  BrickMapType::iterator brickIt;
+  for (brickIt = srcLabelmap->Bricks.begin(); brickIt != srcLabelmap->Bricks.end(); ++brickIt)
+    {
+    BrickType brick;
+    brick.Image = vtkSmartPointer<vtkImageData>::New();
+    brick.Image->DeepCopy(brickIt->second.Image);
+    brick.ScalarRange[0] = brickIt->second.ScalarRange[0];
+    brick.ScalarRange[1] = brickIt->second.ScalarRange[1];
+    this->Bricks[brickIt->first] = brick;
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkChunkedBinaryLabelmap::GetImageToWorldMatrix(vtkMatrix4x4* mat)
+{
+  if (!mat)
+    {
+    return;
+    }
+  mat->DeepCopy(this->ImageToWorldMatrix);
+}
+
+//----------------------------------------------------------------------------
+void vtkChunkedBinaryLabelmap::SetImageToWorldMatrix(vtkMatrix4x4* mat)
+{
+  if (!mat)
+    {
+    return;
+    }
+  this->ImageToWorldMatrix->DeepCopy(mat);
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+bool vtkChunkedBinaryLabelmap::ImportFromImage(vtkOrientedImageData* image)
+{
+  if (!image || !image->GetPointData() || !image->GetPointData()->GetScalars())
+    {
+    vtkErrorMacro("ImportFromImage: Invalid source image");
+    return false;
+    }
+  if (image->GetNumberOfScalarComponents() != 1)
+    {
+    vtkErrorMacro("ImportFromImage: Only single-component labelmaps are supported");
+    return false;
+    }
+
+  this->Bricks.clear();
+  image->GetImageToWorldMatrix(this->ImageToWorldMatrix);
+  image->GetExtent(this->Extent);
+  this->ScalarType = image->GetScalarType();
+
+  // Number of bricks along each axis (the last brick of an axis may be
+  // smaller than BrickSize)
+  long long numberOfBricks[3] = {0, 0, 0};
+  for (int axis = 0; axis < 3; ++axis)
+    {
+    int dimension = this->Extent[2 * axis + 1] - this->Extent[2 * axis] + 1;
+    if (dimension <= 0)
+      {
+      // empty labelmap: keep the geometry, allocate nothing
+      this->Modified();
+      return true;
+      }
+    numberOfBricks[axis] = (dimension + this->BrickSize - 1) / this->BrickSize;
+    }
+
+  for (long long bk = 0; bk < numberOfBricks[2]; ++bk)
+    {
+    for (long long bj = 0; bj < numberOfBricks[1]; ++bj)
+      {
+      for (long long bi = 0; bi < numberOfBricks[0]; ++bi)
+        {
+        int region[6];
+        long long brickIndexPerAxis[3] = {bi, bj, bk};
+        for (int axis = 0; axis < 3; ++axis)
+          {
+          region[2 * axis] = this->Extent[2 * axis]
+            + static_cast<int>(brickIndexPerAxis[axis]) * this->BrickSize;
+          region[2 * axis + 1] = region[2 * axis] + this->BrickSize - 1;
+          if (region[2 * axis + 1] > this->Extent[2 * axis + 1])
+            {
+            region[2 * axis + 1] = this->Extent[2 * axis + 1];
+            }
+          }
+
+        double range[2] = {0.0, 0.0};
+        switch (this->ScalarType)
+          {
+          vtkTemplateMacro(ComputeRegionScalarRange<VTK_TT>(image, region, range));
+          default:
+            vtkErrorMacro("ImportFromImage: Unsupported scalar type " << this->ScalarType);
+            return false;
+          }
+        if (range[1] <= 0.0)
+          {
+          // background-only brick, do not allocate it
+          continue;
+          }
+
+        BrickType brick;
+        brick.Image = vtkSmartPointer<vtkImageData>::New();
+        brick.Image->SetExtent(region);
+        brick.Image->AllocateScalars(this->ScalarType, 1);
+        CopyRegionVoxels(image, brick.Image, region);
+        brick.ScalarRange[0] = range[0];
+        brick.ScalarRange[1] = range[1];
+
+        long long brickIndex = (bk * numberOfBricks[1] + bj) * numberOfBricks[0] + bi;
+        this->Bricks[brickIndex] = brick;
+        }
+      }
+    }
+
+  this->Modified();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkChunkedBinaryLabelmap::ExportToImage(vtkOrientedImageData* image)
+{
+  if (!image)
+    {
+    vtkErrorMacro("ExportToImage: Invalid target image");
+    return false;
+    }
+  if (this->ScalarType == VTK_VOID)
+    {
+    vtkErrorMacro("ExportToImage: Chunked labelmap does not contain geometry");
+    return false;
+    }
+
+  image->SetImageToWorldMatrix(this->ImageToWorldMatrix);
+  image->SetExtent(this->Extent);
+  image->AllocateScalars(this->ScalarType, 1);
+
+  // Start from an all-background image and paste the allocated bricks in
+  void* imageVoxelsPointer = image->GetScalarPointerForExtent(this->Extent);
+  if (imageVoxelsPointer)
+    {
+    vtkIdType imageSizeInBytes = image->GetPointData()->GetScalars()->GetNumberOfTuples()
+      * image->GetScalarSize();
+    memset(imageVoxelsPointer, 0, imageSizeInBytes);
+    }
+
+  BrickMapType::iterator brickIt;
+  for (brickIt = this->Bricks.begin(); brickIt != this->Bricks.end(); ++brickIt)
+    {
+    int region[6];
+    brickIt->second.Image->GetExtent(region);
+    CopyRegionVoxels(brickIt->second.Image, image, region);
+    }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+int vtkChunkedBinaryLabelmap::GetNumberOfBricks()
+{
+  return static_cast<int>(this->Bricks.size());
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkChunkedBinaryLabelmap::GetActualMemorySize()
+{
+  unsigned long memorySizeInKilobytes = 0;
+  BrickMapType::iterator brickIt;
+  for (brickIt = this->Bricks.begin(); brickIt != this->Bricks.end(); ++brickIt)
+    {
+    memorySizeInKilobytes += brickIt->second.Image->GetActualMemorySize();
+    }
+  return memorySizeInKilobytes;
+}
+
+//----------------------------------------------------------------------------
+void vtkChunkedBinaryLabelmap::GetScalarRange(double range[2])
+{
+  range[0] = 0.0;
+  range[1] = 0.0;
+  BrickMapType::iterator brickIt;
+  for (brickIt = this->Bricks.begin(); brickIt != this->Bricks.end(); ++brickIt)
+    {
+    if (brickIt == this->Bricks.begin())
+      {
+      range[0] = brickIt->second.ScalarRange[0];
+      range[1] = brickIt->second.ScalarRange[1];
+      continue;
+      }
+    if (brickIt->second.ScalarRange[0] < range[0])
+      {
+      range[0] = brickIt->second.ScalarRange[0];
+      }
+    if (brickIt->second.ScalarRange[1] > range[1])
+      {
+      range[1] = brickIt->second.ScalarRange[1];
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+bool vtkChunkedBinaryLabelmap::IsEmpty()
+{
+  return this->Bricks.empty();
+}
+
+//----------------------------------------------------------------------------
+void vtkChunkedBinaryLabelmap::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Extent: (" << this->Extent[0] << ", " << this->Extent[1] << ", "
+     << this->Extent[2] << ", " << this->Extent[3] << ", "
+     << this->Extent[4] << ", " << this->Extent[5] << ")\n";
+  os << indent << "ScalarType: " << this->ScalarType << "\n";
+  os << indent << "BrickSize: " << this->BrickSize << "\n";
+  os << indent << "NumberOfBricks: " << this->GetNumberOfBricks() << "\n";
+  os << indent << "ImageToWorldMatrix:\n";
+  this->ImageToWorldMatrix->PrintSelf(os, indent.GetNextIndent());
+}
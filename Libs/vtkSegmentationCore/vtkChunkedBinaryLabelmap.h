@@ -0,0 +1,140 @@
+/*==============================================================================
+
+  Copyright (c) Laboratory for Percutaneous Surgery (PerkLab)
+  Queen's University, Kingston, ON, Canada. All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+#ifndef __vtkChunkedBinaryLabelmap_h
+#define __vtkChunkedBinaryLabelmap_h
+
+// Segmentation includes
+#include "vtkSegmentationCoreConfigure.h"
+
+// VTK includes
+#include <vtkDataObject.h>
+#include <vtkSmartPointer.h>
+
+// STD includes
+#include <map>
+
+class vtkImageData;
+class vtkMatrix4x4;
+class vtkOrientedImageData;
+
+/// \ingroup SegmentationCore
+/// \brief Sparse chunked storage of a binary labelmap
+///
+/// Stores a binary labelmap as fixed-size bricks that are only allocated
+/// where the segment contains foreground voxels (values > 0 are foreground,
+/// following the convention of the binary labelmap representation). Memory
+/// consumption therefore scales with the occupied volume of the segment
+/// instead of its full bounding box, which makes whole-body segmentations
+/// with many segments feasible.
+///
+/// Each allocated brick carries its scalar range, so algorithms walking the
+/// bricks can cull uniform regions without touching the voxels.
+///
+/// The image geometry (orientation, spacing, origin, extent, scalar type)
+/// mirrors the vtkOrientedImageData the chunked labelmap was built from, so
+/// the dense representation can be reconstructed exactly.
+class vtkSegmentationCore_EXPORT vtkChunkedBinaryLabelmap : public vtkDataObject
+{
+public:
+  /// Brick of allocated voxels and the scalar range found inside it
+  struct BrickType
+    {
+    vtkSmartPointer<vtkImageData> Image;
+    double ScalarRange[2];
+    };
+  /// Maps the linearized brick index to the allocated brick
+  typedef std::map<long long, BrickType> BrickMapType;
+
+public:
+  static vtkChunkedBinaryLabelmap *New();
+  vtkTypeMacro(vtkChunkedBinaryLabelmap, vtkDataObject);
+  virtual void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  /// Remove all bricks and reset the geometry
+  virtual void Initialize() VTK_OVERRIDE;
+
+  /// Deep copy another chunked labelmap
+  virtual void DeepCopy(vtkDataObject* src) VTK_OVERRIDE;
+
+  /// Edge length of the bricks in voxels. Only takes effect on the next
+  /// \sa ImportFromImage call; already allocated bricks keep their size.
+  vtkSetClampMacro(BrickSize, int, 8, 256);
+  vtkGetMacro(BrickSize, int);
+
+  /// Get the geometry matrix that includes directions, spacing, and origin
+  void GetImageToWorldMatrix(vtkMatrix4x4* mat);
+  /// Set directions, spacing, and origin from a matrix
+  void SetImageToWorldMatrix(vtkMatrix4x4* mat);
+
+  /// Extent of the dense labelmap the bricks were carved from
+  vtkGetVector6Macro(Extent, int);
+  vtkSetVector6Macro(Extent, int);
+
+  /// Scalar type of the stored voxels (VTK_UNSIGNED_CHAR, VTK_SHORT, ...)
+  vtkGetMacro(ScalarType, int);
+
+  /// Build the bricks from a dense binary labelmap. Bricks that contain
+  /// no foreground voxel (maximum value <= 0) are not allocated.
+  /// Existing bricks are discarded first.
+  /// \return Success flag. Fails if the image has no data or more than
+  ///   one scalar component.
+  bool ImportFromImage(vtkOrientedImageData* image);
+
+  /// Reconstruct the dense binary labelmap. The image is allocated to the
+  /// stored extent and geometry; voxels not covered by any brick are set
+  /// to the background value 0.
+  /// \return Success flag. Fails if the chunked labelmap has no geometry.
+  bool ExportToImage(vtkOrientedImageData* image);
+
+  /// Number of allocated bricks
+  int GetNumberOfBricks();
+
+  /// Memory occupied by the allocated bricks in kilobytes
+  unsigned long GetActualMemorySize();
+
+  /// Scalar range over all allocated bricks. Returns [0,0] when empty.
+  void GetScalarRange(double range[2]);
+
+  /// Determines whether the labelmap contains any foreground brick
+  bool IsEmpty();
+
+  /// Direct access to the bricks for algorithms that want to walk or cull
+  /// them (e.g. conversion rules, editing effects)
+  BrickMapType& GetBricks() { return this->Bricks; };
+
+protected:
+  vtkChunkedBinaryLabelmap();
+  ~vtkChunkedBinaryLabelmap();
+
+protected:
+  /// Geometry of the dense labelmap (directions, spacing, origin)
+  vtkMatrix4x4* ImageToWorldMatrix;
+  /// Extent of the dense labelmap
+  int Extent[6];
+  /// Scalar type of the stored voxels
+  int ScalarType;
+  /// Edge length of the bricks in voxels
+  int BrickSize;
+  /// Allocated bricks by linearized brick index
+  BrickMapType Bricks;
+
+private:
+  vtkChunkedBinaryLabelmap(const vtkChunkedBinaryLabelmap&); // Not implemented.
+  void operator=(const vtkChunkedBinaryLabelmap&); // Not implemented.
+};
+
+#endif // __vtkChunkedBinaryLabelmap_h
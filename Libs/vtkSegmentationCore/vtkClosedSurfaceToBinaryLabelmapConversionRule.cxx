@@ -243,15 +243,18 @@ bool vtkClosedSurfaceToBinaryLabelmapConversionRule::CalculateOutputGeometry(vtk
     return false;
     }
 
-  // Get reference image geometry from parameters
+  // Get reference image geometry from parameters.
+  // Only the geometry (matrix and extent) is needed here; scalars are not
+  // allocated, as allocating the full reference grid for each segment just to
+  // replace its extent below would create large throwaway buffers.
   std::string geometryString = this->ConversionParameters[vtkSegmentationConverter::GetReferenceImageGeometryParameterName()].first;
-  if (geometryString.empty() || !vtkSegmentationConverter::DeserializeImageGeometry(geometryString, geometryImageData))
+  if (geometryString.empty() || !vtkSegmentationConverter::DeserializeImageGeometry(geometryString, geometryImageData, false /* do not allocate scalars */))
     {
     vtkInfoMacro("CalculateOutputGeometry: No image geometry specified, default geometry is calculated with 1 mm spacing");
     geometryString = this->GetDefaultImageGeometryStringForPolyData(closedSurfacePolyData);
 
     // If still not valid then return with error
-    if (!vtkSegmentationConverter::DeserializeImageGeometry(geometryString, geometryImageData))
+    if (!vtkSegmentationConverter::DeserializeImageGeometry(geometryString, geometryImageData, false /* do not allocate scalars */))
       {
       vtkErrorMacro("CalculateOutputGeometry: Failed to get reference image geometry");
       return false;
@@ -356,7 +359,10 @@ bool vtkClosedSurfaceToBinaryLabelmapConversionRule::CalculateOutputGeometry(vtk
     // Set effective extent to be just large enough to contain the full surface
     geometryImageData->SetExtent(surfaceExtent);
     }
-  geometryImageData->AllocateScalars(geometryImageData->GetScalarType(), geometryImageData->GetNumberOfScalarComponents());
+
+  // Scalars are not allocated here. Each conversion rule allocates the voxel
+  // buffer for the final output extent itself (or copies the filter output
+  // into it), so an allocation at this point would be overwritten anyway.
 
   return true;
 }
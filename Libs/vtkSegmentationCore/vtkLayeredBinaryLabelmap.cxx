@@ -0,0 +1,392 @@
+/*==============================================================================
+
+  Copyright (c) Laboratory for Percutaneous Surgery (PerkLab)
+  Queen's University, Kingston, ON, Canada. All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+// SegmentationCore includes
+#include "vtkLayeredBinaryLabelmap.h"
+
+#include "vtkOrientedImageData.h"
+#include "vtkOrientedImageDataResample.h"
+#include "vtkSegment.h"
+#include "vtkSegmentation.h"
+#include "vtkSegmentationConverter.h"
+
+// VTK includes
+#include <vtkMatrix4x4.h>
+#include <vtkNew.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+
+// STD includes
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+vtkStandardNewMacro(vtkLayeredBinaryLabelmap);
+
+namespace
+{
+
+//----------------------------------------------------------------------------
+/// Intersection of the extents of a layer and a segment labelmap.
+/// Returns false if they do not intersect.
+bool ComputeCommonExtent(vtkOrientedImageData* layer, vtkOrientedImageData* labelmap, int commonExtent[6])
+{
+  int layerExtent[6] = { 0, -1, 0, -1, 0, -1 };
+  layer->GetExtent(layerExtent);
+  int labelmapExtent[6] = { 0, -1, 0, -1, 0, -1 };
+  labelmap->GetExtent(labelmapExtent);
+  for (int axis = 0; axis < 3; ++axis)
+    {
+    commonExtent[axis * 2] = std::max(layerExtent[axis * 2], labelmapExtent[axis * 2]);
+    commonExtent[axis * 2 + 1] = std::min(layerExtent[axis * 2 + 1], labelmapExtent[axis * 2 + 1]);
+    if (commonExtent[axis * 2] > commonExtent[axis * 2 + 1])
+      {
+      return false;
+      }
+    }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+/// Return true if any foreground voxel of the labelmap falls on an
+/// already labeled voxel of the layer
+template <class LabelmapScalarType>
+bool LayerOverlapsLabelmap(vtkOrientedImageData* layer, vtkOrientedImageData* labelmap,
+  LabelmapScalarType* vtkNotUsed(typeDispatch))
+{
+  int commonExtent[6] = { 0, -1, 0, -1, 0, -1 };
+  if (!ComputeCommonExtent(layer, labelmap, commonExtent))
+    {
+    return false;
+    }
+  int rowLength = commonExtent[1] - commonExtent[0] + 1;
+  for (int z = commonExtent[4]; z <= commonExtent[5]; ++z)
+    {
+    for (int y = commonExtent[2]; y <= commonExtent[3]; ++y)
+      {
+      short* layerRow = static_cast<short*>(layer->GetScalarPointer(commonExtent[0], y, z));
+      LabelmapScalarType* labelmapRow = static_cast<LabelmapScalarType*>(
+        labelmap->GetScalarPointer(commonExtent[0], y, z));
+      for (int x = 0; x < rowLength; ++x)
+        {
+        if (layerRow[x] != 0 && labelmapRow[x] > 0)
+          {
+          return true;
+          }
+        }
+      }
+    }
+  return false;
+}
+
+//----------------------------------------------------------------------------
+/// Write the label value into the layer at every foreground voxel of the
+/// labelmap
+template <class LabelmapScalarType>
+void PaintLabelmapIntoLayer(vtkOrientedImageData* layer, vtkOrientedImageData* labelmap,
+  short labelValue, LabelmapScalarType* vtkNotUsed(typeDispatch))
+{
+  int commonExtent[6] = { 0, -1, 0, -1, 0, -1 };
+  if (!ComputeCommonExtent(layer, labelmap, commonExtent))
+    {
+    return;
+    }
+  int rowLength = commonExtent[1] - commonExtent[0] + 1;
+  for (int z = commonExtent[4]; z <= commonExtent[5]; ++z)
+    {
+    for (int y = commonExtent[2]; y <= commonExtent[3]; ++y)
+      {
+      short* layerRow = static_cast<short*>(layer->GetScalarPointer(commonExtent[0], y, z));
+      LabelmapScalarType* labelmapRow = static_cast<LabelmapScalarType*>(
+        labelmap->GetScalarPointer(commonExtent[0], y, z));
+      for (int x = 0; x < rowLength; ++x)
+        {
+        if (labelmapRow[x] > 0)
+          {
+          layerRow[x] = labelValue;
+          }
+        }
+      }
+    }
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkLayeredBinaryLabelmap::vtkLayeredBinaryLabelmap()
+{
+}
+
+//----------------------------------------------------------------------------
+vtkLayeredBinaryLabelmap::~vtkLayeredBinaryLabelmap()
+{
+}
+
+//----------------------------------------------------------------------------
+void vtkLayeredBinaryLabelmap::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfLayers: " << this->Layers.size() << "\n";
+  os << indent << "NumberOfSegments: " << this->SegmentMap.size() << "\n";
+  for (SegmentMapType::iterator segmentIt = this->SegmentMap.begin();
+       segmentIt != this->SegmentMap.end(); ++segmentIt)
+    {
+    os << indent.GetNextIndent() << segmentIt->first
+       << ": layer " << segmentIt->second.Layer
+       << ", label " << segmentIt->second.LabelValue << "\n";
+    }
+}
+
+//----------------------------------------------------------------------------
+void vtkLayeredBinaryLabelmap::Initialize()
+{
+  this->Superclass::Initialize();
+  this->Layers.clear();
+  this->SegmentMap.clear();
+}
+
+//----------------------------------------------------------------------------
+void vtkLayeredBinaryLabelmap::DeepCopy(vtkDataObject* src)
+{
+  this->Superclass::DeepCopy(src);
+  vtkLayeredBinaryLabelmap* source = vtkLayeredBinaryLabelmap::SafeDownCast(src);
+  if (source == NULL)
+    {
+    return;
+    }
+  this->Layers.clear();
+  for (unsigned int layerIndex = 0; layerIndex < source->Layers.size(); ++layerIndex)
+    {
+    vtkSmartPointer<vtkOrientedImageData> layerCopy = vtkSmartPointer<vtkOrientedImageData>::New();
+    layerCopy->DeepCopy(source->Layers[layerIndex]);
+    this->Layers.push_back(layerCopy);
+    }
+  this->SegmentMap = source->SegmentMap;
+}
+
+//----------------------------------------------------------------------------
+vtkOrientedImageData* vtkLayeredBinaryLabelmap::AddLayer(vtkOrientedImageData* commonGeometryImage)
+{
+  vtkSmartPointer<vtkOrientedImageData> layer = vtkSmartPointer<vtkOrientedImageData>::New();
+  layer->CopyDirections(commonGeometryImage);
+  layer->SetOrigin(commonGeometryImage->GetOrigin());
+  layer->SetSpacing(commonGeometryImage->GetSpacing());
+  layer->SetExtent(commonGeometryImage->GetExtent());
+  layer->AllocateScalars(VTK_SHORT, 1);
+  vtkOrientedImageDataResample::FillImage(layer, 0);
+  this->Layers.push_back(layer);
+  return layer;
+}
+
+//----------------------------------------------------------------------------
+bool vtkLayeredBinaryLabelmap::ImportFromSegmentation(vtkSegmentation* segmentation,
+  int extentComputationMode)
+{
+  this->Initialize();
+
+  if (segmentation == NULL)
+    {
+    vtkErrorMacro("ImportFromSegmentation: Invalid segmentation");
+    return false;
+    }
+  if (!segmentation->ContainsRepresentation(
+        vtkSegmentationConverter::GetSegmentationBinaryLabelmapRepresentationName()))
+    {
+    vtkErrorMacro("ImportFromSegmentation: Segmentation does not contain binary labelmap representation");
+    return false;
+    }
+
+  std::vector<std::string> segmentIds;
+  segmentation->GetSegmentIDs(segmentIds);
+  if (segmentIds.empty())
+    {
+    return true;
+    }
+
+  // Determine the common geometry that all layers share
+  std::string commonGeometryString =
+    segmentation->DetermineCommonLabelmapGeometry(extentComputationMode, segmentIds);
+  if (commonGeometryString.empty())
+    {
+    // Only empty segments in the segmentation
+    return true;
+    }
+  vtkSmartPointer<vtkOrientedImageData> commonGeometryImage = vtkSmartPointer<vtkOrientedImageData>::New();
+  vtkSegmentationConverter::DeserializeImageGeometry(commonGeometryString, commonGeometryImage, false);
+
+  // Sequential label values identify the segments within their layers
+  short labelValue = 0;
+  for (std::vector<std::string>::iterator segmentIdIt = segmentIds.begin();
+       segmentIdIt != segmentIds.end(); ++segmentIdIt)
+    {
+    ++labelValue;
+    vtkSegment* segment = segmentation->GetSegment(*segmentIdIt);
+    if (segment == NULL)
+      {
+      continue;
+      }
+    vtkOrientedImageData* representationBinaryLabelmap = vtkOrientedImageData::SafeDownCast(
+      segment->GetRepresentation(vtkSegmentationConverter::GetSegmentationBinaryLabelmapRepresentationName()));
+    if (representationBinaryLabelmap == NULL || representationBinaryLabelmap->IsEmpty())
+      {
+      continue;
+      }
+
+    // Resample temporarily if the segment does not match the common geometry
+    vtkOrientedImageData* binaryLabelmap = representationBinaryLabelmap;
+    vtkSmartPointer<vtkOrientedImageData> resampledBinaryLabelmap;
+    if (!vtkOrientedImageDataResample::DoGeometriesMatch(commonGeometryImage, representationBinaryLabelmap))
+      {
+      vtkNew<vtkMatrix4x4> commonGeometryMatrix;
+      commonGeometryImage->GetImageToWorldMatrix(commonGeometryMatrix.GetPointer());
+      resampledBinaryLabelmap = vtkSmartPointer<vtkOrientedImageData>::New();
+      if (!vtkOrientedImageDataResample::ResampleOrientedImageToReferenceGeometry(
+            representationBinaryLabelmap, commonGeometryMatrix.GetPointer(), resampledBinaryLabelmap))
+        {
+        continue;
+        }
+      binaryLabelmap = resampledBinaryLabelmap;
+      }
+
+    // Greedy packing: use the first layer the segment does not collide
+    // with, allocate an overflow layer only if it collides with all
+    vtkOrientedImageData* targetLayer = NULL;
+    int targetLayerIndex = 0;
+    for (unsigned int layerIndex = 0; layerIndex < this->Layers.size(); ++layerIndex)
+      {
+      bool overlaps = true;
+      switch (binaryLabelmap->GetScalarType())
+        {
+        vtkTemplateMacro(overlaps = LayerOverlapsLabelmap(
+          this->Layers[layerIndex].GetPointer(), binaryLabelmap, (VTK_TT*)NULL));
+        }
+      if (!overlaps)
+        {
+        targetLayer = this->Layers[layerIndex];
+        targetLayerIndex = (int)layerIndex;
+        break;
+        }
+      }
+    if (targetLayer == NULL)
+      {
+      targetLayer = this->AddLayer(commonGeometryImage);
+      targetLayerIndex = (int)this->Layers.size() - 1;
+      }
+
+    switch (binaryLabelmap->GetScalarType())
+      {
+      vtkTemplateMacro(PaintLabelmapIntoLayer(
+        targetLayer, binaryLabelmap, labelValue, (VTK_TT*)NULL));
+      }
+
+    SegmentLocationType location;
+    location.Layer = targetLayerIndex;
+    location.LabelValue = labelValue;
+    this->SegmentMap[*segmentIdIt] = location;
+    }
+
+  this->Modified();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkLayeredBinaryLabelmap::ExtractSegmentLabelmap(const std::string& segmentId,
+  vtkOrientedImageData* output)
+{
+  if (output == NULL)
+    {
+    vtkErrorMacro("ExtractSegmentLabelmap: Invalid output image");
+    return false;
+    }
+  SegmentMapType::iterator segmentIt = this->SegmentMap.find(segmentId);
+  if (segmentIt == this->SegmentMap.end())
+    {
+    return false;
+    }
+  vtkOrientedImageData* layer = this->Layers[segmentIt->second.Layer];
+  short labelValue = segmentIt->second.LabelValue;
+
+  int extent[6] = { 0, -1, 0, -1, 0, -1 };
+  layer->GetExtent(extent);
+  output->CopyDirections(layer);
+  output->SetOrigin(layer->GetOrigin());
+  output->SetSpacing(layer->GetSpacing());
+  output->SetExtent(extent);
+  output->AllocateScalars(VTK_UNSIGNED_CHAR, 1);
+
+  int rowLength = extent[1] - extent[0] + 1;
+  for (int z = extent[4]; z <= extent[5]; ++z)
+    {
+    for (int y = extent[2]; y <= extent[3]; ++y)
+      {
+      short* layerRow = static_cast<short*>(layer->GetScalarPointer(extent[0], y, z));
+      unsigned char* outputRow = static_cast<unsigned char*>(output->GetScalarPointer(extent[0], y, z));
+      for (int x = 0; x < rowLength; ++x)
+        {
+        outputRow[x] = (layerRow[x] == labelValue ? 1 : 0);
+        }
+      }
+    }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+int vtkLayeredBinaryLabelmap::GetNumberOfLayers()
+{
+  return (int)this->Layers.size();
+}
+
+//----------------------------------------------------------------------------
+vtkOrientedImageData* vtkLayeredBinaryLabelmap::GetLayer(int layerIndex)
+{
+  if (layerIndex < 0 || layerIndex >= (int)this->Layers.size())
+    {
+    return NULL;
+    }
+  return this->Layers[layerIndex];
+}
+
+//----------------------------------------------------------------------------
+int vtkLayeredBinaryLabelmap::GetSegmentLayer(const std::string& segmentId)
+{
+  SegmentMapType::iterator segmentIt = this->SegmentMap.find(segmentId);
+  if (segmentIt == this->SegmentMap.end())
+    {
+    return -1;
+    }
+  return segmentIt->second.Layer;
+}
+
+//----------------------------------------------------------------------------
+short vtkLayeredBinaryLabelmap::GetSegmentLabelValue(const std::string& segmentId)
+{
+  SegmentMapType::iterator segmentIt = this->SegmentMap.find(segmentId);
+  if (segmentIt == this->SegmentMap.end())
+    {
+    return 0;
+    }
+  return segmentIt->second.LabelValue;
+}
+
+//----------------------------------------------------------------------------
+void vtkLayeredBinaryLabelmap::GetSegmentIds(std::vector<std::string>& segmentIds)
+{
+  segmentIds.clear();
+  for (SegmentMapType::iterator segmentIt = this->SegmentMap.begin();
+       segmentIt != this->SegmentMap.end(); ++segmentIt)
+    {
+    segmentIds.push_back(segmentIt->first);
+    }
+}
@@ -0,0 +1,124 @@
+/*==============================================================================
+
+  Copyright (c) Laboratory for Percutaneous Surgery (PerkLab)
+  Queen's University, Kingston, ON, Canada. All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+#ifndef __vtkLayeredBinaryLabelmap_h
+#define __vtkLayeredBinaryLabelmap_h
+
+// Segmentation includes
+#include "vtkSegmentationCoreConfigure.h"
+
+// VTK includes
+#include <vtkDataObject.h>
+#include <vtkSmartPointer.h>
+
+// STD includes
+#include <map>
+#include <string>
+#include <vector>
+
+class vtkOrientedImageData;
+class vtkSegmentation;
+
+/// \ingroup SegmentationCore
+/// \brief Layered labelmap storage of a whole segmentation
+///
+/// Stores the binary labelmaps of all segments of a segmentation in a
+/// small number of shared label volumes. Segments are packed greedily
+/// into the first layer where they do not overlap any voxel that is
+/// already labeled, so a segmentation of non-overlapping segments
+/// collapses into a single allocated volume regardless of the segment
+/// count, and overflow layers are only created where segments actually
+/// overlap.
+///
+/// Each segment is identified inside its layer by a unique label value,
+/// so whole-segmentation operations (statistics, export, masking) can
+/// visit every segment in a single pass over the layers instead of one
+/// pass per segment.
+///
+/// All layers share the common geometry of the segmentation as computed
+/// by vtkSegmentation::DetermineCommonLabelmapGeometry, and individual
+/// segments can be reconstructed as standalone binary labelmaps.
+class vtkSegmentationCore_EXPORT vtkLayeredBinaryLabelmap : public vtkDataObject
+{
+public:
+  static vtkLayeredBinaryLabelmap *New();
+  vtkTypeMacro(vtkLayeredBinaryLabelmap, vtkDataObject);
+  virtual void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  /// Remove all layers and segment assignments
+  virtual void Initialize() VTK_OVERRIDE;
+
+  /// Deep copy another layered labelmap
+  virtual void DeepCopy(vtkDataObject* src) VTK_OVERRIDE;
+
+  /// Build the layers from the binary labelmap representations of the
+  /// given segmentation. Segment labelmaps that do not match the common
+  /// geometry are resampled temporarily. Returns false if the
+  /// segmentation is invalid or does not contain the binary labelmap
+  /// representation.
+  /// \param extentComputationMode Determines how the common extent is
+  ///   computed, see vtkSegmentation::DetermineCommonLabelmapGeometry
+  bool ImportFromSegmentation(vtkSegmentation* segmentation,
+    int extentComputationMode);
+
+  /// Reconstruct the binary labelmap of one segment from its layer.
+  /// The output is an unsigned char image over the common geometry with
+  /// value 1 inside the segment and 0 outside.
+  /// Returns false if the segment is not stored in this object.
+  bool ExtractSegmentLabelmap(const std::string& segmentId, vtkOrientedImageData* output);
+
+  /// Number of allocated layers. Equals 1 when no segments overlap.
+  int GetNumberOfLayers();
+
+  /// Shared label volume of the given layer (VTK_SHORT scalars), or
+  /// NULL if the index is out of range
+  vtkOrientedImageData* GetLayer(int layerIndex);
+
+  /// Index of the layer holding the given segment, or -1 if the segment
+  /// is not stored in this object
+  int GetSegmentLayer(const std::string& segmentId);
+
+  /// Label value identifying the given segment within its layer, or 0
+  /// if the segment is not stored in this object
+  short GetSegmentLabelValue(const std::string& segmentId);
+
+  /// Get the IDs of all stored segments
+  void GetSegmentIds(std::vector<std::string>& segmentIds);
+
+protected:
+  vtkLayeredBinaryLabelmap();
+  ~vtkLayeredBinaryLabelmap();
+
+  /// Where a segment lives: layer index and label value inside the layer
+  struct SegmentLocationType
+    {
+    int Layer;
+    short LabelValue;
+    };
+  typedef std::map<std::string, SegmentLocationType> SegmentMapType;
+
+  /// Allocate a new layer over the common geometry, filled with zeros
+  vtkOrientedImageData* AddLayer(vtkOrientedImageData* commonGeometryImage);
+
+  std::vector< vtkSmartPointer<vtkOrientedImageData> > Layers;
+  SegmentMapType SegmentMap;
+
+private:
+  vtkLayeredBinaryLabelmap(const vtkLayeredBinaryLabelmap&);
+  void operator=(const vtkLayeredBinaryLabelmap&);
+};
+
+#endif // __vtkLayeredBinaryLabelmap_h
@@ -33,6 +33,14 @@ class vtkMatrix4x4;
 ///
 /// This extends vtkImageData to arbitrary grid orientation.
 ///
+/// Voxels are stored in the scanline-linear (X fastest, then Y, then Z)
+/// layout required by the vtkImageData contract: every VTK filter and the
+/// GetScalarPointer/increment accessors compute addresses from that layout,
+/// so an alternative ordering (e.g. a space-filling curve) cannot be used
+/// here. For cache- and memory-friendly access to sparse segments, convert
+/// to the bricked representation instead
+/// (\sa vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule).
+///
 class vtkSegmentationCore_EXPORT vtkOrientedImageData : public vtkImageData
 {
 public:
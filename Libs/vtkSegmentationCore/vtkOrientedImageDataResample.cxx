@@ -30,6 +30,7 @@
 #include <vtkImageReslice.h>
 #include <vtkImageConstantPad.h>
 #include <vtkMatrix4x4.h>
+#include <vtkMultiThreader.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
 #include <vtkPlaneSource.h>
@@ -46,43 +47,53 @@
 vtkStandardNewMacro(vtkOrientedImageDataResample);
 
 //----------------------------------------------------------------------------
-// This templated function executes the filter for any type of data.
+// Shared state of the threads executing a merge operation. Each thread
+// processes its own contiguous slab of Z slices of the update extent
+// (\sa MergeImageSlabCallback).
 template <class BaseImageScalarType, class ModifierImageScalarType>
-void MergeImageGeneric2(
-    vtkImageData *baseImage,
-    vtkImageData *modifierImage,
-    int operation,
-    const int extent[6],
-    double maskThreshold,
-    double fillValue)
+struct MergeImageJob
 {
-  // Compute update extent as intersection of base and modifier image extents (extent can be further reduced by specifying a smaller extent)
-  int updateExt[6] = { 0, -1, 0, -1, 0, -1 };
-  baseImage->GetExtent(updateExt);
-  int* modifierExt = modifierImage->GetExtent();
-  for (int idx = 0; idx < 3; ++idx)
+  vtkImageData* BaseImage;
+  vtkImageData* ModifierImage;
+  int UpdateExtent[6];
+  int Operation;
+  BaseImageScalarType FillValue;
+  ModifierImageScalarType MaskThreshold;
+  bool ThreadModifiedImage[VTK_MAX_THREADS];
+};
+
+//----------------------------------------------------------------------------
+// Process one slab of the update extent. The inner loops are written
+// branchless (compute the new value unconditionally, accumulate a change
+// flag with bitwise or) so compilers can vectorize the contiguous rows
+// with SSE/AVX instructions; the conditional store of the original
+// implementation prevented that.
+template <class BaseImageScalarType, class ModifierImageScalarType>
+VTK_THREAD_RETURN_TYPE MergeImageSlabCallback(void* arg)
+{
+  vtkMultiThreader::ThreadInfo* info = static_cast<vtkMultiThreader::ThreadInfo*>(arg);
+  MergeImageJob<BaseImageScalarType, ModifierImageScalarType>* job =
+    static_cast<MergeImageJob<BaseImageScalarType, ModifierImageScalarType>*>(info->UserData);
+  int threadId = info->ThreadID;
+  int threadCount = info->NumberOfThreads;
+
+  // Distribute the Z slices of the update extent over the threads
+  int slabExt[6] = { 0, -1, 0, -1, 0, -1 };
+  for (int idx = 0; idx < 6; ++idx)
     {
-    if (modifierExt[idx * 2] > updateExt[idx * 2])
-      {
-      updateExt[idx * 2] = modifierExt[idx * 2];
-      }
-    if (extent && extent[idx * 2] > updateExt[idx * 2])
-      {
-      updateExt[idx * 2] = extent[idx * 2];
-      }
-    if (modifierExt[idx * 2 + 1] < updateExt[idx * 2 + 1])
-      {
-      updateExt[idx * 2 + 1] = modifierExt[idx * 2 + 1];
-      }
-    if (extent && extent[idx * 2 + 1] < updateExt[idx * 2 + 1])
-      {
-      updateExt[idx * 2 + 1] = extent[idx * 2 + 1];
-      }
+    slabExt[idx] = job->UpdateExtent[idx];
     }
-  if (updateExt[0] > updateExt[1] || updateExt[2] > updateExt[3] || updateExt[4] > updateExt[5])
+  int numberOfSlices = job->UpdateExtent[5] - job->UpdateExtent[4] + 1;
+  int slicesPerThread = (numberOfSlices + threadCount - 1) / threadCount;
+  slabExt[4] = job->UpdateExtent[4] + threadId * slicesPerThread;
+  slabExt[5] = slabExt[4] + slicesPerThread - 1;
+  if (slabExt[5] > job->UpdateExtent[5])
     {
-    // base and modifier images don't intersect, nothing need to be done
-    return;
+    slabExt[5] = job->UpdateExtent[5];
+    }
+  if (slabExt[4] > slabExt[5])
+    {
+    return VTK_THREAD_RETURN_VALUE;
     }
 
   // Get increments to march through data
@@ -92,133 +103,214 @@ void MergeImageGeneric2(
   vtkIdType modifierIncX = 0;
   vtkIdType modifierIncY = 0;
   vtkIdType modifierIncZ = 0;
-  baseImage->GetContinuousIncrements(updateExt, baseIncX, baseIncY, baseIncZ);
-  modifierImage->GetContinuousIncrements(updateExt, modifierIncX, modifierIncY, modifierIncZ);
-  int maxX = (updateExt[1] - updateExt[0]) * baseImage->GetNumberOfScalarComponents();
-  int maxY = updateExt[3] - updateExt[2];
-  int maxZ = updateExt[5] - updateExt[4];
-  BaseImageScalarType* baseImagePtr = static_cast<BaseImageScalarType*>(baseImage->GetScalarPointerForExtent(updateExt));
-  ModifierImageScalarType* modifierImagePtr = static_cast<ModifierImageScalarType*>(modifierImage->GetScalarPointerForExtent(updateExt));
-
-  if (baseImagePtr == NULL)
-    {
-    vtkGenericWarningMacro("vtkOrientedImageDataResample::MergeImageGeneric: Base image pointer is invalid");
-    return;
-    }
-  if (modifierImagePtr == NULL)
-    {
-    vtkGenericWarningMacro("vtkOrientedImageDataResample::MergeImageGeneric: Modifier image pointer is invalid");
-    return;
-    }
+  job->BaseImage->GetContinuousIncrements(slabExt, baseIncX, baseIncY, baseIncZ);
+  job->ModifierImage->GetContinuousIncrements(slabExt, modifierIncX, modifierIncY, modifierIncZ);
+  int maxX = (slabExt[1] - slabExt[0]) * job->BaseImage->GetNumberOfScalarComponents();
+  int maxY = slabExt[3] - slabExt[2];
+  int maxZ = slabExt[5] - slabExt[4];
+  BaseImageScalarType* baseImagePtr =
+    static_cast<BaseImageScalarType*>(job->BaseImage->GetScalarPointerForExtent(slabExt));
+  ModifierImageScalarType* modifierImagePtr =
+    static_cast<ModifierImageScalarType*>(job->ModifierImage->GetScalarPointerForExtent(slabExt));
 
   bool baseImageModified = false;
 
-  // Loop through output pixels
   // There is difference in only one line between min/max computation but the comparison
   // is performed for each pixel, so it is faster to make the conditional expression in the outer loop.
-  // Looping is performed in two step: first we just check if any of the pixels have to be changed,
-  // if we find any, then we set baseImageModified flag and to the second loop without need to set
-  // baseImageModified flag again (setting a flag in a hot loop may impact speed).
-  if (operation == vtkOrientedImageDataResample::OPERATION_MAXIMUM)
+  if (job->Operation == vtkOrientedImageDataResample::OPERATION_MAXIMUM)
     {
     for (vtkIdType idxZ = 0; idxZ <= maxZ; idxZ++)
       {
       for (vtkIdType idxY = 0; idxY <= maxY; idxY++)
         {
+        bool rowModified = false;
         for (vtkIdType idxX = 0; idxX <= maxX; idxX++)
           {
-          if (static_cast<BaseImageScalarType>(*modifierImagePtr) > *baseImagePtr)
-            {
-            *baseImagePtr = *modifierImagePtr;
-            baseImageModified = true;
-            }
-          baseImagePtr++;
-          modifierImagePtr++;
+          BaseImageScalarType baseValue = baseImagePtr[idxX];
+          BaseImageScalarType modifierValue = static_cast<BaseImageScalarType>(modifierImagePtr[idxX]);
+          BaseImageScalarType newValue = (modifierValue > baseValue) ? modifierValue : baseValue;
+          rowModified |= (newValue != baseValue);
+          baseImagePtr[idxX] = newValue;
           }
-        baseImagePtr += baseIncY;
-        modifierImagePtr += modifierIncY;
+        baseImageModified |= rowModified;
+        baseImagePtr += maxX + 1 + baseIncY;
+        modifierImagePtr += maxX + 1 + modifierIncY;
         }
       baseImagePtr += baseIncZ;
       modifierImagePtr += modifierIncZ;
       }
     }
-  else if (operation == vtkOrientedImageDataResample::OPERATION_MINIMUM)
+  else if (job->Operation == vtkOrientedImageDataResample::OPERATION_MINIMUM)
     {
     for (vtkIdType idxZ = 0; idxZ <= maxZ; idxZ++)
       {
       for (vtkIdType idxY = 0; idxY <= maxY; idxY++)
         {
+        bool rowModified = false;
         for (vtkIdType idxX = 0; idxX <= maxX; idxX++)
           {
-          if (static_cast<BaseImageScalarType>(*modifierImagePtr) < *baseImagePtr)
-            {
-            *baseImagePtr = *modifierImagePtr;
-            baseImageModified = true;
-            }
-          baseImagePtr++;
-          modifierImagePtr++;
+          BaseImageScalarType baseValue = baseImagePtr[idxX];
+          BaseImageScalarType modifierValue = static_cast<BaseImageScalarType>(modifierImagePtr[idxX]);
+          BaseImageScalarType newValue = (modifierValue < baseValue) ? modifierValue : baseValue;
+          rowModified |= (newValue != baseValue);
+          baseImagePtr[idxX] = newValue;
           }
-        baseImagePtr += baseIncY;
-        modifierImagePtr += modifierIncY;
+        baseImageModified |= rowModified;
+        baseImagePtr += maxX + 1 + baseIncY;
+        modifierImagePtr += maxX + 1 + modifierIncY;
         }
       baseImagePtr += baseIncZ;
       modifierImagePtr += modifierIncZ;
       }
     }
-  else if (operation == vtkOrientedImageDataResample::OPERATION_MASKING)
+  else if (job->Operation == vtkOrientedImageDataResample::OPERATION_MASKING)
     {
-
-    // Make sure the fill value is valid for the base image scalar range
-    BaseImageScalarType fillValueBaseImageType = 0;
-    if (fillValue < baseImage->GetScalarTypeMin())
-      {
-      fillValueBaseImageType = static_cast<BaseImageScalarType>(baseImage->GetScalarTypeMin());
-      }
-    else if (fillValue > baseImage->GetScalarTypeMax())
-      {
-      fillValueBaseImageType = static_cast<BaseImageScalarType>(baseImage->GetScalarTypeMax());
-      }
-    else
+    BaseImageScalarType fillValue = job->FillValue;
+    ModifierImageScalarType maskThreshold = job->MaskThreshold;
+    for (vtkIdType idxZ = 0; idxZ <= maxZ; idxZ++)
       {
-      fillValueBaseImageType = static_cast<BaseImageScalarType>(fillValue);
+      for (vtkIdType idxY = 0; idxY <= maxY; idxY++)
+        {
+        bool rowModified = false;
+        for (vtkIdType idxX = 0; idxX <= maxX; idxX++)
+          {
+          BaseImageScalarType baseValue = baseImagePtr[idxX];
+          BaseImageScalarType newValue =
+            (modifierImagePtr[idxX] > maskThreshold) ? fillValue : baseValue;
+          rowModified |= (newValue != baseValue);
+          baseImagePtr[idxX] = newValue;
+          }
+        baseImageModified |= rowModified;
+        baseImagePtr += maxX + 1 + baseIncY;
+        modifierImagePtr += maxX + 1 + modifierIncY;
+        }
+      baseImagePtr += baseIncZ;
+      modifierImagePtr += modifierIncZ;
       }
+    }
 
-    // Make sure the threshold is valid for the modifier scalar range
-    ModifierImageScalarType maskThresholdModifierType = 0;
-    if (maskThreshold < modifierImage->GetScalarTypeMin())
+  job->ThreadModifiedImage[threadId] = baseImageModified;
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+// This templated function executes the filter for any type of data.
+template <class BaseImageScalarType, class ModifierImageScalarType>
+void MergeImageGeneric2(
+    vtkImageData *baseImage,
+    vtkImageData *modifierImage,
+    int operation,
+    const int extent[6],
+    double maskThreshold,
+    double fillValue)
+{
+  // Compute update extent as intersection of base and modifier image extents (extent can be further reduced by specifying a smaller extent)
+  int updateExt[6] = { 0, -1, 0, -1, 0, -1 };
+  baseImage->GetExtent(updateExt);
+  int* modifierExt = modifierImage->GetExtent();
+  for (int idx = 0; idx < 3; ++idx)
+    {
+    if (modifierExt[idx * 2] > updateExt[idx * 2])
       {
-      maskThresholdModifierType = static_cast<ModifierImageScalarType>(modifierImage->GetScalarTypeMin());
+      updateExt[idx * 2] = modifierExt[idx * 2];
       }
-    else if (maskThreshold > modifierImage->GetScalarTypeMax())
+    if (extent && extent[idx * 2] > updateExt[idx * 2])
       {
-      maskThresholdModifierType = static_cast<ModifierImageScalarType>(modifierImage->GetScalarTypeMax());
+      updateExt[idx * 2] = extent[idx * 2];
       }
-    else
+    if (modifierExt[idx * 2 + 1] < updateExt[idx * 2 + 1])
       {
-      maskThresholdModifierType = static_cast<ModifierImageScalarType>(maskThreshold);
+      updateExt[idx * 2 + 1] = modifierExt[idx * 2 + 1];
       }
-
-    for (vtkIdType idxZ = 0; idxZ <= maxZ; idxZ++)
+    if (extent && extent[idx * 2 + 1] < updateExt[idx * 2 + 1])
       {
-      for (vtkIdType idxY = 0; idxY <= maxY; idxY++)
-        {
-        for (vtkIdType idxX = 0; idxX <= maxX; idxX++)
-          {
-          if ((*modifierImagePtr) > maskThresholdModifierType)
-            {
-            *baseImagePtr = fillValueBaseImageType;
-            baseImageModified = true;
-            }
-          baseImagePtr++;
-          modifierImagePtr++;
-        }
-        baseImagePtr += baseIncY;
-        modifierImagePtr += modifierIncY;
-        }
-      baseImagePtr += baseIncZ;
-      modifierImagePtr += modifierIncZ;
+      updateExt[idx * 2 + 1] = extent[idx * 2 + 1];
       }
     }
+  if (updateExt[0] > updateExt[1] || updateExt[2] > updateExt[3] || updateExt[4] > updateExt[5])
+    {
+    // base and modifier images don't intersect, nothing need to be done
+    return;
+    }
+
+  if (baseImage->GetScalarPointerForExtent(updateExt) == NULL)
+    {
+    vtkGenericWarningMacro("vtkOrientedImageDataResample::MergeImageGeneric: Base image pointer is invalid");
+    return;
+    }
+  if (modifierImage->GetScalarPointerForExtent(updateExt) == NULL)
+    {
+    vtkGenericWarningMacro("vtkOrientedImageDataResample::MergeImageGeneric: Modifier image pointer is invalid");
+    return;
+    }
+
+  MergeImageJob<BaseImageScalarType, ModifierImageScalarType> job;
+  job.BaseImage = baseImage;
+  job.ModifierImage = modifierImage;
+  for (int idx = 0; idx < 6; ++idx)
+    {
+    job.UpdateExtent[idx] = updateExt[idx];
+    }
+  job.Operation = operation;
+  for (int threadId = 0; threadId < VTK_MAX_THREADS; ++threadId)
+    {
+    job.ThreadModifiedImage[threadId] = false;
+    }
+
+  // Make sure the fill value is valid for the base image scalar range
+  if (fillValue < baseImage->GetScalarTypeMin())
+    {
+    job.FillValue = static_cast<BaseImageScalarType>(baseImage->GetScalarTypeMin());
+    }
+  else if (fillValue > baseImage->GetScalarTypeMax())
+    {
+    job.FillValue = static_cast<BaseImageScalarType>(baseImage->GetScalarTypeMax());
+    }
+  else
+    {
+    job.FillValue = static_cast<BaseImageScalarType>(fillValue);
+    }
+
+  // Make sure the threshold is valid for the modifier scalar range
+  if (maskThreshold < modifierImage->GetScalarTypeMin())
+    {
+    job.MaskThreshold = static_cast<ModifierImageScalarType>(modifierImage->GetScalarTypeMin());
+    }
+  else if (maskThreshold > modifierImage->GetScalarTypeMax())
+    {
+    job.MaskThreshold = static_cast<ModifierImageScalarType>(modifierImage->GetScalarTypeMax());
+    }
+  else
+    {
+    job.MaskThreshold = static_cast<ModifierImageScalarType>(maskThreshold);
+    }
+
+  // Split the work over the Z slices; small images are not worth the
+  // thread startup overhead and are processed on the calling thread
+  int numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
+  int numberOfSlices = updateExt[5] - updateExt[4] + 1;
+  if (numberOfThreads > numberOfSlices)
+    {
+    numberOfThreads = numberOfSlices;
+    }
+  long long numberOfVoxels = static_cast<long long>(updateExt[1] - updateExt[0] + 1)
+    * (updateExt[3] - updateExt[2] + 1) * numberOfSlices;
+  const long long minimumVoxelsForThreading = 1 << 20;
+  if (numberOfVoxels < minimumVoxelsForThreading)
+    {
+    numberOfThreads = 1;
+    }
+
+  vtkNew<vtkMultiThreader> threader;
+  threader->SetNumberOfThreads(numberOfThreads);
+  threader->SetSingleMethod(MergeImageSlabCallback<BaseImageScalarType, ModifierImageScalarType>, &job);
+  threader->SingleMethodExecute();
+
+  bool baseImageModified = false;
+  for (int threadId = 0; threadId < VTK_MAX_THREADS; ++threadId)
+    {
+    baseImageModified |= job.ThreadModifiedImage[threadId];
+    }
   if (baseImageModified)
     {
     baseImage->Modified();
@@ -373,9 +465,74 @@ bool vtkOrientedImageDataResample::ResampleOrientedImageToReferenceOrientedImage
     return false;
     }
 
-  // Invert transform for the resampling
-  vtkAbstractTransform* referenceImageToInputImageTransform = inputImageToReferenceImageTransform->GetInverse();
-  referenceImageToInputImageTransform->Update();
+  // Invert transform for the resampling. The reslicer evaluates a
+  // general transform voxel by voxel, while with a plain matrix it runs
+  // its optimized threaded code paths (which also recognize identity
+  // and axis-permutation matrices), so collapse the chain to a single
+  // matrix whenever the input transform is linear.
+  vtkAbstractTransform* referenceImageToInputImageTransform = NULL;
+  vtkSmartPointer<vtkTransform> linearReferenceImageToInputImageTransform;
+  vtkNew<vtkTransform> linearInputImageTransform;
+  bool inputTransformIsLinear = (inputImageTransform == NULL
+    || vtkOrientedImageDataResample::IsTransformLinear(inputImageTransform, linearInputImageTransform.GetPointer()));
+
+  // Only reslice the part of the output the input can reach (with a
+  // one voxel safety margin for rounding). Voxels outside of it are
+  // known to be background, so for an input that covers a small part of
+  // the reference (a segment inside a whole volume) most of the output
+  // is produced by a cheap constant pad instead of the resampler.
+  // TransformExtent maps only the corner points of the input extent, so
+  // this is only valid for linear transforms: a warping transform can
+  // map interior voxels outside the bounding box of the transformed
+  // corners. Reslice the full output extent in that case.
+  int resliceExtent[6] = { 0, -1, 0, -1, 0, -1 };
+  if (inputTransformIsLinear)
+    {
+    bool resliceExtentIsEmpty = false;
+    for (int i = 0; i < 3; i++)
+      {
+      resliceExtent[i * 2] = std::max(inputExtentInReferenceFrame[i * 2] - 1, unionExtent[i * 2]);
+      resliceExtent[i * 2 + 1] = std::min(inputExtentInReferenceFrame[i * 2 + 1] + 1, unionExtent[i * 2 + 1]);
+      if (resliceExtent[i * 2] > resliceExtent[i * 2 + 1])
+        {
+        resliceExtentIsEmpty = true;
+        }
+      }
+    if (resliceExtentIsEmpty)
+      {
+      // The input is entirely outside of the reference, the output is all background
+      outputImage->SetExtent(unionExtent);
+      outputImage->AllocateScalars(inputImage->GetScalarType(), inputImage->GetNumberOfScalarComponents());
+      vtkOrientedImageDataResample::FillImage(outputImage, backgroundValue);
+      outputImage->SetImageToWorldMatrix(referenceImageToWorldMatrix.GetPointer());
+      return true;
+      }
+    }
+  else
+    {
+    for (int i = 0; i < 6; i++)
+      {
+      resliceExtent[i] = unionExtent[i];
+      }
+    }
+
+  if (inputTransformIsLinear)
+    {
+    vtkNew<vtkMatrix4x4> inputImageToReferenceImageMatrix;
+    vtkMatrix4x4::Multiply4x4(linearInputImageTransform->GetMatrix(), inputImageToWorldMatrix.GetPointer(),
+      inputImageToReferenceImageMatrix.GetPointer());
+    vtkMatrix4x4::Multiply4x4(worldToReferenceImageMatrix.GetPointer(), inputImageToReferenceImageMatrix.GetPointer(),
+      inputImageToReferenceImageMatrix.GetPointer());
+    inputImageToReferenceImageMatrix->Invert();
+    linearReferenceImageToInputImageTransform = vtkSmartPointer<vtkTransform>::New();
+    linearReferenceImageToInputImageTransform->SetMatrix(inputImageToReferenceImageMatrix.GetPointer());
+    referenceImageToInputImageTransform = linearReferenceImageToInputImageTransform;
+    }
+  else
+    {
+    referenceImageToInputImageTransform = inputImageToReferenceImageTransform->GetInverse();
+    referenceImageToInputImageTransform->Update();
+    }
 
   // Create clone for input image that has an identity geometry
   //TODO: Creating a new vtkOrientedImageReslice class would be a better solution on the long run
@@ -390,7 +547,7 @@ bool vtkOrientedImageDataResample::ResampleOrientedImageToReferenceOrientedImage
   resliceFilter->SetInputData(identityInputImage);
   resliceFilter->SetOutputOrigin(0, 0, 0);
   resliceFilter->SetOutputSpacing(1, 1, 1);
-  resliceFilter->SetOutputExtent(unionExtent);
+  resliceFilter->SetOutputExtent(resliceExtent);
   resliceFilter->SetOutputScalarType(inputImage->GetScalarType());
   resliceFilter->SetBackgroundLevel(backgroundValue);
   resliceFilter->SetResliceTransform(referenceImageToInputImageTransform);
@@ -407,7 +564,22 @@ bool vtkOrientedImageDataResample::ResampleOrientedImageToReferenceOrientedImage
   resliceFilter->Update();
 
   // Set output
-  outputImage->ShallowCopy(resliceFilter->GetOutput());
+  if (resliceExtent[0] > unionExtent[0] || resliceExtent[1] < unionExtent[1]
+    || resliceExtent[2] > unionExtent[2] || resliceExtent[3] < unionExtent[3]
+    || resliceExtent[4] > unionExtent[4] || resliceExtent[5] < unionExtent[5])
+    {
+    // Fill the part of the output that the reslicer did not cover with background
+    vtkSmartPointer<vtkImageConstantPad> padder = vtkSmartPointer<vtkImageConstantPad>::New();
+    padder->SetInputConnection(resliceFilter->GetOutputPort());
+    padder->SetConstant(backgroundValue);
+    padder->SetOutputWholeExtent(unionExtent);
+    padder->Update();
+    outputImage->ShallowCopy(padder->GetOutput());
+    }
+  else
+    {
+    outputImage->ShallowCopy(resliceFilter->GetOutput());
+    }
   outputImage->SetGeometryFromImageToWorldMatrix(referenceImageToWorldMatrix.GetPointer());
 
   return true;
@@ -38,7 +38,6 @@
 #include <vtkTriangleFilter.h>
 #include <vtkStripper.h>
 #include <vtkImageStencil.h>
-#include <vtkImageCast.h>
 
 // std includes
 #include <map>
@@ -454,10 +453,6 @@ int vtkPolyDataToFractionalLabelmapFilter::RequestData(
   imageStencil->ReverseStencilOn();
   imageStencil->SetBackgroundValue(1); // General foreground value is 1 (background value because of reverse stencil)
 
-  vtkNew<vtkImageCast> imageCast;
-  imageCast->SetInputConnection(imageStencil->GetOutputPort());
-  imageCast->SetOutputScalarTypeToUnsignedChar();
-
   // Iterate through "NumberOfOffsets" in each of the dimensions and create a binary labelmap at each offset
   for (int k = 0; k < this->NumberOfOffsets; ++k)
   {
@@ -477,8 +472,10 @@ int vtkPolyDataToFractionalLabelmapFilter::RequestData(
         this->FillImageStencilData(imageStencilData, transformedClosedSurface, extent);
 
         // Save result to output
-        imageCast->Update();
-        this->AddBinaryLabelMapToFractionalLabelMap(imageCast->GetOutput(), outputData);
+        // (the stencil output has the same unsigned char scalar type as the empty
+        // input image, so it can be accumulated directly without a cast pass)
+        imageStencil->Update();
+        this->AddBinaryLabelMapToFractionalLabelMap(imageStencil->GetOutput(), outputData);
 
         this->UpdateProgress(((i+1)*(j+1)*(k+1))/(this->NumberOfOffsets*this->NumberOfOffsets*this->NumberOfOffsets));
 
@@ -562,6 +559,12 @@ void vtkPolyDataToFractionalLabelmapFilter::FillImageStencilData(
   // get the input data
   vtkPolyData *input = closedSurface;
 
+  // Bounding box of the surface in structured coordinates. Slices outside
+  // of it cannot intersect the surface and can be skipped without querying
+  // the cell locator.
+  double inputBounds[6] = {0.0,0.0,0.0,0.0,0.0,0.0};
+  input->GetBounds(inputBounds);
+
   // the output produced by cutting the polydata with the Z plane
   vtkSmartPointer<vtkPolyData> slice;
 
@@ -582,6 +585,14 @@ void vtkPolyDataToFractionalLabelmapFilter::FillImageStencilData(
 
     double z = idxZ*spacing[2] + origin[2];
 
+    // Skip slices that miss the bounding box of the surface; cutting them
+    // would produce no lines, and they would be re-cut on every offset pass
+    // because empty slices are not cached
+    if (z < inputBounds[4] || z > inputBounds[5])
+      {
+      continue;
+      }
+
     raster.PrepareForNewData();
 
     if ( this->SliceCache.count(z) == 0 )
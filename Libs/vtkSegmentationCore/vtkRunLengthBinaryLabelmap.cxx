@@ -0,0 +1,494 @@
+/*==============================================================================
+
+  Copyright (c) Laboratory for Percutaneous Surgery (PerkLab)
+  Queen's University, Kingston, ON, Canada. All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+// SegmentationCore includes
+#include "vtkRunLengthBinaryLabelmap.h"
+
+#include "vtkOrientedImageData.h"
+
+// VTK includes
+#include <vtkMatrix4x4.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+
+// STD includes
+#include <algorithm>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+vtkStandardNewMacro(vtkRunLengthBinaryLabelmap);
+
+namespace
+{
+
+//----------------------------------------------------------------------------
+// Extend a run of equal bytes eight voxels at a time. Broadcasting the run
+// value into a 64-bit word and comparing whole words lets the compiler use
+// wide loads, which gives most of the speed of explicit vector code
+// without tying the build to an instruction set.
+inline vtkIdType ExtendByteRun(const unsigned char* voxels, vtkIdType position,
+                               vtkIdType numberOfVoxels, unsigned char value)
+{
+  vtkTypeUInt64 pattern = value;
+  pattern |= pattern << 8;
+  pattern |= pattern << 16;
+  pattern |= pattern << 32;
+  while (position + 8 <= numberOfVoxels)
+    {
+    vtkTypeUInt64 word;
+    memcpy(&word, voxels + position, 8);
+    if (word != pattern)
+      {
+      break;
+      }
+    position += 8;
+    }
+  while (position < numberOfVoxels && voxels[position] == value)
+    {
+    ++position;
+    }
+  return position;
+}
+
+//----------------------------------------------------------------------------
+template <class ImageScalarType>
+void EncodeSliceRuns(const ImageScalarType* voxels, vtkIdType numberOfVoxels,
+                     vtkRunLengthBinaryLabelmap::RunVectorType& runs, double range[2])
+{
+  vtkIdType position = 0;
+  while (position < numberOfVoxels)
+    {
+    ImageScalarType value = voxels[position];
+    vtkIdType runStart = position;
+    ++position;
+    while (position < numberOfVoxels && voxels[position] == value)
+      {
+      ++position;
+      }
+    vtkRunLengthBinaryLabelmap::RunType run;
+    run.Length = position - runStart;
+    run.Value = static_cast<double>(value);
+    runs.push_back(run);
+    if (run.Value < range[0])
+      {
+      range[0] = run.Value;
+      }
+    if (run.Value > range[1])
+      {
+      range[1] = run.Value;
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+// Overload for the common unsigned char labelmaps, using the word-at-a-time
+// run scan
+void EncodeSliceRuns(const unsigned char* voxels, vtkIdType numberOfVoxels,
+                     vtkRunLengthBinaryLabelmap::RunVectorType& runs, double range[2])
+{
+  vtkIdType position = 0;
+  while (position < numberOfVoxels)
+    {
+    unsigned char value = voxels[position];
+    vtkIdType runStart = position;
+    position = ExtendByteRun(voxels, position + 1, numberOfVoxels, value);
+    vtkRunLengthBinaryLabelmap::RunType run;
+    run.Length = position - runStart;
+    run.Value = static_cast<double>(value);
+    runs.push_back(run);
+    if (run.Value < range[0])
+      {
+      range[0] = run.Value;
+      }
+    if (run.Value > range[1])
+      {
+      range[1] = run.Value;
+      }
+    }
+}
+
+//----------------------------------------------------------------------------
+template <class ImageScalarType>
+void DecodeSliceRuns(ImageScalarType* voxels,
+                     const vtkRunLengthBinaryLabelmap::RunVectorType& runs)
+{
+  vtkIdType position = 0;
+  for (size_t runIndex = 0; runIndex < runs.size(); ++runIndex)
+    {
+    ImageScalarType value = static_cast<ImageScalarType>(runs[runIndex].Value);
+    for (vtkIdType voxel = 0; voxel < runs[runIndex].Length; ++voxel)
+      {
+      voxels[position + voxel] = value;
+      }
+    position += runs[runIndex].Length;
+    }
+}
+
+//----------------------------------------------------------------------------
+// Overload for the common unsigned char labelmaps, filling runs with memset
+void DecodeSliceRuns(unsigned char* voxels,
+                     const vtkRunLengthBinaryLabelmap::RunVectorType& runs)
+{
+  vtkIdType position = 0;
+  for (size_t runIndex = 0; runIndex < runs.size(); ++runIndex)
+    {
+    memset(voxels + position, static_cast<unsigned char>(runs[runIndex].Value),
+           static_cast<size_t>(runs[runIndex].Length));
+    position += runs[runIndex].Length;
+    }
+}
+
+} // end of anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkRunLengthBinaryLabelmap::vtkRunLengthBinaryLabelmap()
+{
+  this->ImageToWorldMatrix = vtkMatrix4x4::New();
+  this->Extent[0] = 0;
+  this->Extent[1] = -1;
+  this->Extent[2] = 0;
+  this->Extent[3] = -1;
+  this->Extent[4] = 0;
+  this->Extent[5] = -1;
+  this->ScalarType = VTK_VOID;
+  this->ScalarRange[0] = 0.0;
+  this->ScalarRange[1] = 0.0;
+}
+
+//----------------------------------------------------------------------------
+vtkRunLengthBinaryLabelmap::~vtkRunLengthBinaryLabelmap()
+{
+  this->ImageToWorldMatrix->Delete();
+  this->ImageToWorldMatrix = NULL;
+}
+
+//----------------------------------------------------------------------------
+void vtkRunLengthBinaryLabelmap::Initialize()
+{
+  this->Superclass::Initialize();
+  this->SliceRuns.clear();
+  this->ImageToWorldMatrix->Identity();
+  this->Extent[0] = 0;
+  this->Extent[1] = -1;
+  this->Extent[2] = 0;
+  this->Extent[3] = -1;
+  this->Extent[4] = 0;
+  this->Extent[5] = -1;
+  this->ScalarType = VTK_VOID;
+  this->ScalarRange[0] = 0.0;
+  this->ScalarRange[1] = 0.0;
+}
+
+//----------------------------------------------------------------------------
+void vtkRunLengthBinaryLabelmap::DeepCopy(vtkDataObject* src)
+{
+  this->Superclass::DeepCopy(src);
+
+  vtkRunLengthBinaryLabelmap* srcLabelmap = vtkRunLengthBinaryLabelmap::SafeDownCast(src);
+  if (!srcLabelmap)
+    {
+    return;
+    }
+
+  this->ImageToWorldMatrix->DeepCopy(srcLabelmap->ImageToWorldMatrix);
+  for (int i = 0; i < 6; ++i)
+    {
+    this->Extent[i] = srcLabelmap->Extent[i];
+    }
+  this->ScalarType = srcLabelmap->ScalarType;
+  this->ScalarRange[0] = srcLabelmap->ScalarRange[0];
+  this->ScalarRange[1] = srcLabelmap->ScalarRange[1];
+  this->SliceRuns = srcLabelmap->SliceRuns;
+}
+
+//----------------------------------------------------------------------------
+void vtkRunLengthBinaryLabelmap::GetImageToWorldMatrix(vtkMatrix4x4* mat)
+{
+  if (!mat)
+    {
+    return;
+    }
+  mat->DeepCopy(this->ImageToWorldMatrix);
+}
+
+//----------------------------------------------------------------------------
+void vtkRunLengthBinaryLabelmap::SetImageToWorldMatrix(vtkMatrix4x4* mat)
+{
+  if (!mat)
+    {
+    return;
+    }
+  this->ImageToWorldMatrix->DeepCopy(mat);
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+bool vtkRunLengthBinaryLabelmap::ImportFromImage(vtkOrientedImageData* image)
+{
+  if (!image || !image->GetPointData() || !image->GetPointData()->GetScalars())
+    {
+    vtkErrorMacro("ImportFromImage: Invalid source image");
+    return false;
+    }
+  if (image->GetNumberOfScalarComponents() != 1)
+    {
+    vtkErrorMacro("ImportFromImage: Only single-component labelmaps are supported");
+    return false;
+    }
+
+  this->SliceRuns.clear();
+  image->GetImageToWorldMatrix(this->ImageToWorldMatrix);
+  image->GetExtent(this->Extent);
+  this->ScalarType = image->GetScalarType();
+  this->ScalarRange[0] = VTK_DOUBLE_MAX;
+  this->ScalarRange[1] = VTK_DOUBLE_MIN;
+
+  vtkIdType numberOfVoxelsPerSlice =
+    static_cast<vtkIdType>(this->Extent[1] - this->Extent[0] + 1)
+    * static_cast<vtkIdType>(this->Extent[3] - this->Extent[2] + 1);
+  int numberOfSlices = this->Extent[5] - this->Extent[4] + 1;
+  if (numberOfVoxelsPerSlice <= 0 || numberOfSlices <= 0)
+    {
+    // empty labelmap: keep the geometry, encode nothing
+    this->ScalarRange[0] = 0.0;
+    this->ScalarRange[1] = 0.0;
+    this->Modified();
+    return true;
+    }
+
+  this->SliceRuns.resize(numberOfSlices);
+  for (int slice = 0; slice < numberOfSlices; ++slice)
+    {
+    // voxels of a slice are contiguous in memory
+    void* sliceVoxels = image->GetScalarPointer(
+      this->Extent[0], this->Extent[2], this->Extent[4] + slice);
+    switch (this->ScalarType)
+      {
+      vtkTemplateMacro(EncodeSliceRuns(static_cast<VTK_TT*>(sliceVoxels),
+        numberOfVoxelsPerSlice, this->SliceRuns[slice], this->ScalarRange));
+      default:
+        vtkErrorMacro("ImportFromImage: Unsupported scalar type " << this->ScalarType);
+        this->SliceRuns.clear();
+        return false;
+      }
+    }
+
+  this->Modified();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkRunLengthBinaryLabelmap::ExportToImage(vtkOrientedImageData* image)
+{
+  return this->ExportSlabToImage(this->Extent[4], this->Extent[5], image);
+}
+
+//----------------------------------------------------------------------------
+bool vtkRunLengthBinaryLabelmap::ExportSlabToImage(int sliceExtentMin, int sliceExtentMax,
+                                                   vtkOrientedImageData* image)
+{
+  if (!image)
+    {
+    vtkErrorMacro("ExportSlabToImage: Invalid target image");
+    return false;
+    }
+  if (this->ScalarType == VTK_VOID)
+    {
+    vtkErrorMacro("ExportSlabToImage: Run-length labelmap does not contain geometry");
+    return false;
+    }
+  bool emptyLabelmap = (this->Extent[1] < this->Extent[0]
+    || this->Extent[3] < this->Extent[2] || this->Extent[5] < this->Extent[4]);
+  if (!emptyLabelmap && sliceExtentMin > sliceExtentMax)
+    {
+    vtkErrorMacro("ExportSlabToImage: Invalid slab " << sliceExtentMin
+      << ".." << sliceExtentMax);
+    return false;
+    }
+  if (!emptyLabelmap &&
+      (sliceExtentMin < this->Extent[4] || sliceExtentMax > this->Extent[5]))
+    {
+    vtkErrorMacro("ExportSlabToImage: Slab " << sliceExtentMin << ".." << sliceExtentMax
+      << " is outside the stored slice extent " << this->Extent[4]
+      << ".." << this->Extent[5]);
+    return false;
+    }
+
+  int slabExtent[6] = { this->Extent[0], this->Extent[1],
+                        this->Extent[2], this->Extent[3],
+                        sliceExtentMin, sliceExtentMax };
+  image->SetImageToWorldMatrix(this->ImageToWorldMatrix);
+  image->SetExtent(emptyLabelmap ? this->Extent : slabExtent);
+  image->AllocateScalars(this->ScalarType, 1);
+  if (emptyLabelmap)
+    {
+    return true;
+    }
+
+  for (int slice = sliceExtentMin; slice <= sliceExtentMax; ++slice)
+    {
+    void* sliceVoxels = image->GetScalarPointer(
+      this->Extent[0], this->Extent[2], slice);
+    const RunVectorType& runs = this->SliceRuns[slice - this->Extent[4]];
+    switch (this->ScalarType)
+      {
+      vtkTemplateMacro(DecodeSliceRuns(static_cast<VTK_TT*>(sliceVoxels), runs));
+      default:
+        vtkErrorMacro("ExportSlabToImage: Unsupported scalar type " << this->ScalarType);
+        return false;
+      }
+    }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+long long vtkRunLengthBinaryLabelmap::GetNumberOfRuns()
+{
+  long long numberOfRuns = 0;
+  for (size_t slice = 0; slice < this->SliceRuns.size(); ++slice)
+    {
+    numberOfRuns += static_cast<long long>(this->SliceRuns[slice].size());
+    }
+  return numberOfRuns;
+}
+
+//----------------------------------------------------------------------------
+long long vtkRunLengthBinaryLabelmap::GetNumberOfForegroundVoxels()
+{
+  long long numberOfForegroundVoxels = 0;
+  for (size_t slice = 0; slice < this->SliceRuns.size(); ++slice)
+    {
+    const RunVectorType& runs = this->SliceRuns[slice];
+    for (size_t runIndex = 0; runIndex < runs.size(); ++runIndex)
+      {
+      if (runs[runIndex].Value != 0.0)
+        {
+        numberOfForegroundVoxels += static_cast<long long>(runs[runIndex].Length);
+        }
+      }
+    }
+  return numberOfForegroundVoxels;
+}
+
+//----------------------------------------------------------------------------
+bool vtkRunLengthBinaryLabelmap::GetForegroundExtent(int extent[6])
+{
+  extent[0] = 0;
+  extent[1] = -1;
+  extent[2] = 0;
+  extent[3] = -1;
+  extent[4] = 0;
+  extent[5] = -1;
+
+  vtkIdType rowLength = static_cast<vtkIdType>(this->Extent[1] - this->Extent[0] + 1);
+  if (rowLength <= 0)
+    {
+    return false;
+    }
+
+  bool foundForeground = false;
+  for (size_t slice = 0; slice < this->SliceRuns.size(); ++slice)
+    {
+    const RunVectorType& runs = this->SliceRuns[slice];
+    vtkIdType position = 0;
+    for (size_t runIndex = 0; runIndex < runs.size(); ++runIndex)
+      {
+      vtkIdType runLength = runs[runIndex].Length;
+      if (runs[runIndex].Value == 0.0)
+        {
+        position += runLength;
+        continue;
+        }
+      // Rows and columns covered by the run within the slice
+      vtkIdType firstRow = position / rowLength;
+      vtkIdType firstColumn = position % rowLength;
+      vtkIdType lastRow = (position + runLength - 1) / rowLength;
+      vtkIdType lastColumn = (position + runLength - 1) % rowLength;
+      int minI = this->Extent[0];
+      int maxI = this->Extent[1];
+      if (firstRow == lastRow)
+        {
+        minI = this->Extent[0] + static_cast<int>(firstColumn);
+        maxI = this->Extent[0] + static_cast<int>(lastColumn);
+        }
+      // A run crossing a row boundary touches both row ends, covering the
+      // full I extent
+      int minJ = this->Extent[2] + static_cast<int>(firstRow);
+      int maxJ = this->Extent[2] + static_cast<int>(lastRow);
+      int sliceK = this->Extent[4] + static_cast<int>(slice);
+      if (!foundForeground)
+        {
+        extent[0] = minI;
+        extent[1] = maxI;
+        extent[2] = minJ;
+        extent[3] = maxJ;
+        extent[4] = sliceK;
+        extent[5] = sliceK;
+        foundForeground = true;
+        }
+      else
+        {
+        extent[0] = std::min(extent[0], minI);
+        extent[1] = std::max(extent[1], maxI);
+        extent[2] = std::min(extent[2], minJ);
+        extent[3] = std::max(extent[3], maxJ);
+        extent[4] = std::min(extent[4], sliceK);
+        extent[5] = std::max(extent[5], sliceK);
+        }
+      position += runLength;
+      }
+    }
+
+  return foundForeground;
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkRunLengthBinaryLabelmap::GetActualMemorySize()
+{
+  long long memorySizeInBytes = this->GetNumberOfRuns()
+    * static_cast<long long>(sizeof(RunType));
+  return static_cast<unsigned long>(memorySizeInBytes / 1024 + 1);
+}
+
+//----------------------------------------------------------------------------
+void vtkRunLengthBinaryLabelmap::GetScalarRange(double range[2])
+{
+  range[0] = this->ScalarRange[0];
+  range[1] = this->ScalarRange[1];
+}
+
+//----------------------------------------------------------------------------
+bool vtkRunLengthBinaryLabelmap::IsEmpty()
+{
+  return this->ScalarRange[1] <= 0.0;
+}
+
+//----------------------------------------------------------------------------
+void vtkRunLengthBinaryLabelmap::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Extent: (" << this->Extent[0] << ", " << this->Extent[1] << ", "
+     << this->Extent[2] << ", " << this->Extent[3] << ", "
+     << this->Extent[4] << ", " << this->Extent[5] << ")\n";
+  os << indent << "ScalarType: " << this->ScalarType << "\n";
+  os << indent << "ScalarRange: (" << this->ScalarRange[0] << ", "
+     << this->ScalarRange[1] << ")\n";
+  os << indent << "NumberOfRuns: " << this->GetNumberOfRuns() << "\n";
+  os << indent << "ImageToWorldMatrix:\n";
+  this->ImageToWorldMatrix->PrintSelf(os, indent.GetNextIndent());
+}
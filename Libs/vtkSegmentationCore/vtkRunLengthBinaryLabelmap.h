@@ -0,0 +1,150 @@
+/*==============================================================================
+
+  Copyright (c) Laboratory for Percutaneous Surgery (PerkLab)
+  Queen's University, Kingston, ON, Canada. All Rights Reserved.
+
+  See COPYRIGHT.txt
+  or http://www.slicer.org/copyright/copyright.txt for details.
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+==============================================================================*/
+
+#ifndef __vtkRunLengthBinaryLabelmap_h
+#define __vtkRunLengthBinaryLabelmap_h
+
+// Segmentation includes
+#include "vtkSegmentationCoreConfigure.h"
+
+// VTK includes
+#include <vtkDataObject.h>
+
+// STD includes
+#include <vector>
+
+class vtkMatrix4x4;
+class vtkOrientedImageData;
+
+/// \ingroup SegmentationCore
+/// \brief Run-length encoded storage of a binary labelmap
+///
+/// Stores a binary labelmap as runs of equal voxel values. Segment masks
+/// are almost entirely made of long background and foreground runs, so
+/// this form typically uses a small fraction of the memory of the dense
+/// labelmap, which makes it a suitable at-rest representation for segments
+/// that are not being edited.
+///
+/// The runs are kept per slice (runs never cross slice boundaries), so a
+/// slab of slices can be decoded without touching the rest of the volume
+/// (\sa ExportSlabToImage). The whole dense labelmap is reconstructed
+/// exactly by \sa ExportToImage, which is how the conversion machinery
+/// rehydrates the segment when it is edited.
+///
+/// The image geometry (orientation, spacing, origin, extent, scalar type)
+/// mirrors the vtkOrientedImageData the encoded labelmap was built from.
+class vtkSegmentationCore_EXPORT vtkRunLengthBinaryLabelmap : public vtkDataObject
+{
+public:
+  /// Run of voxels sharing the same value
+  struct RunType
+    {
+    vtkIdType Length;
+    double Value;
+    };
+  /// Runs of one slice, in voxel order
+  typedef std::vector<RunType> RunVectorType;
+
+public:
+  static vtkRunLengthBinaryLabelmap *New();
+  vtkTypeMacro(vtkRunLengthBinaryLabelmap, vtkDataObject);
+  virtual void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+
+  /// Remove all runs and reset the geometry
+  virtual void Initialize() VTK_OVERRIDE;
+
+  /// Deep copy another run-length encoded labelmap
+  virtual void DeepCopy(vtkDataObject* src) VTK_OVERRIDE;
+
+  /// Get the geometry matrix that includes directions, spacing, and origin
+  void GetImageToWorldMatrix(vtkMatrix4x4* mat);
+  /// Set directions, spacing, and origin from a matrix
+  void SetImageToWorldMatrix(vtkMatrix4x4* mat);
+
+  /// Extent of the dense labelmap the runs were encoded from
+  vtkGetVector6Macro(Extent, int);
+  vtkSetVector6Macro(Extent, int);
+
+  /// Scalar type of the stored voxels (VTK_UNSIGNED_CHAR, VTK_SHORT, ...)
+  vtkGetMacro(ScalarType, int);
+
+  /// Encode a dense binary labelmap into runs. Single-byte scalar types
+  /// are scanned a machine word at a time, which is where most of the
+  /// encoding time goes on CT-sized labelmaps.
+  /// Existing runs are discarded first.
+  /// \return Success flag. Fails if the image has no data or more than
+  ///   one scalar component.
+  bool ImportFromImage(vtkOrientedImageData* image);
+
+  /// Reconstruct the dense binary labelmap. The image is allocated to the
+  /// stored extent and geometry.
+  /// \return Success flag. Fails if the encoded labelmap has no geometry.
+  bool ExportToImage(vtkOrientedImageData* image);
+
+  /// Reconstruct only the slices sliceExtentMin..sliceExtentMax (given in
+  /// the K extent coordinates of the stored labelmap, both inclusive).
+  /// The image gets the stored geometry with its slice extent restricted
+  /// to the requested slab; the other slices are not decoded.
+  /// \return Success flag. Fails if the encoded labelmap has no geometry
+  ///   or the slab is outside the stored extent.
+  bool ExportSlabToImage(int sliceExtentMin, int sliceExtentMax, vtkOrientedImageData* image);
+
+  /// Total number of runs over all slices
+  long long GetNumberOfRuns();
+
+  /// Number of foreground (non-zero) voxels, computed from the run lengths
+  /// without decoding the labelmap. Cost is proportional to the number of
+  /// runs, not to the volume size.
+  long long GetNumberOfForegroundVoxels();
+
+  /// Compute the tight IJK bounding extent of the foreground voxels from
+  /// the runs, without decoding the labelmap. Cost is proportional to the
+  /// number of runs, not to the volume size.
+  /// \return Success flag. Fails (and sets an invalid extent) if the
+  ///   labelmap contains no foreground voxel.
+  bool GetForegroundExtent(int extent[6]);
+
+  /// Memory occupied by the runs in kilobytes
+  unsigned long GetActualMemorySize();
+
+  /// Scalar range over all runs. Returns [0,0] when empty.
+  void GetScalarRange(double range[2]);
+
+  /// Determines whether the labelmap contains any foreground run
+  bool IsEmpty();
+
+protected:
+  vtkRunLengthBinaryLabelmap();
+  ~vtkRunLengthBinaryLabelmap();
+
+protected:
+  /// Geometry of the dense labelmap (directions, spacing, origin)
+  vtkMatrix4x4* ImageToWorldMatrix;
+  /// Extent of the dense labelmap
+  int Extent[6];
+  /// Scalar type of the stored voxels
+  int ScalarType;
+  /// Scalar range over all runs
+  double ScalarRange[2];
+  /// Runs of each slice, indexed by slice position relative to Extent[4]
+  std::vector<RunVectorType> SliceRuns;
+
+private:
+  vtkRunLengthBinaryLabelmap(const vtkRunLengthBinaryLabelmap&); // Not implemented.
+  void operator=(const vtkRunLengthBinaryLabelmap&); // Not implemented.
+};
+
+#endif // __vtkRunLengthBinaryLabelmap_h
@@ -205,6 +205,53 @@ void vtkSegment::DeepCopy(vtkSegment* source)
     }
 }
 
+//----------------------------------------------------------------------------
+void vtkSegment::DeepCopyWithBaseline(vtkSegment* source, vtkSegment* baseline)
+{
+  if (!source)
+    {
+    vtkErrorMacro("vtkSegment::DeepCopyWithBaseline failed: sourceSegment is invalid")
+    return;
+    }
+
+  this->RemoveAllRepresentations();
+  this->DeepCopyMetadata(source);
+
+  // Copy representations
+  std::vector<std::string> representationNames;
+  source->GetContainedRepresentationNames(representationNames);
+  for (std::vector<std::string>::iterator representationNameIt = representationNames.begin();
+    representationNameIt != representationNames.end(); ++representationNameIt)
+    {
+    vtkDataObject* sourceRepresentation = source->GetRepresentation(*representationNameIt);
+    vtkDataObject* baselineRepresentation = NULL;
+    if (baseline)
+      {
+      baselineRepresentation = baseline->GetRepresentation(*representationNameIt);
+      }
+    // Shallow-copy from baseline if it's up-to-date, otherwise deep-copy from source
+    if (baselineRepresentation != NULL
+      && baselineRepresentation->GetMTime() > sourceRepresentation->GetMTime())
+      {
+      // we already have an up-to-date copy in the baseline, so reuse that
+      this->AddRepresentation(*representationNameIt, baselineRepresentation);
+      }
+    else
+      {
+      vtkDataObject* representationCopy =
+        vtkSegmentationConverterFactory::GetInstance()->ConstructRepresentationObjectByClass(sourceRepresentation->GetClassName());
+      if (!representationCopy)
+        {
+        vtkErrorMacro("DeepCopyWithBaseline: Unable to construct representation type class '" << sourceRepresentation->GetClassName() << "'");
+        continue;
+        }
+      representationCopy->DeepCopy(sourceRepresentation);
+      this->AddRepresentation(*representationNameIt, representationCopy);
+      representationCopy->Delete(); // this representation is now owned by the segment
+      }
+    }
+}
+
 //----------------------------------------------------------------------------
 void vtkSegment::DeepCopyMetadata(vtkSegment* source)
 {
@@ -316,6 +363,21 @@ void vtkSegment::GetContainedRepresentationNames(std::vector<std::string>& repre
     }
 }
 
+//---------------------------------------------------------------------------
+unsigned long vtkSegment::GetActualMemorySize()
+{
+  unsigned long memorySizeInKilobytes = 0;
+  RepresentationMap::iterator reprIt;
+  for (reprIt=this->Representations.begin(); reprIt!=this->Representations.end(); ++reprIt)
+    {
+    if (reprIt->second.GetPointer())
+      {
+      memorySizeInKilobytes += reprIt->second->GetActualMemorySize();
+      }
+    }
+  return memorySizeInKilobytes;
+}
+
 //---------------------------------------------------------------------------
 void vtkSegment::SetTag(std::string tag, std::string value)
 {
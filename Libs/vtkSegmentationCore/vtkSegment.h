@@ -64,6 +64,14 @@ public:
   /// Deep copy one segment into another
   virtual void DeepCopy(vtkSegment* source);
 
+  /// Deep copy one segment into another, but share the representation data
+  /// objects of \a baseline for representations that have not been modified
+  /// since the baseline copy was created (i.e., the baseline representation
+  /// is newer than the source representation). Used for history states and
+  /// undo checkpoints so that their cost is proportional to the edit and not
+  /// to the segment size.
+  virtual void DeepCopyWithBaseline(vtkSegment* source, vtkSegment* baseline);
+
   /// Deep copy metadata (i.e., all data but representations) one segment into another
   virtual void DeepCopyMetadata(vtkSegment* source);
 
@@ -109,6 +117,10 @@ public:
   /// Get representation names present in this segment in an output string vector
   void GetContainedRepresentationNames(std::vector<std::string>& representationNames);
 
+  /// Get the total size of all representations stored in this segment in
+  /// kibibytes, following vtkDataObject::GetActualMemorySize() conventions.
+  unsigned long GetActualMemorySize();
+
 public:
   vtkGetStringMacro(Name);
   vtkSetStringMacro(Name);
@@ -35,6 +35,9 @@
 #include <vtkMath.h>
 #include <vtkVersion.h>
 #include <vtkCallbackCommand.h>
+#include <vtkMultiThreader.h>
+#include <vtkMutexLock.h>
+#include <vtkTimerLog.h>
 #include <vtkStringArray.h>
 #include <vtkAbstractTransform.h>
 #include <vtkMatrix4x4.h>
@@ -42,6 +45,9 @@
 #include <vtkPolyData.h>
 #include <vtkTransformPolyDataFilter.h>
 
+// VTKSYS includes
+#include <vtksys/SystemTools.hxx>
+
 // STD includes
 #include <sstream>
 #include <algorithm>
@@ -50,6 +56,125 @@
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkSegmentation);
 
+namespace
+{
+
+//----------------------------------------------------------------------------
+// Shared state of the worker threads spawned from
+// vtkSegmentation::ConvertSegmentsUsingPath(). Workers pull segments off
+// the list one by one, convert them with their own clones of the
+// conversion rules, and push the produced representations onto the
+// completed list, which the calling thread commits incrementally.
+struct SegmentConversionJob
+{
+  typedef std::vector<std::pair<std::string, vtkSmartPointer<vtkDataObject> > > RepresentationListType;
+  struct ResultType
+    {
+    std::string SegmentID;
+    RepresentationListType Representations;
+    bool Success;
+    };
+
+  std::vector<std::pair<std::string, vtkSegment*> > Segments;
+  vtkSegmentationConverter::ConversionPathType Path;
+  bool OverwriteExisting;
+
+  vtkSmartPointer<vtkMutexLock> Lock;
+  size_t NextSegmentIndex;
+  std::vector<ResultType> Completed;
+};
+
+//----------------------------------------------------------------------------
+VTK_THREAD_RETURN_TYPE ConvertSegmentsThreaderCallback(void* arg)
+{
+  vtkMultiThreader::ThreadInfo* info = static_cast<vtkMultiThreader::ThreadInfo*>(arg);
+  SegmentConversionJob* job = static_cast<SegmentConversionJob*>(info->UserData);
+
+  // Each worker converts with its own clones of the conversion rules,
+  // because rules may store segment-specific state during conversion
+  std::vector<vtkSmartPointer<vtkSegmentationConverterRule> > rules;
+  vtkSegmentationConverter::ConversionPathType::iterator pathIt;
+  for (pathIt = job->Path.begin(); pathIt != job->Path.end(); ++pathIt)
+    {
+    rules.push_back( vtkSmartPointer<vtkSegmentationConverterRule>::Take((*pathIt)->Clone()) );
+    }
+
+  while (true)
+    {
+    job->Lock->Lock();
+    size_t segmentIndex = job->NextSegmentIndex;
+    if (segmentIndex < job->Segments.size())
+      {
+      ++job->NextSegmentIndex;
+      }
+    job->Lock->Unlock();
+    if (segmentIndex >= job->Segments.size())
+      {
+      break;
+      }
+
+    vtkSegment* segment = job->Segments[segmentIndex].second;
+    SegmentConversionJob::ResultType result;
+    result.SegmentID = job->Segments[segmentIndex].first;
+    result.Success = true;
+
+    // Execute each conversion step in the selected path. Representations
+    // produced by earlier steps are visible to later steps of the same
+    // segment, but nothing is written to the segment from the worker.
+    std::vector<vtkSmartPointer<vtkSegmentationConverterRule> >::iterator ruleIt;
+    for (ruleIt = rules.begin(); ruleIt != rules.end(); ++ruleIt)
+      {
+      vtkSegmentationConverterRule* currentConversionRule = (*ruleIt);
+
+      // Get source representation from an earlier step of this conversion,
+      // or from the segment itself
+      vtkDataObject* sourceRepresentation = NULL;
+      SegmentConversionJob::RepresentationListType::iterator reprIt;
+      for (reprIt = result.Representations.begin(); reprIt != result.Representations.end(); ++reprIt)
+        {
+        if (!reprIt->first.compare(currentConversionRule->GetSourceRepresentationName()))
+          {
+          sourceRepresentation = reprIt->second;
+          }
+        }
+      if (!sourceRepresentation)
+        {
+        sourceRepresentation = segment->GetRepresentation(
+          currentConversionRule->GetSourceRepresentationName() );
+        }
+      if (!sourceRepresentation)
+        {
+        result.Success = false;
+        break;
+        }
+
+      // If target representation exists and we do not overwrite existing
+      // representations, then no conversion is necessary with this rule
+      if (segment->GetRepresentation(currentConversionRule->GetTargetRepresentationName())
+        && !job->OverwriteExisting)
+        {
+        continue;
+        }
+
+      vtkSmartPointer<vtkDataObject> targetRepresentation = vtkSmartPointer<vtkDataObject>::Take(
+        currentConversionRule->ConstructRepresentationObjectByRepresentation(currentConversionRule->GetTargetRepresentationName()) );
+      double conversionStartTime = vtkTimerLog::GetUniversalTime();
+      currentConversionRule->Convert(sourceRepresentation, targetRepresentation);
+      currentConversionRule->RecordConversionDuration(vtkTimerLog::GetUniversalTime() - conversionStartTime);
+      result.Representations.push_back( std::make_pair(
+        std::string(currentConversionRule->GetTargetRepresentationName()), targetRepresentation) );
+      }
+
+    job->Lock->Lock();
+    job->Completed.push_back(result);
+    job->Lock->Unlock();
+    }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // end of anonymous namespace
+
 //----------------------------------------------------------------------------
 template<class T>
 struct MapValueCompare : public std::binary_function<typename T::value_type, typename T::mapped_type, bool>
@@ -78,6 +203,8 @@ vtkSegmentation::vtkSegmentation()
 
   this->SegmentIdAutogeneratorIndex = 0;
 
+  this->NumberOfConversionThreads = 0;
+
   this->SetMasterRepresentationName(vtkSegmentationConverter::GetSegmentationBinaryLabelmapRepresentationName());
 }
 
@@ -154,6 +281,38 @@ void vtkSegmentation::DeepCopy(vtkSegmentation* aSegmentation)
     }
 }
 
+//----------------------------------------------------------------------------
+void vtkSegmentation::DeepCopyWithBaseline(vtkSegmentation* aSegmentation, vtkSegmentation* baseline)
+{
+  if (!aSegmentation)
+    {
+    return;
+    }
+  if (!baseline)
+    {
+    this->DeepCopy(aSegmentation);
+    return;
+    }
+
+  this->RemoveAllSegments();
+
+  // Copy properties
+  this->SetMasterRepresentationName(aSegmentation->GetMasterRepresentationName());
+
+  // Copy conversion parameters
+  this->Converter->DeepCopy(aSegmentation->Converter);
+
+  // Copy segments list, sharing unmodified representation data with the
+  // corresponding baseline segment
+  for (std::deque< std::string >::iterator segmentIdIt = aSegmentation->SegmentIds.begin(); segmentIdIt != aSegmentation->SegmentIds.end(); ++segmentIdIt)
+    {
+    vtkSegment* baselineSegment = baseline->GetSegment(*segmentIdIt);
+    vtkSmartPointer<vtkSegment> segment = vtkSmartPointer<vtkSegment>::New();
+    segment->DeepCopyWithBaseline(aSegmentation->Segments[*segmentIdIt], baselineSegment);
+    this->AddSegment(segment);
+    }
+}
+
 //----------------------------------------------------------------------------
 void vtkSegmentation::CopyConversionParameters(vtkSegmentation* aSegmentation)
 {
@@ -615,6 +774,21 @@ int vtkSegmentation::GetNumberOfSegments() const
   return this->SegmentIds.size();
 }
 
+//---------------------------------------------------------------------------
+unsigned long vtkSegmentation::GetActualMemorySize() const
+{
+  unsigned long memorySizeInKilobytes = 0;
+  SegmentMap::const_iterator segmentIt;
+  for (segmentIt = this->Segments.begin(); segmentIt != this->Segments.end(); ++segmentIt)
+    {
+    if (segmentIt->second.GetPointer())
+      {
+      memorySizeInKilobytes += segmentIt->second->GetActualMemorySize();
+      }
+    }
+  return memorySizeInKilobytes;
+}
+
 //---------------------------------------------------------------------------
 vtkSegment* vtkSegmentation::GetNthSegment(unsigned int index) const
 {
@@ -959,8 +1133,11 @@ bool vtkSegmentation::ConvertSegmentUsingPath(vtkSegment* segment, vtkSegmentati
         currentConversionRule->ConstructRepresentationObjectByRepresentation(currentConversionRule->GetTargetRepresentationName()) );
       }
 
-    // Perform conversion step
+    // Perform conversion step. The measured duration feeds the adaptive
+    // conversion cost model used for selecting future conversion paths.
+    double conversionStartTime = vtkTimerLog::GetUniversalTime();
     currentConversionRule->Convert(sourceRepresentation, targetRepresentation);
+    currentConversionRule->RecordConversionDuration(vtkTimerLog::GetUniversalTime() - conversionStartTime);
 
     // Add representation to segment
     segment->AddRepresentation(currentConversionRule->GetTargetRepresentationName(), targetRepresentation);
@@ -969,6 +1146,105 @@ bool vtkSegmentation::ConvertSegmentUsingPath(vtkSegment* segment, vtkSegmentati
   return true;
 }
 
+//-----------------------------------------------------------------------------
+bool vtkSegmentation::ConvertSegmentsUsingPath(vtkSegmentationConverter::ConversionPathType path, bool overwriteExisting/*=false*/)
+{
+  int numberOfThreads = this->NumberOfConversionThreads;
+  if (numberOfThreads <= 0)
+    {
+    numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
+    }
+  if (numberOfThreads > static_cast<int>(this->Segments.size()))
+    {
+    numberOfThreads = static_cast<int>(this->Segments.size());
+    }
+
+  // Serial conversion for a single segment or when parallel conversion
+  // is disabled
+  if (numberOfThreads <= 1)
+    {
+    for (SegmentMap::iterator segmentIt = this->Segments.begin(); segmentIt != this->Segments.end(); ++segmentIt)
+      {
+      if (!this->ConvertSegmentUsingPath(segmentIt->second, path, overwriteExisting))
+        {
+        vtkErrorMacro("ConvertSegmentsUsingPath: Conversion failed");
+        return false;
+        }
+      this->InvokeEvent(vtkSegmentation::RepresentationModified, (void*)segmentIt->first.c_str());
+      }
+    return true;
+    }
+
+  SegmentConversionJob job;
+  job.Path = path;
+  job.OverwriteExisting = overwriteExisting;
+  job.Lock = vtkSmartPointer<vtkMutexLock>::New();
+  job.NextSegmentIndex = 0;
+  for (SegmentMap::iterator segmentIt = this->Segments.begin(); segmentIt != this->Segments.end(); ++segmentIt)
+    {
+    job.Segments.push_back( std::make_pair(segmentIt->first, segmentIt->second.GetPointer()) );
+    }
+
+  vtkNew<vtkMultiThreader> threader;
+  std::vector<int> threadIds;
+  for (int thread = 0; thread < numberOfThreads; ++thread)
+    {
+    threadIds.push_back( threader->SpawnThread(ConvertSegmentsThreaderCallback, &job) );
+    }
+
+  // Commit finished segments on this thread as they arrive, so that
+  // observers (e.g. 3D views) can display converted segments while the
+  // remaining ones are still being computed
+  bool success = true;
+  size_t numberOfCommittedSegments = 0;
+  while (numberOfCommittedSegments < job.Segments.size())
+    {
+    std::vector<SegmentConversionJob::ResultType> completed;
+    job.Lock->Lock();
+    completed.swap(job.Completed);
+    job.Lock->Unlock();
+    if (completed.empty())
+      {
+      vtksys::SystemTools::Delay(20);
+      continue;
+      }
+
+    std::vector<SegmentConversionJob::ResultType>::iterator resultIt;
+    for (resultIt = completed.begin(); resultIt != completed.end(); ++resultIt)
+      {
+      ++numberOfCommittedSegments;
+      if (!resultIt->Success)
+        {
+        success = false;
+        continue;
+        }
+      vtkSegment* segment = this->GetSegment(resultIt->SegmentID);
+      if (!segment)
+        {
+        continue;
+        }
+      SegmentConversionJob::RepresentationListType::iterator reprIt;
+      for (reprIt = resultIt->Representations.begin(); reprIt != resultIt->Representations.end(); ++reprIt)
+        {
+        segment->AddRepresentation(reprIt->first, reprIt->second);
+        }
+      this->InvokeEvent(vtkSegmentation::RepresentationModified, (void*)resultIt->SegmentID.c_str());
+      }
+    }
+
+  std::vector<int>::iterator threadIdIt;
+  for (threadIdIt = threadIds.begin(); threadIdIt != threadIds.end(); ++threadIdIt)
+    {
+    threader->TerminateThread(*threadIdIt);
+    }
+
+  if (!success)
+    {
+    vtkErrorMacro("ConvertSegmentsUsingPath: Conversion failed");
+    }
+  return success;
+}
+
 //---------------------------------------------------------------------------
 bool vtkSegmentation::CreateRepresentation(const std::string& targetRepresentationName, bool alwaysConvert/*=false*/)
 {
@@ -1030,23 +1306,13 @@ bool vtkSegmentation::CreateRepresentation(const std::string& targetRepresentati
     return false;
     }
 
-  // Perform conversion on all segments (no overwrites)
-  for (SegmentMap::iterator segmentIt = this->Segments.begin(); segmentIt != this->Segments.end(); ++segmentIt)
+  // Perform conversion on all segments (no overwrites). Segments are
+  // distributed over a pool of worker threads and committed one by one
+  // as they finish, firing RepresentationModified per segment.
+  if (!this->ConvertSegmentsUsingPath(cheapestPath, alwaysConvert))
     {
-    vtkDataObject* representationBefore = segmentIt->second->GetRepresentation(targetRepresentationName);
-    if (!this->ConvertSegmentUsingPath(segmentIt->second, cheapestPath, alwaysConvert))
-      {
-      vtkErrorMacro("CreateRepresentation: Conversion failed");
-      return false;
-      }
-    vtkDataObject* representationAfter = segmentIt->second->GetRepresentation(targetRepresentationName);
-    if (representationBefore != representationAfter
-      || (representationBefore != NULL && representationAfter != NULL && representationBefore->GetMTime() != representationAfter->GetMTime()) )
-      {
-      // representation has been modified
-      const char* segmentId = segmentIt->first.c_str();
-      this->InvokeEvent(vtkSegmentation::RepresentationModified, (void*)segmentId);
-      }
+    vtkErrorMacro("CreateRepresentation: Conversion failed");
+    return false;
     }
 
   this->InvokeEvent(vtkSegmentation::ContainedRepresentationNamesModified);
@@ -1070,19 +1336,60 @@ bool vtkSegmentation::CreateRepresentation(vtkSegmentationConverter::ConversionP
   // Set conversion parameters
   this->Converter->SetConversionParameters(parameters);
 
-  // Perform conversion on all segments (do overwrites)
-  for (SegmentMap::iterator segmentIt = this->Segments.begin(); segmentIt != this->Segments.end(); ++segmentIt)
+  // Perform conversion on all segments (do overwrites). Segments are
+  // distributed over a pool of worker threads and committed one by one
+  // as they finish, firing RepresentationModified per segment.
+  if (!this->ConvertSegmentsUsingPath(path, true))
+    {
+    vtkErrorMacro("CreateRepresentation: Conversion failed");
+    return false;
+    }
+
+  this->InvokeEvent(vtkSegmentation::ContainedRepresentationNamesModified);
+  return true;
+}
+
+//---------------------------------------------------------------------------
+bool vtkSegmentation::UpdateRepresentationInRegion(const std::string& segmentId,
+  const std::string& targetRepresentationName, const int modifiedExtent[6])
+{
+  vtkSegment* segment = this->GetSegment(segmentId);
+  if (!segment)
     {
-    if (!this->ConvertSegmentUsingPath(segmentIt->second, path, true))
+    vtkErrorMacro("UpdateRepresentationInRegion: Segment not found by ID " << segmentId);
+    return false;
+    }
+
+  // Get conversion path with lowest cost from the master representation
+  vtkSegmentationConverter::ConversionPathAndCostListType pathCosts;
+  this->Converter->GetPossibleConversions(this->MasterRepresentationName, targetRepresentationName, pathCosts);
+  vtkSegmentationConverter::ConversionPathType cheapestPath = vtkSegmentationConverter::GetCheapestPath(pathCosts);
+  if (cheapestPath.empty())
+    {
+    return false;
+    }
+
+  vtkDataObject* sourceRepresentation = segment->GetRepresentation(this->MasterRepresentationName);
+  vtkDataObject* targetRepresentation = segment->GetRepresentation(targetRepresentationName);
+
+  // Region-limited update is possible for a single-step conversion with a
+  // rule that supports it, when the target representation already exists
+  if (cheapestPath.size() == 1 && cheapestPath[0]->SupportsRegionLimitedConversion()
+    && sourceRepresentation && targetRepresentation)
+    {
+    if (!cheapestPath[0]->ConvertModifiedRegion(sourceRepresentation, targetRepresentation, modifiedExtent))
       {
-      vtkErrorMacro("CreateRepresentation: Conversion failed");
+      vtkErrorMacro("UpdateRepresentationInRegion: Region-limited conversion failed");
       return false;
       }
-    const char* segmentId = segmentIt->first.c_str();
-    this->InvokeEvent(vtkSegmentation::RepresentationModified, (void*)segmentId);
+    }
+  else if (!this->ConvertSegmentUsingPath(segment, cheapestPath, true))
+    {
+    vtkErrorMacro("UpdateRepresentationInRegion: Conversion failed");
+    return false;
     }
 
-  this->InvokeEvent(vtkSegmentation::ContainedRepresentationNamesModified);
+  this->InvokeEvent(vtkSegmentation::RepresentationModified, (void*)segmentId.c_str());
   return true;
 }
 
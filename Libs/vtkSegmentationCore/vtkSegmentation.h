@@ -137,6 +137,14 @@ public:
   /// Deep copy one segmentation into another
   virtual void DeepCopy(vtkSegmentation* aSegmentation);
 
+  /// Deep copy one segmentation into another, sharing the representation
+  /// data objects of \a baseline for segments that have not been modified
+  /// since the baseline copy was created. Used by the MRML scene undo stack
+  /// so that a checkpoint of a segmentation costs memory proportional to the
+  /// edited segments only.
+  /// \sa vtkSegment::DeepCopyWithBaseline(), vtkSegmentationHistory
+  virtual void DeepCopyWithBaseline(vtkSegmentation* aSegmentation, vtkSegmentation* baseline);
+
   /// Copy conversion parameters from another segmentation
   virtual void CopyConversionParameters(vtkSegmentation* aSegmentation);
 
@@ -230,6 +238,11 @@ public:
   /// Request the total number of segments, primarily used for iterating over all segments
   int GetNumberOfSegments() const;
 
+  /// Get the total size of all representations of all segments in kibibytes,
+  /// following vtkDataObject::GetActualMemorySize() conventions.
+  /// \sa vtkSegment::GetActualMemorySize()
+  unsigned long GetActualMemorySize() const;
+
   /// Request segment by index
   vtkSegment* GetNthSegment(unsigned int index) const;
 
@@ -324,6 +337,19 @@ public:
   bool CreateRepresentation(vtkSegmentationConverter::ConversionPathType path,
                             vtkSegmentationConverterRule::ConversionParameterListType parameters);
 
+  /// Update a converted representation of one segment after a localized
+  /// edit of its master representation (e.g. a paint/erase stroke), given
+  /// the modified extent in IJK voxel coordinates of the master labelmap.
+  /// If the direct conversion rule supports region-limited conversion
+  /// (\sa vtkSegmentationConverterRule::SupportsRegionLimitedConversion)
+  /// and the target representation already exists, only the part of the
+  /// representation intersecting the modified extent is regenerated;
+  /// otherwise a full conversion of the segment is performed.
+  /// Fires RepresentationModified for the segment.
+  /// \return Success flag
+  bool UpdateRepresentationInRegion(const std::string& segmentId,
+    const std::string& targetRepresentationName, const int modifiedExtent[6]);
+
   /// Removes a representation from all segments if present
   void RemoveRepresentation(const std::string& representationName);
 
@@ -369,6 +395,15 @@ public:
 
 // Get/set methods
 
+  /// Number of worker threads used when converting all segments to a new
+  /// representation (\sa CreateRepresentation). 0 (the default) sizes the
+  /// pool to the number of cores of the machine. Segments are distributed
+  /// over the workers and each finished segment is committed immediately,
+  /// so observers (e.g. 3D views) can display results progressively.
+  /// Set to 1 to convert serially.
+  vtkSetClampMacro(NumberOfConversionThreads, int, 0, 64);
+  vtkGetMacro(NumberOfConversionThreads, int);
+
   /// Get master representation name
   vtkGetMacro(MasterRepresentationName, std::string);
   /// Set master representation name.
@@ -385,6 +420,18 @@ protected:
   /// \return Success flag
   bool ConvertSegmentUsingPath(vtkSegment* segment, vtkSegmentationConverter::ConversionPathType path, bool overwriteExisting=false);
 
+  /// Convert all segments along a specified path on a pool of worker
+  /// threads (\sa SetNumberOfConversionThreads). Each worker converts with
+  /// its own clones of the conversion rules; finished segments are
+  /// committed on the calling thread as they arrive and a
+  /// RepresentationModified event is fired per segment. Falls back to
+  /// serial conversion for a single segment or a single thread.
+  /// \param path Path to do the conversion along
+  /// \param overwriteExisting If true then do each conversion step regardless the target representation
+  ///   exists. If false then skip those conversion steps that would overwrite existing representation
+  /// \return Success flag
+  bool ConvertSegmentsUsingPath(vtkSegmentationConverter::ConversionPathType path, bool overwriteExisting=false);
+
   /// Converts a single segment to a representation.
   bool ConvertSingleSegment(std::string segmentId, std::string targetRepresentationName);
 
@@ -438,6 +485,10 @@ protected:
   /// segment ID.
   int SegmentIdAutogeneratorIndex;
 
+  /// Number of worker threads used for converting all segments
+  /// (0 = number of cores)
+  int NumberOfConversionThreads;
+
   /// This contains the segment IDs in display order.
   /// (we could retrieve segment IDs from SegmentMap too, but that always contains segments in
   /// alphabetical order)
@@ -368,7 +368,7 @@ void vtkSegmentationConverter::FindPath(const std::string& sourceRepresentationN
       // this rule leads to target directly
       ConversionPathAndCostType pathCostFromHere;
       pathCostFromHere.first.push_back(*representationRuleIt); // path
-      pathCostFromHere.second = (*representationRuleIt)->GetConversionCost(); // cost
+      pathCostFromHere.second = (*representationRuleIt)->GetEffectiveConversionCost(); // cost
       pathsCostsFromHere.push_back(pathCostFromHere);
       }
     else
@@ -382,7 +382,7 @@ void vtkSegmentationConverter::FindPath(const std::string& sourceRepresentationN
           {
           ConversionPathAndCostType pathCostFromHere;
           pathCostFromHere.first.push_back(*representationRuleIt); // path
-          pathCostFromHere.second = (*representationRuleIt)->GetConversionCost(); // cost
+          pathCostFromHere.second = (*representationRuleIt)->GetEffectiveConversionCost(); // cost
           pathCostFromHere.first.insert(pathCostFromHere.first.end(), pathCostFromNextIt->first.begin(), pathCostFromNextIt->first.end()); // path append
           pathCostFromHere.second += pathCostFromNextIt->second; // cost
           pathsCostsFromHere.push_back(pathCostFromHere);
@@ -540,9 +540,10 @@ void vtkSegmentationConverter::ApplyTransformOnReferenceImageGeometry(vtkAbstrac
   // Get current reference geometry parameter
   std::string geometryString = this->GetConversionParameter(vtkSegmentationConverter::GetReferenceImageGeometryParameterName());
 
-  // Deserialize parameter string into oriented image data
+  // Deserialize parameter string into oriented image data.
+  // Only the geometry is transformed below, so voxels are never allocated.
   vtkSmartPointer<vtkOrientedImageData> geometryImage = vtkSmartPointer<vtkOrientedImageData>::New();
-  if (!vtkSegmentationConverter::DeserializeImageGeometry(geometryString, geometryImage))
+  if (!vtkSegmentationConverter::DeserializeImageGeometry(geometryString, geometryImage, false /* do not allocate scalars */))
     {
     vtkErrorMacro("ApplyTransformOnReferenceImageGeometry: Failed to get reference image geometry");
     return;
@@ -56,6 +56,8 @@ public:
   /// Default representation types
   /// In binary and fractional labelmaps values <=0 are considered background voxels (outside), values>0 are foreground (inside).
   static const char* GetSegmentationBinaryLabelmapRepresentationName() { return "Binary labelmap"; };
+  static const char* GetSegmentationChunkedBinaryLabelmapRepresentationName() { return "Chunked binary labelmap"; };
+  static const char* GetSegmentationRunLengthBinaryLabelmapRepresentationName() { return "Run-length binary labelmap"; };
   static const char* GetSegmentationFractionalLabelmapRepresentationName() { return "Fractional labelmap"; };
   static const char* GetSegmentationPlanarContourRepresentationName() { return "Planar contour"; };
   static const char* GetSegmentationClosedSurfaceRepresentationName() { return "Closed surface"; };
@@ -22,7 +22,38 @@
 #include "vtkSegmentationConverterRule.h"
 
 // VTK includes
+#include <vtkMutexLock.h>
 #include <vtkObjectFactory.h>
+#include <vtkVariant.h>
+
+// STD includes
+#include <sstream>
+
+namespace
+{
+
+//----------------------------------------------------------------------------
+// Process-wide table of measured conversion durations, keyed by rule name.
+// Rules are cloned per segmentation and per conversion worker thread, so
+// measurements are shared through this table instead of rule instances.
+struct MeasuredCostType
+{
+  double AverageMs;
+  int SampleCount;
+};
+typedef std::map<std::string, MeasuredCostType> MeasuredCostMapType;
+MeasuredCostMapType MeasuredCosts;
+vtkSimpleMutexLock MeasuredCostsLock;
+
+// Once this many samples have been collected the running average becomes an
+// exponential moving average, so the cost model keeps adapting when the
+// typical data size changes
+const int MEASURED_COST_MAX_SAMPLE_WEIGHT = 10;
+
+static const std::string MEASURED_COST_SEPARATOR = "&";
+static const std::string MEASURED_COST_SEPARATOR_INNER = "|";
+
+} // end of anonymous namespace
 
 //----------------------------------------------------------------------------
 vtkSegmentationConverterRule::vtkSegmentationConverterRule()
@@ -82,3 +113,103 @@ bool vtkSegmentationConverterRule::HasConversionParameter(const std::string& nam
 {
   return (this->ConversionParameters.count(name) > 0);
 }
+
+//----------------------------------------------------------------------------
+unsigned int vtkSegmentationConverterRule::GetEffectiveConversionCost(
+  vtkDataObject* sourceRepresentation/*=NULL*/, vtkDataObject* targetRepresentation/*=NULL*/)
+{
+  unsigned int staticCost = this->GetConversionCost(sourceRepresentation, targetRepresentation);
+  if (staticCost >= vtkSegmentationConverterRule::GetConversionInfiniteCost())
+    {
+    // rule is disabled
+    return staticCost;
+    }
+  unsigned int measuredCost = this->GetMeasuredConversionCost();
+  if (measuredCost > 0)
+    {
+    return measuredCost;
+    }
+  return staticCost;
+}
+
+//----------------------------------------------------------------------------
+void vtkSegmentationConverterRule::RecordConversionDuration(double durationSec)
+{
+  double durationMs = durationSec * 1000.0;
+  MeasuredCostsLock.Lock();
+  MeasuredCostType& measuredCost = MeasuredCosts[this->GetName()];
+  if (measuredCost.SampleCount < MEASURED_COST_MAX_SAMPLE_WEIGHT)
+    {
+    ++measuredCost.SampleCount;
+    }
+  measuredCost.AverageMs += (durationMs - measuredCost.AverageMs) / measuredCost.SampleCount;
+  MeasuredCostsLock.Unlock();
+}
+
+//----------------------------------------------------------------------------
+unsigned int vtkSegmentationConverterRule::GetMeasuredConversionCost()
+{
+  unsigned int measuredCostMs = 0;
+  MeasuredCostsLock.Lock();
+  MeasuredCostMapType::iterator costIt = MeasuredCosts.find(this->GetName());
+  if (costIt != MeasuredCosts.end() && costIt->second.SampleCount > 0)
+    {
+    measuredCostMs = static_cast<unsigned int>(costIt->second.AverageMs + 0.5);
+    if (measuredCostMs == 0)
+      {
+      // a sub-millisecond measurement is still a measurement
+      measuredCostMs = 1;
+      }
+    }
+  MeasuredCostsLock.Unlock();
+  return measuredCostMs;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkSegmentationConverterRule::SerializeMeasuredConversionCosts()
+{
+  std::stringstream ssCosts;
+  MeasuredCostsLock.Lock();
+  MeasuredCostMapType::iterator costIt;
+  for (costIt = MeasuredCosts.begin(); costIt != MeasuredCosts.end(); ++costIt)
+    {
+    if (costIt->second.SampleCount <= 0)
+      {
+      continue;
+      }
+    ssCosts << costIt->first << MEASURED_COST_SEPARATOR_INNER << costIt->second.AverageMs
+      << MEASURED_COST_SEPARATOR_INNER << costIt->second.SampleCount << MEASURED_COST_SEPARATOR;
+    }
+  MeasuredCostsLock.Unlock();
+  return ssCosts.str();
+}
+
+//----------------------------------------------------------------------------
+void vtkSegmentationConverterRule::DeserializeMeasuredConversionCosts(const std::string& serializedCosts)
+{
+  std::string remainingCosts = serializedCosts;
+  size_t separatorPosition = remainingCosts.find(MEASURED_COST_SEPARATOR);
+  while (separatorPosition != std::string::npos)
+    {
+    std::string costString = remainingCosts.substr(0, separatorPosition);
+
+    size_t innerSeparatorPosition = costString.find(MEASURED_COST_SEPARATOR_INNER);
+    std::string ruleName = costString.substr(0, innerSeparatorPosition);
+    costString = costString.substr(innerSeparatorPosition + 1);
+    innerSeparatorPosition = costString.find(MEASURED_COST_SEPARATOR_INNER);
+    double averageMs = vtkVariant(costString.substr(0, innerSeparatorPosition)).ToDouble();
+    int sampleCount = vtkVariant(costString.substr(innerSeparatorPosition + 1)).ToInt();
+
+    if (!ruleName.empty() && sampleCount > 0 && averageMs >= 0.0)
+      {
+      MeasuredCostsLock.Lock();
+      MeasuredCostType& measuredCost = MeasuredCosts[ruleName];
+      measuredCost.AverageMs = averageMs;
+      measuredCost.SampleCount = sampleCount;
+      MeasuredCostsLock.Unlock();
+      }
+
+    remainingCosts = remainingCosts.substr(separatorPosition + 1);
+    separatorPosition = remainingCosts.find(MEASURED_COST_SEPARATOR);
+    }
+}
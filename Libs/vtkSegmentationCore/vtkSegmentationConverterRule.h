@@ -83,6 +83,24 @@ public:
   /// Update the target representation based on the source representation
   virtual bool Convert(vtkDataObject* sourceRepresentation, vtkDataObject* targetRepresentation) = 0;
 
+  /// Returns true if the rule can update just the part of an existing target
+  /// representation that is affected by a modified region of the source
+  /// representation (\sa ConvertModifiedRegion)
+  virtual bool SupportsRegionLimitedConversion() { return false; };
+
+  /// Update only the part of an existing target representation that is affected
+  /// by the given modified extent of the source representation (IJK voxel
+  /// coordinates of the source labelmap). Useful for giving fast feedback
+  /// after localized edits such as paint/erase strokes.
+  /// The default implementation ignores the extent and performs a full
+  /// conversion; rules that can do better override this.
+  virtual bool ConvertModifiedRegion(vtkDataObject* sourceRepresentation, vtkDataObject* targetRepresentation,
+    const int modifiedExtent[6])
+    {
+    (void)(modifiedExtent); // unused
+    return this->Convert(sourceRepresentation, targetRepresentation);
+    };
+
   /// Get the cost of the conversion.
   /// \return Expected duration of the conversion in milliseconds. If the arguments are omitted, then a rough average can be
   ///   given just to indicate the relative computational cost of the algorithm. If the objects are given, then a more educated
@@ -94,6 +112,39 @@ public:
     return 100;
     };
 
+  /// Cost used for conversion path selection: the measured average cost if at
+  /// least one conversion with this rule has been timed in this process
+  /// (\sa RecordConversionDuration), otherwise the static GetConversionCost()
+  /// estimate. Rules disabled with an infinite static cost stay disabled
+  /// regardless of measurements.
+  unsigned int GetEffectiveConversionCost(vtkDataObject* sourceRepresentation=NULL, vtkDataObject* targetRepresentation=NULL);
+
+  /// Record the duration of an executed conversion so that future path
+  /// selection can be based on measured performance on the current data and
+  /// machine instead of the static GetConversionCost() estimate.
+  /// Measurements are aggregated per rule name in a process-wide table
+  /// (shared by all clones of the rule) as a running average that weights
+  /// recent conversions more once enough samples have been collected, so the
+  /// cost model adapts when the typical data size changes.
+  /// Can be called from any thread.
+  /// \param durationSec Duration of the conversion in seconds
+  void RecordConversionDuration(double durationSec);
+
+  /// Get the measured average conversion cost of this rule in milliseconds,
+  /// or 0 if no conversion with this rule has been timed yet.
+  /// \sa RecordConversionDuration
+  unsigned int GetMeasuredConversionCost();
+
+  /// Serialize the measured conversion costs of all rules into a string that
+  /// the application can persist (e.g., in application settings) and restore
+  /// in a later session using \sa DeserializeMeasuredConversionCosts
+  static std::string SerializeMeasuredConversionCosts();
+
+  /// Restore measured conversion costs from a string created by
+  /// \sa SerializeMeasuredConversionCosts. Measurements already recorded in
+  /// this process are overwritten for the rules contained in the string.
+  static void DeserializeMeasuredConversionCosts(const std::string& serializedCosts);
+
   /// Human-readable name of the converter rule
   virtual const char* GetName() = 0;
 
@@ -20,17 +20,158 @@
 
 // SegmentationCore includes
 #include "vtkSegmentationHistory.h"
+#include "vtkSegmentationConverter.h"
 #include "vtkSegmentationConverterFactory.h"
 #include "vtkSegmentation.h"
+#include "vtkOrientedImageData.h"
 
 // VTK includes
+#include <vtkCallbackCommand.h>
+#include <vtkDataArray.h>
+#include <vtkFieldData.h>
+#include <vtkIntArray.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
-#include <vtkCallbackCommand.h>
+#include <vtkPointData.h>
+#include <vtkUnsignedCharArray.h>
+
+// STD includes
+#include <cstring>
+#include <vector>
 
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkSegmentationHistory);
 
+//----------------------------------------------------------------------------
+namespace
+{
+
+// Names of the field data arrays that carry the run-length encoded voxel
+// buffer of a stored labelmap while its scalar array is released.
+// Keeping the payload on the image object itself preserves the baseline
+// sharing between history states: states that share the labelmap object
+// automatically share its compressed form too.
+const char* RLE_SCALARS_ARRAY_NAME = "RLECompressedScalars";
+const char* RLE_INFO_ARRAY_NAME = "RLECompressedScalarsInfo";
+
+//----------------------------------------------------------------------------
+/// Replace the scalar array of a stored labelmap with a run-length
+/// encoded copy held in its field data. Labelmaps are dominated by long
+/// constant runs, so this typically shrinks a state by one to two orders
+/// of magnitude. The image is left untouched (and false is returned) if
+/// it has no scalars, is already compressed, or would not shrink.
+bool CompressLabelmapInPlace(vtkOrientedImageData* labelmap)
+{
+  if (labelmap == NULL)
+    {
+    return false;
+    }
+  if (labelmap->GetFieldData()->GetArray(RLE_SCALARS_ARRAY_NAME) != NULL)
+    {
+    // already compressed
+    return false;
+    }
+  vtkDataArray* scalars = labelmap->GetPointData()->GetScalars();
+  if (scalars == NULL || scalars->GetVoidPointer(0) == NULL)
+    {
+    return false;
+    }
+  vtkIdType numberOfBytes = scalars->GetNumberOfTuples()
+    * scalars->GetNumberOfComponents() * scalars->GetDataTypeSize();
+  if (numberOfBytes <= 0)
+    {
+    return false;
+    }
+  const unsigned char* source = (const unsigned char*)scalars->GetVoidPointer(0);
+
+  // Classic byte-wise (count, value) run-length encoding with runs capped
+  // at 255; give up as soon as the encoding stops being a win.
+  std::vector<unsigned char> encoded;
+  encoded.reserve(1024);
+  vtkIdType position = 0;
+  while (position < numberOfBytes)
+    {
+    unsigned char value = source[position];
+    vtkIdType run = 1;
+    while (run < 255 && position + run < numberOfBytes && source[position + run] == value)
+      {
+      ++run;
+      }
+    encoded.push_back((unsigned char)run);
+    encoded.push_back(value);
+    position += run;
+    if ((vtkIdType)encoded.size() >= numberOfBytes)
+      {
+      return false;
+      }
+    }
+
+  vtkNew<vtkUnsignedCharArray> encodedArray;
+  encodedArray->SetName(RLE_SCALARS_ARRAY_NAME);
+  encodedArray->SetNumberOfValues((vtkIdType)encoded.size());
+  memcpy(encodedArray->GetVoidPointer(0), &encoded[0], encoded.size());
+
+  // Scalar type and number of components cannot be recovered from the
+  // image once the scalar array is released, so remember them
+  vtkNew<vtkIntArray> infoArray;
+  infoArray->SetName(RLE_INFO_ARRAY_NAME);
+  infoArray->SetNumberOfValues(2);
+  infoArray->SetValue(0, labelmap->GetScalarType());
+  infoArray->SetValue(1, scalars->GetNumberOfComponents());
+
+  labelmap->GetFieldData()->AddArray(encodedArray.GetPointer());
+  labelmap->GetFieldData()->AddArray(infoArray.GetPointer());
+  labelmap->GetPointData()->SetScalars(NULL);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+/// Restore the scalar array of a labelmap compressed by
+/// CompressLabelmapInPlace and drop the compressed payload.
+/// Returns false if the image holds no compressed payload.
+bool DecompressLabelmapInPlace(vtkOrientedImageData* labelmap)
+{
+  if (labelmap == NULL)
+    {
+    return false;
+    }
+  vtkUnsignedCharArray* encodedArray = vtkUnsignedCharArray::SafeDownCast(
+    labelmap->GetFieldData()->GetArray(RLE_SCALARS_ARRAY_NAME));
+  vtkIntArray* infoArray = vtkIntArray::SafeDownCast(
+    labelmap->GetFieldData()->GetArray(RLE_INFO_ARRAY_NAME));
+  if (encodedArray == NULL || infoArray == NULL || infoArray->GetNumberOfValues() < 2)
+    {
+    return false;
+    }
+
+  labelmap->AllocateScalars(infoArray->GetValue(0), infoArray->GetValue(1));
+  vtkDataArray* scalars = labelmap->GetPointData()->GetScalars();
+  vtkIdType numberOfBytes = scalars->GetNumberOfTuples()
+    * scalars->GetNumberOfComponents() * scalars->GetDataTypeSize();
+  unsigned char* destination = (unsigned char*)scalars->GetVoidPointer(0);
+  const unsigned char* encoded = (const unsigned char*)encodedArray->GetVoidPointer(0);
+  vtkIdType encodedSize = encodedArray->GetNumberOfValues();
+
+  vtkIdType position = 0;
+  for (vtkIdType encodedPosition = 0; encodedPosition + 1 < encodedSize; encodedPosition += 2)
+    {
+    vtkIdType run = encoded[encodedPosition];
+    unsigned char value = encoded[encodedPosition + 1];
+    if (position + run > numberOfBytes)
+      {
+      run = numberOfBytes - position;
+      }
+    memset(destination + position, value, run);
+    position += run;
+    }
+
+  labelmap->GetFieldData()->RemoveArray(RLE_SCALARS_ARRAY_NAME);
+  labelmap->GetFieldData()->RemoveArray(RLE_INFO_ARRAY_NAME);
+  return true;
+}
+
+} // end anonymous namespace
+
 //----------------------------------------------------------------------------
 vtkSegmentationHistory::vtkSegmentationHistory()
 {
@@ -140,6 +281,22 @@ bool vtkSegmentationHistory::SaveState()
       }
     vtkSmartPointer<vtkSegment> segmentClone = vtkSmartPointer<vtkSegment>::New();
     CopySegment(segmentClone, segment, baselineSegment);
+
+    // Compress the stored binary labelmap if this state made a fresh copy.
+    // Unchanged labelmaps are shared with the previous state, which
+    // already holds them in compressed form, so states of untouched
+    // segments stay as cheap as before while modified labelmaps no
+    // longer keep a full voxel array per state.
+    std::string labelmapName = vtkSegmentationConverter::GetSegmentationBinaryLabelmapRepresentationName();
+    vtkOrientedImageData* cloneLabelmap =
+      vtkOrientedImageData::SafeDownCast(segmentClone->GetRepresentation(labelmapName));
+    vtkDataObject* baselineLabelmap =
+      baselineSegment != NULL ? baselineSegment->GetRepresentation(labelmapName) : NULL;
+    if (cloneLabelmap != NULL && cloneLabelmap != baselineLabelmap)
+      {
+      CompressLabelmapInPlace(cloneLabelmap);
+      }
+
     newSegmentationState.Segments[*segmentIDIt] = segmentClone;
     }
   this->SegmentationStates.push_back(newSegmentationState);
@@ -155,42 +312,7 @@ bool vtkSegmentationHistory::SaveState()
 //---------------------------------------------------------------------------
 void vtkSegmentationHistory::CopySegment(vtkSegment* destination, vtkSegment* source, vtkSegment* baseline)
 {
-  destination->RemoveAllRepresentations();
-  destination->DeepCopyMetadata(source);
-
-  // Copy representations
-  std::vector<std::string> representationNames;
-  source->GetContainedRepresentationNames(representationNames);
-  for (std::vector<std::string>::iterator representationNameIt = representationNames.begin();
-    representationNameIt != representationNames.end(); ++representationNameIt)
-    {
-    vtkDataObject* sourceRepresentation = source->GetRepresentation(*representationNameIt);
-    vtkDataObject* baselineRepresentation = NULL;
-    if (baseline)
-      {
-      baselineRepresentation = baseline->GetRepresentation(*representationNameIt);
-      }
-    // Shallow-copy from baseline if it's up-to-date, otherwise deep-copy from source
-    if (baselineRepresentation != NULL
-      && baselineRepresentation->GetMTime() > sourceRepresentation->GetMTime())
-      {
-      // we already have an up-to-date copy in the baseline, so reuse that
-      destination->AddRepresentation(*representationNameIt, baselineRepresentation);
-      }
-    else
-      {
-      vtkDataObject* representationCopy =
-        vtkSegmentationConverterFactory::GetInstance()->ConstructRepresentationObjectByClass(sourceRepresentation->GetClassName());
-      if (!representationCopy)
-        {
-        vtkErrorMacro("DeepCopy: Unable to construct representation type class '" << sourceRepresentation->GetClassName() << "'");
-        continue;
-        }
-      representationCopy->DeepCopy(sourceRepresentation);
-      destination->AddRepresentation(*representationNameIt, representationCopy);
-      representationCopy->Delete(); // this representation is now owned by the segment
-      }
-    }
+  destination->DeepCopyWithBaseline(source, baseline);
 }
 
 //---------------------------------------------------------------------------
@@ -252,6 +374,15 @@ bool vtkSegmentationHistory::RestoreState(unsigned int stateIndex)
     restoredSegmentsIt != restoredState.Segments.end(); ++restoredSegmentsIt)
     {
     segmentIDsToKeep.insert(restoredSegmentsIt->first);
+
+    // Bring a compressed stored labelmap back to its full voxel array for
+    // the duration of the copy, then compress it again so the state keeps
+    // its small footprint
+    vtkOrientedImageData* storedLabelmap = vtkOrientedImageData::SafeDownCast(
+      restoredSegmentsIt->second->GetRepresentation(
+        vtkSegmentationConverter::GetSegmentationBinaryLabelmapRepresentationName()));
+    bool labelmapWasCompressed = DecompressLabelmapInPlace(storedLabelmap);
+
     vtkSegment* segment = this->Segmentation->GetSegment(restoredSegmentsIt->first);
     if (segment != NULL)
       {
@@ -264,6 +395,11 @@ bool vtkSegmentationHistory::RestoreState(unsigned int stateIndex)
       newSegment->DeepCopy(restoredSegmentsIt->second);
       this->Segmentation->AddSegment(newSegment);
       }
+
+    if (labelmapWasCompressed)
+      {
+      CompressLabelmapInPlace(storedLabelmap);
+      }
     }
 
   // Removed segments that were not in the restored state
@@ -452,6 +452,32 @@ static void vtkDiffusionTensorMathematicsExecute1Eigen(vtkDiffusionTensorMathema
   // decide whether to extract eigenfunctions or just use input cols
   extractEigenvalues = self->GetExtractEigenvalues();
 
+  // Eigenvectors are only needed for the directional operations. For the
+  // purely eigenvalue-based measures (FA, diffusivities, eigenvalues, ...)
+  // let the solver skip the eigenvector computation, which substantially
+  // reduces the per-voxel cost.
+  int needEigenvectors;
+  switch (op)
+    {
+    case vtkDiffusionTensorMathematics::VTK_TENS_MAX_EIGENVALUE_PROJX:
+    case vtkDiffusionTensorMathematics::VTK_TENS_MAX_EIGENVALUE_PROJY:
+    case vtkDiffusionTensorMathematics::VTK_TENS_MAX_EIGENVALUE_PROJZ:
+    case vtkDiffusionTensorMathematics::VTK_TENS_RAI_MAX_EIGENVEC_PROJX:
+    case vtkDiffusionTensorMathematics::VTK_TENS_RAI_MAX_EIGENVEC_PROJY:
+    case vtkDiffusionTensorMathematics::VTK_TENS_RAI_MAX_EIGENVEC_PROJZ:
+    case vtkDiffusionTensorMathematics::VTK_TENS_MAX_EIGENVEC_PROJX:
+    case vtkDiffusionTensorMathematics::VTK_TENS_MAX_EIGENVEC_PROJY:
+    case vtkDiffusionTensorMathematics::VTK_TENS_MAX_EIGENVEC_PROJZ:
+    case vtkDiffusionTensorMathematics::VTK_TENS_COLOR_ORIENTATION:
+    case vtkDiffusionTensorMathematics::VTK_TENS_COLOR_ORIENTATION_MIDDLE_EIGENVECTOR:
+    case vtkDiffusionTensorMathematics::VTK_TENS_COLOR_ORIENTATION_MIN_EIGENVECTOR:
+      needEigenvectors = 1;
+      break;
+    default:
+      needEigenvectors = 0;
+      break;
+    }
+
   // transformation of tensor orientations for coloring
   vtkTransform *trans = vtkTransform::New();
   int useTransform = 0;
@@ -526,17 +552,36 @@ static void vtkDiffusionTensorMathematicsExecute1Eigen(vtkDiffusionTensorMathema
           // get eigenvalues and eigenvectors appropriately
           if (extractEigenvalues)
             {
-            for (j=0; j<3; j++)
+            // Most voxels in a typical DTI volume are background with an
+            // all-zero tensor: the eigensystem is known without running the
+            // solver.
+            if (tensor[0][0] == 0. && tensor[0][1] == 0. && tensor[0][2] == 0. &&
+                tensor[1][0] == 0. && tensor[1][1] == 0. && tensor[1][2] == 0. &&
+                tensor[2][0] == 0. && tensor[2][1] == 0. && tensor[2][2] == 0.)
+              {
+              w[0] = w[1] = w[2] = 0.;
+              for (j=0; j<3; j++)
+                {
+                for (i=0; i<3; i++)
+                  {
+                  v[i][j] = (i == j) ? 1. : 0.;
+                  }
+                }
+              }
+            else
               {
-              for (i=0; i<3; i++)
+              for (j=0; j<3; j++)
                 {
-                // transpose
-                m[i][j] = tensor[j][i];
+                for (i=0; i<3; i++)
+                  {
+                  // transpose
+                  m[i][j] = tensor[j][i];
+                  }
                 }
+              // compute eigensystem
+              //vtkMath::Jacobi(m, w, v);
+              vtkDiffusionTensorMathematics::TeemEigenSolver(m,w,needEigenvectors ? v : NULL);
               }
-            // compute eigensystem
-            //vtkMath::Jacobi(m, w, v);
-            vtkDiffusionTensorMathematics::TeemEigenSolver(m,w,v);
             }
           else
             {
@@ -30,41 +30,41 @@ int vtkPrincipalAxesAlign::RequestData(vtkInformation* vtkNotUsed(request),
   vtkPolyData *         input = vtkPolyData::GetData(inInfoVec[0]);
 
   vtkIdType             nr_points = input->GetNumberOfPoints();
-  double* x;
+  double x[3];
 
   int i;
 
-  // reset the intermediate arrays
-  for( i = 0; i < 3; i++ )
-    {
-    Center[i] = 0;
-    }
-  for( i = 0; i < 3; i++ )
-    {
-    for( int j = 0; j < 3; j++ )
-      {
-      eigenvalueProblem[i][j] = 0;
-      }
-    }
-  for( i = 0; i < 3; i++ )
-    {
-    for( int j = 0; j < 3; j++ )
-      {
-      eigenvalueProblemDiag[i][j] = 0;
-      }
-    }
-  // compute the center
-  for( vtkIdType j = 0; j < input->GetNumberOfPoints(); j++ )
+  // Accumulate the point sums and the raw second moments in a single pass.
+  // The sums are kept in local scalars so that the compiler can hold them
+  // in registers (and vectorize the loop) instead of writing the
+  // heap-allocated matrix storage back on every point.
+  double sumX = 0.0, sumY = 0.0, sumZ = 0.0;
+  double sumXX = 0.0, sumXY = 0.0, sumXZ = 0.0;
+  double sumYY = 0.0, sumYZ = 0.0, sumZZ = 0.0;
+  for( vtkIdType m = 0; m < nr_points; m++ )
     {
-    x = input->GetPoint(j);
-    Center[0] += x[0];
-    Center[1] += x[1];
-    Center[2] += x[2];
-    }
-
-  Center[0] =   Center[0] / nr_points;
-  Center[1] =   Center[1] / nr_points;
-  Center[2] =   Center[2] / nr_points;
+    input->GetPoint(m, x);
+    sumX += x[0];
+    sumY += x[1];
+    sumZ += x[2];
+    sumXX += x[0] * x[0];
+    sumXY += x[0] * x[1];
+    sumXZ += x[0] * x[2];
+    sumYY += x[1] * x[1];
+    sumYZ += x[1] * x[2];
+    sumZZ += x[2] * x[2];
+    }
+
+  Center[0] = sumX / nr_points;
+  Center[1] = sumY / nr_points;
+  Center[2] = sumZ / nr_points;
+
+  eigenvalueProblemDiag[0][0] = sumXX;
+  eigenvalueProblemDiag[0][1] = sumXY;
+  eigenvalueProblemDiag[0][2] = sumXZ;
+  eigenvalueProblemDiag[1][1] = sumYY;
+  eigenvalueProblemDiag[1][2] = sumYZ;
+  eigenvalueProblemDiag[2][2] = sumZZ;
 
   // create the eigenvalue-problem
   // using the symmetry of the result matrix
@@ -72,25 +72,8 @@ int vtkPrincipalAxesAlign::RequestData(vtkInformation* vtkNotUsed(request),
     {
     for( int j = i; j < 3; j++ )
       {
-      eigenvalueProblem[i][j] = -Center[i] * nr_points * Center[j];
-      }
-    }
-  for( vtkIdType m = 0; m < nr_points; m++ )
-    {
-    x = input->GetPoint(m);
-    for( i = 0; i < 3; i++ )
-      {
-      for( int j = i; j < 3; j++ )
-        {
-        eigenvalueProblemDiag[i][j] +=  x[i] * x[j];
-        }
-      }
-    }
-  for( i = 0; i < 3; i++ )
-    {
-    for( int j = i; j < 3; j++ )
-      {
-      eigenvalueProblem[i][j] += eigenvalueProblemDiag[i][j];
+      eigenvalueProblem[i][j] =
+        eigenvalueProblemDiag[i][j] - Center[i] * nr_points * Center[j];
       }
     }
   for( i = 0; i < 3; i++ )
@@ -98,6 +81,7 @@ int vtkPrincipalAxesAlign::RequestData(vtkInformation* vtkNotUsed(request),
     for( int j = 0; j < i; j++ )
       {
       eigenvalueProblem[i][j] = eigenvalueProblem[j][i];
+      eigenvalueProblemDiag[i][j] = eigenvalueProblemDiag[j][i];
       }
     }
   vtkMath::Jacobi(eigenvalueProblem, eigenvalues, eigenvectors);
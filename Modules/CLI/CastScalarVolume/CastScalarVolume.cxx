@@ -59,6 +59,9 @@ int DoIt( int argc, char * argv[], Tin, Tout )
                                        CLPProcessInformation);
 
   filter->SetInput( 0, reader1->GetOutput() );
+  // Let the cast reuse the input pixel buffer when input and output pixel
+  // types have the same size, avoiding a second full copy of the volume.
+  filter->InPlaceOn();
 
   typename WriterType::Pointer writer = WriterType::New();
   itk::PluginFilterWatcher watchWriter(writer,
@@ -67,6 +70,11 @@ int DoIt( int argc, char * argv[], Tin, Tout )
   writer->SetFileName( OutputVolume.c_str() );
   writer->SetInput( filter->GetOutput() );
   writer->SetUseCompression(1);
+  // Read, cast and write the volume in slabs so that peak memory is bounded
+  // by one slab instead of the whole volume. Streaming takes effect when the
+  // input and output file formats support streamed access (e.g. uncompressed
+  // MetaImage); otherwise the writer falls back to a single pass.
+  writer->SetNumberOfStreamDivisions(10);
   writer->Update();
   return EXIT_SUCCESS;
 }
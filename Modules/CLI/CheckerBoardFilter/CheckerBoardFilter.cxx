@@ -78,6 +78,11 @@ int DoIt( int argc, char * argv[], T )
 
   writer->SetInput( filter->GetOutput() );
   writer->SetUseCompression(1);
+  // Let the writer pull the checkerboard through in slabs when the output
+  // format supports streamed writing, so the whole composited volume does
+  // not have to be held in memory at once. Formats that cannot stream
+  // (e.g. compressed output) fall back to a single pass automatically.
+  writer->SetNumberOfStreamDivisions(10);
   writer->Update();
 
   return EXIT_SUCCESS;
@@ -295,6 +295,12 @@ int DoIt( int argc, char *argv[] )
     std::cout << "###sampleFromOverlap: " << sampleFromOverlap << std::endl;
     }
 
+  reger->SetSampleSalientPortion( sampleSalientPortion );
+  if( verbosity >= STANDARD )
+    {
+    std::cout << "###sampleSalientPortion: " << sampleSalientPortion << std::endl;
+    }
+
   typedef typename itk::ImageFileReader<itk::Image<unsigned char, DimensionT> > ImageReader;
   typedef typename itk::ImageMaskSpatialObject<DimensionT>                      ImageMaskSpatialObject;
 
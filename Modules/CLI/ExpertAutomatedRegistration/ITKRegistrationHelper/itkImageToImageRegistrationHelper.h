@@ -191,6 +191,11 @@ public:
   itkSetMacro( SampleIntensityPortion, double );
   itkGetConstMacro( SampleIntensityPortion, double );
 
+  //  Restrict metric samples to the portion (0,1] of fixed image voxels
+  //  with the highest gradient magnitude; 0 disables
+  itkSetMacro( SampleSalientPortion, double );
+  itkGetConstMacro( SampleSalientPortion, double );
+
   // **************
   // **************
   //  Update
@@ -446,6 +451,7 @@ private:
 
   bool   m_SampleFromOverlap;
   double m_SampleIntensityPortion;
+  double m_SampleSalientPortion;
 
   bool                                  m_UseFixedImageMaskObject;
   typename MaskObjectType::ConstPointer m_FixedImageMaskObject;
@@ -48,6 +48,7 @@ ImageToImageRegistrationHelper<TImage>
 
   m_SampleFromOverlap = false;
   m_SampleIntensityPortion = 0.0;
+  m_SampleSalientPortion = 0.0;
 
   // Masks
   m_UseFixedImageMaskObject = false;
@@ -424,6 +425,7 @@ ImageToImageRegistrationHelper<TImage>
     regRigid->SetNumberOfSamples( (unsigned int)( m_RigidSamplingRatio
                                                   * fixedImageNumPixels ) );
     regRigid->SetSampleFromOverlap( m_SampleFromOverlap );
+    regRigid->SetSampleSalientPortion( m_SampleSalientPortion );
     regRigid->SetMinimizeMemory( m_MinimizeMemory );
     regRigid->SetMaxIterations( m_RigidMaxIterations );
     regRigid->SetTargetError( m_RigidTargetError );
@@ -549,6 +551,7 @@ ImageToImageRegistrationHelper<TImage>
       regAff->SetRegionOfInterest( m_RegionOfInterestPoint1, m_RegionOfInterestPoint2 );
       }
     regAff->SetSampleFromOverlap( m_SampleFromOverlap );
+    regAff->SetSampleSalientPortion( m_SampleSalientPortion );
     regAff->SetMinimizeMemory( m_MinimizeMemory );
     regAff->SetMaxIterations( m_AffineMaxIterations );
     regAff->SetTargetError( m_AffineTargetError );
@@ -674,6 +677,7 @@ ImageToImageRegistrationHelper<TImage>
       regBspline->SetRegionOfInterest( m_RegionOfInterestPoint1, m_RegionOfInterestPoint2 );
       }
     regBspline->SetSampleFromOverlap( m_SampleFromOverlap );
+    regBspline->SetSampleSalientPortion( m_SampleSalientPortion );
     regBspline->SetMinimizeMemory( m_MinimizeMemory );
     regBspline->SetMaxIterations( m_BSplineMaxIterations );
     regBspline->SetTargetError( m_BSplineTargetError );
@@ -115,6 +115,14 @@ public:
 
   itkGetConstMacro( FixedImageSamplesIntensityThreshold, PixelType );
 
+  /** Restrict metric samples to the given portion (0,1] of the fixed image
+   * voxels with the highest gradient magnitude.  The gradient magnitude
+   * image is computed once before the optimization starts, so every metric
+   * evaluation draws its samples from high-information voxels only.
+   * 0 (default) disables the saliency-based sampling. */
+  itkSetMacro( SampleSalientPortion, double );
+  itkGetConstMacro( SampleSalientPortion, double );
+
   itkSetMacro( TargetError, double );
   itkGetConstMacro( TargetError, double );
 
@@ -171,6 +179,8 @@ private:
   bool      m_UseFixedImageSamplesIntensityThreshold;
   PixelType m_FixedImageSamplesIntensityThreshold;
 
+  double m_SampleSalientPortion;
+
   double m_TargetError;
 
   int m_RandomNumberSeed;
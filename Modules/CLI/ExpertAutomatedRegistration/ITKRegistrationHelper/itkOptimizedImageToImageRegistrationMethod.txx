@@ -43,6 +43,8 @@
 #include "itkImageMaskSpatialObject.h"
 
 #include "itkImage.h"
+#include "itkGradientMagnitudeImageFilter.h"
+#include "itkMinimumMaximumImageCalculator.h"
 #include <itkConstantBoundaryCondition.h>
 
 
@@ -163,6 +165,7 @@ OptimizedImageToImageRegistrationMethod<TImage>
   m_NumberOfSamples = 100000;
   m_FixedImageSamplesIntensityThreshold = 0;
   m_UseFixedImageSamplesIntensityThreshold = false;
+  m_SampleSalientPortion = 0;
 
   m_TargetError = 0.00001;
 
@@ -254,6 +257,7 @@ OptimizedImageToImageRegistrationMethod<TImage>
   if( this->GetUseRegionOfInterest() ||
       this->GetSampleFromOverlap() ||
       this->GetUseFixedImageSamplesIntensityThreshold() ||
+      this->GetSampleSalientPortion() > 0 ||
       this->GetUseFixedImageMaskObject() )
     {
     if( this->GetReportProgress() )
@@ -261,6 +265,60 @@ OptimizedImageToImageRegistrationMethod<TImage>
       std::cout << "Creating fixed image samples" << std::endl;
       }
 
+    // Precompute a saliency index of the fixed image: the gradient magnitude
+    // is computed once and thresholded at the percentile that keeps the
+    // requested portion of voxels, so that the metric samples are drawn from
+    // high-information voxels only.  The threshold is found with a histogram
+    // over the gradient magnitude range to avoid sorting the whole volume.
+    typedef itk::Image<float, itkGetStaticConstMacro( ImageDimension )> GradientImageType;
+    typename GradientImageType::Pointer gradientImage;
+    float gradientThreshold = 0;
+    if( this->GetSampleSalientPortion() > 0 )
+      {
+      typedef itk::GradientMagnitudeImageFilter<ImageType, GradientImageType>
+        GradientFilterType;
+      typename GradientFilterType::Pointer gradientFilter = GradientFilterType::New();
+      gradientFilter->SetInput( fixedImage );
+      gradientFilter->Update();
+      gradientImage = gradientFilter->GetOutput();
+
+      typedef itk::MinimumMaximumImageCalculator<GradientImageType> MinMaxCalcType;
+      typename MinMaxCalcType::Pointer minMaxCalc = MinMaxCalcType::New();
+      minMaxCalc->SetImage( gradientImage );
+      minMaxCalc->Compute();
+      float gradientMax = minMaxCalc->GetMaximum();
+      if( gradientMax > 0 )
+        {
+        const unsigned int numberOfBins = 1024;
+        std::vector<itk::SizeValueType> histogram( numberOfBins, 0 );
+        itk::ImageRegionConstIterator<GradientImageType> gradIter( gradientImage,
+                                                                   gradientImage->GetLargestPossibleRegion() );
+        itk::SizeValueType numberOfVoxels = 0;
+        for( gradIter.GoToBegin(); !gradIter.IsAtEnd(); ++gradIter )
+          {
+          unsigned int bin = static_cast<unsigned int>( gradIter.Get()
+                                                        / gradientMax * ( numberOfBins - 1 ) );
+          ++histogram[bin];
+          ++numberOfVoxels;
+          }
+        itk::SizeValueType targetCount = static_cast<itk::SizeValueType>(
+          this->GetSampleSalientPortion() * numberOfVoxels );
+        itk::SizeValueType cumulativeCount = 0;
+        unsigned int bin = numberOfBins;
+        while( bin > 0 && cumulativeCount < targetCount )
+          {
+          --bin;
+          cumulativeCount += histogram[bin];
+          }
+        gradientThreshold = static_cast<float>( bin ) / ( numberOfBins - 1 ) * gradientMax;
+        }
+      if( this->GetReportProgress() )
+        {
+        std::cout << "...Salient sampling, gradient threshold = "
+                  << gradientThreshold << std::endl;
+        }
+      }
+
     itk::ImageRegionConstIteratorWithIndex<ImageType> iter( fixedImage,
                                                             fixedImage->GetLargestPossibleRegion() );
     typename ImageType::IndexType index;
@@ -289,6 +347,13 @@ OptimizedImageToImageRegistrationMethod<TImage>
           continue;
           }
         }
+      if( gradientImage.IsNotNull() )
+        {
+        if( gradientImage->GetPixel( index ) < gradientThreshold )
+          {
+          continue;
+          }
+        }
       if( this->GetUseFixedImageMaskObject() )
         {
         double val;
@@ -357,6 +422,13 @@ OptimizedImageToImageRegistrationMethod<TImage>
           continue;
           }
         }
+      if( gradientImage.IsNotNull() )
+        {
+        if( gradientImage->GetPixel( index ) < gradientThreshold )
+          {
+          continue;
+          }
+        }
       if( this->GetUseFixedImageMaskObject() )
         {
         double val;
@@ -673,6 +745,8 @@ OptimizedImageToImageRegistrationMethod<TImage>
 
   os << indent << "Samples threshold = " << m_FixedImageSamplesIntensityThreshold << std::endl;
 
+  os << indent << "Sample Salient Portion = " << m_SampleSalientPortion << std::endl;
+
   os << indent << "Target Error = " << m_TargetError << std::endl;
 
   switch( m_MetricMethodEnum )
@@ -695,8 +695,58 @@ void tilg_iso_3D(int dx, int dy, int dz,
   f_tab[16] =   131072;    /* 17 */
   f_tab[17] =      512;    /*  9 */
 
+  /* Determine the bounding box of the object voxels. Thinning only ever
+     deletes voxels, so the box stays valid for all passes, and scanning can
+     be restricted to it instead of the full volume. The box lies within the
+     cleared one-voxel border, so all neighborhood accesses stay in bounds. */
+  int x0 = nx, x1 = -1;
+  int y0 = ny, y1 = -1;
+  int z0 = nz, z1 = -1;
+  for( z = 1; z < nz - 1; z++ )
+    {
+    for( y = 1; y < ny - 1; y++ )
+      {
+      i = nx * (y + z * ny);
+      for( x = 1; x < nx - 1; x++ )
+        {
+        if( result[i + x] == OBJ )
+          {
+          if( x < x0 )
+            {
+            x0 = x;
+            }
+          if( x > x1 )
+            {
+            x1 = x;
+            }
+          if( y < y0 )
+            {
+            y0 = y;
+            }
+          if( y > y1 )
+            {
+            y1 = y;
+            }
+          if( z < z0 )
+            {
+            z0 = z;
+            }
+          if( z > z1 )
+            {
+            z1 = z;
+            }
+          }
+        }
+      }
+    }
+  if( x1 < 0 )
+    {
+    /* no object voxels */
+    free(list);
+    return;
+    }
+
   /* eigentliches Bildparsing */
-  end = end - nzz - nx - 1;
   cnt = 1;
   while( cnt )
     {
@@ -705,18 +755,25 @@ void tilg_iso_3D(int dx, int dy, int dz,
       {
       cnt1 = 0;
       dir_mask = dir_tab[dir];
-      for( i = nzz + nx + 1; i < end; i++ )
+      for( z = z0; z <= z1; z++ )
         {
-        if( result[i] == OBJ )
+        for( y = y0; y <= y1; y++ )
           {
-          nc = Env_Code_3(i);
-          if( ( (~ nc) & dir_mask) == dir_mask )
+          i = x0 + nx * (y + z * ny);
+          for( x = x0; x <= x1; x++, i++ )
             {
-            if( bitcount(nc) > 2 )
+            if( result[i] == OBJ )
               {
-              if( Tilg_Test_3(nc, dir, type) == BG )
+              nc = Env_Code_3(i);
+              if( ( (~ nc) & dir_mask) == dir_mask )
                 {
-                list[cnt1++] = i;
+                if( bitcount(nc) > 2 )
+                  {
+                  if( Tilg_Test_3(nc, dir, type) == BG )
+                    {
+                    list[cnt1++] = i;
+                    }
+                  }
                 }
               }
             }
@@ -736,17 +793,24 @@ void tilg_iso_3D(int dx, int dy, int dz,
   while( cnt )
     {
     cnt = 0;
-    for( i = nzz + nx + 1; i < end; i++ )
+    for( z = z0; z <= z1; z++ )
       {
-      if( result[i] == OBJ )
+      for( y = y0; y <= y1; y++ )
         {
-        nc = Env_Code_3(i);
-        if( bitcount(nc) > 2 )
+        i = x0 + nx * (y + z * ny);
+        for( x = x0; x <= x1; x++, i++ )
           {
-          if( Tilg_Test_3(nc, 18, type) == BG )
+          if( result[i] == OBJ )
             {
-            cnt++;
-            result[i] = BG;
+            nc = Env_Code_3(i);
+            if( bitcount(nc) > 2 )
+              {
+              if( Tilg_Test_3(nc, 18, type) == BG )
+                {
+                cnt++;
+                result[i] = BG;
+                }
+              }
             }
           }
         }
@@ -9,7 +9,7 @@
 #include <itkTransformFileWriter.h>
 
 // STD includes
-#include <numeric>
+#include <algorithm>
 
 namespace
 {
@@ -59,25 +59,23 @@ namespace
     const itk::Point<double, 3>& fixedcenter,
     const itk::Point<double, 3>& movingcenter)
   {
-    std::vector<double> centeredFixedPoints(fixedPoints.size(), 0.0);
-    std::vector<double> centeredMovingPoints(movingPoints.size(), 0.0);
-
-    std::transform(fixedPoints.begin(), fixedPoints.end(),
-      centeredFixedPoints.begin(),
-      SquaredPointDistance(fixedcenter) );
-
-    std::transform(movingPoints.begin(), movingPoints.end(),
-      centeredMovingPoints.begin(),
-      SquaredPointDistance(movingcenter) );
+    // Accumulate the squared distances directly instead of materializing
+    // them in temporary vectors first
+    SquaredPointDistance fixedDistance(fixedcenter);
+    SquaredPointDistance movingDistance(movingcenter);
 
     double fixedmag = 0.0, movingmag = 0.0;
-    fixedmag = std::accumulate(centeredFixedPoints.begin(),
-      centeredFixedPoints.end(),
-      fixedmag);
+    for( std::vector<itk::Point<double, 3> >::const_iterator it = fixedPoints.begin();
+      it != fixedPoints.end(); ++it )
+    {
+      fixedmag += fixedDistance(*it);
+    }
 
-    movingmag = std::accumulate(centeredMovingPoints.begin(),
-      centeredMovingPoints.end(),
-      movingmag);
+    for( std::vector<itk::Point<double, 3> >::const_iterator it = movingPoints.begin();
+      it != movingPoints.end(); ++it )
+    {
+      movingmag += movingDistance(*it);
+    }
 
     return sqrt(movingmag / fixedmag);
   }
@@ -1,5 +1,6 @@
 #include "itkImageFileWriter.h"
 
+#include "itkDiscreteGaussianImageFilter.h"
 #include "itkSmoothingRecursiveGaussianImageFilter.h"
 
 #include "itkPluginUtilities.h"
@@ -28,22 +29,53 @@ int DoIt( int argc, char * argv[], T )
   typedef itk::ImageFileReader<InputImageType>  ReaderType;
   typedef itk::ImageFileWriter<OutputImageType> WriterType;
 
-  typedef itk::SmoothingRecursiveGaussianImageFilter<
-    InputImageType, OutputImageType>  FilterType;
-
   typename ReaderType::Pointer reader = ReaderType::New();
 
   reader->SetFileName( inputVolume.c_str() );
-
-  typename FilterType::Pointer filter = FilterType::New();
-  filter->SetInput( reader->GetOutput() );
-  filter->SetSigma( sigma );
+  reader->UpdateOutputInformation();
 
   typename WriterType::Pointer writer = WriterType::New();
   writer->SetFileName( outputVolume.c_str() );
-  writer->SetInput( filter->GetOutput() );
-  writer->SetUseCompression(1);
-  writer->Update();
+
+  // The cost of the separable FIR discrete Gaussian grows linearly with
+  // sigma (kernel width), while the recursive IIR approximation costs the
+  // same for any sigma. Use the more accurate FIR filter while the kernel
+  // stays a few voxels wide and switch to the recursive filter beyond that.
+  const typename InputImageType::SpacingType & spacing =
+    reader->GetOutput()->GetSpacing();
+  double minSpacing = spacing[0];
+  for( unsigned int dim = 1; dim < InputImageType::ImageDimension; ++dim )
+    {
+    minSpacing = std::min( minSpacing, double(spacing[dim]) );
+    }
+
+  if( sigma <= 2.0 * minSpacing )
+    {
+    typedef itk::DiscreteGaussianImageFilter<
+      InputImageType, OutputImageType> DiscreteFilterType;
+
+    typename DiscreteFilterType::Pointer filter = DiscreteFilterType::New();
+    filter->SetInput( reader->GetOutput() );
+    filter->SetVariance( sigma * sigma );
+    filter->SetUseImageSpacingOn();
+
+    writer->SetInput( filter->GetOutput() );
+    writer->SetUseCompression(1);
+    writer->Update();
+    }
+  else
+    {
+    typedef itk::SmoothingRecursiveGaussianImageFilter<
+      InputImageType, OutputImageType>  FilterType;
+
+    typename FilterType::Pointer filter = FilterType::New();
+    filter->SetInput( reader->GetOutput() );
+    filter->SetSigma( sigma );
+
+    writer->SetInput( filter->GetOutput() );
+    writer->SetUseCompression(1);
+    writer->Update();
+    }
 
   return EXIT_SUCCESS;
 }
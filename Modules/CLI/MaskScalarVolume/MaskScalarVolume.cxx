@@ -82,16 +82,16 @@ int DoIt( int argc, char * argv[] )
   thresholdFilter->ThresholdOutside(Label, Label);
   thresholdFilter->ReleaseDataFlagOn();
 
-  typename Interpolator::Pointer interp = Interpolator::New();
-  interp->SetInputImage(thresholdFilter->GetOutput() );
+  // If the mask volume already matches the geometry of the input volume, the
+  // resampling step (and its full-size intermediate image) can be skipped and
+  // the thresholded mask can be used directly.
+  bool sameGeometry =
+    reader2->GetOutput()->GetLargestPossibleRegion() == reader1->GetOutput()->GetLargestPossibleRegion()
+    && reader2->GetOutput()->GetOrigin() == reader1->GetOutput()->GetOrigin()
+    && reader2->GetOutput()->GetSpacing() == reader1->GetOutput()->GetSpacing()
+    && reader2->GetOutput()->GetDirection() == reader1->GetOutput()->GetDirection();
 
   typename ResampleType::Pointer resample = ResampleType::New();
-  resample->SetInput(thresholdFilter->GetOutput() );
-  resample->SetOutputParametersFromImage(reader1->GetOutput() );
-  resample->SetInterpolator( interp );
-  resample->SetDefaultPixelValue( 0 );
-  resample->ReleaseDataFlagOn();
-
   itk::PluginFilterWatcher watchResample(resample, "Resampling",
                                          CLPProcessInformation);
 
@@ -101,7 +101,23 @@ int DoIt( int argc, char * argv[] )
                                        CLPProcessInformation);
 
   filter->SetInput( 0, reader1->GetOutput() );
-  filter->SetInput( 1, resample->GetOutput() );
+  if( sameGeometry )
+    {
+    filter->SetInput( 1, thresholdFilter->GetOutput() );
+    }
+  else
+    {
+    typename Interpolator::Pointer interp = Interpolator::New();
+    interp->SetInputImage(thresholdFilter->GetOutput() );
+
+    resample->SetInput(thresholdFilter->GetOutput() );
+    resample->SetOutputParametersFromImage(reader1->GetOutput() );
+    resample->SetInterpolator( interp );
+    resample->SetDefaultPixelValue( 0 );
+    resample->ReleaseDataFlagOn();
+
+    filter->SetInput( 1, resample->GetOutput() );
+    }
   filter->SetOutsideValue( Replace );
 
   typename WriterType::Pointer writer = WriterType::New();
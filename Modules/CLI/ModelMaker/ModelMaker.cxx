@@ -40,6 +40,7 @@ Version:   $Revision$
   #include <vtkDiscreteMarchingCubes.h>
   #include <vtkMarchingCubes.h>
 #endif
+#include <vtkExtractVOI.h>
 #include <vtkGeometryFilter.h>
 #include <vtkImageAccumulate.h>
 #include <vtkImageChangeInformation.h>
@@ -67,6 +68,63 @@ Version:   $Revision$
 // VTKsys includes
 #include <vtksys/SystemTools.hxx>
 
+// STD includes
+#include <map>
+
+//----------------------------------------------------------------------------
+// Bounding box, in image extent coordinates, of one label value. Expanded
+// as label voxels are encountered while scanning the volume.
+struct LabelExtent
+{
+  int Extent[6];
+};
+
+//----------------------------------------------------------------------------
+// One pass over the scalars recording the bounding box of every non-zero
+// label, so that each model can be generated from a cropped region of
+// interest instead of the full volume.
+template <class T>
+void ComputeLabelExtents(vtkImageData* image, T* scalars,
+                         std::map<int, LabelExtent>& labelExtents)
+{
+  int extent[6];
+  image->GetExtent(extent);
+  T* ptr = scalars;
+  for (int z = extent[4]; z <= extent[5]; z++)
+    {
+    for (int y = extent[2]; y <= extent[3]; y++)
+      {
+      for (int x = extent[0]; x <= extent[1]; x++)
+        {
+        int label = (int)(*ptr++);
+        if (label == 0)
+          {
+          continue;
+          }
+        std::map<int, LabelExtent>::iterator it = labelExtents.find(label);
+        if (it == labelExtents.end())
+          {
+          LabelExtent labelExtent;
+          labelExtent.Extent[0] = labelExtent.Extent[1] = x;
+          labelExtent.Extent[2] = labelExtent.Extent[3] = y;
+          labelExtent.Extent[4] = labelExtent.Extent[5] = z;
+          labelExtents.insert(std::make_pair(label, labelExtent));
+          }
+        else
+          {
+          int* labelExtent = it->second.Extent;
+          if (x < labelExtent[0]) { labelExtent[0] = x; }
+          if (x > labelExtent[1]) { labelExtent[1] = x; }
+          if (y < labelExtent[2]) { labelExtent[2] = y; }
+          if (y > labelExtent[3]) { labelExtent[3] = y; }
+          if (z < labelExtent[4]) { labelExtent[4] = z; }
+          if (z > labelExtent[5]) { labelExtent[5] = z; }
+          }
+        }
+      }
+    }
+}
+
 int main(int argc, char * argv[])
 {
   PARSE_ARGS;
@@ -665,55 +723,63 @@ int main(int argc, char * argv[])
       cubes = NULL;
       }
 
+    // The shared multi-label extraction visits every cell once and emits
+    // the surfaces of all the labels in a single pass; its output feeds
+    // the joint smoother (and the intermediate model writer). When
+    // neither consumer is active the per-label loop below generates each
+    // surface from a cropped region instead, so skip the full pass.
+    if (JointSmoothing || SaveIntermediateModels)
+      {
 #if VTK_MAJOR_VERSION >= 9
-    cubes = vtkSmartPointer<vtkDiscreteFlyingEdges3D>::New();
+      cubes = vtkSmartPointer<vtkDiscreteFlyingEdges3D>::New();
 #else
-    cubes = vtkSmartPointer<vtkDiscreteMarchingCubes>::New();
+      cubes = vtkSmartPointer<vtkDiscreteMarchingCubes>::New();
 #endif
-    std::string            comment1 = "Discrete Marching Cubes";
-    vtkPluginFilterWatcher watchDMCubes(cubes,
-                                        comment1.c_str(),
-                                        CLPProcessInformation,
-                                        1.0 / numFilterSteps,
-                                        currentFilterOffset / numFilterSteps);
-    if (debug)
-      {
-      watchDMCubes.QuietOn();
-      }
-    currentFilterOffset += 1.0;
-    // add padding if flag is set
-    if (Pad)
-      {
-      cubes->SetInputConnection(padder->GetOutputPort());
-      }
-    else
-      {
-      cubes->SetInputData(image);
-      }
-    if (useStartEnd)
-      {
+      std::string            comment1 = "Discrete Marching Cubes";
+      vtkPluginFilterWatcher watchDMCubes(cubes,
+                                          comment1.c_str(),
+                                          CLPProcessInformation,
+                                          1.0 / numFilterSteps,
+                                          currentFilterOffset / numFilterSteps);
       if (debug)
         {
-        std::cout << "Marching cubes: Using end label = " << EndLabel << ", start label = " << StartLabel << endl;
+        watchDMCubes.QuietOn();
         }
-      cubes->GenerateValues((EndLabel - StartLabel + 1), StartLabel, EndLabel);
-      }
-    else
-      {
-      if (debug)
+      currentFilterOffset += 1.0;
+      // add padding if flag is set
+      if (Pad)
         {
-        std::cout << "Marching cubes: Using max = " << labelsMax << ", min = " << labelsMin << endl;
+        cubes->SetInputConnection(padder->GetOutputPort());
+        }
+      else
+        {
+        cubes->SetInputData(image);
+        }
+      if (useStartEnd)
+        {
+        if (debug)
+          {
+          std::cout << "Marching cubes: Using end label = " << EndLabel << ", start label = " << StartLabel << endl;
+          }
+        cubes->GenerateValues((EndLabel - StartLabel + 1), StartLabel, EndLabel);
+        }
+      else
+        {
+        if (debug)
+          {
+          std::cout << "Marching cubes: Using max = " << labelsMax << ", min = " << labelsMin << endl;
+          }
+        cubes->GenerateValues((labelsMax - labelsMin + 1), labelsMin, labelsMax);
+        }
+      try
+        {
+        cubes->Update();
+        }
+      catch(...)
+        {
+        std::cerr << "ERROR while updating marching cubes filter." << std::endl;
+        return EXIT_FAILURE;
         }
-      cubes->GenerateValues((labelsMax - labelsMin + 1), labelsMin, labelsMax);
-      }
-    try
-      {
-      cubes->Update();
-      }
-    catch(...)
-      {
-      std::cerr << "ERROR while updating marching cubes filter." << std::endl;
-      return EXIT_FAILURE;
       }
     if (JointSmoothing)
       {
@@ -869,6 +935,34 @@ int main(int argc, char * argv[])
     }
   transformIJKtoRAS->Inverse();
 
+  // When thresholding each label out of the volume, crop to the label's
+  // bounding box (plus a margin of background so the surface closes) so
+  // that the per-label intermediates are bounded by the size of the
+  // structure instead of the whole volume. A label missing from the map
+  // falls back to processing the full volume.
+  std::map<int, LabelExtent> labelExtents;
+  vtkImageData* thresholdSource = image;
+  if (JointSmoothing == 0)
+    {
+    if (Pad)
+      {
+      padder->Update();
+      thresholdSource = padder->GetOutput();
+      }
+    if (thresholdSource->GetNumberOfScalarComponents() == 1)
+      {
+      switch (thresholdSource->GetScalarType())
+        {
+        vtkTemplateMacro(ComputeLabelExtents(thresholdSource,
+          (VTK_TT *)thresholdSource->GetScalarPointer(), labelExtents));
+        }
+      }
+    if (debug)
+      {
+      std::cout << "Computed bounding boxes for " << labelExtents.size() << " labels." << endl;
+      }
+    }
+
   //
   // Loop through all the labels
   //
@@ -1020,7 +1114,48 @@ int main(int argc, char * argv[])
         {
         watchImageThreshold.QuietOn();
         }
-      if (Pad)
+      std::map<int, LabelExtent>::iterator labelExtentIt = labelExtents.find(i);
+      if (labelExtentIt != labelExtents.end())
+        {
+        // crop to the label plus one voxel of background so that the
+        // generated surface still closes around it; the extracted
+        // region keeps its extent indices, so the geometry (and the
+        // IJK to RAS transform applied later) is unchanged
+        int wholeExtent[6];
+        thresholdSource->GetExtent(wholeExtent);
+        int voi[6];
+        for (int axis = 0; axis < 3; axis++)
+          {
+          voi[2 * axis] = labelExtentIt->second.Extent[2 * axis] - 1;
+          if (voi[2 * axis] < wholeExtent[2 * axis])
+            {
+            voi[2 * axis] = wholeExtent[2 * axis];
+            }
+          voi[2 * axis + 1] = labelExtentIt->second.Extent[2 * axis + 1] + 1;
+          if (voi[2 * axis + 1] > wholeExtent[2 * axis + 1])
+            {
+            voi[2 * axis + 1] = wholeExtent[2 * axis + 1];
+            }
+          }
+        if (debug)
+          {
+          std::cout << "Label " << i << ": cropping to extent " << voi[0] << " " << voi[1] << " "
+                    << voi[2] << " " << voi[3] << " " << voi[4] << " " << voi[5] << endl;
+          }
+        vtkSmartPointer<vtkExtractVOI> extractVOI = vtkSmartPointer<vtkExtractVOI>::New();
+        extractVOI->SetVOI(voi);
+        if (Pad)
+          {
+          extractVOI->SetInputConnection(padder->GetOutputPort());
+          }
+        else
+          {
+          extractVOI->SetInputData(image);
+          }
+        extractVOI->ReleaseDataFlagOn();
+        imageThreshold->SetInputConnection(extractVOI->GetOutputPort());
+        }
+      else if (Pad)
         {
         imageThreshold->SetInputConnection(padder->GetOutputPort());
         }
@@ -26,6 +26,7 @@
 #include "itkFloodFilledImageFunctionConditionalIterator.h"
 #include "itkImageFileWriter.h"
 #include "itkPluginUtilities.h"
+#include "itkRegionOfInterestImageFilter.h"
 #include <itksys/SystemTools.hxx>
 
 // VTK includes
@@ -178,6 +179,11 @@ int DoIt( int argc, char * argv[])
 
   std::cout << polyData->GetNumberOfPoints() << std::endl;
   std::cout << sampler->GetOutput()->GetNumberOfPoints() << std::endl;
+
+  // bounding box of the stamped surface points in index space
+  LabelImageType::IndexType minIndex;
+  LabelImageType::IndexType maxIndex;
+  bool                      boundingBoxInitialized = false;
   for( int k = 0; k < sampler->GetOutput()->GetNumberOfPoints(); k++ )
     {
     double *                  pt = sampler->GetOutput()->GetPoint( k );
@@ -191,12 +197,64 @@ int DoIt( int argc, char * argv[])
     if( label->GetLargestPossibleRegion().IsInside(idx) )
       {
       label->SetPixel( idx, 255 );
+      if( !boundingBoxInitialized )
+        {
+        minIndex = idx;
+        maxIndex = idx;
+        boundingBoxInitialized = true;
+        }
+      else
+        {
+        for( int m = 0; m < 3; m++ )
+          {
+          if( idx[m] < minIndex[m] )
+            {
+            minIndex[m] = idx[m];
+            }
+          if( idx[m] > maxIndex[m] )
+            {
+            maxIndex[m] = idx[m];
+            }
+          }
+        }
       }
     }
 
+  // Restrict the morphological processing and flood fill to the bounding box of
+  // the stamped surface points. All non-zero voxels of the result lie in this
+  // region, and processing the full volume is much slower when the model only
+  // covers a small part of it.
+  unsigned int               kernelRadius = 2;
+  LabelImageType::RegionType processingRegion = label->GetLargestPossibleRegion();
+  if( boundingBoxInitialized )
+    {
+    // pad by twice the kernel radius so that the closing is not affected by the
+    // region boundary
+    const int                 padding = 2 * static_cast<int>( kernelRadius );
+    LabelImageType::IndexType paddedIndex;
+    LabelImageType::SizeType  paddedSize;
+    for( int m = 0; m < 3; m++ )
+      {
+      paddedIndex[m] = minIndex[m] - padding;
+      paddedSize[m] = maxIndex[m] - minIndex[m] + 1 + 2 * padding;
+      }
+    processingRegion.SetIndex( paddedIndex );
+    processingRegion.SetSize( paddedSize );
+    if( !processingRegion.Crop( label->GetLargestPossibleRegion() ) )
+      {
+      processingRegion = label->GetLargestPossibleRegion();
+      }
+    }
+
+  typedef itk::RegionOfInterestImageFilter<LabelImageType, LabelImageType> ROIFilterType;
+  ROIFilterType::Pointer roiFilter = ROIFilterType::New();
+  roiFilter->SetInput( label );
+  roiFilter->SetRegionOfInterest( processingRegion );
+  roiFilter->Update();
+  LabelImageType::Pointer roiLabel = roiFilter->GetOutput();
+
   // do morphological closing
-  unsigned int                                      kernelRadius = 2;
-  LabelImageType::Pointer                           closedLabel = BinaryClosingFilter3D( label, kernelRadius );
+  LabelImageType::Pointer                           closedLabel = BinaryClosingFilter3D( roiLabel, kernelRadius );
   itk::ImageRegionIteratorWithIndex<LabelImageType> itLabel(closedLabel, closedLabel->GetLargestPossibleRegion() );
 
   // do flood fill using binary threshold image function
@@ -224,7 +282,9 @@ int DoIt( int argc, char * argv[])
     COG[m] /= static_cast<float>( polyData->GetNumberOfPoints() );
     }
 
-  label->TransformPhysicalPointToIndex( COG, idx );
+  // the region of interest image has its own index space, so the seed index is
+  // computed on it rather than on the full-size label image
+  closedLabel->TransformPhysicalPointToIndex( COG, idx );
 
   itk::FloodFilledImageFunctionConditionalIterator<LabelImageType, ImageFunctionType> floodFill( closedLabel, func, idx );
   for( floodFill.GoToBegin(); !floodFill.IsAtEnd(); ++floodFill )
@@ -236,13 +296,18 @@ int DoIt( int argc, char * argv[])
   for( itLabel.GoToBegin(); !itLabel.IsAtEnd(); ++itLabel )
     {
     LabelImageType::IndexType i = itLabel.GetIndex();
+    LabelImageType::IndexType fullIndex;
+    for( int m = 0; m < 3; m++ )
+      {
+      fullIndex[m] = i[m] + processingRegion.GetIndex()[m];
+      }
     if (finalLabel->GetPixel(i) == 255)
       {
-      label->SetPixel( i, labelValue );
+      label->SetPixel( fullIndex, labelValue );
       }
     else
       {
-      label->SetPixel( i, finalLabel->GetPixel(i) );
+      label->SetPixel( fullIndex, finalLabel->GetPixel(i) );
       }
     }
 
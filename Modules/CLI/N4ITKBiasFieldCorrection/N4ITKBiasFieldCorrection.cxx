@@ -249,8 +249,47 @@ int main(int argc, char* * argv)
   maskshrinker->SetInput( maskImage );
   maskshrinker->SetShrinkFactors( 1 );
 
-  shrinker->SetShrinkFactors( shrinkFactor );
-  maskshrinker->SetShrinkFactors( shrinkFactor );
+  /**
+   * Derive a per-axis shrink schedule from the requested shrink factor. The
+   * bias field is smooth, so the estimation runs on aggressively downsampled
+   * data, but axes that are already coarsely sampled (e.g. thick slices) are
+   * shrunk less so that the downsampled voxels stay roughly isotropic and
+   * each axis keeps enough samples to support the B-spline fit. This makes
+   * large shrink factors safe on anisotropic acquisitions.
+   */
+  ShrinkerType::ShrinkFactorsType shrinkFactors;
+  shrinkFactors.Fill( 1 );
+  if( shrinkFactor > 1 )
+    {
+    double minimumSpacing = inputImage->GetSpacing()[0];
+    for( unsigned d = 1; d < ImageDimension; d++ )
+      {
+      if( inputImage->GetSpacing()[d] < minimumSpacing )
+        {
+        minimumSpacing = inputImage->GetSpacing()[d];
+        }
+      }
+    const itk::SizeValueType minimumAxisSize = 8;
+    for( unsigned d = 0; d < ImageDimension; d++ )
+      {
+      double targetSpacing = minimumSpacing * shrinkFactor;
+      int factor = static_cast<int>( targetSpacing / inputImage->GetSpacing()[d] + 0.5 );
+      if( factor < 1 )
+        {
+        factor = 1;
+        }
+      while( factor > 1 &&
+             inputImage->GetLargestPossibleRegion().GetSize()[d] / factor < minimumAxisSize )
+        {
+        factor--;
+        }
+      shrinkFactors[d] = factor;
+      }
+    std::cout << "Shrink factors: " << shrinkFactors << std::endl;
+    }
+
+  shrinker->SetShrinkFactors( shrinkFactors );
+  maskshrinker->SetShrinkFactors( shrinkFactors );
   shrinker->Update();
   maskshrinker->Update();
 
@@ -265,7 +304,7 @@ int main(int argc, char* * argv)
     WeightShrinkerType::Pointer weightshrinker = WeightShrinkerType::New();
     weightshrinker->SetInput( weightImage );
     weightshrinker->SetShrinkFactors( 1 );
-    weightshrinker->SetShrinkFactors( shrinkFactor );
+    weightshrinker->SetShrinkFactors( shrinkFactors );
     weightshrinker->Update();
     correcter->SetConfidenceImage( weightshrinker->GetOutput() );
     }
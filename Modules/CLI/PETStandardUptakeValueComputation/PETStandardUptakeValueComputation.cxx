@@ -16,11 +16,11 @@
 
 // VTK includes
 #include <vtkGlobFileNames.h>
+#include <vtkDataArray.h>
 #include <vtkImageAccumulate.h>
 #include <vtkImageData.h>
-#include <vtkImageThreshold.h>
-#include <vtkImageToImageStencil.h>
 #include <vtkNew.h>
+#include <vtkPointData.h>
 #include <vtkVersion.h>
 
 // ITK includes
@@ -32,6 +32,9 @@
 #include <itkMetaDataDictionary.h>
 #include <itkNumericSeriesFileNames.h>
 
+// STD includes
+#include <vector>
+
 #undef HAVE_SSTREAM // stupid DCMTK Header issue
 #include "itkDCMTKFileReader.h"
 
@@ -775,7 +778,6 @@ int LoadImagesAndComputeSUV( parameters & list, T )
   vtkImageData *                    voiVolume;
   vtkITKArchetypeImageSeriesReader *reader1 = NULL;
   vtkITKArchetypeImageSeriesReader *reader2 = NULL;
-  vtkAlgorithmOutput* petVolumeConnection = 0;
   vtkAlgorithmOutput* voiVolumeConnection = 0;
 
   // check for the input files
@@ -821,7 +823,6 @@ int LoadImagesAndComputeSUV( parameters & list, T )
 
   // stuff the images.
   petVolume = reader1->GetOutput();
-  petVolumeConnection = reader1->GetOutputPort();
   voiVolume = reader2->GetOutput();
   voiVolumeConnection = reader2->GetOutputPort();
 
@@ -1354,6 +1355,45 @@ int LoadImagesAndComputeSUV( parameters & list, T )
   int hi = static_cast<int>(stataccum->GetMax()[0]);
   stataccum->Delete();
 
+  // --- accumulate the per-label statistics in a single shared pass over the
+  // --- volumes. Scanning the whole PET volume once per label (threshold +
+  // --- stencil + accumulate) made re-evaluations with many VOIs take tens of
+  // --- seconds; with one pass the cost is independent of the number of labels.
+  int numberOfLabels = hi - lo + 1;
+  std::vector<double>    labelMin( numberOfLabels, VTK_DOUBLE_MAX );
+  std::vector<double>    labelMax( numberOfLabels, VTK_DOUBLE_MIN );
+  std::vector<double>    labelSum( numberOfLabels, 0.0 );
+  std::vector<vtkIdType> labelCount( numberOfLabels, 0 );
+  vtkDataArray *petScalars = petVolume->GetPointData()->GetScalars();
+  vtkDataArray *voiScalars = voiVolume->GetPointData()->GetScalars();
+  vtkIdType numberOfVoxels = voiScalars->GetNumberOfTuples();
+  if( petScalars->GetNumberOfTuples() != numberOfVoxels )
+    {
+    std::cerr << "ComputeSUV: PET and VOI volumes have a different number of voxels." << std::endl;
+    return EXIT_FAILURE;
+    }
+  for( vtkIdType voxel = 0; voxel < numberOfVoxels; voxel++ )
+    {
+    int label = static_cast<int>( voiScalars->GetComponent( voxel, 0 ) );
+    if( label == 0 || label < lo || label > hi )
+      {
+      // --- eliminate 0 (background) label.
+      continue;
+      }
+    double value = petScalars->GetComponent( voxel, 0 );
+    int offset = label - lo;
+    if( value < labelMin[offset] )
+      {
+      labelMin[offset] = value;
+      }
+    if( value > labelMax[offset] )
+      {
+      labelMax[offset] = value;
+      }
+    labelSum[offset] += value;
+    labelCount[offset]++;
+    }
+
   std::string labelName;
   int         NumberOfVOIs = 0;
   for( int i = lo; i <= hi; i++ )
@@ -1378,38 +1418,16 @@ int LoadImagesAndComputeSUV( parameters & list, T )
     suvmax = 0.0;
     suvmean = 0.0;
 
-    // create the binary volume of the label
-    vtkImageThreshold *thresholder = vtkImageThreshold::New();
-    thresholder->SetInputConnection(voiVolumeConnection);
-    thresholder->SetInValue(1);
-    thresholder->SetOutValue(0);
-    thresholder->ReplaceOutOn();
-    thresholder->ThresholdBetween(i, i);
-    thresholder->SetOutputScalarType(petVolume->GetScalarType() );
-    thresholder->Update();
-
-    // use vtk's statistics class with the binary labelmap as a stencil
-    vtkImageToImageStencil *stencil = vtkImageToImageStencil::New();
-    stencil->SetInputConnection(thresholder->GetOutputPort() );
-    stencil->ThresholdBetween(1, 1);
-
-    vtkImageAccumulate *labelstat = vtkImageAccumulate::New();
-    labelstat->SetInputConnection(petVolumeConnection);
-    labelstat->SetInputConnection(1, stencil->GetOutputPort() ); // == SetStencilData()
-    labelstat->Update();
-
-    stencil->Delete();
-
     // --- For how many labels was SUV computed?
 
-    int voxNumber = labelstat->GetVoxelCount();
+    int voxNumber = static_cast<int>( labelCount[i - lo] );
     if( voxNumber > 0 )
       {
       NumberOfVOIs++;
 
-      double CPETmin = (labelstat->GetMin() )[0];
-      double CPETmax = (labelstat->GetMax() )[0];
-      double CPETmean = (labelstat->GetMean() )[0];
+      double CPETmin = labelMin[i - lo];
+      double CPETmax = labelMax[i - lo];
+      double CPETmean = labelSum[i - lo] / voxNumber;
 
       // --- we want to use the following units as noted at file top:
       // --- CPET(t) -- tissue radioactivity in pixels-- kBq/mlunits
@@ -1514,10 +1532,6 @@ int LoadImagesAndComputeSUV( parameters & list, T )
           }
         }
       }
-
-
-    thresholder->Delete();
-    labelstat->Delete();
     }
   // --- write output return string file
   if (outputStringFile.compare("") != 0)
@@ -18,6 +18,7 @@
 #include <itkImageFileReader.h>
 #include <itkImageFileWriter.h>
 #include <itkMetaDataObject.h>
+#include <itkMultiThreader.h>
 #include <itkNearestNeighborInterpolateImageFunction.h>
 #include <itkResampleImageFilter.h>
 #include <itkBSplineInterpolateImageFunction.h>
@@ -1213,6 +1214,64 @@ SetInterpolator( const parameters & list )
   return interpol;
 }
 
+// Shared state for resampling the gradient volumes in parallel
+template <class PixelType>
+struct ResampleGradientsThreadStruct
+  {
+  parameters* list;
+  itk::Transform<double, 3, 3>::Pointer transform;
+  typename itk::ResampleImageFilter<itk::Image<PixelType, 3>,
+                                    itk::Image<PixelType, 3> >::Pointer prototypeResampler;
+  std::vector<typename itk::Image<PixelType, 3>::Pointer>* inputImages;
+  std::vector<typename itk::Image<PixelType, 3>::Pointer>* outputImages;
+  int numberOfThreadsPerResampler;
+  int failed;
+  };
+
+// Resamples a subset of the gradient volumes. The transform is shared between the
+// threads (TransformPoint() is const and reentrant) while each thread owns its
+// resampler and interpolator, as interpolators keep per-input-image state.
+template <class PixelType>
+ITK_THREAD_RETURN_TYPE ResampleGradientsThreaderCallback( void* arg )
+{
+  typedef itk::Image<PixelType, 3>                       ImageType;
+  typedef itk::ResampleImageFilter<ImageType, ImageType> ResampleType;
+  itk::MultiThreader::ThreadInfoStruct* info
+    = static_cast<itk::MultiThreader::ThreadInfoStruct *>( arg );
+  ResampleGradientsThreadStruct<PixelType>* str
+    = static_cast<ResampleGradientsThreadStruct<PixelType> *>( info->UserData );
+  typename ResampleType::Pointer resample = ResampleType::New();
+  resample->SetOutputSpacing( str->prototypeResampler->GetOutputSpacing() );
+  resample->SetSize( str->prototypeResampler->GetSize() );
+  resample->SetOutputOrigin( str->prototypeResampler->GetOutputOrigin() );
+  resample->SetOutputDirection( str->prototypeResampler->GetOutputDirection() );
+  resample->SetDefaultPixelValue( str->prototypeResampler->GetDefaultPixelValue() );
+  resample->SetTransform( str->transform );
+  resample->SetInterpolator( SetInterpolator<ImageType>( *str->list ) );
+  resample->SetNumberOfThreads( str->numberOfThreadsPerResampler );
+  // Round-robin assignment of the gradient volumes to the threads
+  for( ::size_t idx = info->ThreadID; idx < str->inputImages->size(); idx += info->NumberOfThreads )
+    {
+    try
+      {
+      resample->SetInput( ( *str->inputImages )[idx] );
+      resample->Update();
+      }
+    catch( itk::ExceptionObject &exception )
+      {
+      std::cerr << exception << std::endl;
+      str->failed = 1;
+      return ITK_THREAD_RETURN_VALUE;
+      }
+    ( *str->outputImages )[idx] = resample->GetOutput();
+    ( *str->outputImages )[idx]->DisconnectPipeline();
+    // Release each input gradient volume as soon as it has been resampled
+    // to bound the peak memory consumption
+    ( *str->inputImages )[idx] = NULL;
+    }
+  return ITK_THREAD_RETURN_VALUE;
+}
+
 template <class PixelType>
 int Rotate( parameters & list )
 {
@@ -1260,14 +1319,34 @@ int Rotate( parameters & list )
     }
   resample->SetTransform( transform );
   resample->SetInterpolator( interpol );
-  std::vector<typename ImageType::Pointer> vectorOutputImage;
-  // Resample all the images separately
-  for( ::size_t idx = 0; idx < vectorOfImage.size(); idx++ )
+  std::vector<typename ImageType::Pointer> vectorOutputImage( vectorOfImage.size() );
+  // Resample all the images in parallel: each gradient volume is an independent
+  // resampling problem, so for multi-gradient acquisitions the wall time scales
+  // with the number of cores instead of the number of gradients
+  int totalNumberOfThreads = list.numberOfThread > 0 ?
+    list.numberOfThread : itk::MultiThreader::GetGlobalDefaultNumberOfThreads();
+  int numberOfWorkers = totalNumberOfThreads;
+  if( numberOfWorkers > static_cast<int>( vectorOfImage.size() ) )
+    {
+    numberOfWorkers = static_cast<int>( vectorOfImage.size() );
+    }
+  ResampleGradientsThreadStruct<PixelType> threadStruct;
+  threadStruct.list = &list;
+  threadStruct.transform = transform;
+  threadStruct.prototypeResampler = resample;
+  threadStruct.inputImages = &vectorOfImage;
+  threadStruct.outputImages = &vectorOutputImage;
+  // With fewer gradient volumes than threads (e.g. a scalar volume), the
+  // remaining parallelism is used inside each resampler instead
+  threadStruct.numberOfThreadsPerResampler = totalNumberOfThreads / numberOfWorkers;
+  threadStruct.failed = 0;
+  itk::MultiThreader::Pointer threader = itk::MultiThreader::New();
+  threader->SetNumberOfThreads( numberOfWorkers );
+  threader->SetSingleMethod( ResampleGradientsThreaderCallback<PixelType>, &threadStruct );
+  threader->SingleMethodExecute();
+  if( threadStruct.failed )
     {
-    resample->SetInput( vectorOfImage[idx] );
-    resample->Update();
-    vectorOutputImage.push_back( resample->GetOutput() );
-    vectorOutputImage[idx]->DisconnectPipeline();
+    return EXIT_FAILURE;
     }
   typename itk::VectorImage<PixelType, 3>::Pointer outputImage;
   outputImage = itk::VectorImage<PixelType, 3>::New();
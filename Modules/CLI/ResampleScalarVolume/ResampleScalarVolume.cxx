@@ -214,7 +214,6 @@ int DoIt( int argc, char * argv[], T )
   resampler->SetOutputSpacing( outputSpacing );
   resampler->SetOutputDirection( reader->GetOutput()->GetDirection() );
   resampler->SetSize( outputSize );
-  resampler->Update();
 
 // //////////////////////////////////////////////
 // 5) Write the new DICOM series
@@ -223,6 +222,11 @@ int DoIt( int argc, char * argv[], T )
   seriesWriter->SetInput( resampler->GetOutput() );
   seriesWriter->SetFileName( OutputVolume.c_str() );
   seriesWriter->SetUseCompression(1);
+  // Let the writer drive the resampler tile by tile so that only a slab of the
+  // output image is resident at a time. Formats that do not support streamed
+  // writes (or when compression kicks in) transparently fall back to a single
+  // request.
+  seriesWriter->SetNumberOfStreamDivisions(10);
   try
     {
     seriesWriter->Update();
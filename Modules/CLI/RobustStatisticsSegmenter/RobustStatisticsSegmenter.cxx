@@ -6,6 +6,8 @@
 
 #include "itkImageFileReader.h"
 #include "itkImageFileWriter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIterator.h"
 
 #include "labelMapPreprocessor.h"
 
@@ -67,6 +69,51 @@ int main(int argc, char* * argv)
   SFLSRobustStatSegmentor3DLabelMap_c seg;
   seg.setImage(img);
 
+  // Warm start from a previous segmentation: the contour evolution restarts
+  // from the converged state instead of growing from the seed stroke again,
+  // so re-runs that only tweak the intensity homogeneity or curvature weight
+  // finish in a few iterations. The robust intensity statistics are still
+  // estimated from the seed label image, only the starting contour changes.
+  if( initialSegmentationFileName != "" )
+    {
+    LabelImageReader_t::Pointer initialSegReader = LabelImageReader_t::New();
+    initialSegReader->SetFileName(initialSegmentationFileName.c_str() );
+    LabelImage_t::Pointer initialSeg;
+
+    try
+      {
+      initialSegReader->Update();
+      initialSeg = initialSegReader->GetOutput();
+      }
+    catch( itk::ExceptionObject & err )
+      {
+      std::cerr << "ExceptionObject caught !" << std::endl;
+      std::cerr << err << std::endl;
+      raise(SIGABRT);
+      }
+
+    typedef SFLSRobustStatSegmentor3DLabelMap_c::TMaskImage Mask_t;
+    Mask_t::Pointer initialMask = Mask_t::New();
+    initialMask->SetRegions(initialSeg->GetLargestPossibleRegion() );
+    initialMask->Allocate();
+    initialMask->CopyInformation(initialSeg);
+    initialMask->FillBuffer(0);
+
+    itk::ImageRegionConstIterator<LabelImage_t> sit(initialSeg, initialSeg->GetLargestPossibleRegion() );
+    itk::ImageRegionIterator<Mask_t>            mit(initialMask, initialMask->GetLargestPossibleRegion() );
+    for( sit.GoToBegin(), mit.GoToBegin(); !sit.IsAtEnd(); ++sit, ++mit )
+      {
+      if( sit.Get() != 0 )
+        {
+        mit.Set(1);
+        }
+      }
+
+    // seedToMask() leaves a pre-set mask untouched, so the seeds from the
+    // label image are used for the statistics only
+    seg.setMask(initialMask);
+    }
+
   seg.setNumIter(10000); // a large enough number, s.t. will not be stoped by this creteria.
   seg.setMaxVolume(expectedVolume);
   seg.setInputLabelImage(newLabelMap);
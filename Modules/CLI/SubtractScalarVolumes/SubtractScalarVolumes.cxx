@@ -66,23 +66,41 @@ int DoIt( int argc, char * argv[], T )
   reader1->Update();
   reader2->Update();
 
-  typename Interpolator::Pointer interp = Interpolator::New();
-  interp->SetInputImage(reader2->GetOutput() );
-  interp->SetSplineOrder(order);
+  // If the second volume already matches the geometry of the first one, the
+  // resampling step (and its full-size intermediate image) can be skipped and
+  // the volume can be used directly.
+  bool sameGeometry =
+    reader2->GetOutput()->GetLargestPossibleRegion() == reader1->GetOutput()->GetLargestPossibleRegion()
+    && reader2->GetOutput()->GetOrigin() == reader1->GetOutput()->GetOrigin()
+    && reader2->GetOutput()->GetSpacing() == reader1->GetOutput()->GetSpacing()
+    && reader2->GetOutput()->GetDirection() == reader1->GetOutput()->GetDirection();
 
   typename ResampleType::Pointer resample = ResampleType::New();
-  resample->SetInput(reader2->GetOutput() );
-  resample->SetOutputParametersFromImage(reader1->GetOutput() );
-  resample->SetInterpolator( interp );
-  resample->SetDefaultPixelValue( 0 );
-  resample->ReleaseDataFlagOn();
-
   itk::PluginFilterWatcher watchResample(resample, "Resampling",
                                          CLPProcessInformation);
 
   typename FilterType::Pointer filter = FilterType::New();
   filter->SetInput1( reader1->GetOutput() );
-  filter->SetInput2( resample->GetOutput() );
+  if( sameGeometry )
+    {
+    filter->SetInput2( reader2->GetOutput() );
+    }
+  else
+    {
+    // computing the spline coefficients traverses the whole second volume, so
+    // the interpolator is only set up when resampling is actually needed
+    typename Interpolator::Pointer interp = Interpolator::New();
+    interp->SetInputImage(reader2->GetOutput() );
+    interp->SetSplineOrder(order);
+
+    resample->SetInput(reader2->GetOutput() );
+    resample->SetOutputParametersFromImage(reader1->GetOutput() );
+    resample->SetInterpolator( interp );
+    resample->SetDefaultPixelValue( 0 );
+    resample->ReleaseDataFlagOn();
+
+    filter->SetInput2( resample->GetOutput() );
+    }
 
   itk::PluginFilterWatcher watchFilter(filter, "Adding",
                                        CLPProcessInformation);
@@ -19,6 +19,7 @@
 #include "itkImageFileReader.h"
 #include "itkImageFileWriter.h"
 #include "itkVotingBinaryHoleFillingImageFilter.h"
+#include "itkVotingBinaryIterativeHoleFillingImageFilter.h"
 #include "itkPluginFilterWatcher.h"
 
 #include "VotingBinaryHoleFillingImageFilterCLP.h"
@@ -52,29 +53,57 @@ int main( int argc, char * argv[] )
   reader->SetFileName( inputVolume.c_str() );
   writer->SetFileName( outputVolume.c_str() );
 
-  typedef itk::VotingBinaryHoleFillingImageFilter<
-    InputImageType, OutputImageType>  FilterType;
-
-  FilterType::Pointer      filter = FilterType::New();
-  itk::PluginFilterWatcher watcher(filter, "Voting Binary Hole Filling",
-                                   CLPProcessInformation);
-
   InputImageType::SizeType indexRadius;
 
   indexRadius[0] = radius[0]; // radius along x
   indexRadius[1] = radius[1]; // radius along y
   indexRadius[2] = radius[2]; // radius along z
 
-  filter->SetRadius( indexRadius );
-
-  filter->SetBackgroundValue( background );
-  filter->SetForegroundValue( foreground );
-  filter->SetMajorityThreshold( majorityThreshold );
-
-  filter->SetInput( reader->GetOutput() );
-  writer->SetInput( filter->GetOutput() );
-  writer->SetUseCompression(1);
-  writer->Update();
+  if( maximumNumberOfIterations > 1 )
+  {
+    // Repeated voting with a small radius converges much faster than a
+    // single pass with a radius large enough to cover the same holes,
+    // because each pass only visits a small neighborhood per voxel and
+    // the filter stops as soon as a pass changes no pixels.
+    typedef itk::VotingBinaryIterativeHoleFillingImageFilter<
+      InputImageType> IterativeFilterType;
+
+    IterativeFilterType::Pointer filter = IterativeFilterType::New();
+    itk::PluginFilterWatcher     watcher(filter, "Voting Binary Hole Filling",
+                                         CLPProcessInformation);
+
+    filter->SetRadius( indexRadius );
+
+    filter->SetBackgroundValue( background );
+    filter->SetForegroundValue( foreground );
+    filter->SetMajorityThreshold( majorityThreshold );
+    filter->SetMaximumNumberOfIterations( maximumNumberOfIterations );
+
+    filter->SetInput( reader->GetOutput() );
+    writer->SetInput( filter->GetOutput() );
+    writer->SetUseCompression(1);
+    writer->Update();
+  }
+  else
+  {
+    typedef itk::VotingBinaryHoleFillingImageFilter<
+      InputImageType, OutputImageType>  FilterType;
+
+    FilterType::Pointer      filter = FilterType::New();
+    itk::PluginFilterWatcher watcher(filter, "Voting Binary Hole Filling",
+                                     CLPProcessInformation);
+
+    filter->SetRadius( indexRadius );
+
+    filter->SetBackgroundValue( background );
+    filter->SetForegroundValue( foreground );
+    filter->SetMajorityThreshold( majorityThreshold );
+
+    filter->SetInput( reader->GetOutput() );
+    writer->SetInput( filter->GetOutput() );
+    writer->SetUseCompression(1);
+    writer->Update();
+  }
 
   return EXIT_SUCCESS;
 }
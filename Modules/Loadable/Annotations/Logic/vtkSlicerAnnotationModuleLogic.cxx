@@ -45,6 +45,12 @@
 #include <iostream>
 #include <sstream>
 
+// Bulk operations on more annotations than this are performed in scene
+// batch processing mode, so observers refresh once instead of once per
+// node. For fewer nodes the per-node updates are cheaper than the full
+// refresh triggered at the end of batch processing.
+static const int BatchUpdateThreshold = 30;
+
 //-----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkSlicerAnnotationModuleLogic)
 
@@ -2356,13 +2362,21 @@ void vtkSlicerAnnotationModuleLogic::SetAllAnnotationsSelected(bool selected)
     }
 
   int numberOfHierarchyNodes =  this->GetMRMLScene()->GetNumberOfNodesByClass("vtkMRMLAnnotationHierarchyNode");
+  int numberOfAnnotationNodes =  this->GetMRMLScene()->GetNumberOfNodesByClass("vtkMRMLAnnotationNode");
+
+  // see SetHierarchyAnnotationsVisibleFlag for the batch processing rationale
+  bool batchProcess = (numberOfHierarchyNodes + numberOfAnnotationNodes > BatchUpdateThreshold);
+  if (batchProcess)
+    {
+    this->GetMRMLScene()->StartState(vtkMRMLScene::BatchProcessState);
+    }
+
   for (int i = 0; i < numberOfHierarchyNodes; i++)
     {
     vtkMRMLNode *node = this->GetMRMLScene()->GetNthNodeByClass(i, "vtkMRMLAnnotationHierarchyNode");
     node->SetSelected(selected);
     }
 
-  int numberOfAnnotationNodes =  this->GetMRMLScene()->GetNumberOfNodesByClass("vtkMRMLAnnotationNode");
   for (int i = 0; i < numberOfAnnotationNodes; i++)
     {
     vtkMRMLNode *node = this->GetMRMLScene()->GetNthNodeByClass(i, "vtkMRMLAnnotationNode");
@@ -2370,7 +2384,10 @@ void vtkSlicerAnnotationModuleLogic::SetAllAnnotationsSelected(bool selected)
     this->SetAnnotationSelected(node->GetID(), selected);
     }
 
-
+  if (batchProcess)
+    {
+    this->GetMRMLScene()->EndState(vtkMRMLScene::BatchProcessState);
+    }
 }
 
 //---------------------------------------------------------------------------
@@ -3355,6 +3372,17 @@ void vtkSlicerAnnotationModuleLogic::SetHierarchyAnnotationsVisibleFlag(vtkMRMLA
   vtkCollection* children = vtkCollection::New();
   hierarchyNode->GetChildrenDisplayableNodes(children);
 
+  // Toggling visibility node-by-node triggers a separate update (and
+  // render request) per annotation in the displayable managers. For larger
+  // hierarchies fold them into a single batch processing refresh; for a
+  // few nodes the individual updates are cheaper than a full rebuild.
+  bool batchProcess = (this->GetMRMLScene() != NULL
+                       && children->GetNumberOfItems() > BatchUpdateThreshold);
+  if (batchProcess)
+    {
+    this->GetMRMLScene()->StartState(vtkMRMLScene::BatchProcessState);
+    }
+
   children->InitTraversal();
   for (int i=0; i<children->GetNumberOfItems(); ++i)
     {
@@ -3366,6 +3394,11 @@ void vtkSlicerAnnotationModuleLogic::SetHierarchyAnnotationsVisibleFlag(vtkMRMLA
       childNode->SetDisplayVisibility((flag ? 1 : 0));
       }
     } // for loop
+
+  if (batchProcess)
+    {
+    this->GetMRMLScene()->EndState(vtkMRMLScene::BatchProcessState);
+    }
 }
 
 //---------------------------------------------------------------------------
@@ -3384,6 +3417,14 @@ void vtkSlicerAnnotationModuleLogic::SetHierarchyAnnotationsLockFlag(vtkMRMLAnno
   vtkCollection* children = vtkCollection::New();
   hierarchyNode->GetChildrenDisplayableNodes(children);
 
+  // see SetHierarchyAnnotationsVisibleFlag for the batch processing rationale
+  bool batchProcess = (this->GetMRMLScene() != NULL
+                       && children->GetNumberOfItems() > BatchUpdateThreshold);
+  if (batchProcess)
+    {
+    this->GetMRMLScene()->StartState(vtkMRMLScene::BatchProcessState);
+    }
+
   children->InitTraversal();
   for (int i=0; i<children->GetNumberOfItems(); ++i)
     {
@@ -3395,6 +3436,11 @@ void vtkSlicerAnnotationModuleLogic::SetHierarchyAnnotationsLockFlag(vtkMRMLAnno
       childNode->SetLocked((flag ? 1 : 0));
       }
     } // for loop
+
+  if (batchProcess)
+    {
+    this->GetMRMLScene()->EndState(vtkMRMLScene::BatchProcessState);
+    }
 }
 
 //---------------------------------------------------------------------------
@@ -87,6 +87,13 @@ vtkMRMLAnnotationDisplayableManager::vtkMRMLAnnotationDisplayableManager()
   this->LastClickWorldCoordinates[1]=0;
   this->LastClickWorldCoordinates[2]=0;
   this->LastClickWorldCoordinates[3]=1;
+
+  this->RasToXyMatrix = vtkSmartPointer<vtkMatrix4x4>::New();
+  this->RasToXyMatrixMTime = 0;
+
+  this->LastSliceGeometryMTime = 0;
+  this->LastSliceLayoutGridRows = 0;
+  this->LastSliceLayoutGridColumns = 0;
 }
 
 //---------------------------------------------------------------------------
@@ -690,8 +697,22 @@ void vtkMRMLAnnotationDisplayableManager::OnMRMLDisplayableNodeModifiedEvent(vtk
     // the associated renderWindow is a 2D SliceView
     // this is the entry point for all events fired by one of the three sliceviews
     // (f.e. change slice number, zoom etc.)
-    // now we call the handle for specific sliceNode actions
-    this->OnMRMLSliceNodeModifiedEvent(this->GetSliceNode());
+
+    // slice nodes fire ModifiedEvent for many non-geometric changes as
+    // well; the per-annotation visibility/projection pass only depends on
+    // the slice geometry, so skip it while the geometry is unchanged
+    vtkMRMLSliceNode* sliceNode = this->GetSliceNode();
+    unsigned long sliceGeometryMTime = sliceNode->GetXYToRAS()->GetMTime();
+    if (sliceGeometryMTime != this->LastSliceGeometryMTime ||
+        sliceNode->GetLayoutGridRows() != this->LastSliceLayoutGridRows ||
+        sliceNode->GetLayoutGridColumns() != this->LastSliceLayoutGridColumns)
+      {
+      this->LastSliceGeometryMTime = sliceGeometryMTime;
+      this->LastSliceLayoutGridRows = sliceNode->GetLayoutGridRows();
+      this->LastSliceLayoutGridColumns = sliceNode->GetLayoutGridColumns();
+      // now we call the handle for specific sliceNode actions
+      this->OnMRMLSliceNodeModifiedEvent(sliceNode);
+      }
 
     // and exit
     return;
@@ -1758,11 +1779,20 @@ void vtkMRMLAnnotationDisplayableManager::GetWorldToDisplayCoordinates(double r,
   if (this->Is2DDisplayableManager())
     {
     // 2D case
-    double ras[3];
-    ras[0] = r;
-    ras[1] = a;
-    ras[2] = s;
-    vtkMRMLAbstractSliceViewDisplayableManager::ConvertRASToXYZ(this->GetSliceNode(), ras, displayCoordinates);
+    // only recompute the inverse of the slice matrix when it has changed,
+    // this method is called once per control point on every slice update
+    vtkMatrix4x4 * xyToRasMatrix = this->GetSliceNode()->GetXYToRAS();
+    if (xyToRasMatrix->GetMTime() != this->RasToXyMatrixMTime)
+      {
+      vtkMatrix4x4::Invert(xyToRasMatrix, this->RasToXyMatrix);
+      this->RasToXyMatrixMTime = xyToRasMatrix->GetMTime();
+      }
+    double rasw[4] = {r, a, s, 1.0};
+    double xyzw[4] = {0.0, 0.0, 0.0, 1.0};
+    this->RasToXyMatrix->MultiplyPoint(rasw, xyzw);
+    displayCoordinates[0] = xyzw[0] / xyzw[3];
+    displayCoordinates[1] = xyzw[1] / xyzw[3];
+    displayCoordinates[2] = xyzw[2] / xyzw[3];
     }
   else
     {
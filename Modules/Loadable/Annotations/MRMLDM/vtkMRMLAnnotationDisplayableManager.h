@@ -33,8 +33,10 @@ class vtkSlicerViewerWidget;
 class vtkMRMLSliceNode;
 
 // VTK includes
+#include <vtkSmartPointer.h>
 class vtkAbstractWidget;
 class vtkHandleWidget;
+class vtkMatrix4x4;
 class vtkSeedWidget;
 
 /// \ingroup Slicer_QtModules_Annotation
@@ -241,6 +243,23 @@ protected:
 
   double LastClickWorldCoordinates[4];
 
+  /// Cached inverse of the slice node's XYToRAS matrix. World to display
+  /// conversion is done once per control point per slice update, so the
+  /// inverse is only recomputed when the slice node matrix changes instead
+  /// of being inverted per point.
+  /// \sa GetWorldToDisplayCoordinates
+  vtkSmartPointer<vtkMatrix4x4> RasToXyMatrix;
+  unsigned long RasToXyMatrixMTime;
+
+  /// Slice view geometry (XYToRAS matrix and lightbox layout) at the time
+  /// of the last per-annotation visibility/projection pass. Slice nodes
+  /// fire ModifiedEvent for many non-geometric changes too; the pass is
+  /// skipped while the geometry is unchanged.
+  /// \sa OnMRMLDisplayableNodeModifiedEvent
+  unsigned long LastSliceGeometryMTime;
+  int LastSliceLayoutGridRows;
+  int LastSliceLayoutGridColumns;
+
 private:
 
   vtkMRMLAnnotationDisplayableManager(const vtkMRMLAnnotationDisplayableManager&); /// Not implemented
@@ -43,6 +43,7 @@
 #include <vtkGeneralTransform.h>
 #include <vtkImageData.h>
 #include <vtkImageClip.h>
+#include <vtkImageReslice.h>
 #include <vtkNew.h>
 #include <vtkMatrix4x4.h>
 #include <vtkMatrix3x3.h>
@@ -420,12 +421,6 @@ int vtkSlicerCropVolumeLogic::CropInterpolated(vtkMRMLAnnotationROINode* roi, vt
     return -1;
     }
 
-  if (this->Internal->ResampleLogic == 0)
-    {
-    vtkErrorMacro("CropVolume: resample logic is not set");
-    return -3;
-    }
-
   int outputExtent[6] = { 0, -1, 0, -1, 0, -1 };
   double outputSpacing[3] = { 0 };
   this->GetInterpolatedCropOutputGeometry(roi, inputVolume, isotropicResampling, spacingScale, outputExtent, outputSpacing);
@@ -483,22 +478,6 @@ int vtkSlicerCropVolumeLogic::CropInterpolated(vtkMRMLAnnotationROINode* roi, vt
     outputSpacing[column] = vtkMath::Normalize(outputDirectionColRow[column]);
     }
 
-  vtkMRMLCommandLineModuleNode* cmdNode = this->Internal->ResampleLogic->CreateNodeInScene();
-  if (cmdNode == NULL)
-    {
-    vtkErrorMacro("CropVolume: failed to create resample node");
-    return -4;
-    }
-
-  cmdNode->SetParameterAsString("inputVolume", inputVolume->GetID());
-  cmdNode->SetParameterAsString("outputVolume", outputVolume->GetID());
-
-  std::stringstream sizeStream;
-  sizeStream << (outputExtent[1] - outputExtent[0] + 1)  << ","
-    << (outputExtent[3] - outputExtent[2] + 1) << ","
-    << (outputExtent[5] - outputExtent[4] + 1);
-  cmdNode->SetParameterAsString("outputImageSize", sizeStream.str());
-
   // Center the output image in the ROI. For that, compute the size difference between
   // the ROI and the output image.
   double sizeDifference_IJK[3] =
@@ -519,6 +498,90 @@ int vtkSlicerCropVolumeLogic::CropInterpolated(vtkMRMLAnnotationROINode* roi, vt
   double outputOrigin_RAS[4] = { 0.0, 0.0, 0.0, 1.0 };
   outputIJKToRAS->MultiplyPoint(outputOrigin_IJK, outputOrigin_RAS);
 
+  // Geometry of the output volume: direction*spacing columns of
+  // outputIJKToRAS with the centered origin as translation
+  vtkNew<vtkMatrix4x4> outputIJKToRASCentered;
+  outputIJKToRASCentered->DeepCopy(outputIJKToRAS.GetPointer());
+  for (int row = 0; row < 3; row++)
+    {
+    outputIJKToRASCentered->SetElement(row, 3, outputOrigin_RAS[row]);
+    }
+
+  // Fast path: scalar (non-DWI) volumes with linear transforms and nearest
+  // neighbor or linear interpolation can be cropped in process with
+  // vtkImageReslice, which is multi-threaded and only computes the requested
+  // ROI-sized output extent. This avoids running the resample CLI in a
+  // separate process and allocating anything larger than the output.
+  bool inputTransformLinear = (inputVolume->GetParentTransformNode() == NULL
+    || inputVolume->GetParentTransformNode()->IsTransformToWorldLinear());
+  if (inputTransformLinear
+    && vtkMRMLDiffusionWeightedVolumeNode::SafeDownCast(inputVolume) == NULL
+    && inputVolume->GetImageData() != NULL
+    && (interpolationMode == vtkMRMLCropVolumeParametersNode::InterpolationNearestNeighbor
+      || interpolationMode == vtkMRMLCropVolumeParametersNode::InterpolationLinear))
+    {
+    // reslice axes map output IJK to input IJK
+    // (image data in MRML nodes has origin (0,0,0) and spacing (1,1,1),
+    // so voxel coordinates and data coordinates are the same)
+    vtkNew<vtkMatrix4x4> outputToInputRAS;
+    vtkMRMLTransformNode::GetMatrixTransformBetweenNodes(outputTransform,
+      inputVolume->GetParentTransformNode(), outputToInputRAS.GetPointer());
+    vtkNew<vtkMatrix4x4> inputRASToIJK;
+    inputVolume->GetRASToIJKMatrix(inputRASToIJK.GetPointer());
+    vtkNew<vtkMatrix4x4> resliceAxes;
+    vtkMatrix4x4::Multiply4x4(outputToInputRAS.GetPointer(),
+      outputIJKToRASCentered.GetPointer(), resliceAxes.GetPointer());
+    vtkMatrix4x4::Multiply4x4(inputRASToIJK.GetPointer(), resliceAxes.GetPointer(),
+      resliceAxes.GetPointer());
+
+    vtkNew<vtkImageReslice> reslice;
+    reslice->SetInputData(inputVolume->GetImageData());
+    reslice->SetResliceAxes(resliceAxes.GetPointer());
+    reslice->SetOutputExtent(0, outputExtent[1] - outputExtent[0],
+                             0, outputExtent[3] - outputExtent[2],
+                             0, outputExtent[5] - outputExtent[4]);
+    reslice->SetOutputOrigin(0.0, 0.0, 0.0);
+    reslice->SetOutputSpacing(1.0, 1.0, 1.0);
+    reslice->SetBackgroundLevel(fillValue);
+    if (interpolationMode == vtkMRMLCropVolumeParametersNode::InterpolationNearestNeighbor)
+      {
+      reslice->SetInterpolationModeToNearestNeighbor();
+      }
+    else
+      {
+      reslice->SetInterpolationModeToLinear();
+      }
+    reslice->Update();
+
+    outputVolume->SetAndObserveImageData(reslice->GetOutput());
+    outputVolume->SetIJKToRASMatrix(outputIJKToRASCentered.GetPointer());
+    return 0;
+    }
+
+  // Windowed sinc and b-spline interpolation, diffusion weighted volumes
+  // (gradients need to be reoriented) and non-linearly transformed inputs
+  // are handled by the resample CLI.
+  if (this->Internal->ResampleLogic == 0)
+    {
+    vtkErrorMacro("CropVolume: resample logic is not set");
+    return -3;
+    }
+  vtkMRMLCommandLineModuleNode* cmdNode = this->Internal->ResampleLogic->CreateNodeInScene();
+  if (cmdNode == NULL)
+    {
+    vtkErrorMacro("CropVolume: failed to create resample node");
+    return -4;
+    }
+
+  cmdNode->SetParameterAsString("inputVolume", inputVolume->GetID());
+  cmdNode->SetParameterAsString("outputVolume", outputVolume->GetID());
+
+  std::stringstream sizeStream;
+  sizeStream << (outputExtent[1] - outputExtent[0] + 1)  << ","
+    << (outputExtent[3] - outputExtent[2] + 1) << ","
+    << (outputExtent[5] - outputExtent[4] + 1);
+  cmdNode->SetParameterAsString("outputImageSize", sizeStream.str());
+
   vtkNew<vtkMRMLMarkupsFiducialNode> originMarkupNode;
   // Markups are transformed from RAS to LPS by the CLI infrastructure, so we pass them in RAS
   originMarkupNode->AddFiducial(outputOrigin_RAS[0], outputOrigin_RAS[1], outputOrigin_RAS[2]);
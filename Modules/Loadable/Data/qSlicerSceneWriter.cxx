@@ -24,6 +24,7 @@
 #include <QDir>
 #include <QFileInfo>
 #include <QPixmap>
+#include <QSettings>
 
 // CTK includes
 #include <ctkMessageBox.h>
@@ -256,8 +257,13 @@ bool qSlicerSceneWriter::writeToMRB(const qSlicerIO::IOProperties& properties)
     }
 
   qDebug() << "zipping to " << fileInfo.absoluteFilePath();
+  // -1 keeps the default deflate level; 0 stores the bundle uncompressed
+  // which is much faster when the payload files are compressed already
+  int compressionLevel = qSlicerCoreApplication::application()->userSettings()
+    ->value("ioManager/SceneBundleCompressionLevel", -1).toInt();
   if ( !applicationLogic->Zip(fileInfo.absoluteFilePath().toLatin1(),
-                              bundlePath.toLatin1()) )
+                              bundlePath.toLatin1(),
+                              compressionLevel) )
     {
     QMessageBox::critical(0, tr("Save scene as MRB"), tr("Could not compress bundle"));
     return false;
@@ -25,6 +25,7 @@
 #include <vtkBoundingBox.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
+#include <vtkPoints.h>
 
 // STD includes
 #include <sstream>
@@ -214,6 +215,26 @@ void vtkMRMLMarkupsFiducialNode::SetNthFiducialPosition(int n, double x, double
   this->SetMarkupPoint(n, 0, x, y, z);
 }
 
+//-------------------------------------------------------------------------
+void vtkMRMLMarkupsFiducialNode::SetFiducialPositions(vtkPoints* positions)
+{
+  if (!positions)
+    {
+    vtkErrorMacro("SetFiducialPositions: invalid positions array");
+    return;
+    }
+  int wasModifying = this->StartModify();
+  vtkIdType numberOfPoints = positions->GetNumberOfPoints();
+  int numberOfMarkups = this->GetNumberOfMarkups();
+  for (vtkIdType pointIndex = 0; pointIndex < numberOfPoints && pointIndex < numberOfMarkups; pointIndex++)
+    {
+    double position[3] = { 0.0, 0.0, 0.0 };
+    positions->GetPoint(pointIndex, position);
+    this->SetMarkupPoint(pointIndex, 0, position[0], position[1], position[2]);
+    }
+  this->EndModify(wasModifying);
+}
+
 //-------------------------------------------------------------------------
 bool vtkMRMLMarkupsFiducialNode::GetNthFiducialSelected(int n)
 {
@@ -29,6 +29,8 @@
 // VTK includes
 #include <vtkSmartPointer.h>
 
+class vtkPoints;
+
 /// \brief MRML node to represent a fiducial markup
 /// Fiducial Markups nodes contain a list of fiducial points.
 /// Visualization parameters are set in the vtkMRMLMarkupsDisplayNode class.
@@ -100,6 +102,13 @@ public:
   void SetNthFiducialPosition(int n, double x, double y, double z);
   /// Set the position of the nth fiducial from a double array
   void SetNthFiducialPositionFromArray(int n, double pos[3]);
+  /// Set the positions of the fiducials of this node from a point array in
+  /// a single call: point i becomes the position of the i-th fiducial.
+  /// Extra points (beyond the number of fiducials in the node) are ignored.
+  /// The per-fiducial events are compressed into a single event of each
+  /// type (\sa StartModify, \sa EndModify), so observers process one
+  /// update for the whole batch instead of one per fiducial.
+  void SetFiducialPositions(vtkPoints* positions);
   /// Get selected property on Nth fiducial
   bool GetNthFiducialSelected(int n = 0);
   /// Set selected property on Nth fiducial
@@ -132,6 +132,11 @@ int vtkMRMLMarkupsFiducialStorageNode::ReadDataInternal(vtkMRMLNode *refNode)
 
   if (fstr.is_open())
     {
+    // Compress the per-markup added/modified events into one event each, invoked
+    // when reading finished (the observers perform one full update from the node
+    // instead of a widget update per markup, which does not scale to long lists)
+    int wasModifying = markupsNode->StartModify();
+
     if (markupsNode->GetNumberOfMarkups() > 0)
       {
       // clear out the list
@@ -448,6 +453,8 @@ int vtkMRMLMarkupsFiducialStorageNode::ReadDataInternal(vtkMRMLNode *refNode)
         }
       }
     fstr.close();
+
+    markupsNode->EndModify(wasModifying);
     }
   else
     {
@@ -1109,6 +1109,10 @@ bool vtkMRMLMarkupsNode::CanApplyNonLinearTransforms()const
 //---------------------------------------------------------------------------
 void vtkMRMLMarkupsNode::ApplyTransform(vtkAbstractTransform* transform)
 {
+  // Compress the per-point modified events into a single one invoked at the end,
+  // so that transforming a long markup list does not trigger a widget update per point
+  int wasModifying = this->StartModify();
+
   int numMarkups = this->GetNumberOfMarkups();
   double xyzIn[3];
   double xyzOut[3];
@@ -1124,6 +1128,8 @@ void vtkMRMLMarkupsNode::ApplyTransform(vtkAbstractTransform* transform)
     }
   this->StorableModifiedTime.Modified();
   this->Modified();
+
+  this->EndModify(wasModifying);
 }
 
 //---------------------------------------------------------------------------
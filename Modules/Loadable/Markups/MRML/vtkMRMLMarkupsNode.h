@@ -179,6 +179,11 @@ public:
   void InitMarkup(Markup *markup);
   /// Add a markup to the end of the list. Return index
   /// of new markup, -1 on failure.
+  /// When adding or modifying many markups in a loop, surround the loop with
+  /// \sa StartModify and \sa EndModify calls. The per-markup events are then
+  /// compressed into a single event of each type invoked with NULL call data,
+  /// which the observers handle with one full update instead of a widget
+  /// update per markup.
   int AddMarkup(Markup markup);
   /// Create a new markup with n points.
   /// If point is specified then all markup positions will be initialized to that position,
@@ -92,6 +92,9 @@ vtkMRMLMarkupsDisplayableManager2D::vtkMRMLMarkupsDisplayableManager2D()
   this->LastClickWorldCoordinates[1]=0.0;
   this->LastClickWorldCoordinates[2]=0.0;
   this->LastClickWorldCoordinates[3]=1.0;
+
+  this->RasToXyMatrix = vtkSmartPointer<vtkMatrix4x4>::New();
+  this->RasToXyMatrixMTime = 0;
 }
 
 //---------------------------------------------------------------------------
@@ -391,6 +394,7 @@ void vtkMRMLMarkupsDisplayableManager2D::OnMRMLSceneEndClose()
   vtkDebugMacro("OnMRMLSceneEndClose: remove observers?");
   // run through all nodes and remove node and widget
   this->Helper->RemoveAllWidgetsAndNodes();
+  this->NodeBoundsCache.clear();
 
   this->SetUpdateFromMRMLRequested(1);
   this->RequestRender();
@@ -511,6 +515,7 @@ void vtkMRMLMarkupsDisplayableManager2D::OnMRMLSceneNodeRemoved(vtkMRMLNode* nod
 
   // Remove the widget and the MRMLnode from the internal lists.
   this->Helper->RemoveWidgetAndNode(markupsNode);
+  this->NodeBoundsCache.erase(markupsNode);
 
   // Refresh observers
   vtkUnObserveMRMLNodeMacro(markupsNode);
@@ -612,8 +617,20 @@ void vtkMRMLMarkupsDisplayableManager2D::OnMRMLMarkupsPointModifiedEvent(vtkMRML
   vtkAbstractWidget *widget = this->Helper->GetWidget(markupsNode);
   if (widget)
     {
-    // Update the standard settings of all widgets.
-    this->UpdateNthSeedPositionFromMRML(n, widget, markupsNode);
+    if (n < 0)
+      {
+      // batch update (compressed event without a point index), update all points
+      int numberOfMarkups = markupsNode->GetNumberOfMarkups();
+      for (int i = 0; i < numberOfMarkups; i++)
+        {
+        this->UpdateNthSeedPositionFromMRML(i, widget, markupsNode);
+        }
+      }
+    else
+      {
+      // Update the standard settings of all widgets.
+      this->UpdateNthSeedPositionFromMRML(n, widget, markupsNode);
+      }
 
     // Propagate MRML changes to widget
     this->PropagateMRMLToWidget(markupsNode, widget);
@@ -799,6 +816,18 @@ void vtkMRMLMarkupsDisplayableManager2D::OnMRMLSliceNodeModifiedEvent()
     // we loop through all nodes
     vtkMRMLMarkupsNode * markupsNode = *it;
 
+    // skip nodes whose points are all far away from the slice plane: their
+    // widgets were already hidden when the slice last moved off them, so there
+    // is nothing to update until the slice reaches their bounds again
+    bool offSlice = this->IsNodeEntirelyOffSlice(markupsNode);
+    bool wasOffSlice = this->NodeBoundsCache[markupsNode].OffSlice;
+    this->NodeBoundsCache[markupsNode].OffSlice = offSlice;
+    if (offSlice && wasOffSlice)
+      {
+      ++it;
+      continue;
+      }
+
     vtkAbstractWidget* widget = this->Helper->GetWidget(markupsNode);
     this->PropagateMRMLToWidget(markupsNode, widget);
 
@@ -806,6 +835,98 @@ void vtkMRMLMarkupsDisplayableManager2D::OnMRMLSliceNodeModifiedEvent()
     }
 }
 
+//---------------------------------------------------------------------------
+bool vtkMRMLMarkupsDisplayableManager2D::IsNodeEntirelyOffSlice(vtkMRMLMarkupsNode* markupsNode)
+{
+  vtkMRMLSliceNode* sliceNode = this->GetMRMLSliceNode();
+  if (!markupsNode || !sliceNode)
+    {
+    return false;
+    }
+  if (this->IsInLightboxMode())
+    {
+    // the per-point light box index checks cannot be summarized by a bounding box
+    return false;
+    }
+  vtkMRMLTransformNode* transformNode = markupsNode->GetParentTransformNode();
+  if (transformNode && !transformNode->IsTransformToWorldLinear())
+    {
+    // the bounding box corners only bound the transformed points for linear transforms
+    return false;
+    }
+
+  // look up the cached point bounds of the node, recompute them only if the
+  // node has been modified since they were last computed
+  NodeBoundsCacheEntry& entry = this->NodeBoundsCache[markupsNode];
+  if (entry.NodeMTime != markupsNode->GetMTime())
+    {
+    entry.Bounds[0] = entry.Bounds[2] = entry.Bounds[4] = VTK_DOUBLE_MAX;
+    entry.Bounds[1] = entry.Bounds[3] = entry.Bounds[5] = -VTK_DOUBLE_MAX;
+    int numberOfMarkups = markupsNode->GetNumberOfMarkups();
+    for (int markupIndex = 0; markupIndex < numberOfMarkups; markupIndex++)
+      {
+      int numberOfPoints = markupsNode->GetNumberOfPointsInNthMarkup(markupIndex);
+      for (int pointIndex = 0; pointIndex < numberOfPoints; pointIndex++)
+        {
+        double point[3] = {0.0, 0.0, 0.0};
+        markupsNode->GetMarkupPoint(markupIndex, pointIndex, point);
+        for (int axis = 0; axis < 3; axis++)
+          {
+          if (point[axis] < entry.Bounds[2*axis])
+            {
+            entry.Bounds[2*axis] = point[axis];
+            }
+          if (point[axis] > entry.Bounds[2*axis + 1])
+            {
+            entry.Bounds[2*axis + 1] = point[axis];
+            }
+          }
+        }
+      }
+    entry.NodeMTime = markupsNode->GetMTime();
+    }
+  if (entry.Bounds[0] > entry.Bounds[1])
+    {
+    // no points in the node
+    return false;
+    }
+
+  // transform the eight bounding box corners to display coordinates and check
+  // if they are all on the same side of the displayable slice range; the
+  // transforms are affine so the corners bound the display z of every point
+  vtkNew<vtkMatrix4x4> nodeToWorldMatrix;
+  nodeToWorldMatrix->Identity();
+  if (transformNode)
+    {
+    transformNode->GetMatrixTransformToWorld(nodeToWorldMatrix.GetPointer());
+    }
+  double zMin = VTK_DOUBLE_MAX;
+  double zMax = -VTK_DOUBLE_MAX;
+  for (int cornerIndex = 0; cornerIndex < 8; cornerIndex++)
+    {
+    double corner[4] = {entry.Bounds[cornerIndex & 1],
+                        entry.Bounds[2 + ((cornerIndex >> 1) & 1)],
+                        entry.Bounds[4 + ((cornerIndex >> 2) & 1)],
+                        1.0};
+    double worldCorner[4] = {0.0, 0.0, 0.0, 1.0};
+    nodeToWorldMatrix->MultiplyPoint(corner, worldCorner);
+    double displayCorner[4] = {0.0, 0.0, 0.0, 1.0};
+    this->GetWorldToDisplayCoordinates(worldCorner, displayCorner);
+    if (displayCorner[2] < zMin)
+      {
+      zMin = displayCorner[2];
+      }
+    if (displayCorner[2] > zMax)
+      {
+      zMax = displayCorner[2];
+      }
+    }
+
+  // same criterion as the per-point check in IsWidgetDisplayableOnSlice
+  double maxDistance = 0.5 + (sliceNode->GetDimensions()[2] - 1);
+  return (zMax < -0.5 || zMin >= maxDistance);
+}
+
 //---------------------------------------------------------------------------
 bool vtkMRMLMarkupsDisplayableManager2D::IsWidgetDisplayableOnSlice(vtkMRMLMarkupsNode* node, int markupIndex)
 {
@@ -1210,10 +1331,15 @@ void vtkMRMLMarkupsDisplayableManager2D::GetWorldToDisplayCoordinates(double r,
   // we will get the transformation matrix to convert world coordinates to the display coordinates of the specific sliceNode
 
   vtkMatrix4x4 * xyToRasMatrix = this->GetMRMLSliceNode()->GetXYToRAS();
-  vtkNew<vtkMatrix4x4> rasToXyMatrix;
 
-  // we need to invert this matrix
-  xyToRasMatrix->Invert(xyToRasMatrix, rasToXyMatrix.GetPointer());
+  // we need the inverse of this matrix. This conversion runs once per point on
+  // every slice update, so the inverse is cached and only recomputed when the
+  // slice node matrix changes
+  if (xyToRasMatrix->GetMTime() != this->RasToXyMatrixMTime)
+    {
+    vtkMatrix4x4::Invert(xyToRasMatrix, this->RasToXyMatrix);
+    this->RasToXyMatrixMTime = xyToRasMatrix->GetMTime();
+    }
 
   double worldCoordinates[4];
   worldCoordinates[0] = r;
@@ -1221,7 +1347,7 @@ void vtkMRMLMarkupsDisplayableManager2D::GetWorldToDisplayCoordinates(double r,
   worldCoordinates[2] = s;
   worldCoordinates[3] = 1;
 
-  rasToXyMatrix->MultiplyPoint(worldCoordinates,displayCoordinates);
+  this->RasToXyMatrix->MultiplyPoint(worldCoordinates,displayCoordinates);
   xyToRasMatrix = NULL;
 }
 
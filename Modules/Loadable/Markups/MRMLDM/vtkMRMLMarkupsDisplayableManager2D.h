@@ -32,10 +32,14 @@
 #include <vtkHandleWidget.h>
 #include <vtkSeedWidget.h>
 
+// STD includes
+#include <map>
+
 class vtkMRMLMarkupsNode;
 class vtkSlicerViewerWidget;
 class vtkMRMLMarkupsDisplayNode;
 class vtkAbstractWidget;
+class vtkMatrix4x4;
 
 /// \ingroup Slicer_QtModules_Markups
 class  VTK_SLICER_MARKUPS_MODULE_MRMLDISPLAYABLEMANAGER_EXPORT vtkMRMLMarkupsDisplayableManager2D :
@@ -247,6 +251,33 @@ protected:
 
   double LastClickWorldCoordinates[4];
 
+  /// Cached inverse of the slice node's XYToRAS matrix. Converting world to display
+  /// coordinates is done once per point per slice update, so the inverse is only
+  /// recomputed when the slice node matrix changes instead of being inverted per point.
+  /// \sa GetWorldToDisplayCoordinates
+  vtkSmartPointer<vtkMatrix4x4> RasToXyMatrix;
+  unsigned long RasToXyMatrixMTime;
+
+  /// Cached point bounds and off-slice state of a markups node, used to skip
+  /// the per-point widget updates for nodes whose points are all far from the
+  /// slice plane when the slice is scrolled.
+  /// \sa IsNodeEntirelyOffSlice, OnMRMLSliceNodeModifiedEvent
+  struct NodeBoundsCacheEntry
+    {
+    double Bounds[6];
+    unsigned long NodeMTime;
+    bool OffSlice;
+    };
+  std::map<vtkMRMLMarkupsNode*, NodeBoundsCacheEntry> NodeBoundsCache;
+
+  /// Return true if the bounding box of all points of the node is entirely
+  /// away from the displayable slice range, so that no point of the node can
+  /// be visible on the slice. The point bounds are cached per node and only
+  /// recomputed when the node is modified. Conservative: returns false
+  /// whenever the test cannot be decided cheaply (no slice node, lightbox
+  /// mode, non-linearly transformed node, node without points).
+  bool IsNodeEntirelyOffSlice(vtkMRMLMarkupsNode* markupsNode);
+
 private:
 
   vtkMRMLMarkupsDisplayableManager2D(const vtkMRMLMarkupsDisplayableManager2D&); /// Not implemented
@@ -602,8 +602,20 @@ void vtkMRMLMarkupsDisplayableManager3D::OnMRMLMarkupsPointModifiedEvent(vtkMRML
   vtkAbstractWidget *widget = this->Helper->GetWidget(markupsNode);
   if (widget)
     {
-    // Update the standard settings of all widgets.
-    this->UpdateNthSeedPositionFromMRML(n, widget, markupsNode);
+    if (n < 0)
+      {
+      // batch update (compressed event without a point index), update all points
+      int numberOfMarkups = markupsNode->GetNumberOfMarkups();
+      for (int i = 0; i < numberOfMarkups; i++)
+        {
+        this->UpdateNthSeedPositionFromMRML(i, widget, markupsNode);
+        }
+      }
+    else
+      {
+      // Update the standard settings of all widgets.
+      this->UpdateNthSeedPositionFromMRML(n, widget, markupsNode);
+      }
 
     // Propagate MRML changes to widget
     this->PropagateMRMLToWidget(markupsNode, widget);
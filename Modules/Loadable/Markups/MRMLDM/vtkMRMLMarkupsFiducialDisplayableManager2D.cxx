@@ -45,6 +45,7 @@
 #include <vtkOrientedPolygonalHandleRepresentation3D.h>
 #include <vtkPickingManager.h>
 #include <vtkPointHandleRepresentation2D.h>
+#include <vtkPolyData.h>
 #include <vtkProperty2D.h>
 #include <vtkProperty.h>
 #include <vtkRenderer.h>
@@ -305,11 +306,7 @@ vtkAbstractWidget * vtkMRMLMarkupsFiducialDisplayableManager2D::CreateWidget(vtk
 
 
     // default to a sphere glyph, update in propagate mrml to widget
-    vtkNew<vtkMarkupsGlyphSource2D> glyphSource;
-    glyphSource->SetGlyphType(vtkMRMLMarkupsDisplayNode::Sphere3D);
-    glyphSource->Update();
-    glyphSource->SetScale(1.0);
-    handle->SetHandle(glyphSource->GetOutput());
+    handle->SetHandle(this->GetGlyphPolyData(vtkMRMLMarkupsDisplayNode::Sphere3D));
     rep->SetHandleRepresentation(handle.GetPointer());
     }
   else
@@ -504,6 +501,25 @@ bool vtkMRMLMarkupsFiducialDisplayableManager2D::UpdateNthSeedPositionFromMRML(i
   return positionChanged;
 }
 
+//---------------------------------------------------------------------------
+vtkPolyData* vtkMRMLMarkupsFiducialDisplayableManager2D::GetGlyphPolyData(int glyphType)
+{
+  std::map<int, vtkSmartPointer<vtkPolyData> >::iterator glyphIt =
+    this->GlyphPolyDataCache.find(glyphType);
+  if (glyphIt != this->GlyphPolyDataCache.end())
+    {
+    return glyphIt->second;
+    }
+  vtkNew<vtkMarkupsGlyphSource2D> glyphSource;
+  glyphSource->SetGlyphType(glyphType);
+  glyphSource->Update();
+  // The output polydata outlives the source algorithm, handle
+  // representations only read it
+  vtkSmartPointer<vtkPolyData> glyphPolyData = glyphSource->GetOutput();
+  this->GlyphPolyDataCache[glyphType] = glyphPolyData;
+  return glyphPolyData;
+}
+
 //---------------------------------------------------------------------------
 void vtkMRMLMarkupsFiducialDisplayableManager2D::SetNthSeed(int n, vtkMRMLMarkupsFiducialNode* fiducialNode, vtkSeedWidget *seedWidget)
 {
@@ -612,33 +628,22 @@ void vtkMRMLMarkupsFiducialDisplayableManager2D::SetNthSeed(int n, vtkMRMLMarkup
         {
         // map the 3d sphere to a filled circle, the 3d diamond to a filled
         // diamond
-        vtkNew<vtkMarkupsGlyphSource2D> glyphSource;
+        int glyphType = vtkMRMLMarkupsDisplayNode::StarBurst2D;
         if (displayNode->GetGlyphType() == vtkMRMLMarkupsDisplayNode::Sphere3D)
           {
           // std::cout << "using circle 2d for sphere 3d" << std::endl;
-          glyphSource->SetGlyphType(vtkMRMLMarkupsDisplayNode::Circle2D);
+          glyphType = vtkMRMLMarkupsDisplayNode::Circle2D;
           }
         else if (displayNode->GetGlyphType() == vtkMRMLMarkupsDisplayNode::Diamond3D)
           {
-          glyphSource->SetGlyphType(vtkMRMLMarkupsDisplayNode::Diamond2D);
-          }
-        else
-          {
-          glyphSource->SetGlyphType(vtkMRMLMarkupsDisplayNode::StarBurst2D);
-          // std::cout << "2d starburst" << std::endl;
+          glyphType = vtkMRMLMarkupsDisplayNode::Diamond2D;
           }
-        glyphSource->Update();
-        glyphSource->SetScale(1.0);
-        handleRep->SetHandle(glyphSource->GetOutput());
+        handleRep->SetHandle(this->GetGlyphPolyData(glyphType));
         }//if (displayNode->GlyphTypeIs3D())
       else
         {
         // 2D
-        vtkNew<vtkMarkupsGlyphSource2D> glyphSource;
-        glyphSource->SetGlyphType(displayNode->GetGlyphType());
-        glyphSource->Update();
-        glyphSource->SetScale(1.0);
-        handleRep->SetHandle(glyphSource->GetOutput());
+        handleRep->SetHandle(this->GetGlyphPolyData(displayNode->GetGlyphType()));
         }
       // TBD: keep with the assumption of one glyph type per markups node,
       // that each seed has to have the same type, but update if necessary
@@ -1491,7 +1496,7 @@ void vtkMRMLMarkupsFiducialDisplayableManager2D::OnMRMLSceneEndClose()
 void vtkMRMLMarkupsFiducialDisplayableManager2D::OnMRMLMarkupsNodeNthMarkupModifiedEvent(vtkMRMLMarkupsNode* node, int n)
 {
   int numberOfMarkups = node->GetNumberOfMarkups();
-  if (n < 0 || n >= numberOfMarkups)
+  if (n >= numberOfMarkups)
     {
     vtkErrorMacro("OnMRMLMarkupsNodeNthMarkupModifiedEvent: n = " << n << " is out of range 0-" << numberOfMarkups);
     return;
@@ -1510,6 +1515,15 @@ void vtkMRMLMarkupsFiducialDisplayableManager2D::OnMRMLMarkupsNodeNthMarkupModif
    vtkErrorMacro("OnMRMLMarkupsNodeNthMarkupModifiedEvent: Could not get seed widget!")
    return;
    }
+  if (n < 0)
+    {
+    // batch update (compressed event without a markup index), update all seeds
+    for (int i = 0; i < numberOfMarkups; i++)
+      {
+      this->SetNthSeed(i, vtkMRMLMarkupsFiducialNode::SafeDownCast(node), seedWidget);
+      }
+    return;
+    }
   this->SetNthSeed(n, vtkMRMLMarkupsFiducialNode::SafeDownCast(node), seedWidget);
 }
 
@@ -24,7 +24,14 @@
 // MarkupsModule/MRMLDisplayableManager includes
 #include "vtkMRMLMarkupsDisplayableManager2D.h"
 
+// VTK includes
+#include <vtkSmartPointer.h>
+
+// STD includes
+#include <map>
+
 class vtkMRMLMarkupsFiducialNode;
+class vtkPolyData;
 class vtkSlicerViewerWidget;
 class vtkMRMLMarkupsDisplayNode;
 class vtkTextWidget;
@@ -66,6 +73,11 @@ protected:
 
   /// Update a single seed from MRML
   void SetNthSeed(int n, vtkMRMLMarkupsFiducialNode* fiducialNode, vtkSeedWidget *seedWidget);
+
+  /// Return the glyph polydata for a glyph type, generating it on first
+  /// use. The same polydata is shared by all seed handles that display
+  /// the glyph type, instead of running a glyph source per handle.
+  vtkPolyData* GetGlyphPolyData(int glyphType);
   /// Propagate properties of MRML node to widget.
   virtual void PropagateMRMLToWidget(vtkMRMLMarkupsNode* node, vtkAbstractWidget * widget) VTK_OVERRIDE;
 
@@ -85,6 +97,9 @@ protected:
 
 private:
 
+  /// Glyph type -> glyph polydata, lazily filled by GetGlyphPolyData()
+  std::map<int, vtkSmartPointer<vtkPolyData> > GlyphPolyDataCache;
+
   vtkMRMLMarkupsFiducialDisplayableManager2D(const vtkMRMLMarkupsFiducialDisplayableManager2D&); /// Not implemented
   void operator=(const vtkMRMLMarkupsFiducialDisplayableManager2D&); /// Not Implemented
 
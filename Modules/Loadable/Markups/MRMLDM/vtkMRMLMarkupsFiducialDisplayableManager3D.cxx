@@ -936,7 +936,7 @@ void vtkMRMLMarkupsFiducialDisplayableManager3D::OnMRMLSceneEndClose()
 void vtkMRMLMarkupsFiducialDisplayableManager3D::OnMRMLMarkupsNodeNthMarkupModifiedEvent(vtkMRMLMarkupsNode* node, int n)
 {
   int numberOfMarkups = node->GetNumberOfMarkups();
-  if (n < 0 || n >= numberOfMarkups)
+  if (n >= numberOfMarkups)
     {
     vtkErrorMacro("OnMRMLMarkupsNodeNthMarkupModifiedEvent: n = " << n << " is out of range 0-" << numberOfMarkups);
     return;
@@ -955,6 +955,15 @@ void vtkMRMLMarkupsFiducialDisplayableManager3D::OnMRMLMarkupsNodeNthMarkupModif
    vtkErrorMacro("OnMRMLMarkupsNodeNthMarkupModifiedEvent: Could not get seed widget!")
    return;
    }
+  if (n < 0)
+    {
+    // batch update (compressed event without a markup index), update all seeds
+    for (int i = 0; i < numberOfMarkups; i++)
+      {
+      this->SetNthSeed(i, vtkMRMLMarkupsFiducialNode::SafeDownCast(node), seedWidget);
+      }
+    return;
+    }
   this->SetNthSeed(n, vtkMRMLMarkupsFiducialNode::SafeDownCast(node), seedWidget);
 }
 
@@ -2967,9 +2967,15 @@ void qSlicerMarkupsModuleWidget::onActiveMarkupsNodeNthMarkupModifiedEvent(vtkOb
 {
   //qDebug() << "onActiveMarkupsNodeNthMarkupModifiedEvent\n";
 
+  if (caller == NULL)
+    {
+    return;
+    }
   // the call data should be the index n
-  if (caller == NULL || callData == NULL)
+  if (callData == NULL)
     {
+    // batch update
+    this->updateWidgetFromMRML();
     return;
     }
 
@@ -2988,9 +2994,15 @@ void qSlicerMarkupsModuleWidget::onActiveMarkupsNodePointModifiedEvent(vtkObject
 {
   //qDebug() << "onActiveMarkupsNodePointModifiedEvent";
 
+  if (caller == NULL)
+    {
+    return;
+    }
   // the call data should be the index n
-  if (caller == NULL || callData == NULL)
+  if (callData == NULL)
     {
+    // batch update
+    this->updateWidgetFromMRML();
     return;
     }
   // qDebug() << "\tcaller class = " << caller->GetClassName();
@@ -19,6 +19,10 @@ class SegmentEditorThresholdEffect(AbstractScriptedSegmentEditorEffect):
     # Effect-specific members
     import vtkITK
     self.autoThresholdCalculator = vtkITK.vtkITKImageThresholdCalculator()
+    # Automatic thresholds computed for the current master image, keyed by
+    # (method, image modified time). Stepping through the methods with the
+    # </> buttons then scans the volume only once per method.
+    self.autoThresholdCache = {}
 
     self.timer = qt.QTimer()
     self.previewState = 0
@@ -166,6 +170,8 @@ class SegmentEditorThresholdEffect(AbstractScriptedSegmentEditorEffect):
     return slicer.util.mainWindow().cursor
 
   def masterVolumeNodeChanged(self):
+    # Thresholds computed for the previous master volume are not valid anymore
+    self.autoThresholdCache = {}
     # Set scalar range of master volume image data to threshold slider
     import vtkSegmentationCorePython as vtkSegmentationCore
     masterImageData = self.scriptedEffect.masterVolumeImageData()
@@ -283,10 +289,18 @@ class SegmentEditorThresholdEffect(AbstractScriptedSegmentEditorEffect):
       logging.error("Unknown AutoThresholdMethod {0}".format(autoThresholdMethod))
 
     masterImageData = self.scriptedEffect.masterVolumeImageData()
-    self.autoThresholdCalculator.SetInputData(masterImageData)
 
-    self.autoThresholdCalculator.Update()
-    computedThreshold = self.autoThresholdCalculator.GetThreshold()
+    # Computing a threshold scans the whole volume, so the result is cached
+    # for the current image; trying the same method again (e.g. when iterating
+    # through the methods) only costs a lookup
+    cacheKey = (autoThresholdMethod, masterImageData.GetMTime())
+    if cacheKey in self.autoThresholdCache:
+      computedThreshold = self.autoThresholdCache[cacheKey]
+    else:
+      self.autoThresholdCalculator.SetInputData(masterImageData)
+      self.autoThresholdCalculator.Update()
+      computedThreshold = self.autoThresholdCalculator.GetThreshold()
+      self.autoThresholdCache[cacheKey] = computedThreshold
 
     masterVolumeMin, masterVolumeMax = masterImageData.GetScalarRange()
 
@@ -392,7 +406,12 @@ class SegmentEditorThresholdEffect(AbstractScriptedSegmentEditorEffect):
       sliceLogic = sliceWidget.sliceLogic()
       backgroundLogic = sliceLogic.GetBackgroundLayer()
       pipeline.thresholdFilter.SetInputConnection(backgroundLogic.GetReslice().GetOutputPort())
-      pipeline.thresholdFilter.ThresholdBetween(min, max)
+      # Only touch the threshold filter when the range actually changed;
+      # the opacity pulse itself only needs the lookup table update, so an
+      # unchanged range does not re-threshold the slice on every pulse
+      if pipeline.previewThresholdRange != (min, max):
+        pipeline.thresholdFilter.ThresholdBetween(min, max)
+        pipeline.previewThresholdRange = (min, max)
       pipeline.actor.VisibilityOn()
       sliceWidget.sliceView().scheduleRender()
 
@@ -422,6 +441,8 @@ class PreviewPipeline:
     self.thresholdFilter.SetInValue(1)
     self.thresholdFilter.SetOutValue(0)
     self.thresholdFilter.SetOutputScalarTypeToUnsignedChar()
+    # Threshold range currently set on the filter (\sa preview)
+    self.previewThresholdRange = (None, None)
 
     # Feedback actor
     self.mapper = vtk.vtkImageMapper()
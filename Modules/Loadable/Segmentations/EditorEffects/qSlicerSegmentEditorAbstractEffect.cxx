@@ -214,27 +214,37 @@ void qSlicerSegmentEditorAbstractEffect::applyImageMask(vtkOrientedImageData* in
     return;
     }
 
-  // Make sure mask has the same extent as the input labelmap
-  vtkSmartPointer<vtkImageConstantPad> padder = vtkSmartPointer<vtkImageConstantPad>::New();
-  padder->SetInputData(mask);
-  padder->SetOutputWholeExtent(input->GetExtent());
-  padder->Update();
-  //mask->DeepCopy(padder->GetOutput());
-
   // Apply mask
   vtkSmartPointer<vtkImageMask> masker = vtkSmartPointer<vtkImageMask>::New();
   masker->SetImageInputData(input);
-  //masker->SetMaskInputData(resampledMask);
-  masker->SetMaskInputData(padder->GetOutput());
-  //masker->SetMaskInputData(mask);
+  int* inputExtent = input->GetExtent();
+  int* maskExtent = mask->GetExtent();
+  if (maskExtent[0] == inputExtent[0] && maskExtent[1] == inputExtent[1]
+    && maskExtent[2] == inputExtent[2] && maskExtent[3] == inputExtent[3]
+    && maskExtent[4] == inputExtent[4] && maskExtent[5] == inputExtent[5])
+    {
+    // Extents already match, the padding pass (and its temporary image) can be skipped
+    masker->SetMaskInputData(mask);
+    }
+  else
+    {
+    // Make sure mask has the same extent as the input labelmap
+    vtkSmartPointer<vtkImageConstantPad> padder = vtkSmartPointer<vtkImageConstantPad>::New();
+    padder->SetInputData(mask);
+    padder->SetOutputWholeExtent(input->GetExtent());
+    padder->Update();
+    masker->SetMaskInputData(padder->GetOutput());
+    }
   masker->SetNotMask(notMask);
   masker->SetMaskedOutputValue(fillValue);
   masker->Update();
 
-  // Copy masked input to input
+  // Move masked output into input. Shallow copy is enough because the masker
+  // filter and so the only other reference to the voxel array goes out of scope
+  // when this method returns.
   vtkSmartPointer<vtkMatrix4x4> inputImageToWorldMatrix = vtkSmartPointer<vtkMatrix4x4>::New();
   input->GetImageToWorldMatrix(inputImageToWorldMatrix);
-  input->DeepCopy(masker->GetOutput());
+  input->ShallowCopy(masker->GetOutput());
   input->SetGeometryFromImageToWorldMatrix(inputImageToWorldMatrix);
 }
 
@@ -316,7 +326,7 @@ void qSlicerSegmentEditorAbstractEffect::modifySelectedSegmentByLabelmap(vtkOrie
     threshold->Update();
 
     vtkSmartPointer<vtkOrientedImageData> thresholdMask = vtkSmartPointer<vtkOrientedImageData>::New();
-    thresholdMask->DeepCopy(threshold->GetOutput());
+    thresholdMask->ShallowCopy(threshold->GetOutput());
     vtkSmartPointer<vtkMatrix4x4> modifierLabelmapToWorldMatrix = vtkSmartPointer<vtkMatrix4x4>::New();
     modifierLabelmap->GetImageToWorldMatrix(modifierLabelmapToWorldMatrix);
     thresholdMask->SetGeometryFromImageToWorldMatrix(modifierLabelmapToWorldMatrix);
@@ -326,6 +326,9 @@ public:
   bool showEffectCursorInThreeDView();
 
   /// Get image data of master volume aligned with the modifier labelmap.
+  /// The image is shared between the effects and may reference the voxels
+  /// of the master volume node directly (when no resampling was needed),
+  /// so it must only be read, never modified.
   /// \return Pointer to the image data
   Q_INVOKABLE vtkOrientedImageData* masterVolumeImageData();
 
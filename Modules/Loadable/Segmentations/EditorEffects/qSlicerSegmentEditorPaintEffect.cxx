@@ -44,8 +44,8 @@
 #include <vtkCellPicker.h>
 #include <vtkCollection.h>
 #include <vtkCommand.h>
+#include <vtkFloatArray.h>
 #include <vtkGlyph2D.h>
-#include <vtkGlyph3D.h>
 #include <vtkIdList.h>
 #include <vtkImageChangeInformation.h>
 #include <vtkImageStencil.h>
@@ -56,6 +56,7 @@
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
 #include <vtkPlane.h>
+#include <vtkPointData.h>
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkPolyDataMapper.h>
@@ -95,6 +96,81 @@
 #include "vtkMRMLSliceLayerLogic.h"
 #include "vtkOrientedImageDataResample.h"
 
+// STD includes
+#include <vector>
+
+//-----------------------------------------------------------------------------
+namespace
+{
+
+// Reset a stroke feedback polydata to empty geometry that
+// AppendFeedbackPiece can grow in place
+void ResetFeedbackPolyData(vtkPolyData* polyData, bool withNormals)
+{
+  vtkNew<vtkPoints> points;
+  polyData->SetPoints(points.GetPointer());
+  vtkNew<vtkCellArray> lines;
+  polyData->SetLines(lines.GetPointer());
+  vtkNew<vtkCellArray> polys;
+  polyData->SetPolys(polys.GetPointer());
+  vtkNew<vtkCellArray> strips;
+  polyData->SetStrips(strips.GetPointer());
+  polyData->GetPointData()->Initialize();
+  if (withNormals)
+    {
+    vtkNew<vtkFloatArray> normals;
+    normals->SetNumberOfComponents(3);
+    normals->SetName("Normals");
+    polyData->GetPointData()->SetNormals(normals.GetPointer());
+    }
+  polyData->Modified();
+}
+
+//-----------------------------------------------------------------------------
+void AppendFeedbackCells(vtkCellArray* destination, vtkCellArray* source, vtkIdType pointOffset)
+{
+  vtkIdType numberOfCellPoints = 0;
+  vtkIdType* cellPoints = NULL;
+  for (source->InitTraversal(); source->GetNextCell(numberOfCellPoints, cellPoints);)
+    {
+    destination->InsertNextCell(numberOfCellPoints);
+    for (vtkIdType pointIndex = 0; pointIndex < numberOfCellPoints; pointIndex++)
+      {
+      destination->InsertCellPoint(cellPoints[pointIndex] + pointOffset);
+      }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Append the points and cells of a piece to an accumulated stroke feedback
+// polydata, offsetting the point indices of the appended cells
+void AppendFeedbackPiece(vtkPolyData* accumulated, vtkPolyData* piece)
+{
+  if (!piece || piece->GetNumberOfPoints() == 0)
+    {
+    return;
+    }
+  vtkPoints* points = accumulated->GetPoints();
+  vtkIdType pointOffset = points->GetNumberOfPoints();
+  vtkDataArray* accumulatedNormals = accumulated->GetPointData()->GetNormals();
+  vtkDataArray* pieceNormals = piece->GetPointData()->GetNormals();
+  vtkIdType numberOfPoints = piece->GetNumberOfPoints();
+  for (vtkIdType pointIndex = 0; pointIndex < numberOfPoints; pointIndex++)
+    {
+    points->InsertNextPoint(piece->GetPoint(pointIndex));
+    if (accumulatedNormals && pieceNormals)
+      {
+      accumulatedNormals->InsertNextTuple(pieceNormals->GetTuple(pointIndex));
+      }
+    }
+  AppendFeedbackCells(accumulated->GetLines(), piece->GetLines(), pointOffset);
+  AppendFeedbackCells(accumulated->GetPolys(), piece->GetPolys(), pointOffset);
+  AppendFeedbackCells(accumulated->GetStrips(), piece->GetStrips(), pointOffset);
+  accumulated->Modified();
+}
+
+} // namespace
+
 //-----------------------------------------------------------------------------
 /// Visualization objects and pipeline for each slice view for the paint brush
 class BrushPipeline
@@ -135,13 +211,14 @@ public:
     this->BrushActor->SetMapper(this->BrushMapper);
     this->BrushActor->VisibilityOff();
 
-    this->FeedbackCutter = vtkSmartPointer<vtkCutter>::New();
-    this->FeedbackCutter->SetCutFunction(this->SlicePlane);
-    this->FeedbackCutter->SetGenerateCutScalars(0);
+    // Accumulated contours of the brush stamps of the current stroke in
+    // this view's plane (\sa qSlicerSegmentEditorPaintEffectPrivate::appendFeedbackStamp)
+    this->FeedbackPolyData = vtkSmartPointer<vtkPolyData>::New();
+    ResetFeedbackPolyData(this->FeedbackPolyData, false);
 
     this->FeedbackWorldToSliceTransformer = vtkSmartPointer<vtkTransformPolyDataFilter>::New();
     this->FeedbackWorldToSliceTransformer->SetTransform(this->WorldToSliceTransform);
-    this->FeedbackWorldToSliceTransformer->SetInputConnection(this->FeedbackCutter->GetOutputPort());
+    this->FeedbackWorldToSliceTransformer->SetInputData(this->FeedbackPolyData);
 
     this->FeedbackMapper = vtkSmartPointer<vtkPolyDataMapper2D>::New();
     this->FeedbackMapper->SetInputConnection(this->FeedbackWorldToSliceTransformer->GetOutputPort());
@@ -171,7 +248,7 @@ public:
   vtkSmartPointer<vtkPolyDataMapper2D> FeedbackMapper;
   vtkSmartPointer<vtkCutter> BrushCutter;
   vtkSmartPointer<vtkTransformPolyDataFilter> BrushWorldToSliceTransformer;
-  vtkSmartPointer<vtkCutter> FeedbackCutter;
+  vtkSmartPointer<vtkPolyData> FeedbackPolyData;
   vtkSmartPointer<vtkTransformPolyDataFilter> FeedbackWorldToSliceTransformer;
 };
 
@@ -234,8 +311,6 @@ qSlicerSegmentEditorPaintEffectPrivate::qSlicerSegmentEditorPaintEffectPrivate(q
   , BrushPixelModeCheckbox(NULL)
 {
   this->PaintCoordinates_World = vtkSmartPointer<vtkPoints>::New();
-  this->FeedbackPointsPolyData = vtkSmartPointer<vtkPolyData>::New();
-  this->FeedbackPointsPolyData->SetPoints(this->PaintCoordinates_World);
 
   this->PaintIcon = QIcon(":Icons/Paint.png");
 
@@ -261,9 +336,26 @@ qSlicerSegmentEditorPaintEffectPrivate::qSlicerSegmentEditorPaintEffectPrivate(q
   this->BrushPolyDataToStencil->SetOutputSpacing(1.0,1.0,1.0);
   this->BrushPolyDataToStencil->SetInputConnection(this->WorldOriginToModifierLabelmapIjkTransformer->GetOutputPort());
 
-  this->FeedbackGlyphFilter = vtkSmartPointer<vtkGlyph3D>::New();
-  this->FeedbackGlyphFilter->SetInputData(this->FeedbackPointsPolyData);
-  this->FeedbackGlyphFilter->SetSourceConnection(this->BrushPolyDataNormals->GetOutputPort());
+  // Persistent stamping pipeline and accumulation buffers, reused across
+  // brush applications (\sa paintApply)
+  this->BrushStencilToImage = vtkSmartPointer<vtkImageStencilToImage>::New();
+  this->BrushStencilToImage->SetInputConnection(this->BrushPolyDataToStencil->GetOutputPort());
+  this->BrushPositioner = vtkSmartPointer<vtkImageChangeInformation>::New();
+  this->BrushPositioner->SetInputConnection(this->BrushStencilToImage->GetOutputPort());
+  this->BrushStampLabelmap = vtkSmartPointer<vtkOrientedImageData>::New();
+  this->StrokeLabelmap = vtkSmartPointer<vtkOrientedImageData>::New();
+
+  // Stroke feedback: accumulated geometry grown one brush stamp at a time
+  // (\sa appendFeedbackStamp)
+  this->FeedbackPolyData_World = vtkSmartPointer<vtkPolyData>::New();
+  ResetFeedbackPolyData(this->FeedbackPolyData_World, true);
+  this->FeedbackStampTransformer = vtkSmartPointer<vtkTransformPolyDataFilter>::New();
+  this->FeedbackStampTransform = vtkSmartPointer<vtkTransform>::New();
+  this->FeedbackStampTransformer->SetTransform(this->FeedbackStampTransform);
+  this->FeedbackStampTransformer->SetInputConnection(this->BrushPolyDataNormals->GetOutputPort());
+  this->FeedbackStampCutter = vtkSmartPointer<vtkCutter>::New();
+  this->FeedbackStampCutter->SetGenerateCutScalars(0);
+  this->FeedbackStampCutter->SetInputConnection(this->FeedbackStampTransformer->GetOutputPort());
 
   this->ActiveViewLastInteractionPosition[0] = 0;
   this->ActiveViewLastInteractionPosition[1] = 0;
@@ -292,7 +384,6 @@ BrushPipeline* qSlicerSegmentEditorPaintEffectPrivate::brushForWidget(qMRMLWidge
     {
     BrushPipeline2D* pipeline = new BrushPipeline2D();
     pipeline->BrushCutter->SetInputConnection(this->WorldOriginToWorldTransformer->GetOutputPort());
-    pipeline->FeedbackCutter->SetInputConnection(this->FeedbackGlyphFilter->GetOutputPort());
     this->updateBrush(viewWidget, pipeline);
     q->addActor2D(viewWidget, pipeline->BrushActor);
     q->addActor2D(viewWidget, pipeline->FeedbackActor);
@@ -303,7 +394,7 @@ BrushPipeline* qSlicerSegmentEditorPaintEffectPrivate::brushForWidget(qMRMLWidge
     {
     BrushPipeline3D* pipeline = new BrushPipeline3D();
     pipeline->BrushMapper->SetInputConnection(this->WorldOriginToWorldTransformer->GetOutputPort());
-    pipeline->FeedbackMapper->SetInputConnection(this->FeedbackGlyphFilter->GetOutputPort());
+    pipeline->FeedbackMapper->SetInputData(this->FeedbackPolyData_World);
     this->updateBrush(viewWidget, pipeline);
     q->addActor3D(viewWidget, pipeline->BrushActor);
     q->addActor3D(viewWidget, pipeline->FeedbackActor);
@@ -327,6 +418,59 @@ void qSlicerSegmentEditorPaintEffectPrivate::paintAddPoint(qMRMLWidget* viewWidg
     this->paintApply(viewWidget);
     qSlicerSegmentEditorAbstractEffect::forceRender(viewWidget); // TODO: repaint all?
     }
+  else
+    {
+    this->appendFeedbackStamp(viewWidget, brushPosition_World);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void qSlicerSegmentEditorPaintEffectPrivate::appendFeedbackStamp(qMRMLWidget* viewWidget, double brushPosition_World[3])
+{
+  // Make sure the brush source matches the current shape and diameter,
+  // then stamp it at the new stroke position. Only this one stamp is
+  // transformed and cut; the earlier stamps of the stroke are already
+  // part of the accumulated feedback geometry.
+  this->updateBrushModel(viewWidget, NULL);
+  if (this->BrushToWorldOriginTransformer->GetNumberOfInputConnections(0) == 0)
+    {
+    return;
+    }
+  this->FeedbackStampTransform->Identity();
+  this->FeedbackStampTransform->Translate(brushPosition_World);
+  this->FeedbackStampTransformer->Update();
+  AppendFeedbackPiece(this->FeedbackPolyData_World, this->FeedbackStampTransformer->GetOutput());
+
+  // The slice views show the contour of the stamp in their own plane
+  QMapIterator<qMRMLWidget*, BrushPipeline*> it(this->BrushPipelines);
+  while (it.hasNext())
+    {
+    it.next();
+    BrushPipeline2D* pipeline2D = dynamic_cast<BrushPipeline2D*>(it.value());
+    if (!pipeline2D)
+      {
+      continue;
+      }
+    this->FeedbackStampCutter->SetCutFunction(pipeline2D->SlicePlane);
+    this->FeedbackStampCutter->Update();
+    AppendFeedbackPiece(pipeline2D->FeedbackPolyData, this->FeedbackStampCutter->GetOutput());
+    }
+}
+
+//-----------------------------------------------------------------------------
+void qSlicerSegmentEditorPaintEffectPrivate::resetFeedback()
+{
+  ResetFeedbackPolyData(this->FeedbackPolyData_World, true);
+  QMapIterator<qMRMLWidget*, BrushPipeline*> it(this->BrushPipelines);
+  while (it.hasNext())
+    {
+    it.next();
+    BrushPipeline2D* pipeline2D = dynamic_cast<BrushPipeline2D*>(it.value());
+    if (pipeline2D)
+      {
+      ResetFeedbackPolyData(pipeline2D->FeedbackPolyData, false);
+      }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -384,56 +528,81 @@ void qSlicerSegmentEditorPaintEffectPrivate::paintApply(qMRMLWidget* viewWidget)
     vtkNew<vtkPoints> paintCoordinates_Ijk;
     worldToModifierLabelmapIjkTransform->TransformPoints(this->PaintCoordinates_World, paintCoordinates_Ijk.GetPointer());
 
-    vtkNew<vtkImageStencilToImage> stencilToImage;
-    stencilToImage->SetInputConnection(this->BrushPolyDataToStencil->GetOutputPort());
-    stencilToImage->SetInsideValue(q->m_FillValue);
-    stencilToImage->SetOutsideValue(q->m_EraseValue);
-    stencilToImage->SetOutputScalarType(modifierLabelmap->GetScalarType());
+    this->BrushStencilToImage->SetInsideValue(q->m_FillValue);
+    this->BrushStencilToImage->SetOutsideValue(q->m_EraseValue);
+    this->BrushStencilToImage->SetOutputScalarType(modifierLabelmap->GetScalarType());
 
-    vtkNew<vtkImageChangeInformation> brushPositioner;
-    brushPositioner->SetInputConnection(stencilToImage->GetOutputPort());
-    brushPositioner->SetOutputSpacing(modifierLabelmap->GetSpacing());
-    brushPositioner->SetOutputOrigin(modifierLabelmap->GetOrigin());
+    this->BrushPositioner->SetOutputSpacing(modifierLabelmap->GetSpacing());
+    this->BrushPositioner->SetOutputOrigin(modifierLabelmap->GetOrigin());
 
+    // Compute the voxel shift of each queued brush position and the overall
+    // extent of the stroke. All stamps of the batch are accumulated in a
+    // reusable stroke buffer covering this extent, so the modifier labelmap
+    // is merged and invalidated only once regardless of how many mouse
+    // events were queued up.
     vtkIdType numberOfPoints = this->PaintCoordinates_World->GetNumberOfPoints();
+    std::vector<int> pointShifts(3 * numberOfPoints);
     int updateExtent[6] = { 0, -1, 0, -1, 0, -1 };
     for (int pointIndex = 0; pointIndex < numberOfPoints; pointIndex++)
       {
       double* shiftDouble = paintCoordinates_Ijk->GetPoint(pointIndex);
-      int shift[3] = {int(shiftDouble[0]+0.5), int(shiftDouble[1]+0.5), int(shiftDouble[2]+0.5)};
-      brushPositioner->SetExtentTranslation(shift);
-      brushPositioner->Update();
-      vtkNew<vtkOrientedImageData> orientedBrushPositionerOutput;
-      orientedBrushPositionerOutput->ShallowCopy(brushPositioner->GetOutput());
-      orientedBrushPositionerOutput->CopyDirections(modifierLabelmap);
-      if (pointIndex == 0)
+      int* shift = &pointShifts[3 * pointIndex];
+      shift[0] = int(shiftDouble[0]+0.5);
+      shift[1] = int(shiftDouble[1]+0.5);
+      shift[2] = int(shiftDouble[2]+0.5);
+      for (int i = 0; i < 3; i++)
         {
-        orientedBrushPositionerOutput->GetExtent(updateExtent);
-        }
-      else
-        {
-        int* brushExtent = orientedBrushPositionerOutput->GetExtent();
-        for (int i = 0; i < 3; i++)
+        int stampExtentMin = stencilExtent[i * 2] + shift[i];
+        int stampExtentMax = stencilExtent[i * 2 + 1] + shift[i];
+        if (pointIndex == 0 || stampExtentMin < updateExtent[i * 2])
+          {
+          updateExtent[i * 2] = stampExtentMin;
+          }
+        if (pointIndex == 0 || stampExtentMax > updateExtent[i * 2 + 1])
           {
-          if (brushExtent[i * 2] < updateExtent[i * 2])
-            {
-            updateExtent[i * 2] = brushExtent[i * 2];
-            }
-          if (brushExtent[i * 2 + 1] > updateExtent[i * 2 + 1])
-            {
-            updateExtent[i * 2 + 1] = brushExtent[i * 2 + 1];
-            }
+          updateExtent[i * 2 + 1] = stampExtentMax;
           }
         }
-      vtkOrientedImageDataResample::ModifyImage(modifierLabelmap, orientedBrushPositionerOutput.GetPointer(), vtkOrientedImageDataResample::OPERATION_MAXIMUM);
       }
-    modifierLabelmap->Modified();
+
+    // The stroke buffer only needs to cover the part of the stroke that is
+    // inside the modifier labelmap (the merge would discard the rest anyway)
+    int strokeExtent[6] = { 0, -1, 0, -1, 0, -1 };
+    int* modifierExtent = modifierLabelmap->GetExtent();
+    for (int i = 0; i < 3; i++)
+      {
+      strokeExtent[i * 2] = updateExtent[i * 2] > modifierExtent[i * 2] ? updateExtent[i * 2] : modifierExtent[i * 2];
+      strokeExtent[i * 2 + 1] = updateExtent[i * 2 + 1] < modifierExtent[i * 2 + 1] ? updateExtent[i * 2 + 1] : modifierExtent[i * 2 + 1];
+      }
+    if (numberOfPoints > 0
+      && strokeExtent[0] <= strokeExtent[1] && strokeExtent[2] <= strokeExtent[3] && strokeExtent[4] <= strokeExtent[5])
+      {
+      this->StrokeLabelmap->SetExtent(strokeExtent);
+      this->StrokeLabelmap->SetSpacing(modifierLabelmap->GetSpacing());
+      this->StrokeLabelmap->SetOrigin(modifierLabelmap->GetOrigin());
+      this->StrokeLabelmap->CopyDirections(modifierLabelmap);
+      this->StrokeLabelmap->AllocateScalars(modifierLabelmap->GetScalarType(), 1);
+      vtkOrientedImageDataResample::FillImage(this->StrokeLabelmap, q->m_EraseValue);
+
+      for (int pointIndex = 0; pointIndex < numberOfPoints; pointIndex++)
+        {
+        this->BrushPositioner->SetExtentTranslation(&pointShifts[3 * pointIndex]);
+        this->BrushPositioner->Update();
+        this->BrushStampLabelmap->ShallowCopy(this->BrushPositioner->GetOutput());
+        this->BrushStampLabelmap->CopyDirections(modifierLabelmap);
+        vtkOrientedImageDataResample::ModifyImage(this->StrokeLabelmap, this->BrushStampLabelmap, vtkOrientedImageDataResample::OPERATION_MAXIMUM);
+        }
+
+      vtkOrientedImageDataResample::ModifyImage(modifierLabelmap, this->StrokeLabelmap, vtkOrientedImageDataResample::OPERATION_MAXIMUM);
+      modifierLabelmap->Modified();
+      }
     for (int i = 0; i < 6; i++)
       {
       updateExtentList << updateExtent[i];
       }
     }
   this->PaintCoordinates_World->Reset();
+  this->resetFeedback();
 
   // Notify editor about changes
   qSlicerSegmentEditorAbstractEffect::ModificationMode modificationMode;
@@ -61,7 +61,9 @@ class QToolButton;
 class qMRMLSliceWidget;
 class qMRMLSpinBox;
 class vtkActor2D;
-class vtkGlyph3D;
+class vtkImageChangeInformation;
+class vtkImageStencilToImage;
+class vtkOrientedImageData;
 class vtkPoints;
 class vtkPolyDataNormals;
 class vtkPolyDataToImageStencil;
@@ -106,6 +108,16 @@ protected:
   /// Paint labelmap
   void paintApply(qMRMLWidget* viewWidget);
 
+  /// Append the brush stamp at the given world position to the stroke
+  /// feedback geometry of every view. Only the newest stamp is
+  /// transformed (and, for the slice views, cut with the view plane), so
+  /// the cost of a mouse move does not grow with the length of the stroke.
+  void appendFeedbackStamp(qMRMLWidget* viewWidget, double brushPosition_World[3]);
+
+  /// Discard the accumulated stroke feedback geometry
+  /// (the stroke has been committed to the labelmap)
+  void resetFeedback();
+
   /// Paint one pixel to coordinate
   void paintPixel(qMRMLWidget* viewWidget, double brushPosition_World[3]);
   void paintPixels(qMRMLWidget* viewWidget, vtkPoints* pixelPositions);
@@ -139,11 +151,25 @@ public:
   vtkSmartPointer<vtkTransformPolyDataFilter> WorldOriginToModifierLabelmapIjkTransformer;
   vtkSmartPointer<vtkTransform> WorldOriginToModifierLabelmapIjkTransform; // transforms from polydata source to modifierLabelmap's IJK coordinate system (brush origin in IJK origin)
   vtkSmartPointer<vtkPolyDataToImageStencil> BrushPolyDataToStencil;
-
-  vtkSmartPointer<vtkGlyph3D> FeedbackGlyphFilter;
+  vtkSmartPointer<vtkImageStencilToImage> BrushStencilToImage;
+  vtkSmartPointer<vtkImageChangeInformation> BrushPositioner;
+
+  /// Reusable intermediate buffers for applying a batch of brush stamps
+  /// (\sa paintApply). Kept as members to avoid reallocating them on each
+  /// stroke.
+  vtkSmartPointer<vtkOrientedImageData> BrushStampLabelmap;
+  vtkSmartPointer<vtkOrientedImageData> StrokeLabelmap;
+
+  /// Accumulated brush stamps of the current stroke in world coordinates,
+  /// shown by the 3D views; grown in place by \sa appendFeedbackStamp.
+  /// The slice views accumulate the contours of the stamps in their own
+  /// plane separately (\sa BrushPipeline2D).
+  vtkSmartPointer<vtkPolyData> FeedbackPolyData_World;
+  vtkSmartPointer<vtkTransformPolyDataFilter> FeedbackStampTransformer;
+  vtkSmartPointer<vtkTransform> FeedbackStampTransform;
+  vtkSmartPointer<vtkCutter> FeedbackStampCutter;
 
   vtkSmartPointer<vtkPoints> PaintCoordinates_World;
-  vtkSmartPointer<vtkPolyData> FeedbackPointsPolyData;
 
   QList<vtkActor2D*> FeedbackActors;
   QMap<qMRMLWidget*, BrushPipeline*> BrushPipelines;
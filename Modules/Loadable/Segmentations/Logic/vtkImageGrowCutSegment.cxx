@@ -1,18 +1,21 @@
 #include "vtkImageGrowCutSegment.h"
 
+#include <deque>
 #include <iostream>
 #include <vector>
 
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
 #include <vtkLoggingMacros.h>
+#include <vtkMultiThreader.h>
+#include <vtkMutexLock.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
 #include <vtkSmartPointer.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkTimerLog.h>
 
-#include "FibHeap.h"
+#include <vtksys/SystemTools.hxx>
 
 vtkStandardNewMacro(vtkImageGrowCutSegment);
 
@@ -22,58 +25,242 @@ const int DistancePixelTypeID = VTK_FLOAT;
 const DistancePixelType DIST_INF = std::numeric_limits<DistancePixelType>::max();
 const DistancePixelType DIST_EPSILON = 1e-3;
 
+namespace
+{
+
+// Edge length of the cubic blocks the volume is decomposed into for
+// parallel label propagation. Large enough that the per-block bookkeeping
+// is negligible, small enough that work spreads over all cores even for
+// localized seed updates.
+const long GROWCUT_BLOCK_SIZE = 32;
+
 //----------------------------------------------------------------------------
-class HeapNode : public FibHeapNode
+// Shared state of the worker threads executing a grow-cut propagation.
+// Workers pull active blocks from a shared frontier queue and relax the
+// voxels of one block at a time, so the distance and label of each voxel
+// are only written by the thread that currently owns the enclosing block.
+template<typename IntensityPixelType, typename LabelPixelType>
+struct GrowCutJob
 {
-public:
-  HeapNode()
-  : FibHeapNode()
-  , m_Key(0)
-  , m_Index(-1)
-  {
-  }
+  const IntensityPixelType* IntensityVolumePtr;
+  LabelPixelType* ResultLabelVolumePtr;
+  DistancePixelType* DistanceVolumePtr;
+  long DimX;
+  long DimY;
+  long DimZ;
+  int NumberOfBlocksX;
+  int NumberOfBlocksY;
+  int NumberOfBlocksZ;
+  long NeighborIndexOffsets[26];
+  // Per-block flag indicating that the block is currently in ActiveBlocks
+  // (prevents duplicate queue entries). Protected by Lock.
+  std::vector<unsigned char> BlockQueued;
+  // Frontier queue of blocks that have to be (re)relaxed. Protected by Lock.
+  std::deque<int> ActiveBlocks;
+  // Number of workers currently relaxing a block (they may still activate
+  // more blocks, so an empty queue alone does not mean that the
+  // propagation is complete). Protected by Lock.
+  int BusyWorkerCount;
+  vtkSmartPointer<vtkMutexLock> Lock;
+};
 
-  virtual void operator =(FibHeapNode& RHS)
-  {
-    FHN_Assign(RHS);
-    m_Key = ((HeapNode&)RHS).m_Key;
-  }
+//----------------------------------------------------------------------------
+// Queue every block that overlaps the specified voxel extent.
+// The extent may reach outside the volume, it is clamped here.
+// The caller must hold job->Lock (or be single-threaded).
+template<typename IntensityPixelType, typename LabelPixelType>
+void ActivateBlocksInExtent(GrowCutJob<IntensityPixelType, LabelPixelType>* job, const long extent[6], int skipBlockId)
+{
+  int blockRange[6] = { 0, -1, 0, -1, 0, -1 };
+  long dims[3] = { job->DimX, job->DimY, job->DimZ };
+  for (int axis = 0; axis < 3; axis++)
+    {
+    long rangeMin = extent[axis * 2] >= 0 ? extent[axis * 2] : 0;
+    long rangeMax = extent[axis * 2 + 1] <= dims[axis] - 1 ? extent[axis * 2 + 1] : dims[axis] - 1;
+    if (rangeMin > rangeMax)
+      {
+      return;
+      }
+    blockRange[axis * 2] = static_cast<int>(rangeMin / GROWCUT_BLOCK_SIZE);
+    blockRange[axis * 2 + 1] = static_cast<int>(rangeMax / GROWCUT_BLOCK_SIZE);
+    }
+  for (int bz = blockRange[4]; bz <= blockRange[5]; bz++)
+    {
+    for (int by = blockRange[2]; by <= blockRange[3]; by++)
+      {
+      for (int bx = blockRange[0]; bx <= blockRange[1]; bx++)
+        {
+        int blockId = (bz * job->NumberOfBlocksY + by) * job->NumberOfBlocksX + bx;
+        if (blockId == skipBlockId || job->BlockQueued[blockId])
+          {
+          continue;
+          }
+        job->BlockQueued[blockId] = 1;
+        job->ActiveBlocks.push_back(blockId);
+        }
+      }
+    }
+}
 
-  virtual int operator ==(FibHeapNode& RHS)
-  {
-    if (FHN_Cmp(RHS))
+//----------------------------------------------------------------------------
+// Relax all voxels of one block until the block reaches a local fixed
+// point, then activate the neighbor blocks that are affected by the
+// changed voxels. Only interior voxels are updated (the one-voxel padding
+// border stays untouched, as with the previous heap-based implementation),
+// therefore all 26 neighbors of a relaxed voxel are valid.
+// Voxels of neighbor blocks are only read; such reads may observe a stale
+// distance, which merely delays convergence because distances decrease
+// monotonically and the owner block is re-activated for every change.
+template<typename IntensityPixelType, typename LabelPixelType>
+void RelaxBlock(GrowCutJob<IntensityPixelType, LabelPixelType>* job, int blockId)
+{
+  int bx = blockId % job->NumberOfBlocksX;
+  int by = (blockId / job->NumberOfBlocksX) % job->NumberOfBlocksY;
+  int bz = blockId / (job->NumberOfBlocksX * job->NumberOfBlocksY);
+  long firstX = bx * GROWCUT_BLOCK_SIZE > 1 ? bx * GROWCUT_BLOCK_SIZE : 1;
+  long firstY = by * GROWCUT_BLOCK_SIZE > 1 ? by * GROWCUT_BLOCK_SIZE : 1;
+  long firstZ = bz * GROWCUT_BLOCK_SIZE > 1 ? bz * GROWCUT_BLOCK_SIZE : 1;
+  long lastX = (bx + 1) * GROWCUT_BLOCK_SIZE - 1 < job->DimX - 2 ? (bx + 1) * GROWCUT_BLOCK_SIZE - 1 : job->DimX - 2;
+  long lastY = (by + 1) * GROWCUT_BLOCK_SIZE - 1 < job->DimY - 2 ? (by + 1) * GROWCUT_BLOCK_SIZE - 1 : job->DimY - 2;
+  long lastZ = (bz + 1) * GROWCUT_BLOCK_SIZE - 1 < job->DimZ - 2 ? (bz + 1) * GROWCUT_BLOCK_SIZE - 1 : job->DimZ - 2;
+  if (firstX > lastX || firstY > lastY || firstZ > lastZ)
+    {
+    // the block contains only border voxels
+    return;
+    }
+
+  const IntensityPixelType* intensityPtr = job->IntensityVolumePtr;
+  LabelPixelType* labelPtr = job->ResultLabelVolumePtr;
+  DistancePixelType* distancePtr = job->DistanceVolumePtr;
+
+  long changedExtent[6] = { 0, -1, 0, -1, 0, -1 };
+  bool changedInSweep = true;
+  bool forward = true;
+  while (changedInSweep)
+    {
+    changedInSweep = false;
+    // Alternate sweep direction so that distance values can travel across
+    // the whole block in few sweeps regardless of the propagation direction
+    long zBegin = forward ? firstZ : lastZ;
+    long zEnd = forward ? lastZ + 1 : firstZ - 1;
+    long step = forward ? 1 : -1;
+    for (long z = zBegin; z != zEnd; z += step)
       {
-      return 0;
+      long yBegin = forward ? firstY : lastY;
+      long yEnd = forward ? lastY + 1 : firstY - 1;
+      for (long y = yBegin; y != yEnd; y += step)
+        {
+        long rowOffset = (z * job->DimY + y) * job->DimX;
+        long xBegin = forward ? firstX : lastX;
+        long xEnd = forward ? lastX + 1 : firstX - 1;
+        for (long x = xBegin; x != xEnd; x += step)
+          {
+          long index = rowOffset + x;
+          DistancePixelType bestDistance = distancePtr[index];
+          DistancePixelType pixCenter = intensityPtr[index];
+          long bestNeighborIndex = -1;
+          for (int i = 0; i < 26; i++)
+            {
+            long indexNgbh = index + job->NeighborIndexOffsets[i];
+            DistancePixelType neighborDistance = distancePtr[indexNgbh];
+            if (neighborDistance >= bestDistance)
+              {
+              // cannot improve even through a zero-cost edge (skips unreached DIST_INF neighbors, too)
+              continue;
+              }
+            DistancePixelType candidateDistance = fabs(pixCenter - intensityPtr[indexNgbh]) + neighborDistance;
+            if (candidateDistance < bestDistance)
+              {
+              bestDistance = candidateDistance;
+              bestNeighborIndex = indexNgbh;
+              }
+            }
+          if (bestNeighborIndex >= 0)
+            {
+            // Label is written before distance so that a concurrent reader
+            // that already sees the decreased distance picks up the
+            // matching label.
+            labelPtr[index] = labelPtr[bestNeighborIndex];
+            distancePtr[index] = bestDistance;
+            changedInSweep = true;
+            if (changedExtent[0] > changedExtent[1])
+              {
+              changedExtent[0] = changedExtent[1] = x;
+              changedExtent[2] = changedExtent[3] = y;
+              changedExtent[4] = changedExtent[5] = z;
+              }
+            else
+              {
+              if (x < changedExtent[0]) { changedExtent[0] = x; }
+              if (x > changedExtent[1]) { changedExtent[1] = x; }
+              if (y < changedExtent[2]) { changedExtent[2] = y; }
+              if (y > changedExtent[3]) { changedExtent[3] = y; }
+              if (z < changedExtent[4]) { changedExtent[4] = z; }
+              if (z > changedExtent[5]) { changedExtent[5] = z; }
+              }
+            }
+          }
+        }
       }
-    return m_Key == ((HeapNode&)RHS).m_Key ? 1 : 0;
-  }
+    forward = !forward;
+    }
 
-  virtual int operator <(FibHeapNode& RHS)
-  {
-    int x = FHN_Cmp(RHS);
-    if (x != 0)
+  if (changedExtent[0] > changedExtent[1])
+    {
+    return;
+    }
+
+  // Changed voxels may allow improving their neighbors in adjacent blocks
+  for (int axis = 0; axis < 3; axis++)
+    {
+    changedExtent[axis * 2] -= 1;
+    changedExtent[axis * 2 + 1] += 1;
+    }
+  job->Lock->Lock();
+  ActivateBlocksInExtent(job, changedExtent, blockId);
+  job->Lock->Unlock();
+}
+
+//----------------------------------------------------------------------------
+// Entry point of the worker threads. Workers keep pulling blocks from the
+// shared frontier queue; the propagation is complete when the queue is
+// empty and no worker is busy (a busy worker may still activate blocks).
+template<typename IntensityPixelType, typename LabelPixelType>
+VTK_THREAD_RETURN_TYPE GrowCutWorkerCallback(void* arg)
+{
+  vtkMultiThreader::ThreadInfo* info = static_cast<vtkMultiThreader::ThreadInfo*>(arg);
+  GrowCutJob<IntensityPixelType, LabelPixelType>* job =
+    static_cast<GrowCutJob<IntensityPixelType, LabelPixelType>*>(info->UserData);
+  while (true)
+    {
+    job->Lock->Lock();
+    if (job->ActiveBlocks.empty())
       {
-      return x < 0 ? 1 : 0;
+      bool completed = (job->BusyWorkerCount == 0);
+      job->Lock->Unlock();
+      if (completed)
+        {
+        break;
+        }
+      vtksys::SystemTools::Delay(1);
+      continue;
       }
-    return m_Key < ((HeapNode&)RHS).m_Key ? 1 : 0;
-  }
+    int blockId = job->ActiveBlocks.front();
+    job->ActiveBlocks.pop_front();
+    job->BlockQueued[blockId] = 0;
+    job->BusyWorkerCount++;
+    job->Lock->Unlock();
 
-  virtual void operator =(DistancePixelType newKeyVal)
-  {
-    HeapNode tmp;
-    tmp.m_Key = m_Key = newKeyVal;
-    FHN_Assign(tmp);
-  }
+    RelaxBlock(job, blockId);
 
-  inline DistancePixelType GetKeyValue() { return m_Key; }
-  inline void SetKeyValue(DistancePixelType keyValue) { m_Key = keyValue; }
-  inline long int GetIndexValue() { return m_Index; }
-  inline void SetIndexValue(long int indexValue) { m_Index = indexValue; }
+    job->Lock->Lock();
+    job->BusyWorkerCount--;
+    job->Lock->Unlock();
+    }
+  return VTK_THREAD_RETURN_VALUE;
+}
 
-protected:
-  DistancePixelType m_Key;
-  long m_Index;
-};
+} // end of anonymous namespace
 
 //----------------------------------------------------------------------------
 class vtkImageGrowCutSegment::vtkInternal
@@ -84,12 +271,6 @@ public:
 
   void Reset();
 
-  template<typename IntensityPixelType, typename LabelPixelType>
-  bool InitializationAHP(vtkImageData *intensityVolume, vtkImageData *seedLabelVolume);
-
-  template<typename IntensityPixelType, typename LabelPixelType>
-  void DijkstraBasedClassificationAHP(vtkImageData *intensityVolume, vtkImageData *seedLabelVolume);
-
   template <class SourceVolType>
   bool ExecuteGrowCut(vtkImageData *intensityVolume, vtkImageData *seedLabelVolume, vtkImageData *resultLabelVolume);
 
@@ -97,31 +278,23 @@ public:
   bool ExecuteGrowCut2(vtkImageData *intensityVolume, vtkImageData *seedLabelVolume);
 
   vtkSmartPointer<vtkImageData> m_DistanceVolume;
-  vtkSmartPointer<vtkImageData> m_DistanceVolumePre;
   vtkSmartPointer<vtkImageData> m_ResultLabelVolume;
-  vtkSmartPointer<vtkImageData> m_ResultLabelVolumePre;
 
   long m_DimX;
   long m_DimY;
   long m_DimZ;
-  std::vector<long> m_NeighborIndexOffsets;
-  std::vector<unsigned char> m_NumberOfNeighbors;
-
-  FibHeap *m_Heap;
-  HeapNode *m_HeapNodes;
   bool m_bSegInitialized;
 };
 
 //-----------------------------------------------------------------------------
 vtkImageGrowCutSegment::vtkInternal::vtkInternal()
 {
-  m_Heap = NULL;
-  m_HeapNodes = NULL;
   m_bSegInitialized = false;
+  m_DimX = 0;
+  m_DimY = 0;
+  m_DimZ = 0;
   m_DistanceVolume = vtkSmartPointer<vtkImageData>::New();
-  m_DistanceVolumePre = vtkSmartPointer<vtkImageData>::New();
   m_ResultLabelVolume = vtkSmartPointer<vtkImageData>::New();
-  m_ResultLabelVolumePre = vtkSmartPointer<vtkImageData>::New();
 };
 
 //-----------------------------------------------------------------------------
@@ -133,37 +306,26 @@ vtkImageGrowCutSegment::vtkInternal::~vtkInternal()
 //-----------------------------------------------------------------------------
 void vtkImageGrowCutSegment::vtkInternal::Reset()
 {
-  if (m_Heap != NULL)
-    {
-    delete m_Heap;
-    m_Heap = NULL;
-    }
-  if (m_HeapNodes != NULL)
-    {
-    delete[]m_HeapNodes;
-    m_HeapNodes = NULL;
-    }
   m_bSegInitialized = false;
   m_DistanceVolume->Initialize();
-  m_DistanceVolumePre->Initialize();
   m_ResultLabelVolume->Initialize();
-  m_ResultLabelVolumePre->Initialize();
 }
 
 //-----------------------------------------------------------------------------
-template<typename IntensityPixelType, typename LabelPixelType>
-bool vtkImageGrowCutSegment::vtkInternal::InitializationAHP(
-    vtkImageData *vtkNotUsed(intensityVolume),
-    vtkImageData *seedLabelVolume)
+template< class IntensityPixelType, class LabelPixelType>
+bool vtkImageGrowCutSegment::vtkInternal::ExecuteGrowCut2(vtkImageData *intensityVolume, vtkImageData *seedLabelVolume)
 {
-  m_Heap = new FibHeap;
-  long dimXYZ = m_DimX * m_DimY * m_DimZ;
-  if ((m_HeapNodes = new HeapNode[dimXYZ + 1]) == NULL)
+  int* imSize = intensityVolume->GetDimensions();
+  m_DimX = imSize[0];
+  m_DimY = imSize[1];
+  m_DimZ = imSize[2];
+
+  if (m_DimX <= 2 || m_DimY <= 2 || m_DimZ <= 2)
     {
-    vtkGenericWarningMacro("Memory allocation failed. Dimensions: " << m_DimX << "x" << m_DimY << "x" << m_DimZ);
+    // image is too small (there should be space for at least one voxel padding around the image)
+    vtkGenericWarningMacro("vtkImageGrowCutSegment: image size is too small");
     return false;
     }
-  LabelPixelType* seedLabelVolumePtr = static_cast<LabelPixelType*>(seedLabelVolume->GetScalarPointer());
 
   if (!m_bSegInitialized)
     {
@@ -175,264 +337,94 @@ bool vtkImageGrowCutSegment::vtkInternal::InitializationAHP(
     m_DistanceVolume->SetSpacing(seedLabelVolume->GetSpacing());
     m_DistanceVolume->SetExtent(seedLabelVolume->GetExtent());
     m_DistanceVolume->AllocateScalars(DistancePixelTypeID, 1);
-    m_ResultLabelVolumePre->SetExtent(0, -1, 0, -1, 0, -1);
-    m_ResultLabelVolumePre->AllocateScalars(seedLabelVolume->GetScalarType(), 1);
-    m_DistanceVolumePre->SetExtent(0, -1, 0, -1, 0, -1);
-    m_DistanceVolumePre->AllocateScalars(DistancePixelTypeID, 1);
-    LabelPixelType* resultLabelVolumePtr = static_cast<LabelPixelType*>(m_ResultLabelVolume->GetScalarPointer());
-    DistancePixelType* distanceVolumePtr = static_cast<DistancePixelType*>(m_DistanceVolume->GetScalarPointer());
-
-    // Compute index offset
-    m_NeighborIndexOffsets.clear();
-    // Neighbors are traversed in the order of m_NeighborIndexOffsets,
-    // therefore one would expect that the offsets should
-    // be as continuous as possible (e.g., x coordinate
-    // should change most quickly), but that resulted in
-    // about 5-6% longer computation time. Therefore,
-    // we put indices in order x1y1z1, x1y1z2, x1y1z3, etc.
-    for (int ix = -1; ix <= 1; ix++)
-      {
-      for (int iy = -1; iy <= 1; iy++)
-        {
-        for (int iz = -1; iz <= 1; iz++)
-          {
-          if (ix == 0 && iy == 0 && iz == 0)
-            {
-            continue;
-            }
-          m_NeighborIndexOffsets.push_back(long(ix) + m_DimX*(long(iy) + m_DimY*long(iz)));
-          }
-        }
-      }
-
-    // Determine neighborhood size for computation at each voxel.
-    // The neighborhood size is everwhere the same (size of m_NeighborIndexOffsets)
-    // except at the edges of the volume, where the neighborhood size is 0.
-    m_NumberOfNeighbors.resize(dimXYZ);
-    const unsigned char numberOfNeighbors = m_NeighborIndexOffsets.size();
-    unsigned char* nbSizePtr = &(m_NumberOfNeighbors[0]);
-    for (int z = 0; z < m_DimZ; z++)
-      {
-      bool zEdge = (z == 0 || z == m_DimZ - 1);
-      for (int y = 0; y < m_DimY; y++)
-        {
-        bool yEdge = (y == 0 || y == m_DimY - 1);
-        *(nbSizePtr++) = 0; // x == 0 (there is always padding, so we don'neighborNewDistance need to check if m_DimX>0)
-        unsigned char nbSize = (zEdge || yEdge) ? 0 : numberOfNeighbors;
-        for (int x = m_DimX-2; x > 0; x--)
-          {
-          *(nbSizePtr++) = nbSize;
-          }
-        *(nbSizePtr++) = 0; // x == m_DimX-1 (there is always padding, so we don'neighborNewDistance need to check if m_DimX>1)
-        }
-      }
-
-    for (long index = 0; index < dimXYZ; index++)
-      {
-      LabelPixelType seedValue = seedLabelVolumePtr[index];
-      resultLabelVolumePtr[index] = seedValue;
-      if (seedValue == 0)
-        {
-        m_HeapNodes[index] = DIST_INF;
-        distanceVolumePtr[index] = DIST_INF;
-        }
-      else
-        {
-        m_HeapNodes[index] = DIST_EPSILON;
-        distanceVolumePtr[index] = DIST_EPSILON;
-        }
-      m_Heap->Insert(&m_HeapNodes[index]);
-      m_HeapNodes[index].SetIndexValue(index);
-      }
     }
-  else
-    {
-    // Already initialized
-    LabelPixelType* resultLabelVolumePtr = static_cast<LabelPixelType*>(m_ResultLabelVolume->GetScalarPointer());
-    DistancePixelType* distanceVolumePtr = static_cast<DistancePixelType*>(m_DistanceVolume->GetScalarPointer());
 
-    for (long index = 0; index < dimXYZ; index++)
+  GrowCutJob<IntensityPixelType, LabelPixelType> job;
+  job.IntensityVolumePtr = static_cast<IntensityPixelType*>(intensityVolume->GetScalarPointer());
+  job.ResultLabelVolumePtr = static_cast<LabelPixelType*>(m_ResultLabelVolume->GetScalarPointer());
+  job.DistanceVolumePtr = static_cast<DistancePixelType*>(m_DistanceVolume->GetScalarPointer());
+  job.DimX = m_DimX;
+  job.DimY = m_DimY;
+  job.DimZ = m_DimZ;
+  job.NumberOfBlocksX = static_cast<int>((m_DimX + GROWCUT_BLOCK_SIZE - 1) / GROWCUT_BLOCK_SIZE);
+  job.NumberOfBlocksY = static_cast<int>((m_DimY + GROWCUT_BLOCK_SIZE - 1) / GROWCUT_BLOCK_SIZE);
+  job.NumberOfBlocksZ = static_cast<int>((m_DimZ + GROWCUT_BLOCK_SIZE - 1) / GROWCUT_BLOCK_SIZE);
+  job.BlockQueued.assign(job.NumberOfBlocksX * job.NumberOfBlocksY * job.NumberOfBlocksZ, 0);
+  job.BusyWorkerCount = 0;
+  job.Lock = vtkSmartPointer<vtkMutexLock>::New();
+
+  // Compute index offset.
+  // Neighbors are traversed in the order of NeighborIndexOffsets,
+  // therefore one would expect that the offsets should
+  // be as continuous as possible (e.g., x coordinate
+  // should change most quickly), but that resulted in
+  // about 5-6% longer computation time. Therefore,
+  // we put indices in order x1y1z1, x1y1z2, x1y1z3, etc.
+  int neighborIndex = 0;
+  for (int ix = -1; ix <= 1; ix++)
+    {
+    for (int iy = -1; iy <= 1; iy++)
       {
-      if (seedLabelVolumePtr[index] != 0)
+      for (int iz = -1; iz <= 1; iz++)
         {
-        // Only grow from new/changed seeds
-        if (resultLabelVolumePtr[index] != seedLabelVolumePtr[index])
+        if (ix == 0 && iy == 0 && iz == 0)
           {
-          m_HeapNodes[index] = DIST_EPSILON;
-          distanceVolumePtr[index] = DIST_EPSILON;
-          resultLabelVolumePtr[index] = seedLabelVolumePtr[index];
-          m_Heap->Insert(&m_HeapNodes[index]);
-          m_HeapNodes[index].SetIndexValue(index);
+          continue;
           }
-        }
-      else
-        {
-        m_HeapNodes[index] = DIST_INF;
-        distanceVolumePtr[index] = DIST_INF;
-        resultLabelVolumePtr[index] = 0;
-        m_Heap->Insert(&m_HeapNodes[index]);
-        m_HeapNodes[index].SetIndexValue(index);
+        job.NeighborIndexOffsets[neighborIndex++] = long(ix) + m_DimX * (long(iy) + m_DimY * long(iz));
         }
       }
     }
-  return true;
-}
-
-//-----------------------------------------------------------------------------
-template<typename IntensityPixelType, typename LabelPixelType>
-void vtkImageGrowCutSegment::vtkInternal::DijkstraBasedClassificationAHP(
-    vtkImageData *intensityVolume,
-    vtkImageData *vtkNotUsed(seedLabelVolume))
-{
-  LabelPixelType* resultLabelVolumePtr = static_cast<LabelPixelType*>(m_ResultLabelVolume->GetScalarPointer());
-  IntensityPixelType* imSrc = static_cast<IntensityPixelType*>(intensityVolume->GetScalarPointer());
 
-  // Insert 0 then extract it, which will balance heap
-  HeapNode hnZero;
-  m_Heap->Insert(&hnZero);
-  m_Heap->ExtractMin();
-
-  if (!m_bSegInitialized)
+  // Initialize distance and label fields from the seeds and queue the
+  // blocks around the seeds as the initial frontier.
+  // In incremental mode (seeds only extended since the previous
+  // computation) the previous distance field is kept and only the blocks
+  // around new/changed seeds are queued, so a localized seed update only
+  // propagates where the new seed is closer than all previous seeds.
+  LabelPixelType* seedLabelVolumePtr = static_cast<LabelPixelType*>(seedLabelVolume->GetScalarPointer());
+  long index = 0;
+  for (long z = 0; z < m_DimZ; z++)
     {
-    // Full computation
-    DistancePixelType* distanceVolumePtr = static_cast<DistancePixelType*>(m_DistanceVolume->GetScalarPointer());
-    LabelPixelType* resultLabelVolumePtr = static_cast<LabelPixelType*>(m_ResultLabelVolume->GetScalarPointer());
-
-    // Normal Dijkstra (to be used in initializing the segmenter for the current image)
-    HeapNode hnTmp;
-    while (!m_Heap->IsEmpty())
+    for (long y = 0; y < m_DimY; y++)
       {
-      HeapNode* hnMin = (HeapNode *)m_Heap->ExtractMin();
-      long index = hnMin->GetIndexValue();
-      DistancePixelType currentDistance = hnMin->GetKeyValue();
-      LabelPixelType currentLabel = resultLabelVolumePtr[index];
-      distanceVolumePtr[index] = currentDistance;
-
-      // Update neighbors
-      DistancePixelType pixCenter = imSrc[index];
-      unsigned char nbSize = m_NumberOfNeighbors[index];
-      for (unsigned char i = 0; i < nbSize; i++)
+      for (long x = 0; x < m_DimX; x++, index++)
         {
-        long indexNgbh = index + m_NeighborIndexOffsets[i];
-        DistancePixelType neighborCurrentDistance = distanceVolumePtr[indexNgbh];
-        DistancePixelType neighborNewDistance = fabs(pixCenter - imSrc[indexNgbh]) + currentDistance;
-        if (neighborCurrentDistance > neighborNewDistance)
+        LabelPixelType seedValue = seedLabelVolumePtr[index];
+        if (!m_bSegInitialized)
           {
-          distanceVolumePtr[indexNgbh] = neighborNewDistance;
-          resultLabelVolumePtr[indexNgbh] = currentLabel;
-
-          hnTmp = m_HeapNodes[indexNgbh];
-          hnTmp.SetKeyValue(neighborNewDistance);
-          m_Heap->DecreaseKey(&m_HeapNodes[indexNgbh], hnTmp);
+          job.ResultLabelVolumePtr[index] = seedValue;
+          job.DistanceVolumePtr[index] = (seedValue == 0 ? DIST_INF : DIST_EPSILON);
           }
-        }
-      }
-    }
-  else
-    {
-    // Quick update
-
-    LabelPixelType* resultLabelVolumePrePtr = static_cast<LabelPixelType*>(m_ResultLabelVolumePre->GetScalarPointer());
-
-    // Adaptive Dijkstra
-    HeapNode hnTmp;
-    long dimXYZ = m_DimX * m_DimY * m_DimZ;
-    while (!m_Heap->IsEmpty())
-      {
-      DistancePixelType* distanceVolumePrePtr = static_cast<DistancePixelType*>(m_DistanceVolumePre->GetScalarPointer());
-      DistancePixelType* distanceVolumePtr = static_cast<DistancePixelType*>(m_DistanceVolume->GetScalarPointer());
-
-      HeapNode* hnMin = (HeapNode *)m_Heap->ExtractMin();
-      DistancePixelType currentDistance = hnMin->GetKeyValue();
-
-      // Stop of minimum value is infinite
-      if (currentDistance == DIST_INF)
-        {
-        for (long index = 0; index < dimXYZ; index++)
+        else
           {
-          if (resultLabelVolumePtr[index] == 0)
+          // Only grow from new/changed seeds
+          if (seedValue == 0 || job.ResultLabelVolumePtr[index] == seedValue)
             {
-            resultLabelVolumePtr[index] = resultLabelVolumePrePtr[index];
-            distanceVolumePtr[index] = distanceVolumePrePtr[index];
+            continue;
             }
+          job.ResultLabelVolumePtr[index] = seedValue;
+          job.DistanceVolumePtr[index] = DIST_EPSILON;
           }
-        break;
-        }
-
-      // Stop propagation when the new distance is larger than the previous one
-      long index = hnMin->GetIndexValue();
-      if (currentDistance > distanceVolumePrePtr[index])
-        {
-        distanceVolumePtr[index] = distanceVolumePrePtr[index];
-        resultLabelVolumePtr[index] = resultLabelVolumePrePtr[index];
-        continue;
-        }
-
-      LabelPixelType currentLabel = resultLabelVolumePtr[index];
-      distanceVolumePtr[index] = currentDistance;
-
-      // Update neighbors
-      DistancePixelType pixCenter = imSrc[index];
-      unsigned char nbSize = m_NumberOfNeighbors[index];
-      for (unsigned char i = 0; i < nbSize; i++)
-        {
-        long indexNgbh = index + m_NeighborIndexOffsets[i];
-        DistancePixelType neighborCurrentDistance = distanceVolumePtr[indexNgbh];
-        DistancePixelType neighborNewDistance = fabs(pixCenter - imSrc[indexNgbh]) + currentDistance;
-        if (neighborCurrentDistance > neighborNewDistance)
+        if (seedValue != 0)
           {
-          distanceVolumePtr[indexNgbh] = neighborNewDistance;
-          resultLabelVolumePtr[indexNgbh] = currentLabel;
-
-          hnTmp = m_HeapNodes[indexNgbh];
-          hnTmp.SetKeyValue(neighborNewDistance);
-          m_Heap->DecreaseKey(&m_HeapNodes[indexNgbh], hnTmp);
+          long seedExtent[6] = { x - 1, x + 1, y - 1, y + 1, z - 1, z + 1 };
+          ActivateBlocksInExtent(&job, seedExtent, -1);
           }
         }
       }
     }
 
-  // Update previous labels and distance information
-  m_ResultLabelVolumePre->DeepCopy(m_ResultLabelVolume);
-  m_DistanceVolumePre->DeepCopy(m_DistanceVolume);
-  m_bSegInitialized = true;
-
-  // Release memory
-  if (m_Heap != NULL)
-    {
-    delete m_Heap;
-    m_Heap = NULL;
-    }
-  //m_HeapNodes.clear();
-  if (m_HeapNodes != NULL)
-    {
-    delete[] m_HeapNodes;
-    m_HeapNodes = NULL;
-    }
-}
-
-//-----------------------------------------------------------------------------
-template< class IntensityPixelType, class LabelPixelType>
-bool vtkImageGrowCutSegment::vtkInternal::ExecuteGrowCut2(vtkImageData *intensityVolume, vtkImageData *seedLabelVolume)
-{
-  int* imSize = intensityVolume->GetDimensions();
-  m_DimX = imSize[0];
-  m_DimY = imSize[1];
-  m_DimZ = imSize[2];
-
-  if (m_DimX <= 2 || m_DimY <= 2 || m_DimZ <= 2)
-    {
-    // image is too small (there should be space for at least one voxel padding around the image)
-    vtkGenericWarningMacro("vtkImageGrowCutSegment: image size is too small");
-    return false;
-    }
-
-  if (!InitializationAHP<IntensityPixelType, LabelPixelType>(intensityVolume, seedLabelVolume))
+  if (!job.ActiveBlocks.empty())
     {
-    return false;
+    int numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
+    vtkNew<vtkMultiThreader> threader;
+    threader->SetNumberOfThreads(numberOfThreads);
+    threader->SetSingleMethod(GrowCutWorkerCallback<IntensityPixelType, LabelPixelType>, &job);
+    threader->SingleMethodExecute();
     }
 
-  DijkstraBasedClassificationAHP<IntensityPixelType, LabelPixelType>(intensityVolume, seedLabelVolume);
+  m_bSegInitialized = true;
   return true;
 }
 
@@ -22,10 +22,14 @@
 #include "vtkSlicerSegmentationsModuleLogic.h"
 
 // SegmentationCore includes
+#include "vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule.h"
 #include "vtkBinaryLabelmapToClosedSurfaceConversionRule.h"
+#include "vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule.h"
+#include "vtkChunkedBinaryLabelmapToBinaryLabelmapConversionRule.h"
 #include "vtkClosedSurfaceToBinaryLabelmapConversionRule.h"
 #include "vtkClosedSurfaceToFractionalLabelmapConversionRule.h"
 #include "vtkFractionalLabelmapToClosedSurfaceConversionRule.h"
+#include "vtkRunLengthBinaryLabelmapToBinaryLabelmapConversionRule.h"
 #include "vtkOrientedImageData.h"
 #include "vtkOrientedImageDataResample.h"
 #include "vtkSegmentationConverterFactory.h"
@@ -152,6 +156,14 @@ void vtkSlicerSegmentationsModuleLogic::RegisterNodes()
     vtkSmartPointer<vtkClosedSurfaceToFractionalLabelmapConversionRule>::New() );
   vtkSegmentationConverterFactory::GetInstance()->RegisterConverterRule(
     vtkSmartPointer<vtkFractionalLabelmapToClosedSurfaceConversionRule>::New() );
+  vtkSegmentationConverterFactory::GetInstance()->RegisterConverterRule(
+    vtkSmartPointer<vtkBinaryLabelmapToChunkedBinaryLabelmapConversionRule>::New() );
+  vtkSegmentationConverterFactory::GetInstance()->RegisterConverterRule(
+    vtkSmartPointer<vtkChunkedBinaryLabelmapToBinaryLabelmapConversionRule>::New() );
+  vtkSegmentationConverterFactory::GetInstance()->RegisterConverterRule(
+    vtkSmartPointer<vtkBinaryLabelmapToRunLengthBinaryLabelmapConversionRule>::New() );
+  vtkSegmentationConverterFactory::GetInstance()->RegisterConverterRule(
+    vtkSmartPointer<vtkRunLengthBinaryLabelmapToBinaryLabelmapConversionRule>::New() );
 }
 
 //---------------------------------------------------------------------------
@@ -1276,9 +1288,20 @@ bool vtkSlicerSegmentationsModuleLogic::ImportLabelmapToSegmentationNode(vtkMRML
     threshold->ThresholdBetween(label, label);
     threshold->Update();
 
-    // Create oriented image data for label
+    // Create oriented image data for label.
+    // Shallow copy is enough if the voxels are not modified in place below:
+    // the effective extent clipping deep-copies the result before the
+    // threshold filter overwrites its output for the next label.
+    bool applyParentTransforms = (labelmapNode->GetParentTransformNode() || segmentationNode->GetParentTransformNode());
     vtkSmartPointer<vtkOrientedImageData> labelOrientedImageData = vtkSmartPointer<vtkOrientedImageData>::New();
-    labelOrientedImageData->vtkImageData::DeepCopy(threshold->GetOutput());
+    if (applyParentTransforms)
+      {
+      labelOrientedImageData->vtkImageData::DeepCopy(threshold->GetOutput());
+      }
+    else
+      {
+      labelOrientedImageData->vtkImageData::ShallowCopy(threshold->GetOutput());
+      }
     labelOrientedImageData->SetGeometryFromImageToWorldMatrix(labelmapIjkToRasMatrix);
 
     vtkSmartPointer<vtkSegment> segment = vtkSmartPointer<vtkSegment>::New();
@@ -1311,7 +1334,7 @@ bool vtkSlicerSegmentationsModuleLogic::ImportLabelmapToSegmentationNode(vtkMRML
     segment->SetName(labelName);
 
     // Apply parent transforms if any
-    if (labelmapNode->GetParentTransformNode() || segmentationNode->GetParentTransformNode())
+    if (applyParentTransforms)
       {
       vtkSmartPointer<vtkGeneralTransform> labelmapToSegmentationTransform = vtkSmartPointer<vtkGeneralTransform>::New();
       vtkSlicerSegmentationsModuleLogic::GetTransformBetweenRepresentationAndSegmentation(labelmapNode, segmentationNode, labelmapToSegmentationTransform);
@@ -314,7 +314,7 @@ public:
   void UpdateDisplayNode(vtkMRMLSegmentationDisplayNode* displayNode);
   void UpdateAllDisplayNodesForSegment(vtkMRMLSegmentationNode* segmentationNode);
   void UpdateSegmentPipelines(vtkMRMLSegmentationDisplayNode*, PipelineMapType&);
-  void UpdateDisplayNodePipeline(vtkMRMLSegmentationDisplayNode*, PipelineMapType);
+  void UpdateDisplayNodePipeline(vtkMRMLSegmentationDisplayNode*, const PipelineMapType&);
   void RemoveDisplayNode(vtkMRMLSegmentationDisplayNode* displayNode);
 
   // Observations
@@ -327,7 +327,8 @@ public:
   bool UseDisplayNode(vtkMRMLSegmentationDisplayNode* displayNode);
   bool UseDisplayableNode(vtkMRMLSegmentationNode* node);
   void ClearDisplayableNodes();
-  bool IsSegmentVisibleInCurrentSlice(vtkMRMLSegmentationDisplayNode* displayNode, Pipeline* pipeline, const std::string &segmentID);
+  bool IsSegmentVisibleInCurrentSlice(vtkMRMLSegmentationDisplayNode* displayNode, Pipeline* pipeline, const std::string &segmentID,
+    vtkMatrix4x4* rasToSliceXY);
 
 private:
   vtkSmartPointer<vtkMatrix4x4> SliceXYToRAS;
@@ -398,8 +399,26 @@ void vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::SetSliceNode(vtkMRML
 //---------------------------------------------------------------------------
 void vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::UpdateSliceNode()
 {
-  // Update the Slice node transform then update the DisplayNode pipelines to account for plane location
-  this->SliceXYToRAS->DeepCopy( this->SliceNode->GetXYToRAS() );
+  // Update the Slice node transform then update the DisplayNode pipelines to account for plane location.
+  // Only copy the matrix if it actually changed: copying bumps the matrix MTime, which would
+  // invalidate the MTime-based slice intersection caching in UpdateDisplayNodePipeline on
+  // slice node modifications that do not move the slice.
+  vtkMatrix4x4* xyToRAS = this->SliceNode->GetXYToRAS();
+  bool sliceXYToRASChanged = false;
+  for (int row = 0; row < 4 && !sliceXYToRASChanged; row++)
+    {
+    for (int col = 0; col < 4 && !sliceXYToRASChanged; col++)
+      {
+      if (this->SliceXYToRAS->GetElement(row, col) != xyToRAS->GetElement(row, col))
+        {
+        sliceXYToRASChanged = true;
+        }
+      }
+    }
+  if (sliceXYToRASChanged)
+    {
+    this->SliceXYToRAS->DeepCopy(xyToRAS);
+    }
   PipelinesCacheType::iterator displayNodeIt;
   for (displayNodeIt = this->DisplayPipelines.begin(); displayNodeIt != this->DisplayPipelines.end(); ++displayNodeIt)
     {
@@ -688,7 +707,7 @@ void vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::UpdateSegmentPipelin
 }
 
 //---------------------------------------------------------------------------
-void vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::UpdateDisplayNodePipeline(vtkMRMLSegmentationDisplayNode* displayNode, PipelineMapType pipelines)
+void vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::UpdateDisplayNodePipeline(vtkMRMLSegmentationDisplayNode* displayNode, const PipelineMapType &pipelines)
 {
   // Sets visibility, set pipeline polydata input, update color calculate and set pipeline segments.
   if (!displayNode)
@@ -696,6 +715,18 @@ void vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::UpdateDisplayNodePip
     return;
     }
   bool displayNodeVisible = this->IsVisible(displayNode);
+  if (!displayNodeVisible)
+    {
+    // Hide all segments and skip the per-segment updates while the display node is not visible
+    for (PipelineMapType::const_iterator pipelineIt=pipelines.begin(); pipelineIt!=pipelines.end(); ++pipelineIt)
+      {
+      pipelineIt->second->PolyDataOutlineActor->SetVisibility(false);
+      pipelineIt->second->PolyDataFillActor->SetVisibility(false);
+      pipelineIt->second->ImageOutlineActor->SetVisibility(false);
+      pipelineIt->second->ImageFillActor->SetVisibility(false);
+      }
+    return;
+    }
 
   // Get segmentation display node
   vtkMRMLSegmentationDisplayNode* segmentationDisplayNode = vtkMRMLSegmentationDisplayNode::SafeDownCast(displayNode);
@@ -705,7 +736,7 @@ void vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::UpdateDisplayNodePip
   if (shownRepresenatationName.empty())
     {
     // Hide segmentation if there is no 2D representation to show
-    for (PipelineMapType::iterator pipelineIt=pipelines.begin(); pipelineIt!=pipelines.end(); ++pipelineIt)
+    for (PipelineMapType::const_iterator pipelineIt=pipelines.begin(); pipelineIt!=pipelines.end(); ++pipelineIt)
       {
       pipelineIt->second->PolyDataOutlineActor->SetVisibility(false);
       pipelineIt->second->PolyDataFillActor->SetVisibility(false);
@@ -733,8 +764,12 @@ void vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::UpdateDisplayNodePip
     return;
     }
 
+  // Compute the RAS to slice XY transform once for all segments, it only depends on the slice node
+  vtkNew<vtkMatrix4x4> rasToSliceXY;
+  vtkMatrix4x4::Invert(this->SliceXYToRAS, rasToSliceXY.GetPointer());
+
   // For all pipelines (pipeline per segment)
-  for (PipelineMapType::iterator pipelineIt=pipelines.begin(); pipelineIt!=pipelines.end(); ++pipelineIt)
+  for (PipelineMapType::const_iterator pipelineIt=pipelines.begin(); pipelineIt!=pipelines.end(); ++pipelineIt)
     {
     Pipeline* pipeline = pipelineIt->second;
 
@@ -774,7 +809,7 @@ void vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::UpdateDisplayNodePip
       continue;
       }
 
-    bool visibleInCurrentSlice = this->IsSegmentVisibleInCurrentSlice(displayNode, pipeline, pipelineIt->first);
+    bool visibleInCurrentSlice = this->IsSegmentVisibleInCurrentSlice(displayNode, pipeline, pipelineIt->first, rasToSliceXY.GetPointer());
     if (!visibleInCurrentSlice)
       {
       pipeline->PolyDataOutlineActor->SetVisibility(false);
@@ -807,8 +842,6 @@ void vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::UpdateDisplayNodePip
         pipeline->Plane->Modified();
 
         // Set PolyData transform
-        vtkNew<vtkMatrix4x4> rasToSliceXY;
-        vtkMatrix4x4::Invert(this->SliceXYToRAS, rasToSliceXY.GetPointer());
         pipeline->WorldToSliceTransform->SetMatrix(rasToSliceXY.GetPointer());
 
         if (segmentFillVisible)
@@ -1082,7 +1115,8 @@ bool vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::UseDisplayableNode(v
 
 //---------------------------------------------------------------------------
 bool vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::IsSegmentVisibleInCurrentSlice(
-  vtkMRMLSegmentationDisplayNode* displayNode, Pipeline* pipeline, const std::string &segmentID)
+  vtkMRMLSegmentationDisplayNode* displayNode, Pipeline* pipeline, const std::string &segmentID,
+  vtkMatrix4x4* rasToSliceXY)
 {
   vtkMRMLSegmentationNode* segmentationNode = vtkMRMLSegmentationNode::SafeDownCast(
     displayNode->GetDisplayableNode() );
@@ -1105,9 +1139,7 @@ bool vtkMRMLSegmentationsDisplayableManager2D::vtkInternal::IsSegmentVisibleInCu
   segment->GetBounds(segmentBounds_Segment);
 
   vtkSmartPointer<vtkGeneralTransform> segmentationToSliceTransform = vtkSmartPointer<vtkGeneralTransform>::New();
-  vtkNew<vtkMatrix4x4> rasToSliceXY;
-  vtkMatrix4x4::Invert(this->SliceXYToRAS, rasToSliceXY.GetPointer());
-  segmentationToSliceTransform->Concatenate(rasToSliceXY.GetPointer());
+  segmentationToSliceTransform->Concatenate(rasToSliceXY);
   segmentationToSliceTransform->Concatenate(pipeline->NodeToWorldTransform);
 
   double segmentBounds_Slice[6] = { 0 };
@@ -98,6 +98,7 @@
 #include <QPointer>
 #include <QScrollArea>
 #include <QShortcut>
+#include <QTimer>
 #include <QToolButton>
 #include <QVBoxLayout>
 
@@ -188,6 +189,13 @@ public:
 
   bool updateReferenceGeometryImage();
 
+  /// Request precomputation of the editing buffers (aligned master volume,
+  /// selected segment labelmap) on the next timer timeout. The timer is
+  /// restarted on each request so that the expensive resampling only runs
+  /// once the inputs have settled.
+  /// \sa qMRMLSegmentEditorWidget::precomputeEditingBuffers()
+  void scheduleEditingBuffersPrecompute();
+
   static std::string getReferenceImageGeometryFromSegmentation(vtkSegmentation* segmentation);
   std::string referenceImageGeometry();
 
@@ -257,6 +265,15 @@ public:
   vtkMRMLTransformNode* AlignedMasterVolumeUpdateMasterVolumeNodeTransform;
   vtkMRMLTransformNode* AlignedMasterVolumeUpdateSegmentationNodeTransform;
 
+  /// Input data that was used for computing SelectedSegmentLabelmap.
+  /// It is stored so that it can be determined that the selected segment labelmap has to be updated
+  vtkSegment* SelectedSegmentLabelmapUpdateSegment;
+  std::string SelectedSegmentLabelmapUpdateGeometry;
+
+  /// Timer for deferred precomputation of the editing buffers
+  /// \sa scheduleEditingBuffersPrecompute()
+  QTimer PrecomputeEditingBuffersTimer;
+
   int MaskModeComboBoxFixedItemsCount;
 
   /// If reference geometry changes compared to this value then we notify effects and
@@ -284,6 +301,7 @@ qMRMLSegmentEditorWidgetPrivate::qMRMLSegmentEditorWidgetPrivate(qMRMLSegmentEdi
   , AlignedMasterVolumeUpdateMasterVolumeNode(NULL)
   , AlignedMasterVolumeUpdateMasterVolumeNodeTransform(NULL)
   , AlignedMasterVolumeUpdateSegmentationNodeTransform(NULL)
+  , SelectedSegmentLabelmapUpdateSegment(NULL)
   , MaskModeComboBoxFixedItemsCount(0)
   , EffectButtonStyle(Qt::ToolButtonTextUnderIcon)
 {
@@ -407,6 +425,13 @@ void qMRMLSegmentEditorWidgetPrivate::init()
   q->qvtkConnect(this->SegmentationHistory, vtkCommand::ModifiedEvent,
     q, SLOT(onSegmentationHistoryChanged()));
 
+  // Precompute editing buffers during idle time, shortly after the inputs
+  // (segmentation, master volume, selected segment) have changed, so that
+  // activating an effect does not have to wait for resampling the volumes.
+  this->PrecomputeEditingBuffersTimer.setSingleShot(true);
+  this->PrecomputeEditingBuffersTimer.setInterval(500);
+  QObject::connect(&this->PrecomputeEditingBuffersTimer, SIGNAL(timeout()), q, SLOT(precomputeEditingBuffers()));
+
   // Widget properties
   this->SegmentsTableView->setSelectionMode(QAbstractItemView::SingleSelection);
   this->SegmentsTableView->setHeaderVisible(true);
@@ -557,18 +582,34 @@ bool qMRMLSegmentEditorWidgetPrivate::updateSelectedSegmentLabelmap()
     qCritical() << Q_FUNC_INFO << ": Failed to get binary labelmap representation in segmentation " << segmentationNode->GetName();
     return false;
     }
+
+  // If the input segment and the reference geometry did not change since the last
+  // update then the cached labelmap is up to date (it may have been filled in
+  // by deferred precomputation, \sa qMRMLSegmentEditorWidget::precomputeEditingBuffers).
+  if (this->SelectedSegmentLabelmapUpdateSegment == selectedSegment
+    && this->SelectedSegmentLabelmapUpdateGeometry == referenceImageGeometry
+    && segmentLabelmap->GetMTime() < this->SelectedSegmentLabelmap->GetMTime())
+    {
+    return true;
+    }
+
   int* extent = segmentLabelmap->GetExtent();
   if (extent[0] > extent[1] || extent[2] > extent[3] || extent[4] > extent[5])
     {
     vtkSegmentationConverter::DeserializeImageGeometry(referenceImageGeometry, this->SelectedSegmentLabelmap, false);
     this->SelectedSegmentLabelmap->SetExtent(0, -1, 0, -1, 0, -1);
     this->SelectedSegmentLabelmap->AllocateScalars(VTK_UNSIGNED_CHAR, 1);
-    return true;
     }
-  vtkNew<vtkOrientedImageData> referenceImage;
-  vtkNew<vtkMatrix4x4> referenceImageToWorld;
-  vtkSegmentationConverter::DeserializeImageGeometry(referenceImageGeometry, referenceImage.GetPointer(), false);
-  vtkOrientedImageDataResample::ResampleOrientedImageToReferenceOrientedImage(segmentLabelmap, referenceImage.GetPointer(), this->SelectedSegmentLabelmap, /*linearInterpolation=*/false);
+  else
+    {
+    vtkNew<vtkOrientedImageData> referenceImage;
+    vtkNew<vtkMatrix4x4> referenceImageToWorld;
+    vtkSegmentationConverter::DeserializeImageGeometry(referenceImageGeometry, referenceImage.GetPointer(), false);
+    vtkOrientedImageDataResample::ResampleOrientedImageToReferenceOrientedImage(segmentLabelmap, referenceImage.GetPointer(), this->SelectedSegmentLabelmap, /*linearInterpolation=*/false);
+    }
+
+  this->SelectedSegmentLabelmapUpdateSegment = selectedSegment;
+  this->SelectedSegmentLabelmapUpdateGeometry = referenceImageGeometry;
 
   return true;
 }
@@ -638,8 +679,20 @@ bool qMRMLSegmentEditorWidgetPrivate::updateAlignedMasterVolume()
   vtkNew<vtkGeneralTransform> masterVolumeToSegmentationTransform;
   vtkMRMLTransformNode::GetTransformBetweenNodes(masterVolumeNode->GetParentTransformNode(), segmentationNode->GetParentTransformNode(), masterVolumeToSegmentationTransform.GetPointer());
 
-  vtkOrientedImageDataResample::ResampleOrientedImageToReferenceOrientedImage(masterVolume.GetPointer(), referenceImage.GetPointer(), this->AlignedMasterVolume,
-    /*linearInterpolation=*/true, /*padImage=*/false, masterVolumeToSegmentationTransform.GetPointer());
+  if (masterVolumeToSegmentationTransform->GetNumberOfConcatenatedTransforms() == 0
+    && vtkOrientedImageDataResample::DoGeometriesMatch(masterVolume.GetPointer(), referenceImage.GetPointer())
+    && vtkOrientedImageDataResample::DoExtentsMatch(masterVolume.GetPointer(), referenceImage.GetPointer()))
+    {
+    // The master volume is already on the reference grid. The aligned master
+    // volume is only read by the effects, so it can share the voxels of the
+    // master volume node instead of duplicating them.
+    this->AlignedMasterVolume->ShallowCopy(masterVolume.GetPointer());
+    }
+  else
+    {
+    vtkOrientedImageDataResample::ResampleOrientedImageToReferenceOrientedImage(masterVolume.GetPointer(), referenceImage.GetPointer(), this->AlignedMasterVolume,
+      /*linearInterpolation=*/true, /*padImage=*/false, masterVolumeToSegmentationTransform.GetPointer());
+    }
 
   this->AlignedMasterVolumeUpdateMasterVolumeNode = masterVolumeNode;
   this->AlignedMasterVolumeUpdateMasterVolumeNodeTransform = masterVolumeNode->GetParentTransformNode();
@@ -781,6 +834,12 @@ bool qMRMLSegmentEditorWidgetPrivate::updateReferenceGeometryImage()
   return vtkSegmentationConverter::DeserializeImageGeometry(geometry, this->ReferenceGeometryImage, false /* don't allocate scalars */);
 }
 
+//-----------------------------------------------------------------------------
+void qMRMLSegmentEditorWidgetPrivate::scheduleEditingBuffersPrecompute()
+{
+  this->PrecomputeEditingBuffersTimer.start();
+}
+
 //-----------------------------------------------------------------------------
 void qMRMLSegmentEditorWidgetPrivate::selectFirstSegment()
 {
@@ -1164,6 +1223,9 @@ void qMRMLSegmentEditorWidget::updateWidgetFromMRML()
   // Segmentation object might have been replaced, update selected segment
   this->onSegmentAddedRemoved();
 
+  // Editing inputs may have changed, warm up the editing buffers during idle time
+  d->scheduleEditingBuffersPrecompute();
+
   d->ParameterSetNode->EndModify(wasModified);
 }
 
@@ -2598,6 +2660,41 @@ void qMRMLSegmentEditorWidget::updateVolume(void* volumeToUpdate, bool& success)
     }
 }
 
+//-----------------------------------------------------------------------------
+void qMRMLSegmentEditorWidget::precomputeEditingBuffers()
+{
+  Q_D(qMRMLSegmentEditorWidget);
+  if (!this->isVisible() || d->Locked)
+    {
+    return;
+    }
+  if (!this->mrmlScene() || this->mrmlScene()->IsClosing())
+    {
+    return;
+    }
+  if (!d->ParameterSetNode || !d->ParameterSetNode->GetSegmentationNode())
+    {
+    return;
+    }
+  if (d->ActiveEffect)
+    {
+    // while an effect is active the buffers are kept up to date on demand
+    return;
+    }
+
+  // The update methods are no-ops when their cached output is already
+  // up to date, so precomputation only costs time when an input changed.
+  d->updateReferenceGeometryImage();
+  if (d->ParameterSetNode->GetMasterVolumeNode())
+    {
+    d->updateAlignedMasterVolume();
+    }
+  if (d->ParameterSetNode->GetSelectedSegmentID())
+    {
+    d->updateSelectedSegmentLabelmap();
+    }
+}
+
 //---------------------------------------------------------------------------
 void qMRMLSegmentEditorWidget::processEvents(vtkObject* caller,
                                         unsigned long eid,
@@ -364,6 +364,13 @@ protected slots:
   /// Update masking section on the UI
   void updateMaskingSection();
 
+  /// Precompute the common editing buffers (aligned master volume, selected
+  /// segment labelmap) during idle time, shortly after the editing inputs
+  /// changed, so that activating an effect does not stall on resampling.
+  /// Invoked by a single-shot timer that is restarted whenever the widget
+  /// is updated from MRML.
+  void precomputeEditingBuffers();
+
 protected:
   /// Callback function invoked when interaction happens
   static void processEvents(vtkObject* caller, unsigned long eid, void* clientData, void* callData);
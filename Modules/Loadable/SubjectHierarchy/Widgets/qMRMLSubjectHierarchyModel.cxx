@@ -1241,6 +1241,14 @@ void qMRMLSubjectHierarchyModel::onEvent(
 //------------------------------------------------------------------------------
 void qMRMLSubjectHierarchyModel::onSubjectHierarchyItemAdded(vtkIdType itemID)
 {
+  Q_D(qMRMLSubjectHierarchyModel);
+  if (d->MRMLScene->IsClosing() || d->MRMLScene->IsBatchProcessing())
+    {
+    // All items are inserted in one pass by updateFromSubjectHierarchy()
+    // when the batch ends, an incremental insert now would be discarded
+    // by that rebuild
+    return;
+    }
   this->insertSubjectHierarchyItem(itemID);
 }
 
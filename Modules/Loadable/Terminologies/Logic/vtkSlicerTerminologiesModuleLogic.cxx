@@ -138,7 +138,7 @@ public:
   void GetJsonCodeFromIdentifier(rapidjson::Value& code, CodeIdentifier idenfifier, rapidjson::Document::AllocatorType& allocator);
 
   /// Utility function for safe (memory-leak-free) setting of a document pointer in map
-  static void SetDocumentInTerminologyMap(TerminologyMap& terminologyMap, const std::string& name, rapidjson::Document* doc)
+  void SetDocumentInTerminologyMap(TerminologyMap& terminologyMap, const std::string& name, rapidjson::Document* doc)
     {
     if (terminologyMap.find(name) != terminologyMap.end())
       {
@@ -152,6 +152,8 @@ public:
       }
     // Set new document object
     terminologyMap[name] = doc;
+    // The lookup index may refer to arrays of the replaced document
+    this->CodeArrayIndexCache.clear();
     }
 
 public:
@@ -160,6 +162,13 @@ public:
 
   /// Loaded anatomical region contexts. Key is the context name, value is the root item.
   TerminologyMap LoadedAnatomicContexts;
+
+  /// Lazily built lookup index over Json code arrays. Keyed by the address
+  /// of the array (stable while the owning document is loaded), each entry
+  /// maps "CodingSchemeDesignator|CodeValue" to the element index, so
+  /// repeated code lookups in large dictionaries avoid a linear scan of
+  /// the arrays. Cleared whenever a context document is replaced.
+  std::map<rapidjson::Value*, std::map<std::string, int> > CodeArrayIndexCache;
 };
 
 //---------------------------------------------------------------------------
@@ -193,28 +202,44 @@ rapidjson::Value& vtkSlicerTerminologiesModuleLogic::vtkInternal::GetCodeInArray
     return JSON_EMPTY_VALUE;
     }
 
-  // Traverse array and try to find the object with given identifier
-  rapidjson::SizeType index = 0;
-  while (index<jsonArray.Size())
+  // Look the code up in the per-array index, building the index on first
+  // access. The terminology navigator performs many lookups in the large
+  // dictionaries, and a linear scan of the arrays per lookup is slow.
+  std::map<std::string, int>& arrayIndex = this->CodeArrayIndexCache[&jsonArray];
+  if (arrayIndex.empty())
     {
-    rapidjson::Value& currentObject = jsonArray[index];
-    if (currentObject.IsObject())
+    for (rapidjson::SizeType index = 0; index < jsonArray.Size(); ++index)
       {
+      rapidjson::Value& currentObject = jsonArray[index];
+      if (!currentObject.IsObject())
+        {
+        continue;
+        }
       rapidjson::Value& codingSchemeDesignator = currentObject["CodingSchemeDesignator"];
       rapidjson::Value& codeValue = currentObject["CodeValue"];
-      if ( codingSchemeDesignator.IsString() && !codeId.CodingSchemeDesignator.compare(codingSchemeDesignator.GetString())
-        && codeValue.IsString() && !codeId.CodeValue.compare(codeValue.GetString()) )
+      if (codingSchemeDesignator.IsString() && codeValue.IsString())
         {
-        foundIndex = index;
-        return currentObject;
+        std::string key = std::string(codingSchemeDesignator.GetString()) + "|" + codeValue.GetString();
+        if (arrayIndex.find(key) == arrayIndex.end())
+          {
+          // keep the first occurrence, as the linear search did
+          arrayIndex[key] = static_cast<int>(index);
+          }
         }
       }
-    ++index;
     }
 
-  // Not found
-  foundIndex = -1;
-  return JSON_EMPTY_VALUE;
+  std::map<std::string, int>::iterator codeIt =
+    arrayIndex.find(codeId.CodingSchemeDesignator + "|" + codeId.CodeValue);
+  if (codeIt == arrayIndex.end())
+    {
+    // Not found
+    foundIndex = -1;
+    return JSON_EMPTY_VALUE;
+    }
+
+  foundIndex = codeIt->second;
+  return jsonArray[static_cast<rapidjson::SizeType>(foundIndex)];
 }
 
 //---------------------------------------------------------------------------
@@ -1063,7 +1088,7 @@ bool vtkSlicerTerminologiesModuleLogic::LoadContextFromFile(std::string filePath
     {
     // Store terminology
     std::string contextName = (*jsonRoot)["SegmentationCategoryTypeContextName"].GetString();
-    vtkSlicerTerminologiesModuleLogic::vtkInternal::SetDocumentInTerminologyMap(
+    this->Internal->SetDocumentInTerminologyMap(
       this->Internal->LoadedTerminologies, contextName, jsonRoot);
     vtkDebugMacro("Terminology named '" << contextName << "' successfully loaded from file " << filePath);
     }
@@ -1071,7 +1096,7 @@ bool vtkSlicerTerminologiesModuleLogic::LoadContextFromFile(std::string filePath
     {
     // Store anatomic context
     std::string contextName = (*jsonRoot)["AnatomicContextName"].GetString();
-    vtkSlicerTerminologiesModuleLogic::vtkInternal::SetDocumentInTerminologyMap(
+    this->Internal->SetDocumentInTerminologyMap(
       this->Internal->LoadedAnatomicContexts, contextName, jsonRoot);
     vtkDebugMacro("Anatomic context named '" << contextName << "' successfully loaded from file " << filePath);
     }
@@ -1125,7 +1150,7 @@ std::string vtkSlicerTerminologiesModuleLogic::LoadTerminologyFromFile(std::stri
 
   // Store terminology
   std::string contextName = (*terminologyRoot)["SegmentationCategoryTypeContextName"].GetString();
-  vtkSlicerTerminologiesModuleLogic::vtkInternal::SetDocumentInTerminologyMap(
+  this->Internal->SetDocumentInTerminologyMap(
     this->Internal->LoadedTerminologies, contextName, terminologyRoot);
 
   vtkDebugMacro("Terminology named '" << contextName << "' successfully loaded from file " << filePath);
@@ -1175,7 +1200,7 @@ bool vtkSlicerTerminologiesModuleLogic::LoadTerminologyFromSegmentDescriptorFile
     }
 
   // Store terminology
-  vtkSlicerTerminologiesModuleLogic::vtkInternal::SetDocumentInTerminologyMap(
+  this->Internal->SetDocumentInTerminologyMap(
     this->Internal->LoadedTerminologies, contextName, convertedDoc );
 
   vtkDebugMacro("Terminology named '" << contextName << "' successfully loaded from file " << filePath);
@@ -1239,7 +1264,7 @@ std::string vtkSlicerTerminologiesModuleLogic::LoadAnatomicContextFromFile(std::
 
   // Store anatomic context
   std::string contextName = (*anatomicContextRoot)["AnatomicContextName"].GetString();
-  vtkSlicerTerminologiesModuleLogic::vtkInternal::SetDocumentInTerminologyMap(
+  this->Internal->SetDocumentInTerminologyMap(
     this->Internal->LoadedAnatomicContexts, contextName, anatomicContextRoot);
 
   vtkDebugMacro("Anatomic context named '" << contextName << "' successfully loaded from file " << filePath);
@@ -1289,7 +1314,7 @@ bool vtkSlicerTerminologiesModuleLogic::LoadAnatomicContextFromSegmentDescriptor
     }
 
   // Store anatomic context
-  vtkSlicerTerminologiesModuleLogic::vtkInternal::SetDocumentInTerminologyMap(
+  this->Internal->SetDocumentInTerminologyMap(
     this->Internal->LoadedAnatomicContexts, contextName, convertedDoc );
 
   vtkDebugMacro("Anatomic context named '" << contextName << "' successfully loaded from file " << filePath);
@@ -54,6 +54,13 @@ class vtkVolumeProperty;
 ///   logic->CreateVolumeRenderingDisplayNode();
 /// logic->UpdateDisplayNodeFromVolumeNode(displayNode, volumeNode);
 /// \endcode
+///
+/// Gradient computation for shading is owned by the VTK mappers and is not
+/// managed here: vtkFixedPointVolumeRayCastMapper precomputes and caches
+/// encoded gradient normal and magnitude tables across frames (rebuilt in
+/// parallel when the input volume changes), and vtkGPUVolumeRayCastMapper
+/// evaluates gradients in the shader. Neither mapper accepts an externally
+/// precomputed gradient texture, so the logic cannot usefully maintain one.
 class VTK_SLICER_VOLUMERENDERING_MODULE_LOGIC_EXPORT vtkSlicerVolumeRenderingLogic
   : public vtkSlicerModuleLogic
 {
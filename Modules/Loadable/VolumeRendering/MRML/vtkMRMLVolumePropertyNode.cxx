@@ -152,6 +152,12 @@ void vtkMRMLVolumePropertyNode::CopyParameterSet(vtkMRMLNode *anode)
     return;
     }
 
+  // Compress the modified events fired by the individual property and
+  // transfer function setters into a single one, so that applying a preset
+  // triggers one update of the observing render pipelines instead of one
+  // per copied parameter
+  int disabledModify = this->StartModify();
+
   vtkMRMLCopyBeginMacro(anode);
   vtkMRMLCopyVectorMacro(EffectiveRange, double, 2);
   vtkMRMLCopyEndMacro();
@@ -166,21 +172,18 @@ void vtkMRMLVolumePropertyNode::CopyParameterSet(vtkMRMLNode *anode)
     //TODO: No set method for GrayTransferFunction, ColorChannels, and DefaultGradientOpacity
 
     // Transfer functions
-    vtkColorTransferFunction* rgbTransfer = vtkColorTransferFunction::New();
-    rgbTransfer->DeepCopy(node->GetVolumeProperty()->GetRGBTransferFunction(i));
-    this->SetColor(rgbTransfer, i);
-    rgbTransfer->Delete();
-
-    vtkPiecewiseFunction* scalar = vtkPiecewiseFunction::New();
-    scalar->DeepCopy(node->GetVolumeProperty()->GetScalarOpacity(i));
-    this->SetScalarOpacity(scalar, i);
-    scalar->Delete();
-    this->VolumeProperty->SetScalarOpacityUnitDistance(i,this->VolumeProperty->GetScalarOpacityUnitDistance(i));
-
-    vtkPiecewiseFunction* gradient = vtkPiecewiseFunction::New();
-    gradient->DeepCopy(node->GetVolumeProperty()->GetGradientOpacity(i));
-    this->SetGradientOpacity(gradient, i);
-    gradient->Delete();
+    // Copy into the existing function objects: they are already observed, so
+    // allocating new functions here would re-wire the observers and notify
+    // the volume property once per replaced function
+    this->VolumeProperty->GetRGBTransferFunction(i)->DeepCopy(
+      node->GetVolumeProperty()->GetRGBTransferFunction(i));
+
+    this->VolumeProperty->GetScalarOpacity(i)->DeepCopy(
+      node->GetVolumeProperty()->GetScalarOpacity(i));
+    this->VolumeProperty->SetScalarOpacityUnitDistance(i, node->GetVolumeProperty()->GetScalarOpacityUnitDistance(i));
+
+    this->VolumeProperty->GetGradientOpacity(i)->DeepCopy(
+      node->GetVolumeProperty()->GetGradientOpacity(i));
 
     // Lighting
     this->VolumeProperty->SetDisableGradientOpacity(i,node->GetVolumeProperty()->GetDisableGradientOpacity(i));
@@ -190,6 +193,8 @@ void vtkMRMLVolumePropertyNode::CopyParameterSet(vtkMRMLNode *anode)
     this->VolumeProperty->SetSpecular(i, node->VolumeProperty->GetSpecular(i));
     this->VolumeProperty->SetSpecularPower(i, node->VolumeProperty->GetSpecularPower(i));
     }
+
+  this->EndModify(disabledModify);
 }
 
 //----------------------------------------------------------------------------
@@ -638,7 +638,7 @@ void vtkMRMLVolumeRenderingDisplayableManager::vtkInternal::UpdateDisplayNodePip
     {
     vtkFixedPointVolumeRayCastMapper* cpuMapper = vtkFixedPointVolumeRayCastMapper::SafeDownCast(mapper);
 
-    switch (viewNode->GetRaycastTechnique())
+    switch (viewNode->GetVolumeRenderingQuality())
       {
       case vtkMRMLViewNode::Adaptive:
         cpuMapper->SetAutoAdjustSampleDistances(true);
@@ -704,7 +704,7 @@ void vtkMRMLVolumeRenderingDisplayableManager::vtkInternal::UpdateDisplayNodePip
       vtkMRMLMultiVolumeRenderingDisplayNode::SafeDownCast(displayNode);
     vtkGPUVolumeRayCastMapper* gpuMultiMapper = vtkGPUVolumeRayCastMapper::SafeDownCast(mapper);
 
-    switch (viewNode->GetRaycastTechnique())
+    switch (viewNode->GetVolumeRenderingQuality())
       {
       case vtkMRMLViewNode::Adaptive:
         gpuMultiMapper->SetAutoAdjustSampleDistances(true);